@@ -0,0 +1,321 @@
+/*!
+ * \file benchmark_driver.cpp
+ * \brief Microbenchmarks for performance-critical kernels (the main()).
+ * \note Results are printed to screen and written as JSON for automated
+ * tracking of kernel-level performance between releases.
+ * \version 7.3.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2022, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <sstream>
+
+#include "../Common/include/parallelization/mpi_structure.hpp"
+#include "../Common/include/option_structure.hpp"
+#include "../Common/include/geometry/CPhysicalGeometry.hpp"
+#include "../Common/include/containers/container_decorators.hpp"
+#include "../Common/include/linear_algebra/CSysMatrix.hpp"
+#include "../Common/include/linear_algebra/CSysVector.hpp"
+#include "../Common/include/linear_algebra/CSysSolve.hpp"
+#include "../Common/include/linear_algebra/CMatrixVectorProduct.hpp"
+#include "../Common/include/linear_algebra/CPreconditioner.hpp"
+#include "../SU2_CFD/include/solvers/CSolver.hpp"
+#include "../SU2_CFD/include/gradients/computeGradientsGreenGauss.hpp"
+#include "../SU2_CFD/include/limiters/computeLimiters.hpp"
+#include "../SU2_CFD/include/numerics/flow/convection/roe.hpp"
+
+namespace {
+
+/*!
+ * \brief Timing statistics of one benchmark, all times in milliseconds.
+ */
+struct BenchmarkResult {
+  string name;
+  unsigned long repetitions;
+  passivedouble minTime, meanTime, medianTime, stddevTime;
+};
+
+/*!
+ * \brief Time a kernel with warmup and repetition, reporting basic statistics
+ * so that run-to-run noise can be told apart from real regressions.
+ */
+template <class Kernel>
+BenchmarkResult RunBenchmark(const string& name, unsigned long nWarmup, unsigned long nRepeat, Kernel kernel) {
+
+  for (auto i = 0ul; i < nWarmup; ++i) kernel();
+
+  vector<passivedouble> samples(nRepeat);
+  for (auto i = 0ul; i < nRepeat; ++i) {
+    const su2double start = SU2_MPI::Wtime();
+    kernel();
+    samples[i] = SU2_TYPE::GetValue(SU2_MPI::Wtime() - start) * 1e3;
+  }
+  sort(samples.begin(), samples.end());
+
+  BenchmarkResult result;
+  result.name = name;
+  result.repetitions = nRepeat;
+  result.minTime = samples.front();
+  result.medianTime = samples[nRepeat / 2];
+  result.meanTime = 0.0;
+  for (auto t : samples) result.meanTime += t;
+  result.meanTime /= nRepeat;
+  result.stddevTime = 0.0;
+  for (auto t : samples) result.stddevTime += pow(t - result.meanTime, 2);
+  result.stddevTime = sqrt(result.stddevTime / nRepeat);
+
+  if (SU2_MPI::GetRank() == MASTER_NODE) {
+    cout.precision(4);
+    cout << "  " << name << ": " << result.meanTime << " +/- " << result.stddevTime
+         << " ms (min " << result.minTime << ", median " << result.medianTime << ")" << endl;
+  }
+  return result;
+}
+
+/*!
+ * \brief Synthetic box mesh and config, built the same way as in the unit tests.
+ */
+struct BenchmarkCase {
+  std::unique_ptr<CConfig> config;
+  std::unique_ptr<CGeometry> geometry;
+
+  BenchmarkCase(unsigned long meshSize) {
+    auto origBuf = cout.rdbuf();
+    cout.rdbuf(nullptr);
+
+    stringstream ss;
+    ss << "SOLVER= NAVIER_STOKES\n"
+          "MESH_FORMAT= BOX\n"
+          "INIT_OPTION= TD_CONDITIONS\n"
+          "MARKER_HEATFLUX= (y_minus, 0.0, y_plus, 0.0)\n"
+          "MARKER_FAR= (x_minus, x_plus, z_plus, z_minus)\n"
+          "MESH_BOX_LENGTH= 1,1,1\n"
+          "MESH_BOX_OFFSET= 0,0,0\n"
+          "MESH_BOX_SIZE= " << meshSize << "," << meshSize << "," << meshSize << "\n";
+    config = std::unique_ptr<CConfig>(new CConfig(ss, SU2_COMPONENT::SU2_CFD, false));
+
+    {
+      auto aux_geometry = std::unique_ptr<CGeometry>(new CPhysicalGeometry(config.get(), 0, 1));
+      geometry = std::unique_ptr<CGeometry>(new CPhysicalGeometry(aux_geometry.get(), config.get()));
+    }
+    geometry->SetSendReceive(config.get());
+    geometry->SetBoundaries(config.get());
+    geometry->SetPoint_Connectivity();
+    geometry->SetElement_Connectivity();
+    geometry->SetBoundVolume();
+    geometry->SetEdges();
+    geometry->SetVertex(config.get());
+    geometry->SetControlVolume(config.get(), ALLOCATE);
+    geometry->SetBoundControlVolume(config.get(), ALLOCATE);
+    geometry->FindNormal_Neighbor(config.get());
+    geometry->SetGlobal_to_Local_Point();
+    geometry->PreprocessP2PComms(geometry.get(), config.get());
+
+    cout.rdbuf(origBuf);
+  }
+};
+
+/*!
+ * \brief Green-Gauss gradients and Venkatakrishnan limiters of a smooth field.
+ */
+void BenchmarkGradientsAndLimiters(BenchmarkCase& testCase, vector<BenchmarkResult>& results) {
+
+  auto& geometry = *testCase.geometry;
+  const auto& config = *testCase.config;
+  const auto nPoint = geometry.GetnPoint();
+  const auto nDim = geometry.GetnDim();
+  constexpr unsigned long nVar = 5;
+
+  su2activematrix field(nPoint, nVar);
+  for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint) {
+    const auto coord = geometry.nodes->GetCoord(iPoint);
+    for (auto iVar = 0ul; iVar < nVar; ++iVar)
+      field(iPoint, iVar) = sin((iVar + 1) * coord[0]) + cos((iVar + 1) * coord[1]) + coord[nDim - 1];
+  }
+
+  C3DDoubleMatrix gradient(nPoint, nVar, nDim);
+
+  results.push_back(RunBenchmark("green_gauss_gradients", 3, 20, [&]() {
+    computeGradientsGreenGauss(nullptr, SOLUTION, PERIODIC_NONE, geometry, config, field, 0, nVar, gradient);
+  }));
+
+  su2activematrix fieldMin(nPoint, nVar), fieldMax(nPoint, nVar), limiter(nPoint, nVar);
+
+  results.push_back(RunBenchmark("venkatakrishnan_limiters", 3, 20, [&]() {
+    computeLimiters(LIMITER::VENKATAKRISHNAN, nullptr, SOLUTION_LIMITER, PERIODIC_LIM_SOL_1, PERIODIC_LIM_SOL_2,
+                    geometry, config, 0, nVar, field, gradient, fieldMin, fieldMax, limiter);
+  }));
+}
+
+/*!
+ * \brief Sparse matrix-vector product and FGMRES on a block Laplacian.
+ */
+void BenchmarkLinearAlgebra(BenchmarkCase& testCase, vector<BenchmarkResult>& results) {
+
+  auto* geometry = testCase.geometry.get();
+  const auto* config = testCase.config.get();
+  const auto nPoint = geometry->GetnPoint();
+  const auto nPointDomain = geometry->GetnPointDomain();
+  constexpr unsigned short nVar = 5;
+
+  CSysMatrix<su2double> matrix;
+  matrix.Initialize(nPoint, nPointDomain, nVar, nVar, true, geometry, config);
+  matrix.SetValZero();
+
+  /*--- Fill with a diagonally dominant block Laplacian. ---*/
+
+  su2double offDiag[nVar * nVar] = {0.0};
+  for (auto iVar = 0u; iVar < nVar; ++iVar) offDiag[iVar * nVar + iVar] = -1.0;
+
+  for (auto iEdge = 0ul; iEdge < geometry->GetnEdge(); ++iEdge) {
+    const auto iPoint = geometry->edges->GetNode(iEdge, 0);
+    const auto jPoint = geometry->edges->GetNode(iEdge, 1);
+    matrix.SetBlock(iPoint, jPoint, offDiag);
+    matrix.SetBlock(jPoint, iPoint, offDiag);
+  }
+  for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint)
+    matrix.AddVal2Diag(iPoint, su2double(geometry->nodes->GetnPoint(iPoint)) + 1.0);
+
+  CSysVector<su2double> x(nPoint, nPointDomain, nVar, 1.0);
+  CSysVector<su2double> y(nPoint, nPointDomain, nVar, 0.0);
+  CSysVector<su2double> b(nPoint, nPointDomain, nVar, 1.0);
+
+  CSysMatrixVectorProduct<su2double> product(matrix, geometry, config);
+
+  results.push_back(RunBenchmark("sysmatrix_matrix_vector_product", 3, 20, [&]() {
+    for (int i = 0; i < 10; ++i) product(x, y);
+  }));
+
+  CJacobiPreconditioner<su2double> precond(matrix, geometry, config);
+  precond.Build();
+  CSysSolve<su2double> solver;
+
+  results.push_back(RunBenchmark("fgmres_jacobi_50_iters", 2, 10, [&]() {
+    x = su2double(0.0);
+    su2double residual;
+    /*--- Tight tolerance so all repetitions do the full 50 iterations. ---*/
+    solver.FGMRES_LinSolver(b, x, product, precond, 1e-30, 50, residual, false, config);
+  }));
+}
+
+/*!
+ * \brief Roe flux (with Jacobians) on synthetic left/right states.
+ */
+void BenchmarkRoeFlux(BenchmarkCase& testCase, vector<BenchmarkResult>& results) {
+
+  const auto* config = testCase.config.get();
+  const unsigned short nDim = 3, nVar = 5;
+  const su2double gamma = config->GetGamma();
+
+  CUpwRoe_Flow numerics(nDim, nVar, config, false);
+
+  /*--- Primitive states [T, u, v, w, p, rho, h, c], slightly different left/right. ---*/
+
+  su2double v_i[10] = {0.0}, v_j[10] = {0.0}, normal[3] = {0.8, 0.5, 0.3};
+
+  auto setState = [&](su2double* v, su2double rho, su2double p, su2double vel) {
+    v[1] = vel; v[2] = 0.1 * vel; v[3] = 0.05 * vel;
+    v[nDim + 1] = p;
+    v[nDim + 2] = rho;
+    v[nDim + 3] = gamma / (gamma - 1.0) * p / rho + 0.5 * (v[1] * v[1] + v[2] * v[2] + v[3] * v[3]);
+  };
+  setState(v_i, 1.2, 101325.0, 50.0);
+  setState(v_j, 1.1, 99000.0, 60.0);
+
+  numerics.SetPrimitive(v_i, v_j);
+  numerics.SetNormal(normal);
+
+  su2double sum = 0.0;
+
+  results.push_back(RunBenchmark("roe_flux_100k_faces", 3, 20, [&]() {
+    for (int i = 0; i < 100000; ++i) {
+      auto residual = numerics.ComputeResidual(config);
+      /*--- Consume the flux so the computation cannot be optimized out. ---*/
+      sum += residual[0];
+    }
+  }));
+
+  if (sum == numeric_limits<su2double>::max()) cout << sum << endl;
+}
+
+/*!
+ * \brief Write the results as JSON for automated regression tracking.
+ */
+void WriteResults(const string& fileName, unsigned long meshSize, const vector<BenchmarkResult>& results) {
+
+  if (SU2_MPI::GetRank() != MASTER_NODE) return;
+
+  ofstream json(fileName);
+  json.precision(6);
+  json << "{\n";
+  json << "  \"mesh_box_size\": " << meshSize << ",\n";
+  json << "  \"num_ranks\": " << SU2_MPI::GetSize() << ",\n";
+  json << "  \"num_threads\": " << omp_get_max_threads() << ",\n";
+  json << "  \"benchmarks\": [\n";
+  for (auto i = 0ul; i < results.size(); ++i) {
+    const auto& r = results[i];
+    json << "    {\"name\": \"" << r.name << "\", \"repetitions\": " << r.repetitions
+         << ", \"min_ms\": " << r.minTime << ", \"mean_ms\": " << r.meanTime
+         << ", \"median_ms\": " << r.medianTime << ", \"stddev_ms\": " << r.stddevTime << "}"
+         << (i + 1 < results.size() ? ",\n" : "\n");
+  }
+  json << "  ]\n}\n";
+
+  cout << "\nResults written to " << fileName << endl;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+
+  /*--- Startup MPI, if supported ---*/
+#if defined(HAVE_OMP) && defined(HAVE_MPI)
+  int provided;
+  SU2_MPI::Init_thread(&argc, &argv, MPI_THREAD_FUNNELED, &provided);
+#else
+  SU2_MPI::Init(&argc, &argv);
+#endif
+  {
+    /*--- Optional arguments: mesh size per dimension and output file name. ---*/
+
+    const unsigned long meshSize = (argc > 1) ? atol(argv[1]) : 33;
+    const string fileName = (argc > 2) ? argv[2] : "benchmarks.json";
+
+    if (SU2_MPI::GetRank() == MASTER_NODE)
+      cout << "Running kernel benchmarks on a " << meshSize << "^3 box mesh:" << endl;
+
+    BenchmarkCase testCase(meshSize);
+    vector<BenchmarkResult> results;
+
+    BenchmarkGradientsAndLimiters(testCase, results);
+    BenchmarkLinearAlgebra(testCase, results);
+    BenchmarkRoeFlux(testCase, results);
+
+    WriteResults(fileName, meshSize, results);
+  }
+  /*--- Finalize MPI parallelization ---*/
+  SU2_MPI::Finalize();
+
+  return 0;
+}
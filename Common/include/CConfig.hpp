@@ -129,6 +129,7 @@ private:
   Frozen_Visc_Disc,         /*!< \brief Flag for disc. adjoint problem with/without frozen viscosity. */
   Frozen_Limiter_Disc,      /*!< \brief Flag for disc. adjoint problem with/without frozen limiter. */
   Inconsistent_Disc,        /*!< \brief Use an inconsistent (primal/dual) discrete adjoint formulation. */
+  Compact_Adj_Tape,         /*!< \brief Keep the objective function out of the main discrete adjoint tape. */
   Sens_Remove_Sharp,        /*!< \brief Flag for removing or not the sharp edges from the sensitivity computation. */
   Hold_GridFixed,           /*!< \brief Flag hold fixed some part of the mesh during the deformation. */
   Axisymmetric,             /*!< \brief Flag for axisymmetric calculations */
@@ -152,6 +153,9 @@ private:
   su2double **DV_Value;              /*!< \brief Previous value of the design variable. */
   su2double Venkat_LimiterCoeff;     /*!< \brief Limiter coefficient */
   unsigned long LimiterIter;         /*!< \brief Freeze the value of the limiter after a number of iterations */
+  bool Fused_Gradient_Limiter;       /*!< \brief Compute Green-Gauss gradients and limiters in one fused sweep. */
+  bool Fused_Solver_Gradients;       /*!< \brief Compute the Green-Gauss gradients of the flow, turbulence and species solvers in one fused sweep. */
+  bool Recon_Gradient_Local_Halo;    /*!< \brief Reconstruct halo gradients locally instead of exchanging them. */
   su2double AdjSharp_LimiterCoeff;   /*!< \brief Coefficient to identify the limit of a sharp edge. */
   unsigned short SystemMeasurements; /*!< \brief System of measurements. */
   ENUM_REGIME Kind_Regime;           /*!< \brief Kind of flow regime: in/compressible. */
@@ -267,6 +271,10 @@ private:
   *Marker_Internal,               /*!< \brief Internal flow markers. */
   *Marker_All_TagBound;           /*!< \brief Global index for markers using grid information. */
 
+  mutable map<const string*, vector<unsigned short> >
+  Marker_PositionCache;           /*!< \brief Positions of each marker (by iMarker_All) in the per-BC-type tag arrays,
+                                              resolved once so the hot BC loops avoid the string scans (see GetMarker_Position). */
+
   su2double *Exhaust_Temperature_Target;     /*!< \brief Specified total temperatures for nacelle boundaries. */
   su2double *Exhaust_Pressure_Target;        /*!< \brief Specified total pressures for nacelle boundaries. */
   su2double *Inlet_Ttotal;                   /*!< \brief Specified total temperatures for inlet boundaries. */
@@ -400,6 +408,7 @@ private:
   unsigned long InnerIter;          /*!< \brief Current inner iterations for multizone problems. */
   unsigned long TimeIter;           /*!< \brief Current time iterations for multizone problems. */
   long Unst_AdjointIter;            /*!< \brief Iteration number to begin the reverse time integration in the direct solver for the unsteady adjoint. */
+  unsigned long Adjoint_Checkpoint_Interval; /*!< \brief Interval between direct solution files kept on disk for the unsteady adjoint, intermediate steps are recomputed. */
   long Iter_Avg_Objective;          /*!< \brief Iteration the number of time steps to be averaged, counting from the back */
   su2double PhysicalTime;           /*!< \brief Physical time at the current iteration in the solver for unsteady problems. */
 
@@ -413,12 +422,16 @@ private:
   su2double *RK_Alpha_Step;                 /*!< \brief Runge-Kutta beta coefficients. */
 
   unsigned short nQuasiNewtonSamples;  /*!< \brief Number of samples used in quasi-Newton solution methods. */
+  bool QuasiNewtonReuseHistory;  /*!< \brief Re-use the quasi-Newton history across time steps / outer iterations. */
   bool UseVectorization;       /*!< \brief Whether to use vectorized numerics schemes. */
+  bool DeterministicReductions; /*!< \brief Use fixed-order parallel reductions, making results independent of the number of threads. */
   bool NewtonKrylov;           /*!< \brief Use a coupled Newton method to solve the flow equations. */
   array<unsigned short,3> NK_IntParam{{20, 3, 2}}; /*!< \brief Integer parameters for NK method. */
   array<su2double,4> NK_DblParam{{-2.0, 0.1, -3.0, 1e-4}}; /*!< \brief Floating-point parameters for NK method. */
 
   unsigned short nMGLevels;    /*!< \brief Number of multigrid levels (coarse levels). */
+  unsigned long GridSeq_Iter;  /*!< \brief Number of startup iterations on each coarse level for grid sequencing. */
+  unsigned long MG_MinPointsPerRank; /*!< \brief Minimum number of interior CVs any rank may keep on a coarse level. */
   unsigned short nCFL;         /*!< \brief Number of CFL, one for each multigrid level. */
   su2double
   CFLRedCoeff_Turb,            /*!< \brief CFL reduction coefficient on the LevelSet problem. */
@@ -433,8 +446,10 @@ private:
   su2double SmoothingEps1;          /*!< \brief Parameter for the identity part in gradient smoothing. */
   su2double SmoothingEps2;          /*!< \brief Parameter for the Laplace part in gradient smoothing. */
   bool SmoothGradient;              /*!< \brief Flag for enabling gradient smoothing. */
+  bool ProjectGradient;             /*!< \brief Flag for projecting the gradient onto the design variables at adjoint convergence. */
   bool SmoothSepDim;                /*!< \brief Flag for enabling separated calculation for every dimension. */
   bool SmoothOnSurface;             /*!< \brief Flag for assembling the system only on the surface. */
+  bool SmoothMatrixFree;            /*!< \brief Flag for applying the volume smoothing operator matrix-free. */
   bool SmoothDirichletSurfaceBound; /*!< \brief Flag for using zero Dirichlet boundary in the surface case. */
   ENUM_SOBOLEV_MODUS SmoothNumMode; /*!< \brief The mode in which the Sobolev smoothing solver is applied. */
 
@@ -479,6 +494,7 @@ private:
   ENUM_MULTIZONE Kind_MZSolver;    /*!< \brief Kind of multizone solver.  */
   INC_DENSITYMODEL Kind_DensityModel; /*!< \brief Kind of the density model for incompressible flows. */
   CHT_COUPLING Kind_CHT_Coupling;  /*!< \brief Kind of coupling method used at CHT interfaces. */
+  bool CHT_Async_Coupling;         /*!< \brief Exchange CHT interface data asynchronously (one transfer old). */
   VISCOSITYMODEL Kind_ViscosityModel; /*!< \brief Kind of the Viscosity Model*/
   CONDUCTIVITYMODEL Kind_ConductivityModel; /*!< \brief Kind of the Thermal Conductivity Model */
   CONDUCTIVITYMODEL_TURB Kind_ConductivityModel_Turb; /*!< \brief Kind of the Turbulent Thermal Conductivity Model */
@@ -502,6 +518,8 @@ private:
   Kind_Deform_Linear_Solver_Prec,        /*!< \brief Preconditioner of the linear solver. */
   Kind_Linear_Solver,                    /*!< \brief Numerical solver for the implicit scheme. */
   Kind_Linear_Solver_Prec,               /*!< \brief Preconditioner of the linear solver. */
+  Kind_Turb_Linear_Solver,               /*!< \brief Numerical solver for the scalar (turbulence/species) systems. */
+  Kind_Turb_Linear_Solver_Prec,          /*!< \brief Preconditioner of the scalar linear solver. */
   Kind_AdjTurb_Linear_Solver,            /*!< \brief Numerical solver for the turbulent adjoint implicit scheme. */
   Kind_AdjTurb_Linear_Prec,              /*!< \brief Preconditioner of the turbulent adjoint linear solver. */
   Kind_DiscAdj_Linear_Solver,            /*!< \brief Linear solver for the discrete adjoint system. */
@@ -563,6 +581,8 @@ private:
   bool EulerPersson;       /*!< \brief Boolean to determine whether this is an Euler simulation with Persson shock capturing. */
   bool FSI_Problem = false,/*!< \brief Boolean to determine whether the simulation is FSI or not. */
   Multizone_Problem;       /*!< \brief Boolean to determine whether we are solving a multizone problem. */
+  bool Multizone_SkipConverged;  /*!< \brief Skip solving converged zones until their coupling inputs change. */
+  su2double Multizone_SkipTol;   /*!< \brief Relative change of the transferred data that re-activates a skipped zone. */
   unsigned short nID_DV;   /*!< \brief ID for the region of FEM when computed using direct differentiation. */
 
   bool AD_Mode;             /*!< \brief Algorithmic Differentiation support. */
@@ -594,10 +614,23 @@ private:
   su2double Deform_Linear_Solver_Error;          /*!< \brief Min error of the linear solver for the implicit formulation. */
   su2double Linear_Solver_Smoother_Relaxation;   /*!< \brief Relaxation factor for iterative linear smoothers. */
   unsigned long Linear_Solver_Iter;              /*!< \brief Max iterations of the linear solver for the implicit formulation. */
+  unsigned long Turb_Linear_Solver_Iter;         /*!< \brief Max iterations of the linear solver for the scalar (turbulence/species) systems. */
   unsigned long Deform_Linear_Solver_Iter;       /*!< \brief Max iterations of the linear solver for the implicit formulation. */
   unsigned long Linear_Solver_Restart_Frequency; /*!< \brief Restart frequency of the linear solver for the implicit formulation. */
+  unsigned short Linear_Solver_Recycle;          /*!< \brief Number of FGMRES directions recycled between consecutive solves. */
+  unsigned short Linear_Solver_Refine_Iter;      /*!< \brief Iterative refinement corrections of the linear solver (mixed precision builds). */
   unsigned long Linear_Solver_Prec_Threads;      /*!< \brief Number of threads per rank for ILU and LU_SGS preconditioners. */
   unsigned short Linear_Solver_ILU_n;            /*!< \brief ILU fill=in level. */
+  bool Linear_Solver_ILU_LevelSched;             /*!< \brief Use a level-scheduled (exact in-rank) ILU factorization and solve. */
+  su2double Linear_Solver_ILU_RefreshTol;        /*!< \brief Relative row-change threshold for incremental ILU refactorization. */
+  unsigned short Jacobian_Lag_Flow;              /*!< \brief Nonlinear iterations the flow solver reuses its Jacobian. */
+  unsigned short Jacobian_Lag_Turb;              /*!< \brief Nonlinear iterations the scalar solvers reuse their Jacobian. */
+  su2double Jacobian_Lag_Growth;                 /*!< \brief Linear iteration growth factor triggering an early Jacobian rebuild. */
+  su2double Jacobian_Lag_Sol_Change;             /*!< \brief Relative local solution change triggering an early Jacobian rebuild. */
+  unsigned short Gradient_Lag;                   /*!< \brief Inner iterations the flow solver reuses its reconstruction gradients and limiters. */
+  su2double Gradient_Lag_Growth;                 /*!< \brief RMS residual growth factor triggering an early gradient recompute. */
+  unsigned short Coupled_FlowTurb_Sweeps;        /*!< \brief Flow-turbulence block-Gauss-Seidel sweeps per nonlinear iteration. */
+  unsigned long Coupled_FlowTurb_StartIter;      /*!< \brief Inner iteration at which the extra flow-turbulence sweeps activate. */
   su2double SemiSpan;                   /*!< \brief Wing Semi span. */
   su2double Roe_Kappa;                  /*!< \brief Relaxation of the Roe scheme. */
   su2double Relaxation_Factor_Adjoint;  /*!< \brief Relaxation coefficient for variable updates of adjoint solvers. */
@@ -629,6 +662,10 @@ private:
   su2double Deform_Tol_Factor;       /*!< \brief Factor to multiply smallest volume for deform tolerance (0.001 default) */
   su2double Deform_Coeff;            /*!< \brief Deform coeffienct */
   su2double Deform_Limit;            /*!< \brief Deform limit */
+  bool Deform_IncrementalGridUpdate; /*!< \brief Update the dual grid incrementally after mesh deformation. */
+  su2double Deform_IncrementalTol;   /*!< \brief Displacement tolerance below which a point is treated as unmoved. */
+  bool Deform_ReuseStiffness;        /*!< \brief Reuse the assembled stiffness matrix across mesh deformations. */
+  bool Compact_Mesh_History;         /*!< \brief Store the mesh displacement history in single precision. */
   unsigned short FFD_Continuity;     /*!< \brief Surface continuity at the intersection with the FFD */
   unsigned short FFD_CoordSystem;    /*!< \brief Define the coordinates system */
   su2double Deform_ElasticityMod,    /*!< \brief Young's modulus for volume deformation stiffness model */
@@ -672,10 +709,21 @@ private:
   su2double Cauchy_Eps;               /*!< \brief Epsilon used for the convergence. */
   bool Restart,                       /*!< \brief Restart solution (for direct, adjoint, and linearized problems).*/
   Read_Binary_Restart,                /*!< \brief Read binary SU2 native restart files.*/
+  Read_Surface_Restart,               /*!< \brief Restart from a sparse surface restart file, free-stream interior.*/
+  Read_HighOrder_Restart,             /*!< \brief Restart the FEM DG solver from an element-collocated high-order restart file.*/
   Wrt_Restart_Overwrite,              /*!< \brief Overwrite restart files or append iteration number.*/
   Wrt_Surface_Overwrite,              /*!< \brief Overwrite surface output files or append iteration number.*/
   Wrt_Volume_Overwrite,               /*!< \brief Overwrite volume output files or append iteration number.*/
+  Wrt_Paraview_Compressed,            /*!< \brief Compress the appended data of paraview (.vtu) files with zlib.*/
+  Wrt_Packed_Multiblock,              /*!< \brief Pack all boundary markers of a zone into a single paraview multiblock surface dataset.*/
+  Wrt_CSV_Compressed,                 /*!< \brief Gzip-compress the surface CSV output files.*/
+  Wrt_Snapshot_SinglePrec,            /*!< \brief Write binary volume snapshots in single precision (except keyframes).*/
+  Wrt_Snapshot_Delta,                 /*!< \brief Delta-encode binary volume snapshots w.r.t. the previous write (except keyframes).*/
+  Wrt_Aggregate_Output,               /*!< \brief Funnel parallel binary output through one writer rank per node.*/
+  Wrt_Tecplot_Shared_Grid,            /*!< \brief Write the Tecplot binary grid zones once and solution-only files per snapshot.*/
+  Wrt_Transient_Output_Buffers,       /*!< \brief Release the volume output buffers between file writes.*/
   Restart_Flow;                       /*!< \brief Restart flow solution for adjoint and linearized problems. */
+  unsigned long Snapshot_Keyframe_Freq; /*!< \brief Number of writes between full-precision snapshot keyframes. */
   unsigned short nMarker_Monitoring,  /*!< \brief Number of markers to monitor. */
   nMarker_Designing,                  /*!< \brief Number of markers for the objective function. */
   nMarker_GeoEval,                    /*!< \brief Number of markers for the objective function. */
@@ -747,6 +795,10 @@ private:
   unsigned long StartWindowIteration; /*!< \brief Starting Iteration for long time Windowing apporach . */
   unsigned short nCFL_AdaptParam;     /*!< \brief Number of CFL parameters provided in config. */
   bool CFL_Adapt;        /*!< \brief Use adaptive CFL number. */
+  bool CFL_AdaptRollback;/*!< \brief Retry diverged nonlinear iterations from a solution snapshot at reduced CFL. */
+  bool PTC_SER;          /*!< \brief Use the SER-based pseudo-transient continuation controller for the adaptive CFL. */
+  su2double PTC_SER_Exponent;          /*!< \brief Exponent of the SER CFL growth law. */
+  su2double PTC_Newton_Residual_Drop;  /*!< \brief Residual reduction (orders) that triggers the Newton phase. */
   bool HB_Precondition;  /*!< \brief Flag to turn on harmonic balance source term preconditioning */
   su2double RefArea,     /*!< \brief Reference area for coefficient computation. */
   RefElemLength,         /*!< \brief Reference element length for computing the slope limiting epsilon. */
@@ -765,11 +817,20 @@ private:
   nRefOriginMoment_Z;      /*!< \brief Number of Z-coordinate moment computation origins. */
   unsigned short nMesh_Box_Size;
   short *Mesh_Box_Size;          /*!< \brief Array containing the number of grid points in the x-, y-, and z-directions for the analytic RECTANGLE and BOX grid formats. */
+  su2double *Probe_Locations;    /*!< \brief Coordinates of the sampling probes (x,y[,z] per probe). */
+  unsigned short nProbe_Locations; /*!< \brief Number of values in the probe location list (nDim per probe). */
+  unsigned long Probe_Wrt_Freq;  /*!< \brief Sampling frequency of the probes (iterations). */
+  string *Acoustic_Markers;      /*!< \brief Markers of the acoustic sampling surfaces (e.g. penetrable FWH surfaces). */
+  unsigned short nAcoustic_Markers; /*!< \brief Number of acoustic sampling markers. */
+  unsigned long Acoustic_Buffer_Steps; /*!< \brief Time steps buffered per rank before the acoustic samples are flushed. */
+  bool GeometryCache;            /*!< \brief Reuse expensive geometry preprocessing results (wall distances) cached next to the mesh file. */
   string Mesh_FileName,          /*!< \brief Mesh input file. */
   Mesh_Out_FileName,             /*!< \brief Mesh output file. */
   Solution_FileName,             /*!< \brief Flow solution input file. */
   Solution_AdjFileName,          /*!< \brief Adjoint solution input file for drag functional. */
   Volume_FileName,               /*!< \brief Flow variables output file. */
+  Probe_FileName,                /*!< \brief Probe time history output file (binary). */
+  Acoustic_FileName,             /*!< \brief Base name of the per-rank acoustic sample files (binary). */
   Conv_FileName,                 /*!< \brief Convergence history output file. */
   Breakdown_FileName,            /*!< \brief Breakdown output file. */
   Restart_FileName,              /*!< \brief Restart file for flow variables. */
@@ -782,9 +843,15 @@ private:
   SurfSens_FileName,             /*!< \brief Output file for the sensitivity on the surface (discrete adjoint). */
   VolSens_FileName,              /*!< \brief Output file for the sensitivity in the volume (discrete adjoint). */
   ObjFunc_Hess_FileName;         /*!< \brief Hessian approximation obtained by the Sobolev smoothing solver. */
+  string Performance_Record_FileName; /*!< \brief JSON-lines file the performance records are appended to. */
+  unsigned long Config_Hash = 0; /*!< \brief Hash of the raw config file contents, keys the performance records. */
 
   bool
   Wrt_Performance,           /*!< \brief Write the performance summary at the end of a calculation.  */
+  Wrt_Performance_Record,    /*!< \brief Append a machine-readable performance record at the end of a calculation.  */
+  Dual_Snapshot_Restart,     /*!< \brief Append the previous time step to binary restart files and restart 2nd-order dual time from one file.  */
+  ScalingBenchmark,          /*!< \brief Run a synthetic scaling benchmark on the analytic RECTANGLE / BOX grid. */
+  Wrt_AsyncOutput,           /*!< \brief Write the volume output files on a dedicated thread.  */
   Wrt_AD_Statistics,         /*!< \brief Write the tape statistics (discrete adjoint).  */
   Wrt_MeshQuality,           /*!< \brief Write the mesh quality statistics to the visualization files.  */
   Wrt_MultiGrid,             /*!< \brief Write the coarse grids to the visualization files.  */
@@ -994,6 +1061,8 @@ private:
   bool RadialBasisFunction_PolynomialOption; /*!< \brief Option of whether to include polynomial terms in Radial Basis Function Interpolation or not. */
   su2double RadialBasisFunction_Parameter;   /*!< \brief Radial basis function parameter (radius). */
   su2double RadialBasisFunction_PruneTol;    /*!< \brief Tolerance to prune the RBF interpolation matrix. */
+  unsigned long RadialBasisFunction_MaxControlPoints; /*!< \brief Maximum number of RBF control points selected greedily (0 = no limit). */
+  su2double RadialBasisFunction_FillTol;     /*!< \brief Fill-distance tolerance (relative to the radius) for the greedy RBF control point selection. */
   bool Prestretch;                           /*!< \brief Read a reference geometry for optimization purposes. */
   string Prestretch_FEMFileName;             /*!< \brief File name for reference geometry. */
   string FEA_FileName;              /*!< \brief File name for element-based properties. */
@@ -1007,6 +1076,13 @@ private:
   su2double ParMETIS_tolerance;     /*!< \brief Load balancing tolerance for ParMETIS. */
   long ParMETIS_pointWgt;           /*!< \brief Load balancing weight given to points. */
   long ParMETIS_edgeWgt;            /*!< \brief Load balancing weight given to edges. */
+  su2double ParMETIS_wallModelWgt;  /*!< \brief Load balancing weight multiplier for points on wall-function markers. */
+  unsigned short nMarker_PartitionWeight; /*!< \brief Number of markers with a prescribed partitioning weight. */
+  string *Marker_PartitionWeight;   /*!< \brief Markers with a prescribed partitioning cost multiplier. */
+  su2double *PartitionWeight;       /*!< \brief Partitioning cost multiplier of those markers. */
+  string PartitionMap_FileName;     /*!< \brief File to cache the ParMETIS point coloring between runs. */
+  unsigned long loadBalanceMonitorFreq;  /*!< \brief Frequency for monitoring the parallel load balance. */
+  su2double loadBalanceThreshold;   /*!< \brief Work imbalance ratio above which a rebalancing warning is printed. */
   unsigned short DirectDiff;        /*!< \brief Direct Differentation mode. */
   bool DiscreteAdjoint;                /*!< \brief AD-based discrete adjoint mode. */
   su2double Const_DES;                 /*!< \brief Detached Eddy Simulation Constant. */
@@ -1119,10 +1195,17 @@ private:
 
   unsigned long HistoryWrtFreq[3],    /*!< \brief Array containing history writing frequencies for timer iter, outer iter, inner iter */
                 ScreenWrtFreq[3];     /*!< \brief Array containing screen writing frequencies for timer iter, outer iter, inner iter */
+  bool LazyHistoryOutput;             /*!< \brief Evaluate only the requested history output groups and their dependencies. */
+  unsigned long HistoryEvalFreq;      /*!< \brief Evaluation frequency of requested history groups in lazy output mode. */
+  unsigned long MonitoringFlushFreq;  /*!< \brief Iterations between flushes of the buffered screen / history file output. */
   OUTPUT_TYPE* VolumeOutputFiles;     /*!< \brief File formats to output */
   unsigned short nVolumeOutputFiles=0;/*!< \brief Number of File formats to output */
   unsigned short nVolumeOutputFrequencies; /*!< \brief Number of frequencies for the volume outputs */
   unsigned long *VolumeOutputFrequencies; /*!< \brief list containing the writing frequencies */
+  string Output_Trigger_Field;            /*!< \brief History field monitored by the output trigger. */
+  su2double Output_Trigger_Threshold;     /*!< \brief Relative change per iteration that activates the output trigger. */
+  unsigned long Output_Trigger_Wrt_Freq;  /*!< \brief Volume output frequency while the output trigger is active. */
+  unsigned long Output_Trigger_Hold;      /*!< \brief Iterations the raised frequency is held after the trigger last fired. */
 
   bool Multizone_Mesh;            /*!< \brief Determines if the mesh contains multiple zones. */
   bool SinglezoneDriver;          /*!< \brief Determines if the single-zone driver is used. (TEMPORARY) */
@@ -1132,6 +1215,8 @@ private:
   Wrt_ForcesBreakdown;            /*!< \brief Determines if the forces breakdown file is written. */
   string *ScreenOutput,           /*!< \brief Kind of the screen output. */
   *HistoryOutput, *VolumeOutput;  /*!< \brief Kind of the output printed to the history file. */
+  su2double* OutputROIBox;        /*!< \brief Corners of the region-of-interest box for volume visualization output. */
+  unsigned short nOutputROIBox;   /*!< \brief Number of entries of the region-of-interest box (2*nDim). */
   unsigned short nScreenOutput,   /*!< \brief Number of screen output variables (max: 6). */
   nHistoryOutput, nVolumeOutput;  /*!< \brief Number of variables printed to the history file. */
   bool Multizone_Residual;        /*!< \brief Determines if memory should be allocated for the multizone residual. */
@@ -1149,6 +1234,11 @@ private:
   string caseName;                 /*!< \brief Name of the current case */
 
   unsigned long edgeColorGroupSize; /*!< \brief Size of the edge groups colored for OpenMP parallelization of edge loops. */
+  bool edgeReduction;               /*!< \brief Force the reducer strategy (natural edge order) instead of edge coloring. */
+  bool edgeColorCalibration;        /*!< \brief Measure the cost of the colored edge groups instead of estimating it. */
+  bool slimHalo;                    /*!< \brief Release the halo part of auxiliary fields that are only used for domain points. */
+  bool localityReordering;          /*!< \brief Sort the edge list for cache locality and report the RCM bandwidth reduction. */
+  bool numaDiagnostics;             /*!< \brief Report the page-to-NUMA-node placement of the largest solver allocations. */
 
   INLET_SPANWISE_INTERP Kind_InletInterpolationFunction; /*!brief type of spanwise interpolation function to use for the inlet face. */
   INLET_INTERP_TYPE Kind_Inlet_InterpolationType;    /*!brief type of spanwise interpolation data to use for the inlet face. */
@@ -1196,6 +1286,16 @@ private:
    */
   void SetDefault();
 
+  /*!
+   * \brief Delete the option decoder objects, only needed while parsing.
+   * \note Called at the end of construction for the per-zone configs of multizone
+   *       problems, which are the ones duplicated many times per rank. The base
+   *       config keeps its decoders, zone configs inherit values from them
+   *       (SetDefaultFromConfig) and the runtime file re-parsing uses them.
+   *       all_options is kept, OptionIsSet is queried during the run.
+   */
+  void ReleaseOptionStorage();
+
   /*--- all_options is a map containing all of the options. This is used during config file parsing
    to track the options which have not been set (so the default values can be used). Without this map
    there would be no list of all the config file options. ---*/
@@ -1565,6 +1665,30 @@ public:
    */
   bool GetCFL_Adapt(void) const { return CFL_Adapt; }
 
+  /*!
+   * \brief Get the value of the CFL adaption rollback flag.
+   * \return <code>TRUE</code> if diverged iterations are retried from a snapshot; otherwise <code>FALSE</code>.
+   */
+  bool GetCFL_AdaptRollback(void) const { return CFL_AdaptRollback; }
+
+  /*!
+   * \brief Get the value of the pseudo-transient continuation flag.
+   * \return <code>TRUE</code> if the SER controller drives the adaptive CFL; otherwise <code>FALSE</code>.
+   */
+  bool GetPTC_SER(void) const { return PTC_SER; }
+
+  /*!
+   * \brief Get the exponent of the SER CFL growth law.
+   * \return Exponent applied to the residual ratio.
+   */
+  su2double GetPTC_SER_Exponent(void) const { return PTC_SER_Exponent; }
+
+  /*!
+   * \brief Get the residual reduction that triggers the Newton phase of the SER controller.
+   * \return Orders of magnitude of residual reduction.
+   */
+  su2double GetPTC_Newton_Residual_Drop(void) const { return PTC_Newton_Residual_Drop; }
+
   /*!
    * \brief Get the value of the limits for the sections.
    * \return Value of the limits for the sections.
@@ -2303,6 +2427,26 @@ public:
    */
   su2double GetVenkat_LimiterCoeff(void) const { return Venkat_LimiterCoeff; }
 
+  /*!
+   * \brief Check if gradients and limiters for MUSCL reconstruction are computed in one fused sweep.
+   * \return <code>TRUE</code> means that the fused kernel is used when applicable.
+   */
+  bool GetFused_Gradient_Limiter(void) const { return Fused_Gradient_Limiter; }
+
+  /*!
+   * \brief Check if the Green-Gauss gradients of the flow, turbulence and species
+   *        solvers are batched into one fused sweep with a single round of halo exchanges.
+   * \return <code>TRUE</code> means that the fused multi-solver sweep is used when applicable.
+   */
+  bool GetFused_Solver_Gradients(void) const { return Fused_Solver_Gradients; }
+
+  /*!
+   * \brief Check if reconstruction gradients at halo points are computed locally from the
+   *        one-sided stencil instead of being exchanged, applies to least-squares methods.
+   * \return <code>TRUE</code> means that the gradient halo exchange is skipped for reconstruction.
+   */
+  bool GetRecon_Gradient_Local_Halo(void) const { return Recon_Gradient_Local_Halo; }
+
   /*!
    * \brief Freeze the value of the limiter after a number of iterations.
    * \return Number of iterations.
@@ -2696,6 +2840,18 @@ public:
    */
   void SetMGLevels(unsigned short val_nMGLevels) { nMGLevels = val_nMGLevels; }
 
+  /*!
+   * \brief Get the minimum number of interior CVs any rank may keep on a coarse multigrid level.
+   * \return Minimum coarse level size per rank, levels that degenerate below it are disabled.
+   */
+  unsigned long GetMG_MinPointsPerRank(void) const { return MG_MinPointsPerRank; }
+
+  /*!
+   * \brief Get the number of startup iterations on each coarse grid level for grid sequencing.
+   * \return Number of grid sequencing iterations per level (0 means no grid sequencing).
+   */
+  unsigned long GetGridSeq_Iter(void) const { return GridSeq_Iter; }
+
   /*!
    * \brief Get the index of the finest grid.
    * \return Index of the finest grid in a multigrid strategy, this is 0 unless we are
@@ -3044,6 +3200,13 @@ public:
    */
   long GetUnst_AdjointIter(void) const { return Unst_AdjointIter; }
 
+  /*!
+   * \brief Get the interval between direct solution files kept on disk for the unsteady adjoint.
+   *        Steps in between are recomputed from the preceding checkpoint during the reverse sweep.
+   * \return Checkpoint interval in time steps (1 means every step is stored).
+   */
+  unsigned long GetAdjoint_Checkpoint_Interval(void) const { return Adjoint_Checkpoint_Interval; }
+
   /*!
    * \brief Number of iterations to average (reverse time integration).
    * \return Starting direct iteration number for the unsteady adjoint.
@@ -3128,6 +3291,43 @@ public:
    */
   bool GetWrt_Performance(void) const { return Wrt_Performance; }
 
+  /*!
+   * \brief Get whether a machine-readable performance record is appended at the end of a calculation.
+   * \return <code>TRUE</code> means that a performance record will be appended.
+   */
+  bool GetWrt_Performance_Record(void) const { return Wrt_Performance_Record; }
+
+  /*!
+   * \brief Get whether binary restart files carry the previous time step so that 2nd-order
+   * dual-time restarts are a single contiguous read.
+   * \return <code>TRUE</code> means that dual-snapshot restart files are written and expected.
+   */
+  bool GetDual_Snapshot_Restart(void) const { return Dual_Snapshot_Restart; }
+
+  /*!
+   * \brief Get the name of the JSON-lines file the performance records are appended to.
+   * \return Name of the performance record file.
+   */
+  string GetPerformance_Record_FileName(void) const { return Performance_Record_FileName; }
+
+  /*!
+   * \brief Get the hash of the raw config file contents, used to key the performance records.
+   * \return Hash of the config file.
+   */
+  unsigned long GetConfig_Hash(void) const { return Config_Hash; }
+
+  /*!
+   * \brief Get whether a synthetic scaling benchmark is run on the analytic RECTANGLE / BOX grid.
+   * \return <code>TRUE</code> means that the scaling-benchmark mode is active.
+   */
+  bool GetScalingBenchmark(void) const { return ScalingBenchmark; }
+
+  /*!
+   * \brief Get information about writing the volume output files on a dedicated thread.
+   * \return <code>TRUE</code> means that the volume files will be written asynchronously.
+   */
+  bool GetWrt_AsyncOutput(void) const { return Wrt_AsyncOutput; }
+
   /*!
    * \brief Get information about the computational graph (e.g. memory usage) when using AD in reverse mode.
    * \return <code>TRUE</code> means that the tape statistics will be written after each recording.
@@ -3268,7 +3468,10 @@ public:
    * \param[in] val_marker - Index of the marker in which we are interested.
    * \param[in] val_index - Index of the surface read from geometry file.
    */
-  void SetMarker_All_TagBound(unsigned short val_marker, string val_index) { Marker_All_TagBound[val_marker] = val_index; }
+  void SetMarker_All_TagBound(unsigned short val_marker, string val_index) {
+    Marker_All_TagBound[val_marker] = val_index;
+    Marker_PositionCache.clear();
+  }
 
   /*!
    * \brief Set if a marker <i>val_marker</i> is going to be monitored <i>val_monitoring</i>
@@ -4044,6 +4247,24 @@ public:
    */
   unsigned short GetKind_Linear_Solver_Prec(void) const { return Kind_Linear_Solver_Prec; }
 
+  /*!
+   * \brief Get the kind of linear solver for the scalar (turbulence/species) systems.
+   * \return Numerical solver for the scalar implicit systems.
+   */
+  unsigned short GetKind_Turb_Linear_Solver(void) const { return Kind_Turb_Linear_Solver; }
+
+  /*!
+   * \brief Get the kind of preconditioner of the linear solver for the scalar (turbulence/species) systems.
+   * \return Numerical preconditioner for the scalar implicit systems.
+   */
+  unsigned short GetKind_Turb_Linear_Solver_Prec(void) const { return Kind_Turb_Linear_Solver_Prec; }
+
+  /*!
+   * \brief Get max number of iterations of the linear solver for the scalar (turbulence/species) systems.
+   * \return Max number of iterations of the scalar linear solver.
+   */
+  unsigned long GetTurb_Linear_Solver_Iter(void) const { return Turb_Linear_Solver_Iter; }
+
   /*!
    * \brief Get the kind of solver for the implicit solver.
    * \return Numerical solver for implicit formulation (solving the linear system).
@@ -4068,6 +4289,13 @@ public:
    */
   unsigned long GetLinear_Solver_Iter(void) const { return Linear_Solver_Iter; }
 
+  /*!
+   * \brief Get the number of iterative refinement corrections of the linear solver.
+   * \note Only effective in mixed precision builds, where the correction is accumulated in double.
+   * \return Number of refinement corrections after each linear solve.
+   */
+  unsigned short GetLinear_Solver_Refine_Iter(void) const { return Linear_Solver_Refine_Iter; }
+
   /*!
    * \brief Get max number of iterations of the linear solver for the implicit formulation.
    * \return Max number of iterations of the linear solver for the implicit formulation.
@@ -4080,12 +4308,81 @@ public:
    */
   unsigned short GetLinear_Solver_ILU_n(void) const { return Linear_Solver_ILU_n; }
 
+  /*!
+   * \brief Get whether the ILU preconditioner uses a level-scheduled traversal.
+   * \return <code>TRUE</code> if the level-scheduled (exact in-rank) ILU is used.
+   */
+  bool GetLinear_Solver_ILU_LevelSched(void) const { return Linear_Solver_ILU_LevelSched; }
+
+  /*!
+   * \brief Get the relative row-change threshold for incremental ILU refactorization.
+   * \return Threshold below which the stored factorization of a row is reused (0 = always refactor).
+   */
+  su2double GetLinear_Solver_ILU_RefreshTol(void) const { return Linear_Solver_ILU_RefreshTol; }
+
+  /*!
+   * \brief Get the number of nonlinear iterations the flow solver reuses its Jacobian.
+   * \return Jacobian lag of the flow solver, 1 means rebuild every iteration.
+   */
+  unsigned short GetJacobian_Lag_Flow(void) const { return Jacobian_Lag_Flow; }
+
+  /*!
+   * \brief Get the number of nonlinear iterations the scalar transport solvers reuse their Jacobian.
+   * \return Jacobian lag of the scalar solvers, 1 means rebuild every iteration.
+   */
+  unsigned short GetJacobian_Lag_Turb(void) const { return Jacobian_Lag_Turb; }
+
+  /*!
+   * \brief Get the linear iteration growth factor that triggers an early Jacobian rebuild.
+   * \return Growth factor w.r.t. the linear iterations right after the previous rebuild.
+   */
+  su2double GetJacobian_Lag_Growth(void) const { return Jacobian_Lag_Growth; }
+
+  /*!
+   * \brief Get the relative local solution change that triggers an early Jacobian rebuild.
+   * \return Maximum relative change of any solution variable since the previous rebuild, 0 disables the trigger.
+   */
+  su2double GetJacobian_Lag_Sol_Change(void) const { return Jacobian_Lag_Sol_Change; }
+
+  /*!
+   * \brief Get the number of inner iterations the flow solver reuses its reconstruction
+   *        gradients and limiters.
+   * \return Gradient lag of the flow solver, 1 means recompute every iteration.
+   */
+  unsigned short GetGradient_Lag(void) const { return Gradient_Lag; }
+
+  /*!
+   * \brief Get the RMS residual growth factor that triggers an early gradient recompute.
+   * \return Growth factor w.r.t. the RMS residual at the previous gradient computation.
+   */
+  su2double GetGradient_Lag_Growth(void) const { return Gradient_Lag_Growth; }
+
+  /*!
+   * \brief Get the number of flow-turbulence block-Gauss-Seidel sweeps per nonlinear iteration.
+   * \return Number of sweeps, 1 means the standard segregated iteration.
+   */
+  unsigned short GetCoupled_FlowTurb_Sweeps(void) const { return Coupled_FlowTurb_Sweeps; }
+
+  /*!
+   * \brief Get the inner iteration at which the extra flow-turbulence sweeps activate.
+   * \return First inner iteration with strengthened flow-turbulence coupling.
+   */
+  unsigned long GetCoupled_FlowTurb_StartIter(void) const { return Coupled_FlowTurb_StartIter; }
+
   /*!
    * \brief Get restart frequency of the linear solver for the implicit formulation.
    * \return Restart frequency of the linear solver for the implicit formulation.
    */
   unsigned long GetLinear_Solver_Restart_Frequency(void) const { return Linear_Solver_Restart_Frequency; }
 
+  /*!
+   * \brief Get the number of FGMRES directions recycled between consecutive solves.
+   *        The directions that contributed most to the previous solution update are
+   *        reused as deflation vectors, 0 disables recycling.
+   * \return Number of recycled directions.
+   */
+  unsigned short GetLinear_Solver_Recycle_Directions(void) const { return Linear_Solver_Recycle; }
+
   /*!
    * \brief Get the relaxation factor for iterative linear smoothers.
    * \return Relaxation factor.
@@ -4108,11 +4405,21 @@ public:
    */
   unsigned short GetnQuasiNewtonSamples(void) const { return nQuasiNewtonSamples; }
 
+  /*!
+   * \brief Get whether the quasi-Newton history is re-used across time steps (or outer iterations).
+   */
+  bool GetQuasiNewtonReuseHistory(void) const { return QuasiNewtonReuseHistory; }
+
   /*!
    * \brief Get whether to use vectorized numerics (if available).
    */
   bool GetUseVectorization(void) const { return UseVectorization; }
 
+  /*!
+   * \brief Get whether to use fixed-order parallel reductions (results independent of the number of threads).
+   */
+  bool GetDeterministicReductions(void) const { return DeterministicReductions; }
+
   /*!
    * \brief Get whether to use a Newton-Krylov method.
    */
@@ -4230,6 +4537,30 @@ public:
    */
   su2double GetDeform_Limit(void) const { return Deform_Limit; }
 
+  /*!
+   * \brief Get whether the dual grid is updated incrementally after mesh deformation.
+   * \return <code>TRUE</code> if only the metrics near moved points are recomputed.
+   */
+  bool GetDeform_IncrementalGridUpdate(void) const { return Deform_IncrementalGridUpdate; }
+
+  /*!
+   * \brief Get the displacement tolerance below which a point is treated as unmoved
+   *        by the incremental dual grid update.
+   */
+  su2double GetDeform_IncrementalTol(void) const { return Deform_IncrementalTol; }
+
+  /*!
+   * \brief Get whether the assembled stiffness matrix is reused across mesh deformations.
+   * \return <code>TRUE</code> if the matrix and its preconditioner are only assembled once.
+   */
+  bool GetDeform_ReuseStiffness(void) const { return Deform_ReuseStiffness; }
+
+  /*!
+   * \brief Get whether the mesh displacement history is stored in single precision.
+   * \return <code>TRUE</code> if the time levels n and n-1 of the mesh displacements are compacted.
+   */
+  bool GetCompact_Mesh_History(void) const { return Compact_Mesh_History; }
+
   /*!
    * \brief Get Young's modulus for deformation (constant stiffness deformation)
    */
@@ -4814,6 +5145,13 @@ public:
    */
   bool GetFrozen_Visc_Disc(void) const { return Frozen_Visc_Disc; }
 
+  /*!
+   * \brief Get whether the objective function is kept out of the main discrete adjoint tape,
+   *        with its gradient recorded and evaluated once per recording instead.
+   * \return <code>TRUE</code> if the compact tape is requested.
+   */
+  bool GetCompact_Adjoint_Tape(void) const { return Compact_Adj_Tape; }
+
   /*!
    * \brief Provides information about using an inconsistent (primal/dual) discrete adjoint formulation
    * \return <code>FALSE</code> means that the adjoint use the same numerical methods than the primal problem.
@@ -4869,6 +5207,13 @@ public:
    */
   INLET_TYPE GetKind_Inc_Inlet(string val_marker) const;
 
+  /*!
+   * \brief Get the type of incompressible inlet, by marker index (no string scan).
+   * \param[in] val_marker_all - Marker index using the grid information.
+   * \return Kind of the incompressible inlet.
+   */
+  INLET_TYPE GetKind_Inc_Inlet(unsigned short val_marker_all) const;
+
   /*!
    * \brief Get the total number of types in Kind_Inc_Inlet list
    * \return Total number of types in Kind_Inc_Inlet list
@@ -4887,6 +5232,13 @@ public:
    */
   INC_OUTLET_TYPE GetKind_Inc_Outlet(string val_marker) const;
 
+  /*!
+   * \brief Get the type of incompressible outlet, by marker index (no string scan).
+   * \param[in] val_marker_all - Marker index using the grid information.
+   * \return Kind of the incompressible outlet.
+   */
+  INC_OUTLET_TYPE GetKind_Inc_Outlet(unsigned short val_marker_all) const;
+
   /*!
    * \brief Get the damping factor applied to velocity updates at incompressible pressure inlets.
    * \return Damping factor applied to velocity updates at incompressible pressure inlets.
@@ -5259,12 +5611,62 @@ public:
    */
   bool GetRead_Binary_Restart(void) const { return Read_Binary_Restart; }
 
+  /*!
+   * \brief Flag for whether a sparse surface restart file is read instead of a volume restart.
+   * \return Flag for reading a surface restart, interior points keep their free-stream initialization.
+   */
+  bool GetRead_Surface_Restart(void) const { return Read_Surface_Restart; }
+
+  /*!
+   * \brief Flag for whether the FEM DG solver restarts from an element-collocated high-order restart file.
+   * \return Flag for reading a high-order restart, the element records are verified against the mesh.
+   */
+  bool GetRead_HighOrder_Restart(void) const { return Read_HighOrder_Restart; }
+
   /*!
    * \brief Flag for whether restart solution files are overwritten.
    * \return Flag for overwriting. If Flag=false, iteration nr is appended to filename
    */
   bool GetWrt_Restart_Overwrite(void) const { return Wrt_Restart_Overwrite; }
 
+  /*!
+   * \brief Flag for writing binary volume snapshots in single precision.
+   * \return Flag for single precision snapshot data, keyframes are always written in full precision.
+   */
+  bool GetWrt_Snapshot_SinglePrec(void) const { return Wrt_Snapshot_SinglePrec; }
+
+  /*!
+   * \brief Flag for delta-encoding binary volume snapshots w.r.t. the previously written step.
+   * \return Flag for delta encoding, keyframes are always written as full snapshots.
+   */
+  bool GetWrt_Snapshot_Delta(void) const { return Wrt_Snapshot_Delta; }
+
+  /*!
+   * \brief Flag for funneling the parallel binary output through one writer rank per node.
+   * \return Flag for node-level output aggregation, the file layout is not affected.
+   */
+  bool GetWrt_Aggregate_Output(void) const { return Wrt_Aggregate_Output; }
+
+  /*!
+   * \brief Flag for writing the Tecplot binary grid zones to a shared grid file once,
+   *        with solution-only (.szplt) files per snapshot.
+   * \return Flag for shared-grid Tecplot binary output.
+   */
+  bool GetWrt_Tecplot_Shared_Grid(void) const { return Wrt_Tecplot_Shared_Grid; }
+
+  /*!
+   * \brief Flag for releasing the volume output buffers between file writes, so that
+   *        they are not kept resident for the whole run.
+   * \return Flag for transient output buffers.
+   */
+  bool GetWrt_Transient_Output_Buffers(void) const { return Wrt_Transient_Output_Buffers; }
+
+  /*!
+   * \brief Number of writes between full-precision snapshot keyframes.
+   * \return Keyframe frequency when one of the snapshot reduction options is active.
+   */
+  unsigned long GetSnapshot_Keyframe_Freq(void) const { return Snapshot_Keyframe_Freq; }
+
     /*!
    * \brief Flag for whether visualization files are overwritten.
    * \return Flag for overwriting. If Flag=false, iteration nr is appended to filename
@@ -5277,6 +5679,25 @@ public:
    */
   bool GetWrt_Volume_Overwrite(void) const { return Wrt_Volume_Overwrite; }
 
+  /*!
+   * \brief Flag for whether the appended data of paraview (.vtu) files is compressed with zlib.
+   * \return Flag for compression.
+   */
+  bool GetWrt_Paraview_Compressed(void) const { return Wrt_Paraview_Compressed; }
+
+  /*!
+   * \brief Flag for packing all boundary markers of a zone into a single dataset of the
+   *        paraview multiblock (.vtm) output, instead of one dataset (file) per marker.
+   * \return Flag for packed multiblock output.
+   */
+  bool GetWrt_Packed_Multiblock(void) const { return Wrt_Packed_Multiblock; }
+
+  /*!
+   * \brief Flag for whether the surface CSV output files are gzip-compressed.
+   * \return Flag for compression.
+   */
+  bool GetWrt_CSV_Compressed(void) const { return Wrt_CSV_Compressed; }
+
   /*!
    * \brief Provides the number of varaibles.
    * \return Number of variables.
@@ -5347,6 +5768,13 @@ public:
    */
   string GetMesh_FileName(void) const { return Mesh_FileName; }
 
+  /*!
+   * \brief Check if expensive geometry preprocessing results (wall distances) should be
+   *        cached next to the mesh file and reused on subsequent runs of the same case.
+   * \return <code>TRUE</code> if the geometry cache is enabled.
+   */
+  bool GetGeometryCache(void) const { return GeometryCache; }
+
   /*!
    * \brief Get name of the output grid, this parameter is important for grid
    *        adaptation and deformation.
@@ -5423,6 +5851,54 @@ public:
    */
   string GetVolume_FileName(void) const { return Volume_FileName; }
 
+  /*!
+   * \brief Get the number of values in the probe location list (nDim values per probe).
+   * \return Number of probe location values.
+   */
+  unsigned short GetnProbe_Locations(void) const { return nProbe_Locations; }
+
+  /*!
+   * \brief Get the coordinates of the sampling probes (x,y[,z] per probe).
+   * \return Pointer to the probe location list.
+   */
+  const su2double* GetProbe_Locations(void) const { return Probe_Locations; }
+
+  /*!
+   * \brief Get the name of the file with the probe time histories.
+   * \return Name of the probe output file.
+   */
+  string GetProbe_FileName(void) const { return Probe_FileName; }
+
+  /*!
+   * \brief Get the sampling frequency of the probes.
+   * \return Probe sampling frequency in iterations.
+   */
+  unsigned long GetProbe_Wrt_Freq(void) const { return Probe_Wrt_Freq; }
+
+  /*!
+   * \brief Get the number of acoustic sampling markers.
+   * \return Number of acoustic sampling markers.
+   */
+  unsigned short GetnAcoustic_Markers(void) const { return nAcoustic_Markers; }
+
+  /*!
+   * \brief Get the tags of the acoustic sampling markers.
+   * \return Pointer to the list of marker tags.
+   */
+  const string* GetAcoustic_Markers(void) const { return Acoustic_Markers; }
+
+  /*!
+   * \brief Get the base name of the per-rank acoustic sample files.
+   * \return Name of the acoustic output file.
+   */
+  string GetAcoustic_FileName(void) const { return Acoustic_FileName; }
+
+  /*!
+   * \brief Get the number of time steps buffered per rank before the acoustic samples are flushed.
+   * \return Ring buffer depth in time steps.
+   */
+  unsigned long GetAcoustic_Buffer_Steps(void) const { return Acoustic_Buffer_Steps; }
+
   /*!
    * \brief Add any numbers necessary to the filename (iteration number, zone ID ...)
    * \param[in] filename - the base filename.
@@ -5543,6 +6019,12 @@ public:
    */
   string GetObjFunc_Extension(string val_filename) const;
 
+  /*!
+   * \brief Get the config-file name of the current objective function.
+   * \return Name of the objective function as it appears in the config file.
+   */
+  string GetObjFunc_Name(void) const;
+
   /*!
    * \brief Get functional that is going to be used to evaluate the residual flow convergence.
    * \return Functional that is going to be used to evaluate the residual flow convergence.
@@ -6580,6 +7062,13 @@ public:
    */
   su2double GetInlet_Ttotal(string val_index) const;
 
+  /*!
+   * \brief Get the total temperature at an inlet boundary, by marker index (no string scan).
+   * \param[in] val_marker_all - Marker index using the grid information.
+   * \return The total temperature.
+   */
+  su2double GetInlet_Ttotal(unsigned short val_marker_all) const;
+
   /*!
    * \brief Get the temperature at a supersonic inlet boundary.
    * \param[in] val_index - Index corresponding to the inlet boundary.
@@ -6587,6 +7076,13 @@ public:
    */
   su2double GetInlet_Temperature(string val_index) const;
 
+  /*!
+   * \brief Get the temperature at a supersonic inlet boundary, by marker index (no string scan).
+   * \param[in] val_marker_all - Marker index using the grid information.
+   * \return The inlet temperature.
+   */
+  su2double GetInlet_Temperature(unsigned short val_marker_all) const;
+
   /*!
    * \brief Get the pressure at a supersonic inlet boundary.
    * \param[in] val_index - Index corresponding to the inlet boundary.
@@ -6594,6 +7090,13 @@ public:
    */
   su2double GetInlet_Pressure(string val_index) const;
 
+  /*!
+   * \brief Get the pressure at a supersonic inlet boundary, by marker index (no string scan).
+   * \param[in] val_marker_all - Marker index using the grid information.
+   * \return The inlet pressure.
+   */
+  su2double GetInlet_Pressure(unsigned short val_marker_all) const;
+
   /*!
    * \brief Get the velocity vector at a supersonic inlet boundary.
    * \param[in] val_index - Index corresponding to the inlet boundary.
@@ -6601,6 +7104,13 @@ public:
    */
   const su2double* GetInlet_Velocity(string val_index) const;
 
+  /*!
+   * \brief Get the velocity vector at a supersonic inlet boundary, by marker index (no string scan).
+   * \param[in] val_marker_all - Marker index using the grid information.
+   * \return The inlet velocity vector.
+   */
+  const su2double* GetInlet_Velocity(unsigned short val_marker_all) const;
+
   /*!
    * \brief Get the total pressure at an inlet boundary.
    * \param[in] val_index - Index corresponding to the inlet boundary.
@@ -6608,6 +7118,13 @@ public:
    */
   su2double GetInlet_Ptotal(string val_index) const;
 
+  /*!
+   * \brief Get the total pressure at an inlet boundary, by marker index (no string scan).
+   * \param[in] val_marker_all - Marker index using the grid information.
+   * \return The total pressure.
+   */
+  su2double GetInlet_Ptotal(unsigned short val_marker_all) const;
+
   /*!
    * \brief Set the total pressure at an inlet boundary.
    * \param[in] val_pressure - Pressure value at the inlet boundary.
@@ -6622,6 +7139,13 @@ public:
    */
   const su2double* GetInlet_SpeciesVal(string val_index) const;
 
+  /*!
+   * \brief Get the species values at an inlet boundary, by marker index (no string scan).
+   * \param[in] val_marker_all - Marker index using the grid information.
+   * \return The inlet species values.
+   */
+  const su2double* GetInlet_SpeciesVal(unsigned short val_marker_all) const;
+
   /*!
    * \brief Get the total pressure at an nacelle boundary.
    * \param[in] val_index - Index corresponding to the inlet boundary.
@@ -6648,6 +7172,13 @@ public:
    */
   const su2double* GetInlet_FlowDir(string val_index) const;
 
+  /*!
+   * \brief Get the flow direction unit vector at an inlet boundary, by marker index (no string scan).
+   * \param[in] val_marker_all - Marker index using the grid information.
+   * \return The flow direction vector.
+   */
+  const su2double* GetInlet_FlowDir(unsigned short val_marker_all) const;
+
   /*!
    * \brief Get the back pressure (static) at an outlet boundary.
    * \param[in] val_index - Index corresponding to the outlet boundary.
@@ -6655,6 +7186,13 @@ public:
    */
   su2double GetOutlet_Pressure(string val_index) const;
 
+  /*!
+   * \brief Get the back pressure (static) at an outlet boundary, by marker index (no string scan).
+   * \param[in] val_marker_all - Marker index using the grid information.
+   * \return The outlet pressure.
+   */
+  su2double GetOutlet_Pressure(unsigned short val_marker_all) const;
+
   /*!
    * \brief Set the back pressure (static) at an outlet boundary.
    * \param[in] val_pressure - Pressure value at the outlet boundary.
@@ -6817,6 +7355,13 @@ public:
    */
   su2double GetIsothermal_Temperature(string val_index) const;
 
+  /*!
+   * \brief Get the wall temperature (static) at an isothermal boundary, by marker index (no string scan).
+   * \param[in] val_marker_all - Marker index using the grid information.
+   * \return The wall temperature.
+   */
+  su2double GetIsothermal_Temperature(unsigned short val_marker_all) const;
+
   /*!
    * \brief Get the wall heat flux on a constant heat flux boundary.
    * \param[in] val_index - Index corresponding to the constant heat flux boundary.
@@ -6824,6 +7369,13 @@ public:
    */
   su2double GetWall_HeatFlux(string val_index) const;
 
+  /*!
+   * \brief Get the wall heat flux on a constant heat flux boundary, by marker index (no string scan).
+   * \param[in] val_marker_all - Marker index using the grid information.
+   * \return The heat flux.
+   */
+  su2double GetWall_HeatFlux(unsigned short val_marker_all) const;
+
   /*!
    * \brief Get the heat transfer coefficient on a heat transfer boundary.
    * \param[in] val_index - Index corresponding to the heat transfer boundary.
@@ -6831,6 +7383,13 @@ public:
    */
   su2double GetWall_HeatTransfer_Coefficient(string val_index) const;
 
+  /*!
+   * \brief Get the heat transfer coefficient on a heat transfer boundary, by marker index (no string scan).
+   * \param[in] val_marker_all - Marker index using the grid information.
+   * \return The heat transfer coefficient.
+   */
+  su2double GetWall_HeatTransfer_Coefficient(unsigned short val_marker_all) const;
+
   /*!
    * \brief Get the temperature at inifinty on a heat transfer boundary.
    * \param[in] val_index - Index corresponding to the heat transfer boundary.
@@ -6838,6 +7397,13 @@ public:
    */
   su2double GetWall_HeatTransfer_Temperature(string val_index) const;
 
+  /*!
+   * \brief Get the temperature at infinity on a heat transfer boundary, by marker index (no string scan).
+   * \param[in] val_marker_all - Marker index using the grid information.
+   * \return The temperature at infinity.
+   */
+  su2double GetWall_HeatTransfer_Temperature(unsigned short val_marker_all) const;
+
   /*!
    * \brief Get the wall function treatment for the given boundary marker.
    * \param[in] val_marker - String of the viscous wall marker.
@@ -6845,6 +7411,13 @@ public:
    */
   WALL_FUNCTIONS GetWallFunction_Treatment(string val_marker) const;
 
+  /*!
+   * \brief Get the wall function treatment for a viscous wall, by marker index (no string scan).
+   * \param[in] val_marker_all - Marker index using the grid information.
+   * \return The type of wall function treatment.
+   */
+  WALL_FUNCTIONS GetWallFunction_Treatment(unsigned short val_marker_all) const;
+
   /*!
    * \brief Get the additional integer info for the wall function treatment
             for the given boundary marker.
@@ -6868,6 +7441,13 @@ public:
    */
   pair<WALL_TYPE,su2double> GetWallRoughnessProperties(string val_marker) const;
 
+  /*!
+   * \brief Get the type of wall and roughness height on a wall boundary, by marker index (no string scan).
+   * \param[in] val_marker_all - Marker index using the grid information.
+   * \return The wall type and roughness height.
+   */
+  pair<WALL_TYPE,su2double> GetWallRoughnessProperties(unsigned short val_marker_all) const;
+
   /*!
    * \brief Get the target (pressure, massflow, etc) at an engine inflow boundary.
    * \param[in] val_index - Index corresponding to the engine inflow boundary.
@@ -8139,6 +8719,17 @@ public:
    */
   void SetConfig_Parsing(istream &config_buffer);
 
+  /*!
+   * \brief Get the raw contents of a config file, reading it once on the master
+   *        rank and broadcasting them to all other ranks. The contents are cached,
+   *        so the repeated per-zone and per-component instantiations of CConfig
+   *        parse from memory instead of hitting the file system again.
+   * \note  Must be called by all ranks (the broadcast is collective).
+   * \param[in] case_filename - Name of the config file.
+   * \return Reference to the cached file contents.
+   */
+  static const string& GetConfigFileContents(const string& case_filename);
+
   /*!
    * \brief Set the config file parsing.
    */
@@ -8154,6 +8745,24 @@ public:
    */
   void SetMarkers(SU2_COMPONENT val_software);
 
+  /*!
+   * \brief Position of boundary marker <i>iMarker_All</i> in a per-BC-type tag array
+   *        (nTags if the marker is not in the array). The positions of all markers are
+   *        resolved and cached on the first query of each array, the integer-indexed
+   *        per-marker getters used in the BC loops are then simple array accesses.
+   * \param[in] tags - One of the per-BC-type marker tag arrays.
+   * \param[in] nTags - Number of tags in the array.
+   * \param[in] iMarker_All - Marker index using the grid information.
+   */
+  unsigned short GetMarker_Position(const string* tags, unsigned short nTags, unsigned short iMarker_All) const;
+
+  /*!
+   * \brief Resolve the tag-array positions of the per-marker getters used in the BC
+   *        loops, queries during the solve are then read-only (safe under OpenMP).
+   *        Must be called after the geometry has set the marker tags.
+   */
+  void SetMarker_PositionCaches();
+
   /*!
    * \brief Config file output.
    */
@@ -8836,6 +9445,18 @@ public:
    */
   bool GetMultizone_Problem(void) const { return Multizone_Problem; }
 
+  /*!
+   * \brief Get whether converged zones are skipped until their coupling inputs change.
+   * \return <code>TRUE</code> if converged zones should be skipped.
+   */
+  bool GetMultizone_SkipConverged(void) const { return Multizone_SkipConverged; }
+
+  /*!
+   * \brief Get the relative change of the transferred data that re-activates a skipped zone.
+   * \return Tolerance on the relative change of the coupling inputs.
+   */
+  su2double GetMultizone_SkipTol(void) const { return Multizone_SkipTol; }
+
   /*!
    * \brief Get the ID for the FEA region that we want to compute the gradient for using direct differentiation
    * \return ID
@@ -8955,6 +9576,16 @@ public:
    */
   su2double GetRadialBasisFunctionPruneTol(void) const { return RadialBasisFunction_PruneTol; }
 
+  /*!
+   * \brief Get the maximum number of control points of the greedy RBF selection (0 means no limit).
+   */
+  unsigned long GetRadialBasisFunctionMaxControlPoints(void) const { return RadialBasisFunction_MaxControlPoints; }
+
+  /*!
+   * \brief Get the fill-distance tolerance (relative to the radius) of the greedy RBF selection.
+   */
+  su2double GetRadialBasisFunctionFillTol(void) const { return RadialBasisFunction_FillTol; }
+
   /*!
    * \brief Get the number of donor points to use in Nearest Neighbor interpolation.
    */
@@ -9080,6 +9711,12 @@ public:
    */
   CHT_COUPLING GetKind_CHT_Coupling() const { return Kind_CHT_Coupling; }
 
+  /*!
+   * \brief Check if the CHT interface data is exchanged asynchronously.
+   * \return YES if each zone consumes the partner data of the previous transfer instead of waiting.
+   */
+  bool GetCHT_AsyncCoupling() const { return CHT_Async_Coupling; }
+
   /*!
    * \brief Check if values passed to the BC_HeatFlux-Routine are already integrated.
    * \return YES if the passed values is the integrated heat flux over the marker's surface.
@@ -9266,6 +9903,13 @@ public:
    */
   su2double GetWall_Emissivity(string val_index) const;
 
+  /*!
+   * \brief Get the wall emissivity at a boundary, by marker index (no string scan).
+   * \param[in] val_marker_all - Marker index using the grid information.
+   * \return The wall emissivity.
+   */
+  su2double GetWall_Emissivity(unsigned short val_marker_all) const;
+
   /*!
    * \brief Get the value of the CFL condition for radiation solvers.
    * \return Value of the CFL condition for radiation solvers.
@@ -9345,6 +9989,19 @@ public:
    */
   unsigned short GetnVolumeOutput(void) const { return nVolumeOutput; }
 
+  /*!
+   * \brief Get the number of entries of the region-of-interest box for volume visualization output.
+   * \return Number of entries (0 if no region of interest was requested, 2*nDim otherwise).
+   */
+  unsigned short GetnOutputROIBox(void) const { return nOutputROIBox; }
+
+  /*!
+   * \brief Get one entry of the region-of-interest box for volume visualization output.
+   * \param[in] iVal - Index of the entry, (min coords, max coords).
+   * \return Coordinate value of the box corner.
+   */
+  su2double GetOutputROIBox(unsigned short iVal) const { return OutputROIBox[iVal]; }
+
   /*!
    * \brief Get the history output field iField
    */
@@ -9427,6 +10084,24 @@ public:
    */
   void SetHistory_Wrt_Freq(unsigned short iter, unsigned long nIter) { HistoryWrtFreq[iter] = nIter;}
 
+  /*!
+   * \brief Check if only the requested history output groups should be evaluated.
+   * \return <code>TRUE</code> means that history fields are updated lazily.
+   */
+  bool GetLazyHistoryOutput(void) const { return LazyHistoryOutput; }
+
+  /*!
+   * \brief Get the evaluation frequency of requested history groups in lazy output mode.
+   * \return Evaluation frequency (inner iterations).
+   */
+  unsigned long GetHistory_Eval_Freq(void) const { return HistoryEvalFreq; }
+
+  /*!
+   * \brief Get the number of iterations between flushes of the buffered screen and history file output.
+   * \return Flush frequency (inner iterations).
+   */
+  unsigned long GetMonitoringFlushFreq(void) const { return MonitoringFlushFreq; }
+
   /*!
    * \brief GetScreen_Wrt_Freq_Inner
    * \param[in] iter: index for Time (0), Outer (1), or Inner (2) iterations
@@ -9457,6 +10132,30 @@ public:
    */
   unsigned long GetVolumeOutputFrequency(unsigned short iFile) const { return VolumeOutputFrequencies[iFile]; }
 
+  /*!
+   * \brief Get the history field monitored by the output trigger.
+   * \return Name of the history field, "NONE" disables the trigger.
+   */
+  const string& GetOutput_Trigger_Field(void) const { return Output_Trigger_Field; }
+
+  /*!
+   * \brief Get the relative change per iteration of the monitored field that activates the output trigger.
+   * \return Relative change threshold.
+   */
+  su2double GetOutput_Trigger_Threshold(void) const { return Output_Trigger_Threshold; }
+
+  /*!
+   * \brief Get the volume output frequency used while the output trigger is active.
+   * \return Raised writing frequency.
+   */
+  unsigned long GetOutput_Trigger_Wrt_Freq(void) const { return Output_Trigger_Wrt_Freq; }
+
+  /*!
+   * \brief Get the number of iterations the raised output frequency is held after the trigger last fired.
+   * \return Hold interval in iterations.
+   */
+  unsigned long GetOutput_Trigger_Hold(void) const { return Output_Trigger_Hold; }
+
   /*!
    * \brief Get the desired factorization frequency for PaStiX
    * \return Number of calls to 'Build' that trigger re-factorization.
@@ -9499,6 +10198,32 @@ public:
    */
   unsigned long GetEdgeColoringGroupSize(void) const { return edgeColorGroupSize; }
 
+  /*!
+   * \brief Check if natural-order edge loops with a reduction phase are forced instead of edge coloring.
+   */
+  bool GetEdgeReduction(void) const { return edgeReduction; }
+
+  /*!
+   * \brief Check if the cost of the colored edge groups is measured (instead of estimated)
+   *        to order and schedule the parallel edge loops.
+   */
+  bool GetEdgeColoringCalibration(void) const { return edgeColorCalibration; }
+
+  /*!
+   * \brief Check if the halo-point storage of domain-only auxiliary fields should be released.
+   */
+  bool GetSlimHalo(void) const { return slimHalo; }
+
+  /*!
+   * \brief Check if the edge list should be re-sorted for cache locality after renumbering the points.
+   */
+  bool GetLocalityReordering(void) const { return localityReordering; }
+
+  /*!
+   * \brief Check if the page-to-NUMA-node placement of the largest solver allocations should be reported.
+   */
+  bool GetNumaDiagnostics(void) const { return numaDiagnostics; }
+
   /*!
    * \brief Get the ParMETIS load balancing tolerance.
    */
@@ -9514,6 +10239,39 @@ public:
    */
   long GetParMETIS_EdgeWeight() const { return ParMETIS_edgeWgt; }
 
+  /*!
+   * \brief Get the ParMETIS load balancing weight multiplier for points on wall-function markers.
+   */
+  passivedouble GetParMETIS_WallModelWeight() const { return SU2_TYPE::GetValue(ParMETIS_wallModelWgt); }
+
+  /*!
+   * \brief Get the name of the file used to cache the point-to-rank coloring between runs.
+   * \return The file name, empty if partition caching is disabled.
+   */
+  string GetPartitionMap_FileName() const { return PartitionMap_FileName; }
+
+  /*!
+   * \brief Get the partitioning cost multiplier prescribed for a marker.
+   * \param[in] val_marker - Name of the marker.
+   * \return The prescribed multiplier, or 0 if the marker has none.
+   */
+  passivedouble GetMarker_PartitionWeight(const string& val_marker) const {
+    for (unsigned short iMarker = 0; iMarker < nMarker_PartitionWeight; iMarker++)
+      if (Marker_PartitionWeight[iMarker] == val_marker)
+        return SU2_TYPE::GetValue(PartitionWeight[iMarker]);
+    return 0.0;
+  }
+
+  /*!
+   * \brief Get the frequency for monitoring the parallel load balance (0 means disabled).
+   */
+  unsigned long GetLoadBalanceMonitorFreq() const { return loadBalanceMonitorFreq; }
+
+  /*!
+   * \brief Get the work imbalance ratio above which a rebalancing warning is printed.
+   */
+  passivedouble GetLoadBalanceThreshold() const { return SU2_TYPE::GetValue(loadBalanceThreshold); }
+
   /*!
    * \brief Find the marker index (if any) that is part of a given interface pair.
    * \param[in] iInterface - Number of the interface pair being tested, starting at 0.
@@ -9557,6 +10315,13 @@ public:
    */
   bool GetSmoothGradient(void) const {return SmoothGradient; }
 
+  /*!
+   * \brief Check if the gradient should be projected onto the design variables at
+   *        the end of the discrete adjoint run (in-process replacement for SU2_DOT_AD).
+   * \return true means the driver performs the projection and writes the gradient file.
+   */
+  bool GetProjectGradient(void) const { return ProjectGradient; }
+
   /*!
    * \brief Gets the factor epsilon in front of the Laplace term
    * \return epsilon
@@ -9575,6 +10340,12 @@ public:
    */
   bool GetSmoothSepDim(void) const { return SmoothSepDim; }
 
+  /*!
+   * \brief Check if the volume smoothing operator is applied matrix-free
+   * \return true means the system is solved without assembling the stiffness matrix
+   */
+  bool GetSmoothMatrixFree(void) const { return SmoothMatrixFree; }
+
   /*!
    * \brief Check if we assemble the operator on the surface
    * \return true means that smoothing is done on the surface level
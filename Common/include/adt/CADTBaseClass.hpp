@@ -81,6 +81,32 @@ protected:
                 unsigned long   nPoints,
                 const su2double *coor);
 
+  /*!
+   * \brief Function, which refits the bounding boxes of the leaves to updated
+   *        coordinates, keeping the topology of the tree. Searches remain exact
+   *        after the update, only the balance of the tree is no longer optimal
+   *        for the new coordinates, which is fine for small deformations and
+   *        rigid motions.
+   * \param[in] coor Updated coordinates of the points, same size and order as
+   *                 the coordinates the ADT was built from.
+   */
+  void UpdateBoundingBoxes(const su2double *coor);
+
+  /*!
+   * \brief Function, which determines the order in which a batch of query
+   *        coordinates is processed, by sorting the queries along a Morton
+   *        space-filling curve. Consecutive queries are then close in space,
+   *        such that their tree traversals visit largely the same leaves and
+   *        each search can be warm started from the previous result.
+   * \param[in] nDim     Number of spatial dimensions.
+   * \param[in] nQueries Number of query coordinates.
+   * \param[in] coor     Query coordinates, nQueries times nDim values.
+   * \return Indices of the queries in Morton order.
+   */
+  static vector<unsigned long> DetermineMortonOrder(unsigned short      nDim,
+                                                    const unsigned long nQueries,
+                                                    const su2double     *coor);
+
 public:
 
   /*!
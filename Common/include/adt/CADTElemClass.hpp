@@ -30,6 +30,7 @@
 #include "./CADTBaseClass.hpp"
 #include "./CBBoxTargetClass.hpp"
 #include "../parallelization/omp_structure.hpp"
+#include "../parallelization/shared_memory.hpp"
 
 /*!
  * \class CADTElemClass
@@ -40,19 +41,24 @@
 class CADTElemClass : public CADTBaseClass {
 private:
   unsigned short nDim; /*!< \brief Number of spatial dimensions. */
+  bool isGlobalTree;   /*!< \brief Whether a global tree was built, i.e. whether the
+                                   points and elements of all ranks were gathered. */
 
-  vector<su2double>     coorPoints;    /*!< \brief Vector, which contains the coordinates
-                                                   of the points in the ADT. */
-  vector<su2double>     BBoxCoor;      /*!< \brief Vector, which contains the coordinates
-                                                   of the bounding boxes of the elements. */
+  CSharedMemoryArray<su2double> coorPoints; /*!< \brief Array, which contains the coordinates
+                                                        of the points in the ADT. For a global
+                                                        tree it is shared by the ranks of a node. */
+  CSharedMemoryArray<su2double> BBoxCoor;   /*!< \brief Array, which contains the coordinates
+                                                        of the bounding boxes of the elements.
+                                                        Shared like ::coorPoints. */
 
   vector<unsigned short> elemVTK_Type; /*!< \brief Vector, which the type of the elements
                                                    using the VTK convention. */
   vector<unsigned long> nDOFsPerElem;  /*!< \brief Vector, which contains the number of DOFs
                                                    of the elements in the ADT in cumulative
                                                    storage format. */
-  vector<unsigned long> elemConns;     /*!< \brief Vector, which contains the connectivities
-                                                   of the elements in the ADT. */
+  CSharedMemoryArray<unsigned long> elemConns; /*!< \brief Array, which contains the connectivities
+                                                           of the elements in the ADT.
+                                                           Shared like ::coorPoints. */
   vector<unsigned short> localMarkers; /*!< \brief Vector, which contains the marker ID's
                                                    of the elements in the ADT. */
   vector<unsigned long> localElemIDs;  /*!< \brief Vector, which contains the local element ID's
@@ -132,7 +138,44 @@ public:
               FrontLeavesNew[iThread], coor, dist, markerID, elemID, rankID);
   }
 
+  /*!
+   * \brief Function, which determines the nearest elements in the ADT for a batch of
+   *        coordinates. The queries are sorted along a space-filling curve and each
+   *        search is warm started from the element found by the previous (nearby)
+   *        query, which tightens the initial search radius and makes consecutive
+   *        traversals visit largely the same part of the tree.
+   * \note The batch is processed in parallel when OpenMP is active, hence this
+   *       function must be called outside of a parallel region.
+   * \param[in]  nQueries Number of query coordinates.
+   * \param[in]  coor     Query coordinates, nQueries times nDim values.
+   * \param[out] dist     Distances to the nearest element in the ADT.
+   * \param[out] markerID Local marker IDs of the nearest elements in the ADT.
+   * \param[out] elemID   Local element IDs of the nearest elements in the ADT.
+   * \param[out] rankID   Ranks on which the nearest elements in the ADT are stored.
+   */
+  void DetermineNearestElements(const unsigned long nQueries,
+                                const su2double     *coor,
+                                su2double           *dist,
+                                unsigned short      *markerID,
+                                unsigned long       *elemID,
+                                int                 *rankID);
+
+  /*!
+   * \brief Function, which updates the coordinates of the points in the ADT without
+   *        rebuilding it, for meshes that move while keeping their topology. The
+   *        bounding boxes are refit to the new coordinates, the topology of the tree
+   *        is kept, so searches remain exact (see CADTBaseClass::UpdateBoundingBoxes).
+   * \param[in] val_coor Updated coordinates of the local points, same points and
+   *                     order as in the constructor.
+   */
+  void UpdateCoordinates(const vector<su2double> &val_coor);
+
 private:
+  /*!
+   * \brief Function, which computes the bounding box coordinates of all elements.
+   */
+  void ComputeBoundingBoxes(void);
+
   /*!
    * \brief Implementation of DetermineContainingElement.
    * \note Working variables (first two) passed explicitly for thread safety.
@@ -149,15 +192,21 @@ private:
   /*!
    * \brief Implementation of DetermineNearestElement.
    * \note Working variables (first three) passed explicitly for thread safety.
+   *       An optional guess of the nearest element (internal ADT index, as
+   *       returned by this function) provides an initial upper bound on the
+   *       distance, which prunes the tree traversal.
+   * \return Internal ADT index of the nearest element, usable as guess for a
+   *         nearby follow-up query.
    */
-  void DetermineNearestElement_impl(vector<CBBoxTargetClass>& BBoxTargets,
-                                    vector<unsigned long>& frontLeaves,
-                                    vector<unsigned long>& frontLeavesNew,
-                                    const su2double *coor,
-                                    su2double       &dist,
-                                    unsigned short  &markerID,
-                                    unsigned long   &elemID,
-                                    int             &rankID) const;
+  unsigned long DetermineNearestElement_impl(vector<CBBoxTargetClass>& BBoxTargets,
+                                             vector<unsigned long>& frontLeaves,
+                                             vector<unsigned long>& frontLeavesNew,
+                                             const su2double *coor,
+                                             su2double       &dist,
+                                             unsigned short  &markerID,
+                                             unsigned long   &elemID,
+                                             int             &rankID,
+                                             const long      guessID = -1) const;
 
   /*!
    * \brief Function, which checks whether or not the given coordinate is
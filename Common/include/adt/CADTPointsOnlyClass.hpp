@@ -75,6 +75,26 @@ public:
                               coor, dist, pointID, rankID);
   }
 
+  /*!
+   * \brief Function, which determines the nearest nodes in the ADT for a batch of
+   *        coordinates. The queries are sorted along a space-filling curve and each
+   *        search is warm started from the node found by the previous (nearby)
+   *        query, which tightens the initial search radius and makes consecutive
+   *        traversals visit largely the same part of the tree.
+   * \note The batch is processed in parallel when OpenMP is active, hence this
+   *       function must be called outside of a parallel region.
+   * \param[in]  nQueries Number of query coordinates.
+   * \param[in]  coor     Query coordinates, nQueries times nDim values.
+   * \param[out] dist     Distances to the nearest node in the ADT.
+   * \param[out] pointID  Local point IDs of the nearest nodes in the ADT.
+   * \param[out] rankID   Ranks on which the nearest nodes in the ADT are stored.
+   */
+  void DetermineNearestNodes(const unsigned long nQueries,
+                             const su2double     *coor,
+                             su2double           *dist,
+                             unsigned long       *pointID,
+                             int                 *rankID);
+
   /*!
    * \brief Default constructor of the class, disabled.
    */
@@ -84,11 +104,16 @@ private:
   /*!
    * \brief Implementation of DetermineNearestNode.
    * \note Working variables (first two) passed explicitly for thread safety.
+   * \note The optional guess (internal index of a nearby node, e.g. the result
+   *       of a previous query) provides the initial search radius, which prunes
+   *       the traversal. The internal index of the nearest node is returned so
+   *       that it can serve as guess for a follow-up query.
    */
-  void DetermineNearestNode_impl(vector<unsigned long>& frontLeaves,
-                                 vector<unsigned long>& frontLeavesNew,
-                                 const su2double *coor,
-                                 su2double       &dist,
-                                 unsigned long   &pointID,
-                                 int             &rankID) const;
+  unsigned long DetermineNearestNode_impl(vector<unsigned long>& frontLeaves,
+                                          vector<unsigned long>& frontLeavesNew,
+                                          const su2double *coor,
+                                          su2double       &dist,
+                                          unsigned long   &pointID,
+                                          int             &rankID,
+                                          const long      guess = -1) const;
 };
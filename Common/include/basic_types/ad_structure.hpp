@@ -38,6 +38,13 @@
  */
 namespace AD{
 #ifndef CODI_REVERSE_TYPE
+  /*!
+   * \brief Compile-time constant indicating an AD-active build. Allows eliding runtime
+   * guards (e.g. thread-count queries) around the AD hooks at compile time in passive
+   * builds, where the hooks themselves are empty.
+   */
+  constexpr bool Active = false;
+
   /*!
    * \brief Start the recording of the operations and involved variables.
    * If called, the computational graph of all operations occuring after the call will be stored,
@@ -290,6 +297,11 @@ namespace AD{
   inline void EndNoSharedReading() {}
 
 #else
+  /*!
+   * \brief Compile-time constant indicating an AD-active build.
+   */
+  constexpr bool Active = true;
+
   using CheckpointHandler = codi::DataStore;
 
   using Tape = su2double::TapeType;
@@ -26,6 +26,7 @@
  */
 #pragma once
 
+#include <cstdint>
 #include <type_traits>
 
 #if defined(_MSC_VER)
@@ -121,6 +122,26 @@ using su2mixedfloat = float;
 using su2mixedfloat = passivedouble;
 #endif
 
+/*--- Storage type for the multigrid restriction/prolongation weights. Reduced
+ * precision where the weights can be passive, full precision for the AD builds
+ * where the geometric weights carry derivative information. ---*/
+#if defined(CODI_REVERSE_TYPE) || defined(CODI_FORWARD_TYPE)
+using su2mgfloat = su2double;
+#else
+using su2mgfloat = su2mixedfloat;
+#endif
+
+/*--- Index type for rank-local connectivity (edge endpoints and the column
+ * indices of the sparse matrix products). The compact build stores them in
+ * 32 bits, which halves the index memory traffic of the bandwidth-bound edge
+ * loops and sparse products. Global indices and the rank-local structures
+ * that are shared through CGeometry remain 64 bit. ---*/
+#ifdef USE_COMPACT_INDEX
+using su2localidx = uint32_t;
+#else
+using su2localidx = unsigned long;
+#endif
+
 /*--- Detect if OpDiLib has to be used. ---*/
 #if defined(HAVE_OMP) && defined(CODI_REVERSE_TYPE)
 #ifndef __INTEL_COMPILER
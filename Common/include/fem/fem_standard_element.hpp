@@ -699,7 +699,7 @@ protected:
   */
   su2double ViscousPenaltyParameter(const unsigned short VTK_TypeElem,
                                     const unsigned short nPolyElem) const;
-private:
+
   /*!
   * \brief Function, which determines the 1D Gauss Legendre integration points and weights.
   * \param[in,out] GLPoints  - The location of the Gauss-Legendre integration points.
@@ -707,7 +707,7 @@ private:
   */
   void GaussLegendrePoints1D(vector<su2double> &GLPoints,
                              vector<su2double> &GLWeights);
-
+private:
   /*!
   * \brief Function, which computes the value of the gradient of the Jacobi polynomial for the given x-coordinate.
   * \param[in] n     - Order of the Jacobi polynomial.
@@ -814,6 +814,11 @@ private:
                                                       and dtLagBasisIntegration combined for efficiency when using BLAS routines. */
   vector<su2double> matDerBasisIntTrans;  /*!< \brief Matrix of the transpose of the derivative part of matBasisIntegration. It is
                                                       stored such that the volume residual can be computed in one matrix multiplication. */
+  vector<su2double> matWeightedBasisIntTrans;    /*!< \brief lagBasisIntegrationTrans with the integration weights fused into the
+                                                             columns. The volume source terms can be redistributed without an
+                                                             explicit weight multiplication in the integration points. */
+  vector<su2double> matWeightedDerBasisIntTrans; /*!< \brief matDerBasisIntTrans with the integration weights fused into the
+                                                             columns, for the weight free redistribution of the volume fluxes. */
   vector<su2double> matDerBasisSolDOFs;   /*!< \brief Matrix of the derivatives of the Lagrangian basis functions in the solution
                                                       DOFs. Needed to compute the metric terms in the solution DOFs. */
   vector<su2double> matDerBasisOwnDOFs;   /*!< \brief Matrix of the derivatives of the Lagrangian basis functions in the owned
@@ -824,6 +829,26 @@ private:
                                                       in the integration points. As such second derivatives can be computed
                                                       using one call to the BLAS routines. */
 
+  unsigned short nDOFs1D;        /*!< \brief Number of DOFs in one parametric direction. Only relevant for
+                                             quadrilaterals and hexahedra, zero for the other element types. */
+  unsigned short nIntegration1D; /*!< \brief Number of integration points in one parametric direction. Only
+                                             relevant for quadrilaterals and hexahedra. */
+
+  vector<su2double> lagBasisIntegration1D;        /*!< \brief 1D Lagrangian basis functions in the 1D integration points.
+                                                              Only created for quadrilaterals and hexahedra, for which the
+                                                              volume matrix products can be carried out with sum
+                                                              factorization, i.e. as a sequence of small 1D tensor
+                                                              products. */
+  vector<su2double> lagBasisIntegrationTrans1D;   /*!< \brief Transpose of lagBasisIntegration1D. */
+  vector<su2double> drLagBasisIntegration1D;      /*!< \brief Derivatives of the 1D Lagrangian basis functions in the
+                                                              1D integration points. */
+  vector<su2double> drLagBasisIntegrationTrans1D; /*!< \brief Transpose of drLagBasisIntegration1D. */
+  vector<su2double> lagBasisIntegrationTransWeighted1D;   /*!< \brief lagBasisIntegrationTrans1D with the 1D integration weights
+                                                                      fused into the columns. The tensor product of these operators
+                                                                      reproduces the multi-dimensional integration weights. */
+  vector<su2double> drLagBasisIntegrationTransWeighted1D; /*!< \brief drLagBasisIntegrationTrans1D with the 1D integration
+                                                                      weights fused into the columns. */
+
   vector<unsigned short> connFace0; /*!< \brief Local connectivity of face 0 of the element. The numbering of the DOFs is
                                                 such that the element is to the left of the face. */
   vector<unsigned short> connFace1; /*!< \brief Local connectivity of face 1 of the element. The numbering of the DOFs is
@@ -955,6 +980,20 @@ public:
   */
   inline const su2double* GetDerMatBasisFunctionsIntTrans(void) const {return matDerBasisIntTrans.data();}
 
+  /*!
+  * \brief Function, which makes available the transpose of the basis functions in the integration
+           points with the integration weights fused into the columns.
+  * \return  The pointer to matWeightedBasisIntTrans;
+  */
+  inline const su2double* GetWeightedBasisFunctionsIntegrationTrans(void) const {return matWeightedBasisIntTrans.data();}
+
+  /*!
+  * \brief Function, which makes available the transpose matrix of the derivative of the basis functions
+           in the integration points with the integration weights fused into the columns.
+  * \return  The pointer to matWeightedDerBasisIntTrans;
+  */
+  inline const su2double* GetWeightedDerMatBasisFunctionsIntTrans(void) const {return matWeightedDerBasisIntTrans.data();}
+
   /*!
   * \brief Function, which makes available the matrix storage of the derivative of the basis functions in the own DOFs.
   * \return  The pointer to matDerBasisOwnDOFs.
@@ -974,6 +1013,64 @@ public:
   */
   inline const su2double *GetMat2ndDerBasisFunctionsInt(void) const {return mat2ndDerBasisInt.data();}
 
+  /*!
+  * \brief Function, which indicates whether or not the volume matrix products can be
+           carried out with sum factorization, i.e. for quadrilaterals and hexahedra.
+  * \return  Whether or not sum factorization can be used.
+  */
+  inline bool SumFactorizationPossible(void) const {return !lagBasisIntegration1D.empty();}
+
+  /*!
+  * \brief Function, which makes available the number of DOFs in one parametric direction.
+  * \return  The number of DOFs in one parametric direction.
+  */
+  inline unsigned short GetNDOFs1D(void) const {return nDOFs1D;}
+
+  /*!
+  * \brief Function, which makes available the number of integration points in one parametric direction.
+  * \return  The number of integration points in one parametric direction.
+  */
+  inline unsigned short GetNIntegration1D(void) const {return nIntegration1D;}
+
+  /*!
+  * \brief Function, which makes available the 1D basis functions in the 1D integration points.
+  * \return  The pointer to data, which stores the 1D basis functions.
+  */
+  inline const su2double* GetBasisFunctionsIntegration1D(void) const {return lagBasisIntegration1D.data();}
+
+  /*!
+  * \brief Function, which makes available the transpose of the 1D basis functions in the 1D integration points.
+  * \return  The pointer to data, which stores the transpose of the 1D basis functions.
+  */
+  inline const su2double* GetBasisFunctionsIntegrationTrans1D(void) const {return lagBasisIntegrationTrans1D.data();}
+
+  /*!
+  * \brief Function, which makes available the derivatives of the 1D basis functions in the 1D integration points.
+  * \return  The pointer to data, which stores the derivatives of the 1D basis functions.
+  */
+  inline const su2double* GetDrBasisFunctionsIntegration1D(void) const {return drLagBasisIntegration1D.data();}
+
+  /*!
+  * \brief Function, which makes available the transpose of the derivatives of the 1D basis
+           functions in the 1D integration points.
+  * \return  The pointer to data, which stores the transpose of the derivatives of the 1D basis functions.
+  */
+  inline const su2double* GetDrBasisFunctionsIntegrationTrans1D(void) const {return drLagBasisIntegrationTrans1D.data();}
+
+  /*!
+  * \brief Function, which makes available the transpose of the 1D basis functions in the
+           1D integration points with the 1D integration weights fused into the columns.
+  * \return  The pointer to data, which stores the weighted transpose of the 1D basis functions.
+  */
+  inline const su2double* GetBasisFunctionsIntegrationTransWeighted1D(void) const {return lagBasisIntegrationTransWeighted1D.data();}
+
+  /*!
+  * \brief Function, which makes available the transpose of the derivatives of the 1D basis
+           functions in the 1D integration points with the 1D integration weights fused into the columns.
+  * \return  The pointer to data, which stores the weighted transpose of the derivatives of the 1D basis functions.
+  */
+  inline const su2double* GetDrBasisFunctionsIntegrationTransWeighted1D(void) const {return drLagBasisIntegrationTransWeighted1D.data();}
+
   /*!
   * \brief Function, which makes available the connectivity of face 0.
   * \return  The pointer to data, which stores the connectivity of face 0.
@@ -1156,6 +1253,14 @@ private:
                                                       vector<su2double> &matVandermondeInv,
                                                       vector<su2double> &lagBasis,
                                                       vector<su2double> &matDerBasis);
+  /*!
+  * \brief Function, which creates the 1D basis functions and its derivatives in the
+           1D integration points for the tensor-product elements, i.e. quadrilaterals
+           and hexahedra. This data enables the use of sum factorization in the
+           volume matrix products.
+  */
+  void CreateTensorProductDataVolume(void);
+
   /*!
   * \brief Function, which creates all the data for a line element.
   */
@@ -29,6 +29,7 @@
 #pragma once
 
 #include "../parallelization/mpi_structure.hpp"
+#include "../parallelization/staging_buffers.hpp"
 
 #ifdef HAVE_METIS
 #include "metis.h"
@@ -122,6 +123,10 @@ protected:
   /*--- Boundary information. ---*/
 
   short *Marker_All_SendRecv{nullptr};   /*!< \brief MPI Marker. */
+
+  std::unique_ptr<CADTElemClass> wallADT; /*!< \brief Cached viscous wall ADT, kept for dynamic
+                                                      meshes so that it can be refit instead of
+                                                      rebuilt every time step. */
   su2double **CustomBoundaryTemperature{nullptr};
   su2double **CustomBoundaryHeatFlux{nullptr};
 
@@ -183,9 +188,15 @@ protected:
   elemColoring;                          /*!< \brief Element coloring structure for thread-based parallelization. */
   unsigned long edgeColorGroupSize{1};   /*!< \brief Size of the edge groups within each color. */
   unsigned long elemColorGroupSize{1};   /*!< \brief Size of the element groups within each color. */
+  vector<unsigned long> edgeColorChunkSizes; /*!< \brief Cost-adapted dynamic-schedule chunk size for the edge loops of each color. */
+  bool edgeColorCalibration = false; /*!< \brief Measure the cost of the edge groups (instead of estimating it) to order and schedule the edge loops. */
 
   ColMajorMatrix<uint8_t> CoarseGridColor_;  /*!< \brief Coarse grid levels, colorized. */
 
+  enum : unsigned short {N_SEGREGATED_ELEM_TYPES = 6}; /*!< \brief Number of volume element types in the segregated ordering. */
+  su2vector<unsigned long> elemTypeOrder;    /*!< \brief Element indices sorted such that each VTK type forms one contiguous range. */
+  unsigned long elemTypeOffset[N_SEGREGATED_ELEM_TYPES + 1] = {0}; /*!< \brief Begin/end positions of each type range in elemTypeOrder. */
+
 public:
   /*--- Main geometric elements of the grid. ---*/
 
@@ -194,6 +205,10 @@ public:
   CPoint* nodes{nullptr};                /*!< \brief Node vector (dual grid information). */
   CEdge* edges{nullptr};                 /*!< \brief Edge vector (dual grid information). */
   CVertex*** vertex{nullptr};            /*!< \brief Boundary Vertex vector (dual grid information). */
+  vector<vector<CVertex> > vertexStorage;/*!< \brief Contiguous per-marker storage behind "vertex", for
+                                          cache-friendly boundary traversals (empty in legacy paths). */
+  vector<char> dualGridUpdated;          /*!< \brief Points whose dual-grid metrics changed in the last incremental
+                                          update, empty when the last update was a full recompute. */
   CTurboVertex**** turbovertex{nullptr}; /*!< \brief Boundary Vertex vector ordered for turbomachinery calculation(dual grid information). */
   unsigned long *nVertex{nullptr};       /*!< \brief Number of vertex for each marker. */
   unsigned long *nElem_Bound{nullptr};   /*!< \brief Number of elements of the boundary. */
@@ -201,6 +216,12 @@ public:
   vector<bool> bound_is_straight;        /*!< \brief Bool if boundary-marker is straight(2D)/plane(3D) for each local marker. */
   vector<su2double> SurfaceAreaCfgFile;  /*!< \brief Total Surface area for all markers. */
 
+  /*--- Cached least-squares gradient coefficients (static meshes). ---*/
+
+  su2activematrix lsqCoeffCache[2];            /*!< \brief Inverted LSQ coefficient (S) matrix per point,
+                                                upper triangle, for unweighted [0] and weighted [1] LSQ. */
+  bool lsqCoeffCacheValid[2] = {false,false};  /*!< \brief Whether the cached coefficients are usable. */
+
   /*--- Partitioning-specific variables ---*/
 
   unordered_map<unsigned long,unsigned long> Global_to_Local_Elem; /*!< \brief Mapping of global to local index for elements. */
@@ -227,9 +248,24 @@ public:
   su2double *bufD_P2PSend{nullptr};       /*!< \brief Data structure for su2double point-to-point send. */
   unsigned short *bufS_P2PRecv{nullptr};  /*!< \brief Data structure for unsigned long point-to-point receive. */
   unsigned short *bufS_P2PSend{nullptr};  /*!< \brief Data structure for unsigned long point-to-point send. */
+
+  /*--- Page-locked staging storage backing the point-to-point buffers above,
+   so that the halo exchanges can use RDMA / GPUDirect without per-transfer
+   memory registration. ---*/
+
+  CStagingBuffer stageD_P2PRecv;          /*!< \brief Storage of bufD_P2PRecv. */
+  CStagingBuffer stageD_P2PSend;          /*!< \brief Storage of bufD_P2PSend. */
+  CStagingBuffer stageS_P2PRecv;          /*!< \brief Storage of bufS_P2PRecv. */
+  CStagingBuffer stageS_P2PSend;          /*!< \brief Storage of bufS_P2PSend. */
   SU2_MPI::Request *req_P2PSend{nullptr}; /*!< \brief Data structure for point-to-point send requests. */
   SU2_MPI::Request *req_P2PRecv{nullptr}; /*!< \brief Data structure for point-to-point recv requests. */
 
+  /*--- Persistent requests for the recurring (forward, su2double) point-to-point comms,
+   keyed by packet size. Mutable since they are created lazily on first use. ---*/
+
+  mutable map<unsigned short, vector<SU2_MPI::Request> > pers_P2PSend; /*!< \brief Persistent send requests for each packet size. */
+  mutable map<unsigned short, vector<SU2_MPI::Request> > pers_P2PRecv; /*!< \brief Persistent recv requests for each packet size. */
+
   /*--- Data structures for periodic communications. ---*/
 
   int maxCountPerPeriodicPoint{0};        /*!< \brief Maximum number of pieces of data sent per vertex in periodic comms. */
@@ -252,6 +288,9 @@ public:
   unsigned short *bufS_PeriodicSend{nullptr};  /*!< \brief Data structure for unsigned long periodic send. */
   SU2_MPI::Request *req_PeriodicSend{nullptr}; /*!< \brief Data structure for periodic send requests. */
   SU2_MPI::Request *req_PeriodicRecv{nullptr}; /*!< \brief Data structure for periodic recv requests. */
+  su2activematrix PeriodicRotation;            /*!< \brief Rotation matrix (nDim x nDim, row-major) of each periodic marker, precomputed for the periodic comms. */
+  su2activematrix PeriodicRotCenter;           /*!< \brief Rotation center of each periodic marker, precomputed for the periodic comms. */
+  su2activematrix PeriodicCenterTranslation;   /*!< \brief Rotation center plus translation of each periodic marker, precomputed for the periodic comms. */
 
   /*--- Mesh quality metrics. ---*/
 
@@ -291,6 +330,11 @@ public:
    */
   void AllocateP2PComms(unsigned short val_countPerPoint);
 
+  /*!
+   * \brief Routine to free any persistent point-to-point communication requests, e.g. before the buffers they reference are reallocated.
+   */
+  void FreePersistentP2PComms() const;
+
   /*!
    * \brief Routine to launch non-blocking recvs only for all point-to-point communication with neighboring partitions.
    * \note This routine is called by any class that has loaded data into the generic communication buffers.
@@ -417,6 +461,72 @@ public:
    */
   inline unsigned long GetGlobal_nPointDomain() const { return Global_nPointDomain; }
 
+  /*!
+   * \brief Get the cached least-squares gradient coefficients.
+   * \param[in] weighted - Inverse-distance-weighted or unweighted LSQ.
+   * \return Matrix of cached coefficients, upper triangle per point.
+   */
+  inline su2activematrix& GetLSQCoeffCache(bool weighted) { return lsqCoeffCache[weighted]; }
+
+  /*!
+   * \brief Whether the cached least-squares coefficients are usable.
+   */
+  inline bool GetLSQCoeffCacheValid(bool weighted) const { return lsqCoeffCacheValid[weighted]; }
+
+  /*!
+   * \brief Flag the cached least-squares coefficients as usable.
+   */
+  inline void SetLSQCoeffCacheValid(bool weighted) { lsqCoeffCacheValid[weighted] = true; }
+
+  /*!
+   * \brief Invalidate the cached least-squares coefficients (e.g. after mesh movement).
+   */
+  inline void InvalidateLSQCoeffCache() { lsqCoeffCacheValid[0] = lsqCoeffCacheValid[1] = false; }
+
+  /*!
+   * \brief Position of a volume VTK element type in the type-segregated element ordering.
+   * \param[in] vtkType - VTK identifier of the element type.
+   * \return Position of the type, N_SEGREGATED_ELEM_TYPES if the type is not a volume element.
+   */
+  static inline unsigned short GetElemTypePosition(unsigned short vtkType) {
+    switch (vtkType) {
+      case TRIANGLE: return 0;
+      case QUADRILATERAL: return 1;
+      case TETRAHEDRON: return 2;
+      case HEXAHEDRON: return 3;
+      case PRISM: return 4;
+      case PYRAMID: return 5;
+    }
+    return N_SEGREGATED_ELEM_TYPES;
+  }
+
+  /*!
+   * \brief Group the volume elements into contiguous ranges of equal VTK type.
+   * \note Enables type-segregated iteration of mixed meshes without per-element
+   *       dispatch, the relative order within each type is preserved.
+   */
+  void SetElemTypeIndex(void);
+
+  /*!
+   * \brief Get the element indices grouped by VTK type (built on first use).
+   */
+  inline const su2vector<unsigned long>& GetElemTypeOrder(void) {
+    if (elemTypeOrder.size() != nElem) SetElemTypeIndex();
+    return elemTypeOrder;
+  }
+
+  /*!
+   * \brief First position in the type-segregated element ordering occupied by a type.
+   * \param[in] typePos - Position of the type, see GetElemTypePosition.
+   */
+  inline unsigned long GetElemTypeBegin(unsigned short typePos) const { return elemTypeOffset[typePos]; }
+
+  /*!
+   * \brief One past the last position in the type-segregated element ordering occupied by a type.
+   * \param[in] typePos - Position of the type, see GetElemTypePosition.
+   */
+  inline unsigned long GetElemTypeEnd(unsigned short typePos) const { return elemTypeOffset[typePos + 1]; }
+
   /*!
    * \brief Get number of elements.
    * \return Number of elements.
@@ -627,6 +737,11 @@ public:
    */
   inline virtual void SetPoint_Connectivity() {}
 
+  /*!
+   * \brief Set connectivity between points, restricted to marker-adjacent points.
+   */
+  inline virtual void SetBoundPoint_Connectivity() {}
+
   /*!
    * \brief Orders the RCM.
    * \param[in] config - Definition of the particular problem.
@@ -643,6 +758,13 @@ public:
    */
   void SetEdges();
 
+  /*!
+   * \brief Re-sorts the edge list so that the points of consecutive edges are
+   *        accessed (almost) sequentially, edge loops and the edge coloring
+   *        both visit edges in index order.
+   */
+  void SortEdgesForLocality();
+
   /*!
    * \brief Sets the faces of an element..
    */
@@ -739,6 +861,13 @@ public:
    */
   inline virtual void SetBoundControlVolume(const CConfig *config, unsigned short action) {}
 
+  /*!
+   * \brief Get the per-point flags of the last incremental dual-grid update, used to propagate
+   *        the update through the multigrid levels.
+   * \return Flags marking the points whose metrics changed, empty after a full recompute.
+   */
+  inline const vector<char>& GetDualGridUpdated() const { return dualGridUpdated; }
+
   /*!
    * \brief A virtual member.
    * \param[in] config_filename - Name of the file where the tecplot information is going to be stored.
@@ -1639,6 +1768,18 @@ public:
    */
   inline unsigned long GetEdgeColorGroupSize() const { return edgeColorGroupSize; }
 
+  /*!
+   * \brief Get the chunk size suggested for the dynamic schedule of the edge loops of a color.
+   * \note Always a multiple of the color group size, larger for colors whose groups have
+   *       uniform estimated cost, to reduce the scheduling overhead.
+   * \param[in] iColor - Color index.
+   * \return Chunk size in number of edges.
+   */
+  inline unsigned long GetEdgeColorChunkSize(unsigned long iColor) const {
+    if (iColor < edgeColorChunkSizes.size()) return edgeColorChunkSizes[iColor];
+    return edgeColorGroupSize;
+  }
+
   /*!
    * \brief Get the element coloring.
    * \note This method computes the coloring if that has not been done yet.
@@ -1665,6 +1806,16 @@ public:
    */
   virtual std::unique_ptr<CADTElemClass> ComputeViscousWallADT(const CConfig *config) const { return nullptr; }
 
+  /*!
+   * \brief Update an ADT of the viscous markers with the current coordinates, without
+   * rebuilding it, for meshes that move while keeping their topology.
+   * \param[in,out] WallADT - ADT previously built by ComputeViscousWallADT.
+   * \param[in] config - Definition of the particular problem.
+   * \return True if the ADT was updated, false if updating is not supported
+   * and the ADT must be rebuilt.
+   */
+  virtual bool UpdateViscousWallADT(CADTElemClass *WallADT, const CConfig *config) const { return false; }
+
   /*!
    * \brief Reduce the wall distance based on an previously constructed ADT.
    * \details The ADT might belong to another zone, giving rise to lower wall distances
@@ -1688,6 +1839,25 @@ public:
    */
   static void ComputeWallDistance(const CConfig * const *config_container, CGeometry ****geometry_container);
 
+  /*!
+   * \brief Restore the wall distances of this zone from a binary cache file written
+   * by a previous run of the same case (see GEOMETRY_CACHE).
+   * \param[in] fileName - Name of the per-rank cache file.
+   * \param[in] expectedKey - Hash of the mesh and the relevant config options, a file
+   * with a different key is stale and is ignored.
+   * \param[out] allEmpty - Whether the entire domain had no viscous walls.
+   * \return True if the distances were restored, false if they must be recomputed.
+   */
+  bool ReadWallDistanceCache(const string& fileName, unsigned long expectedKey, bool& allEmpty);
+
+  /*!
+   * \brief Write the wall distances of this zone to a binary cache file.
+   * \param[in] fileName - Name of the per-rank cache file.
+   * \param[in] key - Hash of the mesh and the relevant config options.
+   * \param[in] allEmpty - Whether the entire domain had no viscous walls.
+   */
+  void WriteWallDistanceCache(const string& fileName, unsigned long key, bool allEmpty) const;
+
   /*!
    * \brief Set the amount of nonconvex elements in the mesh.
    * \param[in] nonconvex_elems - amount of nonconvex elements in the mesh
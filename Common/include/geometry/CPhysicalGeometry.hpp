@@ -106,6 +106,28 @@ class CPhysicalGeometry final : public CGeometry {
 
   su2double Streamwise_Periodic_RefNode[MAXNDIM] = {0}; /*!< \brief Coordinates of the reference node [m] on the receiving periodic marker, for recovered pressure/temperature computation only.*/
 
+  su2passivematrix dualGridOldCoord;  /*!< \brief Point coordinates at the last dual-grid update, used to detect which
+                                       points moved and to subtract stale metric contributions (incremental update). */
+  vector<char> dualGridPointMoved;    /*!< \brief Points that moved beyond the tolerance since the last update, valid
+                                       between SetControlVolume and SetBoundControlVolume. */
+  bool dualGridIncrementalOK = false; /*!< \brief Whether the last SetControlVolume call took the incremental path,
+                                       written by the master thread so that all threads take the same branch. */
+
+  /*!
+   * \brief Incrementally update the volumes and edge normals around the points moved by mesh
+   *        deformation, instead of recomputing every metric from scratch. Must be followed by
+   *        SetBoundControlVolume, which refreshes the stored coordinates.
+   * \param[in] config - Definition of the particular problem.
+   * \return <TRUE> if the update was performed, <FALSE> if a full recompute is required.
+   */
+  bool UpdateControlVolumeIncremental(CConfig *config);
+
+  /*!
+   * \brief Boundary counterpart of UpdateControlVolumeIncremental, updates the vertex normals of
+   *        the boundary elements with moved nodes and stores the new coordinates.
+   */
+  void UpdateBoundControlVolumeIncremental();
+
 public:
   /*--- This is to suppress Woverloaded-virtual, omitting it has no negative impact. ---*/
   using CGeometry::SetVertex;
@@ -380,6 +402,14 @@ public:
    */
   void SetPoint_Connectivity() override;
 
+  /*!
+   * \brief Set points which surround a point, restricted to the marker-adjacent elements.
+   * \note Surface-only alternative to SetPoint_Connectivity for tools that only query the
+   *       adjacency near the markers (SU2_GEO, SU2_DEF without volume deformation), it
+   *       avoids building (and storing) the volume adjacency.
+   */
+  void SetBoundPoint_Connectivity() override;
+
   /*!
    * \brief Set a renumbering using a Reverse Cuthill-McKee Algorithm
    * \param[in] config - Definition of the particular problem.
@@ -757,6 +787,15 @@ public:
    */
   std::unique_ptr<CADTElemClass> ComputeViscousWallADT(const CConfig *config) const override;
 
+  /*!
+   * \brief Update an ADT of the viscous markers with the current coordinates, without
+   * rebuilding it, for meshes that move while keeping their topology.
+   * \param[in,out] WallADT - ADT previously built by ComputeViscousWallADT.
+   * \param[in] config - Definition of the particular problem.
+   * \return True, the update is always possible for this geometry.
+   */
+  bool UpdateViscousWallADT(CADTElemClass *WallADT, const CConfig *config) const override;
+
   /*!
    * \brief Reduce the wall distance based on an previously constructed ADT.
    * \details The ADT might belong to another zone, giving rise to lower wall distances
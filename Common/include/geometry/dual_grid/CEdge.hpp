@@ -39,7 +39,7 @@ class CPhysicalGeometry;
 class CEdge {
   static_assert(su2activematrix::IsRowMajor, "Needed to return normal as pointer.");
 private:
-  using Index = unsigned long;
+  using Index = su2localidx;
   using NodeArray = C2DContainer<Index, Index, StorageType::ColumnMajor, 64, DynamicSize, 2>;
   NodeArray Nodes;           /*!< \brief Vector to store the node indices of the edge. */
   su2activematrix Normal;    /*!< \brief Normal (area) of the edge. */
@@ -74,7 +74,12 @@ public:
    */
   template<class T, size_t N>
   FORCEINLINE simd::Array<T,N> GetNode(simd::Array<T,N> iEdge, unsigned long iNode) const {
-    return simd::Array<T,N>(&Nodes(iEdge[0],iNode));
+    /*--- Lane-wise load from the contiguous (column major) storage,
+     *    converts the compact index type if it differs from T. ---*/
+    simd::Array<T,N> nodes;
+    const Index* ptr = &Nodes(iEdge[0],iNode);
+    for (size_t k = 0; k < N; ++k) nodes[k] = ptr[k];
+    return nodes;
   }
 
   /*!
@@ -85,6 +85,7 @@ private:
   su2vector<unsigned long> Parent_CV;          /*!< \brief Index of the parent control volume in the agglomeration process. */
   su2vector<unsigned short> nChildren_CV;      /*!< \brief Number of children in the agglomeration process. */
   vector<vector<unsigned long> > Children_CV;  /*!< \brief Index of the children control volumes in the agglomeration process. */
+  vector<vector<su2mgfloat> > ChildVolumeFrac; /*!< \brief Volume fraction of each child control volume (multigrid restriction weight). */
   su2vector<bool> Agglomerate_Indirect;        /*!< \brief This flag indicates if the indirect points can be agglomerated. */
   su2vector<bool> Agglomerate;                 /*!< \brief This flag indicates if the element has been agglomerated. */
 
@@ -189,6 +190,12 @@ public:
    */
   void SetElems(const vector<vector<long> >& elemsMatrix);
 
+  /*!
+   * \brief Set the elements that are connected to each point, from an already compressed pattern.
+   * \param[in] elemsPattern - Adjacency in CSR format, moved into place (no copy).
+   */
+  void SetElems(CCompressedSparsePatternL&& elemsPattern);
+
   /*!
    * \brief Reset the elements of a control volume.
    */
@@ -220,6 +227,12 @@ public:
    */
   void SetPoints(const vector<vector<unsigned long> >& pointsMatrix);
 
+  /*!
+   * \brief Set the points that compose the control volume, from an already compressed pattern.
+   * \param[in] pointsPattern - Adjacency in CSR format, moved into place (no copy).
+   */
+  void SetPoints(CCompressedSparsePatternUL&& pointsPattern);
+
   /*!
    * \brief Get the entire point adjacency information in compressed format (CSR).
    */
@@ -449,6 +462,16 @@ public:
   inline su2double& GetWall_Distance(unsigned long iPoint) { return Wall_Distance(iPoint); }
   inline const su2double& GetWall_Distance(unsigned long iPoint) const { return Wall_Distance(iPoint); }
 
+  /*!
+   * \brief Get the information about the closest wall element.
+   * \param[in] iPoint - Index of the point.
+   * \return Rank / zone / marker / element index of the closest wall element.
+   */
+  inline int GetClosestWall_Rank(unsigned long iPoint) const { return ClosestWall_Rank(iPoint); }
+  inline unsigned short GetClosestWall_Zone(unsigned long iPoint) const { return ClosestWall_Zone(iPoint); }
+  inline unsigned short GetClosestWall_Marker(unsigned long iPoint) const { return ClosestWall_Marker(iPoint); }
+  inline unsigned long GetClosestWall_Elem(unsigned long iPoint) const { return ClosestWall_Elem(iPoint); }
+
   /*!
    * \brief Set the value of the distance to the nearest wall.
    * \param[in] iPoint - Index of the point.
@@ -629,6 +652,27 @@ public:
     return Children_CV[iPoint][nchildren_CV];
   }
 
+  /*!
+   * \brief Set the volume fraction (restriction weight) of a child control volume.
+   * \param[in] iPoint - Index of the point.
+   * \param[in] iChildren - Number of the children.
+   * \param[in] frac - Volume of the child over the volume of the agglomeration.
+   */
+  inline void SetChildVolumeFrac(unsigned long iPoint, unsigned short iChildren, su2mgfloat frac) {
+    if (ChildVolumeFrac[iPoint].size() <= iChildren) ChildVolumeFrac[iPoint].resize(iChildren+1ul);
+    ChildVolumeFrac[iPoint][iChildren] = frac;
+  }
+
+  /*!
+   * \brief Get the volume fraction (restriction weight) of a child control volume.
+   * \param[in] iPoint - Index of the point.
+   * \param[in] iChildren - Number of the children.
+   * \return Volume of the child over the volume of the agglomeration.
+   */
+  inline su2mgfloat GetChildVolumeFrac(unsigned long iPoint, unsigned short iChildren) const {
+    return ChildVolumeFrac[iPoint][iChildren];
+  }
+
   /*!
    * \brief Get information about if a control volume has been agglomerated.
    * \param[in] iPoint - Index of the point.
@@ -48,6 +48,8 @@ private:
   const int cgnsBase = 1; /*!< \brief CGNS database index (the CGNS reader currently assumes a single database). */
   const int cgnsZone = 1; /*!< \brief CGNS zone index (and 1 zone in that database). */
 
+  bool cgnsParallel = false; /*!< \brief Whether the file was opened with the parallel CGNS API, in which case the bulk data is read with collective MPI-IO calls. */
+
   int nSections;  /*!< \brief Total number of sections in the CGNS file. */
 
   vector<bool> isInterior;             /*!< \brief Vector of booleans to store whether each section in the CGNS file is an interior or boundary section. */
@@ -47,6 +47,7 @@ private:
   const unsigned short nZones; /*!< \brief Total number of zones in the SU2 file. */
 
   const string meshFilename; /*!< \brief Name of the SU2 ASCII mesh file being read. */
+  vector<char> fileBuffer; /*!< \brief Large stream buffer for the file object, must outlive it. */
   ifstream mesh_file;  /*!< \brief File object for the SU2 ASCII mesh file. */
 
   bool actuator_disk; /*!< \brief Boolean for whether we have an actuator disk to split. */
@@ -63,6 +63,7 @@ public:
 
   vector<su2double> CartesianCoord[3];  /*!< \brief Vector with all the cartesian coordinates in the FFD FFDBox. */
   vector<su2double> ParametricCoord[3]; /*!< \brief Vector with all the parametrics coordinates in the FFD FFDBox. */
+  vector<passivedouble> BatchCoord;     /*!< \brief Cartesian coordinates of all surface points from the batched evaluation. */
   vector<unsigned short> MarkerIndex; /*!< \brief Vector with all markers in the FFD FFDBox. */
   vector<unsigned long> VertexIndex;  /*!< \brief Vector with all vertex index in the FFD FFDBox. */
   vector<unsigned long> PointIndex;   /*!< \brief Vector with all points index in the FFD FFDBox. */
@@ -575,6 +576,25 @@ public:
    */
   su2double *EvalCartesianCoord(su2double *ParamCoord) const;
 
+  /*!
+   * \brief Evaluate the Cartesian coordinates of all surface points of the box in one batched pass.
+   *        The basis values of a block of points and the flattened control points turn the accumulation
+   *        into small dense matrix-matrix products, instead of scattered point-by-point evaluations.
+   * \note Works with passive values, the caller has to check that no derivatives are being recorded.
+   */
+  void EvalCartesianCoordBatch(void);
+
+  /*!
+   * \brief Get the result of the batched evaluation for one surface point (see EvalCartesianCoordBatch).
+   * \param[in] iSurfacePoint - Index of the surface point in the FFD FFDBox.
+   * \return Pointer to the cartesian coordinates of the point.
+   */
+  inline su2double *GetBatchCartesianCoord(unsigned long iSurfacePoint) {
+    for (unsigned short iDim = 0; iDim < nDim; iDim++)
+      cart_coord[iDim] = BatchCoord[3*iSurfacePoint+iDim];
+    return cart_coord;
+  }
+
   /*!
    * \brief Get the order in the l direction of the FFD FFDBox.
    * \return Order in the l direction of the FFD FFDBox.
@@ -58,6 +58,12 @@ protected:
   CSysVector<su2double> LinSysSol;
   CSysVector<su2double> LinSysRes;
 
+  /*--- State of the stiffness matrix cache (DEFORM_REUSE_STIFFNESS). ---*/
+  bool stiffnessReady = false;            /*!< \brief The assembled matrix of a previous call is still valid. */
+  su2double cachedMinVolume = 0.0;        /*!< \brief Minimum element volume found during the cached assembly. */
+  passivedouble stiffnessRefLength = 0.0; /*!< \brief Mesh bounding-box diagonal at the cached assembly. */
+  passivedouble accumDeformation = 0.0;   /*!< \brief Maximum displacement accumulated since the cached assembly. */
+
 public:
 
   /*!
@@ -38,6 +38,8 @@ class CRadialBasisFunction final : public CInterpolator {
 private:
   unsigned long MinDonors = 0, AvgDonors = 0, MaxDonors = 0;
   passivedouble Density = 0.0, AvgCorrection = 0.0, MaxCorrection = 0.0;
+  unsigned long nControlPoints = 0, nTotalDonorPoints = 0;
+  passivedouble MaxFillDistance = 0.0;
 
 public:
   /*!
@@ -99,6 +101,21 @@ public:
   static int CheckPolynomialTerms(su2double max_diff_tol, vector<int>& keep_row, su2passivematrix &P);
 
 private:
+  /*!
+   * \brief Greedy (farthest point) selection of a subset of the donor points to act as control
+   * points, such that the dense interpolation system is only assembled and factored for the
+   * subset. The selection stops when the fill distance (the largest distance from any donor
+   * point to its nearest control point, which drives the a-priori RBF interpolation error)
+   * drops below the tolerance, or when the maximum number of points is reached.
+   * \param[in] coords - Coordinates of the donor points.
+   * \param[in] tolDist - Target fill distance, 0 to only limit the number of points.
+   * \param[in] maxPoints - Maximum number of control points, 0 for no limit.
+   * \param[out] fillDistance - Fill distance achieved by the selection.
+   * \return Sorted indices of the selected points, empty if all points were selected.
+   */
+  static vector<unsigned long> SelectControlPoints(const su2activematrix& coords, passivedouble tolDist,
+                                                   unsigned long maxPoints, passivedouble& fillDistance);
+
   /*!
    * \brief Helper function, prunes (by setting to zero) small interpolation coefficients,
    * i.e. <= tolerance*max(abs(coeffs)). The vector is re-scaled such that sum(coeffs)==1.
@@ -64,6 +64,22 @@ public:
    */
   virtual bool IsIdentity() const { return false; }
 
+  /*!
+   * \brief Return true if the preconditioner can be applied fused with the matrix-vector
+   * product (see ApplyToProduct), saving one pass of vector traffic per application.
+   */
+  virtual bool SupportsApplyToProduct() const { return false; }
+
+  /*!
+   * \brief Fused application to a matrix-vector product, prod = A*u and v = M^{-1}*prod
+   * in a single pass over the matrix. Only available for specializations that return
+   * true from SupportsApplyToProduct.
+   */
+  virtual void ApplyToProduct(const CSysVector<ScalarType> & u, CSysVector<ScalarType> & prod,
+                              CSysVector<ScalarType> & v) const {
+    SU2_MPI::Error("The fused application is not implemented for this preconditioner.", CURRENT_FUNCTION);
+  }
+
   /*!
    * \brief Factory method.
    */
@@ -116,6 +132,20 @@ public:
     sparse_matrix.ComputeJacobiPreconditioner(u, v, geometry, config);
   }
 
+  /*!
+   * \brief The block-diagonal inverse can be applied row-by-row inline with the product.
+   */
+  inline bool SupportsApplyToProduct() const override { return true; }
+
+  /*!
+   * \brief Fused product and preconditioner application, the inverse diagonal blocks are
+   * applied while the row products are cache-hot, see CSysMatrix::JacobiMatrixVectorProduct.
+   */
+  inline void ApplyToProduct(const CSysVector<ScalarType> & u, CSysVector<ScalarType> & prod,
+                             CSysVector<ScalarType> & v) const override {
+    sparse_matrix.JacobiMatrixVectorProduct(u, prod, v, geometry, config);
+  }
+
   /*!
    * \note Request the associated matrix to build the preconditioner.
    */
@@ -221,6 +251,57 @@ public:
 };
 
 
+/*!
+ * \class CMulticolorSGSPreconditioner
+ * \brief Specialization of preconditioner that uses CSysMatrix class.
+ */
+template<class ScalarType>
+class CMulticolorSGSPreconditioner final : public CPreconditioner<ScalarType> {
+private:
+  CSysMatrix<ScalarType>& sparse_matrix; /*!< \brief Pointer to matrix that defines the preconditioner. */
+  CGeometry* geometry;                   /*!< \brief Pointer to geometry associated with the matrix. */
+  const CConfig *config;                 /*!< \brief Pointer to problem configuration. */
+
+public:
+  /*!
+   * \brief Constructor of the class.
+   * \param[in] matrix_ref - Matrix reference that will be used to define the preconditioner.
+   * \param[in] geometry_ref - Geometry associated with the problem.
+   * \param[in] config_ref - Config of the problem.
+   */
+  inline CMulticolorSGSPreconditioner(CSysMatrix<ScalarType> & matrix_ref,
+                                      CGeometry *geometry_ref, const CConfig *config_ref) :
+    sparse_matrix(matrix_ref)
+  {
+    if((geometry_ref == nullptr) || (config_ref == nullptr))
+      SU2_MPI::Error("Preconditioner needs to be built with valid references.", CURRENT_FUNCTION);
+    geometry = geometry_ref;
+    config = config_ref;
+  }
+
+  /*!
+   * \note This class cannot be default constructed as that would leave us with invalid Pointers.
+   */
+  CMulticolorSGSPreconditioner() = delete;
+
+  /*!
+   * \brief Operator that defines the preconditioner operation.
+   * \param[in] u - CSysVector that is being preconditioned.
+   * \param[out] v - CSysVector that is the result of the preconditioning.
+   */
+  inline void operator()(const CSysVector<ScalarType> & u, CSysVector<ScalarType> & v) const override {
+    sparse_matrix.ComputeMulticolorSGSPreconditioner(u, v, geometry, config);
+  }
+
+  /*!
+   * \note Request the associated matrix to build the preconditioner.
+   */
+  inline void Build() override {
+    sparse_matrix.BuildMulticolorSGSPreconditioner();
+  }
+};
+
+
 /*!
  * \class CLineletPreconditioner
  * \brief Specialization of preconditioner that uses CSysMatrix class.
@@ -268,6 +349,7 @@ public:
    */
   inline void Build() override {
     sparse_matrix.BuildJacobiPreconditioner();
+    sparse_matrix.FactorizeLineletPreconditioner();
   }
 };
 
@@ -326,6 +408,242 @@ public:
 };
 
 
+/*!
+ * \class CAMGPreconditioner
+ * \brief Two-level aggregation (algebraic multigrid) preconditioner.
+ *
+ * Combines ILU smoothing on the fine level with a coarse-level correction
+ * built by greedy aggregation of the matrix graph, using piecewise-constant
+ * transfer operators (Galerkin coarse matrix). The coarse operator only
+ * couples the points owned by each rank (block-Jacobi across ranks) and is
+ * solved with a few symmetric block Gauss-Seidel sweeps. Targeted at stiff
+ * elliptic systems, e.g. the pseudo-elastic mesh deformation operator on
+ * high-aspect-ratio grids, whose low-frequency error modes local smoothers
+ * cannot remove.
+ */
+template<class ScalarType>
+class CAMGPreconditioner final : public CPreconditioner<ScalarType> {
+private:
+  enum : unsigned long { COARSE_SWEEPS = 4 }; /*!< \brief Symmetric Gauss-Seidel sweeps per application. */
+
+  CSysMatrix<ScalarType>& sparse_matrix;  /*!< \brief Pointer to matrix that defines the preconditioner. */
+  CGeometry* geometry;                    /*!< \brief Pointer to geometry associated with the matrix. */
+  const CConfig *config;                  /*!< \brief Pointer to problem configuration. */
+  CILUPreconditioner<ScalarType> smoother;/*!< \brief Fine-level smoother. */
+
+  unsigned long nVar = 0;                 /*!< \brief Dimension of the matrix blocks. */
+  unsigned long nCoarse = 0;              /*!< \brief Number of aggregates (coarse points). */
+  vector<unsigned long> pointAggr;        /*!< \brief Aggregate each owned fine point belongs to. */
+  vector<unsigned long> coarseRowPtr;     /*!< \brief CSR sparsity of the coarse matrix. */
+  vector<unsigned long> coarseColInd;     /*!< \brief CSR column indices of the coarse matrix. */
+  vector<unsigned long> coarseDiaPtr;     /*!< \brief Position of the diagonal block of each coarse row. */
+  vector<ScalarType> coarseBlocks;        /*!< \brief Coarse matrix blocks in CSR order. */
+  vector<ScalarType> coarseInvDiag;       /*!< \brief Inverses of the coarse diagonal blocks. */
+
+  mutable CSysVector<ScalarType> fineRes; /*!< \brief Fine-level residual of the smoothed solution. */
+  mutable vector<ScalarType> coarseRhs;   /*!< \brief Restricted residual. */
+  mutable vector<ScalarType> coarseSol;   /*!< \brief Coarse-level correction. */
+
+  /*!
+   * \brief Aggregate the matrix graph and assemble the coarse operator, must be called by one thread only.
+   */
+  void BuildCoarseOperator() {
+    const auto nPointDomain = geometry->GetnPointDomain();
+    nVar = sparse_matrix.GetNVar();
+    const auto blkSize = nVar*nVar;
+    const auto* rowPtr = sparse_matrix.GetRowPtr();
+    const auto* colInd = sparse_matrix.GetColInd();
+
+    /*--- Greedy aggregation, each seed point absorbs its not-yet-aggregated
+     *    owned neighbors, leftover points become singleton aggregates. ---*/
+
+    pointAggr.assign(nPointDomain, nPointDomain);
+    nCoarse = 0;
+    for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint) {
+      if (pointAggr[iPoint] != nPointDomain) continue;
+      pointAggr[iPoint] = nCoarse;
+      for (auto k = rowPtr[iPoint]; k < rowPtr[iPoint+1]; ++k) {
+        const auto jPoint = colInd[k];
+        if (jPoint < nPointDomain && pointAggr[jPoint] == nPointDomain)
+          pointAggr[jPoint] = nCoarse;
+      }
+      ++nCoarse;
+    }
+
+    /*--- Galerkin coarse operator with piecewise-constant transfers,
+     *    A_c(I,J) is the sum of the fine blocks joining the two aggregates.
+     *    Couplings to halo points are dropped (block-Jacobi across ranks). ---*/
+
+    vector<map<unsigned long, vector<ScalarType> > > rows(nCoarse);
+    for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint) {
+      const auto iAggr = pointAggr[iPoint];
+      for (auto k = rowPtr[iPoint]; k < rowPtr[iPoint+1]; ++k) {
+        const auto jPoint = colInd[k];
+        if (jPoint >= nPointDomain) continue;
+        auto& blk = rows[iAggr][pointAggr[jPoint]];
+        if (blk.empty()) blk.assign(blkSize, ScalarType(0));
+        const auto* fineBlk = sparse_matrix.GetBlock(iPoint, jPoint);
+        for (auto iVal = 0ul; iVal < blkSize; ++iVal) blk[iVal] += fineBlk[iVal];
+      }
+    }
+
+    coarseRowPtr.assign(nCoarse+1, 0);
+    coarseDiaPtr.assign(nCoarse, 0);
+    coarseColInd.clear();
+    coarseBlocks.clear();
+    for (auto iAggr = 0ul; iAggr < nCoarse; ++iAggr) {
+      for (const auto& entry : rows[iAggr]) {
+        if (entry.first == iAggr) coarseDiaPtr[iAggr] = coarseColInd.size();
+        coarseColInd.push_back(entry.first);
+        coarseBlocks.insert(coarseBlocks.end(), entry.second.begin(), entry.second.end());
+      }
+      coarseRowPtr[iAggr+1] = coarseColInd.size();
+    }
+
+    /*--- Invert the diagonal blocks (Gauss-Jordan with partial pivoting)
+     *    for the Gauss-Seidel sweeps. ---*/
+
+    coarseInvDiag.assign(nCoarse*blkSize, ScalarType(0));
+    vector<ScalarType> aug(2*blkSize);
+    for (auto iAggr = 0ul; iAggr < nCoarse; ++iAggr) {
+      const auto* diag = &coarseBlocks[coarseDiaPtr[iAggr]*blkSize];
+      for (auto i = 0ul; i < nVar; ++i) {
+        for (auto j = 0ul; j < nVar; ++j) {
+          aug[i*2*nVar+j] = diag[i*nVar+j];
+          aug[i*2*nVar+nVar+j] = ScalarType(i == j);
+        }
+      }
+      for (auto j = 0ul; j < nVar; ++j) {
+        auto pivot = j;
+        for (auto i = j+1; i < nVar; ++i)
+          if (fabs(aug[i*2*nVar+j]) > fabs(aug[pivot*2*nVar+j])) pivot = i;
+        if (pivot != j)
+          for (auto k = 0ul; k < 2*nVar; ++k) swap(aug[j*2*nVar+k], aug[pivot*2*nVar+k]);
+        const auto scale = ScalarType(1) / aug[j*2*nVar+j];
+        for (auto k = 0ul; k < 2*nVar; ++k) aug[j*2*nVar+k] *= scale;
+        for (auto i = 0ul; i < nVar; ++i) {
+          if (i == j) continue;
+          const auto factor = aug[i*2*nVar+j];
+          for (auto k = 0ul; k < 2*nVar; ++k) aug[i*2*nVar+k] -= factor*aug[j*2*nVar+k];
+        }
+      }
+      for (auto i = 0ul; i < nVar; ++i)
+        for (auto j = 0ul; j < nVar; ++j)
+          coarseInvDiag[iAggr*blkSize+i*nVar+j] = aug[i*2*nVar+nVar+j];
+    }
+
+    coarseRhs.resize(nCoarse*nVar);
+    coarseSol.resize(nCoarse*nVar);
+    fineRes.Initialize(geometry->GetnPoint(), nPointDomain, nVar, ScalarType(0));
+  }
+
+public:
+  /*!
+   * \brief Constructor of the class.
+   * \param[in] matrix_ref - Matrix reference that will be used to define the preconditioner.
+   * \param[in] geometry_ref - Geometry associated with the problem.
+   * \param[in] config_ref - Config of the problem.
+   */
+  inline CAMGPreconditioner(CSysMatrix<ScalarType> & matrix_ref,
+                            CGeometry *geometry_ref, const CConfig *config_ref) :
+    sparse_matrix(matrix_ref),
+    smoother(matrix_ref, geometry_ref, config_ref)
+  {
+    if((geometry_ref == nullptr) || (config_ref == nullptr))
+      SU2_MPI::Error("Preconditioner needs to be built with valid references.", CURRENT_FUNCTION);
+    geometry = geometry_ref;
+    config = config_ref;
+  }
+
+  /*!
+   * \note This class cannot be default constructed as that would leave us with invalid Pointers.
+   */
+  CAMGPreconditioner() = delete;
+
+  /*!
+   * \brief Operator that defines the preconditioner operation.
+   * \param[in] u - CSysVector that is being preconditioned.
+   * \param[out] v - CSysVector that is the result of the preconditioning.
+   */
+  void operator()(const CSysVector<ScalarType> & u, CSysVector<ScalarType> & v) const override {
+
+    /*--- Fine-level smoothing. ---*/
+
+    smoother(u, v);
+
+    /*--- Residual of the smoothed solution (updates the halos of v). ---*/
+
+    sparse_matrix.MatrixVectorProduct(v, fineRes, geometry, config);
+    fineRes = u - fineRes;
+
+    /*--- Coarse-level correction, the coarse system is local to each rank
+     *    and small enough to be solved by one thread. ---*/
+
+    SU2_OMP_MASTER {
+      const auto nPointDomain = geometry->GetnPointDomain();
+
+      /*--- Restrict the residual (sum over each aggregate). ---*/
+
+      coarseRhs.assign(nCoarse*nVar, ScalarType(0));
+      coarseSol.assign(nCoarse*nVar, ScalarType(0));
+      for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint)
+        for (auto iVar = 0ul; iVar < nVar; ++iVar)
+          coarseRhs[pointAggr[iPoint]*nVar+iVar] += fineRes(iPoint,iVar);
+
+      /*--- Symmetric block Gauss-Seidel sweeps on the coarse operator. ---*/
+
+      const auto blkSize = nVar*nVar;
+      vector<ScalarType> res(nVar);
+
+      auto relaxRow = [&](unsigned long iAggr) {
+        for (auto iVar = 0ul; iVar < nVar; ++iVar) res[iVar] = coarseRhs[iAggr*nVar+iVar];
+        for (auto k = coarseRowPtr[iAggr]; k < coarseRowPtr[iAggr+1]; ++k) {
+          const auto jAggr = coarseColInd[k];
+          if (jAggr == iAggr) continue;
+          const auto* blk = &coarseBlocks[k*blkSize];
+          for (auto iVar = 0ul; iVar < nVar; ++iVar)
+            for (auto jVar = 0ul; jVar < nVar; ++jVar)
+              res[iVar] -= blk[iVar*nVar+jVar] * coarseSol[jAggr*nVar+jVar];
+        }
+        const auto* inv = &coarseInvDiag[iAggr*blkSize];
+        for (auto iVar = 0ul; iVar < nVar; ++iVar) {
+          ScalarType sum = 0.0;
+          for (auto jVar = 0ul; jVar < nVar; ++jVar) sum += inv[iVar*nVar+jVar] * res[jVar];
+          coarseSol[iAggr*nVar+iVar] = sum;
+        }
+      };
+
+      for (auto iSweep = 0ul; iSweep < COARSE_SWEEPS; ++iSweep) {
+        for (auto iAggr = 0ul; iAggr < nCoarse; ++iAggr) relaxRow(iAggr);
+        for (auto iAggr = nCoarse; iAggr > 0ul; --iAggr) relaxRow(iAggr-1);
+      }
+
+      /*--- Prolongate (inject) the correction. ---*/
+
+      for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint)
+        for (auto iVar = 0ul; iVar < nVar; ++iVar)
+          v(iPoint,iVar) += coarseSol[pointAggr[iPoint]*nVar+iVar];
+    }
+    END_SU2_OMP_MASTER
+    SU2_OMP_BARRIER
+  }
+
+  /*!
+   * \note Build the fine-level smoother and the coarse operator.
+   */
+  void Build() override {
+    smoother.Build();
+    SU2_OMP_MASTER {
+      /*--- While the matrix is frozen (Jacobian lagging) the coarse operator is reused as-is. ---*/
+      if (!sparse_matrix.GetFrozen() || coarseRowPtr.empty())
+        BuildCoarseOperator();
+    }
+    END_SU2_OMP_MASTER
+    SU2_OMP_BARRIER
+  }
+};
+
+
 template<class ScalarType>
 CPreconditioner<ScalarType>* CPreconditioner<ScalarType>::Create(ENUM_LINEAR_SOLVER_PREC kind,
                                                                  CSysMatrix<ScalarType>& jacobian,
@@ -346,6 +664,12 @@ CPreconditioner<ScalarType>* CPreconditioner<ScalarType>::Create(ENUM_LINEAR_SOL
     case ILU:
       prec = new CILUPreconditioner<ScalarType>(jacobian, geometry, config);
       break;
+    case MC_SGS:
+      prec = new CMulticolorSGSPreconditioner<ScalarType>(jacobian, geometry, config);
+      break;
+    case AMG:
+      prec = new CAMGPreconditioner<ScalarType>(jacobian, geometry, config);
+      break;
     case PASTIX_ILU: case PASTIX_LU_P: case PASTIX_LDLT_P:
       prec = new CPastixPreconditioner<ScalarType>(jacobian, geometry, config, kind);
       break;
@@ -71,6 +71,14 @@ struct mkl_jit_wrapper<float> {
 #endif
 #endif
 
+/*--- Optional OpenMP target offload of the matrix-vector product and of the Jacobi
+ preconditioner (build with -DHAVE_OMP_OFFLOAD and a compiler configured for device
+ offload). The sparsity and matrix storage are mirrored to the device, uploads only
+ happen after the matrix changes, vectors are streamed for every product. ---*/
+#if defined(HAVE_OMP) && defined(HAVE_OMP_OFFLOAD) && !defined(CODI_FORWARD_TYPE)
+#define CSYSMATRIX_OMP_OFFLOAD
+#endif
+
 class CGeometry;
 
 struct CSysMatrixComms {
@@ -132,6 +140,12 @@ private:
   const unsigned long *row_ptr;     /*!< \brief Pointers to the first element in each row. */
   const unsigned long *dia_ptr;     /*!< \brief Pointers to the diagonal element in each row. */
   const unsigned long *col_ind;     /*!< \brief Column index for each of the elements in val(). */
+#ifdef USE_COMPACT_INDEX
+  su2vector<su2localidx> col_ind_compact; /*!< \brief Compact (32 bit) copy of col_ind, see SetIndexes. */
+#endif
+  const su2localidx *col_ind_prod = nullptr; /*!< \brief Column indices used by the bandwidth-bound products,
+                                                  points to the compact copy in the compact index build
+                                                  and to col_ind otherwise. */
   const unsigned long *col_ptr;     /*!< \brief The transpose of col_ind, pointer to blocks with the same column index. */
 
   ScalarType *ILU_matrix;           /*!< \brief Entries of the ILU sparse matrix. */
@@ -141,16 +155,49 @@ private:
   const unsigned long *col_ind_ilu; /*!< \brief Column index for each of the elements in val() (ILU). */
   unsigned short ilu_fill_in;       /*!< \brief Fill in level for the ILU preconditioner. */
 
+  bool iluLevelSched = false;             /*!< \brief Use an exact in-rank level-scheduled ILU factorization and
+                                                      triangular solves instead of the partitioned approximation. */
+  passivedouble iluRefreshTol = 0.0;      /*!< \brief If > 0, only refactor rows whose entries changed by more than
+                                                      this relative amount since the last factorization (ILU0 only). */
+  vector<passivedouble> iluRowSignature;  /*!< \brief Per-row signature (abs sum of entries) of the last factorization. */
+  vector<char> iluRowChanged;             /*!< \brief Rows whose signature changed beyond the refresh tolerance. */
+  unsigned long iluFirstChanged = 0;      /*!< \brief First changed row of the incremental level-scheduled refresh. */
+  vector<unsigned long> iluLevPtr;        /*!< \brief Start of each level of the lower-triangular DAG (level scheduling). */
+  vector<unsigned long> iluLevRows;       /*!< \brief Rows of the matrix grouped by lower-triangular level. */
+  vector<unsigned long> iluLevPtrU;       /*!< \brief Start of each level of the upper-triangular DAG (level scheduling). */
+  vector<unsigned long> iluLevRowsU;      /*!< \brief Rows of the matrix grouped by upper-triangular level. */
+
   ScalarType *invM;                 /*!< \brief Inverse of (Jacobi) preconditioner, or diagonal of ILU. */
 
+  bool frozen = false;              /*!< \brief While true all assembly-type modifications are ignored and the
+                                                preconditioners are not rebuilt, the matrix and its factorization
+                                                are reused as-is (Jacobian lagging). */
+
+  mutable su2vector<unsigned long> mvpRowOrder; /*!< \brief Row order for the matrix-vector product: rows whose
+                                                            values are sent to other ranks first, dense interior rows
+                                                            after (the halo exchange overlaps with them), and rows that
+                                                            read halo columns last, so the scattered accesses to the
+                                                            halo end of the vector are grouped instead of interleaved
+                                                            with the streaming interior sweep. */
+  mutable unsigned long mvpSendRows = 0;        /*!< \brief Number of rows in the send lists (front of mvpRowOrder). */
+  mutable unsigned long mvpInteriorRows = 0;    /*!< \brief One past the last dense interior row in mvpRowOrder. */
+
   unsigned long nLinelet;                      /*!< \brief Number of Linelets in the system. */
   vector<bool> LineletBool;                    /*!< \brief Identify if a point belong to a Linelet. */
   vector<vector<unsigned long> > LineletPoint; /*!< \brief Linelet structure. */
 
-  /*--- Temporary (hence mutable) working memory used in the Linelet preconditioner, outer vector is for threads ---*/
-  mutable vector<vector<const ScalarType*> > LineletUpper; /*!< \brief Pointers to the upper blocks of the tri-diag system (working memory). */
-  mutable vector<vector<ScalarType> > LineletInvDiag;      /*!< \brief Inverse of the diagonal blocks of the tri-diag system (working memory). */
-  mutable vector<vector<ScalarType> > LineletVector;       /*!< \brief Solution and RHS of the tri-diag system (working memory). */
+  unsigned long nColors;               /*!< \brief Number of colors of the multicolor SGS preconditioner. */
+  vector<unsigned long> colorRowPtr;   /*!< \brief Start of each color in colorRowIdx (size nColors+1). */
+  vector<unsigned long> colorRowIdx;   /*!< \brief Rows of the matrix grouped by color. */
+
+  /*--- Storage of the block-tridiagonal Thomas factorization of the linelets, computed
+   *    once per Jacobian and reused by every application of the preconditioner. ---*/
+  vector<unsigned long> lineletPtr;          /*!< \brief Start of each linelet in the factorization arrays (size nLinelet+1). */
+  vector<ScalarType> lineletInvDiag;         /*!< \brief Inverses of the modified diagonal blocks. */
+  vector<ScalarType> lineletWeight;          /*!< \brief Forward-elimination weights (lower block times previous inverse). */
+  vector<const ScalarType*> lineletUpper;    /*!< \brief Cached pointers to the upper blocks of the tri-diag systems. */
+  vector<const ScalarType*> lineletLower;    /*!< \brief Cached pointers to the lower blocks of the tri-diag systems. */
+  vector<const ScalarType*> lineletDiag;     /*!< \brief Cached pointers to the diagonal blocks of the tri-diag systems. */
 
 #ifdef USE_MKL
   using gemm_t = typename mkl_jit_wrapper<ScalarType>::gemm_t;
@@ -168,6 +215,12 @@ private:
   mutable CPastixWrapper<ScalarType> pastix_wrapper;
 #endif
 
+#ifdef CSYSMATRIX_OMP_OFFLOAD
+  bool deviceDataMapped;             /*!< \brief Whether the sparsity and matrix storage are mapped to a device. */
+  mutable bool deviceMatrixUpToDate; /*!< \brief Whether the device mirror of the matrix is current. */
+  mutable bool deviceInvMUpToDate;   /*!< \brief Whether the device mirror of the Jacobi preconditioner is current. */
+#endif
+
   /*!
    * \brief Auxilary object to wrap the edge map pointer used in fast block updates, i.e. without linear searches.
    */
@@ -224,6 +277,15 @@ private:
    */
   void MatrixVectorProductSub(const ScalarType *matrix, const ScalarType *vector, ScalarType *product) const;
 
+#ifdef CSYSMATRIX_OMP_OFFLOAD
+  /*!
+   * \brief Refresh the device mirror of the matrix if it changed since the last upload.
+   * \note Must be called by only one thread, modifications of the matrix are assumed
+   *       to start from SetValZero (i.e. once per nonlinear iteration).
+   */
+  void UpdateDeviceMatrix() const;
+#endif
+
   /*!
    * \brief Calculates the matrix-matrix product
    */
@@ -342,6 +404,33 @@ private:
    */
   void RowProduct(const CSysVector<ScalarType> & vec, unsigned long row_i, ScalarType *prod) const;
 
+  /*!
+   * \brief Version of MatrixVectorProduct() with the block size fixed at compilation.
+   * \note With the block size known statically the compiler can fully unroll and
+   *       vectorize the small dense products, this path is taken for the common
+   *       block sizes of the coupled solvers (see the dispatch in MatrixVectorProduct).
+   * \param[in] vec - CSysVector to be multiplied by the sparse matrix A.
+   * \param[out] prod - Result of the product.
+   * \param[in] rowBegin - First position of mvpRowOrder to process.
+   * \param[in] rowEnd - One past the last position of mvpRowOrder to process.
+   * \param[in] rowOrder - Row permutation, identity if null.
+   * \param[out] jacProd - If not null, D^{-1} * prod, with the inverse diagonal applied
+   *             while the row product is still in registers.
+   */
+  template<unsigned long N>
+  void MatrixVectorProductStatic(const CSysVector<ScalarType>& vec, CSysVector<ScalarType>& prod,
+                                 unsigned long rowBegin, unsigned long rowEnd,
+                                 const unsigned long* rowOrder,
+                                 CSysVector<ScalarType>* jacProd) const;
+
+  /*!
+   * \brief Common implementation of the matrix-vector product, optionally fused
+   *        with the application of the Jacobi preconditioner (see JacobiMatrixVectorProduct).
+   */
+  void MatrixVectorProductImpl(const CSysVector<ScalarType>& vec, CSysVector<ScalarType>& prod,
+                               CSysVector<ScalarType>* jacProd,
+                               CGeometry *geometry, const CConfig *config) const;
+
 public:
 
   /*!
@@ -370,6 +459,20 @@ public:
                   bool EdgeConnect, CGeometry *geometry,
                   const CConfig *config, bool needTranspPtr = false, bool grad_mode = false);
 
+  /*!
+   * \brief Freeze or unfreeze the matrix. While frozen all assembly-type modifications
+   *        are ignored and the preconditioners are not rebuilt, which allows reusing a
+   *        lagged Jacobian and its factorization over multiple nonlinear iterations.
+   * \note  A preconditioner must have been built at least once before freezing.
+   * \param[in] val - Freeze (true) or unfreeze (false) the matrix.
+   */
+  inline void SetFrozen(bool val) { frozen = val; }
+
+  /*!
+   * \brief Whether the matrix is currently frozen (see SetFrozen).
+   */
+  inline bool GetFrozen(void) const { return frozen; }
+
   /*!
    * \brief Sets to zero all the entries of the sparse matrix.
    */
@@ -380,6 +483,21 @@ public:
    */
   void SetValDiagonalZero(void);
 
+  /*!
+   * \brief Get the number of variables (the dimension of the matrix blocks).
+   */
+  inline unsigned long GetNVar(void) const { return nVar; }
+
+  /*!
+   * \brief Get the pointers to the first nonzero block of each row (CSR sparsity).
+   */
+  inline const unsigned long* GetRowPtr(void) const { return row_ptr; }
+
+  /*!
+   * \brief Get the column indices of the nonzero blocks (CSR sparsity).
+   */
+  inline const unsigned long* GetColInd(void) const { return col_ind; }
+
   /*!
    * \brief Get a pointer to the start of block "ij"
    * \param[in] block_i - Row index.
@@ -431,6 +549,7 @@ public:
   inline void SetBlock(unsigned long block_i, unsigned long block_j,
                        const OtherType *val_block, OtherType alpha = 1.0) {
 
+    if (frozen) return;
     auto mat_ij = GetBlock(block_i, block_j);
     if (!mat_ij) return;
     SU2_OMP_SIMD
@@ -464,6 +583,7 @@ public:
   inline void SetBlock(unsigned long block_i, unsigned long block_j,
                        const OtherType* const* val_block, OtherType alpha = 1.0) {
 
+    if (frozen) return;
     auto mat_ij = GetBlock(block_i, block_j);
     if (!mat_ij) return;
     for (auto iVar = 0ul; iVar < nVar; ++iVar) {
@@ -511,6 +631,7 @@ public:
   template <class MatrixType, bool Overwrite = true>
   inline void SetBlock(unsigned long block_i, unsigned long block_j, MatrixType& val_block,
                        typename MatrixType::Scalar alpha = 1.0) {
+    if (frozen) return;
     auto mat_ij = GetBlock(block_i, block_j);
     if (!mat_ij) return;
     for (auto iVar = 0ul; iVar < nVar; ++iVar) {
@@ -548,6 +669,7 @@ public:
   inline void UpdateBlocks(unsigned long iEdge, unsigned long iPoint, unsigned long jPoint,
                            const MatrixType& block_i, const MatrixType& block_j, OtherType scale = 1) {
 
+    if (frozen) return;
     ScalarType *bii = &matrix[dia_ptr[iPoint]*nVar*nEqn];
     ScalarType *bjj = &matrix[dia_ptr[jPoint]*nVar*nEqn];
     ScalarType *bij = &matrix[edge_ptr(iEdge,0)*nVar*nEqn];
@@ -575,6 +697,36 @@ public:
     UpdateBlocks<MatrixType,ScalarType>(iEdge, iPoint, jPoint, block_i, block_j, -1);
   }
 
+  /*!
+   * \brief Scaled update of the two off-diagonal blocks associated with one edge
+   *        of an FVM-type sparse pattern, by direct index (i.e. without the linear
+   *        search of AddBlock/SubtractBlock). The i/j orientation of the blocks
+   *        follows the node ordering of the edge.
+   * \param[in] iEdge - Index of edge that connects iPoint and jPoint.
+   * \param[in] block_ij - Added to block ij after scaling.
+   * \param[in] block_ji - Added to block ji after scaling.
+   * \param[in] scale_ij - Scale factor for block_ij.
+   * \param[in] scale_ji - Scale factor for block_ji.
+   */
+  template<class MatrixType, class OtherType = ScalarType>
+  inline void UpdateBlocksOffDiag(unsigned long iEdge, const MatrixType& block_ij,
+                                  const MatrixType& block_ji, OtherType scale_ij, OtherType scale_ji) {
+
+    if (frozen) return;
+    ScalarType *bij = &matrix[edge_ptr(iEdge,0)*nVar*nEqn];
+    ScalarType *bji = &matrix[edge_ptr(iEdge,1)*nVar*nEqn];
+
+    unsigned long iVar, jVar, offset = 0;
+
+    for (iVar = 0; iVar < nVar; iVar++) {
+      for (jVar = 0; jVar < nEqn; jVar++) {
+        bij[offset] += PassiveAssign(block_ij[iVar][jVar] * scale_ij);
+        bji[offset] += PassiveAssign(block_ji[iVar][jVar] * scale_ji);
+        ++offset;
+      }
+    }
+  }
+
   /*!
    * \brief SIMD version, does the update for multiple edges and points.
    * \note Nothing is updated if the mask is 0.
@@ -583,6 +735,7 @@ public:
   FORCEINLINE void UpdateBlocks(simd::Array<I,N> iEdge, simd::Array<I,N> iPoint, simd::Array<I,N> jPoint,
                                 const MatTypeSIMD& block_i, const MatTypeSIMD& block_j, simd::Array<F,N> mask = 1) {
 
+    if (frozen) return;
     static_assert(MatTypeSIMD::StaticSize, "This method requires static size blocks.");
     static_assert(MatTypeSIMD::IsRowMajor, "Block storage is not compatible with matrix.");
     constexpr size_t blkSz = MatTypeSIMD::StaticSize;
@@ -636,6 +789,7 @@ public:
   inline void SetBlocks(unsigned long iEdge, const MatrixType& block_i,
                         const MatrixType& block_j, OtherType scale = 1) {
 
+    if (frozen) return;
     ScalarType *bij = &matrix[edge_ptr(iEdge,0)*nVar*nEqn];
     ScalarType *bji = &matrix[edge_ptr(iEdge,1)*nVar*nEqn];
 
@@ -675,6 +829,7 @@ public:
   FORCEINLINE void SetBlocks(simd::Array<I,N> iEdge, const MatTypeSIMD& block_i,
                              const MatTypeSIMD& block_j, simd::Array<F,N> mask = 1) {
 
+    if (frozen) return;
     static_assert(MatTypeSIMD::StaticSize, "This method requires static size blocks.");
     static_assert(MatTypeSIMD::IsRowMajor, "Block storage is not compatible with matrix.");
     constexpr size_t blkSz = MatTypeSIMD::StaticSize;
@@ -721,6 +876,7 @@ public:
   template<class OtherType, bool Overwrite = true, class T = ScalarType>
   inline void SetBlock2Diag(unsigned long block_i, const OtherType& val_block, T alpha = 1.0) {
 
+    if (frozen) return;
     auto mat_ii = &matrix[dia_ptr[block_i]*nVar*nEqn];
 
     for (auto iVar = 0ul; iVar < nVar; iVar++)
@@ -754,6 +910,7 @@ public:
    */
   template<class OtherType>
   inline void AddVal2Diag(unsigned long block_i, OtherType val_matrix) {
+    if (frozen) return;
     for (auto iVar = 0ul; iVar < nVar; iVar++)
       matrix[dia_ptr[block_i]*nVar*nVar + iVar*(nVar+1)] += PassiveAssign(val_matrix);
   }
@@ -767,6 +924,7 @@ public:
    */
   template<class OtherType>
   inline void AddVal2Diag(unsigned long block_i, unsigned long iVar, OtherType val) {
+    if (frozen) return;
     matrix[dia_ptr[block_i]*nVar*nVar + iVar*(nVar+1)] += PassiveAssign(val);
   }
 
@@ -779,6 +937,7 @@ public:
   template<class OtherType>
   inline void SetVal2Diag(unsigned long block_i, OtherType val_matrix) {
 
+    if (frozen) return;
     unsigned long iVar, index = dia_ptr[block_i]*nVar*nVar;
 
     /*--- Clear entire block before setting its diagonal. ---*/
@@ -839,6 +998,23 @@ public:
   void MatrixVectorProduct(const CSysVector<ScalarType> & vec, CSysVector<ScalarType> & prod,
                            CGeometry *geometry, const CConfig *config) const;
 
+  /*!
+   * \brief Performs the product of a sparse matrix by a CSysVector with the Jacobi
+   *        preconditioner applied inline with the row traversal, i.e. prod = A*vec and
+   *        precProd = D^{-1}*A*vec in a single pass over the matrix, while the row
+   *        blocks are cache-hot. The halo exchange is done for precProd (not prod), as
+   *        the fused product is meant for preconditioned iterations that consume it.
+   * \note Requires the Jacobi preconditioner to be built (see BuildJacobiPreconditioner).
+   * \param[in] vec - CSysVector to be multiplied by the sparse matrix A.
+   * \param[out] prod - Result of the product.
+   * \param[out] precProd - Result of the product with the inverse diagonal applied.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void JacobiMatrixVectorProduct(const CSysVector<ScalarType> & vec, CSysVector<ScalarType> & prod,
+                                 CSysVector<ScalarType> & precProd,
+                                 CGeometry *geometry, const CConfig *config) const;
+
   /*!
    * \brief Build the Jacobi preconditioner.
    */
@@ -854,6 +1030,12 @@ public:
   void ComputeJacobiPreconditioner(const CSysVector<ScalarType> & vec, CSysVector<ScalarType> & prod,
                                    CGeometry *geometry, const CConfig *config) const;
 
+  /*!
+   * \brief Build the level schedule (dependency DAG levels) used by the exact
+   *        thread-parallel ILU factorization and triangular solves.
+   */
+  void BuildILULevelSchedule();
+
   /*!
    * \brief Build the ILU preconditioner.
    */
@@ -877,6 +1059,21 @@ public:
   void ComputeLU_SGSPreconditioner(const CSysVector<ScalarType> & vec, CSysVector<ScalarType> & prod,
                                    CGeometry *geometry, const CConfig *config) const;
 
+  /*!
+   * \brief Build the multicolor symmetric Gauss-Seidel preconditioner, i.e. the
+   *        inverse diagonal blocks and a greedy coloring of the sparsity pattern.
+   */
+  void BuildMulticolorSGSPreconditioner();
+
+  /*!
+   * \brief Multiply CSysVector by the multicolor SGS preconditioner, the sweeps
+   *        run color by color so that within a color rows update in parallel.
+   * \param[in] vec - CSysVector to be multiplied by the preconditioner.
+   * \param[out] prod - Result of the product A*vec.
+   */
+  void ComputeMulticolorSGSPreconditioner(const CSysVector<ScalarType> & vec, CSysVector<ScalarType> & prod,
+                                          CGeometry *geometry, const CConfig *config) const;
+
   /*!
    * \brief Build the Linelet preconditioner.
    * \param[in] geometry - Geometrical definition of the problem.
@@ -885,6 +1082,12 @@ public:
    */
   unsigned long BuildLineletPreconditioner(CGeometry *geometry, const CConfig *config);
 
+  /*!
+   * \brief Factorize the block-tridiagonal linelet systems (Thomas algorithm),
+   *        done once per Jacobian so applications only perform substitutions.
+   */
+  void FactorizeLineletPreconditioner();
+
   /*!
    * \brief Multiply CSysVector by the preconditioner
    * \param[in] vec - CSysVector to be multiplied by the preconditioner.
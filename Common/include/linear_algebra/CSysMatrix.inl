@@ -73,6 +73,40 @@ FORCEINLINE void gemv_impl(unsigned long n, unsigned long m, const T *a, const T
   }
 }
 
+template<class T, bool alpha, bool beta, bool transp, unsigned long N>
+FORCEINLINE void gemv_stat(const T *a, const T *b, T *c) {
+  /*--- Version of gemv_impl for square blocks with the size known at
+   compilation, the constant loop bounds allow full unrolling and
+   vectorization of the block arithmetic. ---*/
+  if (!transp) {
+    for (auto i = 0ul; i < N; i++) {
+      if (!beta) c[i] = 0.0;
+      SU2_OMP_SIMD
+      for (auto j = 0ul; j < N; j++)
+        c[i] += (alpha? 1 : -1) * a[i*N+j] * b[j];
+    }
+  } else {
+    if (!beta) for (auto j = 0ul; j < N; j++) c[j] = 0.0;
+    for (auto i = 0ul; i < N; i++)
+      for (auto j = 0ul; j < N; j++)
+        c[j] += (alpha? 1 : -1) * a[i*N+j] * b[i];
+  }
+}
+
+template<class T, bool alpha, bool beta, bool transp>
+FORCEINLINE bool gemv_dispatch(unsigned long n, unsigned long m, const T *a, const T *b, T *c) {
+  /*--- Forward square blocks of the common sizes of the coupled solvers to
+   the specialized kernel, returns false if the generic version is needed. ---*/
+  if (n != m) return false;
+  switch (n) {
+    case 4: gemv_stat<T,alpha,beta,transp,4>(a, b, c); return true;
+    case 5: gemv_stat<T,alpha,beta,transp,5>(a, b, c); return true;
+    case 6: gemv_stat<T,alpha,beta,transp,6>(a, b, c); return true;
+    case 7: gemv_stat<T,alpha,beta,transp,7>(a, b, c); return true;
+    default: return false;
+  }
+}
+
 template<class T>
 FORCEINLINE void gemm_impl(unsigned long n, const T *a, const T *b, T *c) {
   /*--- Same deal as for GEMV but here only the type is templated. ---*/
@@ -98,14 +132,17 @@ MATVECPROD_SIGNATURE( MatrixVectorProduct ) {
    Without MKL (default) picture copying the body of gemv_impl
    here and resolving the conditionals at compilation.
   ---*/
+  if (gemv_dispatch<ScalarType,true,false,false>(nVar, nEqn, matrix, vector, product)) return;
   gemv_impl<ScalarType,true,false,false>(nVar, nEqn, matrix, vector, product);
 }
 
 MATVECPROD_SIGNATURE( MatrixVectorProductAdd ) {
+  if (gemv_dispatch<ScalarType,true,true,false>(nVar, nEqn, matrix, vector, product)) return;
   gemv_impl<ScalarType,true,true,false>(nVar, nEqn, matrix, vector, product);
 }
 
 MATVECPROD_SIGNATURE( MatrixVectorProductSub ) {
+  if (gemv_dispatch<ScalarType,false,true,false>(nVar, nEqn, matrix, vector, product)) return;
   gemv_impl<ScalarType,false,true,false>(nVar, nEqn, matrix, vector, product);
 }
 
@@ -179,7 +216,7 @@ FORCEINLINE void CSysMatrix<ScalarType>::RowProduct(const CSysVector<ScalarType>
     prod[iVar] = 0.0;
 
   for (auto index = row_ptr[row_i]; index < row_ptr[row_i+1]; index++) {
-    auto col_j = col_ind[index];
+    const auto col_j = col_ind_prod[index];
     MatrixVectorProductAdd(&matrix[index*nVar*nEqn], &vec[col_j*nEqn], prod);
   }
 }
@@ -191,7 +228,7 @@ FORCEINLINE void CSysMatrix<ScalarType>::UpperProduct(const CSysVector<ScalarTyp
     prod[iVar] = 0.0;
 
   for (auto index = dia_ptr[row_i]+1; index < row_ptr[row_i+1]; index++) {
-    auto col_j = col_ind[index];
+    const auto col_j = col_ind_prod[index];
     if (col_j < col_ub)
       MatrixVectorProductAdd(&matrix[index*nVar*nEqn], &vec[col_j*nEqn], prod);
   }
@@ -204,7 +241,7 @@ FORCEINLINE void CSysMatrix<ScalarType>::LowerProduct(const CSysVector<ScalarTyp
     prod[iVar] = 0.0;
 
   for (auto index = row_ptr[row_i]; index < dia_ptr[row_i]; index++) {
-    auto col_j = col_ind[index];
+    const auto col_j = col_ind_prod[index];
     if (col_j >= col_lb)
       MatrixVectorProductAdd(&matrix[index*nVar*nEqn], &vec[col_j*nEqn], prod);
   }
@@ -84,20 +84,35 @@ private:
   mutable bool cg_ready;     /*!< \brief Indicate if memory used by CG is allocated. */
   mutable bool bcg_ready;    /*!< \brief Indicate if memory used by BCGSTAB is allocated. */
   mutable bool smooth_ready; /*!< \brief Indicate if memory used by SMOOTHER is allocated. */
+  mutable bool pcg_ready;    /*!< \brief Indicate if memory used by pipelined CG is allocated. */
 
   mutable VectorType r;      /*!< \brief Residual in CG and BCGSTAB. */
   mutable VectorType A_x;    /*!< \brief Result of matrix-vector product in CG and BCGSTAB. */
   mutable VectorType p;      /*!< \brief Direction in CG and BCGSTAB. */
   mutable VectorType z;      /*!< \brief Preconditioned residual/direction in CG/BCGSTAB. */
+  mutable VectorType zAux;   /*!< \brief Preconditioned product (M^-1 A z) in the fused smoother. */
+
+  mutable VectorType pipe_m; /*!< \brief Preconditioned A.z in pipelined CG (m = M^-1.A.z). */
+  mutable VectorType pipe_z; /*!< \brief Recurrence for A.q in pipelined CG. */
+  mutable VectorType pipe_q; /*!< \brief Recurrence for the preconditioned direction in pipelined CG. */
+  mutable VectorType pipe_s; /*!< \brief Recurrence for A.p in pipelined CG. */
 
   mutable VectorType r_0;    /*!< \brief The "arbitrary" vector in BCGSTAB. */
   mutable VectorType v;      /*!< \brief BCGSTAB "v" vector (v = A * M^-1 * p). */
 
   mutable std::vector<VectorType> W;  /*!< \brief Large matrix used by FGMRES, w^i+1 = A * z^i. */
   mutable std::vector<VectorType> Z;  /*!< \brief Large matrix used by FGMRES, preconditioned W. */
+  mutable su2vector<ScalarType> krylovSlab; /*!< \brief Contiguous storage shared by the FGMRES basis vectors (better TLB behavior). */
+
+  mutable std::vector<VectorType> R;  /*!< \brief Directions recycled from the previous FGMRES solve (deflation). */
+  mutable unsigned long nRecycled = 0; /*!< \brief Number of valid directions currently stored in R. */
 
   VectorType  LinSysSol_tmp;        /*!< \brief Temporary used when it is necessary to interface between active and passive types. */
   VectorType  LinSysRes_tmp;        /*!< \brief Temporary used when it is necessary to interface between active and passive types. */
+
+  VectorType Refine_x;              /*!< \brief Solver-precision copy of the solution during iterative refinement. */
+  VectorType Refine_Ax;             /*!< \brief Solver-precision matrix-vector product during iterative refinement. */
+  CSysVector<su2double> Refine_r;   /*!< \brief Full precision residual/correction during iterative refinement. */
   VectorType* LinSysSol_ptr;        /*!< \brief Pointer to appropriate LinSysSol (set to original or temporary in call to Solve). */
   const VectorType* LinSysRes_ptr;  /*!< \brief Pointer to appropriate LinSysRes (set to original or temporary in call to Solve). */
 
@@ -105,6 +120,8 @@ private:
   bool xIsZero = false;           /*!< \brief If true assume the initial solution is always 0. */
   bool recomputeRes = false;      /*!< \brief Recompute the residual after inner iterations, if monitoring. */
   unsigned long monitorFreq = 10; /*!< \brief Monitoring frequency. */
+  ScalarType tolForcing = 1.0;    /*!< \brief Multiplier applied to the configured tolerance (inexact-Newton forcing schedule). */
+  bool recomputePrecond = true;   /*!< \brief Build the preconditioner in Solve (see SetRecomputePreconditioner). */
 
   /*!
    * \brief sign transfer function
@@ -311,6 +328,24 @@ public:
                              const PrecondType & precond, ScalarType tol, unsigned long m,
                              ScalarType & residual, bool monitoring, const CConfig *config) const;
 
+  /*! \brief Pipelined preconditioned Conjugate Gradient method (Ghysels and Vanroose)
+   * \note Algebraically equivalent to CG but the two dot products per iteration are
+   *       fused into a single non-blocking reduction that is overlapped with the
+   *       preconditioner and matrix-vector product, at the cost of extra recurrences.
+   * \param[in] b - the right hand size vector
+   * \param[in,out] x - on entry the intial guess, on exit the solution
+   * \param[in] mat_vec - object that defines matrix-vector product
+   * \param[in] precond - object that defines preconditioner
+   * \param[in] tol - tolerance with which to solve the system
+   * \param[in] m - maximum size of the search subspace
+   * \param[out] residual - final normalized residual
+   * \param[in] monitoring - turn on priting residuals from solver to screen.
+   * \param[in] config - Definition of the particular problem.
+   */
+  unsigned long PCG_LinSolver(const VectorType & b, VectorType & x, const ProductType & mat_vec,
+                              const PrecondType & precond, ScalarType tol, unsigned long m,
+                              ScalarType & residual, bool monitoring, const CConfig *config) const;
+
   /*!
    * \brief Flexible Generalized Minimal Residual method
    * \param[in] b - the right hand size vector
@@ -421,4 +456,26 @@ public:
    */
   inline void SetMonitoringFrequency(bool frequency) {monitorFreq = frequency;}
 
+  /*!
+   * \brief Set the forcing factor applied to the configured tolerance (inexact-Newton schedule).
+   * \param[in] factor - Multiplier in (0,1], values below 1 tighten the tolerance.
+   */
+  inline void SetToleranceForcing(passivedouble factor) {
+    if (factor < 1e-6) factor = 1e-6;
+    if (factor > 1.0) factor = 1.0;
+    tolForcing = ScalarType(factor);
+  }
+
+  /*!
+   * \brief Set whether the preconditioner is (re)built on the next call to Solve. Only skip
+   *        the build if the matrix has not changed since the previous Solve, the factorization
+   *        stored in the matrix from that call is then reused.
+   */
+  inline void SetRecomputePreconditioner(bool recompute) {recomputePrecond = recompute;}
+
+  /*!
+   * \brief Set the mode of operation, changes the source of the solver options (see LINEAR_SOLVER_MODE).
+   */
+  inline void SetSolverMode(LINEAR_SOLVER_MODE mode) {lin_sol_mode = mode;}
+
 };
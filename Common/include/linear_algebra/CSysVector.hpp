@@ -28,6 +28,8 @@
 
 #pragma once
 
+#include <vector>
+
 #include "../parallelization/mpi_structure.hpp"
 #include "../parallelization/omp_structure.hpp"
 #include "../parallelization/vectorization.hpp"
@@ -65,7 +67,9 @@ class CSysVector : public VecExpr::CVecExpr<CSysVector<ScalarType>, ScalarType>
   enum { OMP_MAX_SIZE = 4096 }; /*!< \brief Maximum chunk size used in parallel for loops. */
 
   unsigned long omp_chunk_size = OMP_MAX_SIZE; /*!< \brief Static chunk size used in loops. */
+  static bool fixedOrderReduction;             /*!< \brief Fixed-order dot products, independent of the number of threads (see DETERMINISTIC_REDUCTIONS). */
   ScalarType* vec_val = nullptr;               /*!< \brief Storage, 64 byte aligned (do not use normal new/delete). */
+  bool ownsData = true;            /*!< \brief False when the vector maps externally owned storage. */
   unsigned long nElm = 0;          /*!< \brief Total number of elements (or number elements on this processor). */
   unsigned long nElmDomain = 0;    /*!< \brief Total number of elements without Ghost cells. */
   unsigned long nVar = 1;          /*!< \brief Number of elements in a block. */
@@ -95,9 +99,47 @@ class CSysVector : public VecExpr::CVecExpr<CSysVector<ScalarType>, ScalarType>
     }
   }
 
+  /*!
+   * \brief Fixed-order reduction of a range: partial sums over fixed-size chunks, each
+   *        chunk summed by a single thread and the chunks combined in index order by
+   *        the master thread, making the result independent of the number of threads.
+   * \note The target must be the shared variable of the reduction, only the master
+   *       thread adds to it, callers need a barrier before reading it.
+   */
+  template <class F>
+  void FixedOrderReduction(unsigned long n, ScalarType& target, F term) const {
+    static std::vector<ScalarType> partials;
+
+    const auto nChunks = (n + OMP_MAX_SIZE - 1) / OMP_MAX_SIZE;
+
+    SU2_OMP_MASTER
+    partials.assign(nChunks, ScalarType(0.0));
+    END_SU2_OMP_MASTER
+    SU2_OMP_BARRIER
+
+    SU2_OMP_FOR_STAT(1)
+    for (auto iChunk = 0ul; iChunk < nChunks; ++iChunk) {
+      const auto begin = iChunk * OMP_MAX_SIZE;
+      const auto end = (begin + OMP_MAX_SIZE < n) ? begin + OMP_MAX_SIZE : n;
+      ScalarType sum = 0.0;
+      for (auto i = begin; i < end; ++i) sum += term(i);
+      partials[iChunk] = sum;
+    }
+    END_SU2_OMP_FOR
+
+    SU2_OMP_MASTER
+    for (const auto& p : partials) target += p;
+    END_SU2_OMP_MASTER
+  }
+
  public:
   static constexpr bool StoreAsRef = true; /*! \brief Required by CVecExpr. */
 
+  /*!
+   * \brief Enable/disable fixed-order (thread-count-independent) dot products.
+   */
+  static void SetFixedOrderReduction(bool mode) { fixedOrderReduction = mode; }
+
   /*!
    * \brief Default constructor of the class.
    */
@@ -174,6 +216,17 @@ class CSysVector : public VecExpr::CVecExpr<CSysVector<ScalarType>, ScalarType>
     Initialize(numBlk, numBlkDomain, numVar, ptr, true, false);
   }
 
+  /*!
+   * \brief Map the vector onto externally owned storage, which is neither initialized nor freed.
+   * \note Allows multiple vectors (e.g. a Krylov basis) to share one contiguous allocation,
+   * the pointer must remain valid while the vector is in use and be suitably aligned.
+   * \param[in] numBlk - number of blocks locally
+   * \param[in] numBlkDomain - number of blocks locally (without g cells)
+   * \param[in] numVar - number of variables in each block
+   * \param[in] ptr - externally owned storage with space for numBlk*numVar elements
+   */
+  void MapExternalStorage(unsigned long numBlk, unsigned long numBlkDomain, unsigned long numVar, ScalarType* ptr);
+
   /*!
    * \brief Set our values (resizing if required) by copying from other, the derivative information is lost.
    * \param[in] other - source CSysVector
@@ -306,14 +359,86 @@ class CSysVector : public VecExpr::CVecExpr<CSysVector<ScalarType>, ScalarType>
     /*--- Local dot product for each thread. ---*/
     ScalarType sum = 0.0;
 
-    CSYSVEC_PARFOR
-    for (auto i = 0ul; i < nElmDomain; ++i) {
-      sum += vec_val[i] * expr.derived()[i];
+    if (fixedOrderReduction) {
+      const auto* vec = vec_val;
+      const auto& other = expr.derived();
+      FixedOrderReduction(nElmDomain, dotRes, [vec, &other](unsigned long i) { return vec[i] * other[i]; });
+    }
+    else {
+      CSYSVEC_PARFOR
+      for (auto i = 0ul; i < nElmDomain; ++i) {
+        sum += vec_val[i] * expr.derived()[i];
+      }
+      END_CSYSVEC_PARFOR
+
+      /*--- Update shared variable with "our" partial sum. ---*/
+      atomicAdd(sum, dotRes);
     }
+
+#ifdef HAVE_MPI
+    /*--- Reduce across all mpi ranks, only master thread communicates. ---*/
+    SU2_OMP_BARRIER
+    SU2_OMP_MASTER {
+      sum = dotRes;
+      const auto mpi_type = (sizeof(ScalarType) < sizeof(double)) ? MPI_FLOAT : MPI_DOUBLE;
+      SelectMPIWrapper<ScalarType>::W::Allreduce(&sum, &dotRes, 1, mpi_type, MPI_SUM, SU2_MPI::GetComm());
+    }
+    END_SU2_OMP_MASTER
+#endif
+    /*--- Make view of result consistent across threads. ---*/
+    SU2_OMP_BARRIER
+
+    return dotRes;
+  }
+
+  /*!
+   * \brief Fused axpy and dot product, computes "this += alpha*x" and the dot product
+   * of the result with y in a single pass over the data.
+   * \note Halves the memory traffic of Gram-Schmidt-type orthogonalizations, where the
+   * projection onto one basis vector is subtracted while the product with the next one
+   * is accumulated. "y" may alias "this" to obtain the squared norm of the result.
+   * \param[in] alpha - Scale factor of x.
+   * \param[in] x - Vector being added to this one.
+   * \param[in] y - Vector the result is dotted with.
+   * \return Dot product of the updated vector with y.
+   */
+  ScalarType AxpyDot(ScalarType alpha, const CSysVector& x, const CSysVector& y) {
+    static ScalarType dotRes;
+    /*--- All threads get the same "view" of the vectors and shared variable. ---*/
+    SU2_OMP_BARRIER
+    SU2_OMP_MASTER
+    dotRes = 0.0;
+    END_SU2_OMP_MASTER
+    SU2_OMP_BARRIER
+
+    /*--- Update and local dot product for each thread. ---*/
+    ScalarType sum = 0.0;
+
+    if (fixedOrderReduction) {
+      auto* vec = vec_val;
+      const auto* xv = x.vec_val;
+      const auto* yv = y.vec_val;
+      FixedOrderReduction(nElmDomain, dotRes, [vec, xv, yv, alpha](unsigned long i) {
+        vec[i] += alpha * xv[i];
+        return vec[i] * yv[i];
+      });
+    }
+    else {
+      CSYSVEC_PARFOR
+      for (auto i = 0ul; i < nElmDomain; ++i) {
+        vec_val[i] += alpha * x.vec_val[i];
+        sum += vec_val[i] * y.vec_val[i];
+      }
+      END_CSYSVEC_PARFOR
+    }
+
+    /*--- Halo elements are updated but do not enter the dot product. ---*/
+    CSYSVEC_PARFOR
+    for (auto i = nElmDomain; i < nElm; ++i) vec_val[i] += alpha * x.vec_val[i];
     END_CSYSVEC_PARFOR
 
     /*--- Update shared variable with "our" partial sum. ---*/
-    atomicAdd(sum, dotRes);
+    if (!fixedOrderReduction) atomicAdd(sum, dotRes);
 
 #ifdef HAVE_MPI
     /*--- Reduce across all mpi ranks, only master thread communicates. ---*/
@@ -331,6 +456,24 @@ class CSysVector : public VecExpr::CVecExpr<CSysVector<ScalarType>, ScalarType>
     return dotRes;
   }
 
+  /*!
+   * \brief Add a linear combination of several vectors to this one in a single pass
+   * over the data, i.e. this += coef[0]*vecs[0] + ... + coef[n-1]*vecs[n-1].
+   * \note Replaces a chain of axpy's, which would traverse this vector n times.
+   * \param[in] nTerms - Number of vectors in the combination.
+   * \param[in] coef - Coefficients of the combination.
+   * \param[in] vecs - Pointers to the vectors of the combination.
+   */
+  void AddLinearCombination(unsigned long nTerms, const ScalarType* coef, const CSysVector* const* vecs) {
+    CSYSVEC_PARFOR
+    for (auto i = 0ul; i < nElm; ++i) {
+      ScalarType sum = 0.0;
+      for (auto k = 0ul; k < nTerms; ++k) sum += coef[k] * vecs[k]->vec_val[i];
+      vec_val[i] += sum;
+    }
+    END_CSYSVEC_PARFOR
+  }
+
   /*!
    * \brief Squared L2 norm of the vector (via dot with self).
    * \return Squared L2 norm.
@@ -449,5 +592,8 @@ class CSysVector : public VecExpr::CVecExpr<CSysVector<ScalarType>, ScalarType>
   }
 };
 
+template <class ScalarType>
+bool CSysVector<ScalarType>::fixedOrderReduction = false;
+
 #undef CSYSVEC_PARFOR
 #undef END_CSYSVEC_PARFOR
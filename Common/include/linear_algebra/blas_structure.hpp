@@ -34,6 +34,8 @@
 #include "libxsmm.h"
 #endif
 
+#include <vector>
+
 class CConfig;
 
 /*!
@@ -80,6 +82,51 @@ public:
   void gemv(const int M,        const int N,   const su2double *A,
             const su2double *x, su2double *y);
 
+  /*!
+   * \brief Function, which carries out the 2D tensor product C = (Aj x Ai) B via
+            sum factorization, where x indicates the Kronecker product. The rows
+            of B and C correspond to the points of a 2D tensor-product grid,
+            stored lexicographically with the i-index running fastest. Note that
+            this function is not thread safe, because the work memory for the
+            intermediate result is stored in the class.
+   * \param[in]  M      - Number of rows of Ai and Aj.
+   * \param[in]  K      - Number of columns of Ai and Aj.
+   * \param[in]  N      - Number of columns of B and C.
+   * \param[in]  Ai     - 1D operator applied to the i-index of B, row major order.
+   * \param[in]  Aj     - 1D operator applied to the j-index of B, row major order.
+   * \param[in]  B      - Input matrix with K*K rows, possibly strided.
+   * \param[in]  ldb    - Distance in memory between consecutive rows of B.
+   * \param[out] C      - Result of the tensor product with M*M contiguous rows.
+   * \param[in]  addToC - Whether the result must be added to C or C overwritten.
+   */
+  void tensorProduct2D(const int M,         const int K,         const int N,
+                       const su2double *Ai, const su2double *Aj,
+                       const su2double *B,  const int ldb,
+                       su2double *C,        const bool addToC);
+
+  /*!
+   * \brief Function, which carries out the 3D tensor product C = (Ak x Aj x Ai) B
+            via sum factorization, where x indicates the Kronecker product. The rows
+            of B and C correspond to the points of a 3D tensor-product grid, stored
+            lexicographically with the i-index running fastest. Note that this
+            function is not thread safe, because the work memory for the
+            intermediate results is stored in the class.
+   * \param[in]  M      - Number of rows of Ai, Aj and Ak.
+   * \param[in]  K      - Number of columns of Ai, Aj and Ak.
+   * \param[in]  N      - Number of columns of B and C.
+   * \param[in]  Ai     - 1D operator applied to the i-index of B, row major order.
+   * \param[in]  Aj     - 1D operator applied to the j-index of B, row major order.
+   * \param[in]  Ak     - 1D operator applied to the k-index of B, row major order.
+   * \param[in]  B      - Input matrix with K*K*K rows, possibly strided.
+   * \param[in]  ldb    - Distance in memory between consecutive rows of B.
+   * \param[out] C      - Result of the tensor product with M*M*M contiguous rows.
+   * \param[in]  addToC - Whether the result must be added to C or C overwritten.
+   */
+  void tensorProduct3D(const int M,         const int K,         const int N,
+                       const su2double *Ai, const su2double *Aj, const su2double *Ak,
+                       const su2double *B,  const int ldb,
+                       su2double *C,        const bool addToC);
+
   /*!
    * \brief Function, to carry out the axpy operation, i.e y += a*x.
    * \param[in]    n   - Number of elements in the vectors x and y.
@@ -509,6 +556,9 @@ public:
 
 private:
 
+  std::vector<su2double> memTensorProducts; /*!< \brief Work memory to store the intermediate
+                                                        results of the tensor products. */
+
 #if !(defined(HAVE_LIBXSMM) || defined(HAVE_BLAS) || defined(HAVE_MKL)) || (defined(CODI_REVERSE_TYPE) || defined(CODI_FORWARD_TYPE))
     /* Blocking parameters for the outer kernel.  We multiply mc x kc blocks of
      the matrix A with kc x nc panels of the matrix B (this approach is referred
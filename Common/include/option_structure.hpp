@@ -1665,6 +1665,9 @@ enum class OUTPUT_TYPE {
   SURFACE_CGNS,            /*!< \brief CGNS format. */
   STL_ASCII,               /*!< \brief STL ASCII format for surface solution output. */
   STL_BINARY,              /*!< \brief STL binary format for surface solution output. Not implemented yet. */
+  SURFACE_TIMESERIES,      /*!< \brief Single growing binary file with one record appended per write, for time-resolved surface data. */
+  RESTART_SURFACE,         /*!< \brief SU2 sparse binary restart format holding only marker-adjacent points. */
+  RESTART_HIGHORDER,       /*!< \brief SU2 element-collocated binary restart format for the high-order DG solver. */
 };
 static const MapType<std::string, OUTPUT_TYPE> Output_Map = {
   MakePair("TECPLOT_ASCII", OUTPUT_TYPE::TECPLOT_ASCII)
@@ -1687,6 +1690,9 @@ static const MapType<std::string, OUTPUT_TYPE> Output_Map = {
   MakePair("SURFACE_CGNS", OUTPUT_TYPE::SURFACE_CGNS)
   MakePair("STL_ASCII", OUTPUT_TYPE::STL_ASCII)
   MakePair("STL_BINARY", OUTPUT_TYPE::STL_BINARY)
+  MakePair("SURFACE_TIMESERIES", OUTPUT_TYPE::SURFACE_TIMESERIES)
+  MakePair("RESTART_SURFACE", OUTPUT_TYPE::RESTART_SURFACE)
+  MakePair("RESTART_HIGHORDER", OUTPUT_TYPE::RESTART_HIGHORDER)
 };
 
 /*!
@@ -1868,6 +1874,7 @@ enum ENUM_LINEAR_SOLVER {
   FGMRES,               /*!< \brief Flexible Generalized Minimal Residual method. */
   BCGSTAB,              /*!< \brief BCGSTAB - Biconjugate Gradient Stabilized Method (main solver). */
   RESTARTED_FGMRES,     /*!< \brief Flexible Generalized Minimal Residual method with restart. */
+  PIPELINED_CG,         /*!< \brief Pipelined conjugate gradient, overlaps the global reductions with local work. */
   SMOOTHER,             /*!< \brief Iterative smoother. */
   PASTIX_LDLT,          /*!< \brief PaStiX LDLT (complete) factorization. */
   PASTIX_LU,            /*!< \brief PaStiX LU (complete) factorization. */
@@ -1877,6 +1884,7 @@ static const MapType<std::string, ENUM_LINEAR_SOLVER> Linear_Solver_Map = {
   MakePair("BCGSTAB", BCGSTAB)
   MakePair("FGMRES", FGMRES)
   MakePair("RESTARTED_FGMRES", RESTARTED_FGMRES)
+  MakePair("PIPELINED_CG", PIPELINED_CG)
   MakePair("SMOOTHER", SMOOTHER)
   MakePair("PASTIX_LDLT", PASTIX_LDLT)
   MakePair("PASTIX_LU", PASTIX_LU)
@@ -1936,6 +1944,8 @@ enum ENUM_LINEAR_SOLVER_PREC {
   LU_SGS,         /*!< \brief LU SGS preconditioner. */
   LINELET,        /*!< \brief Line implicit preconditioner. */
   ILU,            /*!< \brief ILU(k) preconditioner. */
+  MC_SGS,         /*!< \brief Multicolor symmetric Gauss-Seidel preconditioner. */
+  AMG,            /*!< \brief Two-level aggregation (algebraic multigrid) preconditioner. */
   PASTIX_ILU=10,  /*!< \brief PaStiX ILU(k) preconditioner. */
   PASTIX_LU_P,    /*!< \brief PaStiX LU as preconditioner. */
   PASTIX_LDLT_P,  /*!< \brief PaStiX LDLT as preconditioner. */
@@ -1945,6 +1955,8 @@ static const MapType<std::string, ENUM_LINEAR_SOLVER_PREC> Linear_Solver_Prec_Ma
   MakePair("LU_SGS", LU_SGS)
   MakePair("LINELET", LINELET)
   MakePair("ILU", ILU)
+  MakePair("MULTICOLOR_SGS", MC_SGS)
+  MakePair("AMG", AMG)
   MakePair("PASTIX_ILU", PASTIX_ILU)
   MakePair("PASTIX_LU", PASTIX_LU_P)
   MakePair("PASTIX_LDLT", PASTIX_LDLT_P)
@@ -2137,6 +2149,7 @@ enum MPI_QUANTITIES {
   UNDIVIDED_LAPLACIAN  ,  /*!< \brief Undivided Laplacian communication. */
   MAX_EIGENVALUE       ,  /*!< \brief Maximum eigenvalue communication. */
   SENSOR               ,  /*!< \brief Dissipation sensor communication. */
+  LAPLACIAN_SENSOR     ,  /*!< \brief Fused undivided Laplacian and dissipation sensor communication (one message instead of two). */
   AUXVAR_GRADIENT      ,  /*!< \brief Auxiliary variable gradient communication. */
   COORDINATES          ,  /*!< \brief Vertex coordinates communication. */
   COORDINATES_OLD      ,  /*!< \brief Old vertex coordinates communication. */
@@ -2277,6 +2290,7 @@ enum class LINEAR_SOLVER_MODE {
   STANDARD,        /*!< \brief Operate in standard mode. */
   MESH_DEFORM,     /*!< \brief Operate in mesh deformation mode. */
   GRADIENT_MODE,   /*!< \brief Operate in gradient smoothing mode. */
+  TURBULENT,       /*!< \brief Operate in scalar (turbulence/species) mode, allows a dedicated solver/smoother for those systems. */
 };
 
 /*!
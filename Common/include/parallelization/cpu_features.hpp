@@ -0,0 +1,67 @@
+/*!
+ * \file cpu_features.hpp
+ * \brief Runtime detection of the SIMD capabilities of the host CPU.
+ * \note The SIMD width of the numerics kernels is a compile-time property
+ * (it defines the data layout of simd::Array and the flux interfaces), these
+ * utilities detect at runtime whether the host supports a wider vector size
+ * than the one the binary was compiled for, e.g. a fleet-wide AVX2 build
+ * running on AVX-512 hardware.
+ * \version 7.3.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2022, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "vectorization.hpp"
+
+namespace CpuFeatures {
+
+/*!
+ * \brief Vector width (bytes) the binary was compiled for.
+ */
+constexpr size_t CompiledVectorWidth() { return simd::PREFERRED_SIZE; }
+
+/*!
+ * \brief Widest vector width (bytes) supported by the CPU the binary runs on.
+ * \note Falls back to the compiled width when runtime detection is not
+ * available for the architecture / compiler combination.
+ */
+inline size_t HostVectorWidth() {
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+  if (__builtin_cpu_supports("avx512f")) return 64;
+  if (__builtin_cpu_supports("avx")) return 32;
+  if (__builtin_cpu_supports("sse2")) return 16;
+  return 8;
+#elif defined(__aarch64__)
+  /*--- NEON (128bit) is mandatory on AArch64. ---*/
+  return 16;
+#else
+  return CompiledVectorWidth();
+#endif
+}
+
+/*!
+ * \brief Whether the host supports wider vectors than the binary uses.
+ */
+inline bool HostIsWiderThanBinary() { return HostVectorWidth() > CompiledVectorWidth(); }
+
+}  // namespace CpuFeatures
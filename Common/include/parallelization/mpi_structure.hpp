@@ -174,6 +174,20 @@ class CBaseMPIWrapper {
 
   static inline int Request_free(Request *request) { return MPI_Request_free(request); }
 
+  static inline void Send_init(const void* buf, int count, Datatype datatype, int dest, int tag, Comm comm,
+                               Request* request) {
+    MPI_Send_init(buf, count, datatype, dest, tag, comm, request);
+  }
+
+  static inline void Recv_init(void* buf, int count, Datatype datatype, int source, int tag, Comm comm,
+                               Request* request) {
+    MPI_Recv_init(buf, count, datatype, source, tag, comm, request);
+  }
+
+  static inline void Start(Request* request) { MPI_Start(request); }
+
+  static inline void Startall(int nrequests, Request* request) { MPI_Startall(nrequests, request); }
+
   static inline void Testall(int count, Request* array_of_requests, int* flag, Status* array_of_statuses) {
     MPI_Testall(count, array_of_requests, flag, array_of_statuses);
   }
@@ -184,6 +198,10 @@ class CBaseMPIWrapper {
 
   static inline void Probe(int source, int tag, Comm comm, Status* status) { MPI_Probe(source, tag, comm, status); }
 
+  static inline void Iprobe(int source, int tag, Comm comm, int* flag, Status* status) {
+    MPI_Iprobe(source, tag, comm, flag, status);
+  }
+
   static inline void Send(const void* buf, int count, Datatype datatype, int dest, int tag, Comm comm) {
     MPI_Send(buf, count, datatype, dest, tag, comm);
   }
@@ -205,6 +223,11 @@ class CBaseMPIWrapper {
     MPI_Allreduce(sendbuf, recvbuf, count, datatype, op, comm);
   }
 
+  static inline void Iallreduce(const void* sendbuf, void* recvbuf, int count, Datatype datatype, Op op, Comm comm,
+                                Request* request) {
+    MPI_Iallreduce(sendbuf, recvbuf, count, datatype, op, comm, request);
+  }
+
   static inline void Gather(const void* sendbuf, int sendcnt, Datatype sendtype, void* recvbuf, int recvcnt,
                             Datatype recvtype, int root, Comm comm) {
     MPI_Gather(sendbuf, sendcnt, sendtype, recvbuf, recvcnt, recvtype, root, comm);
@@ -225,6 +248,12 @@ class CBaseMPIWrapper {
     MPI_Allgatherv(sendbuf, sendcount, sendtype, recvbuf, recvcounts, displs, recvtype, comm);
   }
 
+  static inline void Iallgatherv(const void* sendbuf, int sendcount, Datatype sendtype, void* recvbuf,
+                                 const int* recvcounts, const int* displs, Datatype recvtype, Comm comm,
+                                 Request* request) {
+    MPI_Iallgatherv(sendbuf, sendcount, sendtype, recvbuf, recvcounts, displs, recvtype, comm, request);
+  }
+
   static inline void Alltoall(const void* sendbuf, int sendcount, Datatype sendtype, void* recvbuf, int recvcount,
                               Datatype recvtype, Comm comm) {
     MPI_Alltoall(sendbuf, sendcount, sendtype, recvbuf, recvcount, recvtype, comm);
@@ -389,6 +418,10 @@ class CMediMPIWrapper : public CBaseMPIWrapper {
     AMPI_Probe(source, tag, convertComm(comm), status);
   }
 
+  static inline void Iprobe(int source, int tag, Comm comm, int* flag, Status* status) {
+    AMPI_Iprobe(source, tag, convertComm(comm), flag, status);
+  }
+
   static inline void Send(const void* buf, int count, Datatype datatype, int dest, int tag, Comm comm) {
     AMPI_Send(buf, count, convertDatatype(datatype), dest, tag, convertComm(comm));
   }
@@ -410,6 +443,11 @@ class CMediMPIWrapper : public CBaseMPIWrapper {
     AMPI_Allreduce(sendbuf, recvbuf, count, convertDatatype(datatype), convertOp(op), convertComm(comm));
   }
 
+  static inline void Iallreduce(const void* sendbuf, void* recvbuf, int count, Datatype datatype, Op op, Comm comm,
+                                Request* request) {
+    AMPI_Iallreduce(sendbuf, recvbuf, count, convertDatatype(datatype), convertOp(op), convertComm(comm), request);
+  }
+
   static inline void Gather(const void* sendbuf, int sendcnt, Datatype sendtype, void* recvbuf, int recvcnt,
                             Datatype recvtype, int root, Comm comm) {
     AMPI_Gather(sendbuf, sendcnt, convertDatatype(sendtype), recvbuf, recvcnt, convertDatatype(recvtype), root,
@@ -434,6 +472,13 @@ class CMediMPIWrapper : public CBaseMPIWrapper {
                     convertDatatype(recvtype), convertComm(comm));
   }
 
+  static inline void Iallgatherv(const void* sendbuf, int sendcount, Datatype sendtype, void* recvbuf,
+                                 const int* recvcounts, const int* displs, Datatype recvtype, Comm comm,
+                                 Request* request) {
+    AMPI_Iallgatherv(sendbuf, sendcount, convertDatatype(sendtype), recvbuf, recvcounts, displs,
+                     convertDatatype(recvtype), convertComm(comm), request);
+  }
+
   static inline void Alltoall(const void* sendbuf, int sendcount, Datatype sendtype, void* recvbuf, int recvcount,
                               Datatype recvtype, Comm comm) {
     AMPI_Alltoall(sendbuf, sendcount, convertDatatype(sendtype), recvbuf, recvcount, convertDatatype(recvtype),
@@ -539,6 +584,16 @@ class CBaseMPIWrapper {
 
   static inline int Request_free(Request *request) { return 0; }
 
+  static inline void Send_init(const void* buf, int count, Datatype datatype, int dest, int tag, Comm comm,
+                               Request* request) {}
+
+  static inline void Recv_init(void* buf, int count, Datatype datatype, int source, int tag, Comm comm,
+                               Request* request) {}
+
+  static inline void Start(Request* request) {}
+
+  static inline void Startall(int nrequests, Request* request) {}
+
   static inline void Waitall(int nrequests, Request* request, Status* status) {}
 
   static inline void Waitany(int nrequests, Request* request, int* index, Status* status) {}
@@ -558,6 +613,11 @@ class CBaseMPIWrapper {
     CopyData(sendbuf, recvbuf, count, datatype);
   }
 
+  static inline void Iallreduce(const void* sendbuf, void* recvbuf, int count, Datatype datatype, Op op, Comm comm,
+                                Request* request) {
+    CopyData(sendbuf, recvbuf, count, datatype);
+  }
+
   static inline void Gather(const void* sendbuf, int sendcnt, Datatype sendtype, void* recvbuf, int recvcnt,
                             Datatype recvtype, int root, Comm comm) {
     CopyData(sendbuf, recvbuf, sendcnt, sendtype);
@@ -573,6 +633,12 @@ class CBaseMPIWrapper {
     CopyData(sendbuf, recvbuf, sendcnt, sendtype, displs[0]);
   }
 
+  static inline void Iallgatherv(const void* sendbuf, int sendcnt, Datatype sendtype, void* recvbuf,
+                                 const int* recvcnt, const int* displs, Datatype recvtype, Comm comm,
+                                 Request* request) {
+    CopyData(sendbuf, recvbuf, sendcnt, sendtype, displs[0]);
+  }
+
   static inline void Allgather(const void* sendbuf, int sendcnt, Datatype sendtype, void* recvbuf, int recvcnt,
                                Datatype recvtype, Comm comm) {
     CopyData(sendbuf, recvbuf, sendcnt, sendtype);
@@ -601,6 +667,8 @@ class CBaseMPIWrapper {
 
   static inline void Probe(int source, int tag, Comm comm, Status* status) {}
 
+  static inline void Iprobe(int source, int tag, Comm comm, int* flag, Status* status) { *flag = 0; }
+
   static inline passivedouble Wtime(void) { return omp_get_wtime(); }
 };
 typedef int SU2_Comm;
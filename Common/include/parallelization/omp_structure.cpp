@@ -42,6 +42,22 @@ void omp_initialize() {
 #endif
 }
 
+namespace {
+/*--- Full team size of the rank, captured the first time a zone team is selected
+ and restored by resetZoneTeamSize. ---*/
+int fullZoneTeamSize = 0;
+}
+
+void setZoneTeamSize(int numThreads) {
+  if (omp_in_parallel()) return;
+  if (fullZoneTeamSize == 0) fullZoneTeamSize = omp_get_max_threads();
+  omp_set_num_threads(std::max(1, std::min(numThreads, fullZoneTeamSize)));
+}
+
+void resetZoneTeamSize() {
+  if ((fullZoneTeamSize > 0) && !omp_in_parallel()) omp_set_num_threads(fullZoneTeamSize);
+}
+
 void omp_finalize() {
 #ifdef HAVE_OPDI
   opdi::tool->finalize();
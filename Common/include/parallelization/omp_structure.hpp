@@ -38,6 +38,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cstddef>
 
 #include "../code_config.hpp"
@@ -120,6 +121,24 @@ inline void omp_destroy_lock(omp_lock_t*){}
 void omp_initialize();
 void omp_finalize();
 
+/*--- Zone-local thread teams. In multizone (e.g. CHT) runs every parallel region
+ uses the full team of the rank regardless of the zone being solved, and in small
+ (solid) zones the fork-join barriers then dominate the step cost. The driver
+ registers a team size per zone from its local point count and selects it before
+ solving the zone, subsequent parallel regions and omp_get_max_threads() see the
+ reduced team until the full team is restored. ---*/
+
+/*!
+ * \brief Select the thread team size of the zone about to be solved.
+ * \param[in] numThreads - Team size, clipped to the full team of the rank.
+ */
+void setZoneTeamSize(int numThreads);
+
+/*!
+ * \brief Restore the full thread team of the rank (no-op if no zone team was selected).
+ */
+void resetZoneTeamSize();
+
 /*--- Detect SIMD support (version 4+, after Jul 2013). ---*/
 #ifdef _OPENMP
 #if _OPENMP >= 201307
@@ -221,6 +240,19 @@ inline size_t computeStaticChunkSize(size_t totalWork,
   return roundUpDiv(workPerThread, chunksPerThread);
 }
 
+/*!
+ * \brief Compute the thread team size for a zone from its local amount of work
+ *        (see setZoneTeamSize).
+ * \param[in] workAmount - E.g. number of grid points of the zone on this rank.
+ * \param[in] fullTeamSize - Full team size of the rank, never exceeded.
+ * \param[in] minWorkPerThread - Minimum work that justifies one more thread.
+ * \return Team size between 1 and fullTeamSize.
+ */
+inline int computeZoneTeamSize(size_t workAmount, size_t fullTeamSize, size_t minWorkPerThread = 4096) {
+  const size_t nThreads = std::min(fullTeamSize, roundUpDiv(workAmount, minWorkPerThread));
+  return int(std::max<size_t>(nThreads, 1));
+}
+
 /*!
  * \brief Copy data from one array-like object to another in parallel.
  * \param[in] size - Number of elements.
@@ -0,0 +1,180 @@
+/*!
+ * \file shared_memory.hpp
+ * \brief Helpers to place read-only data in MPI-3 shared memory windows,
+ *        so that ranks on the same node share one copy instead of each
+ *        holding their own.
+ * \version 7.3.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2022, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "mpi_structure.hpp"
+
+#include <algorithm>
+#include <cstddef>
+
+/*--- Shared memory windows hold raw, unconstructed storage, hence they are
+ only used for the passive data types of primal builds. AD builds fall back
+ to per-rank copies, active types carry rank-local tape data that must not
+ be shared. ---*/
+#if defined(HAVE_MPI) && !defined(CODI_REVERSE_TYPE) && !defined(CODI_FORWARD_TYPE)
+#define HAVE_MPI_SHARED_MEMORY
+#endif
+
+#ifdef HAVE_MPI_SHARED_MEMORY
+/*!
+ * \brief Get the communicator of the ranks that share the memory of this
+ *        node, created on first use by splitting the current communicator.
+ */
+inline MPI_Comm GetNodeSharedComm() {
+  static MPI_Comm nodeComm = MPI_COMM_NULL;
+  if (nodeComm == MPI_COMM_NULL)
+    MPI_Comm_split_type(SU2_MPI::GetComm(), MPI_COMM_TYPE_SHARED,
+                        SU2_MPI::GetRank(), MPI_INFO_NULL, &nodeComm);
+  return nodeComm;
+}
+#endif
+
+/*!
+ * \class CSharedMemoryArray
+ * \brief Array of trivially-copyable data that can be backed by an MPI-3
+ *        shared memory window, one copy per node instead of one per rank.
+ *        The first rank of the node owns the data (IsOwner), it fills the
+ *        array and all ranks of the node call Sync before reading.
+ * \note  Allocate and Sync are collective over the ranks of the node when
+ *        the array is shared, and all node ranks must request the same size.
+ *        Without MPI (or when "shared" is not requested) the class degrades
+ *        to a plain owning array.
+ */
+template <class T>
+class CSharedMemoryArray {
+ private:
+  T* ptr = nullptr;          /*!< \brief Start of the (possibly shared) storage. */
+  std::size_t nElem = 0;     /*!< \brief Number of elements of the array. */
+  bool sharedWindow = false; /*!< \brief Whether the storage lives in a shared window. */
+#ifdef HAVE_MPI_SHARED_MEMORY
+  MPI_Win win = MPI_WIN_NULL; /*!< \brief The window backing the shared storage. */
+#endif
+
+ public:
+  CSharedMemoryArray() = default;
+
+  /*--- The array owns raw memory, forbid copies (and thereby moves). ---*/
+  CSharedMemoryArray(const CSharedMemoryArray&) = delete;
+  CSharedMemoryArray& operator=(const CSharedMemoryArray&) = delete;
+
+  ~CSharedMemoryArray() { Free(); }
+
+  /*!
+   * \brief Allocate storage for the array, in a shared window if requested
+   *        and supported, otherwise as a private per-rank array.
+   * \param[in] n - Number of elements.
+   * \param[in] shared - Request node-shared storage.
+   */
+  void Allocate(std::size_t n, bool shared) {
+    Free();
+    nElem = n;
+#ifdef HAVE_MPI_SHARED_MEMORY
+    if (shared && (n > 0)) {
+      MPI_Comm comm = GetNodeSharedComm();
+      int nodeRank;
+      MPI_Comm_rank(comm, &nodeRank);
+
+      /*--- The first rank of the node allocates the entire array, the other
+       ranks allocate nothing and query the start of the node's storage. ---*/
+      const MPI_Aint bytes = (nodeRank == 0) ? MPI_Aint(n * sizeof(T)) : 0;
+      MPI_Win_allocate_shared(bytes, sizeof(T), MPI_INFO_NULL, comm, &ptr, &win);
+
+      if (nodeRank != 0) {
+        MPI_Aint size;
+        int dispUnit;
+        MPI_Win_shared_query(win, 0, &size, &dispUnit, &ptr);
+      }
+
+      /*--- Keep a passive access epoch open for the lifetime of the window,
+       Sync separates the fill from the reads. ---*/
+      MPI_Win_lock_all(MPI_MODE_NOCHECK, win);
+
+      sharedWindow = true;
+      return;
+    }
+#endif
+    ptr = new T[n];
+  }
+
+  /*!
+   * \brief Release the storage (collective over the node when shared).
+   */
+  void Free() {
+#ifdef HAVE_MPI_SHARED_MEMORY
+    if (sharedWindow) {
+      MPI_Win_unlock_all(win);
+      MPI_Win_free(&win);
+      sharedWindow = false;
+      ptr = nullptr;
+      nElem = 0;
+      return;
+    }
+#endif
+    delete[] ptr;
+    ptr = nullptr;
+    nElem = 0;
+  }
+
+  /*!
+   * \brief Whether this rank fills the array (the first rank of the node,
+   *        or every rank when the storage is private).
+   */
+  bool IsOwner() const {
+#ifdef HAVE_MPI_SHARED_MEMORY
+    if (sharedWindow) {
+      int nodeRank;
+      MPI_Comm_rank(GetNodeSharedComm(), &nodeRank);
+      return nodeRank == 0;
+    }
+#endif
+    return true;
+  }
+
+  /*!
+   * \brief Make the data written by the owner visible to all ranks of the
+   *        node (collective over the node when shared, no-op otherwise).
+   */
+  void Sync() const {
+#ifdef HAVE_MPI_SHARED_MEMORY
+    if (sharedWindow) {
+      MPI_Win_sync(win);
+      MPI_Barrier(GetNodeSharedComm());
+      MPI_Win_sync(win);
+    }
+#endif
+  }
+
+  T* data() { return ptr; }
+  const T* data() const { return ptr; }
+
+  std::size_t size() const { return nElem; }
+
+  T& operator[](std::size_t i) { return ptr[i]; }
+  const T& operator[](std::size_t i) const { return ptr[i]; }
+};
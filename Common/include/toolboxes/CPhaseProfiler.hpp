@@ -0,0 +1,132 @@
+/*!
+ * \file CPhaseProfiler.hpp
+ * \brief Lightweight instrumentation of the main phases of an iteration.
+ * \note All of the instrumentation compiles away unless the code is built
+ *       with -DPROFILE (meson option -Denable-profiling=true).
+ * \version 7.3.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2022, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "../parallelization/mpi_structure.hpp"
+#include "../parallelization/omp_structure.hpp"
+
+#include <vector>
+
+/*!
+ * \brief Instrumented phases of a solver iteration.
+ */
+enum class ProfilingPhase : unsigned short {
+  GRADIENTS,          /*!< \brief Green-Gauss / least-squares gradient computation. */
+  LIMITERS,           /*!< \brief Slope limiter computation. */
+  FLUX_ASSEMBLY,      /*!< \brief Convective, viscous, and source residual loops. */
+  JACOBIAN_ASSEMBLY,  /*!< \brief Preparation and completion of the implicit system. */
+  LINEAR_SOLVE,       /*!< \brief Solution of the linear system. */
+  HALO_COMM,          /*!< \brief Point-to-point exchange of halo data. */
+  OUTPUT,             /*!< \brief Writing of history and result files. */
+  COUNT               /*!< \brief Number of phases, do not use as a phase. */
+};
+
+/*!
+ * \class CPhaseProfiler
+ * \brief Accumulates time and call counts per phase and per thread, the
+ *        per-thread slots are padded to avoid false sharing on the hot path.
+ */
+class CPhaseProfiler {
+#ifdef PROFILE
+private:
+  struct alignas(64) PhaseData {
+    passivedouble time = 0.0;      /*!< \brief Accumulated time in seconds. */
+    unsigned long calls = 0;       /*!< \brief Number of times the phase was entered. */
+  };
+  std::vector<PhaseData> data;     /*!< \brief [thread * COUNT + phase] layout. */
+
+  CPhaseProfiler() : data(omp_get_max_threads() * size_t(ProfilingPhase::COUNT)) {}
+#endif
+public:
+  /*!
+   * \brief Access the global profiler instance.
+   */
+  static CPhaseProfiler& GetProfiler() {
+    static CPhaseProfiler profiler;
+    return profiler;
+  }
+
+#ifdef PROFILE
+  /*!
+   * \brief Accumulate the elapsed time of one phase for the calling thread.
+   */
+  inline void Add(ProfilingPhase phase, passivedouble elapsed) {
+    auto& slot = data[omp_get_thread_num() * size_t(ProfilingPhase::COUNT) + size_t(phase)];
+    slot.time += elapsed;
+    slot.calls += 1;
+  }
+#endif
+
+  /*!
+   * \brief Total accumulated time of one phase over all threads of this rank,
+   *        zero unless built with profiling support.
+   */
+  passivedouble GetPhaseTime(ProfilingPhase phase) const {
+#ifdef PROFILE
+    passivedouble time = 0.0;
+    for (size_t iThread = 0; iThread < data.size() / size_t(ProfilingPhase::COUNT); ++iThread)
+      time += data[iThread * size_t(ProfilingPhase::COUNT) + size_t(phase)].time;
+    return time;
+#else
+    (void)phase;
+    return 0.0;
+#endif
+  }
+
+  /*!
+   * \brief Reduce the per-thread and per-rank results and write them as CSV
+   *        (no-op unless built with profiling support).
+   */
+  void WriteProfile() const;
+};
+
+/*!
+ * \class CScopedPhaseTimer
+ * \brief Times the enclosing scope and accumulates the result in the profiler.
+ */
+class CScopedPhaseTimer {
+#ifdef PROFILE
+private:
+  ProfilingPhase phase;
+  passivedouble startTime;
+public:
+  CScopedPhaseTimer(ProfilingPhase val_phase) : phase(val_phase), startTime(SU2_MPI::Wtime()) {}
+  ~CScopedPhaseTimer() { CPhaseProfiler::GetProfiler().Add(phase, SU2_MPI::Wtime() - startTime); }
+#else
+public:
+  CScopedPhaseTimer(ProfilingPhase) {}
+#endif
+};
+
+/*--- Convenience macro, expands to nothing in non-profiling builds. ---*/
+#ifdef PROFILE
+#define SU2_PROFILE_PHASE(PHASE) const CScopedPhaseTimer scopedPhaseTimer(ProfilingPhase::PHASE)
+#else
+#define SU2_PROFILE_PHASE(PHASE)
+#endif
@@ -32,6 +32,9 @@
 
 #pragma once
 
+#include <algorithm>
+#include <limits>
+
 #include "../parallelization/omp_structure.hpp"
 #include "../parallelization/mpi_structure.hpp"
 #include "CSymmetricMatrix.hpp"
@@ -61,6 +64,8 @@ private:
   su2vector<Scalar> mat, rhs, sol;      /*!< \brief Matrix, rhs, and solution of the normal equations. */
   Index iSample = 0;                    /*!< \brief Current sample index. */
   Index nPtDomain = 0;                  /*!< \brief Local size of the history, considered in dot products. */
+  std::vector<char> stalePair;          /*!< \brief Marks sample pairs that span a restart of the FP operator
+                                                    (see "newTimeStep"), they are excluded from the LS problem. */
 
   void shiftHistoryLeft() {
     for (Index i = 1; i < X.size(); ++i) {
@@ -69,6 +74,29 @@ private:
       std::swap(X[i-1], X[i]);
       std::swap(R[i-1], R[i]);
     }
+    /*--- The pair formed by samples (i, i+1) shifts with them. ---*/
+    for (size_t i = 1; i < stalePair.size(); ++i) stalePair[i-1] = stalePair[i];
+    stalePair.back() = false;
+  }
+
+  void filterNormalEquations() {
+    /*--- Decouple from the LS problem the pairs that span a restart of the FP
+     * operator, and pairs whose residual difference is negligible (e.g. carried
+     * over from a converged time step), as they make the problem singular. ---*/
+    Scalar maxDiag = 0;
+    for (Index i = 0; i < iSample; ++i)
+      maxDiag = std::max(maxDiag, mat(i*(i+3)/2));
+    const Scalar tol = std::numeric_limits<Scalar>::epsilon() * maxDiag;
+
+    for (Index i = 0; i < iSample; ++i) {
+      if (!stalePair[i] && mat(i*(i+3)/2) > tol) continue;
+      /*--- Zero the row and column, with a unit diagonal and zero rhs the
+       * solution coefficient of this pair becomes zero. ---*/
+      for (Index j = 0; j < i; ++j) mat(i*(i+1)/2 + j) = 0;
+      for (Index j = i+1; j < iSample; ++j) mat(j*(j+1)/2 + i) = 0;
+      mat(i*(i+3)/2) = 1;
+      rhs(i) = 0;
+    }
   }
 
   void computeNormalEquations() {
@@ -171,6 +199,7 @@ public:
       R.emplace_back(npt,nvar);
     }
     X[0] = Scalar(0);
+    stalePair.assign(nsample-1, false);
     /*--- Lower triangular packed storage. ---*/
     mat.resize(nsample*(nsample-1)/2);
     rhs.resize(nsample-1);
@@ -181,7 +210,24 @@ public:
   Index size() const { return X.size(); }
 
   /*! \brief Discard all history, keeping the current solution. */
-  void reset() { std::swap(X[0], X[iSample]); iSample = 0; }
+  void reset() {
+    std::swap(X[0], X[iSample]);
+    iSample = 0;
+    std::fill(stalePair.begin(), stalePair.end(), char(false));
+  }
+
+  /*!
+   * \brief Keep the history when moving to a new time step (or in general to
+   * a new instance of the FP operator), to warm start the next fixed point
+   * instead of discarding the samples (see "reset").
+   * \note The pair of samples that spans the boundary relates inputs and
+   * residuals of two different operators, it is flagged here and excluded
+   * from the least squares problem, along with any pairs that have become
+   * degenerate (e.g. carried over from a converged time step).
+   */
+  void newTimeStep() {
+    if (iSample > 0) stalePair[iSample-1] = true;
+  }
 
   /*!
    * \brief Access the current fixed-point result.
@@ -216,6 +262,7 @@ public:
     if (iSample > 0) {
       /*--- Solve the normal equations. ---*/
       computeNormalEquations();
+      filterNormalEquations();
       CSymmetricMatrix pseudoInv(iSample);
       for (Index i = 0, k = 0; i < iSample; ++i)
         for (Index j = 0; j <= i; ++j)
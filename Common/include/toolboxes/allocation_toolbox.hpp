@@ -39,6 +39,19 @@
 #include <cstring>
 
 #include <cassert>
+#include <utility>
+#include <vector>
+
+#if defined(__linux__)
+#include <unistd.h>
+#include <sys/syscall.h>
+#include <sys/mman.h>
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <map>
+#include <mutex>
+#endif
 
 namespace MemoryAllocation
 {
@@ -53,6 +66,89 @@ inline constexpr size_t round_up(size_t multiple, size_t x)
   return ((x+multiple-1)/multiple)*multiple;
 }
 
+#if defined(__linux__) && defined(MAP_HUGETLB)
+/*--- Allocations of at least one huge page are requested in huge pages, to
+ *    reduce the TLB pressure of the large solver arrays. ---*/
+#define HAVE_HUGE_PAGES
+constexpr size_t HUGE_PAGE_SIZE = 2*1024*1024;
+
+namespace HugePages
+{
+/*!
+ * \brief Bookkeeping of the huge-page-backed allocations. Explicit hugetlb
+ *        mappings must be released with munmap (and their size), hence the
+ *        registry, which doubles as the source of the coverage report.
+ */
+struct CState
+{
+  std::mutex mutex;                        /*!< \brief Allocations may come from multiple threads. */
+  std::map<void*, std::pair<size_t, bool> > allocations; /*!< \brief Size and whether explicitly mapped. */
+  size_t bytesLarge = 0;    /*!< \brief Large allocations currently alive. */
+  size_t bytesMapped = 0;   /*!< \brief Thereof backed by explicit huge pages. */
+  size_t bytesAdvised = 0;  /*!< \brief Thereof advised to use transparent huge pages. */
+};
+
+inline CState& GetState()
+{
+  static CState state;
+  return state;
+}
+
+/*!
+ * \brief Try to allocate in huge pages, first from the explicit hugetlb pool,
+ *        then via a huge-page-aligned allocation advised to be backed by
+ *        transparent huge pages. Returns nullptr if neither is possible.
+ */
+inline void* Allocate(size_t size)
+{
+  auto& state = GetState();
+  size = round_up(HUGE_PAGE_SIZE, size);
+
+  void* ptr = mmap(nullptr, size, PROT_READ|PROT_WRITE,
+                   MAP_PRIVATE|MAP_ANONYMOUS|MAP_HUGETLB, -1, 0);
+  const bool mapped = (ptr != MAP_FAILED);
+
+  if (!mapped)
+  {
+    /*--- No (or exhausted) hugetlb pool. Huge-page alignment plus the advice
+     *    lets the kernel back the range with transparent huge pages. ---*/
+    ptr = ::aligned_alloc(HUGE_PAGE_SIZE, size);
+    if (ptr == nullptr) return nullptr;
+    madvise(ptr, size, MADV_HUGEPAGE);
+  }
+
+  std::lock_guard<std::mutex> lock(state.mutex);
+  state.allocations[ptr] = std::make_pair(size, mapped);
+  state.bytesLarge += size;
+  (mapped? state.bytesMapped : state.bytesAdvised) += size;
+  return ptr;
+}
+
+/*!
+ * \brief Release an allocation if it is huge-page-backed.
+ * \return True if the pointer was handled, false if it is a regular allocation.
+ */
+inline bool Free(void* ptr)
+{
+  auto& state = GetState();
+  std::lock_guard<std::mutex> lock(state.mutex);
+
+  auto it = state.allocations.find(ptr);
+  if (it == state.allocations.end()) return false;
+
+  const size_t size = it->second.first;
+  const bool mapped = it->second.second;
+  state.bytesLarge -= size;
+  (mapped? state.bytesMapped : state.bytesAdvised) -= size;
+  state.allocations.erase(it);
+
+  if (mapped) munmap(ptr, size);
+  else free(ptr);
+  return true;
+}
+} // namespace HugePages
+#endif
+
 /*!
  * \brief Aligned memory allocation compatible across platforms.
  * \param[in] alignment, in bytes, of the memory being allocated.
@@ -71,6 +167,20 @@ inline T* aligned_alloc(size_t alignment, size_t size) noexcept
 
   void* ptr = nullptr;
 
+#ifdef HAVE_HUGE_PAGES
+  if (size >= HUGE_PAGE_SIZE && alignment <= HUGE_PAGE_SIZE)
+  {
+    ptr = HugePages::Allocate(size);
+    if (ptr != nullptr)
+    {
+      /*--- Fresh mappings are already zero, but the hugetlb pool does not
+       *    grow on demand, only the fallback path may need the memset. ---*/
+      if (ZeroInit) memset(ptr, 0, size);
+      return static_cast<T*>(ptr);
+    }
+  }
+#endif
+
 #if defined(__APPLE__)
   if(::posix_memalign(&ptr, alignment, size) != 0)
   {
@@ -85,6 +195,50 @@ inline T* aligned_alloc(size_t alignment, size_t size) noexcept
   return static_cast<T*>(ptr);
 }
 
+/*!
+ * \brief Print a summary of the NUMA nodes on which the memory pages of an
+ *        allocation currently reside, to diagnose first-touch placement on
+ *        multi-socket machines. Only implemented on Linux, no-op elsewhere.
+ * \param[in] ptr, start of the allocation.
+ * \param[in] size, of the allocation in bytes.
+ * \param[in] tag, name identifying the allocation in the report.
+ */
+inline void ReportNumaPlacement(const void* ptr, size_t size, const char* tag)
+{
+#if defined(__linux__) && defined(SYS_move_pages)
+  if (ptr == nullptr || size == 0) return;
+
+  const size_t pageSize = sysconf(_SC_PAGESIZE);
+  const size_t nPages = (size + pageSize - 1) / pageSize;
+
+  /*--- Sample at most 4096 pages, evenly strided, to keep the query cheap
+   *    for very large allocations. ---*/
+  const size_t stride = (nPages + 4095) / 4096;
+  const size_t nSample = (nPages + stride - 1) / stride;
+
+  std::vector<void*> pages(nSample);
+  std::vector<int> status(nSample);
+
+  char* base = static_cast<char*>(const_cast<void*>(ptr));
+  for (size_t i = 0; i < nSample; ++i) pages[i] = base + i*stride*pageSize;
+
+  /*--- Calling move_pages without target nodes only queries on which
+   *    node each page currently resides. ---*/
+  if (syscall(SYS_move_pages, 0, nSample, pages.data(), nullptr, status.data(), 0) != 0)
+    return;
+
+  std::map<int, size_t> pagesPerNode;
+  for (const int s : status)
+    if (s >= 0) ++pagesPerNode[s];
+
+  std::cout << "NUMA placement of " << tag << " (" << size/(1024*1024) << " MB, "
+            << nSample << "/" << nPages << " pages sampled):";
+  for (const auto& node : pagesPerNode)
+    std::cout << "  node " << node.first << ": " << node.second;
+  std::cout << std::endl;
+#endif
+}
+
 /*!
  * \brief Free memory allocated with su2::aligned_alloc.
  * \param[in] ptr, pointer to memory we want to release.
@@ -92,6 +246,9 @@ inline T* aligned_alloc(size_t alignment, size_t size) noexcept
 template<class T>
 inline void aligned_free(T* ptr) noexcept
 {
+#ifdef HAVE_HUGE_PAGES
+  if (HugePages::Free(ptr)) return;
+#endif
 #if defined(_WIN32)
   _aligned_free(ptr);
 #else
@@ -99,5 +256,156 @@ inline void aligned_free(T* ptr) noexcept
 #endif
 }
 
+/*!
+ * \brief Print a summary of the huge page coverage of the large allocations,
+ *        both what was requested (explicit hugetlb mappings and transparent-
+ *        huge-page advice) and what the kernel actually provided, taken from
+ *        the AnonHugePages accounting of the process. Linux only.
+ */
+inline void ReportHugepageCoverage()
+{
+#ifdef HAVE_HUGE_PAGES
+  size_t bytesLarge, bytesMapped, bytesAdvised;
+  {
+    auto& state = HugePages::GetState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    bytesLarge = state.bytesLarge;
+    bytesMapped = state.bytesMapped;
+    bytesAdvised = state.bytesAdvised;
+  }
+  if (bytesLarge == 0) return;
+
+  /*--- Transparent huge pages are only a request, read back how many
+   *    anonymous huge pages the kernel actually installed. ---*/
+  size_t anonHugeMB = 0;
+  std::ifstream smaps("/proc/self/smaps_rollup");
+  std::string token;
+  while (smaps >> token)
+  {
+    if (token == "AnonHugePages:")
+    {
+      size_t kB = 0;
+      smaps >> kB;
+      anonHugeMB = kB/1024;
+      break;
+    }
+  }
+
+  constexpr size_t MB = 1024*1024;
+  std::cout << "Huge page coverage: " << bytesLarge/MB << " MB in large allocations, "
+            << bytesMapped/MB << " MB explicitly mapped, "
+            << bytesAdvised/MB << " MB THP-advised ("
+            << anonHugeMB << " MB transparent huge pages installed)." << std::endl;
+#endif
+}
+
+/*!
+ * \class CMemoryArena
+ * \brief Simple arena (bump) allocator over cache-aligned blocks. Individual
+ *        allocations cannot be freed, the memory is released all at once when
+ *        the arena is destroyed, or recycled via Reset (which keeps the blocks).
+ * \note  Two intended uses: packing the many small scratch arrays of an object
+ *        into contiguous storage (one arena per object, never reset), and
+ *        temporaries allocated inside iteration loops (the thread_local arena
+ *        of ThreadArena, reset once per iteration, making "allocation" a
+ *        pointer increment). Do not mix the two uses in one arena.
+ */
+class CMemoryArena
+{
+public:
+  static constexpr size_t MIN_BLOCK_SIZE = 4096;
+  static constexpr size_t ALIGNMENT = 64;
+
+private:
+  std::vector<std::pair<char*, size_t> > blocks; /*!< \brief Allocated blocks and their sizes. */
+  size_t activeBlock = 0;                        /*!< \brief Block currently being carved. */
+  size_t offset = 0;                             /*!< \brief Used bytes of the active block. */
+
+public:
+  CMemoryArena() = default;
+
+  /*--- The arena owns raw memory, forbid copies (and thereby moves). ---*/
+  CMemoryArena(const CMemoryArena&) = delete;
+  CMemoryArena& operator=(const CMemoryArena&) = delete;
+
+  ~CMemoryArena()
+  {
+    for (auto& block : blocks) aligned_free(block.first);
+  }
+
+  /*!
+   * \brief Carve an array out of the arena, growing it if needed.
+   * \param[in] count - Number of elements of type T.
+   * \tparam ZeroInit, initialize memory to 0.
+   * \return Pointer valid until the arena is reset or destroyed.
+   */
+  template<class T, bool ZeroInit = false>
+  T* Allocate(size_t count)
+  {
+    /*--- Rounding each allocation up keeps every returned pointer aligned. ---*/
+    const size_t bytes = round_up(ALIGNMENT, count*sizeof(T));
+
+    while (true)
+    {
+      if (activeBlock < blocks.size() && offset+bytes <= blocks[activeBlock].second)
+      {
+        T* ptr = reinterpret_cast<T*>(blocks[activeBlock].first + offset);
+        offset += bytes;
+        if (ZeroInit) memset(ptr, 0, bytes);
+        return ptr;
+      }
+
+      /*--- Move to the next recycled block, or allocate a fresh one. ---*/
+      if (activeBlock+1 < blocks.size())
+      {
+        ++activeBlock;
+      }
+      else
+      {
+        const size_t size = (bytes > MIN_BLOCK_SIZE)? bytes : size_t(MIN_BLOCK_SIZE);
+        blocks.emplace_back(aligned_alloc<char>(ALIGNMENT, size), size);
+        activeBlock = blocks.size()-1;
+      }
+      offset = 0;
+    }
+  }
+
+  /*!
+   * \brief Carve a row-major matrix (array of row pointers) out of the arena.
+   * \param[in] rows - Number of rows.
+   * \param[in] cols - Number of columns.
+   * \tparam ZeroInit, initialize memory to 0.
+   * \return Pointer-to-pointers usable like the result of the new[] idiom.
+   */
+  template<class T, bool ZeroInit = false>
+  T** Allocate2D(size_t rows, size_t cols)
+  {
+    T** ptr = Allocate<T*>(rows);
+    for (size_t i = 0; i < rows; ++i)
+      ptr[i] = Allocate<T,ZeroInit>(cols);
+    return ptr;
+  }
+
+  /*!
+   * \brief Invalidate all allocations, keeping the blocks for reuse.
+   */
+  void Reset() noexcept
+  {
+    activeBlock = 0;
+    offset = 0;
+  }
+};
+
+/*!
+ * \brief Scratch arena of the calling thread, for temporaries inside iteration
+ *        loops. The user of a loop is responsible for resetting it once per
+ *        iteration (and for not holding pointers across the reset).
+ */
+inline CMemoryArena& ThreadArena()
+{
+  static thread_local CMemoryArena arena;
+  return arena;
+}
+
 } // namespace
 
@@ -109,7 +109,7 @@ public:
    */
   CCompressedSparsePattern(su2vector<Index_t>&& outerPtr,
                            su2vector<Index_t>&& innerIdx) :
-    m_outerPtr(outerPtr), m_innerIdx(innerIdx)
+    m_outerPtr(std::move(outerPtr)), m_innerIdx(std::move(innerIdx))
   {
     /*--- perform a basic sanity check ---*/
     assert(m_innerIdx.size() == m_outerPtr(m_outerPtr.size()-1));
@@ -184,6 +184,11 @@ CConfig::CConfig(CConfig* config, char case_filename[MAX_STRING_SIZE], SU2_COMPO
 
   Multizone_Problem = config->GetMultizone_Problem();
 
+  /*--- This zone config is fully built, the option decoders are not needed
+   anymore (the base config keeps its own for the remaining zones). ---*/
+
+  ReleaseOptionStorage();
+
 }
 
 CConfig::CConfig(char case_filename[MAX_STRING_SIZE], SU2_COMPONENT val_software) {
@@ -1080,6 +1085,12 @@ void CConfig::SetConfig_Options() {
   addBoolOption("MULTIZONE", Multizone_Problem, NO);
   /*!\brief PHYSICAL_PROBLEM \n DESCRIPTION: Physical governing equations \n Options: see \link Solver_Map \endlink \n DEFAULT: NONE \ingroup Config*/
   addEnumOption("MULTIZONE_SOLVER", Kind_MZSolver, Multizone_Map, ENUM_MULTIZONE::MZ_BLOCK_GAUSS_SEIDEL);
+  /*!\brief MULTIZONE_SKIP_CONVERGED \n DESCRIPTION: Skip the solve of zones whose inner iteration converged, until
+   their incoming transferred data changes by more than MULTIZONE_SKIP_TOL (relative) \ingroup Config*/
+  addBoolOption("MULTIZONE_SKIP_CONVERGED", Multizone_SkipConverged, NO);
+  /*!\brief MULTIZONE_SKIP_TOL \n DESCRIPTION: Relative change of the transferred data above which a
+   converged zone is solved again (see MULTIZONE_SKIP_CONVERGED) \ingroup Config*/
+  addDoubleOption("MULTIZONE_SKIP_TOL", Multizone_SkipTol, 1e-6);
 #ifdef CODI_REVERSE_TYPE
   const bool discAdjDefault = true;
 #else
@@ -1135,12 +1146,34 @@ void CConfig::SetConfig_Options() {
   addBoolOption("RESTART_SOL", Restart, false);
   /*!\brief BINARY_RESTART \n DESCRIPTION: Read binary SU2 native restart files. \n Options: YES, NO \ingroup Config */
   addBoolOption("READ_BINARY_RESTART", Read_Binary_Restart, true);
+  /*!\brief READ_SURFACE_RESTART \n DESCRIPTION: Restart from a sparse surface restart file (see RESTART_SURFACE output), interior points are initialized from free-stream values. \n Options: NO, YES \ingroup Config */
+  addBoolOption("READ_SURFACE_RESTART", Read_Surface_Restart, false);
+  /*!\brief READ_HIGHORDER_RESTART \n DESCRIPTION: Restart the FEM DG solver from an element-collocated high-order restart file (see RESTART_HIGHORDER output). \n Options: NO, YES \ingroup Config */
+  addBoolOption("READ_HIGHORDER_RESTART", Read_HighOrder_Restart, false);
   /*!\brief WRT_RESTART_OVERWRITE \n DESCRIPTION: overwrite restart files or append iteration number. \n Options: YES, NO \ingroup Config */
   addBoolOption("WRT_RESTART_OVERWRITE", Wrt_Restart_Overwrite, true);
   /*!\brief WRT_SURFACE_OVERWRITE \n DESCRIPTION: overwrite visualisation files or append iteration number. \n Options: YES, NO \ingroup Config */
   addBoolOption("WRT_SURFACE_OVERWRITE", Wrt_Surface_Overwrite, true);
   /*!\brief WRT_VOLUME_OVERWRITE \n DESCRIPTION: overwrite visualisation files or append iteration number. \n Options: YES, NO \ingroup Config */
   addBoolOption("WRT_VOLUME_OVERWRITE", Wrt_Volume_Overwrite, true);
+  /*!\brief WRT_PARAVIEW_COMPRESSED \n DESCRIPTION: zlib-compress the appended data of paraview (.vtu) files, requires compilation with zlib. \n Options: YES, NO \ingroup Config */
+  addBoolOption("WRT_PARAVIEW_COMPRESSED", Wrt_Paraview_Compressed, false);
+  /*!\brief WRT_PACKED_MULTIBLOCK \n DESCRIPTION: pack all boundary markers of a zone into a single dataset of the paraview multiblock (.vtm) output, instead of one dataset (file) per marker. \n Options: YES, NO \ingroup Config */
+  addBoolOption("WRT_PACKED_MULTIBLOCK", Wrt_Packed_Multiblock, false);
+  /*!\brief WRT_CSV_COMPRESSED \n DESCRIPTION: gzip-compress the surface CSV output files (.csv.gz), requires compilation with zlib. \n Options: YES, NO \ingroup Config */
+  addBoolOption("WRT_CSV_COMPRESSED", Wrt_CSV_Compressed, false);
+  /*!\brief WRT_SNAPSHOT_SINGLE_PRECISION \n DESCRIPTION: write the data of binary (.dat) volume snapshots in single precision, except for keyframes. \n Options: YES, NO \ingroup Config */
+  addBoolOption("WRT_SNAPSHOT_SINGLE_PRECISION", Wrt_Snapshot_SinglePrec, false);
+  /*!\brief WRT_SNAPSHOT_DELTA \n DESCRIPTION: store binary (.dat) volume snapshots as differences w.r.t. the previously written step, except for keyframes. \n Options: YES, NO \ingroup Config */
+  addBoolOption("WRT_SNAPSHOT_DELTA", Wrt_Snapshot_Delta, false);
+  /*!\brief SNAPSHOT_KEYFRAME_FREQ \n DESCRIPTION: every how many writes a full-precision keyframe is written when one of the WRT_SNAPSHOT options is active. \n DEFAULT: 10 \ingroup Config */
+  addUnsignedLongOption("SNAPSHOT_KEYFRAME_FREQ", Snapshot_Keyframe_Freq, 10);
+  /*!\brief WRT_AGGREGATE_OUTPUT \n DESCRIPTION: funnel the parallel binary output through one writer rank per node instead of collective MPI-IO from all ranks, the file layout is not affected. \n Options: YES, NO \ingroup Config */
+  addBoolOption("WRT_AGGREGATE_OUTPUT", Wrt_Aggregate_Output, false);
+  /*!\brief WRT_TECPLOT_SHARED_GRID \n DESCRIPTION: write the grid zones of the Tecplot binary (.szplt) output once to a shared grid file and solution-only files per snapshot, instead of repeating the grid in every file. \n Options: YES, NO \ingroup Config */
+  addBoolOption("WRT_TECPLOT_SHARED_GRID", Wrt_Tecplot_Shared_Grid, false);
+  /*!\brief WRT_TRANSIENT_OUTPUT_BUFFERS \n DESCRIPTION: release the volume output buffers between file writes instead of keeping them resident for the whole run, they are reallocated and refilled at the next output. \n Options: YES, NO \ingroup Config */
+  addBoolOption("WRT_TRANSIENT_OUTPUT_BUFFERS", Wrt_Transient_Output_Buffers, false);
   /*!\brief SYSTEM_MEASUREMENTS \n DESCRIPTION: System of measurements \n OPTIONS: see \link Measurements_Map \endlink \n DEFAULT: SI \ingroup Config*/
   addEnumOption("SYSTEM_MEASUREMENTS", SystemMeasurements, Measurements_Map, SI);
 
@@ -1655,8 +1688,14 @@ void CConfig::SetConfig_Options() {
 
   /* DESCRIPTION: Number of samples for quasi-Newton methods. */
   addUnsignedShortOption("QUASI_NEWTON_NUM_SAMPLES", nQuasiNewtonSamples, 0);
+  /* DESCRIPTION: Carry the quasi-Newton history over to the next time step (or outer iteration)
+     instead of restarting it, stale sample pairs are filtered automatically. */
+  addBoolOption("QUASI_NEWTON_REUSE_HISTORY", QuasiNewtonReuseHistory, false);
   /* DESCRIPTION: Whether to use vectorized numerical schemes, less robust against transients. */
   addBoolOption("USE_VECTORIZATION", UseVectorization, false);
+  /* DESCRIPTION: Use fixed-order parallel reductions so that residuals and dot products do not
+     depend on the number of threads, at some memory and performance cost (for validation runs). */
+  addBoolOption("DETERMINISTIC_REDUCTIONS", DeterministicReductions, false);
 
   /*!\par CONFIG_CATEGORY: Time-marching \ingroup Config*/
   /*--- Options related to time-marching ---*/
@@ -1676,6 +1715,17 @@ void CConfig::SetConfig_Options() {
   default_cfl_adapt[0] = 1.0; default_cfl_adapt[1] = 1.0; default_cfl_adapt[2] = 10.0; default_cfl_adapt[3] = 100.0;
   default_cfl_adapt[4] = 0.001;
   addDoubleListOption("CFL_ADAPT_PARAM", nCFL_AdaptParam, CFL_AdaptParam);
+  /* DESCRIPTION: Retry a diverged nonlinear iteration from an in-memory solution snapshot at reduced CFL
+   * instead of terminating the run, requires CFL_ADAPT= YES. */
+  addBoolOption("CFL_ADAPT_ROLLBACK", CFL_AdaptRollback, false);
+  /* DESCRIPTION: Drive the adaptive CFL with a SER-based pseudo-transient continuation controller
+   * (switched evolution relaxation) instead of the reactive controller, requires CFL_ADAPT= YES. */
+  addBoolOption("PTC_SER", PTC_SER, false);
+  /* DESCRIPTION: Exponent of the SER growth law, CFL grows with the residual ratio to this power. */
+  addDoubleOption("PTC_SER_EXPONENT", PTC_SER_Exponent, 1.0);
+  /* DESCRIPTION: Orders of magnitude of nonlinear residual reduction after which the SER controller
+   * switches to Newton iterations (CFL at the adaptive-CFL maximum with tightened linear tolerance). */
+  addDoubleOption("PTC_NEWTON_RESIDUAL_DROP", PTC_Newton_Residual_Drop, 4.0);
   /* DESCRIPTION: Reduction factor of the CFL coefficient in the adjoint problem */
   addDoubleOption("CFL_REDUCTION_ADJFLOW", CFLRedCoeff_AdjFlow, 0.8);
   /* DESCRIPTION: Reduction factor of the CFL coefficient in the level set problem */
@@ -1703,6 +1753,8 @@ void CConfig::SetConfig_Options() {
   addBoolOption("HB_PRECONDITION", HB_Precondition, false);
   /* DESCRIPTION: Starting direct solver iteration for the unsteady adjoint */
   addLongOption("UNST_ADJOINT_ITER", Unst_AdjointIter, 0);
+  /* DESCRIPTION: Interval between direct solution files kept on disk for the unsteady adjoint (1 = every step stored, K > 1 recomputes intermediate steps from the preceding checkpoint) */
+  addUnsignedLongOption("ADJOINT_CHECKPOINT_INTERVAL", Adjoint_Checkpoint_Interval, 1);
   /* DESCRIPTION: Number of iterations to average the objective */
   addLongOption("ITER_AVERAGE_OBJ", Iter_Avg_Objective , 0);
   /* DESCRIPTION: Time discretization */
@@ -1741,12 +1793,60 @@ void CConfig::SetConfig_Options() {
   addDoubleOption("LINEAR_SOLVER_ERROR", Linear_Solver_Error, 1E-6);
   /* DESCRIPTION: Maximum number of iterations of the linear solver for the implicit formulation */
   addUnsignedLongOption("LINEAR_SOLVER_ITER", Linear_Solver_Iter, 10);
+  /*!\brief TURB_LINEAR_SOLVER
+   *  \n DESCRIPTION: Linear solver for the scalar (turbulence/species) implicit systems, e.g. SMOOTHER with a
+   LINELET preconditioner gives a line-implicit relaxation along the wall-normal mesh lines. If not specified,
+   the LINEAR_SOLVER settings are used \n OPTIONS: see \link Linear_Solver_Map \endlink \n DEFAULT: FGMRES \ingroup Config*/
+  addEnumOption("TURB_LINEAR_SOLVER", Kind_Turb_Linear_Solver, Linear_Solver_Map, FGMRES);
+  /*!\brief TURB_LINEAR_SOLVER_PREC
+   *  \n DESCRIPTION: Preconditioner (or smoother type, with TURB_LINEAR_SOLVER= SMOOTHER) for the scalar
+   systems \n OPTIONS: see \link Linear_Solver_Prec_Map \endlink \n DEFAULT: ILU \ingroup Config*/
+  addEnumOption("TURB_LINEAR_SOLVER_PREC", Kind_Turb_Linear_Solver_Prec, Linear_Solver_Prec_Map, ILU);
+  /* DESCRIPTION: Maximum number of iterations (or smoothing sweeps) of the linear solver for the scalar systems */
+  addUnsignedLongOption("TURB_LINEAR_SOLVER_ITER", Turb_Linear_Solver_Iter, 10);
+  /* DESCRIPTION: Number of iterative refinement corrections after each linear solve, the correction
+   systems are solved in the (lower) solver precision and accumulated in double (mixed precision builds) */
+  addUnsignedShortOption("LINEAR_SOLVER_REFINE_ITER", Linear_Solver_Refine_Iter, 0);
   /* DESCRIPTION: Fill in level for the ILU preconditioner */
   addUnsignedShortOption("LINEAR_SOLVER_ILU_FILL_IN", Linear_Solver_ILU_n, 0);
+  /* DESCRIPTION: Factor and apply the ILU preconditioner with a level-scheduled traversal of the
+   * dependency graph, exact within each rank, instead of the thread-partitioned approximation */
+  addBoolOption("LINEAR_SOLVER_ILU_LEVEL_SCHEDULING", Linear_Solver_ILU_LevelSched, false);
+  /* DESCRIPTION: Relative per-row change of the Jacobian below which the stored ILU factorization
+   * of the row is reused instead of recomputed (0 = always refactor), useful with Jacobian lagging */
+  addDoubleOption("LINEAR_SOLVER_ILU_REFRESH_TOL", Linear_Solver_ILU_RefreshTol, 0.0);
   /* DESCRIPTION: Maximum number of iterations of the linear solver for the implicit formulation */
   addUnsignedLongOption("LINEAR_SOLVER_RESTART_FREQUENCY", Linear_Solver_Restart_Frequency, 10);
+  /* DESCRIPTION: Number of FGMRES directions recycled between consecutive solves as deflation vectors (0 = off) */
+  addUnsignedShortOption("LINEAR_SOLVER_RECYCLE_DIRECTIONS", Linear_Solver_Recycle, 0);
   /* DESCRIPTION: Relaxation factor for iterative linear smoothers (SMOOTHER_ILU/JACOBI/LU-SGS/LINELET) */
   addDoubleOption("LINEAR_SOLVER_SMOOTHER_RELAXATION", Linear_Solver_Smoother_Relaxation, 1.0);
+  /* DESCRIPTION: Number of nonlinear iterations the flow solver reuses its Jacobian and preconditioner
+   factorization before rebuilding them (1 = rebuild every iteration) */
+  addUnsignedShortOption("JACOBIAN_LAG_FLOW", Jacobian_Lag_Flow, 1);
+  /* DESCRIPTION: Number of nonlinear iterations the scalar transport solvers (turbulence, species)
+   reuse their Jacobian and preconditioner factorization before rebuilding them (1 = rebuild every iteration) */
+  addUnsignedShortOption("JACOBIAN_LAG_TURB", Jacobian_Lag_Turb, 1);
+  /* DESCRIPTION: Early Jacobian rebuild trigger: rebuild when the linear solver needs more than this
+   factor times the iterations it needed right after the previous rebuild */
+  addDoubleOption("JACOBIAN_LAG_GROWTH", Jacobian_Lag_Growth, 1.5);
+  /* DESCRIPTION: Number of flow-turbulence block-Gauss-Seidel sweeps per nonlinear iteration, each extra
+   sweep re-solves the flow and turbulence implicit systems with the freshest data of the other,
+   strengthening the segregated coupling at high CFL (1 = standard segregated iteration) */
+  addUnsignedShortOption("COUPLED_FLOW_TURB_SWEEPS", Coupled_FlowTurb_Sweeps, 1);
+  /* DESCRIPTION: Inner iteration at which the extra flow-turbulence sweeps activate, reserving the
+   stronger (and more expensive) coupling for the final convergence phase */
+  addUnsignedLongOption("COUPLED_FLOW_TURB_START_ITER", Coupled_FlowTurb_StartIter, 0);
+  /* DESCRIPTION: Early Jacobian rebuild trigger: rebuild when the solution of some point changed by
+   more than this relative amount since the previous rebuild (0 = disabled) */
+  addDoubleOption("JACOBIAN_LAG_SOL_CHANGE", Jacobian_Lag_Sol_Change, 0.0);
+  /* DESCRIPTION: Number of inner iterations the flow solver reuses its reconstruction gradients
+   and limiters before recomputing them (1 = recompute every iteration) */
+  addUnsignedShortOption("GRADIENT_LAG", Gradient_Lag, 1);
+  /* DESCRIPTION: Early gradient recompute trigger: recompute when the RMS residual grows beyond
+   this factor times its value at the previous gradient computation, which signals that the
+   solution started to change significantly again (e.g. at the start of a new time step) */
+  addDoubleOption("GRADIENT_LAG_GROWTH", Gradient_Lag_Growth, 1.5);
   /* DESCRIPTION: Custom number of threads used for additive domain decomposition for ILU and LU_SGS (0 is "auto"). */
   addUnsignedLongOption("LINEAR_SOLVER_PREC_THREADS", Linear_Solver_Prec_Threads, 0);
   /* DESCRIPTION: Relaxation factor for updates of adjoint variables. */
@@ -1810,6 +1910,10 @@ void CConfig::SetConfig_Options() {
   addUnsignedShortOption("MGLEVEL", nMGLevels, 0);
   /*!\brief MGCYCLE\n DESCRIPTION: Multi-grid cycle. OPTIONS: See \link MG_Cycle_Map \endlink. Defualt V_CYCLE \ingroup Config*/
   addEnumOption("MGCYCLE", MGCycle, MG_Cycle_Map, V_CYCLE);
+  /*!\brief GRID_SEQUENCING_ITER\n DESCRIPTION: Number of startup iterations on each coarse multigrid level, the solution is prolongated to initialize the fine grid. DEFAULT: 0 \ingroup Config*/
+  addUnsignedLongOption("GRID_SEQUENCING_ITER", GridSeq_Iter, 0);
+  /*!\brief MG_MIN_POINTS_PER_RANK\n DESCRIPTION: Minimum number of interior CVs any rank may be left with on a coarse level. Coarser levels are disabled once the agglomeration degenerates below this size on some rank, which happens at high rank counts because the agglomeration is rank-local. DEFAULT: 10 \ingroup Config*/
+  addUnsignedLongOption("MG_MIN_POINTS_PER_RANK", MG_MinPointsPerRank, 10);
   /*!\brief MG_PRE_SMOOTH\n DESCRIPTION: Multi-grid pre-smoothing level \ingroup Config*/
   addUShortListOption("MG_PRE_SMOOTH", nMG_PreSmooth, MG_PreSmooth);
   /*!\brief MG_POST_SMOOTH\n DESCRIPTION: Multi-grid post-smoothing level \ingroup Config*/
@@ -1833,6 +1937,17 @@ void CConfig::SetConfig_Options() {
   /*!\brief VENKAT_LIMITER_COEFF
    *  \n DESCRIPTION: Coefficient for the limiter. DEFAULT value 0.5. Larger values decrease the extent of limiting, values approaching zero cause lower-order approximation to the solution. \ingroup Config */
   addDoubleOption("VENKAT_LIMITER_COEFF", Venkat_LimiterCoeff, 0.05);
+  /*!\brief FUSED_GRADIENT_LIMITER
+   *  \n DESCRIPTION: Compute Green-Gauss reconstruction gradients and limiters in one fused sweep over the grid. \ingroup Config*/
+  addBoolOption("FUSED_GRADIENT_LIMITER", Fused_Gradient_Limiter, false);
+  /*!\brief FUSED_SOLVER_GRADIENTS
+   *  \n DESCRIPTION: Batch the Green-Gauss gradients of the flow, turbulence and species solvers into one fused sweep over the grid with a single round of halo exchanges. \ingroup Config*/
+  addBoolOption("FUSED_SOLVER_GRADIENTS", Fused_Solver_Gradients, false);
+  /*!\brief RECON_GRADIENT_LOCAL_HALO
+   *  \n DESCRIPTION: Compute the least-squares reconstruction gradients at halo points locally
+   *  from the one-sided stencil of the rank instead of exchanging them, removes one halo
+   *  exchange per iteration. Not used with periodic boundaries. \ingroup Config*/
+  addBoolOption("RECON_GRADIENT_LOCAL_HALO", Recon_Gradient_Local_Halo, false);
   /*!\brief ADJ_SHARP_LIMITER_COEFF
    *  \n DESCRIPTION: Coefficient for detecting the limit of the sharp edges. DEFAULT value 3.0.  Use with sharp edges limiter. \ingroup Config*/
   addDoubleOption("ADJ_SHARP_LIMITER_COEFF", AdjSharp_LimiterCoeff, 3.0);
@@ -1970,6 +2085,9 @@ void CConfig::SetConfig_Options() {
   addBoolOption("FROZEN_LIMITER_DISC", Frozen_Limiter_Disc, false);
   /* DESCRIPTION: Use an inconsistent (primal/dual) discrete adjoint formulation */
   addBoolOption("INCONSISTENT_DISC", Inconsistent_Disc, false);
+  /* DESCRIPTION: Keep the objective function out of the main discrete adjoint tape and cache its
+   gradient, recorded and evaluated once per recording (steady single-zone adjoints only) */
+  addBoolOption("COMPACT_ADJOINT_TAPE", Compact_Adj_Tape, false);
    /* DESCRIPTION:  */
   addDoubleOption("FIX_AZIMUTHAL_LINE", FixAzimuthalLine, 90.0);
   /*!\brief SENS_REMOVE_SHARP
@@ -1992,6 +2110,8 @@ void CConfig::SetConfig_Options() {
   addBoolOption("SEPARATE_DIMENSIONS", SmoothSepDim, false);
   /* DESCRIPTION: Switch to activate working on the design surfaces only */
   addBoolOption("SMOOTH_ON_SURFACE",SmoothOnSurface, false);
+  /* DESCRIPTION: Switch to apply the volume smoothing operator matrix-free (edge-based stencil, no matrix storage) */
+  addBoolOption("SMOOTH_MATRIXFREE", SmoothMatrixFree, false);
   /* DESCRIPTION: Switch to activate zero Dirichlet boundary for surface mode */
   addBoolOption("DIRICHLET_SURFACE_BOUNDARY", SmoothDirichletSurfaceBound, false);
   /* DESCRIPTION: Switch to activate the debbuging modus */
@@ -2024,6 +2144,8 @@ void CConfig::SetConfig_Options() {
   addStringOption("MESH_FILENAME", Mesh_FileName, string("mesh.su2"));
   /*!\brief MESH_OUT_FILENAME \n DESCRIPTION: Mesh output file name. Used when converting, scaling, or deforming a mesh. \n DEFAULT: mesh_out.su2 \ingroup Config*/
   addStringOption("MESH_OUT_FILENAME", Mesh_Out_FileName, string("mesh_out.su2"));
+  /*!\brief GEOMETRY_CACHE \n DESCRIPTION: Cache expensive geometry preprocessing results (wall distances) in binary files next to the mesh and reuse them on subsequent runs of the same case at the same rank count. The files are keyed on the mesh and the relevant config options, stale caches are recomputed automatically. \n DEFAULT: false \ingroup Config*/
+  addBoolOption("GEOMETRY_CACHE", GeometryCache, false);
 
   /* DESCRIPTION: List of the number of grid points in the RECTANGLE or BOX grid in the x,y,z directions. (default: (33,33,33) ). */
   addShortListOption("MESH_BOX_SIZE", nMesh_Box_Size, Mesh_Box_Size);
@@ -2055,6 +2177,22 @@ void CConfig::SetConfig_Options() {
   addStringOption("RESTART_ADJ_FILENAME", Restart_AdjFileName, string("restart_adj.dat"));
   /*!\brief VOLUME_FLOW_FILENAME  \n DESCRIPTION: Output file flow (w/o extension) variables \ingroup Config */
   addStringOption("VOLUME_FILENAME", Volume_FileName, string("vol_solution"));
+  /* DESCRIPTION: Probe locations (x1, y1, z1, x2, y2, z2, ...), each probe is resolved once to its
+   containing element and the interpolated flow solution is appended to a compact binary time history,
+   avoiding volume output for the sole purpose of extracting point signals */
+  addDoubleListOption("PROBE_LOCATIONS", nProbe_Locations, Probe_Locations);
+  /* DESCRIPTION: Output file for the probe time histories (binary) */
+  addStringOption("PROBE_FILENAME", Probe_FileName, string("probes.dat"));
+  /* DESCRIPTION: Sampling frequency of the probes (iterations) */
+  addUnsignedLongOption("PROBE_WRT_FREQ", Probe_Wrt_Freq, 1);
+  /* DESCRIPTION: Markers of the acoustic sampling surfaces (e.g. penetrable FWH surfaces), the surface
+   state is packed into a per-rank ring buffer every time step and flushed in the background to compact
+   binary files, avoiding volume output for the sole purpose of acoustic post-processing */
+  addStringListOption("ACOUSTIC_MARKERS", nAcoustic_Markers, Acoustic_Markers);
+  /* DESCRIPTION: Base name of the per-rank acoustic sample files (binary) */
+  addStringOption("ACOUSTIC_FILENAME", Acoustic_FileName, string("acoustic_surface.dat"));
+  /* DESCRIPTION: Time steps buffered per rank before the acoustic samples are flushed */
+  addUnsignedLongOption("ACOUSTIC_BUFFER_STEPS", Acoustic_Buffer_Steps, 32);
   /*!\brief VOLUME_ADJ_FILENAME
    *  \n DESCRIPTION: Output file adjoint (w/o extension) variables  \ingroup Config*/
   addStringOption("VOLUME_ADJ_FILENAME", Adj_FileName, string("adj_vol_solution"));
@@ -2078,6 +2216,23 @@ void CConfig::SetConfig_Options() {
   addStringOption("VOLUME_SENS_FILENAME", VolSens_FileName, string("volume_sens"));
   /* DESCRIPTION: Output the performance summary to the console at the end of SU2_CFD  \ingroup Config*/
   addBoolOption("WRT_PERFORMANCE", Wrt_Performance, false);
+  /* DESCRIPTION: Append a machine-readable performance record (per-phase timings, DOF/s, linear solver
+   statistics, memory high-water) to a JSON-lines file at the end of SU2_CFD, keyed by the config hash
+   and code version so runs can be compared across cases and releases  \ingroup Config*/
+  addBoolOption("WRT_PERFORMANCE_RECORD", Wrt_Performance_Record, false);
+  /* DESCRIPTION: JSON-lines file the performance records are appended to  \ingroup Config*/
+  addStringOption("PERFORMANCE_RECORD_FILENAME", Performance_Record_FileName, string("su2_performance.jsonl"));
+  /* DESCRIPTION: Append the data of the previous time step to binary restart files so that a 2nd-order
+   dual-time restart reads both time levels from one file instead of two, requires writing the restart
+   file every time step  \ingroup Config*/
+  addBoolOption("DUAL_SNAPSHOT_RESTART", Dual_Snapshot_Restart, false);
+  /* DESCRIPTION: Scaling-benchmark mode: grow the analytic RECTANGLE / BOX grid with the number of
+   ranks (weak scaling, unless MESH_BOX_SIZE is given explicitly), disable the volume output files,
+   and print the performance summary. \ingroup Config*/
+  addBoolOption("SCALING_BENCHMARK", ScalingBenchmark, false);
+  /* DESCRIPTION: Write the volume output files on a dedicated thread while the solver continues iterating.
+   With MPI this requires running SU2_CFD with --thread_multiple.  \ingroup Config*/
+  addBoolOption("WRT_ASYNC_OUTPUT", Wrt_AsyncOutput, false);
   /* DESCRIPTION: Output the tape statistics (discrete adjoint)  \ingroup Config*/
   addBoolOption("WRT_AD_STATISTICS", Wrt_AD_Statistics, false);
   /*!\brief MARKER_ANALYZE_AVERAGE
@@ -2214,6 +2369,10 @@ void CConfig::SetConfig_Options() {
   addEnumListOption("DV_KIND", nDV, Design_Variable, Param_Map);
   /* DESCRIPTION: Marker of the surface to which we are going apply the shape deformation */
   addStringListOption("DV_MARKER", nMarker_DV, Marker_DV);
+  /* DESCRIPTION: Project the surface sensitivities onto the design variables at the end of the
+   discrete adjoint run and write the gradient file directly, without a separate SU2_DOT_AD call
+   (requires DV_KIND/DV_PARAM/DV_MARKER in the adjoint config). */
+  addBoolOption("PROJECT_GRADIENT", ProjectGradient, false);
   /* DESCRIPTION: Parameters of the shape deformation
    - FFD_CONTROL_POINT_2D ( FFDBox ID, i_Ind, j_Ind, x_Disp, y_Disp )
    - FFD_RADIUS_2D ( FFDBox ID )
@@ -2281,6 +2440,21 @@ void CConfig::SetConfig_Options() {
   addDoubleOption("DEFORM_LINEAR_SOLVER_ERROR", Deform_Linear_Solver_Error, 1E-14);
   /* DESCRIPTION: Maximum number of iterations of the linear solver for the implicit formulation */
   addUnsignedLongOption("DEFORM_LINEAR_SOLVER_ITER", Deform_Linear_Solver_Iter, 1000);
+  /* DESCRIPTION: Update the dual grid incrementally after mesh deformation, recomputing the metrics
+   only near the points that moved beyond DEFORM_INCREMENTAL_TOL (primal runs only) */
+  addBoolOption("DEFORM_INCREMENTAL_GRID_UPDATE", Deform_IncrementalGridUpdate, false);
+  /* DESCRIPTION: Points whose maximum coordinate change is below this tolerance are treated
+   as unmoved by the incremental dual grid update */
+  addDoubleOption("DEFORM_INCREMENTAL_TOL", Deform_IncrementalTol, 1E-10);
+  /* DESCRIPTION: Reuse the assembled mesh-deformation stiffness matrix and the preconditioner
+   built from it across deformations (small-deformation assumption), only the RHS setup and the
+   solve remain per call. Invalidated automatically once the accumulated deformation is no
+   longer small compared to the mesh dimensions. */
+  addBoolOption("DEFORM_REUSE_STIFFNESS", Deform_ReuseStiffness, false);
+  /* DESCRIPTION: Store the dual-time mesh displacement history (time levels n and n-1) in single
+   precision relative to the undeformed reference coordinates, halving the memory footprint of the
+   motion history on large deforming meshes. Not available for discrete adjoint runs. */
+  addBoolOption("DEFORM_COMPACT_HISTORY", Compact_Mesh_History, false);
 
   /*!\par CONFIG_CATEGORY: Rotorcraft problem \ingroup Config*/
   /*--- option related to rotorcraft problems ---*/
@@ -2513,6 +2687,16 @@ void CConfig::SetConfig_Options() {
   /* DESCRIPTION: Tolerance to prune small coefficients from the RBF interpolation matrix. */
   addDoubleOption("RADIAL_BASIS_FUNCTION_PRUNE_TOLERANCE", RadialBasisFunction_PruneTol, 1e-6);
 
+  /* DESCRIPTION: Maximum number of control points for radial basis function interpolation, a greedy
+   selection reduces the donor points to (at most) this subset and the dense interpolation system is
+   only assembled and factored for the subset. 0 (default) disables the limit. */
+  addUnsignedLongOption("RADIAL_BASIS_FUNCTION_MAX_CONTROL_POINTS", RadialBasisFunction_MaxControlPoints, 0);
+
+  /* DESCRIPTION: Fill-distance tolerance (relative to the basis function radius) for the greedy
+   selection of radial basis function control points, the selection stops once every donor point is
+   within this distance of a control point. 0 (default) selects all donor points. */
+  addDoubleOption("RADIAL_BASIS_FUNCTION_FILL_TOLERANCE", RadialBasisFunction_FillTol, 0.0);
+
    /*!\par INLETINTERPOLATION \n
    * DESCRIPTION: Type of spanwise interpolation to use for the inlet face. \n OPTIONS: see \link Inlet_SpanwiseInterpolation_Map \endlink
    * Sets Kind_InletInterpolation \ingroup Config
@@ -2581,6 +2765,11 @@ void CConfig::SetConfig_Options() {
   /*  Options: NO, YES \ingroup Config */
   addEnumOption("CHT_COUPLING_METHOD", Kind_CHT_Coupling, CHT_Coupling_Map, CHT_COUPLING::DIRECT_TEMPERATURE_ROBIN_HEATFLUX);
 
+  /*!\brief CHT_ASYNC_COUPLING \n DESCRIPTION: Exchange the CHT interface data asynchronously, each zone consumes
+   * the partner data gathered during the previous transfer (one outer iteration old) instead of waiting for the
+   * current one, which overlaps the interface communication with the zone solves. \n DEFAULT: false \ingroup Config */
+  addBoolOption("CHT_ASYNC_COUPLING", CHT_Async_Coupling, false);
+
   /*!\par CONFIG_CATEGORY: Visualize Control Volumes \ingroup Config*/
   /*--- options related to visualizing control volumes ---*/
 
@@ -2746,6 +2935,25 @@ void CConfig::SetConfig_Options() {
   /* DESCRIPTION: ParMETIS load balancing weight for edges (equiv. to neighbors) */
   addLongOption("PARMETIS_EDGE_WEIGHT", ParMETIS_edgeWgt, 1);
 
+  /* DESCRIPTION: ParMETIS weight multiplier for points on markers with wall functions,
+   * these points cost more per iteration than regular interior points. */
+  addDoubleOption("PARMETIS_WALL_MODEL_WEIGHT", ParMETIS_wallModelWgt, 1.0);
+
+  /* DESCRIPTION: Markers with a prescribed partitioning cost multiplier,
+   * format: ( marker1, weight1, marker2, weight2, ... ), overrides the wall-function weight. */
+  addStringDoubleListOption("MARKER_PARTITION_WEIGHT", nMarker_PartitionWeight, Marker_PartitionWeight, PartitionWeight);
+
+  /* DESCRIPTION: File used to cache the point-to-rank coloring between runs of the same case
+   * at the same rank count. Written after the first partitioning, read back (skipping ParMETIS)
+   * on reruns if the point count and rank count match. Empty to disable. */
+  addStringOption("PARTITION_MAP_FILENAME", PartitionMap_FileName, string(""));
+
+  /* DESCRIPTION: Frequency (in time iterations) for monitoring the parallel load balance (0 to disable) */
+  addUnsignedLongOption("LOAD_BALANCE_MONITOR_FREQ", loadBalanceMonitorFreq, 0);
+
+  /* DESCRIPTION: Work imbalance ratio (max/avg) above which a rebalancing warning is printed */
+  addDoubleOption("LOAD_BALANCE_THRESHOLD", loadBalanceThreshold, 1.25);
+
   /*--- options that are used in the Hybrid RANS/LES Simulations  ---*/
   /*!\par CONFIG_CATEGORY:Hybrid_RANSLES Options\ingroup Config*/
 
@@ -2810,6 +3018,18 @@ void CConfig::SetConfig_Options() {
   /* DESCRIPTION: Type of output printed to the volume solution file */
   addStringListOption("VOLUME_OUTPUT", nVolumeOutput, VolumeOutput);
 
+  /* DESCRIPTION: Region-of-interest box for the volume visualization files, given as
+   (x_min, y_min, z_min, x_max, y_max, z_max), or 4 values in 2D. Only points and elements
+   inside the box are written, restart and surface files are not affected. */
+  addDoubleListOption("OUTPUT_ROI_BOX", nOutputROIBox, OutputROIBox);
+
+  /* DESCRIPTION: Evaluate only the requested history output groups and their dependencies */
+  addBoolOption("LAZY_HISTORY_OUTPUT", LazyHistoryOutput, false);
+  /* DESCRIPTION: Evaluation frequency of requested history groups in lazy output mode (INNER_ITER) */
+  addUnsignedLongOption("HISTORY_EVAL_FREQ", HistoryEvalFreq, 1);
+  /* DESCRIPTION: Iterations between flushes of the buffered screen and history file output (INNER_ITER) */
+  addUnsignedLongOption("MONITORING_FLUSH_FREQ", MonitoringFlushFreq, 1);
+
   /* DESCRIPTION: History writing frequency (INNER_ITER) */
   addUnsignedLongOption("HISTORY_WRT_FREQ_INNER", HistoryWrtFreq[2], 1);
   /* DESCRIPTION: History writing frequency (OUTER_ITER) */
@@ -2826,6 +3046,15 @@ void CConfig::SetConfig_Options() {
   /* DESCRIPTION: list of writing frequencies for each file type (length same as nVolumeOutputFiles) */
   addULongListOption("OUTPUT_WRT_FREQ", nVolumeOutputFrequencies, VolumeOutputFrequencies);
 
+  /* DESCRIPTION: History field monitored by the output trigger (NONE = fixed frequencies only) */
+  addStringOption("OUTPUT_TRIGGER_FIELD", Output_Trigger_Field, string("NONE"));
+  /* DESCRIPTION: Relative change per iteration of the monitored field that activates the output trigger */
+  addDoubleOption("OUTPUT_TRIGGER_THRESHOLD", Output_Trigger_Threshold, 0.0);
+  /* DESCRIPTION: Volume output frequency while the output trigger is active */
+  addUnsignedLongOption("OUTPUT_TRIGGER_WRT_FREQ", Output_Trigger_Wrt_Freq, 1);
+  /* DESCRIPTION: Number of iterations the raised output frequency is held after the trigger last fired */
+  addUnsignedLongOption("OUTPUT_TRIGGER_HOLD", Output_Trigger_Hold, 0);
+
   /* DESCRIPTION: Volume solution files */
   addEnumListOption("OUTPUT_FILES", nVolumeOutputFiles, VolumeOutputFiles, Output_Map);
 
@@ -2856,6 +3085,22 @@ void CConfig::SetConfig_Options() {
   /* DESCRIPTION: Size of the edge groups colored for thread parallel edge loops (0 forces the reducer strategy). */
   addUnsignedLongOption("EDGE_COLORING_GROUP_SIZE", edgeColorGroupSize, 512);
 
+  /* DESCRIPTION: Use natural-order edge loops with per-edge accumulation and a reduction phase instead of edge coloring. */
+  addBoolOption("USE_EDGE_REDUCTION", edgeReduction, false);
+
+  /* DESCRIPTION: Time calibration sweeps over the colored edge groups and use the measured cost,
+     instead of a stencil-size estimate, to order and schedule the parallel edge loops. */
+  addBoolOption("EDGE_COLORING_CALIBRATION", edgeColorCalibration, false);
+
+  /* DESCRIPTION: Release the halo-point storage of auxiliary solver fields that are only used for domain points. */
+  addBoolOption("SLIM_HALO", slimHalo, false);
+
+  /* DESCRIPTION: Sort the edge list for cache locality after the RCM point renumbering and report the achieved bandwidth reduction. */
+  addBoolOption("LOCALITY_REORDERING", localityReordering, false);
+
+  /* DESCRIPTION: Report the page-to-NUMA-node placement of the largest solver allocations (Linux only). */
+  addBoolOption("NUMA_DIAGNOSTICS", numaDiagnostics, false);
+
   /*--- options that are used for libROM ---*/
   /*!\par CONFIG_CATEGORY:libROM options \ingroup Config*/
 
@@ -2878,21 +3123,56 @@ void CConfig::SetConfig_Options() {
 
 }
 
-void CConfig::SetConfig_Parsing(char case_filename[MAX_STRING_SIZE]) {
+const string& CConfig::GetConfigFileContents(const string& case_filename) {
 
-  ifstream case_file;
+  /*--- Cache the raw contents per file name. Multizone cases instantiate one
+   *    CConfig per zone (and the SU2 components each re-parse the file), so
+   *    without the cache the same file is read and tokenized from disk over
+   *    and over on every rank, which dominates startup time for cases with
+   *    many zones on many ranks. ---*/
 
-  /*--- Read the configuration file ---*/
+  static map<string, string> fileCache;
 
-  case_file.open(case_filename, ios::in);
+  auto it = fileCache.find(case_filename);
+  if (it != fileCache.end()) return it->second;
+
+  /*--- Only the master rank touches the file system, the raw contents are
+   *    broadcast to all other ranks. A length of zero signals failure, a
+   *    successfully read file is sent with one extra byte. ---*/
 
-  if (case_file.fail()) {
+  string contents;
+  unsigned long length = 0;
+
+  if (SU2_MPI::GetRank() == MASTER_NODE) {
+    ifstream case_file(case_filename.c_str(), ios::in);
+    if (!case_file.fail()) {
+      ostringstream ss;
+      ss << case_file.rdbuf();
+      contents = ss.str();
+      length = contents.size() + 1;
+    }
+  }
+
+  SU2_MPI::Bcast(&length, 1, MPI_UNSIGNED_LONG, MASTER_NODE, SU2_MPI::GetComm());
+
+  if (length == 0) {
     SU2_MPI::Error("The configuration file (.cfg) is missing!!", CURRENT_FUNCTION);
   }
 
-  SetConfig_Parsing(case_file);
+  contents.resize(length-1);
+  if (length > 1)
+    SU2_MPI::Bcast(&contents[0], length-1, MPI_CHAR, MASTER_NODE, SU2_MPI::GetComm());
 
-  case_file.close();
+  return fileCache.emplace(case_filename, move(contents)).first->second;
+}
+
+void CConfig::SetConfig_Parsing(char case_filename[MAX_STRING_SIZE]) {
+
+  /*--- Parse from the cached (and already broadcast) file contents. ---*/
+
+  istringstream case_buffer(GetConfigFileContents(case_filename));
+
+  SetConfig_Parsing(case_buffer);
 
 }
 
@@ -2909,10 +3189,20 @@ void CConfig::SetConfig_Parsing(istream& config_buffer){
 
   map<string, bool> included_options;
 
+  /*--- FNV-1a hash of the raw file contents, identifies the exact configuration
+   in the performance records without storing the file itself. ---*/
+
+  Config_Hash = 14695981039346656037ul;
+  auto hashLine = [&](const string& line) {
+    for (const char c : line) Config_Hash = (Config_Hash ^ (unsigned char)c) * 1099511628211ul;
+  };
+
   /*--- Parse the configuration file and set the options ---*/
 
   while (getline (config_buffer, text_line)) {
 
+    hashLine(text_line);
+
     if (err_count >= max_err_count) {
       errorString.append("Too many errors, stopping parse.");
       break;
@@ -2931,6 +3221,7 @@ void CConfig::SetConfig_Parsing(istream& config_buffer){
               (PrintingToolbox::split(text_line, '\\').size() > 1)){
          string tmp;
          getline (config_buffer, tmp);
+         hashLine(tmp);
          line_count++;
          if (tmp.find_first_of('=') != string::npos){
            errorString.append("Line " + to_string(line_count)  + ": Statement found after continuation character.\n");
@@ -3094,6 +3385,17 @@ void CConfig::SetDefault(){
   }
 }
 
+void CConfig::ReleaseOptionStorage() {
+
+  /*--- The decoder objects (and the raw value strings they keep) are only
+   needed while parsing, everything they produced lives in the member fields.
+   Deleting them here shrinks the per-zone footprint of multizone problems
+   to the member data. The map of unset options stays, OptionIsSet needs it. ---*/
+
+  for (auto& option : option_map) delete option.second;
+  option_map.clear();
+}
+
 bool CConfig::SetRunTime_Parsing(char case_filename[MAX_STRING_SIZE]) {
   string text_line, option_name;
   ifstream case_file;
@@ -3336,6 +3638,17 @@ void CConfig::SetPostprocessing(SU2_COMPONENT val_software, unsigned short val_i
     nVolumeOutputFrequencies = nVolumeOutputFiles;
   }
 
+  /*--- The dual-snapshot restart relies on the writer caching the previously written snapshot,
+   *    which is only guaranteed if the binary restart file is written every time step. ---*/
+  if (Dual_Snapshot_Restart && Time_Domain) {
+    for (unsigned short iVolumeFile = 0; iVolumeFile < nVolumeOutputFiles; iVolumeFile++){
+      if ((VolumeOutputFiles[iVolumeFile] == OUTPUT_TYPE::RESTART_BINARY) &&
+          (VolumeOutputFrequencies[iVolumeFile] != 1)) {
+        SU2_MPI::Error(string("DUAL_SNAPSHOT_RESTART requires OUTPUT_WRT_FREQ= 1 for the RESTART_BINARY file.\n"), CURRENT_FUNCTION);
+      }
+    }
+  }
+
   /*--- Check if SU2 was build with TecIO support, as that is required for Tecplot Binary output. ---*/
 #ifndef HAVE_TECIO
   for (unsigned short iVolumeFile = 0; iVolumeFile < nVolumeOutputFiles; iVolumeFile++){
@@ -5014,6 +5327,27 @@ void CConfig::SetPostprocessing(SU2_COMPONENT val_software, unsigned short val_i
                    CURRENT_FUNCTION);
   }
 
+  /* Scaling-benchmark mode, based on the analytic grids so that no mesh files
+   are needed. Unless the grid size is given explicitly (strong scaling), it is
+   grown with the number of ranks to keep the work per rank constant (weak
+   scaling). The volume output is disabled and the performance summary forced,
+   history and screen monitoring are not affected. */
+
+  if (ScalingBenchmark) {
+    if (Mesh_FileFormat != BOX && Mesh_FileFormat != RECTANGLE) {
+      SU2_MPI::Error("SCALING_BENCHMARK requires MESH_FORMAT= BOX or RECTANGLE.", CURRENT_FUNCTION);
+    }
+    if (!OptionIsSet("MESH_BOX_SIZE")) {
+      const unsigned short nDimGrid = (Mesh_FileFormat == BOX) ? 3 : 2;
+      const passivedouble growth = pow(passivedouble(size), 1.0/nDimGrid);
+      for (unsigned short iDim = 0; iDim < nDimGrid; iDim++) {
+        Mesh_Box_Size[iDim] = 1 + short(lround((Mesh_Box_Size[iDim]-1)*growth));
+      }
+    }
+    nVolumeOutputFiles = 0;
+    Wrt_Performance = true;
+  }
+
   /* Force the lowest memory preconditioner when direct solvers are used. */
 
   auto isPastix = [](unsigned short kindSolver) {
@@ -5024,6 +5358,14 @@ void CConfig::SetPostprocessing(SU2_COMPONENT val_software, unsigned short val_i
   if (isPastix(Kind_DiscAdj_Linear_Solver)) Kind_DiscAdj_Linear_Prec = LU_SGS;
   if (isPastix(Kind_Deform_Linear_Solver)) Kind_Deform_Linear_Solver_Prec = LU_SGS;
 
+  /*--- The scalar (turbulence/species) systems use the main linear solver settings unless
+   a dedicated solver was requested, e.g. a line-implicit smoother for RANS problems. ---*/
+
+  if (!OptionIsSet("TURB_LINEAR_SOLVER")) Kind_Turb_Linear_Solver = Kind_Linear_Solver;
+  if (!OptionIsSet("TURB_LINEAR_SOLVER_PREC")) Kind_Turb_Linear_Solver_Prec = Kind_Linear_Solver_Prec;
+  if (!OptionIsSet("TURB_LINEAR_SOLVER_ITER")) Turb_Linear_Solver_Iter = Linear_Solver_Iter;
+  if (isPastix(Kind_Turb_Linear_Solver)) Kind_Turb_Linear_Solver_Prec = LU_SGS;
+
 
   if (DiscreteAdjoint) {
 #if !defined CODI_REVERSE_TYPE
@@ -5037,6 +5379,8 @@ void CConfig::SetPostprocessing(SU2_COMPONENT val_software, unsigned short val_i
     /*--- Use the same linear solver on the primal as the one used in the adjoint. ---*/
     Kind_Linear_Solver = Kind_DiscAdj_Linear_Solver;
     Kind_Linear_Solver_Prec = Kind_DiscAdj_Linear_Prec;
+    if (!OptionIsSet("TURB_LINEAR_SOLVER")) Kind_Turb_Linear_Solver = Kind_Linear_Solver;
+    if (!OptionIsSet("TURB_LINEAR_SOLVER_PREC")) Kind_Turb_Linear_Solver_Prec = Kind_Linear_Solver_Prec;
 
     if (Time_Domain) {
 
@@ -5184,6 +5528,11 @@ void CConfig::SetPostprocessing(SU2_COMPONENT val_software, unsigned short val_i
   /*--- Specifying a deforming surface requires a mesh deformation solver. ---*/
   if (GetSurface_Movement(DEFORMING)) Deform_Mesh = true;
 
+  /*--- The compact (single precision) mesh displacement history cannot be recorded on the AD tape. ---*/
+  if (Compact_Mesh_History && DiscreteAdjoint) {
+    SU2_MPI::Error("DEFORM_COMPACT_HISTORY is not compatible with the discrete adjoint.", CURRENT_FUNCTION);
+  }
+
   if (GetGasModel() == "ARGON") {monoatomic = true;}
   else {monoatomic = false;}
 
@@ -8067,6 +8416,14 @@ string CConfig::GetObjFunc_Extension(string val_filename) const {
   return Filename;
 }
 
+string CConfig::GetObjFunc_Name(void) const {
+
+  for (auto it = Objective_Map.begin(); it != Objective_Map.end(); ++it)
+    if (it->second == GetKind_ObjFunc()) return it->first;
+
+  return "OBJECTIVE";
+}
+
 unsigned short CConfig::GetContainerPosition(unsigned short val_eqsystem) {
 
   switch (val_eqsystem) {
@@ -8528,6 +8885,45 @@ su2double CConfig::GetExhaust_Pressure_Target(string val_marker) const {
   return Exhaust_Pressure_Target[iMarker_EngineExhaust];
 }
 
+unsigned short CConfig::GetMarker_Position(const string* tags, unsigned short nTags, unsigned short iMarker_All) const {
+
+  auto& cache = Marker_PositionCache[tags];
+
+  /*--- On the first query of a tag array resolve the position of every grid
+   marker in it, tags not in the array map to position nTags. ---*/
+
+  if (cache.empty()) {
+    cache.resize(nMarker_All);
+    for (unsigned short iMarker = 0; iMarker < nMarker_All; iMarker++) {
+      unsigned short iTag;
+      for (iTag = 0; iTag < nTags; iTag++)
+        if (tags[iTag] == Marker_All_TagBound[iMarker]) break;
+      cache[iMarker] = iTag;
+    }
+  }
+  return cache[iMarker_All];
+}
+
+void CConfig::SetMarker_PositionCaches() {
+
+  Marker_PositionCache.clear();
+  if (nMarker_All == 0) return;
+
+  /*--- Build the caches of the marker families queried during boundary loops,
+   the index-based getters are then read-only (safe in hybrid parallel runs). ---*/
+
+  if (nMarker_HeatFlux > 0)         GetMarker_Position(Marker_HeatFlux, nMarker_HeatFlux, 0);
+  if (nMarker_Isothermal > 0)       GetMarker_Position(Marker_Isothermal, nMarker_Isothermal, 0);
+  if (nMarker_HeatTransfer > 0)     GetMarker_Position(Marker_HeatTransfer, nMarker_HeatTransfer, 0);
+  if (nMarker_CHTInterface > 0)     GetMarker_Position(Marker_CHTInterface, nMarker_CHTInterface, 0);
+  if (nMarker_Inlet > 0)            GetMarker_Position(Marker_Inlet, nMarker_Inlet, 0);
+  if (nMarker_Supersonic_Inlet > 0) GetMarker_Position(Marker_Supersonic_Inlet, nMarker_Supersonic_Inlet, 0);
+  if (nMarker_Outlet > 0)           GetMarker_Position(Marker_Outlet, nMarker_Outlet, 0);
+  if (nMarker_WallFunctions > 0)    GetMarker_Position(Marker_WallFunctions, nMarker_WallFunctions, 0);
+  if (nMarker_Inlet_Species > 0)    GetMarker_Position(Marker_Inlet_Species, nMarker_Inlet_Species, 0);
+  if (nMarker_Emissivity > 0)       GetMarker_Position(Marker_Emissivity, nMarker_Emissivity, 0);
+}
+
 INLET_TYPE CConfig::GetKind_Inc_Inlet(string val_marker) const {
   unsigned short iMarker_Inlet;
   for (iMarker_Inlet = 0; iMarker_Inlet < nMarker_Inlet; iMarker_Inlet++)
@@ -8535,6 +8931,10 @@ INLET_TYPE CConfig::GetKind_Inc_Inlet(string val_marker) const {
   return Kind_Inc_Inlet[iMarker_Inlet];
 }
 
+INLET_TYPE CConfig::GetKind_Inc_Inlet(unsigned short val_marker_all) const {
+  return Kind_Inc_Inlet[GetMarker_Position(Marker_Inlet, nMarker_Inlet, val_marker_all)];
+}
+
 INC_OUTLET_TYPE CConfig::GetKind_Inc_Outlet(string val_marker) const {
   unsigned short iMarker_Outlet;
   for (iMarker_Outlet = 0; iMarker_Outlet < nMarker_Outlet; iMarker_Outlet++)
@@ -8542,6 +8942,10 @@ INC_OUTLET_TYPE CConfig::GetKind_Inc_Outlet(string val_marker) const {
   return Kind_Inc_Outlet[iMarker_Outlet];
 }
 
+INC_OUTLET_TYPE CConfig::GetKind_Inc_Outlet(unsigned short val_marker_all) const {
+  return Kind_Inc_Outlet[GetMarker_Position(Marker_Outlet, nMarker_Outlet, val_marker_all)];
+}
+
 su2double CConfig::GetInlet_Ttotal(string val_marker) const {
   unsigned short iMarker_Inlet;
   for (iMarker_Inlet = 0; iMarker_Inlet < nMarker_Inlet; iMarker_Inlet++)
@@ -8549,6 +8953,10 @@ su2double CConfig::GetInlet_Ttotal(string val_marker) const {
   return Inlet_Ttotal[iMarker_Inlet];
 }
 
+su2double CConfig::GetInlet_Ttotal(unsigned short val_marker_all) const {
+  return Inlet_Ttotal[GetMarker_Position(Marker_Inlet, nMarker_Inlet, val_marker_all)];
+}
+
 su2double CConfig::GetInlet_Ptotal(string val_marker) const {
   unsigned short iMarker_Inlet;
   for (iMarker_Inlet = 0; iMarker_Inlet < nMarker_Inlet; iMarker_Inlet++)
@@ -8556,6 +8964,10 @@ su2double CConfig::GetInlet_Ptotal(string val_marker) const {
   return Inlet_Ptotal[iMarker_Inlet];
 }
 
+su2double CConfig::GetInlet_Ptotal(unsigned short val_marker_all) const {
+  return Inlet_Ptotal[GetMarker_Position(Marker_Inlet, nMarker_Inlet, val_marker_all)];
+}
+
 void CConfig::SetInlet_Ptotal(su2double val_pressure, string val_marker) {
   unsigned short iMarker_Inlet;
   for (iMarker_Inlet = 0; iMarker_Inlet < nMarker_Inlet; iMarker_Inlet++)
@@ -8570,6 +8982,10 @@ const su2double* CConfig::GetInlet_FlowDir(string val_marker) const {
   return Inlet_FlowDir[iMarker_Inlet];
 }
 
+const su2double* CConfig::GetInlet_FlowDir(unsigned short val_marker_all) const {
+  return Inlet_FlowDir[GetMarker_Position(Marker_Inlet, nMarker_Inlet, val_marker_all)];
+}
+
 su2double CConfig::GetInlet_Temperature(string val_marker) const {
   unsigned short iMarker_Supersonic_Inlet;
   for (iMarker_Supersonic_Inlet = 0; iMarker_Supersonic_Inlet < nMarker_Supersonic_Inlet; iMarker_Supersonic_Inlet++)
@@ -8577,6 +8993,10 @@ su2double CConfig::GetInlet_Temperature(string val_marker) const {
   return Inlet_Temperature[iMarker_Supersonic_Inlet];
 }
 
+su2double CConfig::GetInlet_Temperature(unsigned short val_marker_all) const {
+  return Inlet_Temperature[GetMarker_Position(Marker_Supersonic_Inlet, nMarker_Supersonic_Inlet, val_marker_all)];
+}
+
 su2double CConfig::GetInlet_Pressure(string val_marker) const {
   unsigned short iMarker_Supersonic_Inlet;
   for (iMarker_Supersonic_Inlet = 0; iMarker_Supersonic_Inlet < nMarker_Supersonic_Inlet; iMarker_Supersonic_Inlet++)
@@ -8584,6 +9004,10 @@ su2double CConfig::GetInlet_Pressure(string val_marker) const {
   return Inlet_Pressure[iMarker_Supersonic_Inlet];
 }
 
+su2double CConfig::GetInlet_Pressure(unsigned short val_marker_all) const {
+  return Inlet_Pressure[GetMarker_Position(Marker_Supersonic_Inlet, nMarker_Supersonic_Inlet, val_marker_all)];
+}
+
 const su2double* CConfig::GetInlet_Velocity(string val_marker) const {
   unsigned short iMarker_Supersonic_Inlet;
   for (iMarker_Supersonic_Inlet = 0; iMarker_Supersonic_Inlet < nMarker_Supersonic_Inlet; iMarker_Supersonic_Inlet++)
@@ -8591,6 +9015,10 @@ const su2double* CConfig::GetInlet_Velocity(string val_marker) const {
   return Inlet_Velocity[iMarker_Supersonic_Inlet];
 }
 
+const su2double* CConfig::GetInlet_Velocity(unsigned short val_marker_all) const {
+  return Inlet_Velocity[GetMarker_Position(Marker_Supersonic_Inlet, nMarker_Supersonic_Inlet, val_marker_all)];
+}
+
 const su2double* CConfig::GetInlet_SpeciesVal(string val_marker) const {
   unsigned short iMarker_Inlet_Species;
   for (iMarker_Inlet_Species = 0; iMarker_Inlet_Species < nMarker_Inlet_Species; iMarker_Inlet_Species++)
@@ -8598,6 +9026,10 @@ const su2double* CConfig::GetInlet_SpeciesVal(string val_marker) const {
   return Inlet_SpeciesVal[iMarker_Inlet_Species];
 }
 
+const su2double* CConfig::GetInlet_SpeciesVal(unsigned short val_marker_all) const {
+  return Inlet_SpeciesVal[GetMarker_Position(Marker_Inlet_Species, nMarker_Inlet_Species, val_marker_all)];
+}
+
 su2double CConfig::GetOutlet_Pressure(string val_marker) const {
   unsigned short iMarker_Outlet;
   for (iMarker_Outlet = 0; iMarker_Outlet < nMarker_Outlet; iMarker_Outlet++)
@@ -8605,6 +9037,10 @@ su2double CConfig::GetOutlet_Pressure(string val_marker) const {
   return Outlet_Pressure[iMarker_Outlet];
 }
 
+su2double CConfig::GetOutlet_Pressure(unsigned short val_marker_all) const {
+  return Outlet_Pressure[GetMarker_Position(Marker_Outlet, nMarker_Outlet, val_marker_all)];
+}
+
 void CConfig::SetOutlet_Pressure(su2double val_pressure, string val_marker) {
   unsigned short iMarker_Outlet;
   for (iMarker_Outlet = 0; iMarker_Outlet < nMarker_Outlet; iMarker_Outlet++)
@@ -8868,6 +9304,11 @@ su2double CConfig::GetIsothermal_Temperature(string val_marker) const {
   return Isothermal_Temperature[0];
 }
 
+su2double CConfig::GetIsothermal_Temperature(unsigned short val_marker_all) const {
+  const auto pos = GetMarker_Position(Marker_Isothermal, nMarker_Isothermal, val_marker_all);
+  return Isothermal_Temperature[pos < nMarker_Isothermal ? pos : 0];
+}
+
 su2double CConfig::GetWall_HeatFlux(string val_marker) const {
 
   for (unsigned short iMarker_HeatFlux = 0; iMarker_HeatFlux < nMarker_HeatFlux; iMarker_HeatFlux++)
@@ -8877,6 +9318,11 @@ su2double CConfig::GetWall_HeatFlux(string val_marker) const {
   return Heat_Flux[0];
 }
 
+su2double CConfig::GetWall_HeatFlux(unsigned short val_marker_all) const {
+  const auto pos = GetMarker_Position(Marker_HeatFlux, nMarker_HeatFlux, val_marker_all);
+  return Heat_Flux[pos < nMarker_HeatFlux ? pos : 0];
+}
+
 su2double CConfig::GetWall_HeatTransfer_Coefficient(string val_marker) const {
 
   for (unsigned short iMarker_HeatTransfer = 0; iMarker_HeatTransfer < nMarker_HeatTransfer; iMarker_HeatTransfer++)
@@ -8886,6 +9332,11 @@ su2double CConfig::GetWall_HeatTransfer_Coefficient(string val_marker) const {
   return HeatTransfer_Coeff[0];
 }
 
+su2double CConfig::GetWall_HeatTransfer_Coefficient(unsigned short val_marker_all) const {
+  const auto pos = GetMarker_Position(Marker_HeatTransfer, nMarker_HeatTransfer, val_marker_all);
+  return HeatTransfer_Coeff[pos < nMarker_HeatTransfer ? pos : 0];
+}
+
 su2double CConfig::GetWall_HeatTransfer_Temperature(string val_marker) const {
 
   for (unsigned short iMarker_HeatTransfer = 0; iMarker_HeatTransfer < nMarker_HeatTransfer; iMarker_HeatTransfer++)
@@ -8895,6 +9346,11 @@ su2double CConfig::GetWall_HeatTransfer_Temperature(string val_marker) const {
   return HeatTransfer_WallTemp[0];
 }
 
+su2double CConfig::GetWall_HeatTransfer_Temperature(unsigned short val_marker_all) const {
+  const auto pos = GetMarker_Position(Marker_HeatTransfer, nMarker_HeatTransfer, val_marker_all);
+  return HeatTransfer_WallTemp[pos < nMarker_HeatTransfer ? pos : 0];
+}
+
 pair<WALL_TYPE, su2double> CConfig::GetWallRoughnessProperties(string val_marker) const {
   unsigned short iMarker = 0;
   short          flag = -1;
@@ -8931,6 +9387,36 @@ pair<WALL_TYPE, su2double> CConfig::GetWallRoughnessProperties(string val_marker
   return WallProp;
 }
 
+pair<WALL_TYPE, su2double> CConfig::GetWallRoughnessProperties(unsigned short val_marker_all) const {
+
+  /*--- The roughness arrays hold the heat flux, isothermal, heat transfer,
+   and CHT interface markers back to back (cf. the string overload). ---*/
+
+  unsigned short pos = GetMarker_Position(Marker_HeatFlux, nMarker_HeatFlux, val_marker_all);
+  if (pos < nMarker_HeatFlux)
+    return make_pair(Kind_Wall[pos], Roughness_Height[pos]);
+
+  pos = GetMarker_Position(Marker_Isothermal, nMarker_Isothermal, val_marker_all);
+  if (pos < nMarker_Isothermal) {
+    const unsigned short flag = nMarker_HeatFlux + pos;
+    return make_pair(Kind_Wall[flag], Roughness_Height[flag]);
+  }
+
+  pos = GetMarker_Position(Marker_HeatTransfer, nMarker_HeatTransfer, val_marker_all);
+  if (pos < nMarker_HeatTransfer) {
+    const unsigned short flag = nMarker_HeatFlux + nMarker_Isothermal + pos;
+    return make_pair(Kind_Wall[flag], Roughness_Height[flag]);
+  }
+
+  pos = GetMarker_Position(Marker_CHTInterface, nMarker_CHTInterface, val_marker_all);
+  if (pos < nMarker_CHTInterface) {
+    const unsigned short flag = nMarker_HeatFlux + nMarker_Isothermal + nMarker_HeatTransfer + pos;
+    return make_pair(Kind_Wall[flag], Roughness_Height[flag]);
+  }
+
+  return make_pair(WALL_TYPE::SMOOTH, 0.0);
+}
+
 WALL_FUNCTIONS CConfig::GetWallFunction_Treatment(string val_marker) const {
 
   WALL_FUNCTIONS WallFunction = WALL_FUNCTIONS::NONE;
@@ -8945,6 +9431,12 @@ WALL_FUNCTIONS CConfig::GetWallFunction_Treatment(string val_marker) const {
   return WallFunction;
 }
 
+WALL_FUNCTIONS CConfig::GetWallFunction_Treatment(unsigned short val_marker_all) const {
+  const auto pos = GetMarker_Position(Marker_WallFunctions, nMarker_WallFunctions, val_marker_all);
+  if (pos < nMarker_WallFunctions) return Kind_WallFunctions[pos];
+  return WALL_FUNCTIONS::NONE;
+}
+
 const unsigned short* CConfig::GetWallFunction_IntInfo(string val_marker) const {
   unsigned short *intInfo = nullptr;
 
@@ -9312,6 +9804,12 @@ su2double CConfig::GetWall_Emissivity(string val_marker) const {
   return Wall_Emissivity[iMarker_Emissivity];
 }
 
+su2double CConfig::GetWall_Emissivity(unsigned short val_marker_all) const {
+  unsigned short pos = 0;
+  if (nMarker_Emissivity > 0) pos = GetMarker_Position(Marker_Emissivity, nMarker_Emissivity, val_marker_all);
+  return Wall_Emissivity[pos];
+}
+
 su2double CConfig::GetFlowLoad_Value(string val_marker) const {
   unsigned short iMarker_FlowLoad;
   for (iMarker_FlowLoad = 0; iMarker_FlowLoad < nMarker_FlowLoad; iMarker_FlowLoad++)
@@ -30,6 +30,87 @@
 #include "../../include/adt/CADTComparePointClass.hpp"
 
 #include <algorithm>
+#include <cstdint>
+
+namespace {
+
+/*--- Helper functions to interleave the bits of the scaled integer coordinates,
+      needed to compute the Morton codes along which the batched queries are
+      sorted. The 2D version spreads 32 bits, the 3D version 21 bits. ---*/
+inline uint64_t SpreadBits2D(uint64_t x) {
+  x &= 0x00000000ffffffffull;
+  x = (x | (x << 16)) & 0x0000ffff0000ffffull;
+  x = (x | (x <<  8)) & 0x00ff00ff00ff00ffull;
+  x = (x | (x <<  4)) & 0x0f0f0f0f0f0f0f0full;
+  x = (x | (x <<  2)) & 0x3333333333333333ull;
+  x = (x | (x <<  1)) & 0x5555555555555555ull;
+  return x;
+}
+
+inline uint64_t SpreadBits3D(uint64_t x) {
+  x &= 0x00000000001fffffull;
+  x = (x | (x << 32)) & 0x001f00000000ffffull;
+  x = (x | (x << 16)) & 0x001f0000ff0000ffull;
+  x = (x | (x <<  8)) & 0x100f00f00f00f00full;
+  x = (x | (x <<  4)) & 0x10c30c30c30c30c3ull;
+  x = (x | (x <<  2)) & 0x1249249249249249ull;
+  return x;
+}
+
+}
+
+vector<unsigned long> CADTBaseClass::DetermineMortonOrder(unsigned short      nDim,
+                                                          const unsigned long nQueries,
+                                                          const su2double     *coor) {
+
+  /* Determine the bounding box of the query coordinates. Passive doubles
+     suffice, as the ordering does not affect the results. */
+  passivedouble coorMin[3] = { 1.e+30,  1.e+30,  1.e+30};
+  passivedouble coorMax[3] = {-1.e+30, -1.e+30, -1.e+30};
+
+  for(unsigned long i=0; i<nQueries; ++i) {
+    for(unsigned short iDim=0; iDim<nDim; ++iDim) {
+      const passivedouble val = SU2_TYPE::GetValue(coor[i*nDim+iDim]);
+      coorMin[iDim] = min(coorMin[iDim], val);
+      coorMax[iDim] = max(coorMax[iDim], val);
+    }
+  }
+
+  /* Compute the Morton code of every query point. The coordinates are scaled
+     to 32 bit integers in 2D and 21 bit integers in 3D, such that the
+     interleaved code fits in 64 bits. */
+  vector<uint64_t> mortonCodes(nQueries);
+
+  const passivedouble maxScaled = (nDim == 3) ? 2097151.0 : 2147483647.0;
+  passivedouble scale[3] = {0.0, 0.0, 0.0};
+  for(unsigned short iDim=0; iDim<nDim; ++iDim) {
+    const passivedouble len = coorMax[iDim] - coorMin[iDim];
+    if(len > 0.0) scale[iDim] = maxScaled/len;
+  }
+
+  for(unsigned long i=0; i<nQueries; ++i) {
+    uint64_t code = 0;
+    for(unsigned short iDim=0; iDim<nDim; ++iDim) {
+      const passivedouble val = (SU2_TYPE::GetValue(coor[i*nDim+iDim])
+                              -  coorMin[iDim])*scale[iDim];
+      const uint64_t intCoor = (uint64_t) val;
+      if(nDim == 3) code |= SpreadBits3D(intCoor) << iDim;
+      else          code |= SpreadBits2D(intCoor) << iDim;
+    }
+    mortonCodes[i] = code;
+  }
+
+  /* Determine the order in which the queries are processed by sorting
+     the query indices according to their Morton codes. */
+  vector<unsigned long> queryOrder(nQueries);
+  for(unsigned long i=0; i<nQueries; ++i) queryOrder[i] = i;
+
+  sort(queryOrder.begin(), queryOrder.end(),
+       [&mortonCodes](unsigned long i0, unsigned long i1) {
+         return mortonCodes[i0] < mortonCodes[i1];});
+
+  return queryOrder;
+}
 
 void CADTBaseClass::BuildADT(unsigned short  nDim,
                              unsigned long   nPoints,
@@ -211,3 +292,43 @@ void CADTBaseClass::BuildADT(unsigned short  nDim,
     for(unsigned long i=0; i<nPointIDs[nLeavesToDivide]; ++i) pointIDs[i]  = pointIDsNew[i];
   }
 }
+
+void CADTBaseClass::UpdateBoundingBoxes(const su2double *coor) {
+
+  /* Return immediately if the tree is empty. */
+  if( isEmpty ) return;
+
+  /*--- Loop backward over the leaves. Child leaves are always created after
+        their parent in BuildADT, hence this loop updates the tree bottom-up.
+        The bounding box of a leaf is the union of the boxes of its children,
+        because the children partition the points of the leaf. ---*/
+  for(unsigned long mm=nLeaves; mm--; ) {
+    CADTNodeClass &leaf = leaves[mm];
+
+    for(unsigned short k=0; k<2; ++k) {
+
+      /* Determine the bounding box of the child, which is the point itself
+         for a terminal child. */
+      const su2double *xMinChild, *xMaxChild;
+      if( leaf.childrenAreTerminal[k] ) {
+        xMinChild = xMaxChild = coor + nDimADT*leaf.children[k];
+      }
+      else {
+        xMinChild = leaves[leaf.children[k]].xMin;
+        xMaxChild = leaves[leaf.children[k]].xMax;
+      }
+
+      /* Initialize the box from the first child, merge the second one. */
+      for(unsigned short l=0; l<nDimADT; ++l) {
+        if(k == 0) {
+          leaf.xMin[l] = xMinChild[l];
+          leaf.xMax[l] = xMaxChild[l];
+        }
+        else {
+          leaf.xMin[l] = min(leaf.xMin[l], xMinChild[l]);
+          leaf.xMax[l] = max(leaf.xMax[l], xMaxChild[l]);
+        }
+      }
+    }
+  }
+}
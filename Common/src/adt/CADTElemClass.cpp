@@ -42,8 +42,10 @@ CADTElemClass::CADTElemClass(unsigned short         val_nDim,
                              vector<unsigned long>  &val_elemID,
                              const bool             globalTree) {
 
-  /* Copy the dimension of the problem into nDim. */
+  /* Copy the dimension of the problem into nDim and store what kind
+     of tree is built. */
   nDim = val_nDim;
+  isGlobalTree = globalTree;
 
   /* Allocate some thread-safe working variables if required. */
 #ifdef HAVE_OMP
@@ -96,9 +98,18 @@ CADTElemClass::CADTElemClass(unsigned short         val_nDim,
     /*--- Gather the coordinates of the points on all ranks. ---*/
     int sizeGlobal = displs.back() + recvCounts.back();
 
-    coorPoints.resize(sizeGlobal);
-    SU2_MPI::Allgatherv(val_coor.data(), sizeLocal, MPI_DOUBLE, coorPoints.data(),
-                        recvCounts.data(), displs.data(), MPI_DOUBLE, SU2_MPI::GetComm());
+    /*--- Every rank participates in the gather into a temporary, only the
+          first rank of each node keeps the result, in an array that is
+          shared by all the ranks of the node. ---*/
+    {
+      vector<su2double> bufCoor(sizeGlobal);
+      SU2_MPI::Allgatherv(val_coor.data(), sizeLocal, MPI_DOUBLE, bufCoor.data(),
+                          recvCounts.data(), displs.data(), MPI_DOUBLE, SU2_MPI::GetComm());
+
+      coorPoints.Allocate(sizeGlobal, true);
+      if( coorPoints.IsOwner() ) copy(bufCoor.begin(), bufCoor.end(), coorPoints.data());
+      coorPoints.Sync();
+    }
 
     /*--- Determine the number of elements per rank and make them
           available to all ranks. ---*/
@@ -147,10 +158,15 @@ CADTElemClass::CADTElemClass(unsigned short         val_nDim,
     /*--- Gather the element connectivity on all ranks. ---*/
     sizeGlobal = displs.back() + recvCounts.back();
 
-    elemConns.resize(sizeGlobal);
+    {
+      vector<unsigned long> bufConn(sizeGlobal);
+      SU2_MPI::Allgatherv(val_connElem.data(), sizeLocal, MPI_UNSIGNED_LONG, bufConn.data(),
+                          recvCounts.data(), displs.data(), MPI_UNSIGNED_LONG, SU2_MPI::GetComm());
 
-    SU2_MPI::Allgatherv(val_connElem.data(), sizeLocal, MPI_UNSIGNED_LONG, elemConns.data(),
-                        recvCounts.data(), displs.data(), MPI_UNSIGNED_LONG, SU2_MPI::GetComm());
+      elemConns.Allocate(sizeGlobal, true);
+      if( elemConns.IsOwner() ) copy(bufConn.begin(), bufConn.end(), elemConns.data());
+      elemConns.Sync();
+    }
   }
     else {
 
@@ -159,8 +175,10 @@ CADTElemClass::CADTElemClass(unsigned short         val_nDim,
     int rank;
     SU2_MPI::Comm_rank(SU2_MPI::GetComm(), &rank);
 
-    coorPoints   = val_coor;
-    elemConns    = val_connElem;
+    coorPoints.Allocate(val_coor.size(), false);
+    copy(val_coor.begin(), val_coor.end(), coorPoints.data());
+    elemConns.Allocate(val_connElem.size(), false);
+    copy(val_connElem.begin(), val_connElem.end(), elemConns.data());
     elemVTK_Type = val_VTKElem;
     localMarkers = val_markerID;
     localElemIDs = val_elemID;
@@ -171,8 +189,10 @@ CADTElemClass::CADTElemClass(unsigned short         val_nDim,
 
   /*--- Sequential mode. Copy the data from the arguments into the member
         variables and set the ranks to MASTER_NODE. ---*/
-  coorPoints   = val_coor;
-  elemConns    = val_connElem;
+  coorPoints.Allocate(val_coor.size(), false);
+  copy(val_coor.begin(), val_coor.end(), coorPoints.data());
+  elemConns.Allocate(val_connElem.size(), false);
+  copy(val_connElem.begin(), val_connElem.end(), elemConns.data());
   elemVTK_Type = val_VTKElem;
   localMarkers = val_markerID;
   localElemIDs = val_elemID;
@@ -210,8 +230,32 @@ CADTElemClass::CADTElemClass(unsigned short         val_nDim,
   /*---         these points in this higher dimensional space.             ---*/
   /*--------------------------------------------------------------------------*/
 
-  /* Allocate the memory for the bounding boxes of the elements. */
-  BBoxCoor.resize(2*nDim*nElem);
+  /* Allocate the memory for the bounding boxes of the elements
+     and compute their coordinates. */
+  BBoxCoor.Allocate(2*nDim*nElem, isGlobalTree);
+  ComputeBoundingBoxes();
+
+  /* Build the ADT of the bounding boxes. */
+  BuildADT(2*nDim, nElem, BBoxCoor.data());
+
+  /*--- Reserve the memory for frontLeaves, frontLeavesNew and BBoxTargets,
+        which are needed during the tree search. ---*/
+  for (auto& vec : BBoxTargets) vec.reserve(200);
+  for (auto& vec : FrontLeaves) vec.reserve(200);
+  for (auto& vec : FrontLeavesNew) vec.reserve(200);
+}
+
+void CADTElemClass::ComputeBoundingBoxes(void) {
+
+  const unsigned long nElem = elemVTK_Type.size();
+
+  /*--- When the bounding boxes live in node-shared storage only the owning
+        rank fills them, the final Sync makes them visible to the other
+        ranks of the node. Sync is collective, both paths must reach it. ---*/
+  if( !BBoxCoor.IsOwner() ) {
+    BBoxCoor.Sync();
+    return;
+  }
 
   /*--- Loop over the elements to determine the minimum and maximum coordinates
         of the elements. These coordinates completely define the bounding box,
@@ -252,14 +296,55 @@ CADTElemClass::CADTElemClass(unsigned short         val_nDim,
     }
   }
 
-  /* Build the ADT of the bounding boxes. */
-  BuildADT(2*nDim, nElem, BBoxCoor.data());
+  BBoxCoor.Sync();
+}
 
-  /*--- Reserve the memory for frontLeaves, frontLeavesNew and BBoxTargets,
-        which are needed during the tree search. ---*/
-  for (auto& vec : BBoxTargets) vec.reserve(200);
-  for (auto& vec : FrontLeaves) vec.reserve(200);
-  for (auto& vec : FrontLeavesNew) vec.reserve(200);
+void CADTElemClass::UpdateCoordinates(const vector<su2double> &val_coor) {
+
+  /*--- Bring the new coordinates into coorPoints, mirroring the gather
+        that was carried out when the tree was built. ---*/
+
+#ifdef HAVE_MPI
+  if( isGlobalTree ) {
+
+    /*--- Determine the number of points per rank and the offsets,
+          the topology is fixed but this avoids storing them. ---*/
+    int size;
+    SU2_MPI::Comm_size(SU2_MPI::GetComm(), &size);
+
+    vector<int> recvCounts(size), displs(size);
+    int sizeLocal = (int) val_coor.size();
+
+    SU2_MPI::Allgather(&sizeLocal, 1, MPI_INT, recvCounts.data(), 1,
+                       MPI_INT, SU2_MPI::GetComm());
+    displs[0] = 0;
+    for(int i=1; i<size; ++i) displs[i] = displs[i-1] + recvCounts[i-1];
+
+    if((unsigned long) (displs.back() + recvCounts.back()) != coorPoints.size())
+      SU2_MPI::Error("The number of points changed, the ADT must be rebuilt.", CURRENT_FUNCTION);
+
+    vector<su2double> bufCoor(coorPoints.size());
+    SU2_MPI::Allgatherv(val_coor.data(), sizeLocal, MPI_DOUBLE, bufCoor.data(),
+                        recvCounts.data(), displs.data(), MPI_DOUBLE, SU2_MPI::GetComm());
+
+    if( coorPoints.IsOwner() ) copy(bufCoor.begin(), bufCoor.end(), coorPoints.data());
+    coorPoints.Sync();
+  }
+  else
+#endif
+  {
+    if(val_coor.size() != coorPoints.size())
+      SU2_MPI::Error("The number of points changed, the ADT must be rebuilt.", CURRENT_FUNCTION);
+
+    copy(val_coor.begin(), val_coor.end(), coorPoints.data());
+  }
+
+  if( IsEmpty() ) return;
+
+  /*--- Refit the bounding boxes of the elements and of the leaves of the
+        tree to the new coordinates, the topology of the tree is kept. ---*/
+  ComputeBoundingBoxes();
+  UpdateBoundingBoxes(BBoxCoor.data());
 }
 
 bool CADTElemClass::DetermineContainingElement_impl(vector<unsigned long>& frontLeaves,
@@ -350,14 +435,15 @@ bool CADTElemClass::DetermineContainingElement_impl(vector<unsigned long>& front
   return false;
 }
 
-void CADTElemClass::DetermineNearestElement_impl(vector<CBBoxTargetClass>& BBoxTargets,
-                                                 vector<unsigned long>& frontLeaves,
-                                                 vector<unsigned long>& frontLeavesNew,
-                                                 const su2double *coor,
-                                                 su2double       &dist,
-                                                 unsigned short  &markerID,
-                                                 unsigned long   &elemID,
-                                                 int             &rankID) const {
+unsigned long CADTElemClass::DetermineNearestElement_impl(vector<CBBoxTargetClass>& BBoxTargets,
+                                                          vector<unsigned long>& frontLeaves,
+                                                          vector<unsigned long>& frontLeavesNew,
+                                                          const su2double *coor,
+                                                          su2double       &dist,
+                                                          unsigned short  &markerID,
+                                                          unsigned long   &elemID,
+                                                          int             &rankID,
+                                                          const long      guessID) const {
 
   const bool wasActive = AD::BeginPassive();
 
@@ -378,6 +464,24 @@ void CADTElemClass::DetermineNearestElement_impl(vector<CBBoxTargetClass>& BBoxT
   if(nDim==3) {
   ds = max(fabs(coor[2]-coorBBMin[2]), fabs(coor[2]-coorBBMax[2])); dist += ds*ds;}
 
+  /*--- If a guess of the nearest element is given, compute the distance squared
+        to it. If this distance is smaller than the guaranteed distance of the
+        root element, the guess provides a tighter initial search radius, which
+        prunes the tree traversal below. Initialize the return information from
+        the guess, such that it is the fallback result in case the traversal
+        cannot improve on it. ---*/
+  if(guessID >= 0) {
+    su2double dist2Guess;
+    Dist2ToElement(guessID, coor, dist2Guess);
+    if(dist2Guess <= dist) {
+      jj       = guessID;
+      dist     = dist2Guess;
+      markerID = localMarkers[guessID];
+      elemID   = localElemIDs[guessID];
+      rankID   = ranksOfElems[guessID];
+    }
+  }
+
   /*----------------------------------------------------------------------------*/
   /*--- Step 2: Traverse the tree and store the bounding boxes for which the ---*/
   /*---         possible minimum distance is less than the currently stored  ---*/
@@ -528,6 +632,68 @@ void CADTElemClass::DetermineNearestElement_impl(vector<CBBoxTargetClass>& BBoxT
      the correct value. */
   Dist2ToElement(jj, coor, dist);
   dist = sqrt(dist);
+
+  /* Return the internal index of the nearest element, which can serve as
+     guess for a nearby follow-up query. */
+  return jj;
+}
+
+void CADTElemClass::DetermineNearestElements(const unsigned long nQueries,
+                                             const su2double     *coor,
+                                             su2double           *dist,
+                                             unsigned short      *markerID,
+                                             unsigned long       *elemID,
+                                             int                 *rankID) {
+
+  if(nQueries == 0) return;
+
+  /*----------------------------------------------------------------------------*/
+  /*--- Step 1: Sort the queries along a Morton space-filling curve, such    ---*/
+  /*---         that consecutive queries are close in space and their tree   ---*/
+  /*---         traversals visit largely the same part of the ADT.           ---*/
+  /*----------------------------------------------------------------------------*/
+
+  const auto queryOrder = DetermineMortonOrder(nDim, nQueries, coor);
+
+  /*----------------------------------------------------------------------------*/
+  /*--- Step 2: Carry out the searches in Morton order. Within a chunk of    ---*/
+  /*---         consecutive queries each search is warm started from the     ---*/
+  /*---         element found by the previous query, which provides a tight  ---*/
+  /*---         initial search radius. The chunks are distributed over the   ---*/
+  /*---         threads, hence this function must be called outside of a     ---*/
+  /*---         parallel region.                                             ---*/
+  /*----------------------------------------------------------------------------*/
+
+  /* Chunk size of the queries. It should be large enough to benefit from the
+     spatial coherence of consecutive queries and small enough for dynamic
+     load balancing over the threads. */
+  const unsigned long chunkSize = 256;
+  const unsigned long nChunks   = (nQueries+chunkSize-1)/chunkSize;
+
+  SU2_OMP_PARALLEL {
+    const auto iThread = omp_get_thread_num();
+
+    SU2_OMP_FOR_DYN(1)
+    for(unsigned long iChunk=0; iChunk<nChunks; ++iChunk) {
+
+      const unsigned long iBeg = iChunk*chunkSize;
+      const unsigned long iEnd = min(iBeg+chunkSize, nQueries);
+
+      /* Loop over the queries of this chunk. The first query of the chunk
+         starts from scratch, the others are warm started from the nearest
+         element of the previous query. */
+      long guess = -1;
+      for(unsigned long i=iBeg; i<iEnd; ++i) {
+        const unsigned long iQuery = queryOrder[i];
+        guess = (long) DetermineNearestElement_impl(BBoxTargets[iThread],
+                          FrontLeaves[iThread], FrontLeavesNew[iThread],
+                          coor + iQuery*nDim, dist[iQuery], markerID[iQuery],
+                          elemID[iQuery], rankID[iQuery], guess);
+      }
+    }
+    END_SU2_OMP_FOR
+  }
+  END_SU2_OMP_PARALLEL
 }
 
 bool CADTElemClass::CoorInElement(const unsigned long elemID,
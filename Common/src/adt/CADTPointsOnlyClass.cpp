@@ -114,22 +114,26 @@ CADTPointsOnlyClass::CADTPointsOnlyClass(unsigned short nDim,
   for (auto& vec : FrontLeavesNew) vec.reserve(200);
 }
 
-void CADTPointsOnlyClass::DetermineNearestNode_impl(vector<unsigned long>& frontLeaves,
-                                                    vector<unsigned long>& frontLeavesNew,
-                                                    const su2double *coor,
-                                                    su2double       &dist,
-                                                    unsigned long   &pointID,
-                                                    int             &rankID) const {
+unsigned long CADTPointsOnlyClass::DetermineNearestNode_impl(vector<unsigned long>& frontLeaves,
+                                                             vector<unsigned long>& frontLeavesNew,
+                                                             const su2double *coor,
+                                                             su2double       &dist,
+                                                             unsigned long   &pointID,
+                                                             int             &rankID,
+                                                             const long      guess) const {
 
   const bool wasActive = AD::BeginPassive();
 
   /*--------------------------------------------------------------------------*/
   /*--- Step 1: Initialize the nearest node to the central node of the     ---*/
-  /*---         root leaf. Note that the distance is the distance squared  ---*/
-  /*---         to avoid a sqrt.                                           ---*/
+  /*---         root leaf, or to the guess from a nearby previous query if ---*/
+  /*---         one is given. Note that the distance is the distance       ---*/
+  /*---         squared to avoid a sqrt.                                   ---*/
   /*--------------------------------------------------------------------------*/
 
-  unsigned long kk = leaves[0].centralNodeID, minIndex;
+  unsigned long kk = (guess >= 0) ? (unsigned long) guess
+                                  : leaves[0].centralNodeID;
+  unsigned long minIndex;
   const su2double *coorTarget = coorPoints.data() + nDimADT*kk;
 
   pointID  = localPointIDs[kk];
@@ -252,4 +256,55 @@ void CADTPointsOnlyClass::DetermineNearestNode_impl(vector<unsigned long>& front
      Take the sqrt to obtain the correct value. */
   dist = sqrt(dist);
 
+  /* Return the internal index of the nearest node, which can serve as
+     guess for a nearby follow-up query. */
+  return minIndex;
+}
+
+void CADTPointsOnlyClass::DetermineNearestNodes(const unsigned long nQueries,
+                                                const su2double     *coor,
+                                                su2double           *dist,
+                                                unsigned long       *pointID,
+                                                int                 *rankID) {
+
+  if(nQueries == 0) return;
+
+  /* Sort the queries along a Morton space-filling curve, such that consecutive
+     queries are close in space and their tree traversals visit largely the
+     same part of the ADT. */
+  const auto queryOrder = DetermineMortonOrder(nDimADT, nQueries, coor);
+
+  /* Carry out the searches in Morton order. Within a chunk of consecutive
+     queries each search is warm started from the node found by the previous
+     query, which provides a tight initial search radius. The chunks are
+     distributed over the threads, hence this function must be called outside
+     of a parallel region. The chunk size should be large enough to benefit
+     from the spatial coherence of consecutive queries and small enough for
+     dynamic load balancing over the threads. */
+  const unsigned long chunkSize = 256;
+  const unsigned long nChunks   = (nQueries+chunkSize-1)/chunkSize;
+
+  SU2_OMP_PARALLEL {
+    const auto iThread = omp_get_thread_num();
+
+    SU2_OMP_FOR_DYN(1)
+    for(unsigned long iChunk=0; iChunk<nChunks; ++iChunk) {
+
+      const unsigned long iBeg = iChunk*chunkSize;
+      const unsigned long iEnd = min(iBeg+chunkSize, nQueries);
+
+      /* Loop over the queries of this chunk. The first query of the chunk
+         starts from scratch, the others are warm started from the nearest
+         node of the previous query. */
+      long guess = -1;
+      for(unsigned long i=iBeg; i<iEnd; ++i) {
+        const unsigned long iQuery = queryOrder[i];
+        guess = (long) DetermineNearestNode_impl(FrontLeaves[iThread],
+                          FrontLeavesNew[iThread], coor + iQuery*nDimADT,
+                          dist[iQuery], pointID[iQuery], rankID[iQuery], guess);
+      }
+    }
+    END_SU2_OMP_FOR
+  }
+  END_SU2_OMP_PARALLEL
 }
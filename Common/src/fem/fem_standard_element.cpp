@@ -1929,6 +1929,10 @@ CFEMStandardElement::CFEMStandardElement(unsigned short          val_VTK_Type,
   /*--- Copy the function arguments to the member variables. ---*/
   nPoly = val_nPoly;
 
+  /*--- Initialize the 1D tensor-product data. It is only created for
+        quadrilaterals and hexahedra. ---*/
+  nDOFs1D = nIntegration1D = 0;
+
   /*--- Determine the element type and compute the other member variables. ---*/
   switch( VTK_Type ) {
     case LINE:          DataStandardLine();          break;
@@ -2014,6 +2018,24 @@ CFEMStandardElement::CFEMStandardElement(unsigned short          val_VTK_Type,
     }
   }
 
+  /* Create the versions of the transposed operators with the integration
+     weights fused into the columns. The weights then no longer need to be
+     multiplied into the fluxes and source terms in the integration points
+     during the residual computation. */
+  matWeightedBasisIntTrans.resize(lagBasisIntegrationTrans.size());
+  matWeightedDerBasisIntTrans.resize(matDerBasisIntTrans.size());
+
+  ii = 0;
+  for(unsigned short j=0; j<nDOFs; ++j)
+    for(unsigned short i=0; i<nIntegration; ++i, ++ii)
+      matWeightedBasisIntTrans[ii] = wIntegration[i]*lagBasisIntegrationTrans[ii];
+
+  ii = 0;
+  for(unsigned short j=0; j<nDOFs; ++j)
+    for(unsigned short i=0; i<nIntegration; ++i)
+      for(unsigned short iDim=0; iDim<nDim; ++iDim, ++ii)
+        matWeightedDerBasisIntTrans[ii] = wIntegration[i]*matDerBasisIntTrans[ii];
+
   /*--------------------------------------------------------------------------*/
   /*--- Create the data of the derivatives of the basis functions in the   ---*/
   /*--- solution DOFs of the element.                                      ---*/
@@ -2275,6 +2297,20 @@ void CFEMStandardElement::Copy(const CFEMStandardElement &other) {
   matDerBasisSolDOFs  = other.matDerBasisSolDOFs;
   matDerBasisOwnDOFs  = other.matDerBasisOwnDOFs;
   mat2ndDerBasisInt   = other.mat2ndDerBasisInt;
+
+  matWeightedBasisIntTrans    = other.matWeightedBasisIntTrans;
+  matWeightedDerBasisIntTrans = other.matWeightedDerBasisIntTrans;
+
+  nDOFs1D        = other.nDOFs1D;
+  nIntegration1D = other.nIntegration1D;
+
+  lagBasisIntegration1D        = other.lagBasisIntegration1D;
+  lagBasisIntegrationTrans1D   = other.lagBasisIntegrationTrans1D;
+  drLagBasisIntegration1D      = other.drLagBasisIntegration1D;
+  drLagBasisIntegrationTrans1D = other.drLagBasisIntegrationTrans1D;
+
+  lagBasisIntegrationTransWeighted1D   = other.lagBasisIntegrationTransWeighted1D;
+  drLagBasisIntegrationTransWeighted1D = other.drLagBasisIntegrationTransWeighted1D;
 }
 
 void CFEMStandardElement::CreateBasisFunctionsAndMatrixDerivatives(
@@ -2399,6 +2435,57 @@ void CFEMStandardElement::CreateBasisFunctionsAndMatrixDerivatives(
     matDerBasis[ii] = dtLagBasisLoc[i];
 }
 
+void CFEMStandardElement::CreateTensorProductDataVolume(void) {
+
+  /*--- Determine the 1D Gauss-Legendre integration points. The number of
+        points in one direction must be identical to the value used in
+        IntegrationPointsQuadrilateral and IntegrationPointsHexahedron,
+        because the integration rules of these elements are tensor products
+        of the 1D rule. ---*/
+  nIntegration1D = orderExact/2 + 1;
+
+  vector<su2double> GLPoints(nIntegration1D), GLWeights(nIntegration1D);
+  GaussLegendrePoints1D(GLPoints, GLWeights);
+
+  /*--- Compute the 1D Lagrangian basis functions and its derivatives in the
+        1D integration points. As both the DOFs and the integration points of
+        quadrilaterals and hexahedra are tensor products of the corresponding
+        1D distributions, the multi-dimensional basis functions are products
+        of these 1D basis functions. This allows the volume matrix products to
+        be carried out with sum factorization. ---*/
+  vector<su2double> rDOFs1D, matVandermondeInvDummy;
+  LagrangianBasisFunctionAndDerivativesLine(nPoly, GLPoints, nDOFs1D, rDOFs1D,
+                                            matVandermondeInvDummy,
+                                            lagBasisIntegration1D,
+                                            drLagBasisIntegration1D);
+
+  /*--- Create the transpose of the 1D basis functions and its derivatives,
+        which are needed for the multiplication with the transpose of the
+        derivative matrix in the residual computation. ---*/
+  lagBasisIntegrationTrans1D.resize(lagBasisIntegration1D.size());
+  drLagBasisIntegrationTrans1D.resize(drLagBasisIntegration1D.size());
+
+  /*--- Also create the transposed operators with the 1D integration weights
+        fused into the columns. As the multi-dimensional integration weights
+        are tensor products of the 1D weights, applying the weighted 1D
+        operators in all parametric directions reproduces the full quadrature
+        weights without explicit multiplications in the integration points. ---*/
+  lagBasisIntegrationTransWeighted1D.resize(lagBasisIntegration1D.size());
+  drLagBasisIntegrationTransWeighted1D.resize(drLagBasisIntegration1D.size());
+
+  unsigned int ii = 0;
+  for(unsigned short j=0; j<nDOFs1D; ++j) {
+    for(unsigned short i=0; i<nIntegration1D; ++i, ++ii) {
+      const unsigned int ind = i*nDOFs1D + j;
+      lagBasisIntegrationTrans1D[ii]   = lagBasisIntegration1D[ind];
+      drLagBasisIntegrationTrans1D[ii] = drLagBasisIntegration1D[ind];
+
+      lagBasisIntegrationTransWeighted1D[ii]   = GLWeights[i]*lagBasisIntegrationTrans1D[ii];
+      drLagBasisIntegrationTransWeighted1D[ii] = GLWeights[i]*drLagBasisIntegrationTrans1D[ii];
+    }
+  }
+}
+
 void CFEMStandardElement::DataStandardLine(void) {
 
   /*--- Determine the Lagrangian basis functions and its derivatives
@@ -2485,6 +2572,10 @@ void CFEMStandardElement::DataStandardQuadrilateral(void) {
   /*--- Set the VTK_type(s) for this sub element. ---*/
   VTK_Type1 = QUADRILATERAL;
   VTK_Type2 = NONE;
+
+  /*--- Create the 1D basis functions, which allow the volume matrix products
+        to be carried out with sum factorization. ---*/
+  CreateTensorProductDataVolume();
 }
 
 void CFEMStandardElement::DataStandardTetrahedron(void) {
@@ -2731,6 +2822,10 @@ void CFEMStandardElement::DataStandardHexahedron(void) {
   /*--- Set the VTK_type(s) for this sub element. ---*/
   VTK_Type1 = HEXAHEDRON;
   VTK_Type2 = NONE;
+
+  /*--- Create the 1D basis functions, which allow the volume matrix products
+        to be carried out with sum factorization. ---*/
+  CreateTensorProductDataVolume();
 }
 
 void CFEMStandardElement::SubConnTetrahedron(void) {
@@ -31,6 +31,13 @@
 #include "../../include/toolboxes/geometry_toolbox.hpp"
 #include "../../include/toolboxes/ndflattener.hpp"
 
+/*--- Persistent MPI requests are only used with the plain MPI wrapper, the
+ AD builds go through the MeDiPack wrapper which does not support them. ---*/
+
+#if defined(HAVE_MPI) && !defined(CODI_REVERSE_TYPE) && !defined(CODI_FORWARD_TYPE)
+#define HAVE_PERSISTENT_COMMS
+#endif
+
 CGeometry::CGeometry(void) :
   size(SU2_MPI::GetSize()),
   rank(SU2_MPI::GetRank()) {
@@ -64,8 +71,12 @@ CGeometry::~CGeometry(void) {
 
   if (vertex != nullptr) {
     for (iMarker = 0; iMarker < nMarker; iMarker++) {
-      for (iVertex = 0; iVertex < nVertex[iMarker]; iVertex++) {
-        delete vertex[iMarker][iVertex];
+      /*--- When the vertices live in the contiguous per-marker storage only
+       the pointer tables are owned here. ---*/
+      if (vertexStorage.empty()) {
+        for (iVertex = 0; iVertex < nVertex[iMarker]; iVertex++) {
+          delete vertex[iMarker][iVertex];
+        }
       }
       delete [] vertex[iMarker];
     }
@@ -98,11 +109,7 @@ CGeometry::~CGeometry(void) {
 
   /*--- Delete structures for MPI point-to-point communication. ---*/
 
-  delete [] bufD_P2PRecv;
-  delete [] bufD_P2PSend;
-
-  delete [] bufS_P2PRecv;
-  delete [] bufS_P2PSend;
+  FreePersistentP2PComms();
 
   delete [] req_P2PSend;
   delete [] req_P2PRecv;
@@ -364,19 +371,21 @@ void CGeometry::AllocateP2PComms(unsigned short countPerPoint) {
 
   maxCountPerPoint = countPerPoint;
 
-  /*-- Deallocate and reallocate our su2double cummunication memory. ---*/
+  /*--- Free any persistent requests since they reference the old buffers. ---*/
+
+  FreePersistentP2PComms();
 
-  delete [] bufD_P2PSend;
-  bufD_P2PSend = new su2double[maxCountPerPoint*nPoint_P2PSend[nP2PSend]] ();
+  /*-- Reclaim our communication memory from the page-locked staging buffers,
+   they grow monotonically and zero the claimed elements like the plain
+   allocation they replace. ---*/
 
-  delete [] bufD_P2PRecv;
-  bufD_P2PRecv = new su2double[maxCountPerPoint*nPoint_P2PRecv[nP2PRecv]] ();
+  bufD_P2PSend = stageD_P2PSend.Claim<su2double>(maxCountPerPoint*nPoint_P2PSend[nP2PSend]);
 
-  delete [] bufS_P2PSend;
-  bufS_P2PSend = new unsigned short[maxCountPerPoint*nPoint_P2PSend[nP2PSend]] ();
+  bufD_P2PRecv = stageD_P2PRecv.Claim<su2double>(maxCountPerPoint*nPoint_P2PRecv[nP2PRecv]);
 
-  delete [] bufS_P2PRecv;
-  bufS_P2PRecv = new unsigned short[maxCountPerPoint*nPoint_P2PRecv[nP2PRecv]] ();
+  bufS_P2PSend = stageS_P2PSend.Claim<unsigned short>(maxCountPerPoint*nPoint_P2PSend[nP2PSend]);
+
+  bufS_P2PRecv = stageS_P2PRecv.Claim<unsigned short>(maxCountPerPoint*nPoint_P2PRecv[nP2PRecv]);
 
   }
   END_SU2_OMP_MASTER
@@ -384,12 +393,97 @@ void CGeometry::AllocateP2PComms(unsigned short countPerPoint) {
 
 }
 
+void CGeometry::FreePersistentP2PComms() const {
+#ifdef HAVE_PERSISTENT_COMMS
+
+  /*--- The requests must be inactive when they are freed, which is
+   guaranteed here since the buffers are only reallocated (and the class
+   only destructed) when no exchanges are in flight. ---*/
+
+  for (auto& reqs : pers_P2PSend)
+    for (auto& req : reqs.second) SU2_MPI::Request_free(&req);
+  pers_P2PSend.clear();
+
+  for (auto& reqs : pers_P2PRecv)
+    for (auto& req : reqs.second) SU2_MPI::Request_free(&req);
+  pers_P2PRecv.clear();
+
+#endif
+}
+
 void CGeometry::PostP2PRecvs(CGeometry *geometry,
                              const CConfig *config,
                              unsigned short commType,
                              unsigned short countPerPoint,
                              bool val_reverse) const {
 
+#ifdef HAVE_PERSISTENT_COMMS
+
+  /*--- The forward su2double exchanges are the ones that recur on every
+   iteration of the solvers, and they use persistent requests to avoid
+   paying the request setup cost of the non-blocking calls for every
+   message. The requests for each packet size are created once and then
+   simply restarted for all subsequent exchanges. The reverse and the
+   unsigned short comms are infrequent and keep the non-blocking calls. ---*/
+
+  if (!val_reverse && (commType == COMM_TYPE_DOUBLE)) {
+
+    SU2_OMP_MASTER
+    {
+      auto& sendReq = pers_P2PSend[countPerPoint];
+      auto& recvReq = pers_P2PRecv[countPerPoint];
+
+      if (recvReq.empty() && sendReq.empty()) {
+
+        /*--- First exchange with this packet size. Initialize one
+         persistent request per neighbor with the same buffer offsets,
+         counts, and tags as the non-blocking comms below. ---*/
+
+        recvReq.resize(nP2PRecv);
+        sendReq.resize(nP2PSend);
+
+        for (int iRecv = 0; iRecv < nP2PRecv; iRecv++) {
+          auto offset = countPerPoint*nPoint_P2PRecv[iRecv];
+          auto count = countPerPoint*(nPoint_P2PRecv[iRecv+1] - nPoint_P2PRecv[iRecv]);
+          auto source = Neighbors_P2PRecv[iRecv];
+          auto tag = source + 1;
+          SU2_MPI::Recv_init(&(bufD_P2PRecv[offset]), count, MPI_DOUBLE,
+                             source, tag, SU2_MPI::GetComm(), &recvReq[iRecv]);
+        }
+
+        for (int iSend = 0; iSend < nP2PSend; iSend++) {
+          auto offset = countPerPoint*nPoint_P2PSend[iSend];
+          auto count = countPerPoint*(nPoint_P2PSend[iSend+1] - nPoint_P2PSend[iSend]);
+          auto dest = Neighbors_P2PSend[iSend];
+          auto tag = rank + 1;
+          SU2_MPI::Send_init(&(bufD_P2PSend[offset]), count, MPI_DOUBLE,
+                             dest, tag, SU2_MPI::GetComm(), &sendReq[iSend]);
+        }
+
+      }
+
+      /*--- Copy the handles into the shared request arrays so that the
+       generic completion routines can wait on them as usual. Completing
+       a persistent request only deactivates it, so the cached handles
+       remain valid for the next exchange. ---*/
+
+      for (int iRecv = 0; iRecv < nP2PRecv; iRecv++)
+        req_P2PRecv[iRecv] = recvReq[iRecv];
+      for (int iSend = 0; iSend < nP2PSend; iSend++)
+        req_P2PSend[iSend] = sendReq[iSend];
+
+      /*--- Activate all of the recv's in a single call. The sends are
+       started one-by-one in PostP2PSends() as the buffers are loaded. ---*/
+
+      if (nP2PRecv > 0) SU2_MPI::Startall(nP2PRecv, req_P2PRecv);
+    }
+    END_SU2_OMP_MASTER
+
+    return;
+  }
+
+#endif
+
   /*--- Launch the non-blocking recv's first. Note that we have stored
    the counts and sources, so we can launch these before we even load
    the data and send from the neighbor ranks. ---*/
@@ -495,6 +589,20 @@ void CGeometry::PostP2PSends(CGeometry *geometry,
                              int val_iSend,
                              bool val_reverse) const {
 
+#ifdef HAVE_PERSISTENT_COMMS
+
+  /*--- Start the persistent send that was prepared for this message
+   in PostP2PRecvs() as soon as the buffer is loaded. ---*/
+
+  if (!val_reverse && (commType == COMM_TYPE_DOUBLE)) {
+    SU2_OMP_MASTER
+    SU2_MPI::Start(&(req_P2PSend[val_iSend]));
+    END_SU2_OMP_MASTER
+    return;
+  }
+
+#endif
+
   /*--- Post the non-blocking send as soon as the buffer is loaded. ---*/
 
   /*--- In some instances related to the adjoint solver, we need
@@ -859,6 +967,47 @@ void CGeometry::PreprocessPeriodicComms(CGeometry *geometry,
 
   int iRank, iSend, iRecv, ii, jj;
 
+  /*--- Precompute the rotation matrix, rotation center, and translation of
+   each periodic marker and store them in contiguous arrays. The packing
+   loops of the periodic comms need these values for every vertex on every
+   exchange, and this avoids repeating the marker tag lookups and the
+   trigonometry there. ---*/
+
+  PeriodicRotation.resize(config->GetnMarker_All(), nDim*nDim) = su2double(0.0);
+  PeriodicRotCenter.resize(config->GetnMarker_All(), 3) = su2double(0.0);
+  PeriodicCenterTranslation.resize(config->GetnMarker_All(), 3) = su2double(0.0);
+
+  for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
+    if (config->GetMarker_All_KindBC(iMarker) != PERIODIC_BOUNDARY) continue;
+
+    const string Marker_Tag = config->GetMarker_All_TagBound(iMarker);
+    const su2double *center = config->GetPeriodicRotCenter(Marker_Tag);
+    const su2double *angles = config->GetPeriodicRotAngles(Marker_Tag);
+    const su2double *trans  = config->GetPeriodicTranslation(Marker_Tag);
+
+    for (unsigned short iDim = 0; iDim < 3; iDim++) {
+      PeriodicRotCenter(iMarker,iDim) = center[iDim];
+      PeriodicCenterTranslation(iMarker,iDim) = center[iDim] + trans[iDim];
+    }
+
+    /*--- Compute the rotation matrix. Note that the implicit
+     ordering is rotation about the x-axis, y-axis, then z-axis. ---*/
+
+    if (nDim == 2) {
+      su2double rotMatrix2D[2][2];
+      GeometryToolbox::RotationMatrix(angles[2], rotMatrix2D);
+      for (unsigned short iDim = 0; iDim < 2; iDim++)
+        for (unsigned short jDim = 0; jDim < 2; jDim++)
+          PeriodicRotation(iMarker,iDim*2+jDim) = rotMatrix2D[iDim][jDim];
+    } else {
+      su2double rotMatrix3D[3][3];
+      GeometryToolbox::RotationMatrix(angles[0], angles[1], angles[2], rotMatrix3D);
+      for (unsigned short iDim = 0; iDim < 3; iDim++)
+        for (unsigned short jDim = 0; jDim < 3; jDim++)
+          PeriodicRotation(iMarker,iDim*3+jDim) = rotMatrix3D[iDim][jDim];
+    }
+  }
+
   /*--- Create some temporary structures for tracking sends/recvs. ---*/
 
   int *nPoint_Send_All = new int[size+1]; nPoint_Send_All[0] = 0;
@@ -1399,6 +1548,10 @@ void CGeometry::SetEdges(void) {
     }
   }
 
+  /*--- The compact index build stores the edge endpoints in 32 bits. ---*/
+  if (nPoint > numeric_limits<su2localidx>::max())
+    SU2_MPI::Error("The number of local points exceeds the range of the compact index build.", CURRENT_FUNCTION);
+
   edges = new CEdge(nEdge,nDim);
 
   for (auto iPoint = 0ul; iPoint < nPoint; iPoint++) {
@@ -1411,6 +1564,47 @@ void CGeometry::SetEdges(void) {
   }
 }
 
+void CGeometry::SortEdgesForLocality(void) {
+
+  if (nEdge == 0) return;
+
+  /*--- Sort the edges lexicographically by their end points (SetEdges always
+   * stores the smaller point first). The coloring preserves the relative order
+   * of the edges it groups, hence within each color group the point data is
+   * then visited with (mostly) increasing addresses. ---*/
+
+  vector<unsigned long> order(nEdge);
+  for (auto iEdge = 0ul; iEdge < nEdge; iEdge++) order[iEdge] = iEdge;
+
+  sort(order.begin(), order.end(),
+    [&](unsigned long iEdge, unsigned long jEdge) {
+      if (edges->GetNode(iEdge,0) != edges->GetNode(jEdge,0))
+        return edges->GetNode(iEdge,0) < edges->GetNode(jEdge,0);
+      return edges->GetNode(iEdge,1) < edges->GetNode(jEdge,1);
+    }
+  );
+
+  /*--- Apply the permutation to the edge connectivity. ---*/
+
+  vector<unsigned long> oldNodes(2*nEdge), newIndex(nEdge);
+  for (auto iEdge = 0ul; iEdge < nEdge; iEdge++) {
+    oldNodes[2*iEdge] = edges->GetNode(iEdge,0);
+    oldNodes[2*iEdge+1] = edges->GetNode(iEdge,1);
+  }
+  for (auto iEdge = 0ul; iEdge < nEdge; iEdge++) {
+    edges->SetNodes(iEdge, oldNodes[2*order[iEdge]], oldNodes[2*order[iEdge]+1]);
+    newIndex[order[iEdge]] = iEdge;
+  }
+
+  /*--- Update the edge indices stored in the points. ---*/
+
+  for (auto iPoint = 0ul; iPoint < nPoint; iPoint++) {
+    for (auto iNode = 0u; iNode < nodes->GetnPoint(iPoint); iNode++) {
+      nodes->SetEdge(iPoint, newIndex[nodes->GetEdge(iPoint, iNode)], iNode);
+    }
+  }
+}
+
 void CGeometry::SetFaces(void) {
   //  unsigned long iPoint, jPoint, iFace;
   //  unsigned short jNode, iNode;
@@ -3447,8 +3641,40 @@ bool CGeometry::GetRadialNeighbourhood(const unsigned long iElem_global,
   return finished;
 }
 
+void CGeometry::SetElemTypeIndex()
+{
+  /*--- Counting sort of the elements by VTK type, the relative order
+   within each type is preserved. ---*/
+
+  unsigned long count[N_SEGREGATED_ELEM_TYPES] = {0};
+
+  for (unsigned long iElem=0; iElem<nElem; ++iElem) {
+    const auto typePos = GetElemTypePosition(elem[iElem]->GetVTK_Type());
+    if (typePos == N_SEGREGATED_ELEM_TYPES)
+      SU2_MPI::Error("Unrecognized volume element type.", CURRENT_FUNCTION);
+    ++count[typePos];
+  }
+
+  elemTypeOffset[0] = 0;
+  for (unsigned short iType=0; iType<N_SEGREGATED_ELEM_TYPES; ++iType)
+    elemTypeOffset[iType+1] = elemTypeOffset[iType] + count[iType];
+
+  elemTypeOrder.resize(nElem);
+
+  unsigned long position[N_SEGREGATED_ELEM_TYPES];
+  for (unsigned short iType=0; iType<N_SEGREGATED_ELEM_TYPES; ++iType)
+    position[iType] = elemTypeOffset[iType];
+
+  for (unsigned long iElem=0; iElem<nElem; ++iElem)
+    elemTypeOrder[position[GetElemTypePosition(elem[iElem]->GetVTK_Type())]++] = iElem;
+}
+
 void CGeometry::SetElemVolume()
 {
+  /*--- Group the elements by type so that each range below is
+   processed without per-element dispatch. ---*/
+  const auto& elemOrder = GetElemTypeOrder();
+
   SU2_OMP_PARALLEL
   {
   /*--- Create a bank of elements to avoid instantiating inside loop. ---*/
@@ -3464,35 +3690,47 @@ void CGeometry::SetElemVolume()
     elements[3] = new CHEXA8();
   }
 
-  /*--- Compute and store the volume of each "elem". ---*/
-  SU2_OMP_FOR_DYN(128)
-  for (unsigned long iElem=0; iElem<nElem; ++iElem)
+  /*--- Compute and store the volume of each "elem", one contiguous
+   range of equal-type elements at a time. ---*/
+  for (auto vtkType : {TRIANGLE, QUADRILATERAL, TETRAHEDRON, PYRAMID, PRISM, HEXAHEDRON})
   {
-    /*--- Get the appropriate type of element. ---*/
+    const auto typePos = GetElemTypePosition(vtkType);
+    const auto begin = elemTypeOffset[typePos];
+    const auto end = elemTypeOffset[typePos+1];
+    if (begin == end) continue;
+
+    /*--- Get the appropriate type of element and its number of nodes. ---*/
     CElement* element = nullptr;
-    switch (elem[iElem]->GetVTK_Type()) {
-      case TRIANGLE:      element = elements[0]; break;
-      case QUADRILATERAL: element = elements[1]; break;
-      case TETRAHEDRON:   element = elements[0]; break;
-      case PYRAMID:       element = elements[1]; break;
-      case PRISM:         element = elements[2]; break;
-      case HEXAHEDRON:    element = elements[3]; break;
+    unsigned short nNodes = 0;
+    switch (vtkType) {
+      case TRIANGLE:      element = elements[0]; nNodes = N_POINTS_TRIANGLE; break;
+      case QUADRILATERAL: element = elements[1]; nNodes = N_POINTS_QUADRILATERAL; break;
+      case TETRAHEDRON:   element = elements[0]; nNodes = N_POINTS_TETRAHEDRON; break;
+      case PYRAMID:       element = elements[1]; nNodes = N_POINTS_PYRAMID; break;
+      case PRISM:         element = elements[2]; nNodes = N_POINTS_PRISM; break;
+      case HEXAHEDRON:    element = elements[3]; nNodes = N_POINTS_HEXAHEDRON; break;
       default:
         SU2_MPI::Error("Cannot compute the area/volume of a 1D element.",CURRENT_FUNCTION);
     }
-    /*--- Set the nodal coordinates of the element. ---*/
-    for (unsigned short iNode=0; iNode<elem[iElem]->GetnNodes(); ++iNode) {
-      unsigned long node_idx = elem[iElem]->GetNode(iNode);
-      for (unsigned short iDim=0; iDim<nDim; ++iDim) {
-        su2double coord = nodes->GetCoord(node_idx, iDim);
-        element->SetRef_Coord(iNode, iDim, coord);
+
+    SU2_OMP_FOR_DYN(128)
+    for (auto iOrder=begin; iOrder<end; ++iOrder)
+    {
+      const auto iElem = elemOrder[iOrder];
+      /*--- Set the nodal coordinates of the element. ---*/
+      for (unsigned short iNode=0; iNode<nNodes; ++iNode) {
+        unsigned long node_idx = elem[iElem]->GetNode(iNode);
+        for (unsigned short iDim=0; iDim<nDim; ++iDim) {
+          su2double coord = nodes->GetCoord(node_idx, iDim);
+          element->SetRef_Coord(iNode, iDim, coord);
+        }
       }
+      /*--- Compute ---*/
+      if(nDim==2) elem[iElem]->SetVolume(element->ComputeArea());
+      else        elem[iElem]->SetVolume(element->ComputeVolume());
     }
-    /*--- Compute ---*/
-    if(nDim==2) elem[iElem]->SetVolume(element->ComputeArea());
-    else        elem[iElem]->SetVolume(element->ComputeVolume());
+    END_SU2_OMP_FOR
   }
-  END_SU2_OMP_FOR
 
   delete elements[0];
   delete elements[1];
@@ -3733,6 +3971,50 @@ const su2vector<unsigned long>& CGeometry::GetTransposeSparsePatternMap(Connecti
   return pattern.transposePtr();
 }
 
+namespace {
+/*--- Measure the relative cost of each group of edges of each color by timing
+ * sweeps of a representative gather kernel (the coordinates of the edge points
+ * and of their neighbors) over the actual mesh data. This is a portable proxy
+ * for hardware counters, groups whose stencils miss the caches more often take
+ * longer. The first sweep warms the caches and is discarded, the remaining
+ * timings are reduced with a min to filter out interference. ---*/
+void MeasureEdgeGroupCosts(const CCompressedSparsePatternUL& coloring, unsigned long groupSize,
+                           const CPoint* nodes, const CEdge* edges,
+                           vector<vector<passivedouble> >& groupCost) {
+  constexpr int nSweep = 4;
+
+  passivedouble acc = 0.0;
+
+  for (auto iColor = 0ul; iColor < coloring.getOuterSize(); ++iColor) {
+    const auto colorSize = coloring.getNumNonZeros(iColor);
+    const auto colorEdges = coloring.innerIdx(iColor);
+    const auto nGroup = groupCost[iColor].size();
+
+    for (auto iGroup = 0ul; iGroup < nGroup; ++iGroup) {
+      const auto grpEnd = min<unsigned long>(colorSize, (iGroup+1)*groupSize);
+      passivedouble best = numeric_limits<passivedouble>::max();
+
+      for (int iSweep = 0; iSweep < nSweep; ++iSweep) {
+        const passivedouble tick = SU2_MPI::Wtime();
+        for (auto k = iGroup*groupSize; k < grpEnd; ++k) {
+          const auto iEdge = colorEdges[k];
+          for (int iNode = 0; iNode < 2; ++iNode) {
+            const auto iPoint = edges->GetNode(iEdge, iNode);
+            acc += SU2_TYPE::GetValue(nodes->GetCoord(iPoint, 0));
+            for (auto jPoint : nodes->GetPoints(iPoint))
+              acc += SU2_TYPE::GetValue(nodes->GetCoord(jPoint, 0));
+          }
+        }
+        if (iSweep > 0) best = min(best, SU2_MPI::Wtime() - tick);
+      }
+      groupCost[iColor][iGroup] = best;
+    }
+  }
+  /*--- Prevent the compiler from optimizing the sweeps away. ---*/
+  volatile passivedouble sink = acc; (void)sink;
+}
+}
+
 const CCompressedSparsePatternUL& CGeometry::GetEdgeColoring(su2double* efficiency)
 {
   /*--- Check for dry run mode with dummy geometry. ---*/
@@ -3768,7 +4050,102 @@ const CCompressedSparsePatternUL& CGeometry::GetEdgeColoring(su2double* efficien
     /*--- If the coloring fails use the natural coloring. This is a
      *    "soft" failure as this "bad" coloring should be detected
      *    downstream and a fallback strategy put in place. ---*/
-    if (edgeColoring.empty()) SetNaturalEdgeColoring();
+    if (edgeColoring.empty()) {
+      SetNaturalEdgeColoring();
+    }
+    else {
+      /*--- Estimate the relative cost of each group of edges from the size
+       *    of the stencils involved, and derive a chunk size for the dynamic
+       *    schedule of the edge loops of each color. Colors whose groups have
+       *    nearly uniform cost are dispatched in larger chunks to reduce the
+       *    scheduling overhead, while colors with significant cost variation
+       *    (e.g. mixed prism/tet boundary layers) are dispatched one group at
+       *    a time so that the threads can balance the load. Chunks need to be
+       *    multiples of the group size since edges within a group may share
+       *    points. ---*/
+
+      const auto nColor = edgeColoring.getOuterSize();
+      vector<vector<passivedouble> > groupCost(nColor);
+
+      for (auto iColor = 0ul; iColor < nColor; ++iColor) {
+        const auto colorSize = edgeColoring.getNumNonZeros(iColor);
+        const auto colorEdges = edgeColoring.innerIdx(iColor);
+        const auto nGroup = (colorSize + edgeColorGroupSize - 1) / edgeColorGroupSize;
+        groupCost[iColor].resize(nGroup);
+
+        for (auto iGroup = 0ul; iGroup < nGroup; ++iGroup) {
+          const auto grpEnd = min<unsigned long>(colorSize, (iGroup+1)*edgeColorGroupSize);
+          passivedouble cost = 0.0;
+          for (auto k = iGroup*edgeColorGroupSize; k < grpEnd; ++k) {
+            const auto iEdge = colorEdges[k];
+            cost += nodes->GetnPoint(edges->GetNode(iEdge,0)) +
+                    nodes->GetnPoint(edges->GetNode(iEdge,1));
+          }
+          groupCost[iColor][iGroup] = cost;
+        }
+      }
+
+      if (edgeColorCalibration) {
+        /*--- Replace the estimates with measured sweep timings and greedily
+         *    dispatch the most expensive groups of each color first, which
+         *    reduces the tail imbalance of the dynamic schedule. Groups of
+         *    the same color do not share points so their relative order is
+         *    free, except that a possible partial group has to remain last
+         *    to keep the dispatch windows aligned with the group grid. ---*/
+
+        MeasureEdgeGroupCosts(edgeColoring, edgeColorGroupSize, nodes, edges, groupCost);
+
+        su2vector<unsigned long> outerPtr(nColor+1);
+        su2vector<unsigned long> innerIdx(edgeColoring.getNumNonZeros());
+        outerPtr(0) = 0;
+
+        for (auto iColor = 0ul; iColor < nColor; ++iColor) {
+          const auto colorSize = edgeColoring.getNumNonZeros(iColor);
+          const auto colorEdges = edgeColoring.innerIdx(iColor);
+          auto& cost = groupCost[iColor];
+          const auto nGroup = cost.size();
+          const auto nFull = nGroup - (colorSize % edgeColorGroupSize != 0);
+
+          vector<unsigned long> order(nGroup);
+          for (auto iGroup = 0ul; iGroup < nGroup; ++iGroup) order[iGroup] = iGroup;
+          stable_sort(order.begin(), order.begin()+nFull,
+                      [&cost](unsigned long i, unsigned long j) {return cost[i] > cost[j];});
+
+          auto pos = outerPtr(iColor);
+          vector<passivedouble> newCost(nGroup);
+          for (auto iGroup = 0ul; iGroup < nGroup; ++iGroup) {
+            const auto g = order[iGroup];
+            const auto grpEnd = min<unsigned long>(colorSize, (g+1)*edgeColorGroupSize);
+            for (auto k = g*edgeColorGroupSize; k < grpEnd; ++k) innerIdx(pos++) = colorEdges[k];
+            newCost[iGroup] = cost[g];
+          }
+          cost = move(newCost);
+          outerPtr(iColor+1) = pos;
+        }
+        edgeColoring = CCompressedSparsePatternUL(move(outerPtr), move(innerIdx));
+      }
+
+      edgeColorChunkSizes.resize(nColor);
+
+      for (auto iColor = 0ul; iColor < nColor; ++iColor) {
+        passivedouble maxCost = 0.0, totalCost = 0.0;
+        for (auto cost : groupCost[iColor]) {
+          maxCost = max(maxCost, cost);
+          totalCost += cost;
+        }
+        const auto nGroup = groupCost[iColor].size();
+
+        /*--- Allow chunks of multiple groups when the cost is uniform,
+         *    targetting enough chunks per thread for the dynamic schedule
+         *    to remain effective against the residual variation. ---*/
+
+        unsigned long mult = 1;
+        if (maxCost*nGroup < 1.1*totalCost)
+          mult = max<unsigned long>(1, nGroup / (8*omp_get_max_threads()));
+
+        edgeColorChunkSizes[iColor] = mult*edgeColorGroupSize;
+      }
+    }
   }
 
   if (efficiency != nullptr) {
@@ -3781,6 +4158,8 @@ void CGeometry::SetNaturalEdgeColoring()
 {
   if (nEdge == 0) return;
   edgeColoring = createNaturalColoring(nEdge);
+  /*--- The adapted chunk sizes of a previous coloring do not apply. ---*/
+  edgeColorChunkSizes.clear();
   /*--- In parallel, set the group size to nEdge to protect client code. ---*/
   if (omp_get_max_threads() > 1) edgeColorGroupSize = nEdge;
 }
@@ -3864,12 +4243,145 @@ void CGeometry::ColorMGLevels(unsigned short nMGLevels, const CGeometry* const*
   }
 }
 
+namespace {
+
+/*--- Helpers for the on-disk wall distance cache (see GEOMETRY_CACHE). The files
+ are native binary, each rank reads and writes its own partition, and a 64-bit
+ FNV-1a hash of the meshes and of the config options that influence the distances
+ guards against stale caches (a mismatch simply triggers recomputation). ---*/
+
+const unsigned int WALL_DIST_CACHE_MAGIC = 0x53325744;  /* "S2WD" */
+const unsigned int WALL_DIST_CACHE_VERSION = 1;
+
+void HashCombine(unsigned long& key, const void* data, size_t nBytes) {
+  const auto* bytes = static_cast<const unsigned char*>(data);
+  for (size_t i = 0; i < nBytes; ++i) {
+    key ^= bytes[i];
+    key *= 1099511628211ul;
+  }
+}
+
+template <class T>
+void HashCombine(unsigned long& key, const T& val) { HashCombine(key, &val, sizeof(T)); }
+
+void HashCombine(unsigned long& key, const string& val) { HashCombine(key, val.data(), val.size()); }
+
+unsigned long WallDistanceCacheKey(const CConfig* const* config_container, CGeometry**** geometry_container,
+                                   int nZone, int iInst) {
+  unsigned long key = 14695981039346656037ul;
+  HashCombine(key, WALL_DIST_CACHE_VERSION);
+  HashCombine(key, SU2_MPI::GetSize());
+  HashCombine(key, SU2_MPI::GetRank());
+  HashCombine(key, nZone);
+
+  /*--- The distances in one zone depend on the mesh, the partitioning (validated
+   via the local point count), and the set of viscous walls of every zone. ---*/
+  for (int iZone = 0; iZone < nZone; ++iZone) {
+    const CConfig* config = config_container[iZone];
+    const CGeometry* geometry = geometry_container[iZone][iInst][MESH_0];
+    HashCombine(key, config->GetMesh_FileName());
+    HashCombine(key, geometry->GetnDim());
+    HashCombine(key, geometry->GetGlobal_nPointDomain());
+    HashCombine(key, geometry->GetnPoint());
+    for (unsigned short iMarker = 0; iMarker < config->GetnMarker_All(); ++iMarker) {
+      if (config->GetViscous_Wall(iMarker))
+        HashCombine(key, config->GetMarker_All_TagBound(iMarker));
+    }
+  }
+  return key;
+}
+
+string WallDistanceCacheName(const CConfig* config, int iZone) {
+  return config->GetMesh_FileName() + ".wdc_z" + to_string(iZone) +
+         "_r" + to_string(SU2_MPI::GetRank()) + ".bin";
+}
+
+} // namespace
+
+bool CGeometry::ReadWallDistanceCache(const string& fileName, unsigned long expectedKey, bool& allEmpty) {
+
+  ifstream file(fileName, ios::binary);
+  if (!file.good()) return false;
+
+  unsigned int magic = 0, version = 0, empty = 0;
+  unsigned long key = 0, nPointFile = 0;
+  file.read(reinterpret_cast<char*>(&magic), sizeof(magic));
+  file.read(reinterpret_cast<char*>(&version), sizeof(version));
+  file.read(reinterpret_cast<char*>(&key), sizeof(key));
+  file.read(reinterpret_cast<char*>(&nPointFile), sizeof(nPointFile));
+  file.read(reinterpret_cast<char*>(&empty), sizeof(empty));
+
+  if (!file.good() || magic != WALL_DIST_CACHE_MAGIC || version != WALL_DIST_CACHE_VERSION ||
+      key != expectedKey || nPointFile != nPoint) return false;
+
+  vector<passivedouble> dist(nPoint);
+  vector<int> wallRank(nPoint);
+  vector<unsigned short> wallZone(nPoint), wallMarker(nPoint);
+  vector<unsigned long> wallElem(nPoint);
+
+  file.read(reinterpret_cast<char*>(dist.data()), nPoint*sizeof(passivedouble));
+  file.read(reinterpret_cast<char*>(wallRank.data()), nPoint*sizeof(int));
+  file.read(reinterpret_cast<char*>(wallZone.data()), nPoint*sizeof(unsigned short));
+  file.read(reinterpret_cast<char*>(wallMarker.data()), nPoint*sizeof(unsigned short));
+  file.read(reinterpret_cast<char*>(wallElem.data()), nPoint*sizeof(unsigned long));
+  if (!file.good()) return false;
+
+  /*--- Only commit to the nodes once the entire file was read successfully. ---*/
+  for (unsigned long iPoint = 0; iPoint < nPoint; ++iPoint)
+    nodes->SetWall_Distance(iPoint, dist[iPoint], wallRank[iPoint], wallZone[iPoint],
+                            wallMarker[iPoint], wallElem[iPoint]);
+  allEmpty = (empty != 0);
+  return true;
+}
+
+void CGeometry::WriteWallDistanceCache(const string& fileName, unsigned long key, bool allEmpty) const {
+
+  ofstream file(fileName, ios::binary);
+  if (!file.good()) return;
+
+  const unsigned int magic = WALL_DIST_CACHE_MAGIC, version = WALL_DIST_CACHE_VERSION;
+  const unsigned int empty = allEmpty;
+  const unsigned long nPointFile = nPoint;
+  file.write(reinterpret_cast<const char*>(&magic), sizeof(magic));
+  file.write(reinterpret_cast<const char*>(&version), sizeof(version));
+  file.write(reinterpret_cast<const char*>(&key), sizeof(key));
+  file.write(reinterpret_cast<const char*>(&nPointFile), sizeof(nPointFile));
+  file.write(reinterpret_cast<const char*>(&empty), sizeof(empty));
+
+  vector<passivedouble> dist(nPoint);
+  vector<int> wallRank(nPoint);
+  vector<unsigned short> wallZone(nPoint), wallMarker(nPoint);
+  vector<unsigned long> wallElem(nPoint);
+
+  for (unsigned long iPoint = 0; iPoint < nPoint; ++iPoint) {
+    dist[iPoint] = SU2_TYPE::GetValue(nodes->GetWall_Distance(iPoint));
+    wallRank[iPoint] = nodes->GetClosestWall_Rank(iPoint);
+    wallZone[iPoint] = nodes->GetClosestWall_Zone(iPoint);
+    wallMarker[iPoint] = nodes->GetClosestWall_Marker(iPoint);
+    wallElem[iPoint] = nodes->GetClosestWall_Elem(iPoint);
+  }
+
+  file.write(reinterpret_cast<const char*>(dist.data()), nPoint*sizeof(passivedouble));
+  file.write(reinterpret_cast<const char*>(wallRank.data()), nPoint*sizeof(int));
+  file.write(reinterpret_cast<const char*>(wallZone.data()), nPoint*sizeof(unsigned short));
+  file.write(reinterpret_cast<const char*>(wallMarker.data()), nPoint*sizeof(unsigned short));
+  file.write(reinterpret_cast<const char*>(wallElem.data()), nPoint*sizeof(unsigned long));
+}
+
 void CGeometry::ComputeWallDistance(const CConfig* const* config_container, CGeometry ****geometry_container){
 
   int nZone = config_container[ZONE_0]->GetnZone();
   bool allEmpty = true;
   vector<bool> wallDistanceNeeded(nZone, false);
 
+  /*--- The wall distances of static meshes can optionally be cached on disk and
+   restored on subsequent runs of the same case, skipping the construction of the
+   wall ADTs and the nearest-element searches (see GEOMETRY_CACHE). ---*/
+  bool useCache = config_container[ZONE_0]->GetGeometryCache() &&
+                  (config_container[ZONE_0]->GetnTimeInstances() == 1);
+  for (int iZone = 0; iZone < nZone; iZone++)
+    useCache = useCache && !config_container[iZone]->GetDynamic_Grid();
+
   for (int iInst = 0; iInst < config_container[ZONE_0]->GetnTimeInstances(); iInst++){
     for (int iZone = 0; iZone < nZone; iZone++){
 
@@ -3893,16 +4405,61 @@ void CGeometry::ComputeWallDistance(const CConfig* const* config_container, CGeo
         geometry->SetWallDistance(numeric_limits<su2double>::max());
     }
 
+    bool anyNeeded = false;
+    for (int iZone = 0; iZone < nZone; iZone++)
+      anyNeeded = anyNeeded || wallDistanceNeeded[iZone];
+
+    /*--- Try to restore the distances from the cache, all ranks must succeed,
+     otherwise everything is recomputed. No rollback is needed on ranks that did
+     restore their file, the key guarantees the restored values are identical to
+     the recomputed ones. ---*/
+    bool cacheHit = false;
+    unsigned long cacheKey = 0;
+    if (useCache && anyNeeded) {
+      cacheKey = WallDistanceCacheKey(config_container, geometry_container, nZone, iInst);
+      unsigned short localHit = 1;
+      for (int iZone = 0; iZone < nZone; iZone++) {
+        if (!wallDistanceNeeded[iZone]) continue;
+        if (!geometry_container[iZone][iInst][MESH_0]->ReadWallDistanceCache(
+              WallDistanceCacheName(config_container[iZone], iZone), cacheKey, allEmpty))
+          localHit = 0;
+      }
+      unsigned short globalHit = 0;
+      SU2_MPI::Allreduce(&localHit, &globalHit, 1, MPI_UNSIGNED_SHORT, MPI_MIN, SU2_MPI::GetComm());
+      cacheHit = (globalHit != 0);
+      if (cacheHit && (SU2_MPI::GetRank() == MASTER_NODE))
+        cout << "Restored the wall distances from the geometry cache." << endl;
+    }
+
     /*--- Loop over all zones and compute the ADT based on the viscous walls in that zone ---*/
-    for (int iZone = 0; iZone < nZone; iZone++){
-      unique_ptr<CADTElemClass> WallADT = geometry_container[iZone][iInst][MESH_0]->ComputeViscousWallADT(config_container[iZone]);
+    for (int iZone = 0; iZone < nZone && !cacheHit; iZone++){
+      CGeometry* geometry = geometry_container[iZone][iInst][MESH_0];
+      const CConfig* config = config_container[iZone];
+
+      /*--- For dynamic meshes the topology does not change, the ADT is cached in the
+       * geometry and refit to the moved coordinates instead of being rebuilt (and the
+       * wall surfaces re-gathered) on every call. For static meshes the ADT is only
+       * needed here, it is built locally and released at the end of the loop. ---*/
+      unique_ptr<CADTElemClass> localADT;
+      CADTElemClass* WallADT = nullptr;
+
+      if (config->GetDynamic_Grid()){
+        if (!(geometry->wallADT && geometry->UpdateViscousWallADT(geometry->wallADT.get(), config)))
+          geometry->wallADT = geometry->ComputeViscousWallADT(config);
+        WallADT = geometry->wallADT.get();
+      }
+      else {
+        localADT = geometry->ComputeViscousWallADT(config);
+        WallADT = localADT.get();
+      }
+
       if (WallADT && !WallADT->IsEmpty()){
         allEmpty = false;
         /*--- Inner loop over all zones to update the wall distances.
        * It might happen that there is a closer viscous wall in zone iZone for points in zone jZone. ---*/
         for (int jZone = 0; jZone < nZone; jZone++){
           if (wallDistanceNeeded[jZone])
-            geometry_container[jZone][iInst][MESH_0]->SetWallDistance(WallADT.get(), config_container[jZone], iZone);
+            geometry_container[jZone][iInst][MESH_0]->SetWallDistance(WallADT, config_container[jZone], iZone);
         }
       }
     }
@@ -3937,5 +4494,16 @@ void CGeometry::ComputeWallDistance(const CConfig* const* config_container, CGeo
         }
       }
     }
+
+    /*--- Write the cache after the first computation so later runs of the same
+     case can skip the searches (roughness is not cached, it is reapplied from
+     the config above). ---*/
+    if (useCache && anyNeeded && !cacheHit) {
+      for (int iZone = 0; iZone < nZone; iZone++) {
+        if (!wallDistanceNeeded[iZone]) continue;
+        geometry_container[iZone][iInst][MESH_0]->WriteWallDistanceCache(
+            WallDistanceCacheName(config_container[iZone], iZone), cacheKey, allEmpty);
+      }
+    }
   }
 }
@@ -511,6 +511,14 @@ CMultiGridGeometry::CMultiGridGeometry(CGeometry *fine_grid, CConfig *config, un
   SU2_MPI::Allreduce(&nPoint, &Global_nPointCoarse, 1, MPI_UNSIGNED_LONG, MPI_SUM, SU2_MPI::GetComm());
   SU2_MPI::Allreduce(&nPointFine, &Global_nPointFine, 1, MPI_UNSIGNED_LONG, MPI_SUM, SU2_MPI::GetComm());
 
+  /*--- The agglomeration is rank-local, at high rank counts a coarse level can degenerate
+   on some ranks (a handful of interior CVs) even when the global agglomeration rate still
+   looks healthy. Such levels hurt the convergence rate more than they accelerate the
+   solver, detect the smallest partition to disable them below. ---*/
+
+  unsigned long Local_nPointCoarse = nPointDomain, Min_nPointCoarse;
+  SU2_MPI::Allreduce(&Local_nPointCoarse, &Min_nPointCoarse, 1, MPI_UNSIGNED_LONG, MPI_MIN, SU2_MPI::GetComm());
+
   if (iMesh != MESH_0) {
     const su2double factor = 1.5;
     const su2double Coeff = pow(su2double(Global_nPointFine) / Global_nPointCoarse, 1.0 / nDim);
@@ -520,9 +528,16 @@ CMultiGridGeometry::CMultiGridGeometry(CGeometry *fine_grid, CConfig *config, un
 
   const su2double ratio = su2double(Global_nPointFine) / su2double(Global_nPointCoarse);
 
+  const bool degenerate = (Min_nPointCoarse < config->GetMG_MinPointsPerRank());
+
   if (((nDim == 2) && (ratio < 2.5)) ||
-      ((nDim == 3) && (ratio < 2.5))) {
+      ((nDim == 3) && (ratio < 2.5)) ||
+      degenerate) {
     config->SetMGLevels(iMesh-1);
+    if (degenerate && (rank == MASTER_NODE)) {
+      cout << "MG level " << iMesh << " disabled, a rank was left with " << Min_nPointCoarse
+           << " interior CVs (the partitions are too small to coarsen further)." << endl;
+    }
   }
   else if (rank == MASTER_NODE) {
     PrintingToolbox::CTablePrinter MGTable(&std::cout);
@@ -837,8 +852,16 @@ void CMultiGridGeometry::SetVertex(const CGeometry *fine_grid, const CConfig *co
     }
   }
 
+  vertexStorage.clear();
+  vertexStorage.resize(nMarker);
   for (iMarker = 0; iMarker < nMarker; iMarker++) {
     vertex[iMarker] = new CVertex* [fine_grid->GetnVertex(iMarker)+1];
+
+    /*--- Contiguous per-marker storage behind the pointer table, the reserve
+     guarantees the pointers below remain valid (the coarse marker cannot
+     have more vertices than the fine one). ---*/
+
+    vertexStorage[iMarker].reserve(fine_grid->GetnVertex(iMarker)+1);
     nVertex[iMarker] = 0;
   }
 
@@ -856,7 +879,8 @@ void CMultiGridGeometry::SetVertex(const CGeometry *fine_grid, const CConfig *co
         for (iMarker = 0; iMarker < fine_grid->GetnMarker(); iMarker ++) {
           if ((fine_grid->nodes->GetVertex(iFinePoint, iMarker) != -1) && (nodes->GetVertex(iCoarsePoint, iMarker) == -1)) {
             iVertex = nVertex[iMarker];
-            vertex[iMarker][iVertex] = new CVertex(iCoarsePoint, nDim);
+            vertexStorage[iMarker].emplace_back(iCoarsePoint, nDim);
+            vertex[iMarker][iVertex] = &vertexStorage[iMarker].back();
             nodes->SetVertex(iCoarsePoint, iVertex, iMarker);
 
             /*--- Set the transformation to apply ---*/
@@ -920,8 +944,107 @@ void CMultiGridGeometry::MatchPeriodic(const CConfig *config, unsigned short val
 
 void CMultiGridGeometry::SetControlVolume(const CGeometry *fine_grid, unsigned short action) {
 
+  /*--- If the fine grid was updated incrementally, only re-agglomerate the volumes and
+   edge normals around the points whose fine-grid metrics changed. ---*/
+
+  if ((action != ALLOCATE) && !fine_grid->GetDualGridUpdated().empty()) {
+
+    SU2_OMP_MASTER {
+
+    const auto& fineUpdated = fine_grid->GetDualGridUpdated();
+
+    /*--- Mark the coarse points with at least one updated child, they are propagated
+     in the same way to the next coarser level. ---*/
+
+    dualGridUpdated.assign(nPoint, 0);
+    for (auto iCoarsePoint = 0ul; iCoarsePoint < nPoint; iCoarsePoint++)
+      for (auto iChildren = 0u; iChildren < nodes->GetnChildren_CV(iCoarsePoint); iChildren++)
+        if (fineUpdated[nodes->GetChildren_CV(iCoarsePoint, iChildren)]) {
+          dualGridUpdated[iCoarsePoint] = 1;
+          break;
+        }
+
+    /*--- Re-agglomerate the volumes of the marked points. ---*/
+
+    for (auto iCoarsePoint = 0ul; iCoarsePoint < nPoint; iCoarsePoint++) {
+      if (!dualGridUpdated[iCoarsePoint]) continue;
+      su2double Coarse_Volume = 0.0;
+      for (auto iChildren = 0u; iChildren < nodes->GetnChildren_CV(iCoarsePoint); iChildren++)
+        Coarse_Volume += fine_grid->nodes->GetVolume(nodes->GetChildren_CV(iCoarsePoint, iChildren));
+      nodes->SetVolume(iCoarsePoint, Coarse_Volume);
+
+      for (auto iChildren = 0u; iChildren < nodes->GetnChildren_CV(iCoarsePoint); iChildren++) {
+        const auto iFinePoint = nodes->GetChildren_CV(iCoarsePoint, iChildren);
+        nodes->SetChildVolumeFrac(iCoarsePoint, iChildren,
+                                  su2mgfloat(fine_grid->nodes->GetVolume(iFinePoint)/Coarse_Volume));
+      }
+    }
+
+    /*--- A changed fine edge has both end points flagged, hence only the coarse edges
+     between two marked points can have changed. Zero them and rebuild them from the
+     fine edges crossing between the two agglomerations. ---*/
+
+    vector<char> edgeUpdated(nEdge, 0);
+    const su2double ZeroArea[MAXNDIM] = {0.0};
+
+    for (auto iCoarsePoint = 0ul; iCoarsePoint < nPoint; iCoarsePoint++) {
+      if (!dualGridUpdated[iCoarsePoint]) continue;
+      for (auto jPoint : nodes->GetPoints(iCoarsePoint)) {
+        if (!dualGridUpdated[jPoint]) continue;
+        const auto CoarseEdge = FindEdge(iCoarsePoint, jPoint);
+        if (!edgeUpdated[CoarseEdge]) {
+          edgeUpdated[CoarseEdge] = 1;
+          edges->SetNormal(CoarseEdge, ZeroArea);
+        }
+      }
+    }
+
+    /*--- The contributions to a coarse edge are accumulated while visiting the end
+     point with the larger index, which is marked for every zeroed edge. ---*/
+
+    for (auto iCoarsePoint = 0ul; iCoarsePoint < nPoint; iCoarsePoint++) {
+      if (!dualGridUpdated[iCoarsePoint]) continue;
+      for (auto iChildren = 0u; iChildren < nodes->GetnChildren_CV(iCoarsePoint); iChildren++) {
+        const auto iFinePoint = nodes->GetChildren_CV(iCoarsePoint, iChildren);
+
+        for (auto iFinePoint_Neighbor : fine_grid->nodes->GetPoints(iFinePoint)) {
+          const auto iParent = fine_grid->nodes->GetParent_CV(iFinePoint_Neighbor);
+          if ((iParent != iCoarsePoint) && (iParent < iCoarsePoint)) {
+
+            const auto CoarseEdge = FindEdge(iParent, iCoarsePoint);
+            if (!edgeUpdated[CoarseEdge]) continue;
+
+            const auto FineEdge = fine_grid->FindEdge(iFinePoint, iFinePoint_Neighbor);
+            const auto Normal = fine_grid->edges->GetNormal(FineEdge);
+
+            if (iFinePoint < iFinePoint_Neighbor) edges->SubNormal(CoarseEdge, Normal);
+            else edges->AddNormal(CoarseEdge, Normal);
+          }
+        }
+      }
+    }
+
+    /*--- Restore the default normal on rebuilt edges with null area. ---*/
+
+    for (auto iEdge = 0ul; iEdge < nEdge; iEdge++) {
+      if (!edgeUpdated[iEdge]) continue;
+      if (GeometryToolbox::Norm(nDim, edges->GetNormal(iEdge)) == 0.0) {
+        su2double DefaultNormal[3] = {EPS*EPS};
+        edges->SetNormal(iEdge, DefaultNormal);
+      }
+    }
+
+    }
+    END_SU2_OMP_MASTER
+    SU2_OMP_BARRIER
+    return;
+  }
+
   SU2_OMP_MASTER {
 
+  /*--- This is a full recompute, the coarser levels follow suit. ---*/
+  dualGridUpdated.clear();
+
   unsigned long iFinePoint, iCoarsePoint, iEdge, iParent;
   long FineEdge, CoarseEdge;
   unsigned short iChildren;
@@ -937,6 +1060,15 @@ void CMultiGridGeometry::SetControlVolume(const CGeometry *fine_grid, unsigned s
       Coarse_Volume += fine_grid->nodes->GetVolume(iFinePoint);
     }
     nodes->SetVolume(iCoarsePoint, Coarse_Volume);
+
+    /*--- Store the volume fractions of the children, they are the weights of the
+     restriction/prolongation transfers and keeping them (in reduced precision)
+     takes the divisions and the volume loads out of the transfer loops. ---*/
+    for (iChildren = 0; iChildren < nodes->GetnChildren_CV(iCoarsePoint); iChildren ++) {
+      iFinePoint = nodes->GetChildren_CV(iCoarsePoint, iChildren);
+      nodes->SetChildVolumeFrac(iCoarsePoint, iChildren,
+                                su2mgfloat(fine_grid->nodes->GetVolume(iFinePoint)/Coarse_Volume));
+    }
   }
 
   /*--- Update or not the values of faces at the edge ---*/
@@ -989,6 +1121,43 @@ void CMultiGridGeometry::SetControlVolume(const CGeometry *fine_grid, unsigned s
 
 void CMultiGridGeometry::SetBoundControlVolume(const CGeometry *fine_grid, unsigned short action) {
 
+  /*--- If the fine grid was updated incrementally, only re-agglomerate the vertex
+   normals of the marked coarse points (set by SetControlVolume above). ---*/
+
+  if ((action != ALLOCATE) && !fine_grid->GetDualGridUpdated().empty()) {
+
+    SU2_OMP_MASTER {
+
+    su2double Normal[MAXNDIM] = {0.0};
+
+    for (unsigned short iMarker = 0; iMarker < nMarker; iMarker++) {
+      for (unsigned long iVertex = 0; iVertex < nVertex[iMarker]; iVertex++) {
+        const auto iCoarsePoint = vertex[iMarker][iVertex]->GetNode();
+        if (!dualGridUpdated[iCoarsePoint]) continue;
+
+        vertex[iMarker][iVertex]->SetZeroValues();
+
+        for (auto iChildren = 0u; iChildren < nodes->GetnChildren_CV(iCoarsePoint); iChildren++) {
+          const auto iFinePoint = nodes->GetChildren_CV(iCoarsePoint, iChildren);
+          if (fine_grid->nodes->GetVertex(iFinePoint, iMarker) != -1) {
+            const auto FineVertex = fine_grid->nodes->GetVertex(iFinePoint, iMarker);
+            fine_grid->vertex[iMarker][FineVertex]->GetNormal(Normal);
+            vertex[iMarker][iVertex]->AddNormal(Normal);
+          }
+        }
+
+        auto NormalFace = vertex[iMarker][iVertex]->GetNormal();
+        if (GeometryToolbox::Norm(nDim, NormalFace) == 0.0)
+          for (unsigned short iDim = 0; iDim < nDim; iDim++) NormalFace[iDim] = EPS*EPS;
+      }
+    }
+
+    }
+    END_SU2_OMP_MASTER
+    SU2_OMP_BARRIER
+    return;
+  }
+
   SU2_OMP_MASTER {
 
   unsigned long iCoarsePoint, iFinePoint, FineVertex, iVertex;
@@ -61,6 +61,7 @@ CPhysicalGeometry::CPhysicalGeometry() : CGeometry() { }
 CPhysicalGeometry::CPhysicalGeometry(CConfig *config, unsigned short val_iZone, unsigned short val_nZone) : CGeometry() {
 
   edgeColorGroupSize = config->GetEdgeColoringGroupSize();
+  edgeColorCalibration = config->GetEdgeColoringCalibration();
 
   string text_line, Marker_Tag;
   ifstream mesh_file;
@@ -191,6 +192,7 @@ CPhysicalGeometry::CPhysicalGeometry(CGeometry *geometry,
                                      CConfig *config) : CGeometry() {
 
   edgeColorGroupSize = config->GetEdgeColoringGroupSize();
+  edgeColorCalibration = config->GetEdgeColoringCalibration();
 
   /*--- The new geometry class has the same problem dimension/zone. ---*/
 
@@ -808,6 +810,14 @@ void CPhysicalGeometry::DistributeVolumeConnectivity(const CConfig *config,
     Local2GlobalElem[p.second] = p.first;
   }
 
+  /*--- Contiguous range of elements of this type, so that the loops below
+   do not have to scan (and dispatch on) the entire mixed-element mesh. ---*/
+
+  const auto& elemOrder = geometry->GetElemTypeOrder();
+  const auto typePos = GetElemTypePosition(Elem_Type);
+  const auto elemBegin = geometry->GetElemTypeBegin(typePos);
+  const auto elemEnd = geometry->GetElemTypeEnd(typePos);
+
   /*--- We start with the connectivity distributed across all procs in a
    linear partitioning. We need to loop through our local partition
    and decide how many elements we must send to each other rank in order to
@@ -822,27 +832,26 @@ void CPhysicalGeometry::DistributeVolumeConnectivity(const CConfig *config,
   }
   nElem_Send[size] = 0; nElem_Recv[size] = 0;
 
-  for (iElem = 0; iElem < geometry->GetnElem(); iElem++ ) {
-    if (geometry->elem[iElem]->GetVTK_Type() == Elem_Type) {
-      for (iNode = 0; iNode < NODES_PER_ELEMENT; iNode++ ) {
+  for (auto iOrder = elemBegin; iOrder < elemEnd; iOrder++) {
+    iElem = elemOrder[iOrder];
+    for (iNode = 0; iNode < NODES_PER_ELEMENT; iNode++ ) {
 
-        /*--- Get the index of the current point. ---*/
-
-        Global_Index = geometry->elem[iElem]->GetNode(iNode);
+      /*--- Get the index of the current point. ---*/
 
-        /*--- We have the color stored in a map for all local points. ---*/
+      Global_Index = geometry->elem[iElem]->GetNode(iNode);
 
-        iProcessor = Color_List[Global_Index];
+      /*--- We have the color stored in a map for all local points. ---*/
 
-        /*--- If we have not visited this element yet, increment our
-         number of elements that must be sent to a particular proc. ---*/
+      iProcessor = Color_List[Global_Index];
 
-        if ((nElem_Flag[iProcessor] != (int)iElem)) {
-          nElem_Flag[iProcessor] = (int)iElem;
-          nElem_Send[iProcessor+1]++;
-        }
+      /*--- If we have not visited this element yet, increment our
+       number of elements that must be sent to a particular proc. ---*/
 
+      if ((nElem_Flag[iProcessor] != (int)iElem)) {
+        nElem_Flag[iProcessor] = (int)iElem;
+        nElem_Send[iProcessor+1]++;
       }
+
     }
   }
 
@@ -896,43 +905,42 @@ void CPhysicalGeometry::DistributeVolumeConnectivity(const CConfig *config,
   /*--- Loop through our elements and load the elems and their
    additional data that we will send to the other procs. ---*/
 
-  for (iElem = 0; iElem < geometry->GetnElem(); iElem++) {
-    if (geometry->elem[iElem]->GetVTK_Type() == Elem_Type) {
-      for (iNode = 0; iNode < NODES_PER_ELEMENT; iNode++ ) {
+  for (auto iOrder = elemBegin; iOrder < elemEnd; iOrder++) {
+    iElem = elemOrder[iOrder];
+    for (iNode = 0; iNode < NODES_PER_ELEMENT; iNode++ ) {
 
-        /*--- Get the index of the current point. ---*/
+      /*--- Get the index of the current point. ---*/
 
-        Global_Index = geometry->elem[iElem]->GetNode(iNode);
+      Global_Index = geometry->elem[iElem]->GetNode(iNode);
 
-        /*--- We have the color stored in a map for all local points. ---*/
+      /*--- We have the color stored in a map for all local points. ---*/
 
-        iProcessor = Color_List[Global_Index];
+      iProcessor = Color_List[Global_Index];
 
-        /*--- Load connectivity and IDs into the buffer for sending ---*/
+      /*--- Load connectivity and IDs into the buffer for sending ---*/
 
-        if (nElem_Flag[iProcessor] != (int)iElem) {
+      if (nElem_Flag[iProcessor] != (int)iElem) {
 
-          nElem_Flag[iProcessor] = (int)iElem;
-          unsigned long nn = index[iProcessor];
-          unsigned long mm = idIndex[iProcessor];
+        nElem_Flag[iProcessor] = (int)iElem;
+        unsigned long nn = index[iProcessor];
+        unsigned long mm = idIndex[iProcessor];
 
-          /*--- Load the connectivity values. Note that elements are already
-          stored directly based on their global index for the nodes.---*/
+        /*--- Load the connectivity values. Note that elements are already
+        stored directly based on their global index for the nodes.---*/
 
-          for (jNode = 0; jNode < NODES_PER_ELEMENT; jNode++) {
-            connSend[nn] = geometry->elem[iElem]->GetNode(jNode); nn++;
-          }
+        for (jNode = 0; jNode < NODES_PER_ELEMENT; jNode++) {
+          connSend[nn] = geometry->elem[iElem]->GetNode(jNode); nn++;
+        }
 
-          /*--- Global ID for this element. ---*/
+        /*--- Global ID for this element. ---*/
 
-          idSend[mm] = Local2GlobalElem[iElem];
+        idSend[mm] = Local2GlobalElem[iElem];
 
-          /*--- Increment the index by the message length ---*/
+        /*--- Increment the index by the message length ---*/
 
-          index[iProcessor] += NODES_PER_ELEMENT;
-          idIndex[iProcessor]++;
+        index[iProcessor] += NODES_PER_ELEMENT;
+        idIndex[iProcessor]++;
 
-        }
       }
     }
   }
@@ -4695,75 +4703,214 @@ void CPhysicalGeometry::SetPositive_ZArea(CConfig *config) {
 
 void CPhysicalGeometry::SetPoint_Connectivity() {
 
-  vector<vector<unsigned long> > points(nPoint);
+  /*--- Both adjacency structures are built directly in CSR format with a counting
+   pass followed by a fill pass into exact-size flat arrays, instead of growing one
+   vector per point (the reallocation copies of which dominate the peak memory of
+   large loads, and the scattered allocations hurt every downstream consumer). ---*/
 
-  SU2_OMP_PARALLEL
+  /*--- Point-to-element adjacency. ---*/
   {
-  unsigned short Node_Neighbor, iNode, iNeighbor;
-  unsigned long jElem, Point_Neighbor, iPoint, iElem;
+    su2vector<long> elemPtr(nPoint+1);
+    for (unsigned long iPoint = 0; iPoint <= nPoint; iPoint++) elemPtr(iPoint) = 0;
 
-  /*--- Loop over all the elements ---*/
-  SU2_OMP_MASTER
-  {
-    vector<vector<long> > elems(nPoint);
+    for (unsigned long iElem = 0; iElem < nElem; iElem++)
+      for (unsigned short iNode = 0; iNode < elem[iElem]->GetnNodes(); iNode++)
+        ++elemPtr(elem[iElem]->GetNode(iNode)+1);
 
-    for (iElem = 0; iElem < nElem; iElem++) {
+    for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++) elemPtr(iPoint+1) += elemPtr(iPoint);
 
-      /*--- Loop over all the nodes of an element ---*/
-      for (iNode = 0; iNode < elem[iElem]->GetnNodes(); iNode++) {
-        iPoint = elem[iElem]->GetNode(iNode);
-        elems[iPoint].push_back(iElem);
-      }
-    }
-    nodes->SetElems(elems);
+    su2vector<long> elemIdx(elemPtr(nPoint));
+    vector<long> position(elemPtr.data(), elemPtr.data()+nPoint);
+
+    for (unsigned long iElem = 0; iElem < nElem; iElem++)
+      for (unsigned short iNode = 0; iNode < elem[iElem]->GetnNodes(); iNode++)
+        elemIdx(position[elem[iElem]->GetNode(iNode)]++) = iElem;
+
+    nodes->SetElems(CCompressedSparsePatternL(move(elemPtr), move(elemIdx)));
   }
-  END_SU2_OMP_MASTER
-  SU2_OMP_BARRIER
 
-  /*--- Loop over all the points ---*/
+  /*--- Point-to-point adjacency, the neighbors of each point are found twice
+   (once to count, once to fill), both passes run in parallel. ---*/
 
-  SU2_OMP_FOR_DYN(roundUpDiv(nPoint,2*omp_get_max_threads()))
-  for (iPoint = 0; iPoint < nPoint; iPoint++) {
+  su2vector<unsigned long> pointPtr(nPoint+1);
+  su2vector<unsigned long> pointIdx;
+
+  SU2_OMP_PARALLEL
+  {
+  /*--- Thread-local scratch holding the unique neighbors of one point. ---*/
+  vector<unsigned long> neighbors;
+
+  auto FindUniqueNeighbors = [&](unsigned long iPoint) {
+    neighbors.clear();
 
     /*--- Loop over all elements shared by the point ---*/
 
-    for (iElem = 0; iElem < nodes->GetnElem(iPoint); iElem++) {
+    for (unsigned short iElem = 0; iElem < nodes->GetnElem(iPoint); iElem++) {
 
-      jElem = nodes->GetElem(iPoint, iElem);
+      const auto jElem = nodes->GetElem(iPoint, iElem);
 
       /*--- If we find the point iPoint in the surrounding element ---*/
 
-      for (iNode = 0; iNode < elem[jElem]->GetnNodes(); iNode++) {
+      for (unsigned short iNode = 0; iNode < elem[jElem]->GetnNodes(); iNode++) {
 
         if (elem[jElem]->GetNode(iNode) != iPoint) continue;
 
         /*--- Localize the local index of the neighbor of iPoint in the element ---*/
 
-        for (iNeighbor = 0; iNeighbor < elem[jElem]->GetnNeighbor_Nodes(iNode); iNeighbor++) {
-          Node_Neighbor = elem[jElem]->GetNeighbor_Nodes(iNode, iNeighbor);
-          Point_Neighbor = elem[jElem]->GetNode(Node_Neighbor);
+        for (unsigned short iNeighbor = 0; iNeighbor < elem[jElem]->GetnNeighbor_Nodes(iNode); iNeighbor++) {
+          const auto Node_Neighbor = elem[jElem]->GetNeighbor_Nodes(iNode, iNeighbor);
+          const auto Point_Neighbor = elem[jElem]->GetNode(Node_Neighbor);
 
           /*--- Store the point into the point, if it is new ---*/
-          auto End = points[iPoint].end();
-          if (find(points[iPoint].begin(), End, Point_Neighbor) == End)
-            points[iPoint].push_back(Point_Neighbor);
+          const auto End = neighbors.end();
+          if (find(neighbors.begin(), End, Point_Neighbor) == End)
+            neighbors.push_back(Point_Neighbor);
         }
       }
     }
+  };
+
+  /*--- Counting pass. ---*/
+
+  SU2_OMP_FOR_DYN(roundUpDiv(nPoint,2*omp_get_max_threads()))
+  for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++) {
+    FindUniqueNeighbors(iPoint);
+    pointPtr(iPoint+1) = neighbors.size();
 
     /*--- Set the number of neighbors variable, this is important for JST and multigrid in parallel. ---*/
-    nodes->SetnNeighbor(iPoint, points[iPoint].size());
+    nodes->SetnNeighbor(iPoint, neighbors.size());
   }
   END_SU2_OMP_FOR
 
   SU2_OMP_MASTER
-  nodes->SetPoints(points);
+  {
+    pointPtr(0) = 0;
+    for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++) pointPtr(iPoint+1) += pointPtr(iPoint);
+    pointIdx.resize(pointPtr(nPoint));
+  }
+  END_SU2_OMP_MASTER
+  SU2_OMP_BARRIER
+
+  /*--- Fill pass, every point writes to its own exclusive range. ---*/
+
+  SU2_OMP_FOR_DYN(roundUpDiv(nPoint,2*omp_get_max_threads()))
+  for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++) {
+    FindUniqueNeighbors(iPoint);
+    auto position = pointPtr(iPoint);
+    for (auto Point_Neighbor : neighbors) pointIdx(position++) = Point_Neighbor;
+  }
+  END_SU2_OMP_FOR
+
+  SU2_OMP_MASTER
+  nodes->SetPoints(CCompressedSparsePatternUL(move(pointPtr), move(pointIdx)));
   END_SU2_OMP_MASTER
 
   }
   END_SU2_OMP_PARALLEL
 }
 
+void CPhysicalGeometry::SetBoundPoint_Connectivity() {
+
+  /*--- Same CSR construction as SetPoint_Connectivity, restricted to the layer
+   of volume elements that touch a marker (including send-receive markers, so
+   that halo boundary points are covered). Points away from the markers keep
+   empty adjacency rows, which is fine for the marker-only operations of the
+   geometry tools and avoids the volume-sized storage and neighbor searches.
+   The restriction is by element so that the resulting adjacency is symmetric,
+   which SetEdges relies on. ---*/
+
+  vector<char> markerPoint(nPoint, false);
+
+  for (unsigned short iMarker = 0; iMarker < nMarker; iMarker++)
+    for (unsigned long iElem = 0; iElem < nElem_Bound[iMarker]; iElem++)
+      for (unsigned short iNode = 0; iNode < bound[iMarker][iElem]->GetnNodes(); iNode++)
+        markerPoint[bound[iMarker][iElem]->GetNode(iNode)] = true;
+
+  /*--- Flag the elements adjacent to a marker, and with them every point of such
+   an element (the interior neighbors of the marker points need their own rows,
+   otherwise the adjacency would not be symmetric). ---*/
+
+  vector<char> activeElem(nElem, false);
+
+  for (unsigned long iElem = 0; iElem < nElem; iElem++)
+    for (unsigned short iNode = 0; iNode < elem[iElem]->GetnNodes(); iNode++)
+      if (markerPoint[elem[iElem]->GetNode(iNode)]) {
+        activeElem[iElem] = true;
+        break;
+      }
+
+  /*--- Point-to-element adjacency, counted and filled over active elements only. ---*/
+  {
+    su2vector<long> elemPtr(nPoint+1);
+    for (unsigned long iPoint = 0; iPoint <= nPoint; iPoint++) elemPtr(iPoint) = 0;
+
+    for (unsigned long iElem = 0; iElem < nElem; iElem++) {
+      if (!activeElem[iElem]) continue;
+      for (unsigned short iNode = 0; iNode < elem[iElem]->GetnNodes(); iNode++)
+        ++elemPtr(elem[iElem]->GetNode(iNode)+1);
+    }
+
+    for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++) elemPtr(iPoint+1) += elemPtr(iPoint);
+
+    su2vector<long> elemIdx(elemPtr(nPoint));
+    vector<long> position(elemPtr.data(), elemPtr.data()+nPoint);
+
+    for (unsigned long iElem = 0; iElem < nElem; iElem++) {
+      if (!activeElem[iElem]) continue;
+      for (unsigned short iNode = 0; iNode < elem[iElem]->GetnNodes(); iNode++)
+        elemIdx(position[elem[iElem]->GetNode(iNode)]++) = iElem;
+    }
+
+    nodes->SetElems(CCompressedSparsePatternL(move(elemPtr), move(elemIdx)));
+  }
+
+  /*--- Point-to-point adjacency, the neighbor search is the same as in
+   SetPoint_Connectivity, points with no active element get an empty row. ---*/
+
+  su2vector<unsigned long> pointPtr(nPoint+1);
+  vector<unsigned long> neighbors;
+
+  auto FindUniqueNeighbors = [&](unsigned long iPoint) {
+    neighbors.clear();
+
+    for (unsigned short iElem = 0; iElem < nodes->GetnElem(iPoint); iElem++) {
+
+      const auto jElem = nodes->GetElem(iPoint, iElem);
+
+      for (unsigned short iNode = 0; iNode < elem[jElem]->GetnNodes(); iNode++) {
+
+        if (elem[jElem]->GetNode(iNode) != iPoint) continue;
+
+        for (unsigned short iNeighbor = 0; iNeighbor < elem[jElem]->GetnNeighbor_Nodes(iNode); iNeighbor++) {
+          const auto Node_Neighbor = elem[jElem]->GetNeighbor_Nodes(iNode, iNeighbor);
+          const auto Point_Neighbor = elem[jElem]->GetNode(Node_Neighbor);
+
+          const auto End = neighbors.end();
+          if (find(neighbors.begin(), End, Point_Neighbor) == End)
+            neighbors.push_back(Point_Neighbor);
+        }
+      }
+    }
+  };
+
+  pointPtr(0) = 0;
+  for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++) {
+    FindUniqueNeighbors(iPoint);
+    pointPtr(iPoint+1) = pointPtr(iPoint) + neighbors.size();
+    nodes->SetnNeighbor(iPoint, neighbors.size());
+  }
+
+  su2vector<unsigned long> pointIdx(pointPtr(nPoint));
+
+  for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++) {
+    FindUniqueNeighbors(iPoint);
+    auto position = pointPtr(iPoint);
+    for (auto Point_Neighbor : neighbors) pointIdx(position++) = Point_Neighbor;
+  }
+
+  nodes->SetPoints(CCompressedSparsePatternUL(move(pointPtr), move(pointIdx)));
+}
+
 void CPhysicalGeometry::SetRCM_Ordering(CConfig *config) {
 
   /*--- The result is the RCM ordering, during the process it is also used as
@@ -4844,6 +4991,31 @@ void CPhysicalGeometry::SetRCM_Ordering(CConfig *config) {
     Result.push_back(iPoint);
   }
 
+  /*--- Measure the bandwidth reduction achieved by the reordering, i.e. the
+   * maximum index distance between adjacent points, which bounds how far apart
+   * the data of the two points of an edge can be in memory. ---*/
+
+  if (config->GetLocalityReordering()) {
+    vector<unsigned long> InvOrder(nPoint);
+    for (auto iPoint = 0ul; iPoint < nPoint; iPoint++) {
+      InvOrder[Result[iPoint]] = iPoint;
+    }
+    unsigned long Bandwidth[2] = {0, 0};
+    for (auto iPoint = 0ul; iPoint < nPointDomain; iPoint++) {
+      for (const auto jPoint : nodes->GetPoints(iPoint)) {
+        if (jPoint >= nPointDomain) continue;
+        Bandwidth[0] = max(Bandwidth[0], max(iPoint, jPoint) - min(iPoint, jPoint));
+        Bandwidth[1] = max(Bandwidth[1], max(InvOrder[iPoint], InvOrder[jPoint]) -
+                                         min(InvOrder[iPoint], InvOrder[jPoint]));
+      }
+    }
+    unsigned long GlobalBandwidth[2] = {0, 0};
+    SU2_MPI::Allreduce(Bandwidth, GlobalBandwidth, 2, MPI_UNSIGNED_LONG, MPI_MAX, SU2_MPI::GetComm());
+    if (rank == MASTER_NODE)
+      cout << "Graph bandwidth reduced from " << GlobalBandwidth[0]
+           << " to " << GlobalBandwidth[1] << "." << endl;
+  }
+
   /*--- Reset old data structures ---*/
 
   nodes->ResetElems();
@@ -5031,8 +5203,16 @@ void CPhysicalGeometry::SetVertex(const CConfig *config) {
    is the same as in the input file, this is important for Send/Receive part ---*/
 
   vertex = new CVertex**[nMarker];
+  vertexStorage.clear();
+  vertexStorage.resize(nMarker);
   for (iMarker = 0; iMarker < nMarker; iMarker++) {
     vertex[iMarker] = new CVertex* [nVertex[iMarker]];
+
+    /*--- The vertices of a marker are stored contiguously so that boundary
+     loops traverse them in order, the reserve guarantees the pointers below
+     remain valid (the count of the previous loop is exact). ---*/
+
+    vertexStorage[iMarker].reserve(nVertex[iMarker]);
     nVertex[iMarker] = 0;
 
     /*--- Initialize the number of Bound Vertex for each Marker ---*/
@@ -5045,7 +5225,8 @@ void CPhysicalGeometry::SetVertex(const CConfig *config) {
 
         if ((nodes->GetVertex(iPoint, iMarker) == -1) || (config->GetMarker_All_KindBC(iMarker) == SEND_RECEIVE)) {
           iVertex = nVertex[iMarker];
-          vertex[iMarker][iVertex] = new CVertex(iPoint, nDim);
+          vertexStorage[iMarker].emplace_back(iPoint, nDim);
+          vertex[iMarker][iVertex] = &vertexStorage[iMarker].back();
 
           if (config->GetMarker_All_KindBC(iMarker) == SEND_RECEIVE) {
             vertex[iMarker][iVertex]->SetRotation_Type(bound[iMarker][iElem]->GetRotation_Type());
@@ -7356,6 +7537,20 @@ void CPhysicalGeometry::FindUniqueNode_PeriodicBound(const CConfig *config) {
 
 void CPhysicalGeometry::SetControlVolume(CConfig *config, unsigned short action) {
 
+#if !defined(CODI_REVERSE_TYPE) && !defined(CODI_FORWARD_TYPE)
+  /*--- After mesh deformation, try to update only the metrics around the points that
+   actually moved instead of recomputing everything (not available with AD, the tape
+   would miss the contributions of the edges that are not recomputed). ---*/
+
+  if ((action != ALLOCATE) && config->GetDeform_IncrementalGridUpdate()) {
+    SU2_OMP_MASTER
+    dualGridIncrementalOK = UpdateControlVolumeIncremental(config);
+    END_SU2_OMP_MASTER
+    SU2_OMP_BARRIER
+    if (dualGridIncrementalOK) return;
+  }
+#endif
+
   /*--- Update values of faces of the edge ---*/
   if (action != ALLOCATE) {
     su2double ZeroArea[MAXNDIM] = {0.0};
@@ -7373,6 +7568,9 @@ void CPhysicalGeometry::SetControlVolume(CConfig *config, unsigned short action)
 
   SU2_OMP_MASTER { /*--- The following is difficult to parallelize with threads. ---*/
 
+  /*--- This is a full recompute, the multigrid levels follow suit. ---*/
+  dualGridUpdated.clear();
+
   su2double my_DomainVolume = 0.0;
   for (auto iElem = 0ul; iElem < nElem; iElem++) {
 
@@ -7515,10 +7713,218 @@ void CPhysicalGeometry::SetControlVolume(CConfig *config, unsigned short action)
     if (Area2 == 0.0) edges->SetNormal(iEdge, DefaultArea);
   }
   END_SU2_OMP_FOR
+
+  /*--- Store the coordinates the metrics were computed with, the next update can
+   then be restricted to the points that moved. ---*/
+
+  if (config->GetDeform_IncrementalGridUpdate()) {
+    SU2_OMP_MASTER {
+    dualGridOldCoord.resize(nPoint, nDim);
+    for (auto iPoint = 0ul; iPoint < nPoint; iPoint++)
+      for (unsigned short iDim = 0; iDim < nDim; iDim++)
+        dualGridOldCoord(iPoint, iDim) = SU2_TYPE::GetValue(nodes->GetCoord(iPoint, iDim));
+    dualGridPointMoved.clear();
+    }
+    END_SU2_OMP_MASTER
+    SU2_OMP_BARRIER
+  }
+}
+
+bool CPhysicalGeometry::UpdateControlVolumeIncremental(CConfig *config) {
+
+  const passivedouble tol = SU2_TYPE::GetValue(config->GetDeform_IncrementalTol());
+
+  /*--- Detect the points that moved beyond the tolerance since the last update. The halo
+   coordinates are communicated together with the owned ones, hence all ranks see
+   consistent displacements. A full recompute must have stored the coordinates first. ---*/
+
+  unsigned long nMoved = 0;
+  bool myOK = (dualGridOldCoord.rows() == nPoint);
+
+  if (myOK) {
+    dualGridPointMoved.assign(nPoint, 0);
+
+    for (auto iPoint = 0ul; iPoint < nPoint; iPoint++) {
+      for (unsigned short iDim = 0; iDim < nDim; iDim++) {
+        if (fabs(SU2_TYPE::GetValue(nodes->GetCoord(iPoint, iDim)) - dualGridOldCoord(iPoint, iDim)) > tol) {
+          dualGridPointMoved[iPoint] = 1;
+          nMoved++;
+          break;
+        }
+      }
+    }
+
+    /*--- When a large part of the grid moved the full recompute is cheaper. ---*/
+
+    myOK = (2*nMoved <= nPoint);
+  }
+
+  /*--- The decision must be collective, the full path communicates differently. ---*/
+
+  unsigned long sendOK = myOK, allOK;
+  SU2_MPI::Allreduce(&sendOK, &allOK, 1, MPI_UNSIGNED_LONG, MPI_MIN, SU2_MPI::GetComm());
+  if (allOK == 0) return false;
+
+  /*--- Mark the elements with at least one moved node, only their metric contributions
+   change, and flag all of their points for the multigrid propagation. ---*/
+
+  vector<unsigned long> affectedElems;
+  dualGridUpdated.assign(nPoint, 0);
+
+  for (auto iElem = 0ul; iElem < nElem; iElem++) {
+    bool affected = false;
+    for (unsigned short iNode = 0; iNode < elem[iElem]->GetnNodes(); iNode++)
+      affected = affected || (dualGridPointMoved[elem[iElem]->GetNode(iNode)] != 0);
+    if (!affected) continue;
+
+    affectedElems.push_back(iElem);
+    for (unsigned short iNode = 0; iNode < elem[iElem]->GetnNodes(); iNode++)
+      dualGridUpdated[elem[iElem]->GetNode(iNode)] = 1;
+  }
+
+  /*--- For each affected element, subtract the contributions computed from the old
+   coordinates and add the ones of the new coordinates. Both passes share the kernel
+   of SetControlVolume, the subtract pass flips the face orientation, which negates
+   the normal contributions, and adds the volumes with negative sign. ---*/
+
+  su2double volumeDiff = 0.0;
+  vector<unsigned long> touchedEdges;
+
+  auto addContributions = [&](unsigned long iElem, bool subtract) {
+
+    const auto nNodes = elem[iElem]->GetnNodes();
+    const su2double sign = subtract? -1.0 : 1.0;
+
+    su2double CoordOld[N_POINTS_MAXIMUM][MAXNDIM];
+    array<const su2double*, N_POINTS_MAXIMUM> Coord;
+
+    for (unsigned short iNode = 0; iNode < nNodes; iNode++) {
+      const auto iPoint = elem[iElem]->GetNode(iNode);
+      if (subtract) {
+        for (unsigned short iDim = 0; iDim < nDim; iDim++)
+          CoordOld[iNode][iDim] = dualGridOldCoord(iPoint, iDim);
+        Coord[iNode] = CoordOld[iNode];
+      }
+      else {
+        Coord[iNode] = nodes->GetCoord(iPoint);
+      }
+    }
+
+    /*--- Compute the element median CG, it is stored only with the new coordinates. ---*/
+
+    su2double CGbuffer[MAXNDIM] = {0.0};
+    const su2double* Coord_Elem_CG;
+    if (subtract) {
+      for (unsigned short iNode = 0; iNode < nNodes; iNode++)
+        for (unsigned short iDim = 0; iDim < nDim; iDim++)
+          CGbuffer[iDim] += Coord[iNode][iDim]/nNodes;
+      Coord_Elem_CG = CGbuffer;
+    }
+    else {
+      Coord_Elem_CG = elem[iElem]->SetCoord_CG(nDim, Coord);
+    }
+
+    for (unsigned short iFace = 0; iFace < elem[iElem]->GetnFaces(); iFace++) {
+
+      unsigned short nEdgesFace = 1;
+
+      su2double Coord_FaceElem_CG[MAXNDIM] = {0.0};
+      if (nDim == 3) {
+        nEdgesFace = elem[iElem]->GetnNodesFace(iFace);
+
+        for (unsigned short iNode = 0; iNode < nEdgesFace; iNode++) {
+          auto NodeFace = elem[iElem]->GetFaces(iFace, iNode);
+          for (unsigned short iDim = 0; iDim < nDim; iDim++)
+            Coord_FaceElem_CG[iDim] += Coord[NodeFace][iDim]/nEdgesFace;
+        }
+      }
+
+      for (unsigned short iEdgesFace = 0; iEdgesFace < nEdgesFace; iEdgesFace++) {
+
+        const auto face_iNode = elem[iElem]->GetFaces(iFace,iEdgesFace);
+        unsigned short face_jNode;
+
+        if (nDim == 2) face_jNode = elem[iElem]->GetFaces(iFace,1);
+        else face_jNode = elem[iElem]->GetFaces(iFace, (iEdgesFace+1)%nEdgesFace);
+
+        const auto face_iPoint = elem[iElem]->GetNode(face_iNode);
+        const auto face_jPoint = elem[iElem]->GetNode(face_jNode);
+
+        /*--- Flipping the orientation in the subtract pass negates the normals. ---*/
+        const bool change_face_orientation = (face_iPoint > face_jPoint) != subtract;
+        const auto iEdge = FindEdge(face_iPoint, face_jPoint);
+
+        su2double Coord_Edge_CG[MAXNDIM] = {0.0};
+        for (unsigned short iDim = 0; iDim < nDim; iDim++) {
+          Coord_Edge_CG[iDim] = 0.5 * (Coord[face_iNode][iDim] + Coord[face_jNode][iDim]);
+        }
+
+        su2double Volume_i, Volume_j;
+
+        if (nDim == 2) {
+          if (change_face_orientation)
+            edges->SetNodes_Coord(iEdge, Coord_Elem_CG, Coord_Edge_CG);
+          else
+            edges->SetNodes_Coord(iEdge, Coord_Edge_CG, Coord_Elem_CG);
+
+          Volume_i = CEdge::GetVolume(Coord[face_iNode], Coord_Edge_CG, Coord_Elem_CG);
+          Volume_j = CEdge::GetVolume(Coord[face_jNode], Coord_Edge_CG, Coord_Elem_CG);
+        }
+        else {
+          if (change_face_orientation)
+            edges->SetNodes_Coord(iEdge, Coord_FaceElem_CG, Coord_Edge_CG, Coord_Elem_CG);
+          else
+            edges->SetNodes_Coord(iEdge, Coord_Edge_CG, Coord_FaceElem_CG, Coord_Elem_CG);
+
+          Volume_i = CEdge::GetVolume(Coord[face_iNode], Coord_Edge_CG, Coord_FaceElem_CG, Coord_Elem_CG);
+          Volume_j = CEdge::GetVolume(Coord[face_jNode], Coord_Edge_CG, Coord_FaceElem_CG, Coord_Elem_CG);
+        }
+
+        nodes->AddVolume(face_iPoint, sign*Volume_i);
+        nodes->AddVolume(face_jPoint, sign*Volume_j);
+
+        volumeDiff += sign*(Volume_i+Volume_j);
+
+        if (!subtract) touchedEdges.push_back(iEdge);
+      }
+    }
+  };
+
+  for (auto iElem : affectedElems) {
+    addContributions(iElem, true);
+    addContributions(iElem, false);
+  }
+
+  /*--- Restore the default normal on touched edges that collapsed to zero area. ---*/
+
+  for (auto iEdge : touchedEdges) {
+    const auto Area2 = GeometryToolbox::SquaredNorm(nDim, edges->GetNormal(iEdge));
+    su2double DefaultArea[MAXNDIM] = {EPS*EPS};
+    if (Area2 == 0.0) edges->SetNormal(iEdge, DefaultArea);
+  }
+
+  /*--- Update the domain volume with the net change. ---*/
+
+  su2double myDiff = volumeDiff, totalDiff;
+  SU2_MPI::Allreduce(&myDiff, &totalDiff, 1, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
+  config->SetDomainVolume(config->GetDomainVolume() + totalDiff);
+
+  return true;
 }
 
 void CPhysicalGeometry::SetBoundControlVolume(const CConfig *config, unsigned short action) {
 
+  /*--- After an incremental volume update, only the vertex normals of the boundary
+   elements with moved nodes change. ---*/
+
+  if ((action != ALLOCATE) && !dualGridUpdated.empty()) {
+    SU2_OMP_MASTER
+    UpdateBoundControlVolumeIncremental();
+    END_SU2_OMP_MASTER
+    SU2_OMP_BARRIER
+    return;
+  }
+
   /*--- Clear normals ---*/
 
   if (action != ALLOCATE) {
@@ -7538,7 +7944,7 @@ void CPhysicalGeometry::SetBoundControlVolume(const CConfig *config, unsigned sh
       const auto nNodes = bound[iMarker][iElem]->GetnNodes();
 
       /*--- Cannot preaccumulate if hybrid parallel due to shared reading. ---*/
-      if (omp_get_num_threads() == 1) AD::StartPreacc();
+      if (AD::Active && (omp_get_num_threads() == 1)) AD::StartPreacc();
 
       /*--- Get pointers to the coordinates of all the element nodes ---*/
       array<const su2double*, N_POINTS_MAXIMUM> Coord;
@@ -7608,6 +8014,100 @@ void CPhysicalGeometry::SetBoundControlVolume(const CConfig *config, unsigned sh
   END_SU2_OMP_FOR
 }
 
+void CPhysicalGeometry::UpdateBoundControlVolumeIncremental() {
+
+  /*--- Same difference scheme as UpdateControlVolumeIncremental, the vertex normals
+   of a boundary element only depend on its own nodes, so it is enough to visit the
+   elements with at least one moved node. ---*/
+
+  auto addContributions = [&](unsigned short iMarker, unsigned long iElem, bool subtract) {
+
+    const auto nNodes = bound[iMarker][iElem]->GetnNodes();
+
+    su2double CoordOld[N_POINTS_MAXIMUM][MAXNDIM];
+    array<const su2double*, N_POINTS_MAXIMUM> Coord;
+
+    for (unsigned short iNode = 0; iNode < nNodes; iNode++) {
+      const auto iPoint = bound[iMarker][iElem]->GetNode(iNode);
+      if (subtract) {
+        for (unsigned short iDim = 0; iDim < nDim; iDim++)
+          CoordOld[iNode][iDim] = dualGridOldCoord(iPoint, iDim);
+        Coord[iNode] = CoordOld[iNode];
+      }
+      else {
+        Coord[iNode] = nodes->GetCoord(iPoint);
+      }
+    }
+
+    su2double CGbuffer[MAXNDIM] = {0.0};
+    const su2double* Coord_Elem_CG;
+    if (subtract) {
+      for (unsigned short iNode = 0; iNode < nNodes; iNode++)
+        for (unsigned short iDim = 0; iDim < nDim; iDim++)
+          CGbuffer[iDim] += Coord[iNode][iDim]/nNodes;
+      Coord_Elem_CG = CGbuffer;
+    }
+    else {
+      Coord_Elem_CG = bound[iMarker][iElem]->SetCoord_CG(nDim, Coord);
+    }
+
+    for (unsigned short iNode = 0; iNode < nNodes; iNode++) {
+      const auto iPoint = bound[iMarker][iElem]->GetNode(iNode);
+      const auto iVertex = nodes->GetVertex(iPoint, iMarker);
+      auto Coord_Vertex = Coord[iNode];
+
+      for (unsigned short iNeighbor = 0; iNeighbor < bound[iMarker][iElem]->GetnNeighbor_Nodes(iNode); iNeighbor++) {
+        if (nDim == 2) {
+          /*--- Flipping the argument order in the subtract pass negates the normal. ---*/
+          if ((iNode == 0) != subtract) vertex[iMarker][iVertex]->SetNodes_Coord(Coord_Elem_CG, Coord_Vertex);
+          else vertex[iMarker][iVertex]->SetNodes_Coord(Coord_Vertex, Coord_Elem_CG);
+        }
+        else {
+          const auto Neighbor_Node = bound[iMarker][iElem]->GetNeighbor_Nodes(iNode, iNeighbor);
+          auto Neighbor_Coord = Coord[Neighbor_Node];
+
+          su2double Coord_Edge_CG[MAXNDIM] = {0.0};
+          for (unsigned short iDim = 0; iDim < nDim; iDim++)
+            Coord_Edge_CG[iDim] = 0.5 * (Coord_Vertex[iDim] + Neighbor_Coord[iDim]);
+
+          if ((iNeighbor == 0) != subtract) vertex[iMarker][iVertex]->SetNodes_Coord(Coord_Elem_CG, Coord_Edge_CG, Coord_Vertex);
+          else vertex[iMarker][iVertex]->SetNodes_Coord(Coord_Edge_CG, Coord_Elem_CG, Coord_Vertex);
+        }
+      }
+    }
+  };
+
+  for (unsigned short iMarker = 0; iMarker < nMarker; iMarker++) {
+    for (unsigned long iElem = 0; iElem < nElem_Bound[iMarker]; iElem++) {
+
+      bool affected = false;
+      for (unsigned short iNode = 0; iNode < bound[iMarker][iElem]->GetnNodes(); iNode++)
+        affected = affected || (dualGridPointMoved[bound[iMarker][iElem]->GetNode(iNode)] != 0);
+      if (!affected) continue;
+
+      addContributions(iMarker, iElem, true);
+      addContributions(iMarker, iElem, false);
+
+      /*--- Restore the default normal on touched vertices that collapsed to zero area. ---*/
+
+      for (unsigned short iNode = 0; iNode < bound[iMarker][iElem]->GetnNodes(); iNode++) {
+        const auto iPoint = bound[iMarker][iElem]->GetNode(iNode);
+        const auto iVertex = nodes->GetVertex(iPoint, iMarker);
+        const auto Area2 = GeometryToolbox::SquaredNorm(nDim, vertex[iMarker][iVertex]->GetNormal());
+        su2double DefaultArea[MAXNDIM] = {EPS*EPS};
+        if (Area2 == 0.0) vertex[iMarker][iVertex]->SetNormal(DefaultArea);
+      }
+    }
+  }
+
+  /*--- The stored coordinates now correspond to the updated metrics. ---*/
+
+  for (auto iPoint = 0ul; iPoint < nPoint; iPoint++)
+    if (dualGridPointMoved[iPoint])
+      for (unsigned short iDim = 0; iDim < nDim; iDim++)
+        dualGridOldCoord(iPoint, iDim) = SU2_TYPE::GetValue(nodes->GetCoord(iPoint, iDim));
+}
+
 void CPhysicalGeometry::VisualizeControlVolume(const CConfig *config) const {
 
   /*--- Access the point number for control volume we want to vizualize ---*/
@@ -8077,6 +8577,52 @@ void CPhysicalGeometry::SetColorGrid_Parallel(const CConfig *config) {
 
   CLinearPartitioner pointPartitioner(Global_nPointDomain,0);
 
+  /*--- If a partition map file is configured, try to reuse the coloring of a
+   previous run of the same case at the same rank count instead of calling
+   ParMETIS again. The file holds a small header (magic number, global point
+   count, rank count) followed by one int per point in the linear ordering
+   used here, so each rank reads its contiguous chunk directly. Any mismatch
+   in the header falls through to a fresh partitioning. ---*/
+
+  const string mapFileName = config->GetPartitionMap_FileName();
+  const unsigned long PARTITION_MAP_MAGIC = 535536;
+
+  if (!mapFileName.empty()) {
+    MPI_File mapFile;
+    if (MPI_File_open(comm, mapFileName.c_str(), MPI_MODE_RDONLY, MPI_INFO_NULL, &mapFile) == MPI_SUCCESS) {
+
+      unsigned long header[3] = {0,0,0};
+      MPI_File_read_at_all(mapFile, 0, header, 3, MPI_UNSIGNED_LONG, MPI_STATUS_IGNORE);
+
+      const bool mapValid = (header[0] == PARTITION_MAP_MAGIC) &&
+                            (header[1] == Global_nPointDomain) &&
+                            (header[2] == static_cast<unsigned long>(size));
+      if (mapValid) {
+        vector<int> colors(nPoint);
+        MPI_Offset disp = 3*sizeof(unsigned long) +
+                          pointPartitioner.GetFirstIndexOnRank(rank)*sizeof(int);
+        MPI_File_read_at_all(mapFile, disp, colors.data(), nPoint, MPI_INT, MPI_STATUS_IGNORE);
+        MPI_File_close(&mapFile);
+
+        for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++) {
+          nodes->SetColor(iPoint, colors[iPoint]);
+        }
+
+        if (rank == MASTER_NODE)
+          cout << "Reusing the grid partitioning cached in " << mapFileName << "." << endl;
+
+        decltype(xadj)().swap(xadj);
+        decltype(adjacency)().swap(adjacency);
+        return;
+      }
+
+      MPI_File_close(&mapFile);
+      if (rank == MASTER_NODE)
+        cout << "Cached partition map " << mapFileName
+             << " does not match this case, repartitioning." << endl;
+    }
+  }
+
   /*--- Some recommended defaults for the various ParMETIS options. ---*/
 
   idx_t wgtflag = 2;
@@ -8112,6 +8658,62 @@ void CPhysicalGeometry::SetColorGrid_Parallel(const CConfig *config) {
     vwgt[iPoint] = wp + we * (xadj[iPoint+1] - xadj[iPoint]);
   }
 
+  /*--- Optional cost-model weighting: points on markers with wall functions
+   (or with a multiplier prescribed via MARKER_PARTITION_WEIGHT) are more
+   expensive per iteration than regular interior points, scale their weights
+   so that ParMETIS balances run time rather than raw point counts. The
+   surface elements are only available on the master rank at this stage, so
+   the list of weighted points is built there and broadcast. ---*/
+
+  unsigned long nWeightedPoint = 0;
+  vector<unsigned long> weightedPoint;
+  vector<passivedouble> weightedFactor;
+
+  if (rank == MASTER_NODE) {
+    unordered_map<unsigned long, passivedouble> pointCost;
+    for (unsigned short iMarker = 0; iMarker < nMarker; iMarker++) {
+      const string tag = config->GetMarker_All_TagBound(iMarker);
+      passivedouble factor = config->GetMarker_PartitionWeight(tag);
+      if ((factor <= 0.0) && (config->GetWallFunction_Treatment(tag) != WALL_FUNCTIONS::NONE))
+        factor = config->GetParMETIS_WallModelWeight();
+      if ((factor <= 0.0) || (factor == 1.0)) continue;
+
+      /*--- Keep the largest multiplier for points shared by multiple markers. ---*/
+      for (unsigned long iElem = 0; iElem < nElem_Bound[iMarker]; iElem++) {
+        for (unsigned short iNode = 0; iNode < bound[iMarker][iElem]->GetnNodes(); iNode++) {
+          auto it = pointCost.emplace(bound[iMarker][iElem]->GetNode(iNode), factor).first;
+          it->second = max(it->second, factor);
+        }
+      }
+    }
+    for (const auto& it : pointCost) {
+      weightedPoint.push_back(it.first);
+      weightedFactor.push_back(it.second);
+    }
+    nWeightedPoint = weightedPoint.size();
+  }
+
+  SU2_MPI::Bcast(&nWeightedPoint, 1, MPI_UNSIGNED_LONG, MASTER_NODE, comm);
+
+  if (nWeightedPoint > 0) {
+    weightedPoint.resize(nWeightedPoint);
+    weightedFactor.resize(nWeightedPoint);
+    SU2_MPI::Bcast(weightedPoint.data(), nWeightedPoint, MPI_UNSIGNED_LONG, MASTER_NODE, comm);
+    SU2_MPI::Bcast(weightedFactor.data(), nWeightedPoint, MPI_DOUBLE, MASTER_NODE, comm);
+
+    /*--- Each rank applies the multipliers to the points it holds in the
+     linear partitioning, rounding up to keep integer weights. ---*/
+
+    const auto firstIndex = pointPartitioner.GetFirstIndexOnRank(rank);
+    const auto lastIndex  = pointPartitioner.GetLastIndexOnRank(rank);
+    for (unsigned long i = 0; i < nWeightedPoint; i++) {
+      const auto iPointGlobal = weightedPoint[i];
+      if ((iPointGlobal < firstIndex) || (iPointGlobal >= lastIndex)) continue;
+      auto& wgt = vwgt[iPointGlobal - firstIndex];
+      wgt = idx_t(ceil(weightedFactor[i] * max<passivedouble>(wgt, 1.0)));
+    }
+  }
+
   /*--- Create some structures that ParMETIS needs to output the partitioning. ---*/
 
   idx_t edgecut;
@@ -8136,159 +8738,67 @@ void CPhysicalGeometry::SetColorGrid_Parallel(const CConfig *config) {
     nodes->SetColor(iPoint, part[iPoint]);
   }
 
-  /*--- Force free the connectivity. ---*/
+  /*--- Cache the coloring for reruns of the same case at this rank count. ---*/
 
-  decltype(xadj)().swap(xadj);
-  decltype(adjacency)().swap(adjacency);
-
-#endif
-}
-
-void CPhysicalGeometry::ComputeMeshQualityStatistics(const CConfig *config) {
-
-  /*--- Resize our vectors for the 3 metrics: orthogonality, aspect
-   ratio, and volume ratio. All are vertex-based for the dual CV. ---*/
-
-  Orthogonality.resize(nPoint,0.0);
-  Aspect_Ratio.resize(nPoint,0.0);
-  Volume_Ratio.resize(nPoint,0.0);
-
-  /*--- Helper vectors for holding intermediate values. ---*/
-
-  vector<su2double> SurfaceArea(nPoint,0.0);
-  vector<su2double> Area_Max(nPoint,0.0);
-  vector<su2double> Area_Min(nPoint,1.e6);
-  vector<su2double> SubVolume_Max(nPoint,0.0);
-  vector<su2double> SubVolume_Min(nPoint,1.e6);
-
-  /*--- Orthogonality and aspect ratio (areas) are computed by
-   looping over all edges to check the angles and the face areas. ---*/
-
-  for (unsigned long iEdge = 0; iEdge < nEdge; iEdge++) {
-
-    /*--- Point identification, edge normal vector and area ---*/
+  if (!mapFileName.empty()) {
+    MPI_File mapFile;
+    if (MPI_File_open(comm, mapFileName.c_str(), MPI_MODE_CREATE | MPI_MODE_WRONLY,
+                      MPI_INFO_NULL, &mapFile) == MPI_SUCCESS) {
 
-    const unsigned long iPoint = edges->GetNode(iEdge,0);
-    const unsigned long jPoint = edges->GetNode(iEdge,1);
-
-    const unsigned long GlobalIndex_i = nodes->GetGlobalIndex(iPoint);
-    const unsigned long GlobalIndex_j = nodes->GetGlobalIndex(jPoint);
-
-    /*-- Area normal for the current edge. Recall that this normal
-     is computed by summing the normals of adjacent faces along
-     the edge between iPoint & jPoint. ---*/
-
-    const su2double *Normal = edges->GetNormal(iEdge);
-
-    /*--- Get the coordinates for point i & j. ---*/
-
-    const su2double *Coord_i = nodes->GetCoord(iPoint);
-    const su2double *Coord_j = nodes->GetCoord(jPoint);
-
-    /*--- Compute the vector pointing from iPoint to jPoint and
-     its distance. We also compute face area (norm of the normal vector). ---*/
-
-    su2double distance = 0.0;
-    su2double area     = 0.0;
-    vector<su2double> edgeVector(nDim);
-    for (unsigned short iDim = 0; iDim < nDim; iDim++) {
-      edgeVector[iDim] = Coord_j[iDim]-Coord_i[iDim];
-      distance        += edgeVector[iDim]*edgeVector[iDim];
-      area            += Normal[iDim]*Normal[iDim];
-    }
-    distance = sqrt(distance);
-    area     = sqrt(area);
-
-    /*--- Aspect ratio is the ratio between the largest and smallest
-     faces making up the boundary of the dual CV and is a measure
-     of the aspect ratio of the dual control volume. Smaller
-     is better (closer to isotropic). ----*/
-
-    if (nodes->GetDomain(iPoint)) {
-      Area_Min[iPoint] = min(Area_Min[iPoint], area);
-      Area_Max[iPoint] = max(Area_Max[iPoint], area);
-    }
-
-    if (nodes->GetDomain(jPoint)) {
-      Area_Min[jPoint] = min(Area_Min[jPoint], area);
-      Area_Max[jPoint] = max(Area_Max[jPoint], area);
-    }
-
-    if (area <= 0.0) {
-      char buf[200];
-      SPRINTF(buf, "Zero-area CV face found for edge (%lu,%lu).",
-              GlobalIndex_i, GlobalIndex_j);
-      SU2_MPI::Error(string(buf), CURRENT_FUNCTION);
-    }
-
-    /*--- Compute the angle between the unit normal associated
-     with the edge and the unit vector pointing from iPoint to jPoint. ---*/
+      if (rank == MASTER_NODE) {
+        unsigned long header[3] = {PARTITION_MAP_MAGIC, Global_nPointDomain,
+                                   static_cast<unsigned long>(size)};
+        MPI_File_write_at(mapFile, 0, header, 3, MPI_UNSIGNED_LONG, MPI_STATUS_IGNORE);
+      }
 
-    su2double dotProduct = 0.0;
-    for (unsigned short iDim = 0; iDim < nDim; iDim++) {
-      dotProduct += (Normal[iDim]/area)*(edgeVector[iDim]/distance);
-    }
+      vector<int> colors(nPoint);
+      for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++)
+        colors[iPoint] = static_cast<int>(part[iPoint]);
 
-    /*--- The definition of orthogonality is an area-weighted average of
-     90 degrees minus the angle between the face area unit normal and
-     the vector between i & j. If the two are perfectly aligned, then
-     the orthogonality is the desired max of 90 degrees. If they are
-     not aligned, the orthogonality will reduce from there. Good values
-     are close to 90 degress, poor values are typically below 20 degress. ---*/
+      MPI_Offset disp = 3*sizeof(unsigned long) +
+                        pointPartitioner.GetFirstIndexOnRank(rank)*sizeof(int);
+      MPI_File_write_at_all(mapFile, disp, colors.data(), nPoint, MPI_INT, MPI_STATUS_IGNORE);
+      MPI_File_close(&mapFile);
 
-    if (nodes->GetDomain(iPoint)) {
-      Orthogonality[iPoint] += area*(90.0 - acos(dotProduct)*180.0/PI_NUMBER);
-      SurfaceArea[iPoint]   += area;
-    }
-    if (nodes->GetDomain(jPoint)) {
-      Orthogonality[jPoint] += area*(90.0 - acos(dotProduct)*180.0/PI_NUMBER);
-      SurfaceArea[jPoint]   += area;
-    }
-
-    /*--- Error check for zero volume of the dual CVs. ---*/
-
-    if (nodes->GetVolume(iPoint) <= 0.0) {
-      char buf[200];
-      SPRINTF(buf, "Zero-area CV face found for point %lu.", GlobalIndex_i);
-      SU2_MPI::Error(string(buf), CURRENT_FUNCTION);
+      if (rank == MASTER_NODE)
+        cout << "Cached the grid partitioning in " << mapFileName << "." << endl;
     }
-
-    if (nodes->GetVolume(jPoint) <= 0.0) {
-      char buf[200];
-      SPRINTF(buf, "Zero-area CV face found for point %lu.", GlobalIndex_j);
-      SU2_MPI::Error(string(buf), CURRENT_FUNCTION);
+    else if (rank == MASTER_NODE) {
+      cout << "WARNING: Could not open " << mapFileName << " to cache the partitioning." << endl;
     }
-
   }
 
-  /*--- Loop boundary edges to include the area of the boundary elements.  ---*/
+  /*--- Force free the connectivity. ---*/
 
-  for (unsigned short iMarker = 0; iMarker < nMarker; iMarker++) {
-    if ((config->GetMarker_All_KindBC(iMarker) != INTERNAL_BOUNDARY) &&
-        (config->GetMarker_All_KindBC(iMarker) != SEND_RECEIVE)){
+  decltype(xadj)().swap(xadj);
+  decltype(adjacency)().swap(adjacency);
 
-      for (unsigned long iVertex = 0; iVertex < nVertex[iMarker]; iVertex++) {
-        const unsigned long iPoint = vertex[iMarker][iVertex]->GetNode();
-        const su2double *Normal    = vertex[iMarker][iVertex]->GetNormal();
+#endif
+}
 
-        if (nodes->GetDomain(iPoint)) {
+void CPhysicalGeometry::ComputeMeshQualityStatistics(const CConfig *config) {
 
-          /*--- Face area (norm of the normal vector) ---*/
+  /*--- The point-wise fields for the 3 metrics (orthogonality, aspect
+   ratio, and volume ratio, all vertex-based for the dual CV) are only
+   stored if they will be written to the visualization files. Otherwise,
+   the statistics are streamed through scalar accumulators while looping
+   over the local points, which avoids keeping several large arrays
+   resident during preprocessing. ---*/
 
-          su2double area = 0.0;
-          for (unsigned short iDim = 0; iDim < nDim; iDim++)
-            area += Normal[iDim]*Normal[iDim];
-          area = sqrt(area);
+  const bool keepFields = config->GetWrt_MeshQuality();
 
-          /*--- Check to store the area as the min or max for i or j. ---*/
+  if (keepFields) {
+    Orthogonality.resize(nPoint,0.0);
+    Aspect_Ratio.resize(nPoint,0.0);
+    Volume_Ratio.resize(nPoint,0.0);
+  }
 
-          Area_Min[iPoint] = min(Area_Min[iPoint], area);
-          Area_Max[iPoint] = max(Area_Max[iPoint], area);
+  /*--- The sub-element volumes are scattered from the volume elements,
+   which requires per-point storage for the running min and max. These
+   are the only helper vectors that we allocate. ---*/
 
-        }
-      }
-    }
-  }
+  vector<su2double> SubVolume_Max(nPointDomain,0.0);
+  vector<su2double> SubVolume_Min(nPointDomain,1.e6);
 
   /*--- Volume ratio is computed by looping over all volume elements and
    computing the sub-element volume contributions. The ratio between the
@@ -8381,23 +8891,130 @@ void CPhysicalGeometry::ComputeMeshQualityStatistics(const CConfig *config) {
     }
   }
 
-  /*--- Compute the metrics with a final loop over the vertices. Also
-   compute the local min and max values here for reporting. ---*/
+  /*--- Orthogonality and aspect ratio (areas) are computed by gathering
+   the edges adjacent to each local point, such that the angle and face
+   area checks complete point-by-point without intermediate storage. The
+   local min and max values for reporting are tracked in the same pass. ---*/
 
   su2double orthoMin = 1.e6, arMin = 1.e6, vrMin = 1.e6;
   su2double orthoMax = 0.0,  arMax = 0.0,  vrMax = 0.0;
-  for (unsigned long iPoint= 0; iPoint < nPointDomain; iPoint++) {
-    Orthogonality[iPoint] = Orthogonality[iPoint]/SurfaceArea[iPoint];
-    orthoMin = min(Orthogonality[iPoint], orthoMin);
-    orthoMax = max(Orthogonality[iPoint], orthoMax);
+  for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
+
+    const unsigned long GlobalIndex_i = nodes->GetGlobalIndex(iPoint);
+    const su2double *Coord_i = nodes->GetCoord(iPoint);
+
+    /*--- Error check for zero volume of the dual CV. ---*/
+
+    if (nodes->GetVolume(iPoint) <= 0.0) {
+      char buf[200];
+      SPRINTF(buf, "Zero-area CV face found for point %lu.", GlobalIndex_i);
+      SU2_MPI::Error(string(buf), CURRENT_FUNCTION);
+    }
+
+    su2double orthoSum = 0.0, surfaceArea = 0.0;
+    su2double areaMin = 1.e6, areaMax = 0.0;
+
+    for (unsigned short iNeigh = 0; iNeigh < nodes->GetnPoint(iPoint); iNeigh++) {
+
+      const unsigned long jPoint = nodes->GetPoint(iPoint, iNeigh);
+      const auto iEdge = nodes->GetEdge(iPoint, iNeigh);
+
+      /*-- Area normal for the current edge. Recall that this normal
+       is computed by summing the normals of adjacent faces along
+       the edge between iPoint & jPoint, and that it is oriented from
+       the first node of the edge towards the second. ---*/
+
+      const su2double *Normal  = edges->GetNormal(iEdge);
+      const su2double *Coord_j = nodes->GetCoord(jPoint);
+
+      const su2double direction = (edges->GetNode(iEdge,0) == iPoint) ? 1.0 : -1.0;
+
+      /*--- Compute the vector pointing along the edge in the direction
+       of the normal and its distance. We also compute the face area
+       (norm of the normal vector). ---*/
+
+      su2double distance   = 0.0;
+      su2double area       = 0.0;
+      su2double dotProduct = 0.0;
+      for (unsigned short iDim = 0; iDim < nDim; iDim++) {
+        const su2double edgeVector = direction*(Coord_j[iDim]-Coord_i[iDim]);
+        distance   += edgeVector*edgeVector;
+        area       += Normal[iDim]*Normal[iDim];
+        dotProduct += Normal[iDim]*edgeVector;
+      }
+      distance = sqrt(distance);
+      area     = sqrt(area);
+
+      if (area <= 0.0) {
+        char buf[200];
+        SPRINTF(buf, "Zero-area CV face found for edge (%lu,%lu).",
+                GlobalIndex_i, nodes->GetGlobalIndex(jPoint));
+        SU2_MPI::Error(string(buf), CURRENT_FUNCTION);
+      }
+      dotProduct /= (area*distance);
+
+      /*--- The definition of orthogonality is an area-weighted average of
+       90 degrees minus the angle between the face area unit normal and
+       the vector between i & j. If the two are perfectly aligned, then
+       the orthogonality is the desired max of 90 degrees. If they are
+       not aligned, the orthogonality will reduce from there. Good values
+       are close to 90 degress, poor values are typically below 20 degress. ---*/
+
+      orthoSum    += area*(90.0 - acos(dotProduct)*180.0/PI_NUMBER);
+      surfaceArea += area;
+
+      /*--- Aspect ratio is the ratio between the largest and smallest
+       faces making up the boundary of the dual CV and is a measure
+       of the aspect ratio of the dual control volume. Smaller
+       is better (closer to isotropic). ----*/
+
+      areaMin = min(areaMin, area);
+      areaMax = max(areaMax, area);
+
+    }
+
+    /*--- Include the area of the boundary faces attached to the point. ---*/
+
+    if (nodes->GetBoundary(iPoint)) {
+      for (unsigned short iMarker = 0; iMarker < nMarker; iMarker++) {
+        if ((config->GetMarker_All_KindBC(iMarker) == INTERNAL_BOUNDARY) ||
+            (config->GetMarker_All_KindBC(iMarker) == SEND_RECEIVE)) continue;
+
+        const long iVertex = nodes->GetVertex(iPoint, iMarker);
+        if (iVertex < 0) continue;
+
+        const su2double *Normal = vertex[iMarker][iVertex]->GetNormal();
 
-    Aspect_Ratio[iPoint] = Area_Max[iPoint]/Area_Min[iPoint];
-    arMin = min(Aspect_Ratio[iPoint], arMin);
-    arMax = max(Aspect_Ratio[iPoint], arMax);
+        su2double area = 0.0;
+        for (unsigned short iDim = 0; iDim < nDim; iDim++)
+          area += Normal[iDim]*Normal[iDim];
+        area = sqrt(area);
 
-    Volume_Ratio[iPoint] = SubVolume_Max[iPoint]/SubVolume_Min[iPoint];
-    vrMin = min(Volume_Ratio[iPoint], vrMin);
-    vrMax = max(Volume_Ratio[iPoint], vrMax);
+        areaMin = min(areaMin, area);
+        areaMax = max(areaMax, area);
+      }
+    }
+
+    /*--- Compute the 3 metrics for this point and update the extrema. ---*/
+
+    const su2double ortho = orthoSum/surfaceArea;
+    const su2double ar    = areaMax/areaMin;
+    const su2double vr    = SubVolume_Max[iPoint]/SubVolume_Min[iPoint];
+
+    orthoMin = min(ortho, orthoMin);
+    orthoMax = max(ortho, orthoMax);
+
+    arMin = min(ar, arMin);
+    arMax = max(ar, arMax);
+
+    vrMin = min(vr, vrMin);
+    vrMax = max(vr, vrMax);
+
+    if (keepFields) {
+      Orthogonality[iPoint] = ortho;
+      Aspect_Ratio[iPoint]  = ar;
+      Volume_Ratio[iPoint]  = vr;
+    }
   }
 
   /*--- Reduction to find the min and max values globally. ---*/
@@ -8434,15 +9051,6 @@ void CPhysicalGeometry::ComputeMeshQualityStatistics(const CConfig *config) {
     MetricsTable.PrintFooter();
   }
 
-  /*--- If we will not be writing the stats to the visualization files,
-   force clear the memory with the swap() function. ---*/
-
-  if (!config->GetWrt_MeshQuality()) {
-    vector<su2double>().swap(Orthogonality);
-    vector<su2double>().swap(Aspect_Ratio);
-    vector<su2double>().swap(Volume_Ratio);
-  }
-
 }
 
 void CPhysicalGeometry::FindNormal_Neighbor(const CConfig *config) {
@@ -10852,6 +11460,38 @@ std::unique_ptr<CADTElemClass> CPhysicalGeometry::ComputeViscousWallADT(const CC
 
 }
 
+bool CPhysicalGeometry::UpdateViscousWallADT(CADTElemClass *WallADT, const CConfig *config) const {
+
+  /*--- Collect the current coordinates of the points on the viscous walls,
+        in the same order in which ComputeViscousWallADT stored them. ---*/
+
+  vector<bool> wallPoint(nPoint, false);
+
+  for(unsigned short iMarker=0; iMarker<config->GetnMarker_All(); ++iMarker) {
+    if( config->GetViscous_Wall(iMarker)) {
+      for(unsigned long iElem=0; iElem < nElem_Bound[iMarker]; iElem++) {
+        for (unsigned short iNode = 0; iNode < bound[iMarker][iElem]->GetnNodes(); iNode++)
+          wallPoint[bound[iMarker][iElem]->GetNode(iNode)] = true;
+      }
+    }
+  }
+
+  vector<su2double> surfaceCoor;
+
+  for(unsigned long i=0; i<nPoint; ++i) {
+    if( wallPoint[i] ) {
+      for(unsigned short k=0; k<nDim; ++k)
+        surfaceCoor.push_back(nodes->GetCoord(i, k));
+    }
+  }
+
+  /*--- Refit the ADT to the new coordinates, the tree is not rebuilt. ---*/
+
+  WallADT->UpdateCoordinates(surfaceCoor);
+
+  return true;
+}
+
 void CPhysicalGeometry::SetWallDistance(CADTElemClass* WallADT, const CConfig* config, unsigned short iZone) {
 
   /*--------------------------------------------------------------------------*/
@@ -10859,25 +11499,30 @@ void CPhysicalGeometry::SetWallDistance(CADTElemClass* WallADT, const CConfig* c
   /*---        distance to a solid wall element                           ---*/
   /*--------------------------------------------------------------------------*/
 
-  SU2_OMP_PARALLEL
-  if (!WallADT->IsEmpty()) {
-    /*--- Solid wall boundary nodes are present. Compute the wall
-     distance for all nodes. ---*/
+  if (WallADT->IsEmpty()) return;
 
-    SU2_OMP_FOR_DYN(roundUpDiv(nPoint,2*omp_get_max_threads()))
-    for (unsigned long iPoint=0; iPoint<GetnPoint(); ++iPoint) {
-      unsigned short markerID;
-      unsigned long  elemID;
-      int            rankID;
-      su2double      dist;
+  /*--- Solid wall boundary nodes are present. Gather the coordinates of all
+   nodes and determine the nearest wall elements with the batched query, which
+   sorts the queries along a space-filling curve and warm starts consecutive
+   searches. The batched query parallelizes over OpenMP internally. ---*/
 
-      WallADT->DetermineNearestElement(nodes->GetCoord(iPoint), dist, markerID, elemID, rankID);
+  vector<su2double> coords(nPoint*nDim);
+  for (unsigned long iPoint=0; iPoint<GetnPoint(); ++iPoint)
+    for (unsigned short iDim=0; iDim<nDim; ++iDim)
+      coords[iPoint*nDim+iDim] = nodes->GetCoord(iPoint, iDim);
 
-      if(dist < nodes->GetWall_Distance(iPoint)){
-        nodes->SetWall_Distance(iPoint, dist, rankID, iZone, markerID, elemID);
-      }
+  vector<su2double>      dists(nPoint);
+  vector<unsigned short> markerIDs(nPoint);
+  vector<unsigned long>  elemIDs(nPoint);
+  vector<int>            rankIDs(nPoint);
+
+  WallADT->DetermineNearestElements(nPoint, coords.data(), dists.data(),
+                                    markerIDs.data(), elemIDs.data(), rankIDs.data());
+
+  for (unsigned long iPoint=0; iPoint<GetnPoint(); ++iPoint) {
+    if(dists[iPoint] < nodes->GetWall_Distance(iPoint)){
+      nodes->SetWall_Distance(iPoint, dists[iPoint], rankIDs[iPoint], iZone,
+                              markerIDs[iPoint], elemIDs[iPoint]);
     }
-    END_SU2_OMP_FOR
   }
-  END_SU2_OMP_PARALLEL
 }
@@ -29,6 +29,10 @@
 #include "../../../include/toolboxes/CLinearPartitioner.hpp"
 #include "../../../include/geometry/meshreader/CCGNSMeshReaderFVM.hpp"
 
+#if defined(HAVE_CGNS) && defined(HAVE_MPI)
+#include "pcgnslib.h"
+#endif
+
 CCGNSMeshReaderFVM::CCGNSMeshReaderFVM(CConfig        *val_config,
                                        unsigned short val_iZone,
                                        unsigned short val_nZone)
@@ -62,6 +66,11 @@ CCGNSMeshReaderFVM::CCGNSMeshReaderFVM(CConfig        *val_config,
   }
 
   /*--- We have extracted all CGNS data. Close the CGNS file. ---*/
+#ifdef HAVE_MPI
+  if (cgnsParallel) {
+    if (cgp_close(cgnsFileID)) cg_error_exit();
+  } else
+#endif
   if (cg_close(cgnsFileID)) cg_error_exit();
 
   /*--- Put our CGNS data into the class data for the mesh reader. ---*/
@@ -92,15 +101,34 @@ void CCGNSMeshReaderFVM::OpenCGNSFile(string val_filename) {
                    CURRENT_FUNCTION);
   }
 
-  /*--- Open the CGNS file for reading. The value of cgnsFileID returned
-   is the specific index number for this file and will be
-   repeatedly used in the function calls. ---*/
+#ifdef HAVE_MPI
+  /*--- In parallel runs, open HDF5-based CGNS files with the parallel
+   API so that the large coordinate and connectivity reads become
+   collective MPI-IO operations, which scale much better with the
+   number of ranks than independent reads of the same file. ADF files
+   do not support parallel I/O and keep the serial code path. ---*/
+
+  if ((size > SINGLE_NODE) && (file_type == CG_FILE_HDF5)) {
+    if (cgp_mpi_comm(SU2_MPI::GetComm())) cg_error_exit();
+    if (cgp_pio_mode(CGP_COLLECTIVE)) cg_error_exit();
+    if (cgp_open(val_filename.c_str(), CG_MODE_READ, &cgnsFileID))
+      cg_error_exit();
+    cgnsParallel = true;
+  }
+#endif
+
+  /*--- Otherwise, open the CGNS file for reading serially. The value of
+   cgnsFileID returned is the specific index number for this file and
+   will be repeatedly used in the function calls. ---*/
 
-  if (cg_open(val_filename.c_str(), CG_MODE_READ, &cgnsFileID))
-    cg_error_exit();
+  if (!cgnsParallel) {
+    if (cg_open(val_filename.c_str(), CG_MODE_READ, &cgnsFileID))
+      cg_error_exit();
+  }
   if (rank == MASTER_NODE) {
-    cout << "Reading the CGNS file: ";
-    cout << val_filename.c_str() << "." << endl;
+    cout << "Reading the CGNS file";
+    if (cgnsParallel) cout << " with collective MPI-IO";
+    cout << ": " << val_filename.c_str() << "." << endl;
   }
   if (cg_version(cgnsFileID, &file_version))
     cg_error_exit();
@@ -283,6 +311,26 @@ void CCGNSMeshReaderFVM::ReadCGNSPointCoordinates() {
      Ask for datatype RealDouble and let CGNS library do the translation
      when RealSingle is found. ---*/
 
+#ifdef HAVE_MPI
+    if (cgnsParallel) {
+
+      /*--- For a parallel open, read the chunk with a collective call.
+       The general form of the read converts the data to RealDouble in
+       memory when the file holds single precision coordinates. All
+       ranks must participate in the collective, so a rank without
+       points passes a null buffer and reads nothing. ---*/
+
+      const cgsize_t m_dimvals = (cgsize_t)numberOfLocalPoints;
+      const cgsize_t m_rmin = 1, m_rmax = m_dimvals;
+      void* coordBuf = (numberOfLocalPoints > 0) ?
+                       (void*)localPointCoordinates[indC].data() : nullptr;
+      if (cgp_coord_general_read_data(cgnsFileID, cgnsBase, cgnsZone, k+1,
+                                      &range_min, &range_max, RealDouble,
+                                      1, &m_dimvals, &m_rmin, &m_rmax,
+                                      coordBuf))
+        cg_error_exit();
+    } else
+#endif
     if (cg_coord_read(cgnsFileID, cgnsBase, cgnsZone, coordname, RealDouble,
                       &range_min, &range_max, localPointCoordinates[indC].data()))
       cg_error_exit();
@@ -471,22 +519,42 @@ void CCGNSMeshReaderFVM::ReadCGNSVolumeSection(int val_section) {
    partial read function in the CGNS API. Only call the CGNS API
    if we have a non-zero number of elements on this rank. ---*/
 
-  if (nElems[val_section] > 0) {
-    if (elemType == MIXED || elemType == NFACE_n || elemType == NGON_n) {
+  if (elemType == MIXED || elemType == NFACE_n || elemType == NGON_n) {
+
+    /*--- The parallel CGNS API can not read sections with variable
+     element sizes, so these always use the per-rank partial reads. ---*/
+
+    if (nElems[val_section] > 0) {
       if (cg_poly_elements_partial_read(cgnsFileID, cgnsBase, cgnsZone, val_section+1,
                                         (cgsize_t)elementPartitioner.GetFirstIndexOnRank(rank),
                                         (cgsize_t)elementPartitioner.GetLastIndexOnRank(rank),
                                         connElemCGNS.data(),
                                         connOffsetCGNS.data(), NULL) != CG_OK)
       cg_error_exit();
-    } else {
-      if (cg_elements_partial_read(cgnsFileID, cgnsBase, cgnsZone, val_section+1,
-                                   (cgsize_t)elementPartitioner.GetFirstIndexOnRank(rank),
-                                   (cgsize_t)elementPartitioner.GetLastIndexOnRank(rank),
-                                   connElemCGNS.data(), NULL) != CG_OK)
-      cg_error_exit();
     }
   }
+#ifdef HAVE_MPI
+  else if (cgnsParallel) {
+
+    /*--- Collective MPI-IO read of our rank's chunk of the section.
+     All ranks must participate in the collective, so a rank without
+     elements passes a null buffer and reads nothing. ---*/
+
+    cgsize_t* connBuf = (nElems[val_section] > 0) ? connElemCGNS.data() : nullptr;
+    if (cgp_elements_read_data(cgnsFileID, cgnsBase, cgnsZone, val_section+1,
+                               (cgsize_t)elementPartitioner.GetFirstIndexOnRank(rank),
+                               (cgsize_t)elementPartitioner.GetLastIndexOnRank(rank),
+                               connBuf) != CG_OK)
+      cg_error_exit();
+  }
+#endif
+  else if (nElems[val_section] > 0) {
+    if (cg_elements_partial_read(cgnsFileID, cgnsBase, cgnsZone, val_section+1,
+                                 (cgsize_t)elementPartitioner.GetFirstIndexOnRank(rank),
+                                 (cgsize_t)elementPartitioner.GetLastIndexOnRank(rank),
+                                 connElemCGNS.data(), NULL) != CG_OK)
+    cg_error_exit();
+  }
 
   /*--- Print some information to the console. ---*/
 
@@ -29,6 +29,29 @@
 #include "../../../include/toolboxes/CLinearPartitioner.hpp"
 #include "../../../include/geometry/meshreader/CSU2ASCIIMeshReaderFVM.hpp"
 
+#include <cstdlib>
+
+namespace {
+
+/*--- Fast tokenizers for the hot point/element loops, an order of magnitude cheaper than
+ extracting from a stringstream. They advance the cursor past the parsed token. ---*/
+
+inline unsigned long FastParseULong(const char*& cursor) {
+  char* end = nullptr;
+  const unsigned long val = strtoul(cursor, &end, 10);
+  cursor = end;
+  return val;
+}
+
+inline passivedouble FastParseDouble(const char*& cursor) {
+  char* end = nullptr;
+  const passivedouble val = strtod(cursor, &end);
+  cursor = end;
+  return val;
+}
+
+}
+
 CSU2ASCIIMeshReaderFVM::CSU2ASCIIMeshReaderFVM(CConfig *val_config,
                                                unsigned short val_iZone,
                                                unsigned short val_nZone)
@@ -44,6 +67,11 @@ CSU2ASCIIMeshReaderFVM::CSU2ASCIIMeshReaderFVM(CConfig *val_config,
                       (config->GetActDisk_SU2_DEF()))));
   if (config->GetActDisk_DoubleSurface()) actuator_disk = false;
 
+  /* A large stream buffer speeds up the line-based reading of big ASCII meshes,
+   it has to be set before the file is opened for the first time. */
+  fileBuffer.resize(1 << 22);
+  mesh_file.rdbuf()->pubsetbuf(fileBuffer.data(), fileBuffer.size());
+
   /* Read the basic metadata and perform some basic error checks. */
   const auto try_single_pass = !actuator_disk;
 
@@ -795,13 +823,13 @@ void CSU2ASCIIMeshReaderFVM::ReadPointCoordinates(const bool single_pass) {
       passivedouble Coords[3] = {0.0,0.0,0.0};
       if (pointPartitioner.IndexBelongsToRank(GlobalIndex, rank)) {
 
-        istringstream point_line(text_line);
+        const char* cursor = text_line.c_str();
 
         /* Store the coordinates more clearly. */
-        point_line >> Coords[0];
-        point_line >> Coords[1];
+        Coords[0] = FastParseDouble(cursor);
+        Coords[1] = FastParseDouble(cursor);
         if (dimension == 3) {
-          point_line >> Coords[2];
+          Coords[2] = FastParseDouble(cursor);
         }
 
         /* Load into the coordinate class data structure. */
@@ -840,17 +868,16 @@ void CSU2ASCIIMeshReaderFVM::ReadVolumeElementConnectivity(const bool single_pas
 
     for (unsigned long GlobalIndex = 0; GlobalIndex < numberOfGlobalElements; ++GlobalIndex) {
       getline(mesh_file, text_line);
-      istringstream elem_line(text_line);
+      const char* cursor = text_line.c_str();
 
       /*--- Decide whether this rank needs each element. ---*/
 
-      unsigned short VTK_Type;
-      elem_line >> VTK_Type;
+      const auto VTK_Type = static_cast<unsigned short>(FastParseULong(cursor));
 
       const auto nPointsElem = nPointsOfElementType(VTK_Type);
 
       for (unsigned short  i = 0; i < nPointsElem; i++) {
-        elem_line >> connectivity[i];
+        connectivity[i] = FastParseULong(cursor);
       }
 
       if (actuator_disk) {
@@ -956,10 +983,9 @@ void CSU2ASCIIMeshReaderFVM::ReadSurfaceElementConnectivity(const bool single_pa
 
       for (unsigned long iElem_Bound = 0; iElem_Bound < nElem_Bound; iElem_Bound++) {
         getline(mesh_file, text_line);
-        istringstream bound_line(text_line);
+        const char* cursor = text_line.c_str();
 
-        unsigned short VTK_Type;
-        bound_line >> VTK_Type;
+        const auto VTK_Type = static_cast<unsigned short>(FastParseULong(cursor));
 
         const auto nPointsElem = nPointsOfElementType(VTK_Type);
 
@@ -969,7 +995,7 @@ void CSU2ASCIIMeshReaderFVM::ReadSurfaceElementConnectivity(const bool single_pa
         }
 
         for (unsigned short i = 0; i < nPointsElem; i++) {
-          bound_line >> connectivity[i];
+          connectivity[i] = FastParseULong(cursor);
         }
 
         surfaceElementConnectivity[iMarker].push_back(0);
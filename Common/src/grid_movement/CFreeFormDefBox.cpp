@@ -757,6 +757,18 @@ su2double *CFreeFormDefBox::GetParametricCoord_Analytical(const su2double *cart_
 su2double *CFreeFormDefBox::EvalCartesianCoord(su2double *ParamCoord) const {
   unsigned short iDim, iDegree, jDegree, kDegree;
 
+  /*--- Evaluate the three 1D bases once, instead of once per control point
+   inside the triple loop below. ---*/
+
+  vector<su2double> biu(lDegree+1), bjv(mDegree+1), bkw(nDegree+1);
+
+  for (iDegree = 0; iDegree <= lDegree; iDegree++)
+    biu[iDegree] = BlendingFunction[0]->GetBasis(iDegree, ParamCoord[0]);
+  for (jDegree = 0; jDegree <= mDegree; jDegree++)
+    bjv[jDegree] = BlendingFunction[1]->GetBasis(jDegree, ParamCoord[1]);
+  for (kDegree = 0; kDegree <= nDegree; kDegree++)
+    bkw[kDegree] = BlendingFunction[2]->GetBasis(kDegree, ParamCoord[2]);
+
   for (iDim = 0; iDim < nDim; iDim++)
     cart_coord[iDim] = 0.0;
 
@@ -765,14 +777,77 @@ su2double *CFreeFormDefBox::EvalCartesianCoord(su2double *ParamCoord) const {
       for (kDegree = 0; kDegree <= nDegree; kDegree++)
         for (iDim = 0; iDim < nDim; iDim++) {
           cart_coord[iDim] += Coord_Control_Points[iDegree][jDegree][kDegree][iDim]
-          * BlendingFunction[0]->GetBasis(iDegree, ParamCoord[0])
-          * BlendingFunction[1]->GetBasis(jDegree, ParamCoord[1])
-          * BlendingFunction[2]->GetBasis(kDegree, ParamCoord[2]);
+          * biu[iDegree] * bjv[jDegree] * bkw[kDegree];
         }
 
   return cart_coord;
 }
 
+void CFreeFormDefBox::EvalCartesianCoordBatch(void) {
+
+  const unsigned long nSurf = GetnSurfacePoint();
+  const unsigned long nControl = (lDegree+1)*(mDegree+1)*(nDegree+1);
+  const unsigned long BLOCK_SIZE = 64;
+
+  BatchCoord.resize(3*nSurf);
+
+  /*--- Flatten the control points once per evaluation. ---*/
+
+  vector<passivedouble> cp(nControl*nDim);
+  unsigned long iControl = 0;
+  for (unsigned short iDegree = 0; iDegree <= lDegree; iDegree++)
+    for (unsigned short jDegree = 0; jDegree <= mDegree; jDegree++)
+      for (unsigned short kDegree = 0; kDegree <= nDegree; kDegree++) {
+        for (unsigned short iDim = 0; iDim < nDim; iDim++)
+          cp[iControl*nDim+iDim] = SU2_TYPE::GetValue(Coord_Control_Points[iDegree][jDegree][kDegree][iDim]);
+        iControl++;
+      }
+
+  vector<passivedouble> biu(lDegree+1), bjv(mDegree+1), bkw(nDegree+1);
+  vector<passivedouble> table(BLOCK_SIZE*nControl);
+
+  for (unsigned long blockBegin = 0; blockBegin < nSurf; blockBegin += BLOCK_SIZE) {
+    const unsigned long blockSize = min(BLOCK_SIZE, nSurf-blockBegin);
+
+    /*--- Basis table of this block of points, each row holds the separable
+     product of the 1D bases for all control points. ---*/
+
+    for (unsigned long iPoint = 0; iPoint < blockSize; iPoint++) {
+      const unsigned long iSurf = blockBegin + iPoint;
+
+      for (unsigned short iDegree = 0; iDegree <= lDegree; iDegree++)
+        biu[iDegree] = SU2_TYPE::GetValue(BlendingFunction[0]->GetBasis(iDegree, ParametricCoord[0][iSurf]));
+      for (unsigned short jDegree = 0; jDegree <= mDegree; jDegree++)
+        bjv[jDegree] = SU2_TYPE::GetValue(BlendingFunction[1]->GetBasis(jDegree, ParametricCoord[1][iSurf]));
+      for (unsigned short kDegree = 0; kDegree <= nDegree; kDegree++)
+        bkw[kDegree] = SU2_TYPE::GetValue(BlendingFunction[2]->GetBasis(kDegree, ParametricCoord[2][iSurf]));
+
+      passivedouble* row = &table[iPoint*nControl];
+      unsigned long c = 0;
+      for (unsigned short iDegree = 0; iDegree <= lDegree; iDegree++) {
+        const passivedouble bi = biu[iDegree];
+        for (unsigned short jDegree = 0; jDegree <= mDegree; jDegree++) {
+          const passivedouble bij = bi*bjv[jDegree];
+          for (unsigned short kDegree = 0; kDegree <= nDegree; kDegree++)
+            row[c++] = bij*bkw[kDegree];
+        }
+      }
+    }
+
+    /*--- Dense accumulation, coord(point,dim) = sum_c table(point,c) * cp(c,dim). ---*/
+
+    for (unsigned long iPoint = 0; iPoint < blockSize; iPoint++) {
+      const passivedouble* row = &table[iPoint*nControl];
+      passivedouble coord[3] = {0.0, 0.0, 0.0};
+      for (unsigned long c = 0; c < nControl; c++)
+        for (unsigned short iDim = 0; iDim < nDim; iDim++)
+          coord[iDim] += row[c]*cp[c*nDim+iDim];
+      for (unsigned short iDim = 0; iDim < nDim; iDim++)
+        BatchCoord[3*(blockBegin+iPoint)+iDim] = coord[iDim];
+    }
+  }
+}
+
 
 su2double *CFreeFormDefBox::GetFFDGradient(su2double *val_coord, su2double *xyz) {
 
@@ -1013,6 +1088,24 @@ bool CFreeFormDefBox::GetPointFFD(CGeometry *geometry, CConfig *config, unsigned
 
   }
 
+  /*--- Bounding-box pre-filter: the tetrahedra of the decomposition below
+   are contained in the axis-aligned bounding box of the corner points, so
+   a point outside of that box cannot be inside the FFD box. This rejects
+   the vast majority of the candidates without evaluating the plane
+   distances of the tetrahedra. ---*/
+
+  for (iDim = 0; iDim < nDim; iDim++) {
+    su2double BoxMin = Coord_Corner_Points[0][iDim];
+    su2double BoxMax = Coord_Corner_Points[0][iDim];
+    for (iVar = 1; iVar < 8; iVar++) {
+      BoxMin = min(BoxMin, Coord_Corner_Points[iVar][iDim]);
+      BoxMax = max(BoxMax, Coord_Corner_Points[iVar][iDim]);
+    }
+    const su2double Margin = EPS*(BoxMax-BoxMin);
+    if ((Coord[iDim] < BoxMin-Margin) || (Coord[iDim] > BoxMax+Margin))
+      return false;
+  }
+
   /*--- 1st tetrahedron {V0, V1, V2, V5}
    2nd tetrahedron {V0, V2, V7, V5}
    3th tetrahedron {V0, V2, V3, V7}
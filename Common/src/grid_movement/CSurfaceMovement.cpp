@@ -735,7 +735,6 @@ void CSurfaceMovement::SetParametricCoord(CGeometry *geometry, CConfig *config,
   unsigned long iVertex, iPoint, TotalVertex = 0;
   su2double *CartCoordNew, *ParamCoord, CartCoord[3], ParamCoordGuess[3], MaxDiff, my_MaxDiff = 0.0, Diff, *Coord;
   unsigned short nDim = geometry->GetnDim();
-  su2double X_0, Y_0, Z_0, Xbar, Ybar, Zbar;
 
   unsigned short BoxFFD = true;
   bool cylindrical = (config->GetFFD_CoordSystem() == CYLINDRICAL);
@@ -783,107 +782,147 @@ void CSurfaceMovement::SetParametricCoord(CGeometry *geometry, CConfig *config,
       for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++)
         TotalVertex++;
 
-  for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
-    if (config->GetMarker_All_DV(iMarker) == YES) {
+  /*--- Flatten the vertices of the DV markers so that the point-in-FFD-box
+   classification can be chunked over the threads. The transformed
+   coordinates are also stored for the point inversion below. ---*/
+
+  vector<unsigned short> Vertex_Marker(TotalVertex);
+  vector<unsigned long> Vertex_Index(TotalVertex);
+  vector<su2double> Vertex_Coord(3*TotalVertex, 0.0);
+  vector<char> Vertex_Inside(TotalVertex, 0);
+
+  unsigned long nVertexDV = 0;
+  for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++)
+    if (config->GetMarker_All_DV(iMarker) == YES)
       for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
+        Vertex_Marker[nVertexDV] = iMarker;
+        Vertex_Index[nVertexDV] = iVertex;
+        nVertexDV++;
+      }
 
-        /*--- Get the cartesian coordinates ---*/
+  /*--- Classify the vertices against the FFD box in parallel, the test only
+   reads the box corners and the grid coordinates. The point inversion stays
+   outside of the parallel region since it uses scratch data stored in the
+   FFD box object. ---*/
 
-        for (iDim = 0; iDim < nDim; iDim++)
-          CartCoord[iDim] = geometry->vertex[iMarker][iVertex]->GetCoord(iDim);
+  SU2_OMP_PARALLEL_(for schedule(dynamic,1024))
+  for (unsigned long jVertex = 0; jVertex < TotalVertex; jVertex++) {
 
-        /*--- Transform the cartesian into polar ---*/
+    const unsigned short jMarker = Vertex_Marker[jVertex];
+    const unsigned long jPoint = geometry->vertex[jMarker][Vertex_Index[jVertex]]->GetNode();
 
-        if (cylindrical) {
-          X_0 = config->GetFFD_Axis(0); Y_0 = config->GetFFD_Axis(1);  Z_0 = config->GetFFD_Axis(2);
+    /*--- Get the cartesian coordinates ---*/
 
-          Xbar =  CartCoord[0] - X_0; Ybar =  CartCoord[1] - Y_0; Zbar =  CartCoord[2] - Z_0;
+    su2double PointCoord[3] = {0.0, 0.0, 0.0};
+    for (unsigned short jDim = 0; jDim < nDim; jDim++)
+      PointCoord[jDim] = geometry->vertex[jMarker][Vertex_Index[jVertex]]->GetCoord(jDim);
 
-          CartCoord[0] = sqrt(Ybar*Ybar + Zbar*Zbar);
-          CartCoord[1] = atan2(Zbar, Ybar); if (CartCoord[1] > PI_NUMBER/2.0) CartCoord[1] -= 2.0*PI_NUMBER;
-          CartCoord[2] = Xbar;
-        }
-        else if (spherical || polar) {
-          X_0 = config->GetFFD_Axis(0); Y_0 = config->GetFFD_Axis(1);  Z_0 = config->GetFFD_Axis(2);
+    /*--- Transform the cartesian into polar ---*/
 
-          Xbar =  CartCoord[0] - X_0; Ybar =  CartCoord[1] - Y_0; Zbar =  CartCoord[2] - Z_0;
+    if (cylindrical) {
+      const su2double xBar = PointCoord[0] - config->GetFFD_Axis(0);
+      const su2double yBar = PointCoord[1] - config->GetFFD_Axis(1);
+      const su2double zBar = PointCoord[2] - config->GetFFD_Axis(2);
 
-          CartCoord[0] = sqrt(Xbar*Xbar + Ybar*Ybar + Zbar*Zbar);
-          CartCoord[1] = atan2(Zbar, Ybar);  if (CartCoord[1] > PI_NUMBER/2.0) CartCoord[1] -= 2.0*PI_NUMBER;
-          CartCoord[2] = acos(Xbar/CartCoord[0]);
-        }
+      PointCoord[0] = sqrt(yBar*yBar + zBar*zBar);
+      PointCoord[1] = atan2(zBar, yBar); if (PointCoord[1] > PI_NUMBER/2.0) PointCoord[1] -= 2.0*PI_NUMBER;
+      PointCoord[2] = xBar;
+    }
+    else if (spherical || polar) {
+      const su2double xBar = PointCoord[0] - config->GetFFD_Axis(0);
+      const su2double yBar = PointCoord[1] - config->GetFFD_Axis(1);
+      const su2double zBar = PointCoord[2] - config->GetFFD_Axis(2);
+
+      PointCoord[0] = sqrt(xBar*xBar + yBar*yBar + zBar*zBar);
+      PointCoord[1] = atan2(zBar, yBar);  if (PointCoord[1] > PI_NUMBER/2.0) PointCoord[1] -= 2.0*PI_NUMBER;
+      PointCoord[2] = acos(xBar/PointCoord[0]);
+    }
 
-        iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+    for (unsigned short jDim = 0; jDim < nDim; jDim++)
+      Vertex_Coord[3*jVertex+jDim] = PointCoord[jDim];
 
-        /*--- If the point is inside the FFD, compute the value of the parametric coordinate ---*/
+    Vertex_Inside[jVertex] = FFDBox->GetPointFFD(geometry, config, jPoint);
 
-        if (FFDBox->GetPointFFD(geometry, config, iPoint)) {
+  }
+  END_SU2_OMP_PARALLEL
 
-          /*--- Find the parametric coordinate ---*/
+  /*--- Compute the parametric coordinates of the points inside the FFD box.
+   Each inversion warm starts from the previous solution, so the points are
+   visited in their original order. ---*/
 
-          ParamCoord = FFDBox->GetParametricCoord_Iterative(iPoint, CartCoord, ParamCoordGuess, config);
+  for (unsigned long jVertex = 0; jVertex < TotalVertex; jVertex++) {
 
-          /*--- Compute the cartesian coordinates using the parametric coordinates
-           to check that everything is correct ---*/
+    if (!Vertex_Inside[jVertex]) continue;
 
-          CartCoordNew = FFDBox->EvalCartesianCoord(ParamCoord);
+    iMarker = Vertex_Marker[jVertex];
+    iVertex = Vertex_Index[jVertex];
+    iPoint  = geometry->vertex[iMarker][iVertex]->GetNode();
 
-          /*--- Compute max difference between original value and the recomputed value ---*/
+    for (iDim = 0; iDim < nDim; iDim++)
+      CartCoord[iDim] = Vertex_Coord[3*jVertex+iDim];
 
-          Diff = 0.0;
-          for (iDim = 0; iDim < nDim; iDim++)
-            Diff += (CartCoordNew[iDim]-CartCoord[iDim])*(CartCoordNew[iDim]-CartCoord[iDim]);
-          Diff = sqrt(Diff);
-          my_MaxDiff = max(my_MaxDiff, Diff);
+    /*--- Find the parametric coordinate ---*/
 
-          /*--- If the parametric coordinates are in (0,1) the point belongs to the FFDBox, using the input tolerance  ---*/
+    ParamCoord = FFDBox->GetParametricCoord_Iterative(iPoint, CartCoord, ParamCoordGuess, config);
 
-          if (((ParamCoord[0] >= - config->GetFFD_Tol()) && (ParamCoord[0] <= 1.0 + config->GetFFD_Tol())) &&
-              ((ParamCoord[1] >= - config->GetFFD_Tol()) && (ParamCoord[1] <= 1.0 + config->GetFFD_Tol())) &&
-              ((ParamCoord[2] >= - config->GetFFD_Tol()) && (ParamCoord[2] <= 1.0 + config->GetFFD_Tol()))) {
+    /*--- Compute the cartesian coordinates using the parametric coordinates
+     to check that everything is correct ---*/
 
+    CartCoordNew = FFDBox->EvalCartesianCoord(ParamCoord);
 
-            /*--- Rectification of the initial tolerance (we have detected situations
-             where 0.0 and 1.0 doesn't work properly ---*/
+    /*--- Compute max difference between original value and the recomputed value ---*/
 
-            su2double lower_limit = config->GetFFD_Tol();
-            su2double upper_limit = 1.0-config->GetFFD_Tol();
+    Diff = 0.0;
+    for (iDim = 0; iDim < nDim; iDim++)
+      Diff += (CartCoordNew[iDim]-CartCoord[iDim])*(CartCoordNew[iDim]-CartCoord[iDim]);
+    Diff = sqrt(Diff);
+    my_MaxDiff = max(my_MaxDiff, Diff);
 
-            if (ParamCoord[0] < lower_limit) ParamCoord[0] = lower_limit;
-            if (ParamCoord[1] < lower_limit) ParamCoord[1] = lower_limit;
-            if (ParamCoord[2] < lower_limit) ParamCoord[2] = lower_limit;
-            if (ParamCoord[0] > upper_limit) ParamCoord[0] = upper_limit;
-            if (ParamCoord[1] > upper_limit) ParamCoord[1] = upper_limit;
-            if (ParamCoord[2] > upper_limit) ParamCoord[2] = upper_limit;
+    /*--- If the parametric coordinates are in (0,1) the point belongs to the FFDBox, using the input tolerance  ---*/
 
-            /*--- Set the value of the parametric coordinate ---*/
+    if (((ParamCoord[0] >= - config->GetFFD_Tol()) && (ParamCoord[0] <= 1.0 + config->GetFFD_Tol())) &&
+        ((ParamCoord[1] >= - config->GetFFD_Tol()) && (ParamCoord[1] <= 1.0 + config->GetFFD_Tol())) &&
+        ((ParamCoord[2] >= - config->GetFFD_Tol()) && (ParamCoord[2] <= 1.0 + config->GetFFD_Tol()))) {
 
-            FFDBox->Set_MarkerIndex(iMarker);
-            FFDBox->Set_VertexIndex(iVertex);
-            FFDBox->Set_PointIndex(iPoint);
-            FFDBox->Set_ParametricCoord(ParamCoord);
-            FFDBox->Set_CartesianCoord(CartCoord);
 
-            ParamCoordGuess[0] = ParamCoord[0]; ParamCoordGuess[1] = ParamCoord[1]; ParamCoordGuess[2] = ParamCoord[2];
+      /*--- Rectification of the initial tolerance (we have detected situations
+       where 0.0 and 1.0 doesn't work properly ---*/
 
-            if (Diff >= config->GetFFD_Tol()) {
-              cout << "Please check this point: Local (" << ParamCoord[0] <<" "<< ParamCoord[1] <<" "<< ParamCoord[2] <<") <-> Global ("
-              << CartCoord[0] <<" "<< CartCoord[1] <<" "<< CartCoord[2] <<") <-> Error "<< Diff <<" vs "<< config->GetFFD_Tol() <<"." << endl;
-            }
+      su2double lower_limit = config->GetFFD_Tol();
+      su2double upper_limit = 1.0-config->GetFFD_Tol();
 
-          }
-          else {
+      if (ParamCoord[0] < lower_limit) ParamCoord[0] = lower_limit;
+      if (ParamCoord[1] < lower_limit) ParamCoord[1] = lower_limit;
+      if (ParamCoord[2] < lower_limit) ParamCoord[2] = lower_limit;
+      if (ParamCoord[0] > upper_limit) ParamCoord[0] = upper_limit;
+      if (ParamCoord[1] > upper_limit) ParamCoord[1] = upper_limit;
+      if (ParamCoord[2] > upper_limit) ParamCoord[2] = upper_limit;
 
-            if (Diff >= config->GetFFD_Tol()) {
-              cout << "Please check this point: Local (" << ParamCoord[0] <<" "<< ParamCoord[1] <<" "<< ParamCoord[2] <<") <-> Global ("
-              << CartCoord[0] <<" "<< CartCoord[1] <<" "<< CartCoord[2] <<") <-> Error "<< Diff <<" vs "<< config->GetFFD_Tol() <<"." << endl;
-            }
+      /*--- Set the value of the parametric coordinate ---*/
 
-          }
+      FFDBox->Set_MarkerIndex(iMarker);
+      FFDBox->Set_VertexIndex(iVertex);
+      FFDBox->Set_PointIndex(iPoint);
+      FFDBox->Set_ParametricCoord(ParamCoord);
+      FFDBox->Set_CartesianCoord(CartCoord);
 
-        }
+      ParamCoordGuess[0] = ParamCoord[0]; ParamCoordGuess[1] = ParamCoord[1]; ParamCoordGuess[2] = ParamCoord[2];
+
+      if (Diff >= config->GetFFD_Tol()) {
+        cout << "Please check this point: Local (" << ParamCoord[0] <<" "<< ParamCoord[1] <<" "<< ParamCoord[2] <<") <-> Global ("
+        << CartCoord[0] <<" "<< CartCoord[1] <<" "<< CartCoord[2] <<") <-> Error "<< Diff <<" vs "<< config->GetFFD_Tol() <<"." << endl;
+      }
+
+    }
+    else {
+
+      if (Diff >= config->GetFFD_Tol()) {
+        cout << "Please check this point: Local (" << ParamCoord[0] <<" "<< ParamCoord[1] <<" "<< ParamCoord[2] <<") <-> Global ("
+        << CartCoord[0] <<" "<< CartCoord[1] <<" "<< CartCoord[2] <<") <-> Error "<< Diff <<" vs "<< config->GetFFD_Tol() <<"." << endl;
       }
+
     }
+
   }
 
 #ifdef HAVE_MPI
@@ -1492,6 +1531,13 @@ su2double CSurfaceMovement::SetCartesianCoord(CGeometry *geometry, CConfig *conf
     }
   }
 
+  /*--- Without derivative recording, all surface points of the box can be
+   evaluated in one batched pass (see CFreeFormDefBox::EvalCartesianCoordBatch). ---*/
+
+  const bool batched = !config->GetAD_Mode() && (config->GetDirectDiff() != D_DESIGN);
+
+  if (batched) FFDBox->EvalCartesianCoordBatch();
+
   /*--- Recompute the cartesians coordinates ---*/
 
   for (iSurfacePoints = 0; iSurfacePoints < FFDBox->GetnSurfacePoint(); iSurfacePoints++) {
@@ -1518,7 +1564,8 @@ su2double CSurfaceMovement::SetCartesianCoord(CGeometry *geometry, CConfig *conf
       /*--- Compute the new cartesian coordinate, and set the value in
        the FFDBox structure ---*/
 
-      CartCoordNew = FFDBox->EvalCartesianCoord(ParamCoord);
+      CartCoordNew = batched ? FFDBox->GetBatchCartesianCoord(iSurfacePoints)
+                             : FFDBox->EvalCartesianCoord(ParamCoord);
 
       /*--- If polar coordinates, compute the cartesians from the polar value ---*/
 
@@ -83,6 +83,10 @@ void CVolumetricMovement::UpdateGridCoord(CGeometry *geometry, CConfig *config)
   geometry->InitiateComms(geometry, config, COORDINATES);
   geometry->CompleteComms(geometry, config, COORDINATES);
 
+  /*--- Cached gradient coefficients are no longer usable. ---*/
+
+  geometry->InvalidateLSQCoeffCache();
+
 }
 
 void CVolumetricMovement::UpdateDualGrid(CGeometry *geometry, CConfig *config) {
@@ -133,6 +137,18 @@ void CVolumetricMovement::SetVolume_Deformation(CGeometry *geometry, CConfig *co
 
   if (Derivative) Nonlinear_Iter = 1;
 
+  /*--- In the small-deformation setting the stiffness matrix depends only on the undeformed
+   mesh. If requested, the assembled matrix (and the preconditioner factorization it stores)
+   is reused across calls and increments, so that only the RHS setup and the solve remain per
+   deformation. The cache is invalidated once the accumulated deformation is no longer small
+   compared to the mesh dimensions. The transposed solves of the projection (SU2_DOT) modify
+   the matrix in place and therefore always reassemble. ---*/
+
+  const bool transposedSolve = Derivative && (config->GetKind_SU2() == SU2_COMPONENT::SU2_DOT);
+  const bool reuseStiffness = config->GetDeform_ReuseStiffness() && !transposedSolve;
+
+  if (!reuseStiffness) stiffnessReady = false;
+
   /*--- Loop over the total number of grid deformation iterations. The surface
    deformation can be divided into increments to help with stability. In
    particular, the linear elasticity equations hold only for small deformations. ---*/
@@ -143,13 +159,43 @@ void CVolumetricMovement::SetVolume_Deformation(CGeometry *geometry, CConfig *co
 
     LinSysSol.SetValZero();
     LinSysRes.SetValZero();
-    StiffMatrix.SetValZero();
 
-    /*--- Compute the stiffness matrix entries for all nodes/elements in the
-     mesh. FEA uses a finite element method discretization of the linear
-     elasticity equations (transfers element stiffnesses to point-to-point). ---*/
+    if (!stiffnessReady) {
+
+      StiffMatrix.SetValZero();
 
-    MinVolume = SetFEAMethodContributions_Elem(geometry, config);
+      /*--- Compute the stiffness matrix entries for all nodes/elements in the
+       mesh. FEA uses a finite element method discretization of the linear
+       elasticity equations (transfers element stiffnesses to point-to-point). ---*/
+
+      MinVolume = SetFEAMethodContributions_Elem(geometry, config);
+      cachedMinVolume = MinVolume;
+
+      /*--- Reference length (bounding-box diagonal) used to decide when the accumulated
+       deformation invalidates the cached matrix. ---*/
+
+      if (reuseStiffness) {
+        su2double minCoord[3] = {1e30, 1e30, 1e30}, maxCoord[3] = {-1e30, -1e30, -1e30};
+        for (auto iPoint = 0ul; iPoint < nPointDomain; iPoint++) {
+          for (auto iDim = 0u; iDim < nDim; iDim++) {
+            minCoord[iDim] = min(minCoord[iDim], geometry->nodes->GetCoord(iPoint, iDim));
+            maxCoord[iDim] = max(maxCoord[iDim], geometry->nodes->GetCoord(iPoint, iDim));
+          }
+        }
+        su2double bbox[3] = {0.0};
+        SU2_MPI::Allreduce(minCoord, bbox, nDim, MPI_DOUBLE, MPI_MIN, SU2_MPI::GetComm());
+        for (auto iDim = 0u; iDim < nDim; iDim++) minCoord[iDim] = bbox[iDim];
+        SU2_MPI::Allreduce(maxCoord, bbox, nDim, MPI_DOUBLE, MPI_MAX, SU2_MPI::GetComm());
+        stiffnessRefLength = 0.0;
+        for (auto iDim = 0u; iDim < nDim; iDim++)
+          stiffnessRefLength += pow(SU2_TYPE::GetValue(bbox[iDim] - minCoord[iDim]), 2);
+        stiffnessRefLength = sqrt(stiffnessRefLength);
+        accumDeformation = 0.0;
+      }
+    }
+    else {
+      MinVolume = cachedMinVolume;
+    }
 
     /*--- Set the boundary and volume displacements (as prescribed by the
      design variable perturbations controlling the surface shape)
@@ -180,6 +226,9 @@ void CVolumetricMovement::SetVolume_Deformation(CGeometry *geometry, CConfig *co
     /*--- To keep legacy behavior ---*/
     System.SetToleranceType(LinearToleranceType::RELATIVE);
 
+    /*--- Reuse the preconditioner factorization if the matrix was not reassembled. ---*/
+    System.SetRecomputePreconditioner(!stiffnessReady);
+
     /*--- If we want no derivatives or the direct derivatives, we solve the system using the
      * normal matrix vector product and preconditioner. For the mesh sensitivities using
      * the discrete adjoint method we solve the system using the transposed matrix. ---*/
@@ -193,6 +242,25 @@ void CVolumetricMovement::SetVolume_Deformation(CGeometry *geometry, CConfig *co
     }
     su2double Residual = System.GetResidual();
 
+    /*--- The matrix (and the factorization it stores) is now valid for further solves. ---*/
+
+    stiffnessReady = reuseStiffness;
+
+    /*--- Track the accumulated deformation and invalidate the cached matrix once it stops
+     being small compared to the mesh, the linear elasticity assumption no longer holds. ---*/
+
+    if (reuseStiffness && !Derivative) {
+      su2double maxDisp = 0.0;
+      for (auto iPoint = 0ul; iPoint < nPointDomain; iPoint++)
+        for (auto iDim = 0u; iDim < nDim; iDim++)
+          maxDisp = max(maxDisp, fabs(LinSysSol[iPoint*nDim+iDim]));
+      su2double maxDispGlobal = 0.0;
+      SU2_MPI::Allreduce(&maxDisp, &maxDispGlobal, 1, MPI_DOUBLE, MPI_MAX, SU2_MPI::GetComm());
+      accumDeformation += SU2_TYPE::GetValue(maxDispGlobal);
+
+      if (accumDeformation > 0.01*stiffnessRefLength) stiffnessReady = false;
+    }
+
     /*--- Update the grid coordinates and cell volumes using the solution
      of the linear system (usol contains the x, y, z displacements). ---*/
 
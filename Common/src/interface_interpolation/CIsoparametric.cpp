@@ -27,9 +27,11 @@
 
 #include "../../include/interface_interpolation/CIsoparametric.hpp"
 #include "../../include/CConfig.hpp"
+#include "../../include/adt/CADTPointsOnlyClass.hpp"
 #include "../../include/geometry/CGeometry.hpp"
 #include "../../include/geometry/elements/CElement.hpp"
 #include "../../include/toolboxes/geometry_toolbox.hpp"
+#include <numeric>
 #include <unordered_map>
 
 using namespace GeometryToolbox;
@@ -153,34 +155,64 @@ void CIsoparametric::SetTransferCoeff(const CConfig* const* config) {
       }
     }
 
+    /*--- Build an ADT of the compressed donor vertices, the tree is local since
+     *    the donor information was already gathered on all ranks. The "point IDs"
+     *    are the compressed donor indices. ---*/
+
+    vector<unsigned long> donorIndex(nGlobalVertexDonor);
+    iota(donorIndex.begin(), donorIndex.end(), 0ul);
+
+    CADTPointsOnlyClass donorVertexADT(nDim, nGlobalVertexDonor, donorCoord.data(),
+                                       donorIndex.data(), false);
+
+    /*--- Determine the closest donor vertex for all owned target points in one
+     *    batched query (sorted along a space-filling curve and parallelized
+     *    internally), instead of a linear scan over the donor vertices per
+     *    target point. ---*/
+
+    vector<unsigned long> queryVertex;
+    queryVertex.reserve(nVertexTarget);
+    vector<su2double> queryCoord;
+    queryCoord.reserve(nVertexTarget*nDim);
+
+    for (auto iVertexTarget = 0u; iVertexTarget < nVertexTarget; ++iVertexTarget) {
+      const auto iPoint = target_geometry->vertex[markTarget][iVertexTarget]->GetNode();
+      if (!target_geometry->nodes->GetDomain(iPoint)) continue;
+      queryVertex.push_back(iVertexTarget);
+      const su2double* coord_i = target_geometry->nodes->GetCoord(iPoint);
+      for (int iDim = 0; iDim < nDim; ++iDim) queryCoord.push_back(coord_i[iDim]);
+    }
+    const auto nQueries = queryVertex.size();
+
+    vector<su2double> donorDist(nQueries);
+    vector<unsigned long> closestVertex(nQueries);
+    vector<int> closestRank(nQueries);
+
+    donorVertexADT.DetermineNearestNodes(nQueries, queryCoord.data(), donorDist.data(),
+                                         closestVertex.data(), closestRank.data());
+
     /*--- Compute transfer coefficients for each target point. ---*/
     SU2_OMP_PARALLEL
     {
     su2double maxDist = 0.0;
     unsigned long errorCount = 0, totalCount = 0;
 
-    SU2_OMP_FOR_DYN(roundUpDiv(nVertexTarget,2*omp_get_max_threads()))
-    for (auto iVertexTarget = 0u; iVertexTarget < nVertexTarget; ++iVertexTarget) {
+    SU2_OMP_FOR_DYN(roundUpDiv(nQueries,2*omp_get_max_threads()))
+    for (auto iQuery = 0ul; iQuery < nQueries; ++iQuery) {
 
+      const auto iVertexTarget = queryVertex[iQuery];
       auto& target_vertex = targetVertices[markTarget][iVertexTarget];
       const auto iPoint = target_geometry->vertex[markTarget][iVertexTarget]->GetNode();
 
-      if (!target_geometry->nodes->GetDomain(iPoint)) continue;
       totalCount += 1;
 
       /*--- Coordinates of the target point. ---*/
       const su2double* coord_i = target_geometry->nodes->GetCoord(iPoint);
 
-      /*--- Find the closest donor vertex. ---*/
-      su2double minDist = 1e9;
-      unsigned iClosestVertex = 0;
-      for (auto iVertexDonor = 0u; iVertexDonor < nGlobalVertexDonor; ++iVertexDonor) {
-        su2double d = SquaredDistance(nDim, coord_i, donorCoord[iVertexDonor]);
-        if (d < minDist) {
-          minDist = d;
-          iClosestVertex = iVertexDonor;
-        }
-      }
+      /*--- Closest donor vertex from the batched ADT query, the
+       *    returned distance is not squared. ---*/
+      const auto iClosestVertex = closestVertex[iQuery];
+      const su2double minDist = pow(donorDist[iQuery], 2);
 
       if (minDist < matchingVertexTol) {
         /*--- Perfect match. ---*/
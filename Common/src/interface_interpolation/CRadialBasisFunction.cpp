@@ -61,6 +61,10 @@ void CRadialBasisFunction::PrintStatistics() const {
   else if (MaxCorrection < 2.0 && AvgCorrection < 1.05) cout << " (warning)\n";
   else cout << " <<< WARNING >>>\n";
   cout << "  Interpolation matrix is " << Density << "% dense." << endl;
+  if (nTotalDonorPoints > 0) {
+    cout << "  Greedy selection kept " << nControlPoints << " of " << nTotalDonorPoints
+         << " donor points (max fill distance: " << MaxFillDistance << ")." << endl;
+  }
   cout.unsetf(ios::floatfield);
 }
 
@@ -102,6 +106,11 @@ void CRadialBasisFunction::SetTransferCoeff(const CConfig* const* config) {
   const su2double paramRBF = config[donorZone]->GetRadialBasisFunctionParameter();
   const su2double pruneTol = config[donorZone]->GetRadialBasisFunctionPruneTol();
 
+  /*--- Greedy control point selection options, the fill tolerance is relative to the radius. ---*/
+  const auto maxControlPoints = config[donorZone]->GetRadialBasisFunctionMaxControlPoints();
+  const auto fillTol = SU2_TYPE::GetValue(paramRBF * config[donorZone]->GetRadialBasisFunctionFillTol());
+  const bool useGreedy = (maxControlPoints > 0) || (fillTol > 0.0);
+
   const auto nMarkerInt = config[donorZone]->GetMarker_n_ZoneInterface()/2;
   const int nDim = donor_geometry->GetnDim();
 
@@ -204,13 +213,36 @@ void CRadialBasisFunction::SetTransferCoeff(const CConfig* const* config) {
   vector<int> nPolynomialVec(nMarkerInt,-1);
   vector<vector<int> > keepPolynomialRowVec(nMarkerInt, vector<int>(nDim,1));
   vector<su2passivematrix> CinvTrucVec(nMarkerInt);
+  vector<vector<unsigned long> > controlIndexVec(nMarkerInt);
+  vector<passivedouble> fillDistanceVec(nMarkerInt, 0.0);
 
   SU2_OMP_PARALLEL_(for schedule(dynamic,1))
   for (unsigned short iMarkerInt = 0; iMarkerInt < nMarkerInt; ++iMarkerInt) {
     if (rank == assignedProcessor[iMarkerInt]) {
-      ComputeGeneratorMatrix(kindRBF, usePolynomial, paramRBF,
-                             donorCoordinates[iMarkerInt], nPolynomialVec[iMarkerInt],
-                             keepPolynomialRowVec[iMarkerInt], CinvTrucVec[iMarkerInt]);
+
+      /*--- Greedy mode: select the control point subset and assemble/factor the dense
+       *    interpolation system only for it, instead of for all donor points. ---*/
+      if (useGreedy) {
+        controlIndexVec[iMarkerInt] = SelectControlPoints(donorCoordinates[iMarkerInt], fillTol,
+                                                          maxControlPoints, fillDistanceVec[iMarkerInt]);
+      }
+      const auto& controlIndex = controlIndexVec[iMarkerInt];
+
+      if (controlIndex.empty()) {
+        ComputeGeneratorMatrix(kindRBF, usePolynomial, paramRBF,
+                               donorCoordinates[iMarkerInt], nPolynomialVec[iMarkerInt],
+                               keepPolynomialRowVec[iMarkerInt], CinvTrucVec[iMarkerInt]);
+      }
+      else {
+        su2activematrix controlCoord(controlIndex.size(), nDim);
+        for (auto i = 0ul; i < controlIndex.size(); ++i)
+          for (int iDim = 0; iDim < nDim; ++iDim)
+            controlCoord(i,iDim) = donorCoordinates[iMarkerInt](controlIndex[i],iDim);
+
+        ComputeGeneratorMatrix(kindRBF, usePolynomial, paramRBF,
+                               controlCoord, nPolynomialVec[iMarkerInt],
+                               keepPolynomialRowVec[iMarkerInt], CinvTrucVec[iMarkerInt]);
+      }
     }
   }
   END_SU2_OMP_PARALLEL
@@ -241,6 +273,40 @@ void CRadialBasisFunction::SetTransferCoeff(const CConfig* const* config) {
     auto& C_inv_trunc = CinvTrucVec[iMarkerInt];
     auto& nPolynomial = nPolynomialVec[iMarkerInt];
     auto& keepPolynomialRow = keepPolynomialRowVec[iMarkerInt];
+    auto& controlIndex = controlIndexVec[iMarkerInt];
+
+    const auto nDonorTotal = donorCoord.rows();
+
+    /*--- In greedy mode the assigned rank shares the selected control points, and
+     *    the donor information is compacted so that only the control points act as
+     *    donors, the rest of this loop then works on the reduced set. ---*/
+    if (useGreedy) {
+#ifdef HAVE_MPI
+      unsigned long nControl = controlIndex.size();
+      SU2_MPI::Bcast(&nControl, 1, MPI_UNSIGNED_LONG, iProcessor, SU2_MPI::GetComm());
+      controlIndex.resize(nControl);
+      if (nControl > 0)
+        SU2_MPI::Bcast(controlIndex.data(), nControl, MPI_UNSIGNED_LONG, iProcessor, SU2_MPI::GetComm());
+#endif
+      if (!controlIndex.empty()) {
+        su2activematrix coordSub(controlIndex.size(), nDim);
+        for (auto i = 0ul; i < controlIndex.size(); ++i) {
+          for (int iDim = 0; iDim < nDim; ++iDim)
+            coordSub(i,iDim) = donorCoord(controlIndex[i],iDim);
+          donorPoint[i] = donorPoint[controlIndex[i]];
+          donorProc[i] = donorProc[controlIndex[i]];
+        }
+        donorCoord = std::move(coordSub);
+        donorPoint.resize(controlIndex.size());
+        donorProc.resize(controlIndex.size());
+      }
+      /*--- Selection statistics, only on the rank that made the selection. ---*/
+      if (rank == iProcessor) {
+        nTotalDonorPoints += nDonorTotal;
+        nControlPoints += controlIndex.empty()? nDonorTotal : controlIndex.size();
+        MaxFillDistance = max(MaxFillDistance, fillDistanceVec[iMarkerInt]);
+      }
+    }
 
     const auto nGlobalVertexDonor = donorCoord.rows();
 
@@ -408,10 +474,13 @@ void CRadialBasisFunction::SetTransferCoeff(const CConfig* const* config) {
   Reduce(MPI_SUM, denseSize);
   Reduce(MPI_MIN, MinDonors);
   Reduce(MPI_MAX, MaxDonors);
+  Reduce(MPI_SUM, nControlPoints);
+  Reduce(MPI_SUM, nTotalDonorPoints);
 #ifdef HAVE_MPI
-  passivedouble tmp1 = AvgCorrection, tmp2 = MaxCorrection;
+  passivedouble tmp1 = AvgCorrection, tmp2 = MaxCorrection, tmp3 = MaxFillDistance;
   MPI_Allreduce(&tmp1, &AvgCorrection, 1, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
   MPI_Allreduce(&tmp2, &MaxCorrection, 1, MPI_DOUBLE, MPI_MAX, SU2_MPI::GetComm());
+  MPI_Allreduce(&tmp3, &MaxFillDistance, 1, MPI_DOUBLE, MPI_MAX, SU2_MPI::GetComm());
 #endif
   if (totalTargetPoints == 0)
     SU2_MPI::Error("Somehow there are no target interpolation points.", CURRENT_FUNCTION);
@@ -429,6 +498,73 @@ void CRadialBasisFunction::SetTransferCoeff(const CConfig* const* config) {
 
 }
 
+vector<unsigned long> CRadialBasisFunction::SelectControlPoints(const su2activematrix& coords,
+                                                                passivedouble tolDist, unsigned long maxPoints,
+                                                                passivedouble& fillDistance) {
+  const auto nPoint = coords.rows();
+  const int nDim = coords.cols();
+  if (maxPoints == 0 || maxPoints > nPoint) maxPoints = nPoint;
+
+  /*--- Deterministic seed, the point closest to the centroid. ---*/
+  vector<passivedouble> centroid(nDim, 0.0);
+  for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint)
+    for (int iDim = 0; iDim < nDim; ++iDim)
+      centroid[iDim] += SU2_TYPE::GetValue(coords(iPoint,iDim));
+  for (int iDim = 0; iDim < nDim; ++iDim) centroid[iDim] /= nPoint;
+
+  auto seed = 0ul;
+  passivedouble minDist = numeric_limits<passivedouble>::max();
+  for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint) {
+    passivedouble d2 = 0.0;
+    for (int iDim = 0; iDim < nDim; ++iDim) {
+      const auto d = SU2_TYPE::GetValue(coords(iPoint,iDim)) - centroid[iDim];
+      d2 += d*d;
+    }
+    if (d2 < minDist) { minDist = d2; seed = iPoint; }
+  }
+
+  /*--- Farthest point iteration, minDistSq tracks the squared distance of every
+   *    point to its nearest control point, its maximum is the fill distance. ---*/
+  vector<passivedouble> minDistSq(nPoint);
+  vector<unsigned long> selected;
+  selected.reserve(maxPoints);
+
+  auto newPoint = seed;
+  fillDistance = 0.0;
+
+  while (true) {
+    selected.push_back(newPoint);
+
+    auto nextPoint = 0ul;
+    passivedouble maxMinDistSq = 0.0;
+    for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint) {
+      passivedouble d2 = 0.0;
+      for (int iDim = 0; iDim < nDim; ++iDim) {
+        const auto d = SU2_TYPE::GetValue(coords(iPoint,iDim) - coords(newPoint,iDim));
+        d2 += d*d;
+      }
+      if (selected.size() == 1) minDistSq[iPoint] = d2;
+      else minDistSq[iPoint] = min(minDistSq[iPoint], d2);
+
+      if (minDistSq[iPoint] > maxMinDistSq) {
+        maxMinDistSq = minDistSq[iPoint];
+        nextPoint = iPoint;
+      }
+    }
+    fillDistance = sqrt(maxMinDistSq);
+
+    if ((fillDistance <= tolDist) || (selected.size() == maxPoints)) break;
+    newPoint = nextPoint;
+  }
+
+  /*--- All points selected, signal that no reduction is possible. ---*/
+  if (selected.size() == nPoint) return {};
+
+  /*--- Restore the global point ordering of the donors (matrix conditioning). ---*/
+  sort(selected.begin(), selected.end());
+  return selected;
+}
+
 void CRadialBasisFunction::ComputeGeneratorMatrix(RADIAL_BASIS type, bool usePolynomial,
                            su2double radius, const su2activematrix& coords, int& nPolynomial,
                            vector<int>& keepPolynomialRow, su2passivematrix& C_inv_trunc) {
@@ -27,9 +27,13 @@
 
 #include "../../include/interface_interpolation/CSlidingMesh.hpp"
 #include "../../include/CConfig.hpp"
+#include "../../include/adt/CADTPointsOnlyClass.hpp"
 #include "../../include/geometry/CGeometry.hpp"
 #include "../../include/toolboxes/geometry_toolbox.hpp"
 
+#include <numeric>
+#include <unordered_map>
+
 
 CSlidingMesh::CSlidingMesh(CGeometry ****geometry_container, const CConfig* const* config,
                            unsigned int iZone, unsigned int jZone) :
@@ -60,7 +64,8 @@ void CSlidingMesh::SetTransferCoeff(const CConfig* const* config) {
 
   /* --- Geometrical variables --- */
 
-  su2double *Coord_i, *Coord_j, dist, mindist, *Normal;
+  su2double *Coord_i, mindist, *Normal;
+  int rankID;
   su2double Area, Area_old, tmp_Area;
   su2double LineIntersectionLength, *Direction, length;
 
@@ -170,6 +175,23 @@ void CSlidingMesh::SetTransferCoeff(const CConfig* const* config) {
     Donor_LinkedNodes      = Buffer_Receive_LinkedNodes;
     Donor_Proc             = Buffer_Receive_Proc;
 
+    /*--- Build an ADT of the reconstructed donor boundary to accelerate the
+          closest donor searches. As the boundary was gathered on all ranks,
+          the tree is built as a local tree containing all donor points. ---*/
+
+    vector<unsigned long> DonorPointIDs(nGlobalVertex_Donor);
+    iota(DonorPointIDs.begin(), DonorPointIDs.end(), 0ul);
+
+    CADTPointsOnlyClass DonorADT(nDim, nGlobalVertex_Donor, DonorPoint_Coord.data(),
+                                 DonorPointIDs.data(), false);
+
+    /*--- Map the global index of the target boundary points to their index in
+          the reconstructed boundary, to avoid a linear search per vertex. ---*/
+
+    unordered_map<unsigned long, unsigned long> Target_GlobalIndex;
+    for (iVertex = 0; iVertex < nGlobalVertex_Target; iVertex++)
+      Target_GlobalIndex[Target_GlobalPoint[iVertex]] = iVertex;
+
     /*--- Starts building the supermesh layer (2D or 3D) ---*/
     /* - For each target node, it first finds the closest donor point
      * - Then it creates the supermesh in the close proximity of the target point:
@@ -202,27 +224,9 @@ void CSlidingMesh::SetTransferCoeff(const CConfig* const* config) {
 
           Coord_i = target_geometry->nodes->GetCoord(target_iPoint);
 
-          /*--- Brute force to find the closest donor_node ---*/
+          /*--- Find the closest donor node through the ADT ---*/
 
-          mindist = 1E6;
-          donor_StartIndex = 0;
-
-          for (donor_iPoint = 0; donor_iPoint < nGlobalVertex_Donor; donor_iPoint++) {
-
-            Coord_j = DonorPoint_Coord[ donor_iPoint ];
-
-            dist = GeometryToolbox::Distance(nDim, Coord_i, Coord_j);
-
-            if (dist < mindist) {
-              mindist = dist;
-              donor_StartIndex = donor_iPoint;
-            }
-
-            if (dist == 0.0){
-              donor_StartIndex = donor_iPoint;
-              break;
-            }
-          }
+          DonorADT.DetermineNearestNode(Coord_i, mindist, donor_StartIndex, rankID);
 
           donor_iPoint    = donor_StartIndex;
           donor_OldiPoint = donor_iPoint;
@@ -230,9 +234,7 @@ void CSlidingMesh::SetTransferCoeff(const CConfig* const* config) {
           /*--- Contruct information regarding the target cell ---*/
 
           auto dPoint = target_geometry->nodes->GetGlobalIndex(target_iPoint);
-          for (jVertexTarget = 0; jVertexTarget < nGlobalVertex_Target; jVertexTarget++)
-            if( dPoint == Target_GlobalPoint[jVertexTarget] )
-              break;
+          jVertexTarget = Target_GlobalIndex.at(dPoint);
 
           if ( Target_nLinkedNodes[jVertexTarget] == 1 ){
             target_segment[0] = Target_LinkedNodes[ Target_StartLinkedNodes[jVertexTarget] ];
@@ -465,10 +467,7 @@ void CSlidingMesh::SetTransferCoeff(const CConfig* const* config) {
           Coord_i[iDim] = target_geometry->nodes->GetCoord(target_iPoint, iDim);
 
         auto dPoint = target_geometry->nodes->GetGlobalIndex(target_iPoint);
-        for (target_iPoint = 0; target_iPoint < nGlobalVertex_Target; target_iPoint++){
-          if( dPoint == Target_GlobalPoint[target_iPoint] )
-            break;
-        }
+        target_iPoint = Target_GlobalIndex.at(dPoint);
 
         /*--- Build local surface dual mesh for target element ---*/
 
@@ -483,27 +482,9 @@ void CSlidingMesh::SetTransferCoeff(const CConfig* const* config) {
         nNode_target = Build_3D_surface_element(Target_LinkedNodes, Target_StartLinkedNodes, Target_nLinkedNodes,
                                                 TargetPoint_Coord, target_iPoint, target_element);
 
-        /*--- Brute force to find the closest donor_node ---*/
-
-        mindist = 1E6;
-        donor_StartIndex = 0;
-
-        for (donor_iPoint = 0; donor_iPoint < nGlobalVertex_Donor; donor_iPoint++) {
-
-          Coord_j = DonorPoint_Coord[ donor_iPoint ];
+        /*--- Find the closest donor node through the ADT ---*/
 
-          dist = GeometryToolbox::Distance(nDim, Coord_i, Coord_j);
-
-          if (dist < mindist) {
-            mindist = dist;
-            donor_StartIndex = donor_iPoint;
-          }
-
-          if (dist == 0.0){
-            donor_StartIndex = donor_iPoint;
-            break;
-          }
-        }
+        DonorADT.DetermineNearestNode(Coord_i, mindist, donor_StartIndex, rankID);
 
         donor_iPoint = donor_StartIndex;
 
@@ -29,8 +29,10 @@
 
 #include "../../include/geometry/CGeometry.hpp"
 #include "../../include/toolboxes/allocation_toolbox.hpp"
+#include "../../include/toolboxes/graph_toolbox.hpp"
 
 #include <cmath>
+#include <limits>
 
 template<class ScalarType>
 CSysMatrix<ScalarType>::CSysMatrix() :
@@ -41,6 +43,7 @@ CSysMatrix<ScalarType>::CSysMatrix() :
   nnz = nnz_ilu = 0;
   ilu_fill_in = 0;
   nLinelet = 0;
+  nColors = 0;
 
   omp_partitions    = nullptr;
 
@@ -64,11 +67,26 @@ CSysMatrix<ScalarType>::CSysMatrix() :
   MatrixVectorProductJitterAlphaMinusOne = nullptr;
 #endif
 
+#ifdef CSYSMATRIX_OMP_OFFLOAD
+  deviceDataMapped     = false;
+  deviceMatrixUpToDate = false;
+  deviceInvMUpToDate   = false;
+#endif
+
 }
 
 template<class ScalarType>
 CSysMatrix<ScalarType>::~CSysMatrix(void) {
 
+#ifdef CSYSMATRIX_OMP_OFFLOAD
+  if (deviceDataMapped) {
+    #pragma omp target exit data map(delete: row_ptr[:nPointDomain+1], col_ind[:nnz], matrix[:nnz*nVar*nEqn])
+    if (invM != nullptr) {
+      #pragma omp target exit data map(delete: invM[:nPointDomain*nVar*nEqn])
+    }
+  }
+#endif
+
   delete [] omp_partitions;
   MemoryAllocation::aligned_free(ILU_matrix);
   MemoryAllocation::aligned_free(matrix);
@@ -141,6 +159,24 @@ void CSysMatrix<ScalarType>::Initialize(unsigned long npoint, unsigned long npoi
   col_ind = csr.innerIdx();
   dia_ptr = csr.diagPtr();
 
+#ifdef USE_COMPACT_INDEX
+  /*--- Compact (32 bit) copy of the column indices for the bandwidth-bound
+   *    products. The pattern itself stays 64 bit as it is shared through
+   *    CGeometry with consumers that need the full range. ---*/
+  if (nPoint > numeric_limits<su2localidx>::max())
+    SU2_MPI::Error("The number of local points exceeds the range of the compact index build.", CURRENT_FUNCTION);
+
+  col_ind_compact.resize(nnz);
+  SU2_OMP_PARALLEL {
+    SU2_OMP_FOR_STAT(roundUpDiv(nnz, 2ul*omp_get_max_threads()))
+    for (auto k = 0ul; k < nnz; ++k) col_ind_compact(k) = col_ind[k];
+    END_SU2_OMP_FOR
+  } END_SU2_OMP_PARALLEL
+  col_ind_prod = col_ind_compact.data();
+#else
+  col_ind_prod = col_ind;
+#endif
+
   if (needTranspPtr)
     col_ptr = geometry->GetTransposeSparsePatternMap(type).data();
 
@@ -161,11 +197,28 @@ void CSysMatrix<ScalarType>::Initialize(unsigned long npoint, unsigned long npoi
     col_ind_ilu = csr_ilu.innerIdx();
     dia_ptr_ilu = csr_ilu.diagPtr();
     nnz_ilu = csr_ilu.getNumNonZeros();
+
+    iluLevelSched = config->GetLinear_Solver_ILU_LevelSched();
+
+    /*--- Incremental refresh relies on ILU0 sharing the matrix sparsity. ---*/
+    if (ilu_fill_in == 0)
+      iluRefreshTol = SU2_TYPE::GetValue(config->GetLinear_Solver_ILU_RefreshTol());
   }
 
-  /*--- Allocate data. ---*/
+  /*--- Allocate data. The zero initialization doubles as a NUMA-aware first
+   *    touch: the pages are touched in parallel with the same even static
+   *    chunking used by SetValZero and the linear algebra kernels, such that
+   *    on multi-socket machines they are mapped to the memory of the socket
+   *    of the thread that operates on them, instead of the whole allocation
+   *    being committed to the socket of the master thread. ---*/
   auto allocAndInit = [](ScalarType*& ptr, unsigned long num) {
-    ptr = MemoryAllocation::aligned_alloc<ScalarType,true>(64, num*sizeof(ScalarType));
+    ptr = MemoryAllocation::aligned_alloc<ScalarType>(64, num*sizeof(ScalarType));
+
+    SU2_OMP_PARALLEL {
+      const auto chunk = roundUpDiv(num, (unsigned long)omp_get_num_threads());
+      const auto begin = chunk * omp_get_thread_num();
+      if (begin < num) memset(&ptr[begin], 0, min(chunk, num-begin)*sizeof(ScalarType));
+    } END_SU2_OMP_PARALLEL
   };
 
   allocAndInit(matrix, nnz*nVar*nEqn);
@@ -176,6 +229,29 @@ void CSysMatrix<ScalarType>::Initialize(unsigned long npoint, unsigned long npoi
 
   if (diag_needed) allocAndInit(invM, nPointDomain*nVar*nEqn);
 
+  /*--- Diagnostic report of the achieved page placement. ---*/
+
+  if (config->GetNumaDiagnostics()) {
+    MemoryAllocation::ReportNumaPlacement(matrix, nnz*nVar*nEqn*sizeof(ScalarType), "CSysMatrix matrix");
+    if (ilu_needed)
+      MemoryAllocation::ReportNumaPlacement(ILU_matrix, nnz_ilu*nVar*nEqn*sizeof(ScalarType), "CSysMatrix ILU");
+    if (diag_needed)
+      MemoryAllocation::ReportNumaPlacement(invM, nPointDomain*nVar*nEqn*sizeof(ScalarType), "CSysMatrix invM");
+  }
+
+#ifdef CSYSMATRIX_OMP_OFFLOAD
+  /*--- Mirror the sparsity and allocate device storage for the matrix data,
+   *    uploads happen lazily before the first product after a modification. ---*/
+  if (omp_get_num_devices() > 0) {
+    #pragma omp target enter data map(to: row_ptr[:nPointDomain+1], col_ind[:nnz]) \
+                                  map(alloc: matrix[:nnz*nVar*nEqn])
+    if (invM != nullptr) {
+      #pragma omp target enter data map(alloc: invM[:nPointDomain*nVar*nEqn])
+    }
+    deviceDataMapped = true;
+  }
+#endif
+
   /*--- Thread parallel initialization. ---*/
 
   int num_threads = omp_get_max_threads();
@@ -485,16 +561,27 @@ void CSysMatrixComms::Complete(CSysVector<T>& x, CGeometry *geometry,
 
 template<class ScalarType>
 void CSysMatrix<ScalarType>::SetValZero() {
+  if (frozen) return;
   const auto size = nnz*nVar*nEqn;
   const auto chunk = roundUpDiv(size,omp_get_num_threads());
   const auto begin = chunk * omp_get_thread_num();
   const auto mySize = min(chunk, size-begin) * sizeof(ScalarType);
   memset(&matrix[begin], 0, mySize);
   SU2_OMP_BARRIER
+
+#ifdef CSYSMATRIX_OMP_OFFLOAD
+  /*--- The matrix is about to be rebuilt, invalidate the device mirrors. ---*/
+  SU2_OMP_MASTER {
+    deviceMatrixUpToDate = false;
+    deviceInvMUpToDate = false;
+  }
+  END_SU2_OMP_MASTER
+#endif
 }
 
 template<class ScalarType>
 void CSysMatrix<ScalarType>::SetValDiagonalZero() {
+  if (frozen) return;
   SU2_OMP_FOR_STAT(omp_heavy_size)
   for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint)
     for (auto index = 0ul; index < nVar*nEqn; ++index)
@@ -502,6 +589,154 @@ void CSysMatrix<ScalarType>::SetValDiagonalZero() {
   END_SU2_OMP_FOR
 }
 
+namespace {
+
+/*--- Versions of the dense linear solves with the block size known at
+ compilation, see gemv_stat in CSysMatrix.inl for the rationale. ---*/
+
+template<class T, unsigned long N>
+FORCEINLINE void gauss_elimination_stat(T* matrix, T* vec) {
+#define A(I,J) matrix[(I)*N+(J)]
+  /*--- Transform system in Upper Matrix ---*/
+  for (auto iVar = 1ul; iVar < N; iVar++) {
+    for (auto jVar = 0ul; jVar < iVar; jVar++) {
+      T weight = A(iVar,jVar) / A(jVar,jVar);
+      for (auto kVar = jVar; kVar < N; kVar++)
+        A(iVar,kVar) -= weight * A(jVar,kVar);
+      vec[iVar] -= weight * vec[jVar];
+    }
+  }
+
+  /*--- Backwards substitution ---*/
+  for (auto iVar = N; iVar > 0ul;) {
+    iVar--; // unsigned type
+    for (auto jVar = iVar+1; jVar < N; jVar++)
+      vec[iVar] -= A(iVar,jVar) * vec[jVar];
+    vec[iVar] /= A(iVar,iVar);
+  }
+#undef A
+}
+
+template<class T, unsigned long N>
+FORCEINLINE void matrix_inverse_stat(T* matrix, T* inverse) {
+#define A(I,J) matrix[(I)*N+(J)]
+#define M(I,J) inverse[(I)*N+(J)]
+  /*--- Initialize the inverse with the identity. ---*/
+  for (auto iVar = 0ul; iVar < N; iVar++)
+    for (auto jVar = 0ul; jVar < N; jVar++)
+      M(iVar,jVar) = T(iVar==jVar);
+
+  /*--- Transform system in Upper Matrix ---*/
+  for (auto iVar = 1ul; iVar < N; iVar++) {
+    for (auto jVar = 0ul; jVar < iVar; jVar++) {
+      T weight = A(iVar,jVar) / A(jVar,jVar);
+      for (auto kVar = jVar; kVar < N; kVar++)
+        A(iVar,kVar) -= weight * A(jVar,kVar);
+      /*--- at this stage M is lower triangular so not all cols need updating ---*/
+      for (auto kVar = 0ul; kVar <= jVar; kVar++)
+        M(iVar,kVar) -= weight * M(jVar,kVar);
+    }
+  }
+
+  /*--- Backwards substitution ---*/
+  for (auto iVar = N; iVar > 0ul;) {
+    iVar--; // unsigned type
+    for (auto jVar = iVar+1; jVar < N; jVar++)
+      for (auto kVar = 0ul; kVar < N; kVar++)
+        M(iVar,kVar) -= A(iVar,jVar) * M(jVar,kVar);
+    for (auto kVar = 0ul; kVar < N; kVar++)
+      M(iVar,kVar) /= A(iVar,iVar);
+  }
+#undef A
+#undef M
+}
+
+/*--- Width of the batched diagonal inversion, each vector lane inverts one block. ---*/
+constexpr unsigned long DIAG_BATCH_LEN = 8;
+
+/*--- Batched version of matrix_inverse_stat, inverts DIAG_BATCH_LEN blocks at once
+ with the batch as the innermost (SIMD) dimension. The blocks are transposed into an
+ entry-major interleaved workspace so that the divisions and the data-dependent
+ elimination updates vectorize across the batch instead of serializing within the
+ few entries of one small block. No pivoting, like the scalar kernels. ---*/
+
+template<class T, unsigned long N>
+FORCEINLINE void matrix_inverse_batched(const T* const* blocks, T* inverse) {
+  constexpr auto L = DIAG_BATCH_LEN;
+
+  T A[N*N][L], M[N*N][L];
+
+  /*--- Gather the blocks into interleaved storage and init the inverses with identity. ---*/
+  for (auto eVar = 0ul; eVar < N*N; eVar++) {
+    SU2_OMP_SIMD
+    for (auto l = 0ul; l < L; l++) {
+      A[eVar][l] = blocks[l][eVar];
+      M[eVar][l] = T((eVar % N) == (eVar / N));
+    }
+  }
+
+  /*--- Transform system in Upper Matrix ---*/
+  for (auto iVar = 1ul; iVar < N; iVar++) {
+    for (auto jVar = 0ul; jVar < iVar; jVar++) {
+      T weight[L];
+      SU2_OMP_SIMD
+      for (auto l = 0ul; l < L; l++)
+        weight[l] = A[iVar*N+jVar][l] / A[jVar*N+jVar][l];
+
+      for (auto kVar = jVar; kVar < N; kVar++) {
+        SU2_OMP_SIMD
+        for (auto l = 0ul; l < L; l++)
+          A[iVar*N+kVar][l] -= weight[l] * A[jVar*N+kVar][l];
+      }
+      /*--- at this stage M is lower triangular so not all cols need updating ---*/
+      for (auto kVar = 0ul; kVar <= jVar; kVar++) {
+        SU2_OMP_SIMD
+        for (auto l = 0ul; l < L; l++)
+          M[iVar*N+kVar][l] -= weight[l] * M[jVar*N+kVar][l];
+      }
+    }
+  }
+
+  /*--- Backwards substitution ---*/
+  for (auto iVar = N; iVar > 0ul;) {
+    iVar--; // unsigned type
+    for (auto jVar = iVar+1; jVar < N; jVar++) {
+      for (auto kVar = 0ul; kVar < N; kVar++) {
+        SU2_OMP_SIMD
+        for (auto l = 0ul; l < L; l++)
+          M[iVar*N+kVar][l] -= A[iVar*N+jVar][l] * M[jVar*N+kVar][l];
+      }
+    }
+    for (auto kVar = 0ul; kVar < N; kVar++) {
+      SU2_OMP_SIMD
+      for (auto l = 0ul; l < L; l++)
+        M[iVar*N+kVar][l] /= A[iVar*N+iVar][l];
+    }
+  }
+
+  /*--- Scatter back to the block-major layout of invM. ---*/
+  for (auto eVar = 0ul; eVar < N*N; eVar++)
+    for (auto l = 0ul; l < L; l++)
+      inverse[l*N*N + eVar] = M[eVar][l];
+}
+
+/*--- Batched inversion of all full batches of diagonal blocks, the tail that does
+ not fill a batch is handled by the caller. Runs inside the parallel region. ---*/
+
+template<class T, unsigned long N>
+void invert_diagonal_batched(const T* matrix, const unsigned long* dia_ptr, T* invM,
+                             unsigned long nBatch, unsigned long chunk) {
+  SU2_OMP_FOR_(schedule(dynamic,chunk) SU2_NOWAIT)
+  for (auto iBatch = 0ul; iBatch < nBatch; iBatch++) {
+    const T* blocks[DIAG_BATCH_LEN];
+    for (auto l = 0ul; l < DIAG_BATCH_LEN; l++)
+      blocks[l] = &matrix[dia_ptr[iBatch*DIAG_BATCH_LEN + l]*N*N];
+    matrix_inverse_batched<T,N>(blocks, &invM[iBatch*DIAG_BATCH_LEN*N*N]);
+  }
+  END_SU2_OMP_FOR
+}
+} // namespace
+
 template<class ScalarType>
 void CSysMatrix<ScalarType>::Gauss_Elimination(ScalarType* matrix, ScalarType* vec) const {
 
@@ -511,6 +746,13 @@ void CSysMatrix<ScalarType>::Gauss_Elimination(ScalarType* matrix, ScalarType* v
   LAPACKE_dgetrf( LAPACK_ROW_MAJOR, nVar, nVar, matrix, nVar, ipiv);
   LAPACKE_dgetrs( LAPACK_ROW_MAJOR, 'N', nVar, 1, matrix, nVar, ipiv, vec, 1 );
 #else
+  /*--- Blocks of the common sizes are solved by fully unrolled kernels. ---*/
+  switch (nVar) {
+    case 4: return gauss_elimination_stat<ScalarType,4>(matrix, vec);
+    case 5: return gauss_elimination_stat<ScalarType,5>(matrix, vec);
+    case 6: return gauss_elimination_stat<ScalarType,6>(matrix, vec);
+    case 7: return gauss_elimination_stat<ScalarType,7>(matrix, vec);
+  }
 #define A(I,J) matrix[(I)*nVar+(J)]
 
   /*--- Transform system in Upper Matrix ---*/
@@ -544,6 +786,16 @@ void CSysMatrix<ScalarType>::MatrixInverse(ScalarType *matrix, ScalarType *inver
 
   assert((matrix != inverse) && "Output cannot be the same as the input.");
 
+#ifndef USE_MKL_LAPACK
+  /*--- Blocks of the common sizes are inverted by fully unrolled kernels. ---*/
+  switch (nVar) {
+    case 4: return matrix_inverse_stat<ScalarType,4>(matrix, inverse);
+    case 5: return matrix_inverse_stat<ScalarType,5>(matrix, inverse);
+    case 6: return matrix_inverse_stat<ScalarType,6>(matrix, inverse);
+    case 7: return matrix_inverse_stat<ScalarType,7>(matrix, inverse);
+  }
+#endif
+
 #define M(I,J) inverse[(I)*nVar+(J)]
 
   /*--- Initialize the inverse with the identity. ---*/
@@ -593,6 +845,7 @@ void CSysMatrix<ScalarType>::MatrixInverse(ScalarType *matrix, ScalarType *inver
 template<class ScalarType>
 void CSysMatrix<ScalarType>::DeleteValsRowi(unsigned long i) {
 
+  if (frozen) return;
   const auto block_i = i/nVar;
   const auto row = i%nVar;
 
@@ -604,9 +857,76 @@ void CSysMatrix<ScalarType>::DeleteValsRowi(unsigned long i) {
   }
 }
 
+template<class ScalarType>
+template<unsigned long N>
+void CSysMatrix<ScalarType>::MatrixVectorProductStatic(const CSysVector<ScalarType> & vec,
+                                                       CSysVector<ScalarType> & prod,
+                                                       unsigned long rowBegin, unsigned long rowEnd,
+                                                       const unsigned long* rowOrder,
+                                                       CSysVector<ScalarType>* jacProd) const {
+  assert(N == nVar && N == nEqn);
+
+  SU2_OMP_FOR_DYN(omp_heavy_size)
+  for (auto i = rowBegin; i < rowEnd; i++) {
+
+    const auto row_i = rowOrder? rowOrder[i] : i;
+
+    /*--- Accumulate in registers, the static size allows the compiler to
+     *    keep the entire row product in vector registers. ---*/
+    ScalarType sum[N];
+    SU2_OMP_SIMD
+    for (auto iVar = 0ul; iVar < N; iVar++)
+      sum[iVar] = 0.0;
+
+    for (auto index = row_ptr[row_i]; index < row_ptr[row_i+1]; index++) {
+      const auto block = &matrix[index*N*N];
+      const auto x = &vec[col_ind_prod[index]*N];
+
+      for (auto iVar = 0ul; iVar < N; iVar++) {
+        SU2_OMP_SIMD
+        for (auto jVar = 0ul; jVar < N; jVar++)
+          sum[iVar] += block[iVar*N+jVar] * x[jVar];
+      }
+    }
+
+    SU2_OMP_SIMD
+    for (auto iVar = 0ul; iVar < N; iVar++)
+      prod[row_i*N+iVar] = sum[iVar];
+
+    /*--- Fused application of the Jacobi preconditioner, the row product is
+     *    still in registers so only the inverse diagonal block is read. ---*/
+    if (jacProd) {
+      const auto block = &invM[row_i*N*N];
+      for (auto iVar = 0ul; iVar < N; iVar++) {
+        ScalarType y = 0.0;
+        SU2_OMP_SIMD
+        for (auto jVar = 0ul; jVar < N; jVar++)
+          y += block[iVar*N+jVar] * sum[jVar];
+        (*jacProd)[row_i*N+iVar] = y;
+      }
+    }
+  }
+  END_SU2_OMP_FOR
+}
+
 template<class ScalarType>
 void CSysMatrix<ScalarType>::MatrixVectorProduct(const CSysVector<ScalarType> & vec, CSysVector<ScalarType> & prod,
                                                  CGeometry *geometry, const CConfig *config) const {
+  MatrixVectorProductImpl(vec, prod, nullptr, geometry, config);
+}
+
+template<class ScalarType>
+void CSysMatrix<ScalarType>::JacobiMatrixVectorProduct(const CSysVector<ScalarType> & vec, CSysVector<ScalarType> & prod,
+                                                       CSysVector<ScalarType> & precProd,
+                                                       CGeometry *geometry, const CConfig *config) const {
+  assert(invM != nullptr && "The Jacobi preconditioner must be built before the fused product.");
+  MatrixVectorProductImpl(vec, prod, &precProd, geometry, config);
+}
+
+template<class ScalarType>
+void CSysMatrix<ScalarType>::MatrixVectorProductImpl(const CSysVector<ScalarType> & vec, CSysVector<ScalarType> & prod,
+                                                     CSysVector<ScalarType>* jacProd,
+                                                     CGeometry *geometry, const CConfig *config) const {
 
   /*--- Some checks for consistency between CSysMatrix and the CSysVector<ScalarType>s ---*/
 #ifndef NDEBUG
@@ -624,25 +944,191 @@ void CSysMatrix<ScalarType>::MatrixVectorProduct(const CSysVector<ScalarType> &
 
   SU2_OMP_BARRIER
 
-  SU2_OMP_FOR_DYN(omp_heavy_size)
-  for (auto row_i = 0ul; row_i < nPointDomain; row_i++) {
-    RowProduct(vec, row_i, &prod[row_i*nVar]);
+#ifdef CSYSMATRIX_OMP_OFFLOAD
+  if (deviceDataMapped) {
+    /*--- Offload the product, the matrix is refreshed on the device only after
+     *    modifications, the vectors are streamed for every product. ---*/
+    SU2_OMP_MASTER
+    {
+      UpdateDeviceMatrix();
+
+      const auto* a = matrix;
+      const auto* rp = row_ptr;
+      const auto* ci = col_ind;
+      const auto* x = &vec[0];
+      auto* y = &prod[0];
+      const auto nRows = nPointDomain;
+      const auto nVars = nVar, nEqns = nEqn, nCols = nPoint*nEqn;
+
+      #pragma omp target teams distribute parallel for \
+              map(to: x[:nCols]) map(from: y[:nRows*nVars])
+      for (auto row_i = 0ul; row_i < nRows; row_i++) {
+        for (auto iVar = 0ul; iVar < nVars; iVar++) {
+          ScalarType sum = 0.0;
+          for (auto index = rp[row_i]; index < rp[row_i+1]; index++) {
+            const auto block = &a[index*nVars*nEqns + iVar*nEqns];
+            const auto col = &x[ci[index]*nEqns];
+            for (auto jVar = 0ul; jVar < nEqns; jVar++)
+              sum += block[jVar] * col[jVar];
+          }
+          y[row_i*nVars+iVar] = sum;
+        }
+      }
+    }
+    END_SU2_OMP_MASTER
+    SU2_OMP_BARRIER
+
+    /*--- MPI Parallelization. ---*/
+
+    CSysMatrixComms::Initiate(prod, geometry, config);
+    CSysMatrixComms::Complete(prod, geometry, config);
+
+    /*--- The fused preconditioner application is not offloaded, apply it as a
+     *    separate block-diagonal pass (which communicates its own halos). ---*/
+    if (jacProd) ComputeJacobiPreconditioner(prod, *jacProd, geometry, config);
+
+    return;
   }
-  END_SU2_OMP_FOR
+#endif
 
-  /*--- MPI Parallelization. ---*/
+  /*--- Build the halo-aware row order once: rows whose values are sent to other
+   ranks first (so the halo exchange of the product can be started early), then
+   the dense interior rows that only read owned columns (a streaming sweep that
+   hides the exchange), and finally the rows that read halo columns, grouping
+   their scattered accesses to the halo end of the vector. ---*/
+
+  const bool overlap = (geometry->nP2PSend > 0);
+
+  if (overlap && (mvpRowOrder.size() != nPointDomain)) {
+    SU2_OMP_MASTER {
+      mvpRowOrder.resize(nPointDomain);
+      vector<bool> isSent(nPointDomain, false);
+      for (auto iSend = 0; iSend < geometry->nPoint_P2PSend[geometry->nP2PSend]; ++iSend) {
+        const auto iPoint = geometry->Local_Point_P2PSend[iSend];
+        if (iPoint < nPointDomain) isSent[iPoint] = true;
+      }
+      auto readsHalo = [&](unsigned long iPoint) {
+        for (auto index = row_ptr[iPoint]; index < row_ptr[iPoint+1]; ++index)
+          if (col_ind[index] >= nPointDomain) return true;
+        return false;
+      };
+      unsigned long k = 0;
+      for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint)
+        if (isSent[iPoint]) mvpRowOrder(k++) = iPoint;
+      mvpSendRows = k;
+      for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint)
+        if (!isSent[iPoint] && !readsHalo(iPoint)) mvpRowOrder(k++) = iPoint;
+      mvpInteriorRows = k;
+      for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint)
+        if (!isSent[iPoint] && readsHalo(iPoint)) mvpRowOrder(k++) = iPoint;
+    }
+    END_SU2_OMP_MASTER
+    SU2_OMP_BARRIER
+  }
 
-  CSysMatrixComms::Initiate(prod, geometry, config);
-  CSysMatrixComms::Complete(prod, geometry, config);
+  /*--- Dispatch to a specialized kernel for the common block sizes of the
+   *    coupled solvers, generic (runtime block size) fallback otherwise. ---*/
+
+  auto computeRows = [&](unsigned long begin, unsigned long end, const unsigned long* order) {
+    switch ((nVar == nEqn)? nVar : 0ul) {
+      case 4: MatrixVectorProductStatic<4>(vec, prod, begin, end, order, jacProd); break;
+      case 5: MatrixVectorProductStatic<5>(vec, prod, begin, end, order, jacProd); break;
+      case 6: MatrixVectorProductStatic<6>(vec, prod, begin, end, order, jacProd); break;
+      case 7: MatrixVectorProductStatic<7>(vec, prod, begin, end, order, jacProd); break;
+      default:
+        SU2_OMP_FOR_DYN(omp_heavy_size)
+        for (auto i = begin; i < end; i++) {
+          const auto row_i = order? order[i] : i;
+          RowProduct(vec, row_i, &prod[row_i*nVar]);
+          if (jacProd)
+            MatrixVectorProduct(&invM[row_i*nVar*nVar], &prod[row_i*nVar], &(*jacProd)[row_i*nVar]);
+        }
+        END_SU2_OMP_FOR
+        break;
+    }
+  };
+
+  /*--- For the fused product the halo exchange targets the preconditioned
+   *    product, as that is the vector the caller's iteration consumes. ---*/
+  CSysVector<ScalarType>& commVec = jacProd? *jacProd : prod;
+
+  if (overlap) {
+    /*--- Compute the rows other ranks are waiting for, start the exchange, and
+     hide it behind the dense interior rows (the implicit barriers of the
+     worksharing loops order the computation and the buffer packing). The rows
+     with scattered reads from the halo columns run last as their own sweep.
+     The interior sweep runs in a few slices, between slices the master thread
+     polls the MPI progress engine (Iprobe makes no completion visible, it only
+     drives progress), without this fabrics that lack asynchronous hardware
+     progress advance the messages only inside the final wait. ---*/
+    computeRows(0, mvpSendRows, mvpRowOrder.data());
+    CSysMatrixComms::Initiate(commVec, geometry, config);
+
+    const auto slice = max(4096ul, roundUpDiv(mvpInteriorRows - mvpSendRows, 8ul));
+    for (auto begin = mvpSendRows; begin < mvpInteriorRows; begin += slice) {
+      computeRows(begin, min(begin + slice, mvpInteriorRows), mvpRowOrder.data());
+#ifdef HAVE_MPI
+      if (begin + slice < mvpInteriorRows) {
+        SU2_OMP_MASTER {
+          int flag = 0;
+          SU2_MPI::Iprobe(MPI_ANY_SOURCE, MPI_ANY_TAG, SU2_MPI::GetComm(), &flag, MPI_STATUS_IGNORE);
+        }
+        END_SU2_OMP_MASTER
+      }
+#endif
+    }
+
+    computeRows(mvpInteriorRows, nPointDomain, mvpRowOrder.data());
+    CSysMatrixComms::Complete(commVec, geometry, config);
+  }
+  else {
+    computeRows(0, nPointDomain, nullptr);
+
+    /*--- MPI Parallelization. ---*/
 
+    CSysMatrixComms::Initiate(commVec, geometry, config);
+    CSysMatrixComms::Complete(commVec, geometry, config);
+  }
+}
+
+#ifdef CSYSMATRIX_OMP_OFFLOAD
+template<class ScalarType>
+void CSysMatrix<ScalarType>::UpdateDeviceMatrix() const {
+  if (deviceMatrixUpToDate) return;
+  #pragma omp target update to(matrix[:nnz*nVar*nEqn])
+  deviceMatrixUpToDate = true;
 }
+#endif
 
 template<class ScalarType>
 void CSysMatrix<ScalarType>::BuildJacobiPreconditioner() {
 
+  /*--- A frozen matrix has not changed, reuse the stored inverses. ---*/
+  if (frozen) return;
+
   /*--- Build Jacobi preconditioner (M = D), compute and store the inverses of the diagonal blocks. ---*/
+
+#ifndef USE_MKL_LAPACK
+  /*--- Blocks of the common sizes are inverted by the batched SIMD kernel,
+   the tail that does not fill a batch falls through to the scalar loop. ---*/
+  unsigned long firstTailPoint = 0;
+  auto nBatch = nPointDomain / DIAG_BATCH_LEN;
+  const auto chunk = roundUpDiv(omp_heavy_size, DIAG_BATCH_LEN);
+
+  switch (nVar) {
+    case 4: invert_diagonal_batched<ScalarType,4>(matrix, dia_ptr, invM, nBatch, chunk); break;
+    case 5: invert_diagonal_batched<ScalarType,5>(matrix, dia_ptr, invM, nBatch, chunk); break;
+    case 6: invert_diagonal_batched<ScalarType,6>(matrix, dia_ptr, invM, nBatch, chunk); break;
+    case 7: invert_diagonal_batched<ScalarType,7>(matrix, dia_ptr, invM, nBatch, chunk); break;
+    default: nBatch = 0;
+  }
+  firstTailPoint = nBatch * DIAG_BATCH_LEN;
+#else
+  const unsigned long firstTailPoint = 0;
+#endif
+
   SU2_OMP_FOR_(schedule(dynamic,omp_heavy_size) SU2_NOWAIT)
-  for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++)
+  for (unsigned long iPoint = firstTailPoint; iPoint < nPointDomain; iPoint++)
     InverseDiagonalBlock(iPoint, &(invM[iPoint*nVar*nVar]));
   END_SU2_OMP_FOR
 
@@ -654,10 +1140,46 @@ void CSysMatrix<ScalarType>::ComputeJacobiPreconditioner(const CSysVector<Scalar
 
   /*--- Apply Jacobi preconditioner, y = D^{-1} * x, the inverse of the diagonal is already known. ---*/
   SU2_OMP_BARRIER
-  SU2_OMP_FOR_DYN(omp_heavy_size)
-  for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++)
-    MatrixVectorProduct(&(invM[iPoint*nVar*nVar]), &vec[iPoint*nVar], &prod[iPoint*nVar]);
-  END_SU2_OMP_FOR
+
+#ifdef CSYSMATRIX_OMP_OFFLOAD
+  if (deviceDataMapped && (invM != nullptr)) {
+    /*--- Offload the block-diagonal product, the inverses are uploaded once
+     *    per preconditioner build, the vectors stream for every application. ---*/
+    SU2_OMP_MASTER
+    {
+      if (!deviceInvMUpToDate) {
+        #pragma omp target update to(invM[:nPointDomain*nVar*nEqn])
+        deviceInvMUpToDate = true;
+      }
+
+      const auto* m = invM;
+      const auto* x = &vec[0];
+      auto* y = &prod[0];
+      const auto nRows = nPointDomain;
+      const auto nVars = nVar, nEqns = nEqn;
+
+      #pragma omp target teams distribute parallel for \
+              map(to: x[:nRows*nEqns]) map(from: y[:nRows*nVars])
+      for (auto iPoint = 0ul; iPoint < nRows; iPoint++) {
+        for (auto iVar = 0ul; iVar < nVars; iVar++) {
+          ScalarType sum = 0.0;
+          for (auto jVar = 0ul; jVar < nEqns; jVar++)
+            sum += m[(iPoint*nVars+iVar)*nEqns+jVar] * x[iPoint*nEqns+jVar];
+          y[iPoint*nVars+iVar] = sum;
+        }
+      }
+    }
+    END_SU2_OMP_MASTER
+    SU2_OMP_BARRIER
+  }
+  else
+#endif
+  {
+    SU2_OMP_FOR_DYN(omp_heavy_size)
+    for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++)
+      MatrixVectorProduct(&(invM[iPoint*nVar*nVar]), &vec[iPoint*nVar], &prod[iPoint*nVar]);
+    END_SU2_OMP_FOR
+  }
 
   /*--- MPI Parallelization ---*/
   CSysMatrixComms::Initiate(prod, geometry, config);
@@ -668,16 +1190,50 @@ void CSysMatrix<ScalarType>::ComputeJacobiPreconditioner(const CSysVector<Scalar
 template<class ScalarType>
 void CSysMatrix<ScalarType>::BuildILUPreconditioner() {
 
+  /*--- A frozen matrix has not changed, reuse the stored factorization. ---*/
+  if (frozen) return;
+
+  /*--- Incremental refresh (ILU0 only): compare a cheap per-row signature of
+   *    the matrix against the one stored at the last factorization, rows whose
+   *    entries did not change (beyond the tolerance) keep their factored values.
+   *    Because the in-place IKJ elimination of a row only reads rows above it,
+   *    the factorization stays exact if every row below the first changed one
+   *    is redone. This pairs with Jacobian lagging, where between refreshes
+   *    only a few rows (e.g. near shocks or walls) are updated. ---*/
+
+  bool incremental = false;
+
+  if (iluRefreshTol > 0.0) {
+    incremental = !iluRowSignature.empty();
+    SU2_OMP_BARRIER
+    SU2_OMP_MASTER {
+      iluRowSignature.resize(nPointDomain, 0.0);
+      iluRowChanged.resize(nPointDomain, 1);
+    } END_SU2_OMP_MASTER
+    SU2_OMP_BARRIER
+
+    SU2_OMP_FOR_STAT(omp_heavy_size)
+    for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint) {
+      passivedouble sig = 0.0;
+      for (auto iVar = row_ptr[iPoint]*nVar*nVar; iVar < row_ptr[iPoint+1]*nVar*nVar; ++iVar)
+        sig += fabs(SU2_TYPE::GetValue(matrix[iVar]));
+      const auto old = iluRowSignature[iPoint];
+      iluRowChanged[iPoint] = !incremental || (fabs(sig-old) > iluRefreshTol*max(fabs(old), 1e-30));
+      iluRowSignature[iPoint] = sig;
+    }
+    END_SU2_OMP_FOR
+  }
+
   /*--- Copy block matrix to compute factorization in-place. ---*/
 
-  if (ilu_fill_in == 0) {
+  if (ilu_fill_in == 0 && !incremental) {
     /*--- ILU0, direct copy. ---*/
     SU2_OMP_FOR_STAT(omp_light_size)
     for (auto iVar = 0ul; iVar < nnz*nVar*nVar; ++iVar)
       ILU_matrix[iVar] = matrix[iVar];
     END_SU2_OMP_FOR
   }
-  else {
+  else if (ilu_fill_in != 0) {
     /*--- ILUn clear the ILU matrix first. ---*/
     SU2_OMP_FOR_STAT(omp_light_size)
     for (auto iVar = 0ul; iVar < nnz_ilu*nVar*nVar; iVar++)
@@ -698,6 +1254,92 @@ void CSysMatrix<ScalarType>::BuildILUPreconditioner() {
 
   /*--- Transform system in Upper Matrix ---*/
 
+  if (iluLevelSched) {
+
+    /*--- Exact in-rank factorization, rows are processed level by level of the
+     *    dependency DAG of the elimination, rows within a level do not depend
+     *    on each other and are distributed over the threads. Unlike the
+     *    partitioned path below this does not change the preconditioner with
+     *    the number of threads. The schedule only depends on the sparsity,
+     *    build it on the first factorization. ---*/
+
+    SU2_OMP_MASTER {
+      if (iluLevPtr.empty()) BuildILULevelSchedule();
+
+      iluFirstChanged = 0;
+      if (incremental) {
+        iluFirstChanged = nPointDomain;
+        for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint)
+          if (iluRowChanged[iPoint]) { iluFirstChanged = iPoint; break; }
+      }
+    } END_SU2_OMP_MASTER
+    SU2_OMP_BARRIER
+
+    /*--- Incremental refresh: copy only the rows that will be refactored,
+     *    the ones above the first changed row keep their factored values. ---*/
+
+    if (incremental) {
+      SU2_OMP_FOR_STAT(omp_light_size)
+      for (auto iVar = row_ptr_ilu[iluFirstChanged]*nVar*nVar; iVar < row_ptr_ilu[nPointDomain]*nVar*nVar; ++iVar)
+        ILU_matrix[iVar] = matrix[iVar];
+      END_SU2_OMP_FOR
+    }
+
+    const auto firstRow = incremental? iluFirstChanged : 0ul;
+
+    for (auto iLev = 0ul; iLev+1 < iluLevPtr.size(); ++iLev) {
+
+      /*--- The implicit barrier of the loop makes the rows of
+       *    this level visible to the levels that depend on them. ---*/
+
+      SU2_OMP_FOR_DYN(OMP_MIN_SIZE)
+      for (auto idx = iluLevPtr[iLev]; idx < iluLevPtr[iLev+1]; ++idx) {
+
+        const auto iPoint = iluLevRows[idx];
+        if (iPoint < firstRow) continue;
+
+        ScalarType weight[MAXNVAR*MAXNVAR], aux_block[MAXNVAR*MAXNVAR];
+
+        /*--- Eliminate the lower entries of the row, all the rows they refer
+         *    to (and their diagonal inverses) were factored in lower levels. ---*/
+
+        for (auto index = row_ptr_ilu[iPoint]; index < dia_ptr_ilu[iPoint]; index++) {
+
+          auto jPoint = col_ind_ilu[index];
+
+          auto Block_ij = &ILU_matrix[index*nVar*nVar];
+          MatrixMatrixProduct(Block_ij, &invM[jPoint*nVar*nVar], weight);
+
+          for (auto index_ = dia_ptr_ilu[jPoint]+1; index_ < row_ptr_ilu[jPoint+1]; index_++) {
+
+            auto kPoint = col_ind_ilu[index_];
+
+            /*--- Halo columns are not factored (column indices are sorted). ---*/
+            if (kPoint >= nPointDomain) break;
+
+            auto Block_ik = GetBlock_ILUMatrix(iPoint, kPoint);
+
+            if (Block_ik != nullptr) {
+              auto Block_jk = &ILU_matrix[index_*nVar*nVar];
+              MatrixMatrixProduct(weight, Block_jk, aux_block);
+              MatrixSubtraction(Block_ik, aux_block, Block_ik);
+            }
+          }
+
+          for (auto iVar = 0ul; iVar < nVar*nVar; ++iVar)
+            Block_ij[iVar] = weight[iVar];
+        }
+
+        /*--- The row is final, store the inverse of its diagonal block. ---*/
+
+        InverseDiagonalBlock_ILUMatrix(iPoint, &invM[iPoint*nVar*nVar]);
+      }
+      END_SU2_OMP_FOR
+    }
+
+    return;
+  }
+
   /*--- OpenMP Parallelization, a loop construct is used to ensure
    *    the preconditioner is computed correctly even if called
    *    outside of a parallel section. ---*/
@@ -712,9 +1354,26 @@ void CSysMatrix<ScalarType>::BuildILUPreconditioner() {
      *    to row/col "end-1" (i.e. the range [begin,end[). Which is exactly
      *    what the MPI-only implementation does. ---*/
 
+    /*--- Incremental refresh: find the first changed row of the partition,
+     *    restart the elimination there, the rows above it (and their stored
+     *    diagonal inverses) are unchanged. Copy only the rows redone. ---*/
+
+    auto firstRow = begin;
+
+    if (incremental) {
+      firstRow = end;
+      for (auto iPoint = begin; iPoint < end; ++iPoint)
+        if (iluRowChanged[iPoint]) { firstRow = iPoint; break; }
+
+      if (firstRow == end) continue;
+
+      for (auto iVar = row_ptr_ilu[firstRow]*nVar*nVar; iVar < row_ptr_ilu[end]*nVar*nVar; ++iVar)
+        ILU_matrix[iVar] = matrix[iVar];
+    }
+
     ScalarType weight[MAXNVAR*MAXNVAR], aux_block[MAXNVAR*MAXNVAR];
 
-    for (auto iPoint = begin+1; iPoint < end; iPoint++) {
+    for (auto iPoint = max(firstRow, begin+1); iPoint < end; iPoint++) {
 
       /*--- Invert and store the previous diagonal block to later compute the weight. ---*/
 
@@ -772,12 +1431,134 @@ void CSysMatrix<ScalarType>::BuildILUPreconditioner() {
 
 }
 
+template<class ScalarType>
+void CSysMatrix<ScalarType>::BuildILULevelSchedule() {
+
+  /*--- The level of a row is one more than the highest level among the rows
+   *    it depends on, rows of the same level can be processed in parallel.
+   *    Built once, serially, the sparsity does not change. ---*/
+
+  vector<unsigned long> level(nPointDomain, 0);
+
+  /*--- Lower triangle, for the factorization and the forward solve. The
+   *    elimination of a row reads the rows of its lower entries, which the
+   *    forward solve reads too, so both share this schedule. ---*/
+
+  unsigned long nLevel = 0;
+
+  for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint) {
+    unsigned long lev = 0;
+    for (auto index = row_ptr_ilu[iPoint]; index < dia_ptr_ilu[iPoint]; ++index)
+      lev = max(lev, level[col_ind_ilu[index]]+1);
+    level[iPoint] = lev;
+    nLevel = max(nLevel, lev+1);
+  }
+
+  /*--- Bucket the rows by level (counting sort), rows within
+   *    a level stay in ascending order for better locality. ---*/
+
+  auto bucketRows = [this](const vector<unsigned long>& level, unsigned long nLevel,
+                           vector<unsigned long>& levPtr, vector<unsigned long>& levRows) {
+    levPtr.assign(nLevel+1, 0);
+    for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint)
+      levPtr[level[iPoint]+1]++;
+    for (auto iLev = 0ul; iLev < nLevel; ++iLev)
+      levPtr[iLev+1] += levPtr[iLev];
+
+    levRows.resize(nPointDomain);
+    auto pos = levPtr;
+    for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint)
+      levRows[pos[level[iPoint]]++] = iPoint;
+  };
+
+  bucketRows(level, nLevel, iluLevPtr, iluLevRows);
+
+  /*--- Upper triangle, for the backward solve, the dependencies run in the
+   *    opposite direction and halo columns are not part of the solve. ---*/
+
+  nLevel = 0;
+
+  for (auto iPoint = nPointDomain; iPoint > 0;) {
+    --iPoint;
+    unsigned long lev = 0;
+    for (auto index = dia_ptr_ilu[iPoint]+1; index < row_ptr_ilu[iPoint+1]; ++index) {
+      auto jPoint = col_ind_ilu[index];
+      if (jPoint >= nPointDomain) break;
+      lev = max(lev, level[jPoint]+1);
+    }
+    level[iPoint] = lev;
+    nLevel = max(nLevel, lev+1);
+  }
+
+  bucketRows(level, nLevel, iluLevPtrU, iluLevRowsU);
+
+}
+
 template<class ScalarType>
 void CSysMatrix<ScalarType>::ComputeILUPreconditioner(const CSysVector<ScalarType> & vec, CSysVector<ScalarType> & prod,
                                                       CGeometry *geometry, const CConfig *config) const {
   /*--- Coherent view of vectors. ---*/
   SU2_OMP_BARRIER
 
+  if (iluLevelSched) {
+
+    /*--- Triangular solves consistent with the level-scheduled factorization,
+     *    i.e. exact within the rank instead of restricted to the partition of
+     *    each thread. Levels are processed in order, the implicit barrier of
+     *    each loop makes the updated entries visible to dependent levels. ---*/
+
+    SU2_OMP_FOR_STAT(omp_heavy_size)
+    for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint)
+      for (auto iVar = 0ul; iVar < nVar; ++iVar)
+        prod[iPoint*nVar+iVar] = vec[iPoint*nVar+iVar];
+    END_SU2_OMP_FOR
+
+    /*--- Forward solve with the stored lower factors. ---*/
+
+    for (auto iLev = 0ul; iLev+1 < iluLevPtr.size(); ++iLev) {
+      SU2_OMP_FOR_DYN(OMP_MIN_SIZE)
+      for (auto idx = iluLevPtr[iLev]; idx < iluLevPtr[iLev+1]; ++idx) {
+        const auto iPoint = iluLevRows[idx];
+        for (auto index = row_ptr_ilu[iPoint]; index < dia_ptr_ilu[iPoint]; index++) {
+          auto jPoint = col_ind_ilu[index];
+          auto Block_ij = &ILU_matrix[index*nVar*nVar];
+          MatrixVectorProductSub(Block_ij, &prod[jPoint*nVar], &prod[iPoint*nVar]);
+        }
+      }
+      END_SU2_OMP_FOR
+    }
+
+    /*--- Backward substitution over the upper levels. ---*/
+
+    for (auto iLev = 0ul; iLev+1 < iluLevPtrU.size(); ++iLev) {
+      SU2_OMP_FOR_DYN(OMP_MIN_SIZE)
+      for (auto idx = iluLevPtrU[iLev]; idx < iluLevPtrU[iLev+1]; ++idx) {
+        const auto iPoint = iluLevRowsU[idx];
+
+        ScalarType aux_vec[MAXNVAR];
+        for (auto iVar = 0ul; iVar < nVar; iVar++)
+          aux_vec[iVar] = prod[iPoint*nVar+iVar];
+
+        for (auto index = dia_ptr_ilu[iPoint]+1; index < row_ptr_ilu[iPoint+1]; index++) {
+          auto jPoint = col_ind_ilu[index];
+          if (jPoint >= nPointDomain) break;
+          auto Block_ij = &ILU_matrix[index*nVar*nVar];
+          MatrixVectorProductSub(Block_ij, &prod[jPoint*nVar], aux_vec);
+        }
+
+        MatrixVectorProduct(&invM[iPoint*nVar*nVar], aux_vec, &prod[iPoint*nVar]);
+      }
+      END_SU2_OMP_FOR
+    }
+
+    /*--- MPI Parallelization ---*/
+
+    CSysMatrixComms::Initiate(prod, geometry, config);
+    CSysMatrixComms::Complete(prod, geometry, config);
+
+    return;
+  }
+
   /*--- OpenMP Parallelization ---*/
   SU2_OMP_FOR_STAT(1)
   for(unsigned long thread = 0; thread < omp_num_parts; ++thread)
@@ -900,6 +1681,123 @@ void CSysMatrix<ScalarType>::ComputeLU_SGSPreconditioner(const CSysVector<Scalar
 
 }
 
+template<class ScalarType>
+void CSysMatrix<ScalarType>::BuildMulticolorSGSPreconditioner() {
+
+  /*--- The inverse diagonal blocks are shared with the Jacobi preconditioner. ---*/
+
+  BuildJacobiPreconditioner();
+
+  /*--- Color the rows of the matrix on first use, the sparsity is constant. ---*/
+
+  if (!colorRowPtr.empty()) return;
+
+  SU2_OMP_MASTER {
+
+    /*--- Wrap the sparsity in the pattern type of the coloring toolbox, rows
+     *    that share a column cannot be in the same color, which in particular
+     *    separates adjacent rows (each row contains its own diagonal). ---*/
+
+    su2vector<unsigned long> outerPtr(nPointDomain+1);
+    for (auto iPoint = 0ul; iPoint <= nPointDomain; ++iPoint)
+      outerPtr(iPoint) = row_ptr[iPoint];
+
+    su2vector<unsigned long> innerIdx(row_ptr[nPointDomain]);
+    for (auto index = 0ul; index < row_ptr[nPointDomain]; ++index)
+      innerIdx(index) = col_ind[index];
+
+    CCompressedSparsePatternUL pattern(std::move(outerPtr), std::move(innerIdx));
+
+    const auto coloring = colorSparsePattern(pattern, 1, true);
+
+    /*--- An empty pattern indicates the coloring failed, the application then
+     *    falls back to the serial LU-SGS sweeps (nColors stays at zero). ---*/
+
+    if (!coloring.empty()) {
+      nColors = coloring.getOuterSize();
+      colorRowPtr.assign(coloring.outerPtr(), coloring.outerPtr()+nColors+1);
+      colorRowIdx.assign(coloring.innerIdx(), coloring.innerIdx()+coloring.getNumNonZeros());
+    }
+    else {
+      colorRowPtr.assign(1, 0ul);
+    }
+
+  } END_SU2_OMP_MASTER
+  SU2_OMP_BARRIER
+}
+
+template<class ScalarType>
+void CSysMatrix<ScalarType>::ComputeMulticolorSGSPreconditioner(const CSysVector<ScalarType> & vec,
+                                                                CSysVector<ScalarType> & prod,
+                                                                CGeometry *geometry, const CConfig *config) const {
+  /*--- Fallback if the coloring was not successful. ---*/
+
+  if (nColors == 0) {
+    ComputeLU_SGSPreconditioner(vec, prod, geometry, config);
+    return;
+  }
+
+  /*--- Coherent view of vectors, and zero initial guess so that colors not
+   *    swept yet (and halos) do not contribute to the forward sweep. ---*/
+
+  SU2_OMP_BARRIER
+  prod.SetValZero();
+
+  /*--- First part of the symmetric iteration: (D+L).x* = b, where "lower" is
+   *    defined by the color ordering. Within a color no two rows are adjacent
+   *    and so they can be updated in parallel without races. ---*/
+
+  for (auto iColor = 0ul; iColor < nColors; ++iColor) {
+    SU2_OMP_FOR_DYN(OMP_MIN_SIZE)
+    for (auto k = colorRowPtr[iColor]; k < colorRowPtr[iColor+1]; ++k) {
+      const auto iPoint = colorRowIdx[k];
+      const auto idx = iPoint*nVar;
+
+      ScalarType sum[MAXNVAR], aux[MAXNVAR];
+      for (auto iVar = 0ul; iVar < nVar; ++iVar) sum[iVar] = 0.0;
+
+      for (auto index = row_ptr[iPoint]; index < row_ptr[iPoint+1]; ++index) {
+        const auto jPoint = col_ind_prod[index];
+        if (jPoint == iPoint || jPoint >= nPointDomain) continue;
+        MatrixVectorProductAdd(&matrix[index*nVar*nVar], &prod[jPoint*nVar], sum);
+      }
+      VectorSubtraction(&vec[idx], sum, aux);                       // y = b - (L+U).x
+      MatrixVectorProduct(&invM[iPoint*nVar*nVar], aux, &prod[idx]); // x = D^{-1}.y
+    }
+    END_SU2_OMP_FOR
+  }
+
+  /*--- Second part of the symmetric iteration, sweep the colors in reverse
+   *    order using the updated values of all neighbor rows. ---*/
+
+  for (auto iColor = nColors; iColor > 0ul;) {
+    iColor--; // unsigned type
+    SU2_OMP_FOR_DYN(OMP_MIN_SIZE)
+    for (auto k = colorRowPtr[iColor]; k < colorRowPtr[iColor+1]; ++k) {
+      const auto iPoint = colorRowIdx[k];
+      const auto idx = iPoint*nVar;
+
+      ScalarType sum[MAXNVAR], aux[MAXNVAR];
+      for (auto iVar = 0ul; iVar < nVar; ++iVar) sum[iVar] = 0.0;
+
+      for (auto index = row_ptr[iPoint]; index < row_ptr[iPoint+1]; ++index) {
+        const auto jPoint = col_ind_prod[index];
+        if (jPoint == iPoint || jPoint >= nPointDomain) continue;
+        MatrixVectorProductAdd(&matrix[index*nVar*nVar], &prod[jPoint*nVar], sum);
+      }
+      VectorSubtraction(&vec[idx], sum, aux);
+      MatrixVectorProduct(&invM[iPoint*nVar*nVar], aux, &prod[idx]);
+    }
+    END_SU2_OMP_FOR
+  }
+
+  /*--- MPI Parallelization ---*/
+
+  CSysMatrixComms::Initiate(prod, geometry, config);
+  CSysMatrixComms::Complete(prod, geometry, config);
+
+}
+
 template<class ScalarType>
 unsigned long CSysMatrix<ScalarType>::BuildLineletPreconditioner(CGeometry *geometry, const CConfig *config) {
 
@@ -910,7 +1808,7 @@ unsigned long CSysMatrix<ScalarType>::BuildLineletPreconditioner(CGeometry *geom
   unsigned short iMarker, iNode;
   su2double alpha = 0.9, weight, max_weight, area, volume_iPoint, volume_jPoint;
   const su2double* normal;
-  unsigned long Local_nPoints, Local_nLineLets, Global_nPoints, Global_nLineLets, max_nElem;
+  unsigned long Local_nPoints, Local_nLineLets, Global_nPoints, Global_nLineLets;
 
   /*--- Memory allocation --*/
 
@@ -1027,21 +1925,6 @@ unsigned long CSysMatrix<ScalarType>::BuildLineletPreconditioner(CGeometry *geom
       }
     }
 
-    /*--- Identify the maximum number of elements in a Linelet ---*/
-
-    max_nElem = LineletPoint[0].size();
-    for (iLinelet = 1; iLinelet < nLinelet; iLinelet++)
-      if (LineletPoint[iLinelet].size() > max_nElem)
-        max_nElem = LineletPoint[iLinelet].size();
-
-  }
-
-  /*--- The domain doesn't have well defined linelets ---*/
-
-  else {
-
-    max_nElem = 0;
-
   }
 
   /*--- Screen output ---*/
@@ -1055,113 +1938,135 @@ unsigned long CSysMatrix<ScalarType>::BuildLineletPreconditioner(CGeometry *geom
   SU2_MPI::Allreduce(&Local_nPoints, &Global_nPoints, 1, MPI_UNSIGNED_LONG, MPI_SUM, SU2_MPI::GetComm());
   SU2_MPI::Allreduce(&Local_nLineLets, &Global_nLineLets, 1, MPI_UNSIGNED_LONG, MPI_SUM, SU2_MPI::GetComm());
 
-  /*--- Memory allocation --*/
+  /*--- Allocate the factorization storage and cache the pointers to the lower,
+   *    diagonal, and upper blocks of each linelet, the sparsity is static. ---*/
+
+  lineletPtr.assign(nLinelet+1, 0);
+  for (iLinelet = 0; iLinelet < nLinelet; iLinelet++)
+    lineletPtr[iLinelet+1] = lineletPtr[iLinelet] + LineletPoint[iLinelet].size();
+
+  const auto totalElem = lineletPtr[nLinelet];
 
-  LineletUpper.resize(omp_get_max_threads(), vector<const ScalarType*>(max_nElem,nullptr));
-  LineletVector.resize(omp_get_max_threads(), vector<ScalarType>(max_nElem*nVar,0.0));
-  LineletInvDiag.resize(omp_get_max_threads(), vector<ScalarType>(max_nElem*nVar*nVar,0.0));
+  lineletInvDiag.resize(totalElem*nVar*nVar);
+  lineletWeight.resize(totalElem*nVar*nVar);
+  lineletUpper.assign(totalElem, nullptr);
+  lineletLower.assign(totalElem, nullptr);
+  lineletDiag.assign(totalElem, nullptr);
+
+  for (iLinelet = 0; iLinelet < nLinelet; iLinelet++) {
+    const auto begin = lineletPtr[iLinelet];
+    const auto nElem = LineletPoint[iLinelet].size();
+    for (iElem = 0; iElem < nElem; iElem++) {
+      iPoint = LineletPoint[iLinelet][iElem];
+      lineletDiag[begin+iElem] = &matrix[dia_ptr[iPoint]*nVar*nVar];
+      if (iElem > 0)
+        lineletLower[begin+iElem] = GetBlock(iPoint, LineletPoint[iLinelet][iElem-1]);
+      if (iElem+1 < nElem)
+        lineletUpper[begin+iElem] = GetBlock(iPoint, LineletPoint[iLinelet][iElem+1]);
+    }
+  }
 
   return (unsigned long)(passivedouble(Global_nPoints) / Global_nLineLets);
 
 }
 
 template<class ScalarType>
-void CSysMatrix<ScalarType>::ComputeLineletPreconditioner(const CSysVector<ScalarType> & vec, CSysVector<ScalarType> & prod,
-                                                          CGeometry *geometry, const CConfig *config) const {
-  /*--- Coherent view of vectors. ---*/
-  SU2_OMP_BARRIER
-
-  /*--- Jacobi preconditioning where there is no linelet ---*/
+void CSysMatrix<ScalarType>::FactorizeLineletPreconditioner() {
 
-  SU2_OMP_FOR_(schedule(dynamic,omp_heavy_size) SU2_NOWAIT)
-  for (auto iPoint = 0ul; iPoint < nPointDomain; iPoint++)
-    if (!LineletBool[iPoint])
-      MatrixVectorProduct(&(invM[iPoint*nVar*nVar]), &vec[iPoint*nVar], &prod[iPoint*nVar]);
-  END_SU2_OMP_FOR
+  /*--- A frozen matrix has not changed, reuse the stored factorization. ---*/
+  if (frozen) return;
 
-  /*--- Solve each linelet using the Thomas algorithm ---*/
+  /*--- Forward elimination of the block-tridiagonal systems, stores the
+   *    elimination weights and the inverted modified diagonals so every
+   *    application of the preconditioner only performs substitutions. ---*/
 
   SU2_OMP_FOR_DYN(1)
   for (auto iLinelet = 0ul; iLinelet < nLinelet; iLinelet++) {
 
-    /*--- Get references to the working vectors allocated for this thread. ---*/
+    ScalarType aux_block[MAXNVAR*MAXNVAR], mod_diag[MAXNVAR*MAXNVAR];
 
-    int thread = omp_get_thread_num();
-    vector<const ScalarType*>& lineletUpper = LineletUpper[thread];
-    vector<ScalarType>& lineletInvDiag = LineletInvDiag[thread];
-    vector<ScalarType>& lineletVector = LineletVector[thread];
+    const auto begin = lineletPtr[iLinelet];
+    const auto nElem = lineletPtr[iLinelet+1] - begin;
 
-    /*--- Initialize the solution vector with the rhs ---*/
+    /*--- Invert the diagonal of the first point of the linelet. ---*/
 
-    auto nElem = LineletPoint[iLinelet].size();
+    MatrixCopy(lineletDiag[begin], aux_block);
+    MatrixInverse(aux_block, &lineletInvDiag[begin*nVar*nVar]);
 
-    for (auto iElem = 0ul; iElem < nElem; iElem++) {
-      auto iPoint = LineletPoint[iLinelet][iElem];
-      for (auto iVar = 0ul; iVar < nVar; iVar++)
-        lineletVector[iElem*nVar+iVar] = vec[iPoint*nVar+iVar];
-    }
+    for (auto iElem = 1ul; iElem < nElem; iElem++) {
 
-    /*--- Forward pass, eliminate lower entries, modify diagonal and rhs. ---*/
+      const auto e = begin+iElem;
 
-    /*--- Small temporaries. ---*/
-    ScalarType aux_block[MAXNVAR*MAXNVAR], aux_vector[MAXNVAR];
+      /*--- Weight, lower block times the previous inverted diagonal. ---*/
 
-    /*--- Copy diagonal block for first point in this linelet. ---*/
-    MatrixCopy(&matrix[dia_ptr[LineletPoint[iLinelet][0]]*nVar*nVar],
-               lineletInvDiag.data());
+      auto weight = &lineletWeight[e*nVar*nVar];
+      MatrixMatrixProduct(lineletLower[e], &lineletInvDiag[(e-1)*nVar*nVar], weight);
 
-    for (auto iElem = 1ul; iElem < nElem; iElem++) {
+      /*--- Modify the diagonal, d' = d - weight * u_{i-1}, and invert it. ---*/
 
-      /*--- Setup pointers to required matrices and vectors ---*/
-      auto im1Point = LineletPoint[iLinelet][iElem-1];
-      auto iPoint = LineletPoint[iLinelet][iElem];
+      MatrixMatrixProduct(weight, lineletUpper[e-1], mod_diag);
+      MatrixSubtraction(lineletDiag[e], mod_diag, mod_diag);
+      MatrixInverse(mod_diag, &lineletInvDiag[e*nVar*nVar]);
+    }
+  }
+  END_SU2_OMP_FOR
 
-      auto d = &matrix[dia_ptr[iPoint]*nVar*nVar];
-      auto l = GetBlock(iPoint, im1Point);
-      auto u = GetBlock(im1Point, iPoint);
+}
 
-      auto inv_dm1 = &lineletInvDiag[(iElem-1)*nVar*nVar];
-      auto d_prime = &lineletInvDiag[iElem*nVar*nVar];
-      auto b_prime = &lineletVector[iElem*nVar];
+template<class ScalarType>
+void CSysMatrix<ScalarType>::ComputeLineletPreconditioner(const CSysVector<ScalarType> & vec, CSysVector<ScalarType> & prod,
+                                                          CGeometry *geometry, const CConfig *config) const {
+  /*--- Coherent view of vectors. ---*/
+  SU2_OMP_BARRIER
 
-      /*--- Invert previous modified diagonal ---*/
-      MatrixCopy(inv_dm1, aux_block);
-      MatrixInverse(aux_block, inv_dm1);
+  /*--- Jacobi preconditioning where there is no linelet ---*/
 
-      /*--- Left-multiply by lower block to obtain the weight ---*/
-      MatrixMatrixProduct(l, inv_dm1, aux_block);
+  SU2_OMP_FOR_(schedule(dynamic,omp_heavy_size) SU2_NOWAIT)
+  for (auto iPoint = 0ul; iPoint < nPointDomain; iPoint++)
+    if (!LineletBool[iPoint])
+      MatrixVectorProduct(&(invM[iPoint*nVar*nVar]), &vec[iPoint*nVar], &prod[iPoint*nVar]);
+  END_SU2_OMP_FOR
+
+  /*--- Solve each linelet with the stored Thomas factorization (see
+   *    FactorizeLineletPreconditioner), only substitutions remain here. ---*/
 
-      /*--- Multiply weight by upper block to modify current diagonal ---*/
-      MatrixMatrixProduct(aux_block, u, d_prime);
-      MatrixSubtraction(d, d_prime, d_prime);
+  SU2_OMP_FOR_DYN(1)
+  for (auto iLinelet = 0ul; iLinelet < nLinelet; iLinelet++) {
 
-      /*--- Update the rhs ---*/
-      MatrixVectorProduct(aux_block, &lineletVector[(iElem-1)*nVar], aux_vector);
-      VectorSubtraction(b_prime, aux_vector, b_prime);
+    ScalarType aux_vector[MAXNVAR];
 
-      /*--- Cache upper block pointer for the backward substitution phase ---*/
-      lineletUpper[iElem-1] = u;
-    }
+    const auto& points = LineletPoint[iLinelet];
+    const auto begin = lineletPtr[iLinelet];
+    const auto nElem = points.size();
 
-    /*--- Backwards substitution, LineletVector becomes the solution ---*/
+    /*--- Forward substitution, b'_i = b_i - w_i * b'_{i-1}, stored in prod. ---*/
 
-    /*--- x_n = d_n^{-1} * b_n ---*/
-    Gauss_Elimination(&lineletInvDiag[(nElem-1)*nVar*nVar], &lineletVector[(nElem-1)*nVar]);
+    for (auto iVar = 0ul; iVar < nVar; iVar++)
+      prod[points[0]*nVar+iVar] = vec[points[0]*nVar+iVar];
 
-    /*--- x_i = d_i^{-1}*(b_i - u_i*x_{i+1}) ---*/
-    for (auto iElem = nElem-1; iElem > 0; --iElem) {
-      auto inv_dm1 = &lineletInvDiag[(iElem-1)*nVar*nVar];
-      MatrixVectorProduct(lineletUpper[iElem-1], &lineletVector[iElem*nVar], aux_vector);
-      VectorSubtraction(&lineletVector[(iElem-1)*nVar], aux_vector, aux_vector);
-      MatrixVectorProduct(inv_dm1, aux_vector, &lineletVector[(iElem-1)*nVar]);
+    for (auto iElem = 1ul; iElem < nElem; iElem++) {
+      const auto iPoint = points[iElem];
+      for (auto iVar = 0ul; iVar < nVar; iVar++)
+        prod[iPoint*nVar+iVar] = vec[iPoint*nVar+iVar];
+      MatrixVectorProductSub(&lineletWeight[(begin+iElem)*nVar*nVar],
+                             &prod[points[iElem-1]*nVar], &prod[iPoint*nVar]);
     }
 
-    /*--- Copy results to product vector ---*/
+    /*--- Backward substitution, x_n = d_n^{-1} * b'_n ---*/
+
+    const auto last = points[nElem-1];
+    for (auto iVar = 0ul; iVar < nVar; iVar++)
+      aux_vector[iVar] = prod[last*nVar+iVar];
+    MatrixVectorProduct(&lineletInvDiag[(begin+nElem-1)*nVar*nVar], aux_vector, &prod[last*nVar]);
 
-    for (auto iElem = 0ul; iElem < nElem; iElem++) {
-      auto iPoint = LineletPoint[iLinelet][iElem];
+    /*--- x_i = d_i^{-1}*(b'_i - u_i*x_{i+1}) ---*/
+
+    for (auto iElem = nElem-1; iElem > 0; --iElem) {
+      const auto iPoint = points[iElem-1];
+      MatrixVectorProductSub(lineletUpper[begin+iElem-1], &prod[points[iElem]*nVar], &prod[iPoint*nVar]);
       for (auto iVar = 0ul; iVar < nVar; iVar++)
-        prod[iPoint*nVar+iVar] = lineletVector[iElem*nVar+iVar];
+        aux_vector[iVar] = prod[iPoint*nVar+iVar];
+      MatrixVectorProduct(&lineletInvDiag[(begin+iElem-1)*nVar*nVar], aux_vector, &prod[iPoint*nVar]);
     }
 
   }
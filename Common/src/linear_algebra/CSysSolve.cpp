@@ -33,6 +33,7 @@
 #include "../../include/linear_algebra/CSysMatrix.hpp"
 #include "../../include/linear_algebra/CMatrixVectorProduct.hpp"
 #include "../../include/linear_algebra/CPreconditioner.hpp"
+#include "../../include/toolboxes/CPhaseProfiler.hpp"
 
 #include <limits>
 
@@ -54,6 +55,7 @@ CSysSolve<ScalarType>::CSysSolve(LINEAR_SOLVER_MODE linear_solver_mode) :
   cg_ready(false),
   bcg_ready(false),
   smooth_ready(false),
+  pcg_ready(false),
   LinSysSol_ptr(nullptr),
   LinSysRes_ptr(nullptr) {
 }
@@ -132,19 +134,24 @@ void CSysSolve<ScalarType>::ModGramSchmidt(int i, su2matrix<ScalarType>& Hsbg,
     SU2_MPI::Error("FGMRES orthogonalization failed, linear solver diverged.", CURRENT_FUNCTION);
   }
 
-  /*--- Begin main Gram-Schmidt loop ---*/
+  /*--- Begin main Gram-Schmidt loop. Subtracting the projection onto w[k] is fused
+  with the dot product against the next basis vector (or with the squared norm of
+  the result on the last step), halving the number of passes over w[i+1]. ---*/
+
+  ScalarType prod = w[i+1].dot(w[0]);
 
   for (int k = 0; k < i+1; k++) {
-    ScalarType prod = w[i+1].dot(w[k]);
     Hsbg(k,i) = prod;
-    w[i+1] -= prod * w[k];
+    const auto& next = (k < i) ? w[k+1] : w[i+1];
+
+    ScalarType prodNext = w[i+1].AxpyDot(-prod, w[k], next);
 
     /*--- Check if reorthogonalization is necessary ---*/
 
     if (prod*prod > thr) {
       prod = w[i+1].dot(w[k]);
       Hsbg(k,i) += prod;
-      w[i+1] -= prod * w[k];
+      prodNext = w[i+1].AxpyDot(-prod, w[k], next);
     }
 
     /*--- Update the norm and check its size ---*/
@@ -152,11 +159,12 @@ void CSysSolve<ScalarType>::ModGramSchmidt(int i, su2matrix<ScalarType>& Hsbg,
     nrm -= pow(Hsbg(k,i),2);
     nrm = max<ScalarType>(nrm, 0.0);
     thr = nrm*reorth;
+    prod = prodNext;
   }
 
-  /*--- Test the resulting vector ---*/
+  /*--- Test the resulting vector, the last fused pass returned its squared norm ---*/
 
-  nrm = w[i+1].norm();
+  nrm = sqrt(prod);
   Hsbg(i+1,i) = nrm;
 
   /*--- Scale the resulting vector ---*/
@@ -337,6 +345,245 @@ unsigned long CSysSolve<ScalarType>::CG_LinSolver(const CSysVector<ScalarType> &
 
 }
 
+namespace {
+/*!
+ * \brief Local part of the fused dot products of pipelined CG, i.e. (r,u), (w,u),
+ *        and (r,r), followed by a single non-blocking global reduction.
+ * \note The results are only valid (on all threads) after CompletePipelinedDots.
+ */
+template<class ScalarType>
+void StartPipelinedDots(const CSysVector<ScalarType>& r, const CSysVector<ScalarType>& u,
+                        const CSysVector<ScalarType>& w, ScalarType* localDots,
+                        ScalarType* globalDots, SU2_MPI::Request& req) {
+
+  /*--- All threads get the same "view" of the vectors and shared variables. ---*/
+  SU2_OMP_BARRIER
+  SU2_OMP_MASTER
+  localDots[0] = localDots[1] = localDots[2] = 0.0;
+  END_SU2_OMP_MASTER
+  SU2_OMP_BARRIER
+
+  /*--- Local dot products for each thread. ---*/
+  ScalarType sum[3] = {0.0, 0.0, 0.0};
+
+  SU2_OMP_FOR_(schedule(static) SU2_NOWAIT)
+  for (auto i = 0ul; i < r.GetNElmDomain(); ++i) {
+    sum[0] += r[i]*u[i];
+    sum[1] += w[i]*u[i];
+    sum[2] += r[i]*r[i];
+  }
+  END_SU2_OMP_FOR
+
+  for (int k = 0; k < 3; ++k) atomicAdd(sum[k], localDots[k]);
+
+  SU2_OMP_BARRIER
+  SU2_OMP_MASTER {
+#ifdef HAVE_MPI
+    /*--- Start the reduction across all mpi ranks, only master thread communicates. ---*/
+    const auto mpi_type = (sizeof(ScalarType) < sizeof(double)) ? MPI_FLOAT : MPI_DOUBLE;
+    SelectMPIWrapper<ScalarType>::W::Iallreduce(localDots, globalDots, 3, mpi_type, MPI_SUM,
+                                                SU2_MPI::GetComm(), &req);
+#else
+    for (int k = 0; k < 3; ++k) globalDots[k] = localDots[k];
+#endif
+  }
+  END_SU2_OMP_MASTER
+}
+
+/*!
+ * \brief Waits for the reduction started by StartPipelinedDots, on return all
+ *        threads have a consistent view of the global dot products.
+ */
+template<class ScalarType>
+void CompletePipelinedDots(SU2_MPI::Request& req) {
+  SU2_OMP_BARRIER
+#ifdef HAVE_MPI
+  SU2_OMP_MASTER {
+    SU2_MPI::Status status;
+    SelectMPIWrapper<ScalarType>::W::Wait(&req, &status);
+  }
+  END_SU2_OMP_MASTER
+  SU2_OMP_BARRIER
+#endif
+}
+}
+
+template<class ScalarType>
+unsigned long CSysSolve<ScalarType>::PCG_LinSolver(const CSysVector<ScalarType> & b, CSysVector<ScalarType> & x,
+                                                   const CMatrixVectorProduct<ScalarType> & mat_vec, const CPreconditioner<ScalarType> & precond,
+                                                   ScalarType tol, unsigned long m, ScalarType & residual, bool monitoring, const CConfig *config) const {
+
+  const bool master = (SU2_MPI::GetRank() == MASTER_NODE) && (omp_get_thread_num() == 0);
+  ScalarType norm_r = 0.0, norm0 = 0.0;
+  unsigned long i = 0;
+
+  /*--- Shared (across threads) storage for the fused reductions. ---*/
+
+  static ScalarType localDots[3], dots[3];
+  static SU2_MPI::Request req;
+
+  /*--- Check the subspace size ---*/
+
+  if (m < 1) {
+    SU2_MPI::Error("Number of linear solver iterations must be greater than 0.", CURRENT_FUNCTION);
+  }
+
+  /*--- Allocate if not allocated yet, only one thread can
+   *    do this since the working vectors are shared. ---*/
+
+  if (!pcg_ready) {
+    SU2_OMP_BARRIER
+    SU2_OMP_MASTER {
+      auto nVar = b.GetNVar();
+      auto nBlk = b.GetNBlk();
+      auto nBlkDomain = b.GetNBlkDomain();
+
+      A_x.Initialize(nBlk, nBlkDomain, nVar, nullptr);
+      r.Initialize(nBlk, nBlkDomain, nVar, nullptr);
+      z.Initialize(nBlk, nBlkDomain, nVar, nullptr);
+      p.Initialize(nBlk, nBlkDomain, nVar, nullptr);
+      v.Initialize(nBlk, nBlkDomain, nVar, nullptr);
+      pipe_m.Initialize(nBlk, nBlkDomain, nVar, nullptr);
+      pipe_z.Initialize(nBlk, nBlkDomain, nVar, nullptr);
+      pipe_q.Initialize(nBlk, nBlkDomain, nVar, nullptr);
+      pipe_s.Initialize(nBlk, nBlkDomain, nVar, nullptr);
+
+      pcg_ready = true;
+    }
+    END_SU2_OMP_MASTER
+    SU2_OMP_BARRIER
+  }
+
+  /*--- The recurrences are scaled by beta=0 on the first iteration,
+   *    but 0*garbage could still produce NaNs. ---*/
+
+  pipe_z.SetValZero();
+  pipe_q.SetValZero();
+  pipe_s.SetValZero();
+  p.SetValZero();
+
+  /*--- Calculate the initial residual, compute norm, and check if system is already solved ---*/
+
+  if (!xIsZero) {
+    mat_vec(x, A_x);
+    r = b - A_x;
+  } else {
+    r = b;
+  }
+
+  /*--- Only compute the residuals in full communication mode. ---*/
+
+  if (config->GetComm_Level() == COMM_FULL) {
+
+    norm_r = r.norm();
+    norm0  = b.norm();
+
+    /*--- Set the norm to the initial initial residual value ---*/
+
+    if (tol_type == LinearToleranceType::RELATIVE) norm0 = norm_r;
+
+    if ((norm_r < tol*norm0) || (norm_r < eps)) {
+      if (master && (lin_sol_mode!=LINEAR_SOLVER_MODE::MESH_DEFORM)) cout << "CSysSolve::PipelinedCG(): system solved by initial guess." << endl;
+      return 0;
+    }
+
+    /*--- Output header information including initial residual ---*/
+
+    if (monitoring && master) {
+      WriteHeader("PCG", tol, norm_r);
+      WriteHistory(i, norm_r/norm0);
+    }
+
+  }
+
+  /*--- Initial preconditioned residual (u = z) and its product with the matrix (w = v). ---*/
+
+  precond(r, z);
+  mat_vec(z, v);
+
+  ScalarType alpha = 1.0, gamma = 0.0;
+
+  /*---  Loop over all search directions ---*/
+
+  for (i = 0; i < m; i++) {
+
+    /*--- Start the fused non-blocking reduction of (r,u), (w,u) and (r,r). ---*/
+
+    StartPipelinedDots(r, z, v, localDots, dots, req);
+
+    /*--- Overlap the global communication with the preconditioner
+     *    and matrix-vector product (m = M^-1.w and n = A.m). ---*/
+
+    precond(v, pipe_m);
+    mat_vec(pipe_m, A_x);
+
+    CompletePipelinedDots<ScalarType>(req);
+
+    const ScalarType gamma_new = dots[0];
+    const ScalarType delta = dots[1];
+    norm_r = sqrt(dots[2]);
+
+    /*--- Only check the residuals in full communication mode, note that the
+     *    norm comes for free with the fused reduction. ---*/
+
+    if (config->GetComm_Level() == COMM_FULL) {
+      if (norm_r < tol*norm0) break;
+      if (((monitoring) && (master)) && ((i+1) % monitorFreq == 0))
+        WriteHistory(i+1, norm_r/norm0);
+    }
+
+    /*--- Step length and Gram-Schmidt coefficient from the fused reduction. ---*/
+
+    ScalarType beta;
+    if (i == 0) {
+      beta = 0.0;
+      alpha = gamma_new / delta;
+    }
+    else {
+      beta = gamma_new / gamma;
+      alpha = gamma_new / (delta - beta*gamma_new/alpha);
+    }
+    gamma = gamma_new;
+
+    /*--- Update the recurrences, then solution and residuals, note that the
+     *    usual products A.p and M^-1.A.p are obtained with vector updates. ---*/
+
+    pipe_z = A_x + beta*pipe_z;
+    pipe_q = pipe_m + beta*pipe_q;
+    pipe_s = v + beta*pipe_s;
+    p = z + beta*p;
+
+    x += alpha*p;
+    r -= alpha*pipe_s;
+    z -= alpha*pipe_q;
+    v -= alpha*pipe_z;
+
+  }
+
+  /*--- Recalculate final residual (this should be optional) ---*/
+
+  if ((monitoring) && (config->GetComm_Level() == COMM_FULL)) {
+
+    if (master) WriteFinalResidual("PCG", i, norm_r/norm0);
+
+    if (recomputeRes) {
+      mat_vec(x, A_x);
+      r = b - A_x;
+      ScalarType true_res = r.norm();
+
+      if (fabs(true_res - norm_r) > tol*10.0) {
+        if (master) {
+          WriteWarning(norm_r, true_res, tol);
+        }
+      }
+    }
+  }
+
+  residual = norm_r/norm0;
+  return i;
+
+}
+
 template<class ScalarType>
 unsigned long CSysSolve<ScalarType>::FGMRES_LinSolver(const CSysVector<ScalarType> & b, CSysVector<ScalarType> & x,
                                                       const CMatrixVectorProduct<ScalarType> & mat_vec, const CPreconditioner<ScalarType> & precond,
@@ -355,16 +602,45 @@ unsigned long CSysSolve<ScalarType>::FGMRES_LinSolver(const CSysVector<ScalarTyp
     SU2_MPI::Error("FGMRES subspace is too large.", CURRENT_FUNCTION);
   }
 
-  /*--- Allocate if not allocated yet ---*/
+  /*--- Directions recycled from the previous solve are injected at the start of the
+   cycle, consecutive systems differ little so they act as cheap deflation vectors.
+   This requires right preconditioning because the FGMRES solution update allows
+   arbitrary vectors in the Z basis, recycling is skipped otherwise. ---*/
+
+  const unsigned long nRecycleReq = (flexible && (config != nullptr)) ?
+                                    config->GetLinear_Solver_Recycle_Directions() : 0ul;
 
-  if (W.size() <= m || (flexible && Z.size() <= m)) {
+  if (R.size() < nRecycleReq) {
     SU2_OMP_BARRIER
     SU2_OMP_MASTER {
+      R.resize(nRecycleReq);
+      for (auto& vec : R) vec.Initialize(x.GetNBlk(), x.GetNBlkDomain(), x.GetNVar(), nullptr);
+      nRecycled = 0;
+    }
+    END_SU2_OMP_MASTER
+    SU2_OMP_BARRIER
+  }
+
+  const unsigned long nAugment = min(nRecycled, min(nRecycleReq, m/2));
+
+  /*--- Allocate if not allocated yet. All basis vectors live in one contiguous slab,
+   each padded to a multiple of the cache line so that they stay 64-byte aligned. ---*/
+
+  const auto linePad = 64 / sizeof(ScalarType);
+  const auto stride = ((x.GetLocSize() + linePad - 1) / linePad) * linePad;
+  const auto nBasis = (flexible ? 2 : 1) * (m + 1);
+
+  if (krylovSlab.size() < nBasis * stride || W.size() <= m || (flexible && Z.size() <= m)) {
+    SU2_OMP_BARRIER
+    SU2_OMP_MASTER {
+      krylovSlab.resize(nBasis * stride);
       W.resize(m+1);
-      for (auto& w : W) w.Initialize(x.GetNBlk(), x.GetNBlkDomain(), x.GetNVar(), nullptr);
+      for (auto j = 0ul; j <= m; ++j)
+        W[j].MapExternalStorage(x.GetNBlk(), x.GetNBlkDomain(), x.GetNVar(), krylovSlab.data() + j*stride);
       if (flexible) {
         Z.resize(m+1);
-        for (auto& z : Z) z.Initialize(x.GetNBlk(), x.GetNBlkDomain(), x.GetNVar(), nullptr);
+        for (auto j = 0ul; j <= m; ++j)
+          Z[j].MapExternalStorage(x.GetNBlk(), x.GetNBlkDomain(), x.GetNVar(), krylovSlab.data() + (m+1+j)*stride);
       }
     }
     END_SU2_OMP_MASTER
@@ -438,9 +714,16 @@ unsigned long CSysSolve<ScalarType>::FGMRES_LinSolver(const CSysVector<ScalarTyp
     if (beta < tol*norm0) break;
 
     if (flexible) {
-      /*---  Precondition the CSysVector w[i] and store result in z[i] ---*/
+      if (i < nAugment) {
+        /*---  Inject a recycled direction instead of preconditioning. ---*/
 
-      precond(W[i], Z[i]);
+        Z[i] = R[i];
+      }
+      else {
+        /*---  Precondition the CSysVector w[i] and store result in z[i] ---*/
+
+        precond(W[i], Z[i]);
+      }
 
       /*---  Add to Krylov subspace ---*/
 
@@ -478,8 +761,29 @@ unsigned long CSysSolve<ScalarType>::FGMRES_LinSolver(const CSysVector<ScalarTyp
 
   const auto& basis = flexible? Z : W;
 
-  for (unsigned long k = 0; k < i; k++) {
-    x += y[k] * basis[k];
+  /*--- Update the solution with all search directions in a single fused pass. ---*/
+
+  if (i > 0) {
+    vector<const CSysVector<ScalarType>*> dirs(i);
+    for (unsigned long k = 0; k < i; k++) dirs[k] = &basis[k];
+    x.AddLinearCombination(i, y.data(), dirs.data());
+  }
+
+  /*--- Keep the directions that contributed most to the solution update, they are
+   reused as deflation vectors in the next solve. All threads compute the same
+   selection and participate in the (parallel) vector copies. ---*/
+
+  if ((nRecycleReq > 0) && (i > 0)) {
+    const auto nKeep = min<unsigned long>(nRecycleReq, i);
+    vector<unsigned long> idx(i);
+    for (unsigned long k = 0; k < i; k++) idx[k] = k;
+    partial_sort(idx.begin(), idx.begin()+nKeep, idx.end(),
+                 [&y](unsigned long a, unsigned long b) { return fabs(y[a]) > fabs(y[b]); });
+    for (unsigned long k = 0; k < nKeep; k++) R[k] = Z[idx[k]];
+    SU2_OMP_MASTER {
+      nRecycled = nKeep;
+    }
+    END_SU2_OMP_MASTER
   }
 
   /*---  Recalculate final (neg.) residual (this should be optional) ---*/
@@ -724,6 +1028,7 @@ unsigned long CSysSolve<ScalarType>::Smoother_LinSolver(const CSysVector<ScalarT
       A_x.Initialize(nBlk, nBlkDomain, nVar, nullptr);
       r.Initialize(nBlk, nBlkDomain, nVar, nullptr);
       z.Initialize(nBlk, nBlkDomain, nVar, nullptr);
+      zAux.Initialize(nBlk, nBlkDomain, nVar, nullptr);
 
       smooth_ready = true;
     }
@@ -765,22 +1070,39 @@ unsigned long CSysSolve<ScalarType>::Smoother_LinSolver(const CSysVector<ScalarT
 
   }
 
+  /*--- When the preconditioner supports it (e.g. Jacobi), fuse its application
+   into the matrix-vector product: with z = M^{-1}*r tracked directly, one fused
+   sweep yields A*z and M^{-1}*A*z, and by linearity the next increment is
+   z -= w*M^{-1}*A*z. This saves a separate pass over the inverse diagonal (and
+   one halo exchange) per iteration compared to re-applying M^{-1} to r. ---*/
+
+  const bool fused = precond.SupportsApplyToProduct();
+
+  /*--- Compute the first solution increment, z = M^{-1} * r. ---*/
+
+  if (fused) precond(r, z);
+
   /*--- Smoothing Iterations ---*/
 
   for (i=0; i<m; i++) {
 
-    /*--- Compute the solution increment (z), or "search" direction, by applying
-     the preconditioner to the residual, i.e. z = M^{-1} * r. ---*/
+    if (fused) {
+      precond.ApplyToProduct(z, A_x, zAux);
+    }
+    else {
+      /*--- Compute the solution increment (z), or "search" direction, by applying
+       the preconditioner to the residual, i.e. z = M^{-1} * r. ---*/
 
-    precond(r, z);
+      precond(r, z);
 
-    /*--- The increment will be added to the solution (with relaxation omega)
-     to update the residual, needed to compute the next increment, we get the
-     product of the matrix with the direction (into A_x) and subtract from the
-     current residual, the system is linear so this saves some computation
-     compared to re-evaluating r = b-A*x. ---*/
+      /*--- The increment will be added to the solution (with relaxation omega)
+       to update the residual, needed to compute the next increment, we get the
+       product of the matrix with the direction (into A_x) and subtract from the
+       current residual, the system is linear so this saves some computation
+       compared to re-evaluating r = b-A*x. ---*/
 
-    mat_vec(z, A_x);
+      mat_vec(z, A_x);
+    }
 
     /*--- Update solution and residual with relaxation omega. Mathematically this
      is a modified Richardson iteration for the left-preconditioned system
@@ -789,6 +1111,7 @@ unsigned long CSysSolve<ScalarType>::Smoother_LinSolver(const CSysVector<ScalarT
 
     x += omega * z;
     r -= omega * A_x;
+    if (fused) z -= omega * zAux;
 
     /*--- Only compute the residuals in full communication mode. ---*/
     /*--- Check if solution has converged, else output the relative residual if necessary. ---*/
@@ -814,6 +1137,7 @@ unsigned long CSysSolve<ScalarType>::Smoother_LinSolver(const CSysVector<ScalarT
 template<class ScalarType>
 unsigned long CSysSolve<ScalarType>::Solve(CSysMatrix<ScalarType> & Jacobian, const CSysVector<su2double> & LinSysRes,
                                            CSysVector<su2double> & LinSysSol, CGeometry *geometry, const CConfig *config) {
+  SU2_PROFILE_PHASE(LINEAR_SOLVE);
   /*---
    A word about the templated types. It is assumed that the residual and solution vectors are always of su2doubles,
    meaning that they are active in the discrete adjoint. The same assumption is made in SetExternalSolve.
@@ -850,6 +1174,19 @@ unsigned long CSysSolve<ScalarType>::Solve(CSysMatrix<ScalarType> & Jacobian, co
       break;
     }
 
+    /*--- Scalar (turbulence/species) mode, dedicated settings so that e.g. a line-implicit
+     * smoother can be used for the near-tridiagonal wall-normal turbulence systems while
+     * the mean flow keeps its Krylov solver. Defaults to the LINEAR_SOLVER settings. ---*/
+    case LINEAR_SOLVER_MODE::TURBULENT: {
+      KindSolver   = config->GetKind_Turb_Linear_Solver();
+      KindPrecond  = config->GetKind_Turb_Linear_Solver_Prec();
+      MaxIter      = config->GetTurb_Linear_Solver_Iter();
+      SolverTol    = SU2_TYPE::GetValue(config->GetLinear_Solver_Error());
+      SolverTol   *= tolForcing;
+      ScreenOutput = false;
+      break;
+    }
+
     /*--- Normal mode
      * assumes that 'lin_sol_mode==LINEAR_SOLVER_MODE::STANDARD', but does not enforce it to avoid compiler warning. ---*/
     default: {
@@ -857,6 +1194,8 @@ unsigned long CSysSolve<ScalarType>::Solve(CSysMatrix<ScalarType> & Jacobian, co
       KindPrecond  = config->GetKind_Linear_Solver_Prec();
       MaxIter      = config->GetLinear_Solver_Iter();
       SolverTol    = SU2_TYPE::GetValue(config->GetLinear_Solver_Error());
+      /*--- Inexact-Newton forcing, tighter solves as the nonlinear problem converges. ---*/
+      SolverTol   *= tolForcing;
       ScreenOutput = false;
       break;
     }
@@ -891,39 +1230,88 @@ unsigned long CSysSolve<ScalarType>::Solve(CSysMatrix<ScalarType> & Jacobian, co
 
   auto precond = CPreconditioner<ScalarType>::Create(kindPrec, Jacobian, geometry, config);
 
-  /*--- Build preconditioner. ---*/
+  /*--- Build preconditioner, unless the caller guarantees that the matrix (and with it the
+   * factorization it stores from the previous call) has not changed. AMG keeps its state in
+   * the preconditioner object, which does not outlive the call, and always rebuilds. ---*/
 
-  precond->Build();
+  if (recomputePrecond || kindPrec == AMG) precond->Build();
 
   /*--- Solve system. ---*/
 
   unsigned long IterLinSol = 0;
   ScalarType residual = 0.0;
 
-  switch (KindSolver) {
-    case BCGSTAB:
-      IterLinSol = BCGSTAB_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter, residual, ScreenOutput, config);
-      break;
-    case FGMRES:
-      IterLinSol = FGMRES_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter, residual, ScreenOutput, config);
-      break;
-    case RESTARTED_FGMRES:
-      IterLinSol = RFGMRES_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter, residual, ScreenOutput, config);
-      break;
-    case CONJUGATE_GRADIENT:
-      IterLinSol = CG_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter, residual, ScreenOutput, config);
-      break;
-    case SMOOTHER:
-      IterLinSol = Smoother_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter, residual, ScreenOutput, config);
-      break;
-    case PASTIX_LDLT : case PASTIX_LU:
-      Jacobian.BuildPastixPreconditioner(geometry, config, KindSolver);
-      Jacobian.ComputePastixPreconditioner(*LinSysRes_ptr, *LinSysSol_ptr, geometry, config);
-      IterLinSol = 1;
-      residual = 1e-20;
-      break;
-    default:
-      SU2_MPI::Error("Unknown type of linear solver.",CURRENT_FUNCTION);
+  auto SolveSystem = [&](const VectorType& b, VectorType& x) {
+    unsigned long iter = 0;
+    switch (KindSolver) {
+      case BCGSTAB:
+        iter = BCGSTAB_LinSolver(b, x, mat_vec, *precond, SolverTol, MaxIter, residual, ScreenOutput, config);
+        break;
+      case FGMRES:
+        iter = FGMRES_LinSolver(b, x, mat_vec, *precond, SolverTol, MaxIter, residual, ScreenOutput, config);
+        break;
+      case RESTARTED_FGMRES:
+        iter = RFGMRES_LinSolver(b, x, mat_vec, *precond, SolverTol, MaxIter, residual, ScreenOutput, config);
+        break;
+      case CONJUGATE_GRADIENT:
+        iter = CG_LinSolver(b, x, mat_vec, *precond, SolverTol, MaxIter, residual, ScreenOutput, config);
+        break;
+      case PIPELINED_CG:
+        iter = PCG_LinSolver(b, x, mat_vec, *precond, SolverTol, MaxIter, residual, ScreenOutput, config);
+        break;
+      case SMOOTHER:
+        iter = Smoother_LinSolver(b, x, mat_vec, *precond, SolverTol, MaxIter, residual, ScreenOutput, config);
+        break;
+      case PASTIX_LDLT : case PASTIX_LU:
+        Jacobian.BuildPastixPreconditioner(geometry, config, KindSolver);
+        Jacobian.ComputePastixPreconditioner(b, x, geometry, config);
+        iter = 1;
+        residual = 1e-20;
+        break;
+      default:
+        SU2_MPI::Error("Unknown type of linear solver.",CURRENT_FUNCTION);
+    }
+    return iter;
+  };
+
+  IterLinSol = SolveSystem(*LinSysRes_ptr, *LinSysSol_ptr);
+
+  HandleTemporariesOut(LinSysSol);
+
+  /*--- Iterative refinement, only effective when the solver runs in a lower precision
+   * than the outer vectors (mixed precision builds). The correction systems reuse the
+   * solver-precision temporaries while the residual and solution are accumulated in
+   * full precision, recovering accuracy beyond the limit of the solver scalar. ---*/
+
+  const bool lowPrecision = sizeof(ScalarType) < sizeof(passivedouble);
+  unsigned short nRefine = 0;
+  if (lowPrecision && (lin_sol_mode == LINEAR_SOLVER_MODE::STANDARD) && !TapeActive)
+    nRefine = config->GetLinear_Solver_Refine_Iter();
+
+  if (nRefine > 0) {
+    const su2double RefineTol = SU2_TYPE::GetValue(SolverTol) * LinSysRes.norm();
+
+    for (auto iRefine = 0u; iRefine < nRefine; ++iRefine) {
+
+      /*--- Full precision residual of the current solution, the matrix-vector
+       * product is still evaluated in solver precision. ---*/
+
+      Refine_x.PassiveCopy(LinSysSol);
+      mat_vec(Refine_x, Refine_Ax);
+      Refine_r.PassiveCopy(Refine_Ax);
+      Refine_r = LinSysRes - Refine_r;
+
+      if (Refine_r.norm() <= RefineTol) break;
+
+      /*--- Solve for the correction in solver precision and accumulate it. ---*/
+
+      LinSysRes_tmp.PassiveCopy(Refine_r);
+      LinSysSol_tmp.SetValZero();
+      IterLinSol += SolveSystem(LinSysRes_tmp, LinSysSol_tmp);
+
+      Refine_r.PassiveCopy(LinSysSol_tmp);
+      LinSysSol += Refine_r;
+    }
   }
 
   SU2_OMP_MASTER
@@ -933,8 +1321,6 @@ unsigned long CSysSolve<ScalarType>::Solve(CSysMatrix<ScalarType> & Jacobian, co
   }
   END_SU2_OMP_MASTER
 
-  HandleTemporariesOut(LinSysSol);
-
   delete precond;
 
   if(TapeActive) {
@@ -958,6 +1344,12 @@ unsigned long CSysSolve<ScalarType>::Solve(CSysMatrix<ScalarType> & Jacobian, co
       case LINELET:
         if (RequiresTranspose) Jacobian.BuildJacobiPreconditioner();
         break;
+      case MC_SGS:
+        if (RequiresTranspose) Jacobian.BuildMulticolorSGSPreconditioner();
+        break;
+      case AMG:
+        /*--- Rebuilt from the transposed Jacobian in Solve_b. ---*/
+        break;
       case LU_SGS:
         /*--- Nothing to build. ---*/
         break;
@@ -1052,6 +1444,11 @@ unsigned long CSysSolve<ScalarType>::Solve_b(CSysMatrix<ScalarType> & Jacobian,
     Jacobian.TransposeInPlace();
     precond->Build();
   }
+  else if (kindPrec == AMG) {
+    /*--- The forward solve does not keep the preconditioner object alive,
+     *    rebuild it from the (already transposed) Jacobian. ---*/
+    precond->Build();
+  }
 
   auto mat_vec = CSysMatrixVectorProduct<ScalarType>(Jacobian, geometry, config);
 
@@ -1072,6 +1469,9 @@ unsigned long CSysSolve<ScalarType>::Solve_b(CSysMatrix<ScalarType> & Jacobian,
     case CONJUGATE_GRADIENT:
       IterLinSol = CG_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter, Residual, ScreenOutput, config);
       break;
+    case PIPELINED_CG:
+      IterLinSol = PCG_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter, Residual, ScreenOutput, config);
+      break;
     case SMOOTHER:
       IterLinSol = Smoother_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter, Residual, ScreenOutput, config);
       break;
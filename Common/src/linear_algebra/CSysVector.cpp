@@ -39,9 +39,10 @@ void CSysVector<ScalarType>::Initialize(unsigned long numBlk, unsigned long numB
   if (omp_get_thread_num())
     SU2_MPI::Error("Only the master thread is allowed to initialize the vector.", CURRENT_FUNCTION);
 
-  if (nElm != numBlk * numVar) {
-    MemoryAllocation::aligned_free(vec_val);
+  if (nElm != numBlk * numVar || !ownsData) {
+    if (ownsData) MemoryAllocation::aligned_free(vec_val);
     vec_val = nullptr;
+    ownsData = true;
   }
 
   nElm = numBlk * numVar;
@@ -61,8 +62,31 @@ void CSysVector<ScalarType>::Initialize(unsigned long numBlk, unsigned long numB
   }
 }
 
+template <class ScalarType>
+void CSysVector<ScalarType>::MapExternalStorage(unsigned long numBlk, unsigned long numBlkDomain,
+                                                unsigned long numVar, ScalarType* ptr) {
+  if (omp_get_thread_num())
+    SU2_MPI::Error("Only the master thread is allowed to initialize the vector.", CURRENT_FUNCTION);
+
+  if (ownsData) {
+    if (!std::is_trivial<ScalarType>::value)
+      for (auto i = 0ul; i < nElm; i++) vec_val[i].~ScalarType();
+    MemoryAllocation::aligned_free(vec_val);
+  }
+
+  vec_val = ptr;
+  ownsData = false;
+
+  nElm = numBlk * numVar;
+  nElmDomain = numBlkDomain * numVar;
+  nVar = numVar;
+
+  omp_chunk_size = computeStaticChunkSize(nElm, omp_get_max_threads(), OMP_MAX_SIZE);
+}
+
 template <class ScalarType>
 CSysVector<ScalarType>::~CSysVector() {
+  if (!ownsData) return;
   if (!std::is_trivial<ScalarType>::value)
     for (auto i = 0ul; i < nElm; i++) vec_val[i].~ScalarType();
   MemoryAllocation::aligned_free(vec_val);
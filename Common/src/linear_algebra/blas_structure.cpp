@@ -137,6 +137,106 @@ void CBlasStructure::gemv(const int M,        const int N,   const su2double *A,
 #endif
 }
 
+/* 2D tensor product via sum factorization. */
+void CBlasStructure::tensorProduct2D(const int M,         const int K,         const int N,
+                                     const su2double *Ai, const su2double *Aj,
+                                     const su2double *B,  const int ldb,
+                                     su2double *C,        const bool addToC) {
+
+  /* Allocate the work memory for the intermediate result, if not
+     large enough already. */
+  const unsigned long sizeTmp = (unsigned long) K*M*N;
+  if(memTensorProducts.size() < sizeTmp) memTensorProducts.resize(sizeTmp);
+
+  su2double *tmpI = memTensorProducts.data();
+
+  /* Contraction in i-direction: tmpI[j][mi][n] = sum_i Ai[mi][i] B[j][i][n].
+     Note that the stride ldb must be used to address the rows of B. */
+  for(int j=0; j<K; ++j) {
+    const su2double *BB = B    + (unsigned long) j*K*ldb;
+    su2double       *T  = tmpI + (unsigned long) j*M*N;
+    for(int mi=0; mi<M; ++mi) {
+      su2double *TT = T + mi*N;
+      for(int n=0; n<N; ++n) TT[n] = 0.0;
+      for(int i=0; i<K; ++i) {
+        const su2double a   = Ai[mi*K+i];
+        const su2double *bb = BB + (unsigned long) i*ldb;
+        for(int n=0; n<N; ++n) TT[n] += a*bb[n];
+      }
+    }
+  }
+
+  /* Contraction in j-direction: C[mj][mi][n] (+)= sum_j Aj[mj][j] tmpI[j][mi][n]. */
+  for(int mj=0; mj<M; ++mj) {
+    su2double *CC = C + (unsigned long) mj*M*N;
+    if( !addToC ) for(int l=0; l<(M*N); ++l) CC[l] = 0.0;
+    for(int j=0; j<K; ++j) {
+      const su2double a  = Aj[mj*K+j];
+      const su2double *T = tmpI + (unsigned long) j*M*N;
+      for(int l=0; l<(M*N); ++l) CC[l] += a*T[l];
+    }
+  }
+}
+
+/* 3D tensor product via sum factorization. */
+void CBlasStructure::tensorProduct3D(const int M,         const int K,         const int N,
+                                     const su2double *Ai, const su2double *Aj, const su2double *Ak,
+                                     const su2double *B,  const int ldb,
+                                     su2double *C,        const bool addToC) {
+
+  /* Allocate the work memory for the two intermediate results, if not
+     large enough already. */
+  const unsigned long sizeTmpI = (unsigned long) K*K*M*N;
+  const unsigned long sizeTmpJ = (unsigned long) K*M*M*N;
+  if(memTensorProducts.size() < (sizeTmpI+sizeTmpJ))
+    memTensorProducts.resize(sizeTmpI+sizeTmpJ);
+
+  su2double *tmpI = memTensorProducts.data();
+  su2double *tmpJ = tmpI + sizeTmpI;
+
+  /* Contraction in i-direction: tmpI[k][j][mi][n] = sum_i Ai[mi][i] B[k][j][i][n].
+     Note that the stride ldb must be used to address the rows of B. */
+  for(int kj=0; kj<(K*K); ++kj) {
+    const su2double *BB = B    + (unsigned long) kj*K*ldb;
+    su2double       *T  = tmpI + (unsigned long) kj*M*N;
+    for(int mi=0; mi<M; ++mi) {
+      su2double *TT = T + mi*N;
+      for(int n=0; n<N; ++n) TT[n] = 0.0;
+      for(int i=0; i<K; ++i) {
+        const su2double a   = Ai[mi*K+i];
+        const su2double *bb = BB + (unsigned long) i*ldb;
+        for(int n=0; n<N; ++n) TT[n] += a*bb[n];
+      }
+    }
+  }
+
+  /* Contraction in j-direction: tmpJ[k][mj][mi][n] = sum_j Aj[mj][j] tmpI[k][j][mi][n]. */
+  for(int k=0; k<K; ++k) {
+    const su2double *TI = tmpI + (unsigned long) k*K*M*N;
+    su2double       *TJ = tmpJ + (unsigned long) k*M*M*N;
+    for(int mj=0; mj<M; ++mj) {
+      su2double *TT = TJ + (unsigned long) mj*M*N;
+      for(int l=0; l<(M*N); ++l) TT[l] = 0.0;
+      for(int j=0; j<K; ++j) {
+        const su2double a  = Aj[mj*K+j];
+        const su2double *T = TI + (unsigned long) j*M*N;
+        for(int l=0; l<(M*N); ++l) TT[l] += a*T[l];
+      }
+    }
+  }
+
+  /* Contraction in k-direction: C[mk][mj][mi][n] (+)= sum_k Ak[mk][k] tmpJ[k][mj][mi][n]. */
+  for(int mk=0; mk<M; ++mk) {
+    su2double *CC = C + (unsigned long) mk*M*M*N;
+    if( !addToC ) for(int l=0; l<(M*M*N); ++l) CC[l] = 0.0;
+    for(int k=0; k<K; ++k) {
+      const su2double a  = Ak[mk*K+k];
+      const su2double *T = tmpJ + (unsigned long) k*M*M*N;
+      for(int l=0; l<(M*M*N); ++l) CC[l] += a*T[l];
+    }
+  }
+}
+
 #if !(defined(HAVE_LIBXSMM) || defined(HAVE_BLAS) || defined(HAVE_MKL)) || (defined(CODI_REVERSE_TYPE) || defined(CODI_FORWARD_TYPE))
 
 /* Macros for accessing submatrices of a matmul using the leading dimension. */
@@ -0,0 +1,86 @@
+/*!
+ * \file CPhaseProfiler.cpp
+ * \brief Reduction and output of the per-phase instrumentation results.
+ * \version 7.3.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2022, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../include/toolboxes/CPhaseProfiler.hpp"
+#include "../../include/option_structure.hpp"
+
+#include <algorithm>
+#include <fstream>
+
+using namespace std;
+
+void CPhaseProfiler::WriteProfile() const {
+
+#ifdef PROFILE
+
+  constexpr auto nPhase = size_t(ProfilingPhase::COUNT);
+  const char* phaseNames[nPhase] = {"gradients", "limiters", "flux_assembly", "jacobian_assembly",
+                                    "linear_solve", "halo_comm", "output"};
+
+  /*--- Collapse the per-thread slots, the time of a phase on this rank is
+   that of the slowest thread (the wall time of the parallel region). ---*/
+
+  passivedouble localTime[nPhase] = {0.0};
+  unsigned long localCalls[nPhase] = {0};
+
+  const size_t nThread = data.size() / nPhase;
+  for (size_t iThread = 0; iThread < nThread; ++iThread) {
+    for (size_t iPhase = 0; iPhase < nPhase; ++iPhase) {
+      const auto& slot = data[iThread * nPhase + iPhase];
+      localTime[iPhase] = std::max(localTime[iPhase], slot.time);
+      localCalls[iPhase] += slot.calls;
+    }
+  }
+
+  /*--- Reduce across ranks to get the avg/min/max time of each phase. ---*/
+
+  passivedouble avgTime[nPhase], minTime[nPhase], maxTime[nPhase];
+  unsigned long totCalls[nPhase];
+  SU2_MPI::Reduce(localTime, avgTime, nPhase, MPI_DOUBLE, MPI_SUM, MASTER_NODE, SU2_MPI::GetComm());
+  SU2_MPI::Reduce(localTime, minTime, nPhase, MPI_DOUBLE, MPI_MIN, MASTER_NODE, SU2_MPI::GetComm());
+  SU2_MPI::Reduce(localTime, maxTime, nPhase, MPI_DOUBLE, MPI_MAX, MASTER_NODE, SU2_MPI::GetComm());
+  SU2_MPI::Reduce(localCalls, totCalls, nPhase, MPI_UNSIGNED_LONG, MPI_SUM, MASTER_NODE, SU2_MPI::GetComm());
+
+  if (SU2_MPI::GetRank() != MASTER_NODE) return;
+
+  int size; SU2_MPI::Comm_size(SU2_MPI::GetComm(), &size);
+  for (size_t iPhase = 0; iPhase < nPhase; ++iPhase) avgTime[iPhase] /= size;
+
+  ofstream profileFile("phase_profiling.csv");
+  profileFile.precision(6);
+  profileFile << "\"Phase\", \"Total Calls\", \"Avg Time (s)\", \"Min Time (s)\", \"Max Time (s)\", \"Avg Time per Call (s)\"\n";
+  for (size_t iPhase = 0; iPhase < nPhase; ++iPhase) {
+    const passivedouble perCall = (totCalls[iPhase] > 0) ? avgTime[iPhase] * size / totCalls[iPhase] : 0.0;
+    profileFile << "\"" << phaseNames[iPhase] << "\", " << totCalls[iPhase] << ", " << avgTime[iPhase]
+                << ", " << minTime[iPhase] << ", " << maxTime[iPhase] << ", " << perCall << "\n";
+  }
+  profileFile.close();
+
+  cout << endl << "Phase profiling data written to phase_profiling.csv" << endl;
+
+#endif
+
+}
@@ -281,10 +281,12 @@ protected:
     for (auto iSol = 0u, offset = 0u; iSol < MAX_SOLS; ++iSol) {
       auto solver = solver_container[iZone][INST_0][MESH_0][iSol];
       if (!(solver && solver->GetAdjoint())) continue;
+      /*--- An external container that was never materialized reads as zero. ---*/
       const auto& ext = solver->GetNodes()->Get_External();
+      const bool materialized = solver->GetNodes()->ExternalMaterialized();
       for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint)
         for (auto iVar = 0ul; iVar < solver->GetnVar(); ++iVar)
-          rhs(iPoint,offset+iVar) = -SU2_TYPE::GetValue(ext(iPoint,iVar));
+          rhs(iPoint,offset+iVar) = materialized? -SU2_TYPE::GetValue(ext(iPoint,iVar)) : 0.0;
       offset += solver->GetnVar();
     }
   }
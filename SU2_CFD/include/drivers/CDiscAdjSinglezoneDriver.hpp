@@ -28,6 +28,7 @@
 
 #pragma once
 #include "CSinglezoneDriver.hpp"
+#include "../../../Common/include/toolboxes/CQuasiNewtonInvLeastSquares.hpp"
 
 /*!
  * \class CDiscAdjSinglezoneDriver
@@ -45,6 +46,12 @@ protected:
   int MainSolver;                               /*!< \brief Index of the main adjoint solver. */
   su2double ObjFunc;                            /*!< \brief The value of the objective function.*/
   CIteration* direct_iteration;                 /*!< \brief A pointer to the direct iteration.*/
+  long RecomputedWindowStart = -1;              /*!< \brief Start step of the checkpoint window regenerated most recently.*/
+  long CleanupWindowStart = -1;                 /*!< \brief Older regenerated window whose transient files are deleted next.*/
+  bool CompactMainTape = false;                 /*!< \brief The main tape excludes the objective function, whose gradient
+                                                            is cached in the External containers of the adjoint solvers.*/
+  CQuasiNewtonInvLeastSquares<passivedouble> fixPtCorrector; /*!< \brief Quasi-Newton driver for the adjoint fixed point,
+                                                            a member so its history can be kept across time steps.*/
 
   CConfig *config;                              /*!< \brief Definition of the particular problem. */
   CIteration *iteration;                        /*!< \brief Container vector with all the iteration methods. */
@@ -93,8 +100,23 @@ public:
   /*!
    * \brief Record one iteration of a flow iteration in within multiple zones.
    * \param[in] kind_recording - Type of recording (full list in ENUM_RECORDING, option_structure.hpp)
+   * \param[in] objective_function_tape - If true, record only the dependence of the objective
+   *            function on the inputs (no direct iteration, no output registration).
    */
-  void SetRecording(RECORDING kind_recording);
+  void SetRecording(RECORDING kind_recording, bool objective_function_tape = false);
+
+  /*!
+   * \brief Check whether the main tape can exclude the objective function section
+   *        (its gradient is then cached once per recording, see CacheObjFunctionGradient).
+   */
+  bool UseCompactMainTape(void) const;
+
+  /*!
+   * \brief Record the dependence of the objective function on the solution variables on a
+   *        dedicated tape, evaluate it once, and store the gradient in the External
+   *        containers of the adjoint solvers.
+   */
+  void CacheObjFunctionGradient(void);
 
   /*!
    * \brief Run one iteration of the solver.
@@ -122,6 +144,24 @@ public:
    */
   void SecondaryRecording(void);
 
+  /*!
+   * \brief Project the converged surface sensitivities onto the design variables
+   * and write the gradient file, replacing a separate SU2_DOT_AD call (see PROJECT_GRADIENT).
+   */
+  void ProjectSensitivityToDV(void);
+
+  /*!
+   * \brief Regenerate missing direct solution files by forward recomputation from the nearest checkpoint.
+   * \param[in] TimeIter - index of the current time-step.
+   */
+  void RecomputeDirectStates(unsigned long TimeIter);
+
+  /*!
+   * \brief Load the direct solution of one time step from file into the working solution arrays.
+   * \param[in] DirectIter - Direct iteration to load.
+   */
+  void LoadDirectState(int DirectIter);
+
   /*!
    * \brief gets Convergence on physical time scale, (deactivated in adjoint case)
    * \return false
@@ -36,12 +36,16 @@
 
 #include "../../../Common/include/geometry/CGeometry.hpp"
 
+#include <functional>
+
 using namespace std;
 
 class COutputLegacy;
 class CInterpolator;
 class CIteration;
 class COutput;
+class CParallelDataSorter;
+class CBlasStructure;
 
 /*!
  * \class CDriver
@@ -61,6 +65,8 @@ protected:
             UsedTimeOutput,                     /*!< \brief Elapsed time between Start and Stop point of the timer for tracking output phase.*/
             UsedTime;                           /*!< \brief Elapsed time between Start and Stop point of the timer.*/
   su2double BandwidthSum = 0.0;                 /*!< \brief Aggregate value of the bandwidth for writing restarts (to be average later).*/
+  passivedouble lbWindowStart = 0.0;            /*!< \brief Start of the current load balance monitoring window.*/
+  passivedouble lbWaitTime = 0.0;               /*!< \brief Accumulated synchronization wait time in the current window.*/
   unsigned long IterCount,                      /*!< \brief Iteration count stored for performance benchmarking.*/
   OutputCount;                                  /*!< \brief Output count stored for performance benchmarking.*/
   unsigned long DOFsPerPoint;                   /*!< \brief Number of unknowns at each vertex, i.e., number of equations solved. */
@@ -99,6 +105,16 @@ protected:
   CInterface ***interface_container;            /*!< \brief Definition of the interface of information and physics. */
   bool dry_run;                                 /*!< \brief Flag if SU2_CFD was started as dry-run via "SU2_CFD -d <config>.cfg" */
 
+  /*!
+   * \brief Signature of an in-situ analysis callback. It is invoked with the zone index, the
+   *        current time iteration and the volume data sorter of the zone, which gives zero-copy
+   *        access to the sorted solution data and connectivity of the linear partition.
+   */
+  using InSituCallbackType = std::function<void(unsigned short, unsigned long, const CParallelDataSorter*)>;
+
+  vector<pair<InSituCallbackType, unsigned long> >
+  inSituCallbacks;                              /*!< \brief Registered in-situ callbacks and their call frequencies. */
+
 public:
 
   /*!
@@ -333,6 +349,21 @@ protected:
    */
   void Print_DirectResidual(RECORDING kind_recording);
 
+  /*!
+   * \brief Monitor the parallel load balance, periodically reporting the work
+   *        imbalance across ranks and warning when it exceeds the threshold.
+   * \param[in] TimeIter - Current time iteration.
+   */
+  void MonitorLoadBalance(unsigned long TimeIter);
+
+  /*!
+   * \brief Run the registered in-situ callbacks that are due at the current iteration.
+   *        The solution data of every zone is loaded into the volume data sorters and
+   *        handed to the callbacks directly from solver memory, no files are written.
+   * \param[in] TimeIter - Current time iteration.
+   */
+  void RunInSituCallbacks(unsigned long TimeIter);
+
 public:
 
   /*!
@@ -350,6 +381,16 @@ public:
    */
   virtual void ResetConvergence();
 
+  /*!
+   * \brief Prepare the driver for a warm restart, i.e. run a new case on the same grid and
+   *        solver allocations by calling StartSolver() again, e.g. after changing boundary
+   *        conditions or free-stream values, without repeating the mesh read or any of the
+   *        preprocessing of the constructor.
+   * \param[in] reset_solution - If true, reset the solution to the free-stream state instead
+   *            of starting from the result of the previous solve.
+   */
+  void WarmRestart(bool reset_solution);
+
   /*!
    * \brief Perform some pre-processing before an iteration of the physics.
    */
@@ -360,6 +401,16 @@ public:
    */
   virtual bool Monitor(unsigned long TimeIter){ return false; }
 
+  /*!
+   * \brief Register an in-situ analysis callback (e.g. a Catalyst or Ascent adaptor), which is
+   *        invoked from the monitoring step with zero-copy access to the sorted solution data
+   *        of each zone, so external libraries can consume the solution between time steps
+   *        without going through the file-write path.
+   * \param[in] callback - The callback to invoke, see InSituCallbackType.
+   * \param[in] frequency - Invoke the callback every this many time iterations.
+   */
+  void RegisterInSituCallback(InSituCallbackType callback, unsigned long frequency = 1);
+
   /*!
    * \brief Output the solution in solution file.
    */
@@ -489,6 +540,13 @@ public:
    */
   vector<passivedouble> GetInitialMeshCoord(unsigned short iMarker, unsigned long iVertex) const;
 
+  /*!
+   * \brief Get the coordinates of all the vertices on a specified marker in one call.
+   * \param[in] iMarker - Marker identifier.
+   * \return Flat vector with nDim coordinates per vertex.
+   */
+  vector<passivedouble> GetMarkerCoordinates(unsigned short iMarker) const;
+
   /*!
    * \brief Get the temperature at a vertex on a specified marker.
    * \param[in] iMarker - Marker identifier.
@@ -505,6 +563,20 @@ public:
    */
   void SetVertexTemperature(unsigned short iMarker, unsigned long iVertex, passivedouble val_WallTemp);
 
+  /*!
+   * \brief Get the temperature at all the vertices on a specified marker in one call.
+   * \param[in] iMarker - Marker identifier.
+   * \return Flat vector with one temperature per vertex.
+   */
+  vector<passivedouble> GetMarkerTemperatures(unsigned short iMarker) const;
+
+  /*!
+   * \brief Set the temperature of all the vertices on a specified marker in one call.
+   * \param[in] iMarker - Marker identifier.
+   * \param[in] values - Flat vector with one temperature per vertex.
+   */
+  void SetMarkerTemperatures(unsigned short iMarker, const vector<passivedouble>& values);
+
   /*!
    * \brief Get the heat flux at a vertex on a specified marker (3 components).
    * \param[in] iMarker - Marker identifier.
@@ -610,6 +682,13 @@ public:
    */
   void SetMeshDisplacement(unsigned short iMarker, unsigned long iVertex, passivedouble DispX, passivedouble DispY, passivedouble DispZ);
 
+  /*!
+   * \brief Set the mesh displacement of all the vertices on a specified marker in one call.
+   * \param[in] iMarker - Marker identifier.
+   * \param[in] values - Flat vector with nDim displacement components per vertex.
+   */
+  void SetMarkerMeshDisplacements(unsigned short iMarker, const vector<passivedouble>& values);
+
   /*!
    * \brief Communicate the boundary mesh displacements in a python call
    */
@@ -634,6 +713,13 @@ public:
   void SetFEA_Loads(unsigned short iMarker, unsigned long iVertex, passivedouble LoadX,
                     passivedouble LoadY, passivedouble LoadZ);
 
+  /*!
+   * \brief Set the loads of all the vertices on a specified marker for the structural solver in one call.
+   * \param[in] iMarker - Marker identifier.
+   * \param[in] values - Flat vector with nDim load components per vertex.
+   */
+  void SetMarkerFEALoads(unsigned short iMarker, const vector<passivedouble>& values);
+
   /*!
    * \brief Return the displacements from the FEA solver.
    * \param[in] iMarker - Marker identifier.
@@ -642,6 +728,13 @@ public:
    */
   vector<passivedouble> GetFEA_Displacements(unsigned short iMarker, unsigned long iVertex) const;
 
+  /*!
+   * \brief Return the displacements of all the vertices on a specified marker from the FEA solver in one call.
+   * \param[in] iMarker - Marker identifier.
+   * \return Flat vector with nDim displacement components per vertex.
+   */
+  vector<passivedouble> GetMarkerFEADisplacements(unsigned short iMarker) const;
+
   /*!
    * \brief Return the velocities from the FEA Solver.
    * \param[in] iMarker - Marker identifier.
@@ -676,6 +769,13 @@ public:
    */
   vector<passivedouble> GetFlowLoad(unsigned short iMarker, unsigned long iVertex) const;
 
+  /*!
+   * \brief Get the flow loads of all the vertices on a specified marker in one call.
+   * \param[in] iMarker - Marker identifier.
+   * \return Flat vector with nDim load components per vertex.
+   */
+  vector<passivedouble> GetMarkerFlowLoads(unsigned short iMarker) const;
+
   /*!
    * \brief Set the adjoint of the flow tractions (from the extra step -
    * the repeated methods should be unified once the postprocessing strategy is in place).
@@ -919,6 +1019,10 @@ private:
   COutputLegacy* output_legacy;
   unsigned short nInstHB;
   su2double **D; /*!< \brief Harmonic Balance operator. */
+  vector<su2double> Dflat;       /*!< \brief Row-major copy of the operator for the batched (GEMM) application. */
+  vector<su2double> DflatAdj;    /*!< \brief Transposed copy, the adjoint sources multiply by D^T. */
+  bool hbOperatorReady = false;  /*!< \brief The operator only depends on the period, it is computed once. */
+  CBlasStructure* blasFunctions; /*!< \brief Pointer to the object to carry out the BLAS functionalities. */
 
 public:
 
@@ -944,11 +1048,12 @@ public:
   void Run() override;
 
   /*!
-   * \brief Computation and storage of the Harmonic Balance method source terms.
+   * \brief Computation and storage of the Harmonic Balance method source terms,
+   *        for all time instances at once. The instance coupling is applied as
+   *        a batched small GEMM on contiguous per-point instance blocks.
    * \author T. Economon, K. Naik
-   * \param[in] iZone - Current zone number.
    */
-  void SetHarmonicBalance(unsigned short iZone);
+  void SetHarmonicBalance();
 
   /*!
    * \brief Precondition Harmonic Balance source term for stability
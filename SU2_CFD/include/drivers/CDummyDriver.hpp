@@ -56,4 +56,12 @@ public:
    */
   void StartSolver() override;
 
+private:
+
+  /*!
+   * \brief Estimate the per-rank memory footprint and a reasonable rank count for each zone
+   *        from the mesh dimensions and the config, without allocating the full data structures.
+   */
+  void EstimateResources() const;
+
 };
@@ -56,6 +56,27 @@ protected:
 
   bool *prefixed_motion;     /*!< \brief Determines if a fixed motion is imposed in the config file. */
 
+  vector<unsigned short> zoneOrder;  /*!< \brief Zone sweep order, topological w.r.t. the coupling graph where possible. */
+
+  vector<bool> zoneConverged;        /*!< \brief Whether the last inner iteration of each zone converged. */
+
+  vector<int> zoneTeamSize;          /*!< \brief Thread team size used to solve each zone (see setZoneTeamSize). */
+
+  /*!
+   * \brief Determine the zone sweep order from the interface definitions, such that in
+   * Gauss-Seidel iterations donor zones are solved before their targets when possible.
+   */
+  void SetZoneSolveOrder();
+
+  /*!
+   * \brief Check whether the solve of a zone can be skipped in the current outer iteration,
+   * i.e. its last inner iteration converged and its coupling inputs did not change.
+   * \param[in] val_iZone - Target zone.
+   * \param[in] OuterIter - Current outer iteration.
+   * \return <code>TRUE</code> if the zone does not need to be solved again.
+   */
+  bool SkipZoneSolve(unsigned short val_iZone, unsigned long OuterIter) const;
+
 public:
 
   /*!
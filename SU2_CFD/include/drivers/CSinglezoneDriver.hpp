@@ -62,6 +62,12 @@ public:
    */
   void StartSolver() override;
 
+  /*!
+   * \brief Grid sequencing startup, runs the initial transient on the coarse multigrid
+   *        levels and prolongates the solution to initialize the fine grid.
+   */
+  void GridSequencing();
+
   /*!
    * \brief Preprocess the single-zone iteration
    */
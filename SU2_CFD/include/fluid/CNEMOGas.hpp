@@ -154,6 +154,22 @@ public:
    */
   virtual vector<su2double>& ComputeSpeciesEve(su2double val_T, bool vibe_only = false) = 0;
 
+  /*!
+   * \brief Compute species V-E energies for a batch of temperatures.
+   * \param[in] nPts - Number of states in the batch.
+   * \param[in] val_T - Vibro-electronic temperatures (size nPts).
+   * \param[out] val_eves - Species V-E energies (size nPts*nSpecies, point-major).
+   */
+  virtual void ComputeSpeciesEveBatch(unsigned long nPts, const su2double* val_T, su2double* val_eves);
+
+  /*!
+   * \brief Compute species V-E specific heats for a batch of temperatures.
+   * \param[in] nPts - Number of states in the batch.
+   * \param[in] val_T - Vibro-electronic temperatures (size nPts).
+   * \param[out] val_cvves - Species V-E specific heats (size nPts*nSpecies, point-major).
+   */
+  virtual void ComputeSpeciesCvVibEleBatch(unsigned long nPts, const su2double* val_T, su2double* val_cvves);
+
   /*!
    * \brief Compute species enthalpies.
    */
@@ -179,6 +195,17 @@ public:
    */
   virtual vector<su2double>& ComputeTemperatures(vector<su2double>& val_rhos, su2double rhoEmix, su2double rhoEve, su2double rhoEvel) = 0;
 
+  /*!
+   * \brief Compute translational and vibrational temperatures vector, warm
+   * starting any iterative solve from a previous vibrational temperature.
+   * Models without a warm start fall back to the full solve.
+   * \param[in] Tve_init - Previous vibrational temperature (<= 0 to disable).
+   */
+  virtual vector<su2double>& ComputeTemperatures(vector<su2double>& val_rhos, su2double rhoEmix,
+                                                 su2double rhoEve, su2double rhoEvel, su2double Tve_init) {
+    return ComputeTemperatures(val_rhos, rhoEmix, rhoEve, rhoEvel);
+  }
+
   /*!
    * \brief Compute speed of sound.
    */
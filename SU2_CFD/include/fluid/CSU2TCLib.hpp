@@ -87,7 +87,9 @@ private:
   vector<su2double>
   dkf, dkb,
   dRfok, dRbok,
-  eve, eve_eq, cvve, cvve_eq;
+  eve, eve_eq, cvve, cvve_eq,
+  RuOverM;                        /*!< \brief Species specific gas constants Ru/MolarMass, precomputed
+                                              to keep divisions out of the property evaluation kernels. */
 
   vector<int>
   alphak, betak;
@@ -163,6 +165,16 @@ public:
                                 const su2double *dTdU, const su2double* dTvedU,
                                 su2double **val_jacobian) final;
 
+  /*!
+   * \brief Compute species V-E energies for a batch of temperatures (tiled, vectorization friendly).
+   */
+  void ComputeSpeciesEveBatch(unsigned long nPts, const su2double* val_T, su2double* val_eves) final;
+
+  /*!
+   * \brief Compute species V-E specific heats for a batch of temperatures (tiled, vectorization friendly).
+   */
+  void ComputeSpeciesCvVibEleBatch(unsigned long nPts, const su2double* val_T, su2double* val_cvves) final;
+
   /*!
    * \brief Compute species enthalpies.
    */
@@ -188,6 +200,13 @@ public:
    */
   vector<su2double>& ComputeTemperatures(vector<su2double>& val_rhos, su2double rhoEmix, su2double rhoEve, su2double rhoEvel) final;
 
+  /*!
+   * \brief Compute translational and vibrational temperatures vector, the
+   * bisection for Tve is bracketed around the previous value when possible.
+   */
+  vector<su2double>& ComputeTemperatures(vector<su2double>& val_rhos, su2double rhoEmix, su2double rhoEve,
+                                         su2double rhoEvel, su2double Tve_init) final;
+
   private:
 
   /*!
@@ -28,6 +28,27 @@
  */
 
 #include "../../../Common/include/parallelization/omp_structure.hpp"
+#include "../../../Common/include/toolboxes/CPhaseProfiler.hpp"
+
+#include "../../../Common/include/option_structure.hpp"
+#include "../../../Common/include/containers/container_decorators.hpp"
+
+#include <vector>
+
+class CSolver;
+
+/*!
+ * \brief One field of a fused multi-solver Green-Gauss sweep, see computeGradientsGreenGaussFused.
+ */
+struct CGreenGaussField {
+  CSolver* solver;                       /*!< \brief Solver that owns the field, used for the communications. */
+  const su2activematrix* field;          /*!< \brief Field values, (iPoint, iVar). */
+  CVectorOfMatrix* gradient;             /*!< \brief Gradient storage, (iPoint, iVar, iDim). */
+  size_t varBegin;                       /*!< \brief Index of the first variable. */
+  size_t varEnd;                         /*!< \brief Index one past the last variable. */
+  MPI_QUANTITIES kindMpiComm;            /*!< \brief Type of MPI communication required. */
+  PERIODIC_QUANTITIES kindPeriodicComm;  /*!< \brief Type of periodic communication required. */
+};
 
 namespace detail {
 
@@ -77,7 +98,7 @@ void computeGradientsGreenGauss(CSolver* solver,
     auto nodes = geometry.nodes;
 
     /*--- Cannot preaccumulate if hybrid parallel due to shared reading. ---*/
-    if (omp_get_num_threads() == 1) AD::StartPreacc();
+    if (AD::Active && (omp_get_num_threads() == 1)) AD::StartPreacc();
     AD::SetPreaccIn(nodes->GetVolume(iPoint));
     AD::SetPreaccIn(nodes->GetPeriodicVolume(iPoint));
 
@@ -200,6 +221,7 @@ void computeGradientsGreenGauss(CSolver* solver,
                                 size_t varBegin,
                                 size_t varEnd,
                                 GradientType& gradient) {
+  SU2_PROFILE_PHASE(GRADIENTS);
   switch (geometry.GetnDim()) {
   case 2:
     detail::computeGradientsGreenGauss<2>(solver, kindMpiComm, kindPeriodicComm, geometry,
@@ -214,3 +236,173 @@ void computeGradientsGreenGauss(CSolver* solver,
     break;
   }
 }
+
+namespace detail {
+
+/*!
+ * \brief Compute the Green-Gauss gradients of the fields of several solvers in one
+ *        fused sweep over the grid. The loop structure matches ::computeGradientsGreenGauss,
+ *        but the edge geometry (neighbor lists, area vectors, volumes) is read once for all
+ *        fields instead of once per solver, which is what makes the fusion pay off for
+ *        bandwidth-bound cases with many transported scalars.
+ */
+template<size_t nDim, class FieldListType>
+void computeGradientsGreenGaussFused(CGeometry& geometry,
+                                     const CConfig& config,
+                                     const FieldListType& fields)
+{
+  const size_t nPointDomain = geometry.GetnPointDomain();
+
+#ifdef HAVE_OMP
+  constexpr size_t OMP_MAX_CHUNK = 512;
+
+  const auto chunkSize = computeStaticChunkSize(nPointDomain, omp_get_max_threads(), OMP_MAX_CHUNK);
+#endif
+
+  /*--- For each (non-halo) volume integrate over its faces (edges). ---*/
+
+  SU2_OMP_FOR_DYN(chunkSize)
+  for (size_t iPoint = 0; iPoint < nPointDomain; ++iPoint)
+  {
+    auto nodes = geometry.nodes;
+
+    /*--- Cannot preaccumulate if hybrid parallel due to shared reading. ---*/
+    if (AD::Active && (omp_get_num_threads() == 1)) AD::StartPreacc();
+    AD::SetPreaccIn(nodes->GetVolume(iPoint));
+    AD::SetPreaccIn(nodes->GetPeriodicVolume(iPoint));
+
+    for (const auto& f : fields)
+      for (size_t iVar = f.varBegin; iVar < f.varEnd; ++iVar)
+        AD::SetPreaccIn((*f.field)(iPoint,iVar));
+
+    /*--- Clear the gradients. --*/
+
+    for (const auto& f : fields)
+      for (size_t iVar = f.varBegin; iVar < f.varEnd; ++iVar)
+        for (size_t iDim = 0; iDim < nDim; ++iDim)
+          (*f.gradient)(iPoint, iVar, iDim) = 0.0;
+
+    /*--- Handle averaging and division by volume in one constant. ---*/
+
+    su2double halfOnVol = 0.5 / (nodes->GetVolume(iPoint)+nodes->GetPeriodicVolume(iPoint));
+
+    /*--- Add a contribution due to each neighbor, for all fields. ---*/
+
+    for (size_t iNeigh = 0; iNeigh < nodes->GetnPoint(iPoint); ++iNeigh)
+    {
+      size_t iEdge = nodes->GetEdge(iPoint,iNeigh);
+      size_t jPoint = nodes->GetPoint(iPoint,iNeigh);
+
+      /*--- Determine if edge points inwards or outwards of iPoint.
+       *    If inwards we need to flip the area vector. ---*/
+
+      su2double dir = (iPoint < jPoint)? 1.0 : -1.0;
+      su2double weight = dir * halfOnVol;
+
+      const auto area = geometry.edges->GetNormal(iEdge);
+      AD::SetPreaccIn(area, nDim);
+
+      for (const auto& f : fields)
+        for (size_t iVar = f.varBegin; iVar < f.varEnd; ++iVar)
+        {
+          AD::SetPreaccIn((*f.field)(jPoint,iVar));
+
+          su2double flux = weight * ((*f.field)(iPoint,iVar) + (*f.field)(jPoint,iVar));
+
+          for (size_t iDim = 0; iDim < nDim; ++iDim)
+            (*f.gradient)(iPoint, iVar, iDim) += flux * area[iDim];
+        }
+
+    }
+
+    for (const auto& f : fields)
+      for (size_t iVar = f.varBegin; iVar < f.varEnd; ++iVar)
+        for (size_t iDim = 0; iDim < nDim; ++iDim)
+          AD::SetPreaccOut((*f.gradient)(iPoint,iVar,iDim));
+
+    AD::EndPreacc();
+  }
+  END_SU2_OMP_FOR
+
+  /*--- Add boundary fluxes. ---*/
+
+  for (size_t iMarker = 0; iMarker < geometry.GetnMarker(); ++iMarker)
+  {
+    if ((config.GetMarker_All_KindBC(iMarker) != INTERNAL_BOUNDARY) &&
+        (config.GetMarker_All_KindBC(iMarker) != NEARFIELD_BOUNDARY) &&
+        (config.GetMarker_All_KindBC(iMarker) != PERIODIC_BOUNDARY))
+    {
+      /*--- Work is shared in inner loop as two markers
+       *    may try to update the same point. ---*/
+
+      SU2_OMP_FOR_STAT(32)
+      for (size_t iVertex = 0; iVertex < geometry.GetnVertex(iMarker); ++iVertex)
+      {
+        size_t iPoint = geometry.vertex[iMarker][iVertex]->GetNode();
+        auto nodes = geometry.nodes;
+
+        /*--- Halo points do not need to be considered. ---*/
+
+        if (!nodes->GetDomain(iPoint)) continue;
+
+        su2double volume = nodes->GetVolume(iPoint) + nodes->GetPeriodicVolume(iPoint);
+
+        const auto area = geometry.vertex[iMarker][iVertex]->GetNormal();
+
+        for (const auto& f : fields)
+          for (size_t iVar = f.varBegin; iVar < f.varEnd; iVar++)
+          {
+            su2double flux = (*f.field)(iPoint,iVar) / volume;
+
+            for (size_t iDim = 0; iDim < nDim; iDim++)
+              (*f.gradient)(iPoint, iVar, iDim) -= flux * area[iDim];
+          }
+      }
+      END_SU2_OMP_FOR
+    }
+  }
+
+  /*--- Account for periodic contributions. ---*/
+
+  for (size_t iPeriodic = 1; iPeriodic <= config.GetnMarker_Periodic()/2; ++iPeriodic)
+  {
+    for (const auto& f : fields)
+    {
+      f.solver->InitiatePeriodicComms(&geometry, &config, iPeriodic, f.kindPeriodicComm);
+      f.solver->CompletePeriodicComms(&geometry, &config, iPeriodic, f.kindPeriodicComm);
+    }
+  }
+
+  /*--- Obtain the gradients at halo points from the MPI ranks that own them. The
+   *    messages of all solvers are put on the wire before any of them is waited
+   *    on, i.e. the fields share one round of halo exchanges. ---*/
+
+  for (const auto& f : fields)
+    f.solver->InitiateComms(&geometry, &config, f.kindMpiComm);
+
+  for (const auto& f : fields)
+    f.solver->CompleteComms(&geometry, &config, f.kindMpiComm);
+
+}
+} // end namespace
+
+/*!
+ * \brief Instantiations for 2D and 3D.
+ */
+template<class FieldListType>
+void computeGradientsGreenGaussFused(CGeometry& geometry,
+                                     const CConfig& config,
+                                     const FieldListType& fields) {
+  SU2_PROFILE_PHASE(GRADIENTS);
+  switch (geometry.GetnDim()) {
+  case 2:
+    detail::computeGradientsGreenGaussFused<2>(geometry, config, fields);
+    break;
+  case 3:
+    detail::computeGradientsGreenGaussFused<3>(geometry, config, fields);
+    break;
+  default:
+    SU2_MPI::Error("Too many dimensions to compute gradients.", CURRENT_FUNCTION);
+    break;
+  }
+}
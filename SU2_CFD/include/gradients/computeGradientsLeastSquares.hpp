@@ -28,6 +28,7 @@
 
 #include "../../../Common/include/parallelization/omp_structure.hpp"
 #include "../../../Common/include/toolboxes/geometry_toolbox.hpp"
+#include "../../../Common/include/toolboxes/CPhaseProfiler.hpp"
 
 namespace detail {
 
@@ -61,16 +62,15 @@ FORCEINLINE void computeSmatrix(su2double r11, su2double r12, su2double r13,
 }
 
 /*!
- * \brief Solve the least-squares problem for one point.
+ * \brief Compute the inverted coefficient matrix (S := inv(R)*transpose(inv(R)))
+ *        of the least-squares problem for one point.
  * \note See detail::computeGradientsLeastSquares for the
  *       purpose of template "nDim" and "periodic".
  */
-template<size_t nDim, bool periodic, class GradientType, class RMatrixType>
-FORCEINLINE void solveLeastSquares(size_t iPoint,
-                                   size_t varBegin,
-                                   size_t varEnd,
-                                   const RMatrixType& Rmatrix,
-                                   GradientType& gradient)
+template<size_t nDim, bool periodic, class RMatrixType>
+FORCEINLINE void computeSmatrixAtPoint(size_t iPoint,
+                                       const RMatrixType& Rmatrix,
+                                       su2double Smatrix[nDim][nDim])
 {
   const auto eps = pow(std::numeric_limits<passivedouble>::epsilon(),2);
 
@@ -116,8 +116,6 @@ FORCEINLINE void solveLeastSquares(size_t iPoint,
 
   /*--- S matrix := inv(R)*traspose(inv(R)) ---*/
 
-  su2double Smatrix[nDim][nDim] = {{0.0}};
-
   /*--- Detect singular matrix ---*/
 
   if (detR2 > eps) {
@@ -131,9 +129,18 @@ FORCEINLINE void solveLeastSquares(size_t iPoint,
         AD::SetPreaccOut(Smatrix[iDim][jDim]);
     AD::EndPreacc();
   }
+}
 
-  /*--- Computation of the gradient: S*c ---*/
-
+/*!
+ * \brief Computation of the gradient: S*c.
+ */
+template<size_t nDim, class GradientType>
+FORCEINLINE void applySmatrix(size_t iPoint,
+                              size_t varBegin,
+                              size_t varEnd,
+                              const su2double Smatrix[nDim][nDim],
+                              GradientType& gradient)
+{
   for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
   {
     su2double Cvector[nDim] = {0.0};
@@ -145,6 +152,32 @@ FORCEINLINE void solveLeastSquares(size_t iPoint,
     for (size_t iDim = 0; iDim < nDim; ++iDim)
       gradient(iPoint, iVar, iDim) = Cvector[iDim];
   }
+}
+
+/*!
+ * \brief Solve the least-squares problem for one point.
+ * \param[out] cacheRow - Optional, store the upper triangle of the
+ *             inverted coefficient matrix for reuse in later iterations.
+ */
+template<size_t nDim, bool periodic, class GradientType, class RMatrixType>
+FORCEINLINE void solveLeastSquares(size_t iPoint,
+                                   size_t varBegin,
+                                   size_t varEnd,
+                                   const RMatrixType& Rmatrix,
+                                   GradientType& gradient,
+                                   su2double* cacheRow = nullptr)
+{
+  su2double Smatrix[nDim][nDim] = {{0.0}};
+  computeSmatrixAtPoint<nDim, periodic>(iPoint, Rmatrix, Smatrix);
+
+  if (cacheRow != nullptr) {
+    size_t iSym = 0;
+    for (size_t iDim = 0; iDim < nDim; ++iDim)
+      for (size_t jDim = iDim; jDim < nDim; ++jDim)
+        cacheRow[iSym++] = Smatrix[iDim][jDim];
+  }
+
+  applySmatrix<nDim>(iPoint, varBegin, varEnd, Smatrix, gradient);
 
   if (!periodic) {
     /*--- Stop preacc here instead as gradient is only out. ---*/
@@ -188,23 +221,57 @@ void computeGradientsLeastSquares(CSolver* solver,
 
   const size_t nPointDomain = geometry.GetnPointDomain();
 
+  /*--- For reconstruction (MUSCL) gradients the halo values can be computed
+   locally from the one-sided stencil of the rank (the solution at the halo
+   layer was already exchanged), which trades a little extra compute for the
+   elimination of the gradient halo exchange. Periodic grids still need the
+   exchange as their Rmatrix receives corrections via the periodic comms. ---*/
+
+  const bool reconstruction = (kindMpiComm == SOLUTION_GRAD_REC) || (kindMpiComm == PRIMITIVE_GRAD_REC);
+  const bool localHaloGrad = reconstruction && !periodic && (solver != nullptr) &&
+                             config.GetRecon_Gradient_Local_Halo();
+  const size_t nPointLoop = localHaloGrad ? geometry.GetnPoint() : nPointDomain;
+
+  /*--- On static meshes the inverted coefficient matrix of each point only
+   *    depends on the grid, it is computed on the first call and cached, so
+   *    that later calls are a pure right-hand-side + multiply pass. The cache
+   *    is not used with periodic boundaries (Rmatrix receives corrections
+   *    every iteration) or for the discrete adjoint (tape correctness). ---*/
+
+  const bool useCache = !periodic && !config.GetDynamic_Grid() && !config.GetDeform_Mesh() &&
+                        !config.GetDiscrete_Adjoint();
+  auto& coeffCache = geometry.GetLSQCoeffCache(weighted);
+  const bool cacheValid = useCache && geometry.GetLSQCoeffCacheValid(weighted);
+  const bool fillCache = useCache && !cacheValid;
+
+  if (fillCache) {
+    SU2_OMP_MASTER {
+      if (coeffCache.rows() != nPointDomain) coeffCache.resize(nPointDomain, nDim*(nDim+1)/2);
+    } END_SU2_OMP_MASTER
+    SU2_OMP_BARRIER
+  }
+
 #ifdef HAVE_OMP
   constexpr size_t OMP_MAX_CHUNK = 512;
 
-  size_t chunkSize = computeStaticChunkSize(nPointDomain,
+  size_t chunkSize = computeStaticChunkSize(nPointLoop,
                      omp_get_max_threads(), OMP_MAX_CHUNK);
 #endif
 
-  /*--- First loop over non-halo points of the grid. ---*/
+  /*--- First loop over non-halo points of the grid (and over the halo
+   points as well when their gradients are reconstructed locally). ---*/
 
   SU2_OMP_FOR_DYN(chunkSize)
-  for (size_t iPoint = 0; iPoint < nPointDomain; ++iPoint)
+  for (size_t iPoint = 0; iPoint < nPointLoop; ++iPoint)
   {
+    /*--- The coefficient cache only covers the owned points. ---*/
+    const bool cachedRow = cacheValid && (iPoint < nPointDomain);
+
     auto nodes = geometry.nodes;
     const auto coord_i = nodes->GetCoord(iPoint);
 
     /*--- Cannot preaccumulate if hybrid parallel due to shared reading. ---*/
-    if (omp_get_num_threads() == 1) AD::StartPreacc();
+    if (AD::Active && (omp_get_num_threads() == 1)) AD::StartPreacc();
     AD::SetPreaccIn(coord_i, nDim);
 
     for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
@@ -216,9 +283,10 @@ void computeGradientsLeastSquares(CSolver* solver,
       for (size_t iDim = 0; iDim < nDim; ++iDim)
         gradient(iPoint, iVar, iDim) = 0.0;
 
-    for (size_t iDim = 0; iDim < nDim; ++iDim)
-      for (size_t jDim = 0; jDim < nDim; ++jDim)
-        Rmatrix(iPoint, iDim, jDim) = 0.0;
+    if (!cachedRow)
+      for (size_t iDim = 0; iDim < nDim; ++iDim)
+        for (size_t jDim = 0; jDim < nDim; ++jDim)
+          Rmatrix(iPoint, iDim, jDim) = 0.0;
 
 
     for (auto jPoint : nodes->GetPoints(iPoint))
@@ -244,12 +312,14 @@ void computeGradientsLeastSquares(CSolver* solver,
       {
         weight = 1.0 / weight;
 
-        for (size_t iDim = 0; iDim < nDim; ++iDim)
-          for (size_t jDim = iDim; jDim < nDim; ++jDim)
-            Rmatrix(iPoint,iDim,jDim) += dist_ij[iDim]*dist_ij[jDim]*weight;
+        if (!cachedRow) {
+          for (size_t iDim = 0; iDim < nDim; ++iDim)
+            for (size_t jDim = iDim; jDim < nDim; ++jDim)
+              Rmatrix(iPoint,iDim,jDim) += dist_ij[iDim]*dist_ij[jDim]*weight;
 
-        if (nDim == 3)
-          Rmatrix(iPoint,2,1) += dist_ij[0]*dist_ij[nDim-1]*weight;
+          if (nDim == 3)
+            Rmatrix(iPoint,2,1) += dist_ij[0]*dist_ij[nDim-1]*weight;
+        }
 
         /*--- Entries of c:= transpose(A)*b ---*/
 
@@ -279,14 +349,41 @@ void computeGradientsLeastSquares(CSolver* solver,
 
       AD::EndPreacc();
     }
+    else if (cachedRow) {
+      /*--- Apply the cached inverted coefficient matrix. ---*/
+
+      su2double Smatrix[nDim][nDim] = {{0.0}};
+      const su2double* coeffs = coeffCache[iPoint];
+      size_t iSym = 0;
+      for (size_t iDim = 0; iDim < nDim; ++iDim)
+        for (size_t jDim = iDim; jDim < nDim; ++jDim)
+          Smatrix[iDim][jDim] = coeffs[iSym++];
+
+      applySmatrix<nDim>(iPoint, varBegin, varEnd, Smatrix, gradient);
+
+      for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
+        for (size_t iDim = 0; iDim < nDim; ++iDim)
+          AD::SetPreaccOut(gradient(iPoint, iVar, iDim));
+      AD::EndPreacc();
+    }
     else {
       /*--- Periodic comms are not needed, solve the LS problem for iPoint. ---*/
 
-      solveLeastSquares<nDim, false>(iPoint, varBegin, varEnd, Rmatrix, gradient);
+      solveLeastSquares<nDim, false>(iPoint, varBegin, varEnd, Rmatrix, gradient,
+                                     (fillCache && (iPoint < nPointDomain))? coeffCache[iPoint] : nullptr);
     }
   }
   END_SU2_OMP_FOR
 
+  /*--- The cache was filled for all points, later calls can use it. ---*/
+
+  if (fillCache) {
+    SU2_OMP_MASTER {
+      geometry.SetLSQCoeffCacheValid(weighted);
+    } END_SU2_OMP_MASTER
+    SU2_OMP_BARRIER
+  }
+
   /*--- Correct the gradient values across any periodic boundaries. ---*/
 
   if (periodic)
@@ -305,9 +402,10 @@ void computeGradientsLeastSquares(CSolver* solver,
     END_SU2_OMP_FOR
   }
 
-  /*--- If no solver was provided we do not communicate ---*/
+  /*--- If no solver was provided, or the halo gradients were already
+   reconstructed locally above, we do not communicate. ---*/
 
-  if (solver != nullptr)
+  if ((solver != nullptr) && !localHaloGrad)
   {
     /*--- Obtain the gradients at halo points from the MPI ranks that own them. ---*/
 
@@ -333,6 +431,7 @@ void computeGradientsLeastSquares(CSolver* solver,
                                   size_t varEnd,
                                   GradientType& gradient,
                                   RMatrixType& Rmatrix) {
+  SU2_PROFILE_PHASE(GRADIENTS);
   switch (geometry.GetnDim()) {
   case 2:
     detail::computeGradientsLeastSquares<2>(solver, kindMpiComm, kindPeriodicComm, geometry, config,
@@ -52,6 +52,19 @@ public:
                            CNumerics ******numerics_container, CConfig **config,
                            unsigned short RunTime_EqSystem, unsigned short iZone, unsigned short iInst) override;
 
+  /*!
+   * \brief Compute the fine solution from a coarse solution.
+   * \note Public because it is also used by the grid sequencing startup of the drivers.
+   * \param[in] RunTime_EqSystem - System of equations which is going to be solved.
+   * \param[out] sol_fine - Pointer to the solution on the fine grid.
+   * \param[in] sol_coarse - Pointer to the solution on the coarse grid.
+   * \param[in] geo_fine - Geometrical definition of the fine grid.
+   * \param[in] geo_coarse - Geometrical definition of the coarse grid.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void SetProlongated_Solution(unsigned short RunTime_EqSystem, CSolver *sol_fine, CSolver *sol_coarse,
+                               CGeometry *geo_fine, CGeometry *geo_coarse, CConfig *config);
+
 private:
   /*!
    * \brief Perform a Full-Approximation Storage (FAS) Multigrid.
@@ -120,18 +133,6 @@ private:
                                  CConfig *config, unsigned short FinestMesh, unsigned short RunTime_EqSystem,
                                  su2double *monitor);
 
-  /*!
-   * \brief Compute the fine solution from a coarse solution.
-   * \param[in] RunTime_EqSystem - System of equations which is going to be solved.
-   * \param[out] sol_fine - Pointer to the solution on the fine grid.
-   * \param[in] sol_coarse - Pointer to the solution on the coarse grid.
-   * \param[in] geo_fine - Geometrical definition of the fine grid.
-   * \param[in] geo_coarse - Geometrical definition of the coarse grid.
-   * \param[in] config - Definition of the particular problem.
-   */
-  void SetProlongated_Solution(unsigned short RunTime_EqSystem, CSolver *sol_fine, CSolver *sol_coarse,
-                               CGeometry *geo_fine, CGeometry *geo_coarse, CConfig *config);
-
   /*!
    * \brief Compute the fine grid correction from the coarse solution.
    * \param[out] sol_fine - Pointer to the solution on the fine grid.
@@ -163,11 +164,13 @@ private:
    * \param[in] geo_fine - Geometrical definition of the fine grid.
    * \param[in] geo_coarse - Geometrical definition of the coarse grid.
    * \param[in] config - Definition of the particular problem.
-   * \param[in] iMesh - Index of the mesh in multigrid computations.
-   * \param[in] InclSharedDomain - Include the shared domain in the interpolation.
+   * \param[in] completeComms - If false, the halo exchange of the restricted solution is only
+   *            initiated, the caller completes it (CSolver::CompleteComms with SOLUTION) after
+   *            overlapping the exchange with independent work.
    */
   void SetRestricted_Solution(unsigned short RunTime_EqSystem, CSolver *sol_fine, CSolver *sol_coarse,
-                              CGeometry *geo_fine, CGeometry *geo_coarse, CConfig *config);
+                              CGeometry *geo_fine, CGeometry *geo_coarse, CConfig *config,
+                              bool completeComms = true);
 
   /*!
    * \brief Initialize the adjoint solution using the primal problem.
@@ -36,6 +36,7 @@
 #include <sstream>
 #include <algorithm>
 #include <iostream>
+#include <vector>
 #include <stdlib.h>
 #include <stdio.h>
 
@@ -72,6 +73,38 @@ protected:
   unsigned short nVar = 0;
   static constexpr size_t MAXNDIM = 3;  /*!< \brief Max number of space dimensions, used in some static arrays. */
 
+  /*--- Derived interfaces that tolerate consuming donor data that is one transfer old (currently
+   * only CHT) set this flag to enable the asynchronous exchange mode of BroadcastData. ---*/
+  bool allowAsyncTransfer = false;      /*!< \brief The interface supports asynchronous (lagged) transfers. */
+
+  /*--- Relative change of the broadcast donor data, used to detect stagnant coupling inputs. ---*/
+  passivedouble relativeChange = 1e30;                    /*!< \brief Relative change in the last BroadcastData call. */
+  vector<vector<passivedouble> > prevDonorVar;            /*!< \brief Donor data of the previous call, per interface marker. */
+
+  /*--- Communication pattern and persistent buffers of BroadcastData. The donor vertex counts,
+   * global indices, and sort order do not change between calls, so they are gathered once and
+   * the donor variables of all interface markers share a single packed exchange afterwards. ---*/
+  struct {
+    bool built = false;                  /*!< \brief The pattern was gathered on a previous call. */
+    vector<int> sendCounts;              /*!< \brief Packed variable count of each rank, all markers. */
+    vector<int> sendDispl;               /*!< \brief Displacements of the packed variable exchange. */
+    vector<su2double> sendBuf;           /*!< \brief Packed donor variables of this rank. */
+    vector<su2double> recvBuf;           /*!< \brief Packed donor variables of all ranks. */
+    struct Marker {
+      bool active = false;               /*!< \brief The marker connects the two zones. */
+      vector<int> nAllVertexDonor;       /*!< \brief Donor vertex count of each rank. */
+      vector<unsigned long> donorIdx;    /*!< \brief Donor global indices, sorted. */
+      vector<unsigned long> gatherOffset;/*!< \brief Buffer position of each donor vertex, in gathered (rank) order. */
+      vector<unsigned long> sortedOffset;/*!< \brief Buffer position of each donor vertex, in sorted index order. */
+      unsigned long nGlobalVertexDonor = 0;
+    };
+    vector<Marker> markers;              /*!< \brief Pattern of each interface marker. */
+
+    /*--- State of the asynchronous exchange mode, see BroadcastData. ---*/
+    bool asyncPending = false;           /*!< \brief A nonblocking gather into recvBuf is in flight. */
+    SU2_MPI::Request asyncReq;           /*!< \brief Request of the in-flight gather. */
+  } bcastComm;
+
 public:
   /*!
    * \brief Constructor of the class.
@@ -105,6 +138,12 @@ public:
                      CGeometry *donor_geometry, CGeometry *target_geometry,
                      const CConfig *donor_config, const CConfig *target_config);
 
+  /*!
+   * \brief Get the relative change of the donor data in the last call to BroadcastData.
+   * \return Relative (L2) change of the broadcast data, large on the first call.
+   */
+  passivedouble GetRelativeChange(void) const { return relativeChange; }
+
 protected:
   /*!
    * \brief A virtual member.
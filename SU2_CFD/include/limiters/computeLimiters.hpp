@@ -27,6 +27,7 @@
 
 #include "CLimiterDetails.hpp"
 #include "computeLimiters_impl.hpp"
+#include "../../../Common/include/toolboxes/CPhaseProfiler.hpp"
 
 /*!
  * \brief A wrapper funtion that calls specialized implementations depending
@@ -34,7 +35,7 @@
  *        versions of "computeLimiters_impl" with appropriate specializations
  *        of "CLimiterDetails". See corresponding hpp files for further details.
  */
-template<class FieldType, class GradientType>
+template<class FieldType, class GradientType, class MinMaxType>
 void computeLimiters(LIMITER LimiterKind,
                      CSolver* solver,
                      MPI_QUANTITIES kindMpiComm,
@@ -46,10 +47,12 @@ void computeLimiters(LIMITER LimiterKind,
                      size_t varEnd,
                      const FieldType& field,
                      const GradientType& gradient,
-                     FieldType& fieldMin,
-                     FieldType& fieldMax,
+                     MinMaxType& fieldMin,
+                     MinMaxType& fieldMax,
                      FieldType& limiter)
 {
+  SU2_PROFILE_PHASE(LIMITERS);
+
   if (geometry.GetnDim() != 2 && geometry.GetnDim() != 3)
     SU2_MPI::Error("Too many dimensions to compute limiters.", CURRENT_FUNCTION);
 
@@ -59,8 +59,9 @@
  * \param LimiterKind - Used to instantiate the right details class.
  * \param FieldType - Generic object with operator (iPoint,iVar).
  * \param GradientType - Generic object with operator (iPoint,iVar,iDim).
+ * \param MinMaxType - Generic object with operator (iPoint,iVar), may use a different storage layout.
  */
-template<size_t nDim, LIMITER LimiterKind, class FieldType, class GradientType>
+template<size_t nDim, LIMITER LimiterKind, class FieldType, class GradientType, class MinMaxType>
 void computeLimiters_impl(CSolver* solver,
                           MPI_QUANTITIES kindMpiComm,
                           PERIODIC_QUANTITIES kindPeriodicComm1,
@@ -71,8 +72,8 @@ void computeLimiters_impl(CSolver* solver,
                           size_t varEnd,
                           const FieldType& field,
                           const GradientType& gradient,
-                          FieldType& fieldMin,
-                          FieldType& fieldMax,
+                          MinMaxType& fieldMin,
+                          MinMaxType& fieldMax,
                           FieldType& limiter)
 {
   constexpr size_t MAXNVAR = 32;
@@ -133,7 +134,7 @@ void computeLimiters_impl(CSolver* solver,
     const auto coord_i = nodes->GetCoord(iPoint);
 
     /*--- Cannot preaccumulate if hybrid parallel due to shared reading. ---*/
-    if (omp_get_num_threads() == 1) AD::StartPreacc();
+    if (AD::Active && (omp_get_num_threads() == 1)) AD::StartPreacc();
     AD::SetPreaccIn(coord_i, nDim);
 
     for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
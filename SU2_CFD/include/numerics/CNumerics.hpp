@@ -35,6 +35,7 @@
 
 #include "../../../Common/include/CConfig.hpp"
 #include "../../../Common/include/linear_algebra/blas_structure.hpp"
+#include "../../../Common/include/toolboxes/allocation_toolbox.hpp"
 
 class CElement;
 class CFluidModel;
@@ -48,6 +49,11 @@ class CNumerics {
 protected:
   enum : size_t {MAXNDIM = 3}; /*!< \brief Max number of space dimensions, used in some static arrays. */
 
+  /*--- Arena for the scratch arrays of the instance, it packs them into contiguous
+   storage (instead of scattered new[] blocks) for locality of the per-thread working
+   set, the arena releases the memory, nothing allocated from it may be deleted. ---*/
+  MemoryAllocation::CMemoryArena ScratchMemory;
+
   unsigned short nDim, nVar;  /*!< \brief Number of dimensions and variables. */
   su2double Gamma;            /*!< \brief Fluid's Gamma constant (ratio of specific heats). */
   su2double Gamma_Minus_One;  /*!< \brief Fluids's Gamma - 1.0  . */
@@ -355,6 +361,20 @@ public:
     ScalarVar_j = val_scalarvar_j;
   }
 
+  /*!
+   * \brief Provide a cached face-normal velocity for the next residual evaluation,
+   *        skipping its computation from the flow primitives (see the scalar
+   *        upwind schemes, the value is identical for all of them).
+   * \param[in] val_faceVel - Velocity projected onto the area-scaled face normal.
+   */
+  inline virtual void SetCachedFaceVel(su2double val_faceVel) { }
+
+  /*!
+   * \brief Get the face-normal velocity computed by the last residual evaluation.
+   * \return Velocity projected onto the area-scaled face normal.
+   */
+  inline virtual su2double GetFaceVel() const { return 0.0; }
+
   /*!
    * \brief Set the value of the turbulent variable.
    * \param[in] val_transvar_i - Value of the turbulent variable at point i.
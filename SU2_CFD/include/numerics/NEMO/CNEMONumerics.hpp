@@ -55,6 +55,8 @@ public:
   su2double** Jacobian_i = nullptr;
   su2double** Jacobian_j = nullptr;
 
+  su2activematrix Flux_Tensor;          /*!< \brief Scratch space for the unprojected viscous flux tensor. */
+
   unsigned short nSpecies, nHeavy, nEl; /*!< \brief Number of species present in plasma */
 
   /*--- Graidents w.r.t. conservative variables. ---*/
@@ -41,6 +41,8 @@ private:
 
   su2double *Y, **dYdr;                  // Mass fraction
 
+  vector<su2double> rhos;                /*!< \brief Species densities, scratch for the source routines. */
+
   su2double*  residual = nullptr;        /*!< \brief The source residual. */
   su2double** jacobian = nullptr;
 public:
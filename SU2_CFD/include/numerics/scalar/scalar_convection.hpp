@@ -52,6 +52,8 @@ class CUpwScalar : public CNumerics {
   const FlowIndices idx;            /*!< \brief Object to manage the access to the flow primitives. */
   su2double a0 = 0.0;               /*!< \brief The maximum of the face-normal velocity and 0. */
   su2double a1 = 0.0;               /*!< \brief The minimum of the face-normal velocity and 0. */
+  su2double cachedFaceVel = 0.0;    /*!< \brief Externally provided face-normal velocity (see SetCachedFaceVel). */
+  bool useCachedFaceVel = false;    /*!< \brief Use the cached value instead of computing it, reset after every evaluation. */
   su2double Flux[MAXNVAR];          /*!< \brief Final result, diffusive flux/residual. */
   su2double* Jacobian_i[MAXNVAR];   /*!< \brief Flux Jacobian w.r.t. node i. */
   su2double* Jacobian_j[MAXNVAR];   /*!< \brief Flux Jacobian w.r.t. node j. */
@@ -119,7 +121,13 @@ class CUpwScalar : public CNumerics {
     ExtraADPreaccIn();
 
     su2double q_ij = 0.0;
-    if (dynamic_grid) {
+    if (useCachedFaceVel) {
+      /*--- Reuse the face-normal velocity computed by a previous scalar
+       *    convective pass of this iteration. ---*/
+      AD::SetPreaccIn(cachedFaceVel);
+      q_ij = cachedFaceVel;
+      useCachedFaceVel = false;
+    } else if (dynamic_grid) {
       for (unsigned short iDim = 0; iDim < nDim; iDim++) {
         su2double Velocity_i = V_i[iDim + idx.Velocity()] - GridVel_i[iDim];
         su2double Velocity_j = V_j[iDim + idx.Velocity()] - GridVel_j[iDim];
@@ -141,4 +149,19 @@ class CUpwScalar : public CNumerics {
 
     return ResidualType<>(Flux, Jacobian_i, Jacobian_j);
   }
+
+  /*!
+   * \brief Provide a cached face-normal velocity for the next residual evaluation.
+   * \param[in] val_faceVel - Velocity projected onto the area-scaled face normal.
+   */
+  inline void SetCachedFaceVel(su2double val_faceVel) final {
+    cachedFaceVel = val_faceVel;
+    useCachedFaceVel = true;
+  }
+
+  /*!
+   * \brief Get the face-normal velocity computed by the last residual evaluation.
+   * \return Velocity projected onto the area-scaled face normal.
+   */
+  inline su2double GetFaceVel() const final { return a0 + a1; }
 };
@@ -478,9 +478,15 @@ class CCompressibilityCorrection final : public ParentClass {
     /*--- Residual from standard SA ---*/
     ParentClass::ComputeResidual(config);
 
-    /*--- Compressibility Correction term ---*/
+    /*--- Compressibility Correction term, preaccumulated separately since the
+     * base residual closes its own preaccumulation region. ---*/
     const auto& pressure = V_i[idx.Pressure()];
     const auto& density = V_i[idx.Density()];
+
+    AD::StartPreacc();
+    AD::SetPreaccIn(pressure, density, ScalarVar_i[0], Volume, this->Residual);
+    AD::SetPreaccIn(PrimVar_Grad_i + idx.Velocity(), nDim, nDim);
+
     const su2double sound_speed = sqrt(pressure * Gamma / density);
     su2double aux_cc = 0;
     for (unsigned short iDim = 0; iDim < nDim; ++iDim) {
@@ -494,6 +500,9 @@ class CCompressibilityCorrection final : public ParentClass {
     this->Residual -= CompCorrection;
     this->Jacobian_i[0] -= d_CompCorrection;
 
+    AD::SetPreaccOut(this->Residual);
+    AD::EndPreacc();
+
     return ResidualType(&this->Residual, &this->Jacobian_i, nullptr);
   }
 };
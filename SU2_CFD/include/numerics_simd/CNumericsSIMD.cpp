@@ -28,9 +28,13 @@
  */
 
 #include "CNumericsSIMD.hpp"
+#include "../../../Common/include/parallelization/cpu_features.hpp"
 #include "flow/convection/roe.hpp"
 #include "flow/convection/centered.hpp"
+#include "flow/convection/fds.hpp"
 #include "flow/diffusion/viscous_fluxes.hpp"
+#include "turbulent/turb_fluxes.hpp"
+#include "species/species_fluxes.hpp"
 
 namespace {
 
@@ -56,6 +60,20 @@ CNumericsSIMD* createUpwindGeneralNumerics(const CConfig& config, int iMesh, con
   return nullptr;
 }
 
+/*!
+ * \brief Upwind factory implementation for incompressible flows.
+ */
+template<class ViscousDecorator>
+CNumericsSIMD* createUpwindIncNumerics(const CConfig& config, int iMesh, const CVariable* turbVars) {
+  CNumericsSIMD* obj = nullptr;
+  switch (config.GetKind_Upwind_Flow()) {
+    case FDS:
+      obj = new CFDSScheme<ViscousDecorator>(config, iMesh, turbVars);
+      break;
+  }
+  return obj;
+}
+
 /*!
  * \brief Centered factory implementation.
  */
@@ -90,6 +108,18 @@ CNumericsSIMD* createNumerics(const CConfig& config, int iMesh, const CVariable*
   const bool ideal_gas = (config.GetKind_FluidModel() == STANDARD_AIR) ||
                          (config.GetKind_FluidModel() == IDEAL_GAS);
 
+  /*--- Incompressible flows have their own family of schemes. ---*/
+
+  if (config.GetKind_Regime() == ENUM_REGIME::INCOMPRESSIBLE) {
+    if (config.GetKind_ConvNumScheme_Flow() == SPACE_UPWIND) {
+      if (config.GetViscous())
+        obj = createUpwindIncNumerics<CIncompressibleViscousFlux<nDim> >(config, iMesh, turbVars);
+      else
+        obj = createUpwindIncNumerics<CNoViscousFlux<nDim> >(config, iMesh, turbVars);
+    }
+    return obj;
+  }
+
   switch (config.GetKind_ConvNumScheme_Flow()) {
     case SPACE_UPWIND:
       if (config.GetViscous()) {
@@ -130,11 +160,86 @@ CNumericsSIMD* createNumerics(const CConfig& config, int iMesh, const CVariable*
  * numerical methods.
  */
 CNumericsSIMD* CNumericsSIMD::CreateNumerics(const CConfig& config, int nDim, int iMesh, const CVariable* turbVars) {
-  if ((Double::Size < 4) && (SU2_MPI::GetRank() == MASTER_NODE)) {
-    cout << "WARNING: SU2 was not compiled for an AVX-capable architecture." << endl;
+  if (SU2_MPI::GetRank() == MASTER_NODE) {
+    if (Double::Size < 4) {
+      cout << "WARNING: SU2 was not compiled for an AVX-capable architecture." << endl;
+    }
+    /*--- The SIMD width is a compile-time property (it defines the layout of
+     simd::Array and the flux interfaces), detect hosts that support wider
+     vectors than the binary uses so heterogeneous clusters can spot builds
+     that underutilize their newest nodes. ---*/
+    if (CpuFeatures::HostIsWiderThanBinary()) {
+      cout << "WARNING: SU2 was compiled for " << 8 * CpuFeatures::CompiledVectorWidth()
+           << "bit vectors but this CPU supports " << 8 * CpuFeatures::HostVectorWidth()
+           << "bit vectors,\n         rebuild with native optimizations to use the full SIMD width." << endl;
+    }
   }
   if (nDim == 2) return createNumerics<2>(config, iMesh, turbVars);
   if (nDim == 3) return createNumerics<3>(config, iMesh, turbVars);
 
   return nullptr;
 }
+
+/*!
+ * \brief Turbulence counterpart of CreateNumerics, returns nullptr instead of
+ * erroring for unsupported models so callers can fall back to scalar numerics.
+ */
+CNumericsSIMD* CNumericsSIMD::CreateTurbNumerics(const CConfig& config, int nDim, const CVariable* flowVars) {
+
+  /*--- Only SA variants that share the standard diffusion term, without MUSCL
+   *    reconstruction of the turbulence variable, and for compressible flow
+   *    (the primitive variable layout is hardcoded in the kernels). ---*/
+
+  const auto model = config.GetKind_Turb_Model();
+  const bool supported = (model == TURB_MODEL::SA) || (model == TURB_MODEL::SA_E) ||
+                         (model == TURB_MODEL::SA_COMP) || (model == TURB_MODEL::SA_E_COMP);
+
+  if (!supported || config.GetMUSCL_Turb() ||
+      (config.GetKind_Regime() != ENUM_REGIME::COMPRESSIBLE)) return nullptr;
+
+  if (nDim == 2) return new CSAFlux<2>(config, flowVars);
+  if (nDim == 3) return new CSAFlux<3>(config, flowVars);
+
+  return nullptr;
+}
+
+namespace {
+
+/*!
+ * \brief Species factory implementation, the number of species is a template
+ * parameter of the kernels (to unroll the small per-variable loops), hence
+ * only a few counts are instantiated.
+ */
+template<int nDim>
+CNumericsSIMD* createSpeciesNumerics(const CConfig& config, const CVariable* flowVars, unsigned short nVarSpecies) {
+  switch (nVarSpecies) {
+    case 1: return new CSpeciesFlux<nDim,1>(config, flowVars);
+    case 2: return new CSpeciesFlux<nDim,2>(config, flowVars);
+    case 3: return new CSpeciesFlux<nDim,3>(config, flowVars);
+    case 4: return new CSpeciesFlux<nDim,4>(config, flowVars);
+  }
+  return nullptr;
+}
+
+} // namespace
+
+/*!
+ * \brief Species transport counterpart of CreateNumerics, returns nullptr
+ * instead of erroring for unsupported setups so callers can fall back to
+ * scalar numerics.
+ */
+CNumericsSIMD* CNumericsSIMD::CreateSpeciesNumerics(const CConfig& config, int nDim, const CVariable* flowVars,
+                                                    unsigned short nVarSpecies) {
+
+  /*--- Only the plain scalar upwind scheme, without MUSCL reconstruction of
+   *    the species variables, and for compressible flow (the primitive
+   *    variable layout is hardcoded in the kernels). ---*/
+
+  if ((config.GetKind_Upwind_Species() != SCALAR_UPWIND) || config.GetMUSCL_Species() ||
+      (config.GetKind_Regime() != ENUM_REGIME::COMPRESSIBLE)) return nullptr;
+
+  if (nDim == 2) return createSpeciesNumerics<2>(config, flowVars, nVarSpecies);
+  if (nDim == 3) return createSpeciesNumerics<3>(config, flowVars, nVarSpecies);
+
+  return nullptr;
+}
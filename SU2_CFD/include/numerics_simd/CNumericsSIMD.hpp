@@ -96,4 +96,22 @@ public:
    */
   static CNumericsSIMD* CreateNumerics(const CConfig& config, int nDim, int iMesh, const CVariable* turbVars = nullptr);
 
+  /*!
+   * \brief Factory method for turbulence edge fluxes (nullptr if the model is not supported).
+   * \param[in] config - Problem definitions.
+   * \param[in] nDim - 2D or 3D.
+   * \param[in] flowVars - Flow variables (for velocities and viscosities).
+   */
+  static CNumericsSIMD* CreateTurbNumerics(const CConfig& config, int nDim, const CVariable* flowVars);
+
+  /*!
+   * \brief Factory method for species transport edge fluxes (nullptr if not supported).
+   * \param[in] config - Problem definitions.
+   * \param[in] nDim - 2D or 3D.
+   * \param[in] flowVars - Flow variables (for velocities and viscosities).
+   * \param[in] nVarSpecies - Number of transported species.
+   */
+  static CNumericsSIMD* CreateSpeciesNumerics(const CConfig& config, int nDim, const CVariable* flowVars,
+                                              unsigned short nVarSpecies);
+
 };
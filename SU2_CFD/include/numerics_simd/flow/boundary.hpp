@@ -0,0 +1,276 @@
+﻿/*!
+ * \file boundary.hpp
+ * \brief Batched (SIMD) boundary condition kernels.
+ * \note These kernels gather per-marker vertex data into contiguous
+ * SIMD-width tiles and apply the boundary flux to a whole tile at once,
+ * instead of dispatching a scalar CNumerics object per vertex.
+ * \author P. Gomes
+ * \version 7.3.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2022, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "../CNumericsSIMD.hpp"
+#include "../util.hpp"
+#include "variables.hpp"
+#include "convection/common.hpp"
+#include "../../variables/CEulerVariable.hpp"
+#include "../../../../Common/include/geometry/CGeometry.hpp"
+
+/*!
+ * \brief Compute the far-field fluxes for an entire marker in SIMD-width batches.
+ * \note This is the characteristic (Riemann invariant) boundary condition of
+ * CEulerSolver::BC_Far_Field, with the conditionals of the scalar version
+ * replaced by mask blending, and the flux evaluated with the same Roe scheme
+ * used by the vectorized edge loop. Static grids only, the viscous
+ * contribution (if any) is handled by the scalar part of the caller.
+ * \param[in] config - Problem definitions.
+ * \param[in] geometry - Problem geometry.
+ * \param[in] solution - Flow variables.
+ * \param[in] iMarker - Far-field marker.
+ * \param[in] velocityInf - Free-stream velocity.
+ * \param[in] densityInf - Free-stream density.
+ * \param[in] pressureInf - Free-stream pressure.
+ * \param[in] tkeInf - Free-stream turbulent kinetic energy (0 if not needed).
+ * \param[in,out] characPrimVar - Storage for the boundary state, [iVertex][iVar].
+ * \param[in,out] vector - Target for the fluxes (linear system RHS).
+ * \param[in,out] matrix - Target for the flux Jacobians (linear system matrix).
+ */
+template<size_t nDim>
+void computeFarfieldBCFluxes(const CConfig& config,
+                             const CGeometry& geometry,
+                             const CEulerVariable& solution,
+                             unsigned short iMarker,
+                             const su2double* velocityInf,
+                             su2double densityInf,
+                             su2double pressureInf,
+                             su2double tkeInf,
+                             su2activematrix& characPrimVar,
+                             CSysVector<su2double>& vector,
+                             SparseMatrixType& matrix) {
+  constexpr size_t nVar = nDim+2;
+  constexpr size_t nPrimVar = nDim+4;
+  constexpr size_t OMP_MIN_SIZE = 32;
+
+  const bool implicit = (config.GetKind_TimeIntScheme() == EULER_IMPLICIT);
+  const su2double gamma = config.GetGamma();
+  const su2double gm1 = gamma - 1.0;
+  const su2double gasConst = config.GetGas_ConstantND();
+  const su2double kappa = config.GetRoe_Kappa();
+  const su2double entropyFix = config.GetEntropyFix_Coeff();
+  const auto typeDissip = static_cast<ENUM_ROELOWDISS>(config.GetKind_RoeLowDiss());
+
+  /*--- Free-stream quantities are uniform over the marker. ---*/
+  const su2double soundInf = sqrt(gamma*pressureInf/densityInf);
+  const su2double entropyInf = pow(densityInf,gamma)/pressureInf;
+
+  const auto nVertex = geometry.nVertex[iMarker];
+  const auto vertices = geometry.vertex[iMarker];
+
+  /*--- Loop over SIMD-width tiles of vertices, lanes past the end of the
+   *    marker duplicate the last vertex and are masked out of the update. ---*/
+
+  SU2_OMP_FOR_DYN(nextMultiple(OMP_MIN_SIZE, Double::Size))
+  for (auto kVertex = 0ul; kVertex < nVertex; kVertex += Double::Size) {
+
+    AD::StartPreacc();
+    for (size_t iDim = 0; iDim < nDim; ++iDim)
+      AD::SetPreaccIn(velocityInf[iDim]);
+    AD::SetPreaccIn(densityInf);
+    AD::SetPreaccIn(pressureInf);
+    AD::SetPreaccIn(tkeInf);
+
+    /*--- Gather the vertex data into contiguous tiles. ---*/
+
+    Int iPoint;
+    VectorDbl<nDim> normal;
+    unsigned long vertexIdx[Double::Size];
+    bool laneValid[Double::Size];
+
+    for (size_t k = 0; k < Double::Size; ++k) {
+      const auto jVertex = std::min<unsigned long>(kVertex+k, nVertex-1);
+      vertexIdx[k] = jVertex;
+      const auto point = vertices[jVertex]->GetNode();
+      iPoint[k] = point;
+      laneValid[k] = (kVertex+k < nVertex) && geometry.nodes->GetDomain(point);
+
+      /*--- Negate the normal for the outward convention. ---*/
+      const su2double* n = vertices[jVertex]->GetNormal();
+      for (size_t iDim = 0; iDim < nDim; ++iDim) {
+        AD::SetPreaccIn(n[iDim]);
+        normal(iDim)[k] = -n[iDim];
+      }
+    }
+
+    const auto area = norm(normal);
+    VectorDbl<nDim> unitNormal;
+    for (size_t iDim = 0; iDim < nDim; ++iDim)
+      unitNormal(iDim) = normal(iDim) / area;
+
+    /*--- Interior state of the tile. ---*/
+
+    CPair<CCompressiblePrimitives<nDim,nPrimVar> > V;
+    V.i.all = gatherVariables<nPrimVar>(iPoint, solution.GetPrimitive());
+
+    const Double vnBound = dot<nDim>(unitNormal.data(), V.i.velocity());
+    const Double soundBound = sqrt(gamma * V.i.pressure() / V.i.density());
+    const Double entropyBound = pow(V.i.density(),gamma) / V.i.pressure();
+
+    const Double vnInf = dot<nDim>(unitNormal.data(), velocityInf);
+
+    /*--- Acoustic Riemann invariants, the masks select the boundary or
+     *    free-stream invariant depending on the wave directions, see the
+     *    scalar implementation for the full story. ---*/
+
+    const Double subsonicIn = vnInf > -soundInf;
+    const Double riemannPlus = subsonicIn * (vnBound + 2.0*soundBound/gm1) +
+                          (1.0-subsonicIn) * (vnInf + 2.0*soundInf/gm1);
+
+    const Double supersonicOut = vnInf > soundInf;
+    const Double riemannMinus = supersonicOut * (vnBound - 2.0*soundBound/gm1) +
+                           (1.0-supersonicOut) * (vnInf - 2.0*soundInf/gm1);
+
+    const Double vn = 0.5 * (riemannPlus + riemannMinus);
+    const Double soundSpeed = 0.25 * (riemannPlus - riemannMinus) * gm1;
+
+    /*--- Construct the boundary state from interior (outflow) or
+     *    free-stream (inflow) information. ---*/
+
+    const Double outflow = vnInf > 0.0;
+
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      V.j.velocity(iDim) = outflow * (V.i.velocity(iDim) + (vn-vnBound)*unitNormal(iDim)) +
+                      (1.0-outflow) * (velocityInf[iDim] + (vn-vnInf)*unitNormal(iDim));
+    }
+    const Double entropy = outflow*entropyBound + (1.0-outflow)*entropyInf;
+
+    V.j.density() = pow(entropy*soundSpeed*soundSpeed/gamma, 1.0/gm1);
+    V.j.pressure() = V.j.density()*soundSpeed*soundSpeed/gamma;
+    V.j.temperature() = V.j.pressure() / (gasConst*V.j.density());
+    const Double energy = V.j.pressure()/(gm1*V.j.density()) +
+                          0.5*squaredNorm<nDim>(V.j.velocity()) + tkeInf;
+    V.j.enthalpy() = energy + V.j.pressure()/V.j.density();
+
+    /*--- Conservative variables and Roe averages. ---*/
+
+    CPair<CCompressibleConservatives<nDim> > U;
+    U.i = compressibleConservatives(V.i);
+    U.j = compressibleConservatives(V.j);
+
+    auto roeAvg = roeAveragedVariables(gamma, V, unitNormal);
+
+    auto pMat = pMatrix(gamma, roeAvg.density, roeAvg.velocity,
+                        roeAvg.projVel, roeAvg.speedSound, unitNormal);
+
+    /*--- Convective eigenvalues with Mavriplis' entropy correction. ---*/
+
+    VectorDbl<nVar> lambda;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      lambda(iDim) = roeAvg.projVel;
+    }
+    lambda(nDim) = roeAvg.projVel + roeAvg.speedSound;
+    lambda(nDim+1) = roeAvg.projVel - roeAvg.speedSound;
+
+    const Double maxLambda = abs(roeAvg.projVel) + roeAvg.speedSound;
+
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      lambda(iVar) = max(abs(lambda(iVar)), entropyFix*maxLambda);
+    }
+
+    /*--- Inviscid fluxes and Jacobians. ---*/
+
+    auto flux_i = inviscidProjFlux(V.i, U.i, normal);
+    auto flux_j = inviscidProjFlux(V.j, U.j, normal);
+
+    VectorDbl<nVar> flux;
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      flux(iVar) = kappa * (flux_i(iVar) + flux_j(iVar));
+    }
+
+    MatrixDbl<nVar> jac_i;
+    if (implicit) {
+      jac_i = inviscidProjJac(gamma, V.i.velocity(), U.i.energy(), normal, kappa);
+    }
+
+    /*--- Roe dissipation, only the Jacobian w.r.t. the interior state
+     *    is needed (weak imposition of the boundary condition). ---*/
+
+    auto pMatInv = pMatrixInv(gamma, roeAvg.density, roeAvg.velocity,
+                              roeAvg.projVel, roeAvg.speedSound, unitNormal);
+
+    const Double dissipation = roeDissipation(iPoint, iPoint, typeDissip, solution);
+
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      for (size_t jVar = 0; jVar < nVar; ++jVar) {
+        Double projModJacTensor = 0.0;
+        for (size_t kVar = 0; kVar < nVar; ++kVar) {
+          projModJacTensor += pMat(iVar,kVar) * lambda(kVar) * pMatInv(kVar,jVar);
+        }
+        const Double dDdU = projModJacTensor * (1-kappa) * area * dissipation;
+
+        flux(iVar) -= dDdU * (U.j.all(jVar) - U.i.all(jVar));
+
+        if (implicit) jac_i(iVar,jVar) += dDdU;
+      }
+    }
+
+    /*--- Store the boundary state, other BCs and the viscous
+     *    contribution of the caller fetch it from here. ---*/
+
+    for (size_t k = 0; k < Double::Size; ++k) {
+      if (!laneValid[k]) continue;
+      su2double* vInfty = characPrimVar[vertexIdx[k]];
+      for (size_t iVar = 0; iVar < nPrimVar; ++iVar) {
+        vInfty[iVar] = V.j.all(iVar)[k];
+        AD::SetPreaccOut(vInfty[iVar]);
+      }
+    }
+
+    stopPreacc(flux);
+
+    /*--- Scatter the fluxes and Jacobians, each vertex of a marker is a
+     *    different point, hence no lane or thread can conflict here. ---*/
+
+    for (size_t k = 0; k < Double::Size; ++k) {
+      if (!laneValid[k]) continue;
+      const auto point = iPoint[k];
+
+      su2double fluxLane[nVar];
+      for (size_t iVar = 0; iVar < nVar; ++iVar)
+        fluxLane[iVar] = flux(iVar)[k];
+      vector.AddBlock(point, fluxLane);
+
+      if (implicit) {
+        su2double jacLane[nVar][nVar];
+        for (size_t iVar = 0; iVar < nVar; ++iVar)
+          for (size_t jVar = 0; jVar < nVar; ++jVar)
+            jacLane[iVar][jVar] = jac_i(iVar,jVar)[k];
+
+        const auto wasActive = AD::BeginPassive();
+        matrix.AddBlock2Diag(point, jacLane);
+        AD::EndPassive(wasActive);
+      }
+    }
+  }
+  END_SU2_OMP_FOR
+}
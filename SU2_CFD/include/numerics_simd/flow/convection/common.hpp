@@ -317,6 +317,144 @@ FORCEINLINE MatrixDbl<nDim+2> inviscidProjJac(Double gamma, RandomAccessIterator
   return jac;
 }
 
+/*!
+ * \brief Convective projected (onto normal) flux (incompressible flow).
+ */
+template<class PrimVarType, size_t nDim>
+FORCEINLINE VectorDbl<nDim+2> inviscidIncProjFlux(const PrimVarType& V,
+                                                  Double enthalpy,
+                                                  const VectorDbl<nDim>& normal) {
+  Double mdot = V.density() * dot<nDim>(V.velocity(), normal);
+  VectorDbl<nDim+2> flux;
+  flux(0) = mdot;
+  for (size_t iDim = 0; iDim < nDim; ++iDim) {
+    flux(iDim+1) = mdot*V.velocity(iDim) + normal(iDim)*V.pressure();
+  }
+  flux(nDim+1) = mdot*enthalpy;
+  return flux;
+}
+
+/*!
+ * \brief Jacobian of the convective flux (incompressible flow), w.r.t. the
+ * working variables (pressure, velocity, temperature).
+ */
+template<class PrimVarType, size_t nDim>
+FORCEINLINE MatrixDbl<nDim+2> inviscidIncProjJac(const PrimVarType& V,
+                                                 Double cp,
+                                                 Double dRhodT,
+                                                 const VectorDbl<nDim>& normal,
+                                                 Double scale) {
+  MatrixDbl<nDim+2> jac;
+
+  Double projVel = dot<nDim>(V.velocity(), normal);
+  Double oneOnBeta2 = 1 / V.beta2();
+
+  jac(0,0) = scale * projVel * oneOnBeta2;
+  for (size_t jDim = 0; jDim < nDim; ++jDim) {
+    jac(0,jDim+1) = scale * normal(jDim) * V.density();
+  }
+  jac(0,nDim+1) = scale * dRhodT * projVel;
+
+  for (size_t iDim = 0; iDim < nDim; ++iDim) {
+    jac(iDim+1,0) = scale * (normal(iDim) + V.velocity(iDim)*projVel*oneOnBeta2);
+    for (size_t jDim = 0; jDim < nDim; ++jDim) {
+      jac(iDim+1,jDim+1) = scale * normal(jDim) * V.density() * V.velocity(iDim);
+    }
+    jac(iDim+1,iDim+1) += scale * V.density() * projVel;
+    jac(iDim+1,nDim+1) = scale * dRhodT * V.velocity(iDim) * projVel;
+  }
+
+  const Double cpT = cp * V.temperature();
+  jac(nDim+1,0) = scale * cpT * projVel * oneOnBeta2;
+  for (size_t jDim = 0; jDim < nDim; ++jDim) {
+    jac(nDim+1,jDim+1) = scale * cpT * normal(jDim) * V.density();
+  }
+  jac(nDim+1,nDim+1) = scale * cp * (V.temperature()*dRhodT + V.density()) * projVel;
+
+  return jac;
+}
+
+/*!
+ * \brief Preconditioner of the incompressible system (lower-triangular-ish
+ * transformation from working to "conservative-like" variables).
+ */
+template<size_t nDim>
+FORCEINLINE MatrixDbl<nDim+2> incPreconditioner(Double density,
+                                                Double beta2,
+                                                Double cp,
+                                                Double temperature,
+                                                Double dRhodT,
+                                                const VectorDbl<nDim>& velocity) {
+  MatrixDbl<nDim+2> precon;
+  const Double oneOnBeta2 = 1 / beta2;
+
+  precon(0,0) = oneOnBeta2;
+  for (size_t iDim = 0; iDim < nDim; ++iDim) {
+    precon(iDim+1,0) = velocity(iDim) * oneOnBeta2;
+  }
+  precon(nDim+1,0) = cp * temperature * oneOnBeta2;
+
+  for (size_t jDim = 0; jDim < nDim; ++jDim) {
+    precon(0,jDim+1) = 0.0;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      precon(iDim+1,jDim+1) = (iDim==jDim)? density : Double(0.0);
+    }
+    precon(nDim+1,jDim+1) = 0.0;
+  }
+
+  precon(0,nDim+1) = dRhodT;
+  for (size_t iDim = 0; iDim < nDim; ++iDim) {
+    precon(iDim+1,nDim+1) = velocity(iDim) * dRhodT;
+  }
+  precon(nDim+1,nDim+1) = cp * (dRhodT*temperature + density);
+
+  return precon;
+}
+
+/*!
+ * \brief Absolute value of the preconditioned Jacobian of the incompressible
+ * system, |A_precon| = P x |Lambda| x inv(P), evaluated from its eigenvalues.
+ */
+template<size_t nDim>
+FORCEINLINE MatrixDbl<nDim+2> incPreconditionedProjJac(Double density,
+                                                       Double beta2,
+                                                       const VectorDbl<nDim+2>& lambda,
+                                                       const VectorDbl<nDim>& unitNormal) {
+  MatrixDbl<nDim+2> jac;
+  const Double betaSqrt = sqrt(beta2);
+
+  jac(0,0) = 0.5 * (lambda(nDim) + lambda(nDim+1));
+  for (size_t iDim = 0; iDim < nDim; ++iDim) {
+    jac(iDim+1,0) = unitNormal(iDim) * (lambda(nDim+1) - lambda(nDim)) / (2 * betaSqrt * density);
+  }
+  jac(nDim+1,0) = 0.0;
+
+  for (size_t jDim = 0; jDim < nDim; ++jDim) {
+    jac(0,jDim+1) = 0.5 * betaSqrt * unitNormal(jDim) * density * (lambda(nDim+1) - lambda(nDim));
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      if (iDim == jDim) {
+        jac(iDim+1,jDim+1) = 0.5 * (lambda(nDim) + lambda(nDim+1)) * pow(unitNormal(iDim),2);
+        for (size_t kDim = 0; kDim < nDim; ++kDim) {
+          if (kDim != iDim) jac(iDim+1,jDim+1) += 2 * lambda(0) * pow(unitNormal(kDim),2);
+        }
+      }
+      else {
+        jac(iDim+1,jDim+1) = 0.5 * unitNormal(iDim) * unitNormal(jDim) *
+                             (lambda(nDim) + lambda(nDim+1) - 2*lambda(0));
+      }
+    }
+    jac(nDim+1,jDim+1) = 0.0;
+  }
+
+  jac(0,nDim+1) = 0.0;
+  for (size_t iDim = 0; iDim < nDim; ++iDim) {
+    jac(iDim+1,nDim+1) = 0.0;
+  }
+  jac(nDim+1,nDim+1) = lambda(nDim-1);
+
+  return jac;
+}
+
 /*!
  * \brief (Low) Dissipation coefficient for Roe schemes.
  */
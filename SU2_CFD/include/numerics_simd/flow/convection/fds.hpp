@@ -0,0 +1,268 @@
+/*!
+ * \file fds.hpp
+ * \brief Flux difference splitting scheme for incompressible flows.
+ * \author P. Gomes, F. Palacios, T. Economon
+ * \version 7.3.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2022, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "../../CNumericsSIMD.hpp"
+#include "../../util.hpp"
+#include "../variables.hpp"
+#include "common.hpp"
+#include "../../../variables/CIncEulerVariable.hpp"
+#include "../../../../../Common/include/geometry/CGeometry.hpp"
+
+/*!
+ * \class CFDSScheme
+ * \brief Flux difference splitting scheme for the preconditioned
+ * incompressible equations (SIMD version of CUpwFDSInc_Flow).
+ * The system is solved for the working variables (pressure, velocity,
+ * temperature), hence flux and Jacobians are w.r.t. those variables.
+ * A base class implementing "viscousTerms" is accepted as template parameter.
+ */
+template<class Base>
+class CFDSScheme : public Base {
+protected:
+  using Base::nDim;
+  static constexpr size_t nVar = nDim+2;
+  static constexpr size_t nPrimVarGrad = nDim+4;
+  static constexpr size_t nPrimVar = Max(Base::nPrimVar, nDim+8);
+
+  const bool variableDensity;
+  const bool energy;
+  const bool finestGrid;
+  const bool dynamicGrid;
+  const bool muscl;
+  const LIMITER typeLimiter;
+
+public:
+  /*!
+   * \brief Constructor, store some constants and forward args to base.
+   */
+  template<class... Ts>
+  CFDSScheme(const CConfig& config, unsigned iMesh, Ts&... args) : Base(config, iMesh, args...),
+    variableDensity(config.GetKind_DensityModel() == INC_DENSITYMODEL::VARIABLE),
+    energy(config.GetEnergy_Equation()),
+    finestGrid(iMesh == MESH_0),
+    dynamicGrid(config.GetDynamic_Grid()),
+    muscl(finestGrid && config.GetMUSCL_Flow()),
+    typeLimiter(config.GetKind_SlopeLimit_Flow()) {
+  }
+
+  /*!
+   * \brief Implementation of the FDS flux.
+   */
+  void ComputeFlux(Int iEdge,
+                   const CConfig& config,
+                   const CGeometry& geometry,
+                   const CVariable& solution_,
+                   UpdateType updateType,
+                   Double updateMask,
+                   CSysVector<su2double>& vector,
+                   SparseMatrixType& matrix) const final {
+
+    /*--- Start preaccumulation, inputs are registered
+     *    automatically in "gatherVariables". ---*/
+    AD::StartPreacc();
+
+    const bool implicit = (config.GetKind_TimeIntScheme() == EULER_IMPLICIT);
+    const auto& solution = static_cast<const CIncEulerVariable&>(solution_);
+
+    const auto iPoint = geometry.edges->GetNode(iEdge,0);
+    const auto jPoint = geometry.edges->GetNode(iEdge,1);
+
+    /*--- Geometric properties. ---*/
+
+    const auto vector_ij = distanceVector<nDim>(iPoint, jPoint, geometry.nodes->GetCoord());
+
+    const auto normal = gatherVariables<nDim>(iEdge, geometry.edges->GetNormal());
+    const auto area = norm(normal);
+    VectorDbl<nDim> unitNormal;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      unitNormal(iDim) = normal(iDim) / area;
+    }
+
+    /*--- Reconstructed primitives. ---*/
+
+    CPair<CIncompressiblePrimitives<nDim,nPrimVar> > V1st;
+    V1st.i.all = gatherVariables<nPrimVar>(iPoint, solution.GetPrimitive());
+    V1st.j.all = gatherVariables<nPrimVar>(jPoint, solution.GetPrimitive());
+
+    auto V = reconstructPrimitives<CIncompressiblePrimitives<nDim,nPrimVarGrad> >(
+                  iPoint, jPoint, muscl, typeLimiter, V1st, vector_ij, solution);
+
+    /*--- Enthalpy, with the specific heat taken un-reconstructed. ---*/
+
+    const Double enthalpy_i = V1st.i.cp() * V.i.temperature();
+    const Double enthalpy_j = V1st.j.cp() * V.j.temperature();
+
+    /*--- Mean variables of the two points. ---*/
+
+    const Double meanDensity = 0.5 * (V.i.density() + V.j.density());
+    const Double meanBeta2 = 0.5 * (V.i.beta2() + V.j.beta2());
+    const Double meanCp = 0.5 * (V1st.i.cp() + V1st.j.cp());
+    const Double meanTemperature = 0.5 * (V.i.temperature() + V.j.temperature());
+
+    VectorDbl<nDim> meanVelocity;
+    Double projVel = 0.0;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      meanVelocity(iDim) = 0.5 * (V.i.velocity(iDim) + V.j.velocity(iDim));
+      projVel += meanVelocity(iDim) * normal(iDim);
+    }
+
+    /*--- Projected velocity adjustment due to grid motion. ---*/
+
+    Double projGridVel = 0.0;
+    if (dynamicGrid) {
+      const auto& gridVel = geometry.nodes->GetGridVel();
+      projGridVel = 0.5*(dot(gatherVariables<nDim>(iPoint,gridVel), normal)+
+                         dot(gatherVariables<nDim>(jPoint,gridVel), normal));
+      projVel -= projGridVel;
+    }
+
+    /*--- Artificial sound speed based on the eigenvalues of the
+     *    preconditioned system (scaled by area like projVel). ---*/
+
+    const Double meanSoundSpeed = sqrt(meanBeta2) * area;
+
+    /*--- Density derivative w.r.t. temperature, for now the only option
+     *    is the ideal gas law (dRhodT should come from the fluid model). ---*/
+
+    Double meandRhodT = 0.0, dRhodT_i = 0.0, dRhodT_j = 0.0;
+    if (variableDensity) {
+      meandRhodT = -meanDensity / meanTemperature;
+      dRhodT_i = -V.i.density() / V.i.temperature();
+      dRhodT_j = -V.j.density() / V.j.temperature();
+    }
+
+    /*--- Eigenvalues of the preconditioned system. ---*/
+
+    VectorDbl<nVar> lambda;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      lambda(iDim) = abs(projVel);
+    }
+    lambda(nDim) = abs(projVel - meanSoundSpeed);
+    lambda(nDim+1) = abs(projVel + meanSoundSpeed);
+
+    /*--- Preconditioner and |A_precon| from mean values. ---*/
+
+    auto precon = incPreconditioner<nDim>(meanDensity, meanBeta2, meanCp,
+                                          meanTemperature, meandRhodT, meanVelocity);
+
+    auto modJac = incPreconditionedProjJac<nDim>(meanDensity, meanBeta2, lambda, unitNormal);
+
+    /*--- Inviscid fluxes and Jacobians. ---*/
+
+    auto flux_i = inviscidIncProjFlux(V.i, enthalpy_i, normal);
+    auto flux_j = inviscidIncProjFlux(V.j, enthalpy_j, normal);
+
+    MatrixDbl<nVar> jac_i, jac_j;
+    if (implicit) {
+      jac_i = inviscidIncProjJac(V.i, V1st.i.cp(), dRhodT_i, normal, 0.5);
+      jac_j = inviscidIncProjJac(V.j, V1st.j.cp(), dRhodT_j, normal, 0.5);
+    }
+
+    /*--- Difference of the working variables at the two points. ---*/
+
+    VectorDbl<nVar> deltaV;
+    deltaV(0) = V.j.pressure() - V.i.pressure();
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      deltaV(iDim+1) = V.j.velocity(iDim) - V.i.velocity(iDim);
+    }
+    deltaV(nDim+1) = V.j.temperature() - V.i.temperature();
+
+    /*--- Compute the flux with dissipation as Precon x |A_precon| x dV. ---*/
+
+    VectorDbl<nVar> flux;
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      flux(iVar) = 0.5 * (flux_i(iVar) + flux_j(iVar));
+      for (size_t jVar = 0; jVar < nVar; ++jVar) {
+        Double dDdV = 0.0;
+        for (size_t kVar = 0; kVar < nVar; ++kVar) {
+          dDdV += precon(iVar,kVar) * modJac(kVar,jVar);
+        }
+        dDdV *= 0.5;
+        flux(iVar) -= dDdV * deltaV(jVar);
+        if (implicit) {
+          jac_i(iVar,jVar) += dDdV;
+          jac_j(iVar,jVar) -= dDdV;
+        }
+      }
+    }
+
+    /*--- Correct for grid motion. ---*/
+
+    if (dynamicGrid) {
+      /*--- "Conservative-like" variables. ---*/
+      VectorDbl<nVar> U_i, U_j;
+      U_i(0) = V.i.density(); U_j(0) = V.j.density();
+      for (size_t iDim = 0; iDim < nDim; ++iDim) {
+        U_i(iDim+1) = V.i.density() * V.i.velocity(iDim);
+        U_j(iDim+1) = V.j.density() * V.j.velocity(iDim);
+      }
+      U_i(nDim+1) = V.i.density() * enthalpy_i;
+      U_j(nDim+1) = V.j.density() * enthalpy_j;
+
+      for (size_t iVar = 0; iVar < nVar; ++iVar) {
+        flux(iVar) -= projGridVel * 0.5 * (U_i(iVar) + U_j(iVar));
+      }
+
+      if (implicit) {
+        for (size_t iDim = 0; iDim < nDim; ++iDim) {
+          jac_i(iDim+1,iDim+1) -= 0.5 * projGridVel * V.i.density();
+          jac_j(iDim+1,iDim+1) -= 0.5 * projGridVel * V.j.density();
+        }
+        jac_i(nDim+1,nDim+1) -= 0.5 * projGridVel * V.i.density() * V1st.i.cp();
+        jac_j(nDim+1,nDim+1) -= 0.5 * projGridVel * V.j.density() * V1st.j.cp();
+      }
+    }
+
+    /*--- Add the contributions from the base class (static decorator). ---*/
+
+    Base::viscousTerms(iEdge, iPoint, jPoint, V1st, solution_, vector_ij, geometry,
+                       config, area, unitNormal, implicit, flux, jac_i, jac_j);
+
+    /*--- Without the energy equation the temperature is decoupled. ---*/
+
+    if (!energy) {
+      flux(nDim+1) = 0.0;
+      if (implicit) {
+        for (size_t iVar = 0; iVar < nVar; ++iVar) {
+          jac_i(iVar,nDim+1) = jac_j(iVar,nDim+1) = 0.0;
+          jac_i(nDim+1,iVar) = jac_j(nDim+1,iVar) = 0.0;
+        }
+      }
+    }
+
+    /*--- Stop preaccumulation. ---*/
+
+    stopPreacc(flux);
+
+    /*--- Update the vector and system matrix. ---*/
+
+    updateLinearSystem(iEdge, iPoint, jPoint, implicit, updateType,
+                       updateMask, flux, jac_i, jac_j, vector, matrix);
+  }
+};
@@ -31,6 +31,7 @@
 #include "../../util.hpp"
 #include "../variables.hpp"
 #include "common.hpp"
+#include "../../../variables/CIncNSVariable.hpp"
 
 /*!
  * \class CNoViscousFlux
@@ -367,3 +368,185 @@ public:
     return dEdU;
   }
 };
+
+/*!
+ * \class CIncompressibleViscousFlux
+ * \brief Decorator class to add viscous fluxes (incompressible flow).
+ * The fluxes and Jacobians are w.r.t. the working variables (pressure,
+ * velocity, temperature), as expected by the incompressible schemes.
+ */
+template<size_t NDIM>
+class CIncompressibleViscousFlux : public CNumericsSIMD {
+public:
+  static constexpr size_t nDim = NDIM;
+  static constexpr size_t nPrimVar = nDim+8;
+  static constexpr size_t nPrimVarGrad = nDim+2;
+
+protected:
+  const bool correct;
+  const bool useSA_QCR;
+  const bool wallFun;
+  const bool uq;
+  const bool uq_permute;
+  const size_t uq_eigval_comp;
+  const su2double uq_delta_b;
+  const su2double uq_urlx;
+
+  const CVariable* turbVars;
+
+  /*!
+   * \brief Constructor, initialize constants and booleans.
+   */
+  template<class... Ts>
+  CIncompressibleViscousFlux(const CConfig& config, int iMesh,
+                             const CVariable* turbVars_, Ts&...) :
+    correct(iMesh == MESH_0),
+    useSA_QCR(config.GetQCR()),
+    wallFun(config.GetWall_Functions()),
+    uq(config.GetUsing_UQ()),
+    uq_permute(config.GetUQ_Permute()),
+    uq_eigval_comp(config.GetEig_Val_Comp()),
+    uq_delta_b(config.GetUQ_Delta_B()),
+    uq_urlx(config.GetUQ_URLX()),
+    turbVars(turbVars_) {
+  }
+
+  /*!
+   * \brief Add viscous contributions to flux and jacobians.
+   */
+  template<class PrimVarType, size_t nVar>
+  FORCEINLINE void viscousTerms(Int iEdge,
+                                Int iPoint,
+                                Int jPoint,
+                                const PrimVarType& avgV,
+                                const CPair<PrimVarType>& V,
+                                const CVariable& solution_,
+                                const VectorDbl<nDim>& vector_ij,
+                                const CGeometry& geometry,
+                                const CConfig& config,
+                                Double area,
+                                const VectorDbl<nDim>& unitNormal,
+                                bool implicit,
+                                VectorDbl<nVar>& flux,
+                                MatrixDbl<nVar>& jac_i,
+                                MatrixDbl<nVar>& jac_j) const {
+
+    static_assert(PrimVarType::nVar <= nPrimVar,"");
+
+    const auto& solution = static_cast<const CIncNSVariable&>(solution_);
+    const auto& gradient = solution.GetGradient_Primitive();
+
+    /*--- Compute distance and handle zero without "ifs" by making it large. ---*/
+
+    auto dist2_ij = squaredNorm(vector_ij);
+    Double mask = dist2_ij < EPS*EPS;
+    dist2_ij += mask / (EPS*EPS);
+
+    /*--- Compute the corrected mean gradient (pressure, velocity, temperature). ---*/
+
+    auto avgGrad = averageGradient<nPrimVarGrad,nDim>(iPoint, jPoint, gradient);
+    if(correct) correctGradient(V, vector_ij, dist2_ij, avgGrad);
+
+    /*--- Stress tensor, the layout of the velocity gradient (rows 1 to
+     *    nDim) is the same as in the compressible case. ---*/
+
+    auto tau = stressTensor(avgV.laminarVisc() + (uq? Double(0.0) : avgV.eddyVisc()), avgGrad);
+    if(useSA_QCR) addQCR(avgGrad, tau);
+    if(uq) {
+      Double turb_ke = 0.5*(gatherVariables(iPoint, turbVars->GetSolution()) +
+                            gatherVariables(jPoint, turbVars->GetSolution()));
+      addPerturbedRSM(avgV, avgGrad, turb_ke, tau,
+                      uq_eigval_comp, uq_permute, uq_delta_b, uq_urlx);
+    }
+
+    if(wallFun) addTauWall(iPoint, jPoint, solution.GetTau_Wall(), unitNormal, tau);
+
+    /*--- The effective thermal conductivity is an incompressible primitive. ---*/
+
+    const Double cond = avgV.thermalCond();
+
+    /*--- Projected flux, no work of the viscous forces in the energy
+     *    (temperature) equation. ---*/
+
+    VectorDbl<nVar> viscFlux;
+    viscFlux(0) = 0.0;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      viscFlux(iDim+1) = area * dot(tau[iDim], unitNormal);
+    }
+    viscFlux(nDim+1) = 0.0;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      viscFlux(nDim+1) += area * unitNormal(iDim) * cond * avgGrad(nDim+1,iDim);
+    }
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      flux(iVar) -= viscFlux(iVar);
+    }
+
+    if (!implicit) return;
+
+    /*--- Flux Jacobians w.r.t. the working variables, the derivatives of the
+     *    stress tensor are not divided by the density (unlike compressible). ---*/
+
+    const Double dist_ij = sqrt(dist2_ij);
+    const Double xi = (avgV.laminarVisc() + avgV.eddyVisc()) / dist_ij;
+
+    MatrixDbl<nDim,nVar> dtau;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      dtau(iDim,0) = 0.0;
+      for (size_t jDim = 0; jDim < nDim; ++jDim) {
+        dtau(iDim,jDim+1) = (-1/3.0) * xi * unitNormal(iDim) * unitNormal(jDim);
+      }
+      dtau(iDim,iDim+1) -= xi;
+      dtau(iDim,nDim+1) = 0.0;
+    }
+
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      for (size_t iVar = 0; iVar < nVar; ++iVar) {
+        jac_i(iDim+1,iVar) -= area * dtau(iDim,iVar);
+        jac_j(iDim+1,iVar) += area * dtau(iDim,iVar);
+      }
+    }
+
+    /*--- Temperature equation Jacobian. ---*/
+
+    const Double projOnDist = area * dot(unitNormal,vector_ij) / dist2_ij;
+    jac_i(nDim+1,nDim+1) += cond * projOnDist;
+    jac_j(nDim+1,nDim+1) -= cond * projOnDist;
+  }
+
+  /*!
+   * \overload Average primitives if not provided yet.
+   */
+  template<class PrimVarType, class... Ts>
+  FORCEINLINE void viscousTerms(Int iEdge,
+                                Int iPoint,
+                                Int jPoint,
+                                const CPair<PrimVarType>& V,
+                                Ts&... args) const {
+    PrimVarType avgV;
+    for (size_t iVar = 0; iVar < PrimVarType::nVar; ++iVar) {
+      avgV.all(iVar) = 0.5 * (V.i.all(iVar) + V.j.all(iVar));
+    }
+
+    /*--- Continue calculation. ---*/
+    viscousTerms(iEdge, iPoint, jPoint, avgV, V, args...);
+  }
+
+  /*!
+   * \overload Compute the i-j vector if not provided yet.
+   */
+  template<class PrimVarType, class... Ts>
+  FORCEINLINE void viscousTerms(Int iEdge,
+                                Int iPoint,
+                                Int jPoint,
+                                const PrimVarType& avgV,
+                                const CPair<PrimVarType>& V,
+                                const CVariable& solution_,
+                                const CGeometry& geometry,
+                                Ts&... args) const {
+
+    const auto vector_ij = distanceVector<nDim>(iPoint, jPoint, geometry.nodes->GetCoord());
+
+    /*--- Continue calculation. ---*/
+    viscousTerms(iEdge, iPoint, jPoint, avgV, V, solution_, vector_ij, geometry, args...);
+  }
+};
@@ -0,0 +1,201 @@
+/*!
+ * \file species_fluxes.hpp
+ * \brief Vectorized (SIMD) edge fluxes for species transport equations.
+ * \note Convective and viscous terms are fused in a single kernel, the
+ * sign conventions are therefore those of the convective terms.
+ * \version 7.3.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2022, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "../CNumericsSIMD.hpp"
+#include "../util.hpp"
+#include "../flow/variables.hpp"
+#include "../../variables/CFlowVariable.hpp"
+#include "../../variables/CSpeciesVariable.hpp"
+#include "../../../../Common/include/geometry/CGeometry.hpp"
+
+/*!
+ * \class CSpeciesFlux
+ * \brief SIMD implementation of the species transport convective (scalar
+ * upwind) and viscous (corrected average-of-gradients) fluxes and their
+ * Jacobians. Equivalent to CUpwSca_Species plus CAvgGrad_Species, for the
+ * edge loop of CScalarSolver, first-order in the species variables. The
+ * number of transported species is a template parameter so that the small
+ * per-variable loops unroll completely.
+ */
+template<size_t nDim, size_t nVar>
+class CSpeciesFlux final : public CNumericsSIMD {
+protected:
+  /*--- Compressible primitive layout, up to the eddy viscosity. ---*/
+  static constexpr size_t nPrimVar = nDim+7;
+
+  const bool dynamicGrid;
+  const bool turbulence;
+  const su2double invScTurb;
+  const CFlowVariable* flowVars;
+
+  /*--- For a single species MatrixDbl<1> and MatrixDbl<1,nDim> collapse to
+   *    vector types without two-argument accessors, hence this flat-index
+   *    access helper (the static containers are stored without padding). ---*/
+  template<class Mat>
+  FORCEINLINE static Double& matEntry(Mat& mat, size_t iVar, size_t jVar) {
+    return mat.data()[iVar * mat.cols() + jVar];
+  }
+  template<class Mat>
+  FORCEINLINE static const Double& matEntry(const Mat& mat, size_t iVar, size_t jVar) {
+    return mat.data()[iVar * mat.cols() + jVar];
+  }
+
+public:
+  /*!
+   * \brief Constructor, store the flow variables to fetch velocities and viscosities.
+   */
+  CSpeciesFlux(const CConfig& config, const CVariable* flowVars_) :
+    dynamicGrid(config.GetDynamic_Grid()),
+    turbulence(config.GetKind_Turb_Model() != TURB_MODEL::NONE),
+    invScTurb(1.0 / config.GetSchmidt_Number_Turbulent()),
+    flowVars(static_cast<const CFlowVariable*>(flowVars_)) {
+  }
+
+  /*!
+   * \brief Implementation of the fused convective + viscous flux.
+   */
+  void ComputeFlux(Int iEdge,
+                   const CConfig& config,
+                   const CGeometry& geometry,
+                   const CVariable& solution,
+                   UpdateType updateType,
+                   Double updateMask,
+                   CSysVector<su2double>& vector,
+                   SparseMatrixType& matrix) const final {
+
+    /*--- Start preaccumulation, inputs are registered
+     *    automatically in "gatherVariables". ---*/
+    AD::StartPreacc();
+
+    const bool implicit = (config.GetKind_TimeIntScheme() == EULER_IMPLICIT);
+
+    const auto iPoint = geometry.edges->GetNode(iEdge,0);
+    const auto jPoint = geometry.edges->GetNode(iEdge,1);
+
+    /*--- Geometric properties. ---*/
+
+    const auto vector_ij = distanceVector<nDim>(iPoint, jPoint, geometry.nodes->GetCoord());
+    const auto normal = gatherVariables<nDim>(iEdge, geometry.edges->GetNormal());
+
+    /*--- Flow primitives, species variables, and mass diffusivities,
+     *    no reconstruction. ---*/
+
+    CPair<CCompressiblePrimitives<nDim,nPrimVar> > V;
+    V.i.all = gatherVariables<nPrimVar>(iPoint, flowVars->GetPrimitive());
+    V.j.all = gatherVariables<nPrimVar>(jPoint, flowVars->GetPrimitive());
+
+    const auto Y_i = gatherVariables<nVar>(iPoint, solution.GetSolution());
+    const auto Y_j = gatherVariables<nVar>(jPoint, solution.GetSolution());
+
+    const auto& speciesVars = static_cast<const CSpeciesVariable&>(solution);
+    const auto D_i = gatherVariables<nVar>(iPoint, speciesVars.GetDiffusivity());
+    const auto D_j = gatherVariables<nVar>(jPoint, speciesVars.GetDiffusivity());
+
+    /*--- Convective flux, upwinded on the face-normal velocity. ---*/
+
+    Double projVel = 0.0;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      projVel += 0.5 * (V.i.velocity(iDim) + V.j.velocity(iDim)) * normal(iDim);
+    }
+    if (dynamicGrid) {
+      const auto& gridVel = geometry.nodes->GetGridVel();
+      projVel -= 0.5 * (dot(gatherVariables<nDim>(iPoint,gridVel), normal)+
+                        dot(gatherVariables<nDim>(jPoint,gridVel), normal));
+    }
+
+    const Double a0 = 0.5 * (projVel + abs(projVel));
+    const Double a1 = 0.5 * (projVel - abs(projVel));
+
+    VectorDbl<nVar> flux;
+    MatrixDbl<nVar> jac_i, jac_j;
+
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      flux(iVar) = a0 * V.i.density() * Y_i(iVar) + a1 * V.j.density() * Y_j(iVar);
+    }
+
+    if (implicit) {
+      /*--- Jacobians are taken w.r.t. rho*Y, the off-diagonals are zero. ---*/
+      for (size_t iVar = 0; iVar < nVar; ++iVar) {
+        for (size_t jVar = 0; jVar < nVar; ++jVar) {
+          matEntry(jac_i,iVar,jVar) = matEntry(jac_j,iVar,jVar) = Double(0.0);
+        }
+        matEntry(jac_i,iVar,iVar) = a0;
+        matEntry(jac_j,iVar,iVar) = a1;
+      }
+    }
+
+    /*--- Viscous flux, average of gradients corrected for skewness,
+     *    TSL approximation with frozen diffusivity for the Jacobians. ---*/
+
+    const auto grad_i = gatherVariables<nVar,nDim>(iPoint, solution.GetGradient());
+    const auto grad_j = gatherVariables<nVar,nDim>(jPoint, solution.GetGradient());
+
+    const Double dist2_ij = max(squaredNorm(vector_ij), Double(EPS));
+    const Double projVec_ij = dot(vector_ij, normal) / dist2_ij;
+
+    Double diffTurb = 0.0;
+    if (turbulence) {
+      diffTurb = 0.5 * (V.i.eddyVisc() + V.j.eddyVisc()) * invScTurb;
+    }
+
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+
+      Double projGrad = 0.0, edgeProj = 0.0;
+      for (size_t iDim = 0; iDim < nDim; ++iDim) {
+        const Double meanGrad = 0.5 * (matEntry(grad_i,iVar,iDim) + matEntry(grad_j,iVar,iDim));
+        projGrad += meanGrad * normal(iDim);
+        edgeProj += meanGrad * vector_ij(iDim);
+      }
+      projGrad -= (edgeProj - (Y_j(iVar) - Y_i(iVar))) * projVec_ij;
+
+      /*--- The diffusion coefficients are the binary ones, the turbulent
+       *    part is shared by all species. ---*/
+
+      const Double diffusivity = 0.5 * (V.i.density() * D_i(iVar) +
+                                        V.j.density() * D_j(iVar)) + diffTurb;
+
+      flux(iVar) -= diffusivity * projGrad;
+
+      if (implicit) {
+        matEntry(jac_i,iVar,iVar) += diffusivity * projVec_ij / V.i.density();
+        matEntry(jac_j,iVar,iVar) -= diffusivity * projVec_ij / V.j.density();
+      }
+    }
+
+    /*--- Stop preaccumulation. ---*/
+
+    stopPreacc(flux);
+
+    /*--- Update the vector and system matrix. ---*/
+
+    updateLinearSystem(iEdge, iPoint, jPoint, implicit, updateType,
+                       updateMask, flux, jac_i, jac_j, vector, matrix);
+  }
+};
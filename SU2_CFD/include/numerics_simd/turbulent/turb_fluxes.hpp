@@ -0,0 +1,159 @@
+/*!
+ * \file turb_fluxes.hpp
+ * \brief Vectorized (SIMD) edge fluxes for turbulence transport equations.
+ * \note Convective and viscous terms are fused in a single kernel, the
+ * sign conventions are therefore those of the convective terms.
+ * \version 7.3.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2022, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "../CNumericsSIMD.hpp"
+#include "../util.hpp"
+#include "../flow/variables.hpp"
+#include "../../variables/CFlowVariable.hpp"
+#include "../../../../Common/include/geometry/CGeometry.hpp"
+
+/*!
+ * \class CSAFlux
+ * \brief SIMD implementation of the SA convective (scalar upwind) and
+ * viscous (corrected average-of-gradients) fluxes and their Jacobians.
+ * Equivalent to CUpwSca_TurbSA plus CAvgGrad_TurbSA, for the edge loop
+ * of CScalarSolver, first-order in the turbulence variable.
+ */
+template<size_t nDim>
+class CSAFlux final : public CNumericsSIMD {
+protected:
+  static constexpr size_t nVar = 1;
+  /*--- Compressible primitive layout, up to the laminar viscosity. ---*/
+  static constexpr size_t nPrimVar = nDim+6;
+
+  const su2double sigma = 2.0/3.0;
+  const bool dynamicGrid;
+  const CFlowVariable* flowVars;
+
+public:
+  /*!
+   * \brief Constructor, store the flow variables to fetch velocities and viscosities.
+   */
+  CSAFlux(const CConfig& config, const CVariable* flowVars_) :
+    dynamicGrid(config.GetDynamic_Grid()),
+    flowVars(static_cast<const CFlowVariable*>(flowVars_)) {
+  }
+
+  /*!
+   * \brief Implementation of the fused convective + viscous flux.
+   */
+  void ComputeFlux(Int iEdge,
+                   const CConfig& config,
+                   const CGeometry& geometry,
+                   const CVariable& solution,
+                   UpdateType updateType,
+                   Double updateMask,
+                   CSysVector<su2double>& vector,
+                   SparseMatrixType& matrix) const final {
+
+    /*--- Start preaccumulation, inputs are registered
+     *    automatically in "gatherVariables". ---*/
+    AD::StartPreacc();
+
+    const bool implicit = (config.GetKind_TimeIntScheme() == EULER_IMPLICIT);
+
+    const auto iPoint = geometry.edges->GetNode(iEdge,0);
+    const auto jPoint = geometry.edges->GetNode(iEdge,1);
+
+    /*--- Geometric properties. ---*/
+
+    const auto vector_ij = distanceVector<nDim>(iPoint, jPoint, geometry.nodes->GetCoord());
+    const auto normal = gatherVariables<nDim>(iEdge, geometry.edges->GetNormal());
+
+    /*--- Flow primitives and turbulence variables, no reconstruction. ---*/
+
+    CPair<CCompressiblePrimitives<nDim,nPrimVar> > V;
+    V.i.all = gatherVariables<nPrimVar>(iPoint, flowVars->GetPrimitive());
+    V.j.all = gatherVariables<nPrimVar>(jPoint, flowVars->GetPrimitive());
+
+    const Double nu_i = gatherVariables(iPoint, solution.GetSolution());
+    const Double nu_j = gatherVariables(jPoint, solution.GetSolution());
+
+    /*--- Convective flux, upwinded on the face-normal velocity. ---*/
+
+    Double projVel = 0.0;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      projVel += 0.5 * (V.i.velocity(iDim) + V.j.velocity(iDim)) * normal(iDim);
+    }
+    if (dynamicGrid) {
+      const auto& gridVel = geometry.nodes->GetGridVel();
+      projVel -= 0.5 * (dot(gatherVariables<nDim>(iPoint,gridVel), normal)+
+                        dot(gatherVariables<nDim>(jPoint,gridVel), normal));
+    }
+
+    const Double a0 = 0.5 * (projVel + abs(projVel));
+    const Double a1 = 0.5 * (projVel - abs(projVel));
+
+    VectorDbl<nVar> flux;
+    flux(0) = a0*nu_i + a1*nu_j;
+
+    MatrixDbl<nVar> jac_i, jac_j;
+    if (implicit) {
+      jac_i(0) = a0;
+      jac_j(0) = a1;
+    }
+
+    /*--- Viscous flux, average of gradients corrected for skewness,
+     *    TSL approximation for the Jacobians. ---*/
+
+    const auto grad_i = gatherVariables<nVar,nDim>(iPoint, solution.GetGradient());
+    const auto grad_j = gatherVariables<nVar,nDim>(jPoint, solution.GetGradient());
+
+    const Double dist2_ij = max(squaredNorm(vector_ij), Double(EPS));
+    const Double projVec_ij = dot(vector_ij, normal) / dist2_ij;
+
+    Double projGrad = 0.0, edgeProj = 0.0;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      const Double meanGrad = 0.5 * (grad_i(iDim) + grad_j(iDim));
+      projGrad += meanGrad * normal(iDim);
+      edgeProj += meanGrad * vector_ij(iDim);
+    }
+    projGrad -= (edgeProj - (nu_j - nu_i)) * projVec_ij;
+
+    const Double nu_e = 0.5 * (V.i.laminarVisc()/V.i.density() +
+                               V.j.laminarVisc()/V.j.density() + nu_i + nu_j);
+
+    flux(0) -= nu_e * projGrad / sigma;
+
+    if (implicit) {
+      jac_i(0) -= (0.5*projGrad - nu_e*projVec_ij) / sigma;
+      jac_j(0) -= (0.5*projGrad + nu_e*projVec_ij) / sigma;
+    }
+
+    /*--- Stop preaccumulation. ---*/
+
+    stopPreacc(flux);
+
+    /*--- Update the vector and system matrix. ---*/
+
+    updateLinearSystem(iEdge, iPoint, jPoint, implicit, updateType,
+                       updateMask, flux, jac_i, jac_j, vector, matrix);
+  }
+};
@@ -0,0 +1,111 @@
+/*!
+ * \file CAcousticOutput.hpp
+ * \brief Headers of the acoustic surface sampling (time histories on FWH-type surfaces).
+ * \version 7.3.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2022, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../../../Common/include/basic_types/datatype_structure.hpp"
+
+class CConfig;
+class CGeometry;
+class CSolver;
+
+/*! \class CAcousticOutput
+ *  \brief Samples the flow state on acoustic surfaces (e.g. penetrable FWH
+ *  surfaces) every time step and streams the histories to compact per-rank
+ *  binary files, avoiding volume output for the sole purpose of acoustic
+ *  post-processing.
+ *
+ *  The surface markers are resolved once to the owned vertices at
+ *  preprocessing, each sample is packed into a per-rank ring buffer, and
+ *  full buffers are flushed by a background thread (the same pattern used
+ *  for the asynchronous volume output). The flush thread only performs file
+ *  I/O, hence no MPI threading support is required and each rank streams its
+ *  own file, the pieces are concatenated by the FWH post-processing.
+ *
+ *  File layout: header of 4 unsigned long (magic number 535538, number of
+ *  local surface points, number of variables, number of dimensions) followed
+ *  by the static surface metadata (nPoints x 2 nDim doubles: coordinates and
+ *  area-scaled outward normal per point), then one record of
+ *  (2 + nPoints x nVar) doubles per time step, the first two values being
+ *  the physical time and the iteration number. The variables are density,
+ *  velocity, and pressure, which is what the FWH integration consumes.
+ */
+class CAcousticOutput {
+ private:
+  int rank;                          /*!< \brief MPI rank. */
+  unsigned short nDim = 0;           /*!< \brief Number of spatial dimensions. */
+  unsigned long nVar = 0;            /*!< \brief Number of sampled variables (rho, v, p). */
+  unsigned long nPoints = 0;         /*!< \brief Number of surface points owned by this rank. */
+  unsigned long bufferSteps = 0;     /*!< \brief Capacity of the ring buffer in time steps. */
+  unsigned long stepsInBuffer = 0;   /*!< \brief Number of samples currently held in the ring buffer. */
+  unsigned long recordSize = 0;      /*!< \brief Doubles per sample (2 + nPoints x nVar). */
+  std::string fileName;              /*!< \brief Name of the binary output file of this rank. */
+  bool fileReady = false;            /*!< \brief Whether the file has been created (or opened for append). */
+  bool restart = false;              /*!< \brief Whether an existing file should be appended to. */
+
+  std::vector<unsigned long> points;       /*!< \brief Point indices of the owned surface vertices. */
+  std::vector<passivedouble> metadata;     /*!< \brief Coordinates and normals of the surface points. */
+  std::vector<passivedouble> ringBuffer;   /*!< \brief Packed samples awaiting a flush. */
+  std::vector<passivedouble> flushBuffer;  /*!< \brief Samples handed to the flush thread. */
+
+  std::thread flushThread;           /*!< \brief Background thread appending the flush buffer to the file. */
+  bool flushFailed = false;          /*!< \brief Set by the flush thread on I/O errors, checked by the main thread. */
+
+  /*!
+   * \brief Create the output file and write the header, or open it for append on a restart.
+   */
+  void PrepareFile();
+
+  /*!
+   * \brief Hand the filled part of the ring buffer to the background thread and reset the ring.
+   */
+  void Flush();
+
+ public:
+  /*!
+   * \brief Constructor, resolves the acoustic markers to owned vertices and caches the surface metadata.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  CAcousticOutput(CGeometry* geometry, const CConfig* config);
+
+  /*!
+   * \brief Destructor, joins the flush thread and writes any partial buffer.
+   */
+  ~CAcousticOutput();
+
+  /*!
+   * \brief Pack the surface state of the current time step into the ring buffer, flushing if it is full.
+   * \param[in] solver - The container holding all solution data.
+   * \param[in] iter - Current iteration (time iteration for unsteady problems).
+   * \param[in] curTime - Current physical time.
+   */
+  void Sample(CSolver** solver, unsigned long iter, su2double curTime);
+};
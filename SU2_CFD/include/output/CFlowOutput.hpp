@@ -202,10 +202,12 @@ protected:
   /*!
    * \brief Compute value of the Q criteration for vortex idenfitication
    * \param[in] VelocityGradient - Velocity gradients
+   * \param[in] Vorticity - Vorticity vector of the node, shared with the vorticity
+   *            output fields so that the spin tensor is not recomputed here.
    * \return Value of the Q criteration at the node
    */
   template<class T>
-  su2double GetQ_Criterion(const T& VelocityGradient) const {
+  su2double GetQ_Criterion(const T& VelocityGradient, const su2double* Vorticity) const {
 
     /*--- Make a 3D copy of the gradient so we do not have worry about nDim ---*/
 
@@ -226,13 +228,13 @@ protected:
     su2double s23 = 0.5 * (Grad_Vel[1][2] + Grad_Vel[2][1]);
     su2double s33 = Grad_Vel[2][2];
 
-    /*--- Components of the spin tensor (skew-symmetric) ---*/
-    su2double omega12 = 0.5 * (Grad_Vel[0][1] - Grad_Vel[1][0]);
-    su2double omega13 = 0.5 * (Grad_Vel[0][2] - Grad_Vel[2][0]);
-    su2double omega23 = 0.5 * (Grad_Vel[1][2] - Grad_Vel[2][1]);
+    /*--- Squared norm of the spin tensor (skew-symmetric), its independent
+     components are half the vorticity vector already computed by the solver:
+     2*(omega12^2 + omega13^2 + omega23^2) = 0.5*||Vorticity||^2 ---*/
+    su2double omega2 = 0.5 * (pow(Vorticity[0],2) + pow(Vorticity[1],2) + pow(Vorticity[2],2));
 
     /*--- Q = ||Omega|| - ||Strain|| ---*/
-    su2double Q = 2*(pow(omega12,2) + pow(omega13,2) + pow(omega23,2)) -
+    su2double Q = omega2 -
       (pow(s11,2) + pow(s22,2) + pow(s33,2) + 2*(pow(s12,2) + pow(s13,2) + pow(s23,2)));
 
     return Q;
@@ -280,6 +282,16 @@ protected:
    */
   void LoadTimeAveragedData(unsigned long iPoint, const CVariable *node_flow);
 
+  /*!
+   * \brief Load the time averaged surface output fields (running statistics per vertex).
+   * \param solver
+   * \param iPoint
+   * \param iMarker
+   * \param iVertex
+   */
+  void LoadTimeAveragedSurfaceData(CSolver** solver, unsigned long iPoint, unsigned short iMarker,
+                                   unsigned long iVertex);
+
   /*!
    * \brief Write additional output for fixed CL mode.
    * \param[in] config - Definition of the particular problem per zone.
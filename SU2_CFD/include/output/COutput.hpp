@@ -30,9 +30,12 @@
 #include <fstream>
 #include <cmath>
 #include <map>
+#include <memory>
+#include <set>
 #include <sstream>
 #include <iomanip>
 #include <limits>
+#include <thread>
 #include <vector>
 
 #include "../../../Common/include/toolboxes/printing_toolbox.hpp"
@@ -54,6 +57,8 @@ class CSolver;
 class CFileWriter;
 class CParallelDataSorter;
 class CConfig;
+class CProbeOutput;
+class CAcousticOutput;
 
 using namespace std;
 
@@ -91,8 +96,21 @@ protected:
   string historyFilename;   /*!< \brief The history filename*/
   ofstream histFile;        /*!< \brief Output file stream for the history */
 
+  stringstream screenBuf;   /*!< \brief Buffer holding deferred screen lines between flushes (MONITORING_FLUSH_FREQ > 1). */
+  unsigned long monitorFlushFreq = 1;     /*!< \brief Iterations between flushes of the monitoring output. */
+  unsigned long monitorLinesBuffered = 0; /*!< \brief Iterations since the monitoring output was last flushed. */
+
   bool cauchyTimeConverged; /*! \brief: Flag indicating that solver is already converged. Needed for writing restart files. */
 
+  /*--- State of the physical output trigger (OUTPUT_TRIGGER_FIELD), which temporarily
+   raises the volume output frequency when the monitored history field changes fast. ---*/
+
+  su2double triggerFieldOldValue = 0.0;   /*!< \brief Monitored field value at the previous evaluation. */
+  bool triggerFieldOldValid = false;      /*!< \brief The previous value (and hence the change) is available. */
+  bool triggerFieldMissing = false;       /*!< \brief The monitored field does not exist, warn once and disable. */
+  unsigned long triggerActiveUntil = 0;   /*!< \brief Last iteration covered by the raised frequency. */
+  bool triggerEverFired = false;          /*!< \brief The trigger fired at least once (activeUntil is meaningful). */
+
   /** \brief Enum to identify the screen output format. */
   enum class ScreenOutputFormat {
     INTEGER,         /*!< \brief Integer format. Example: 34 */
@@ -159,6 +177,45 @@ protected:
   std::vector<const su2double*> requestedHistoryFieldCache;
   std::vector<const HistoryOutputField*> requestedScreenFieldCache;
 
+  /*! \brief Table translating integer field handles to history output fields. Handles are
+   *  resolved once at preprocessing (::GetHistoryFieldHandle), the per-iteration setters
+   *  then index this table instead of hashing string keys into ::historyOutput_Map. */
+  std::vector<HistoryOutputField*> historyFieldHandles;
+
+  /*! \brief Integer handles of the common history fields, resolved once at preprocessing. */
+  struct {
+    int timeIter = -1, outerIter = -1, innerIter = -1, curTime = -1,
+        timeStep = -1, wallTime = -1, nonphysicalPoints = -1;
+  } commonFieldHandles;
+
+  /*! \brief Precomputed link from a registered field to its derived fields (relative
+   *  residual, group average, time average, derivatives), so that ::Postprocess_HistoryData
+   *  does not rebuild string keys and map lookups every iteration. */
+  struct DerivedFieldLink {
+    HistoryOutputField* field = nullptr;      /*!< \brief The registered field itself. */
+    HistoryOutputField* relField = nullptr;   /*!< \brief REL_ field (residuals). */
+    su2double* initResidual = nullptr;        /*!< \brief Entry of ::initialResiduals (residuals). */
+    short avgGroup = -1;                      /*!< \brief Index into ::avgGroupFields (residuals), -1 if no AVG_ field. */
+    HistoryOutputField* tavgField = nullptr;  /*!< \brief TAVG_ field (coefficients, time domain). */
+    HistoryOutputField* dField = nullptr;     /*!< \brief D_ field (coefficients, direct differentiation). */
+    HistoryOutputField* dtavgField = nullptr; /*!< \brief D_TAVG_ field (coefficients, both). */
+    CWindowedAverage* timeAverage = nullptr;  /*!< \brief Windowed time average (coefficients, time domain). */
+  };
+  std::vector<DerivedFieldLink> derivedFieldLinks;
+  /*! \brief AVG_ fields of the residual groups, in the order referenced by DerivedFieldLink::avgGroup. */
+  std::vector<HistoryOutputField*> avgGroupFields;
+  /*! \brief Whether ::derivedFieldLinks has been built (on the first call of ::Postprocess_HistoryData). */
+  bool derivedFieldLinksReady = false;
+
+  /*! \brief Whether only the requested history groups and their dependencies are evaluated. */
+  bool lazyHistoryEval;
+  /*! \brief Evaluation frequency of requested history groups in lazy mode (inner iterations). */
+  unsigned long historyEvalFreq;
+  /*! \brief Groups that must be evaluated every iteration (convergence monitoring, objectives, running averages). */
+  std::set<string> neededHistoryGroups;
+  /*! \brief Groups that only feed the screen and history file and may be evaluated at ::historyEvalFreq. */
+  std::set<string> requestedHistoryGroups;
+
   PrintingToolbox::CTablePrinter* convergenceTable;     //!< Convergence  output table structure
   PrintingToolbox::CTablePrinter* multiZoneHeaderTable; //!< Multizone header output structure
   PrintingToolbox::CTablePrinter* historyFileTable;     //!< Table structure for writing to history file
@@ -169,6 +226,15 @@ protected:
   //! Structure to store the value of the running averages
   map<string, CWindowedAverage> windowedTimeAverages;
 
+  //! Probe sampler (point time histories), created on first use when PROBE_LOCATIONS is set.
+  std::unique_ptr<CProbeOutput> probeOutput;
+
+  //! Acoustic surface sampler, created on first use when ACOUSTIC_MARKERS is set.
+  std::unique_ptr<CAcousticOutput> acousticOutput;
+
+  //! Global number of points of the problem, cached for the performance record.
+  unsigned long nDOFGlobal = 0;
+
   //! Structure to store the value initial residuals for relative residual computation
   std::map<string, su2double> initialResiduals;
 
@@ -189,8 +255,23 @@ protected:
    /*----------------------------- Volume output ----------------------------*/
 
    CParallelDataSorter* volumeDataSorter;    //!< Volume data sorter
+   CParallelDataSorter* regionDataSorter;    //!< Region-of-interest data sorter for the volume visualization files
    CParallelDataSorter* surfaceDataSorter;   //!< Surface data sorter
 
+   /*--- Sorted results are shared by all writers of one snapshot (sort once,
+    write many), the flags below track what the sorters currently hold and are
+    invalidated whenever new data is loaded, see ::InvalidateSortedData(). ---*/
+
+   short volumeConnSortedFor;   //!< val_sort of the current volume connectivity (-1 if not sorted for this snapshot)
+   short regionConnSortedFor;   //!< val_sort of the current region connectivity (-1 if not sorted for this snapshot)
+   bool surfaceDataSorted;      //!< Whether the surface sorter holds the current snapshot
+   bool regionDataSorted;       //!< Whether the region sorter holds the current snapshot
+
+   std::thread asyncWriteThread;    //!< Thread writing the volume files while the solver continues iterating
+   SU2_MPI::Comm outputFileComm;    //!< Communicator handed to the file writers, a duplicate of the global one in async mode
+   bool outputFileCommDuplicated;   //!< Whether ::outputFileComm was duplicated and has to be freed
+   passivedouble curTimeStamp;      //!< Physical time of the current snapshot, captured before the history advances
+
    vector<string> volumeFieldNames;     //!< Vector containing the volume field names
    unsigned short nVolumeFields;        /*!< \brief Number of fields in the volume output */
 
@@ -296,6 +377,13 @@ public:
    */
   void Load_Data(CGeometry *geometry, CConfig *config, CSolver **solver_container);
 
+  /*!
+   * \brief Get the volume data sorter, which gives zero-copy access to the sorted solution
+   * data and connectivity, e.g. for in-situ analysis libraries. Valid after ::Load_Data.
+   * \return Pointer to the volume data sorter, nullptr until the sorters are allocated.
+   */
+  CParallelDataSorter* GetVolumeDataSorter() { return volumeDataSorter; }
+
   /*!
    * \brief Preprocess the history output by setting the history fields and opening the history file.
    * \param[in] config - Definition of the particular problem.
@@ -472,6 +560,17 @@ public:
    */
   void PrintConvergenceSummary();
 
+  /*!
+   * \brief Write any buffered screen lines to the terminal and flush the history file.
+   */
+  void FlushMonitoringOutput();
+
+  /*!
+   * \brief Configure the deferred flushing of screen and history file output.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void SetDeferredMonitoring(const CConfig *config);
+
   /*!
    * \brief Get convergence of the problem.
    * \return Boolean indicating whether the problem is converged.
@@ -514,6 +613,13 @@ public:
   bool SetResult_Files(CGeometry *geometry, CConfig *config, CSolver** solver_container,
                        unsigned long iter, bool force_writing = false);
 
+  /*!
+   * \brief Append a machine-readable performance record of this run to a JSON-lines file,
+   * keyed by the config hash and code version so runs can be compared across cases and releases.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void WritePerformanceRecord(const CConfig *config);
+
   /*!
    * \brief Get convergence time convergence of the specified windowed-time-averaged ouput of the problem.
    *        Delays solver stop, if Cauchy time convergence criterion is fullfilled, but 2nd order
@@ -590,6 +696,38 @@ protected:
     }
   }
 
+  /*!
+   * \brief Resolve the integer handle of a history output field. To be called once at
+   *  preprocessing (after the field is registered), the handle then gives constant-time
+   *  access to the field without hashing the string key every iteration.
+   * \param[in] name - Name of the field.
+   * \return Integer handle of the field, or -1 if no field with this name exists.
+   */
+  inline int GetHistoryFieldHandle(const string& name){
+    auto it = historyOutput_Map.find(name);
+    if (it == historyOutput_Map.end()) return -1;
+    historyFieldHandles.push_back(&it->second);
+    return static_cast<int>(historyFieldHandles.size()) - 1;
+  }
+
+  /*!
+   * \brief Set the value of a history output field via its integer handle.
+   * \param[in] handle - Handle of the field, resolved with ::GetHistoryFieldHandle.
+   * \param[in] value - The new value of this field.
+   */
+  inline void SetHistoryOutputValue(int handle, su2double value){
+    historyFieldHandles[handle]->value = value;
+  }
+
+  /*!
+   * \brief Get the value of a history output field via its integer handle.
+   * \param[in] handle - Handle of the field, resolved with ::GetHistoryFieldHandle.
+   * \return Value of the field.
+   */
+  inline su2double GetHistoryFieldValue(int handle) const {
+    return historyFieldHandles[handle]->value;
+  }
+
   /*!
    * \brief Add a new field per surface marker to the history output.
    * \param[in] name - Name for referencing it (in the config file and in the code).
@@ -676,6 +814,23 @@ protected:
    */
   void CheckHistoryOutput();
 
+  /*!
+   * \brief Determine which history output groups must be evaluated every iteration and which
+   * ones only feed the screen and history file, for lazy history output.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void SetHistoryGroupsNeeded(const CConfig *config);
+
+  /*!
+   * \brief Check whether a history output group has to be evaluated on the current iteration.
+   * Always true unless lazy history output is enabled, in which case groups that are not
+   * requested are skipped and requested ones are refreshed at the evaluation frequency and
+   * whenever screen or history file output is written.
+   * \param[in] group - Name of the history output group.
+   * \param[in] config - Definition of the particular problem.
+   */
+  bool HistoryGroupNeeded(const string& group, const CConfig *config);
+
   /*!
    * \brief Open the history file and write the header.
    * \param[in] config - Definition of the particular problem.
@@ -696,6 +851,13 @@ protected:
    */
   void Postprocess_HistoryData(CConfig *config);
 
+  /*!
+   * \brief Restore the state of the windowed-time averages from the metadata file of the restart iteration,
+   * so that the statistics of a previous run continue seamlessly instead of starting from scratch.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void LoadWindowedTimeAverages(CConfig *config);
+
   /*!
    * \brief Postprocess_HistoryFields
    * \param[in] config - Definition of the particular problem.
@@ -739,6 +901,55 @@ protected:
    */
   void AllocateDataSorters(CConfig *config, CGeometry *geometry);
 
+  /*!
+   * \brief Get the data sorter to use for a volume visualization file, with sorted connectivity.
+   * Returns the volume sorter, or the region-of-interest sorter if OUTPUT_ROI_BOX was set
+   * (allocating and sorting it if necessary).
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] val_sort - boolean controlling whether the elements are sorted or simply loaded by their owning rank.
+   * \return The data sorter the file writer should read from.
+   */
+  CParallelDataSorter* GetVizVolumeSorter(CConfig *config, CGeometry *geometry, bool val_sort);
+
+  /*!
+   * \brief Mark the sorted connectivity and surface/region data as stale, the next
+   * writer that needs them sorts again. Called whenever new volume data is loaded.
+   */
+  void InvalidateSortedData();
+
+  /*!
+   * \brief Sort the volume connectivity for the given element ordering, unless the
+   * sorter already holds it for this snapshot.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] val_sort - boolean controlling whether the elements are sorted or simply loaded by their owning rank.
+   */
+  void SortVolumeConnectivity(CConfig *config, CGeometry *geometry, bool val_sort);
+
+  /*!
+   * \brief Sort the surface connectivity and data, unless the sorter already holds
+   * them for this snapshot (several surface writers can share one sort).
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] geometry - Geometrical definition of the problem.
+   */
+  void SortSurfaceData(CConfig *config, CGeometry *geometry);
+
+  /*!
+   * \brief Check whether the requested volume files can be written asynchronously, i.e. whether all
+   * requested formats write through the common MPI file routines and, with MPI, whether full thread
+   * support was requested (--thread_multiple).
+   * \param[in] config - Definition of the particular problem.
+   * \return <TRUE> if the volume files can be handed to the writer thread.
+   */
+  bool AsyncFileWritesPossible(const CConfig *config) const;
+
+  /*!
+   * \brief Wait until a volume file write that may still be in flight on the writer thread has
+   * finished and release the frozen data snapshot of the volume data sorter.
+   */
+  void WaitForAsyncFileWrites();
+
   /*!
    * \brief Computes the custom and combo objectives.
    * \note To be called after all other history outputs are set.
@@ -785,6 +996,16 @@ protected:
    */
   virtual bool WriteVolume_Output(CConfig *config, unsigned long Iter, bool force_writing, unsigned short iFile);
 
+  /*!
+   * \brief Evaluate the physical output trigger: fires when the monitored history field
+   *        changes by more than the threshold between iterations, and keeps the raised
+   *        output frequency for the hold interval afterwards.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] iter - Current iteration index.
+   * \return True if the trigger requests a volume output this iteration.
+   */
+  bool EvaluateOutputTrigger(CConfig *config, unsigned long iter);
+
   /*!
    * \brief Set the values of the volume output fields for a point.
    * \param[in] config - Definition of the particular problem.
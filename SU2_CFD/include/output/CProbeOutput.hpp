@@ -0,0 +1,92 @@
+/*!
+ * \file CProbeOutput.hpp
+ * \brief Headers of the probe output (point time histories).
+ * \version 7.3.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2022, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "../../../Common/include/basic_types/datatype_structure.hpp"
+
+class CConfig;
+class CGeometry;
+class CSolver;
+
+/*! \class CProbeOutput
+ *  \brief Samples the flow solution at fixed probe locations and appends the
+ *  time histories to a compact binary file, avoiding volume output for the
+ *  sole purpose of extracting point signals.
+ *
+ *  Each probe is resolved once to its containing element with an ADT search,
+ *  the interpolation weights are cached, and the owner ranks send their
+ *  interpolated values to the master rank which appends one record per sample.
+ *
+ *  File layout (little/big endian as written): header of 4 unsigned long
+ *  (magic number 535537, number of probes, number of variables, number of
+ *  dimensions) followed by the probe coordinates (nProbes x nDim doubles),
+ *  then one record of (1 + nProbes x nVar) doubles per sample, the first
+ *  value being the iteration number. Probes outside the domain record zeros.
+ */
+class CProbeOutput {
+ private:
+  int rank;                      /*!< \brief MPI rank. */
+  unsigned short nDim = 0;       /*!< \brief Number of spatial dimensions. */
+  unsigned short nVar = 0;       /*!< \brief Number of sampled variables (flow solution variables). */
+  unsigned long nProbes = 0;     /*!< \brief Number of probes. */
+  std::string fileName;          /*!< \brief Name of the binary output file. */
+  bool fileReady = false;        /*!< \brief Whether the file has been created (or opened for append). */
+
+  /*! \brief Cached interpolation stencil of a probe on its owner rank. */
+  struct Probe {
+    bool owned = false;             /*!< \brief Whether this rank interpolates the probe. */
+    unsigned short nNodes = 0;      /*!< \brief Number of nodes of the containing element. */
+    unsigned long nodes[8] = {0};   /*!< \brief Point indices of the containing element. */
+    su2double weights[8] = {0.0};   /*!< \brief Interpolation weights, aligned with ::nodes. */
+  };
+  std::vector<Probe> probes;
+
+  /*!
+   * \brief Create the output file and write the header, or open it for append on a restart.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void PrepareFile(const CConfig* config);
+
+ public:
+  /*!
+   * \brief Constructor, resolves the probe locations to containing elements and caches the weights.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  CProbeOutput(CGeometry* geometry, const CConfig* config);
+
+  /*!
+   * \brief Sample the flow solution at the probes and append one record to the output file.
+   * \param[in] solver - The container holding all solution data.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] iter - Current iteration (time iteration for unsteady problems).
+   */
+  void Sample(CSolver** solver, const CConfig* config, unsigned long iter);
+};
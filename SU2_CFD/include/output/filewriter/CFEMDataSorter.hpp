@@ -58,8 +58,17 @@ public:
     return linearPartitioner.GetFirstIndexOnRank(rank) + iPoint;
   }
 
+  /*!
+   * \brief Get the high-order element records of the owned elements.
+   * \return Pointer to the element records, four entries per element.
+   */
+  const vector<unsigned long>* GetHighOrderElemInfo() const override { return &highOrderElemInfo; }
+
 private:
 
+  vector<unsigned long> highOrderElemInfo;  /*!< \brief Per owned element: VTK type, solution polynomial
+                                                        degree, number of solution DOFs, global DOF offset. */
+
 
   /*!
    * \brief Sort the connectivity for a single volume element type into a linear partitioning across all processors.
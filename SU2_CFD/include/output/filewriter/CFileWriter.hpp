@@ -51,6 +51,11 @@ protected:
    */
   int size;
 
+  /*!
+   * \brief The communicator used to open and write the file, the global communicator by default.
+   */
+  SU2_MPI::Comm fileComm;
+
   /*!
    * \brief The file extension to be attached to the filename.
    */
@@ -78,6 +83,11 @@ protected:
    */
   CParallelDataSorter* dataSorter;
 
+  /*!
+   * \brief Whether the output is funneled through one writer rank per node.
+   */
+  bool aggregateOutput = false;
+
 #ifdef HAVE_MPI
   /*!
    * \brief The displacement that every process has in the current file view
@@ -88,6 +98,21 @@ protected:
    * \brief The file handle for writing
    */
   MPI_File fhw;
+
+  /*!
+   * \brief Whether this rank performs the file writes, always true without aggregation.
+   */
+  bool isWriter = true;
+
+  /*!
+   * \brief Node-local communicator used to funnel the data to the writer of the node.
+   */
+  MPI_Comm nodeComm = MPI_COMM_NULL;
+
+  /*!
+   * \brief Communicator of the writer ranks that access the filesystem.
+   */
+  MPI_Comm writerComm = MPI_COMM_NULL;
 #else
 
   /*!
@@ -115,6 +140,20 @@ public:
    */
   virtual ~CFileWriter();
 
+  /*!
+   * \brief Set the communicator used to open and write the file, e.g. a duplicate of the global
+   * communicator when the file is written asynchronously while the solver keeps communicating.
+   * \param[in] valComm - The communicator for the file I/O.
+   */
+  void SetComm(SU2_MPI::Comm valComm) {fileComm = valComm;}
+
+  /*!
+   * \brief Enable or disable node-level output aggregation, i.e. funneling the data to
+   * one writer rank per node such that only the writers access the filesystem.
+   * \param[in] valAggregate - Whether to aggregate the output.
+   */
+  void SetAggregation(bool valAggregate) {aggregateOutput = valAggregate;}
+
   /*!
    * \brief Write sorted data to file
    * \param[in] val_filename - The name of the file
@@ -149,6 +188,21 @@ protected:
    */
   bool WriteMPIBinaryDataAll(const void *data, unsigned long sizeInBytes, unsigned long totalSizeInBytes, unsigned long offset);
 
+#ifdef HAVE_MPI
+  /*!
+   * \brief Write a distributed binary data array by funneling it to the writer rank of each node,
+   * such that only the writers access the filesystem. The file layout is identical to the
+   * collective version.
+   * \param[in] data - Pointer to the data to write.
+   * \param sizeInBytes - The size of the data in bytes on this processor.
+   * \param totalSizeInBytes - The total size of the array accumulated over all processors.
+   * \param offsetInBytes - The offset in bytes of the chunk of data the current processor owns within the global array.
+   * \return Boolean indicating whether the writing was successful.
+   */
+  bool WriteMPIBinaryDataAggregated(const void *data, unsigned long sizeInBytes,
+                                    unsigned long totalSizeInBytes, unsigned long offsetInBytes);
+#endif
+
   /*!
    * \brief Write a binary data array to a currently opened file using MPI I/O. Note: routine must be called collectively,
    * although only one processor writes its data.
@@ -175,6 +229,15 @@ protected:
    */
   bool OpenMPIFile(string val_filename);
 
+  /*!
+   * \brief Open a file to append to using MPI I/O. An already existing file is
+   *  kept and the writing continues behind its current end.
+   * \param[in] val_filename - The name of the file
+   * \param[out] existingSize - Size in bytes the file had before opening, zero for a new file.
+   * \return Boolean indicating whether the opening was successful.
+   */
+  bool OpenMPIFileAppend(string val_filename, unsigned long &existingSize);
+
   /*!
    * \brief Close a file using MPI I/O.
    * \return Boolean indicating whether the closing was successful.
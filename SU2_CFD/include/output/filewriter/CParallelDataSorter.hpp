@@ -82,10 +82,10 @@ protected:
     }
   } TypeMap;
 
-  unsigned long nPointsGlobal;   //!< Global number of points without halos
+  mutable unsigned long nPointsGlobal;   //!< Global number of points without halos (mutable for the lazy sort completion)
   unsigned long nElemGlobal;    //!< Global number of elems without halos
   unsigned long nConnGlobal;    //!< Global size of the connectivity array
-  unsigned long nPoints;    //!< Local number of points
+  mutable unsigned long nPoints;    //!< Local number of points (mutable for the lazy sort completion)
   unsigned long nElem;     //!< Local number of elements
   unsigned long nConn;     //!< Local size of the connectivity array
 
@@ -103,11 +103,38 @@ protected:
   int *nElemConn_Cum;                  //!< Cumulative number of element connectivity entries
   unsigned long *Index;                //!< Index each point has in the send buffer
   passivedouble *connSend;             //!< Send buffer holding the data that will be send to other processors
-  passivedouble *dataBuffer;           //!< Buffer holding the sorted, partitioned data as passivedouble types
+  mutable passivedouble *dataBuffer;   //!< Buffer holding the sorted, partitioned data as passivedouble types (mutable for the lazy sort completion)
+  passivedouble *dataBufferSnapshot;   //!< Frozen copy of the sorted data for asynchronous file writes
+  unsigned long snapshotSize;          //!< Allocated size of the snapshot buffer
+  const passivedouble *dataView;       //!< While a snapshot is active the data accessors read from it instead of ::dataBuffer
+  passivedouble *deltaBaseBuffer;      //!< Previously written data, reference for delta-encoded snapshots
+  unsigned long deltaBaseSize;         //!< Allocated size of the delta reference buffer
+  unsigned long nSnapshotsWritten;     //!< Number of snapshots written from this sorter, drives the keyframe cadence
   unsigned long *idSend;               //!< Send buffer holding global indices that will be send to other processors
   int nSends,                          //!< Number of sends
   nRecvs;                              //!< Number of receives
 
+  /*--- The completion of an in-flight redistribution is triggered lazily by the (const)
+   consumers of the sorted data, hence the overlap state is mutable. ---*/
+
+  mutable bool sortOngoing;                    //!< A redistribution started by ::InitiateSortOutputData has not been completed yet
+  mutable vector<unsigned long> idRecv;        //!< Receive buffer for the global indices, alive while a redistribution is in flight
+  mutable passivedouble *dataScratch;          //!< Scratch buffer for the partition-order reorder, swapped with ::dataBuffer
+  unsigned long connSendSize;          //!< Allocated size of ::connSend, kept to reallocate a released buffer
+  unsigned long dataBufferSize;        //!< Allocated size of ::dataBuffer, kept to reallocate a released buffer
+  bool transientBuffers;               //!< Release the field data buffers between outputs instead of keeping them resident
+  vector<int> sendCount,               //!< Send counts (in buffer entries) of the data redistribution
+  sendDispl,                           //!< Send displacements of the data redistribution
+  recvCount,                           //!< Receive counts of the data redistribution
+  recvDispl,                           //!< Receive displacements of the data redistribution
+  idSendCount,                         //!< Send counts of the global index redistribution
+  idSendDispl,                         //!< Send displacements of the global index redistribution
+  idRecvCount,                         //!< Receive counts of the global index redistribution
+  idRecvDispl;                         //!< Receive displacements of the global index redistribution
+#ifdef HAVE_MPI
+  mutable MPI_Request sortRequest[2];  //!< Requests of the non-blocking data and global index all-to-alls
+#endif
+
   vector<string> fieldNames;           //!< Vector with names of the output fields
 
   unsigned short nDim;                 //!< Spatial dimension of the data
@@ -139,6 +166,20 @@ public:
    */
   virtual void SortOutputData();
 
+  /*!
+   * \brief Start the non-blocking redistribution of the output data into the linear partitioning.
+   * Independent work (e.g. sorting the connectivity) can be done while the data is in flight,
+   * ::CompleteSortOutputData must be called before the sorted data is accessed.
+   */
+  void InitiateSortOutputData();
+
+  /*!
+   * \brief Finish a redistribution started by ::InitiateSortOutputData and reorder the received
+   * data into partition order. No-op if no redistribution is in flight. Const because it is
+   * called lazily by the consumers of the sorted data.
+   */
+  void CompleteSortOutputData() const;
+
   /*!
    * \brief Sort the connectivities (volume and surface) into data structures.
    * \param[in] config - Definition of the particular problem.
@@ -248,6 +289,15 @@ public:
    */
   unsigned long GetElem_Connectivity(GEO_TYPE type, unsigned long iElem, unsigned long iNode) const ;
 
+  /*!
+   * \brief Get the pointer to the sorted connectivity of an element type, e.g. for zero-copy
+   * access by in-situ analysis libraries. The array holds ::GetnElem(type) elements with
+   * their global (1-based) node IDs stored consecutively.
+   * \input type - The type of element, ref GEO_TYPE
+   * \return Pointer to the connectivity of the element type, nullptr if there are no such elements.
+   */
+  const int *GetConnectivityBuffer(GEO_TYPE type) const;
+
   /*!
    * \brief Beginning node ID of the linear partition owned by a specific processor.
    * \input rank - the processor rank.
@@ -262,7 +312,7 @@ public:
    * \param rank - the processor rank.
    * \return The ending node ID.
    */
-  unsigned long GetNodeEnd(unsigned short rank) const {
+  virtual unsigned long GetNodeEnd(unsigned short rank) const {
     return linearPartitioner.GetLastIndexOnRank(rank);
   }
 
@@ -272,13 +322,68 @@ public:
    * \input iPoint - the point ID.
    * \return the value of the data field at a point.
    */
-  passivedouble GetData(unsigned short iField, unsigned long iPoint) const  {return dataBuffer[iPoint*GlobalField_Counter + iField];}
+  passivedouble GetData(unsigned short iField, unsigned long iPoint) const  {return GetData()[iPoint*GlobalField_Counter + iField];}
 
   /*!
    * \brief Get the pointer to the sorted linear partitioned data.
-   * \return Pointer to the sorted data.
+   * \return Pointer to the sorted data (the frozen snapshot while one is active).
    */
-  const passivedouble *GetData() const {return dataBuffer;}
+  const passivedouble *GetData() const {return (dataView != nullptr) ? dataView : dataBuffer;}
+
+  /*!
+   * \brief Freeze a copy of the sorted data in a second buffer, so that the data accessors keep
+   * returning the current solution while ::SortOutputData is called again for a later iteration.
+   * Used to overlap asynchronous file writes with the solver.
+   */
+  void SnapshotData();
+
+  /*!
+   * \brief Release the frozen snapshot, the data accessors read the live buffer again.
+   */
+  void ReleaseSnapshot() {dataView = nullptr;}
+
+  /*!
+   * \brief Enable releasing the field data buffers between outputs, so that they are
+   * not kept resident for the whole run.
+   * \param[in] val_transient - If true, ::ReleaseDataBuffers frees the buffers.
+   */
+  void SetTransientBuffers(bool val_transient) {transientBuffers = val_transient;}
+
+  /*!
+   * \brief Reallocate the field data buffers if they were released after a previous output.
+   * No-op while the buffers are allocated.
+   */
+  void AllocateDataBuffers();
+
+  /*!
+   * \brief Free the field data buffers until the next output. No-op unless transient
+   * buffers were enabled with ::SetTransientBuffers.
+   */
+  void ReleaseDataBuffers();
+
+  /*!
+   * \brief Get the data of the previously written snapshot, the reference frame
+   * for delta-encoded output.
+   * \return Pointer to the reference data, nullptr until ::UpdateDeltaBase has been called.
+   */
+  const passivedouble *GetDeltaBase() const {return deltaBaseBuffer;}
+
+  /*!
+   * \brief Store a full-precision copy of the current data as the reference for
+   * the next delta-encoded snapshot. Called by the file writer after each write.
+   */
+  void UpdateDeltaBase();
+
+  /*!
+   * \brief Get the number of snapshots written from this sorter.
+   * \return Number of writes counted via ::CountSnapshotWrite.
+   */
+  unsigned long GetnSnapshotsWritten() const {return nSnapshotsWritten;}
+
+  /*!
+   * \brief Count a snapshot write, used by the file writer for the keyframe cadence.
+   */
+  void CountSnapshotWrite() {nSnapshotsWritten++;}
 
   /*!
    * \brief Get the global index of a point.
@@ -348,6 +453,14 @@ public:
     return nDim;
   }
 
+  /*!
+   * \brief Get the high-order element records of the owned elements (element type,
+   * solution polynomial degree, number of solution DOFs, and global solution DOF
+   * offset per element), only available for FEM data sorters.
+   * \return Pointer to the element records, or nullptr for node-based (FVM) sorters.
+   */
+  virtual const vector<unsigned long>* GetHighOrderElemInfo() const { return nullptr; }
+
   /*!
    * \brief Set the total number of elements after sorting individual element types
    */
@@ -27,6 +27,8 @@
 
 #pragma once
 
+#include <set>
+
 #include "CFileWriter.hpp"
 #include "../../../../Common/include/CConfig.hpp"
 
@@ -74,6 +76,22 @@ class CParaviewVTMFileWriter final: public CFileWriter{
    */
   su2double accumulatedBandwidth;
 
+  /*!
+   * \brief Metadata blocks collected per vtm file until all zones have contributed
+   */
+  static map<string, string> pendingBlocks;
+
+  /*!
+   * \brief Folders that have already been created, to skip redundant mkdir calls
+   */
+  static set<string> createdFolders;
+
+  /*!
+   * \brief Create a folder, unless a previous call already created it
+   * \param[in] name - The name of the folder
+   */
+  static void CreateFolder(const string& name);
+
 public:
 
   /*!
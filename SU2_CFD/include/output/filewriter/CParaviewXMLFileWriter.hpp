@@ -28,6 +28,7 @@
 #pragma once
 
 #include "CFileWriter.hpp"
+#include <map>
 
 class CParaviewXMLFileWriter final: public CFileWriter{
 
@@ -47,11 +48,48 @@ private:
    */
   bool bigEndian;
 
+  /*!
+   * \brief Whether the appended data sections are compressed with zlib
+   */
+  bool compressed;
+
   /*!
    * \brief The current data offset that is used to find data in the binary blob at the end of the file
    */
   unsigned long dataOffset;
 
+  /*!
+   * \brief Uncompressed size of the compression blocks, the value used by the VTK library.
+   */
+  static constexpr unsigned long compressionBlockSize = 32768;
+
+  /*!
+   * \brief A data array compressed in blocks, in the format paraview expects for appended data,
+   * i.e. a header (number of blocks, block size, partial size of the last block, compressed
+   * size of each block) followed by the concatenated compressed blocks.
+   */
+  struct CompressedDataArray {
+    vector<unsigned long> header;     /*!< \brief Block header, identical on all ranks. */
+    vector<unsigned char> data;       /*!< \brief Compressed blocks owned by this rank. */
+    unsigned long totalCompressedSize; /*!< \brief Sum of the compressed block sizes over all ranks. */
+    unsigned long writeOffset;        /*!< \brief Offset of this rank's blocks in the compressed stream. */
+  };
+
+  /*!
+   * \brief Compressed arrays staged for writing, in the order they appear in the file.
+   */
+  vector<CompressedDataArray> compressedArrays;
+
+  /*!
+   * \brief Index of the array whose header info is written next (compressed mode only).
+   */
+  unsigned long currentArray;
+
+  /*!
+   * \brief The time steps and file names written so far for each time series (.pvd) collection.
+   */
+  static map<string, vector<pair<passivedouble, string> > > timeSeries;
+
 public:
 
   /*!
@@ -69,8 +107,9 @@ public:
   /*!
    * \brief Construct a file writer using field names and the data sorter.
    * \param[in] valDataSorter - The parallel sorted data to write
+   * \param[in] valCompressed - Compress the appended data sections with zlib.
    */
-  CParaviewXMLFileWriter(CParallelDataSorter* valDataSorter);
+  CParaviewXMLFileWriter(CParallelDataSorter* valDataSorter, bool valCompressed = false);
 
   /*!
    * \brief Destructor
@@ -82,8 +121,49 @@ public:
    */
   void Write_Data(string val_filename) override;
 
+  /*!
+   * \brief Add an entry to a time series (.pvd) collection file and rewrite it. The collection
+   * references the .vtu snapshots so paraview can animate them directly. Only the master node
+   * writes, the file is small as it only holds names and time values.
+   * \param[in] seriesName - Base name of the collection, the file is <seriesName>.pvd.
+   * \param[in] fileName - Name of the snapshot file, including extension.
+   * \param[in] timeValue - Physical time of the snapshot.
+   */
+  static void WriteTimeSeries(const string& seriesName, const string& fileName, passivedouble timeValue);
+
 private:
 
+  /*!
+   * \brief Write the XML part of the file, i.e. everything up to the start of the appended data.
+   * \param[in] myPoint - Number of points on this rank.
+   * \param[in] globalPoint - Global number of points.
+   * \param[in] myElem - Number of elements on this rank.
+   * \param[in] myElemStorage - Size of the connectivity on this rank.
+   * \param[in] globalElem - Global number of elements.
+   * \param[in] globalElemStorage - Global size of the connectivity.
+   */
+  void WriteXMLHeader(unsigned long myPoint, unsigned long globalPoint, unsigned long myElem,
+                      unsigned long myElemStorage, unsigned long globalElem, unsigned long globalElemStorage);
+
+  /*!
+   * \brief Write sorted data to file with zlib-compressed appended data sections.
+   */
+  void WriteDataCompressed(string val_filename);
+
+  /*!
+   * \brief Compress an array in blocks and stage it for writing (appends to compressedArrays).
+   * The global array is split in blocks of compressionBlockSize uncompressed bytes, the local
+   * data is redistributed such that block boundaries do not straddle ranks, and each block is
+   * deflated independently as paraview expects.
+   * \param[in] data - Pointer to the data
+   * \param[in] type - The vtk datatype
+   * \param[in] arraySize - The size of the array on this rank
+   * \param[in] globalSize - The global size of the array over all processors
+   * \param[in] offset - The entry this rank's chunk starts at within the global array
+   */
+  void CompressDataArray(const void *data, VTKDatatype type, unsigned long arraySize,
+                         unsigned long globalSize, unsigned long offset);
+
   /*!
    * \brief Add a new data array definition to the vtu file.
    * \param[in] type - The vtk datatype
@@ -0,0 +1,149 @@
+/*!
+ * \file CRegionFVMDataSorter.hpp
+ * \brief Headers for the region-of-interest datasorter for FVM solvers.
+ * \author T. Albring
+ * \version 7.3.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2022, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "CParallelDataSorter.hpp"
+#include "CFVMDataSorter.hpp"
+
+/*!
+ * \class CRegionFVMDataSorter
+ * \brief Extracts the subset of the sorted volume data inside a region-of-interest box,
+ * so that the volume visualization files only contain that region. Works analogous to
+ * the surface data sorters: the subset is built from the sorted data of the volume
+ * sorter, with the points renumbered contiguously.
+ */
+class CRegionFVMDataSorter final: public CParallelDataSorter{
+
+  const CFVMDataSorter* volumeSorter;  //!< Pointer to the volume sorter instance
+  passivedouble boxMin[3];             //!< Minimum corner of the region-of-interest box
+  passivedouble boxMax[3];             //!< Maximum corner of the region-of-interest box
+  vector<char> keepLocal;              //!< Flags of the points of the linear partition that are inside the region
+  vector<unsigned long> renumberOld;   //!< Original global index of each local renumbered point
+
+public:
+
+  /*!
+   * \brief Constructor
+   * \param[in] config - Pointer to the current config structure
+   * \param[in] geometry - Pointer to the current geometry
+   * \param[in] valVolumeSorter - The datasorter containing the sorted volume data
+   */
+  CRegionFVMDataSorter(CConfig *config, CGeometry* geometry, const CFVMDataSorter* valVolumeSorter);
+
+  /*!
+   * \brief Extract the points inside the region of interest from the sorted volume data.
+   * The volume sorter must be sorted before calling this function.
+   */
+  void SortOutputData() override;
+
+  /*!
+   * \brief Sort the connectivity of the elements inside the region of interest.
+   * ::SortOutputData must be called first, as it determines which points are kept.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] val_sort - boolean controlling whether the elements are sorted or simply loaded by their owning rank.
+   */
+  void SortConnectivity(CConfig *config, CGeometry *geometry, bool val_sort) override;
+
+  /*!
+   * \brief Get the original global index of a point.
+   * \param[in] iPoint - the local renumbered point ID.
+   * \return Global index of a specific point.
+   */
+  unsigned long GetGlobalIndex(unsigned long iPoint) const override {
+    return renumberOld[iPoint];
+  }
+
+  /*!
+   * \brief Get the beginning renumbered node ID of the partition owned by a specific processor.
+   * \param[in] rank - the processor rank.
+   * \return The beginning renumbered node ID.
+   */
+  unsigned long GetNodeBegin(unsigned short rank) const override {
+    return nPoint_Recv[rank];
+  }
+
+  /*!
+   * \brief Get the ending renumbered node ID of the partition owned by a specific processor.
+   * \param[in] rank - the processor rank.
+   * \return The ending renumbered node ID.
+   */
+  unsigned long GetNodeEnd(unsigned short rank) const override {
+    return nPoint_Recv[rank+1];
+  }
+
+  /*!
+   * \brief Get the cumulated number of points
+   * \param[in] rank - the processor rank.
+   * \return The cumulated number of points up to certain processor rank.
+   */
+  unsigned long GetnPointCumulative(unsigned short rank) const override {
+    return nPoint_Recv[rank];
+  }
+
+  /*!
+   * \brief Get the Processor ID a Point belongs to.
+   * \param[in] iPoint - global renumbered ID of the point.
+   * \return The rank/processor number.
+   */
+  unsigned short FindProcessor(unsigned long iPoint) const override {
+
+    for (unsigned short iRank = 1; iRank < size; iRank++){
+      if (nPoint_Recv[iRank] > static_cast<int>(iPoint)){
+        return iRank - 1;
+      }
+    }
+    return size-1;
+  }
+
+private:
+
+  /*!
+   * \brief Check whether a point is inside the region-of-interest box.
+   * \param[in] coord - Coordinates of the point.
+   * \return <TRUE> if the point is inside the box.
+   */
+  bool InsideRegion(const passivedouble* coord) const {
+    for (unsigned short iDim = 0; iDim < nDim; iDim++)
+      if ((coord[iDim] < boxMin[iDim]) || (coord[iDim] > boxMax[iDim])) return false;
+    return true;
+  }
+
+  /*!
+   * \brief Sort the connectivity of the elements of one type that are inside the region of interest.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] Elem_Type - VTK index of the element type being merged.
+   * \param[in] val_sort - boolean controlling whether the elements are sorted or simply loaded by their owning rank.
+   * \param[in] keepGlobal - Region flags of all points of the mesh.
+   * \param[in] newGlobalIndex - Functor mapping an original global index to the renumbered index.
+   */
+  void SortVolumetricConnectivity(CConfig *config, CGeometry *geometry, unsigned short Elem_Type, bool val_sort,
+                                  const vector<char>& keepGlobal, const vector<unsigned long>& regionOffset);
+
+};
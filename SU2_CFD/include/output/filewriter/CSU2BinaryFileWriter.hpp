@@ -30,6 +30,10 @@
 
 class CSU2BinaryFileWriter final: public CFileWriter{
 
+  bool singlePrec;             /*!< \brief Write the data in single precision (except keyframes). */
+  bool deltaMode;              /*!< \brief Delta-encode the data w.r.t. the previous write (except keyframes). */
+  unsigned long keyframeFreq;  /*!< \brief Number of writes between full-precision keyframes. */
+  bool dualSnapshot;           /*!< \brief Append the previously written snapshot as a second data block. */
 
 public:
 
@@ -38,11 +42,25 @@ public:
    */
   const static string fileExt;
 
+  /*!
+   * \brief Bit flags stored in the file header to mark reduced snapshots.
+   */
+  enum SNAPSHOT_FLAGS : int {
+    FLAG_SINGLE_PRECISION = 1, /*!< \brief The data section holds float instead of passivedouble values. */
+    FLAG_DELTA = 2             /*!< \brief The data section holds differences w.r.t. the previously written file. */
+  };
+
   /*!
    * \brief Construct a file writer using field names and the data sorter.
    * \param[in] valDataSorter - The parallel sorted data to write
+   * \param[in] valSinglePrec - Write the data in single precision (except keyframes)
+   * \param[in] valDeltaMode - Delta-encode the data w.r.t. the previous write (except keyframes)
+   * \param[in] valKeyframeFreq - Number of writes between full-precision keyframes
+   * \param[in] valDualSnapshot - Append the previously written snapshot as a second data block
    */
-  CSU2BinaryFileWriter(CParallelDataSorter* valDataSorter);
+  CSU2BinaryFileWriter(CParallelDataSorter* valDataSorter, bool valSinglePrec = false,
+                       bool valDeltaMode = false, unsigned long valKeyframeFreq = 1,
+                       bool valDualSnapshot = false);
 
   /*!
    * \brief Destructor
@@ -30,6 +30,8 @@
 
 class CSU2FileWriter final: public CFileWriter{
 
+  bool compressed; /*!< \brief Gzip-compress the file, requires compilation with zlib. */
+
 public:
 
   /*!
@@ -40,8 +42,9 @@ public:
   /*!
    * \brief Construct a file writer using field names and the data sorter.
    * \param[in] valDataSorter - The parallel sorted data to write
+   * \param[in] valCompressed - Gzip-compress the file (".gz" is appended to the extension).
    */
-  CSU2FileWriter(CParallelDataSorter* valDataSorter);
+  CSU2FileWriter(CParallelDataSorter* valDataSorter, bool valCompressed = false);
 
   /*!
    * \brief Write sorted data to file in SU2 ASCII file format
@@ -0,0 +1,70 @@
+/*!
+ * \file CSU2HighOrderFileWriter.hpp
+ * \brief Headers for the SU2 high-order (element-collocated) restart file writer class.
+ * \version 7.3.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2022, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+#include "CFileWriter.hpp"
+
+/*!
+ * \class CSU2HighOrderFileWriter
+ * \brief Writer for the native high-order restart format of the FEM DG solver.
+ * The standard restart expands the solution DOFs of every high-order element
+ * into the nodes of linear subcells and stores the DOF coordinates alongside
+ * the data. This format instead stores one record per element (VTK type,
+ * solution polynomial degree, number of solution DOFs, global DOF offset)
+ * followed by the raw nodal solution coefficients, without coordinate columns.
+ * The coordinates and the collocation points are implied by the mesh and the
+ * standard elements, so restarts read with READ_HIGHORDER_RESTART are exact
+ * for the discretization stored in the file, and the reader can verify the
+ * element records against the mesh instead of silently misinterpreting the
+ * DOF data.
+ */
+class CSU2HighOrderFileWriter final: public CFileWriter{
+
+public:
+
+  /*!
+   * \brief File extension
+   */
+  const static string fileExt;
+
+  /*!
+   * \brief Magic number, the standard restart magic (535532) plus three.
+   */
+  const static int fileMagic = 535535;
+
+  /*!
+   * \brief Construct a file writer using field names and the data sorter.
+   * \param[in] valDataSorter - The parallel sorted FEM data to write
+   */
+  CSU2HighOrderFileWriter(CParallelDataSorter* valDataSorter);
+
+  /*!
+   * \brief Write sorted DOF data to file in the high-order restart format
+   * \param[in] filename - The filename to write
+   */
+  void Write_Data(string filename) override;
+
+};
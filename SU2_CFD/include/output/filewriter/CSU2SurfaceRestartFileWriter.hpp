@@ -0,0 +1,67 @@
+/*!
+ * \file CSU2SurfaceRestartFileWriter.hpp
+ * \brief Headers for the SU2 surface (sparse) restart file writer class.
+ * \version 7.3.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2022, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+#include "CFileWriter.hpp"
+
+/*!
+ * \class CSU2SurfaceRestartFileWriter
+ * \brief Writer for sparse restart files holding only the points adjacent to
+ * the plotted markers, in the layout of the surface data sorter. The format
+ * mirrors the SU2 binary restart file, but since the points are a sparse
+ * subset of the volume, every record carries the global point index as its
+ * first column (named Point_ID, like the ASCII restart). Workflows that only
+ * need surface state (acoustic sampling, load extraction) can restart from
+ * these files with READ_SURFACE_RESTART, the interior is then initialized
+ * from free-stream values.
+ */
+class CSU2SurfaceRestartFileWriter final: public CFileWriter{
+
+public:
+
+  /*!
+   * \brief File extension
+   */
+  const static string fileExt;
+
+  /*!
+   * \brief Magic number, the standard restart magic (535532) plus two.
+   */
+  const static int fileMagic = 535534;
+
+  /*!
+   * \brief Construct a file writer using field names and the data sorter.
+   * \param[in] valDataSorter - The parallel sorted surface data to write
+   */
+  CSU2SurfaceRestartFileWriter(CParallelDataSorter* valDataSorter);
+
+  /*!
+   * \brief Write sorted surface data to file in SU2 surface restart format
+   * \param[in] filename - The filename to write
+   */
+  void Write_Data(string filename) override;
+
+};
@@ -0,0 +1,72 @@
+/*!
+ * \file CSU2TimeSeriesFileWriter.hpp
+ * \brief Headers for the time series file writer class.
+ * \version 7.3.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2022, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+#include "CFileWriter.hpp"
+
+/*!
+ * \class CSU2TimeSeriesFileWriter
+ * \brief Appends the sorted data to a single growing binary file, one
+ *  fixed-size record per write. The file starts with the same header as the
+ *  SU2 binary restart format (magic number, counts, variable names), each
+ *  record holds the physical time and time iteration followed by the data of
+ *  all points. The fixed layout lets readers seek to any record from the
+ *  header alone, and high-frequency sampling does not scatter thousands of
+ *  small files over the filesystem.
+ */
+class CSU2TimeSeriesFileWriter final: public CFileWriter{
+
+  unsigned long timeIter;  /*!< \brief Time iteration the current write belongs to. */
+  passivedouble curTime;   /*!< \brief Physical time the current write belongs to. */
+
+public:
+
+  /*!
+   * \brief File extension
+   */
+  const static string fileExt;
+
+  /*!
+   * \brief Construct a file writer using field names and the data sorter.
+   * \param[in] valDataSorter - The parallel sorted data to write
+   * \param[in] valTimeIter - Time iteration the write belongs to
+   * \param[in] valTime - Physical time the write belongs to
+   */
+  CSU2TimeSeriesFileWriter(CParallelDataSorter* valDataSorter,
+                           unsigned long valTimeIter, passivedouble valTime);
+
+  /*!
+   * \brief Destructor
+   */
+  ~CSU2TimeSeriesFileWriter() override;
+
+  /*!
+   * \brief Append the sorted data as one record to the time series file.
+   * \param[in] filename - The filename to write
+   */
+  void Write_Data(string filename) override;
+
+};
@@ -33,6 +33,9 @@ class CSurfaceFVMDataSorter final: public CParallelDataSorter{
 
   const CFVMDataSorter* volumeSorter;               //!< Pointer to the volume sorter instance
   map<unsigned long,unsigned long> Renumber2Global; //! Structure to map the local sorted point ID to the global point ID
+  bool surfaceMapsCached = false;                   //!< The renumbering and communication schedule of the last sort are still valid
+  vector<unsigned long> surfIndex;                  //!< Indices of the local surface points in the sorted volume data, in renumbered order
+  vector<string> cachedMarkerList;                  //!< Markers the cached renumbering was built for
 public:
 
   /*!
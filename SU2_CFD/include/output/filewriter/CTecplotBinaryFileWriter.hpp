@@ -35,6 +35,7 @@ class CTecplotBinaryFileWriter final: public CFileWriter{
 
   unsigned long timeIter;  //!< Current value of the time iteration
   su2double timeStep;       //!< Current value of the time step
+  bool sharedGrid;          //!< Write the grid zones once to a shared grid file, and solution-only files per snapshot
 
 public:
 
@@ -48,9 +49,11 @@ public:
    * \param[in] valDataSorter - The parallel sorted data to write
    * \param[in] valTimeIter - The current time iteration
    * \param[in] valTimeStep - The current physical time step value
+   * \param[in] valSharedGrid - Write the grid zones to a shared grid file once, with solution-only files per snapshot
    */
   CTecplotBinaryFileWriter(CParallelDataSorter* valDataSorter,
-                           unsigned long valTimeIter, su2double valTimeStep);
+                           unsigned long valTimeIter, su2double valTimeStep,
+                           bool valSharedGrid = false);
 
   /*!
    * \brief Destructor
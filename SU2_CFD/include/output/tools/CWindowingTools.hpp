@@ -89,6 +89,31 @@ private:
    */
   inline su2double GetVal() const { return val; }
 
+  /*!
+   * \brief Returns the time iteration of the last sample added to the average.
+   */
+  inline unsigned long GetLastTimeIter() const { return lastTimeIter; }
+
+  /*!
+   * \brief Returns the stored samples of the instantaneous output (all samples for non-trivial windows, the last one for the square window).
+   */
+  inline const std::vector<su2double>& GetSamples() const { return values; }
+
+  /*!
+   * \brief Restores the averaging state saved by a previous run, so that the average continues seamlessly across a restart.
+   * \param valIn - windowed-time average at the end of the previous run
+   * \param lastIter - time iteration of the last sample added during the previous run
+   * \param samplesIn - stored samples of the previous run (contents of ::GetSamples())
+   */
+  inline void RestoreState(su2double valIn, unsigned long lastIter, std::vector<su2double>&& samplesIn) {
+    val = valIn;
+    lastTimeIter = lastIter;
+    values = std::move(samplesIn);
+    /*--- The cached sum is rebuilt from the samples (or from val, for the square
+     window) when the next sample is added, no need to restore it. ---*/
+    cachedSum = 0.0;
+  }
+
   /*!
    *\brief Resets the value of windowed-time average (of the instantaneous output) from starting time to the current time iteration to 0.
    */
@@ -38,6 +38,8 @@
  */
 class CAdjEulerSolver : public CSolver {
 protected:
+  static constexpr size_t MAXNDIM = 3;  /*!< \brief Max number of space dimensions, used in some static arrays. */
+  static constexpr size_t MAXNVAR = 5;  /*!< \brief Max number of adjoint variables (nDim+2), for static arrays. */
   su2double
   PsiRho_Inf,     /*!< \brief PsiRho variable at the infinity. */
   PsiE_Inf,       /*!< \brief PsiE variable at the infinity. */
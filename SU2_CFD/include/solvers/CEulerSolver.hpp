@@ -75,6 +75,10 @@ protected:
   vector<vector<su2double> > ActDisk_Fx; /*!< \brief Value of the actuator disk X component of the radial and tangential forces per Unit Area resultant. */
   vector<vector<su2double> > ActDisk_Fy; /*!< \brief Value of the actuator disk Y component of the radial and tangential forces per Unit Area resultant. */
   vector<vector<su2double> > ActDisk_Fz; /*!< \brief Value of the actuator disk Z component of the radial and tangential forces per Unit Area resultant. */
+  vector<su2activematrix> ActDisk_RadialLoad;       /*!< \brief Radial load table of each actuator disk marker (station radius, Fa, Ft, Fr). */
+  vector<vector<unsigned long> > ActDisk_Station;   /*!< \brief Radial station containing each vertex (precomputed interpolation support). */
+  vector<vector<su2double> > ActDisk_StationWeight; /*!< \brief Linear interpolation weight of each vertex inside its station. */
+  bool ActDisk_LoadsCached = false;                 /*!< \brief Whether the per-vertex variable loads are up to date (grid motion invalidates them). */
 
   su2double
   Total_CL_Prev = 0.0,        /*!< \brief Total lift coefficient for all the boundaries (fixed lift mode). */
@@ -225,6 +229,8 @@ protected:
 
   /*!
    * \brief Compute the undivided laplacian for the solution.
+   * \note The halo exchange of the Laplacian (UNDIVIDED_LAPLACIAN) is left to
+   *       the caller, so that the communication can be overlapped with other work.
    * \param[in] geometry - Geometrical definition of the problem.
    * \param[in] config - Definition of the particular problem.
    */
@@ -232,6 +238,8 @@ protected:
 
   /*!
    * \brief Compute the dissipation sensor for centered schemes.
+   * \note The halo exchange of the sensor (SENSOR) is left to the caller,
+   *       so that the communication can be overlapped with other work.
    * \param[in] geometry - Geometrical definition of the problem.
    * \param[in] config - Definition of the particular problem.
    */
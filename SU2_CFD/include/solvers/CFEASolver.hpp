@@ -86,6 +86,7 @@ protected:
 
 #ifdef HAVE_OMP
   vector<GridColor<> > ElemColoring;   /*!< \brief Element colors. */
+  vector<unsigned long> ElemTypeSortedIdx; /*!< \brief Element indices of each color, grouped by element type. */
   bool LockStrategy = false;           /*!< \brief Whether to use an OpenMP lock to guard updates of the Jacobian. */
   vector<omp_lock_t> UpdateLocks;      /*!< \brief Locks that may be used to protect accesses to CSysMatrix/Vector in element loops. */
 #else
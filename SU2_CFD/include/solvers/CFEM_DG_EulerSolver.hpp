@@ -169,6 +169,8 @@ protected:
                                                                        points for ADER-DG. */
 
   unsigned int sizeWorkArray;     /*!< \brief The size of the work array needed. */
+  vector<su2double> workArrayVec; /*!< \brief Persistent work array of size sizeWorkArray. It is allocated
+                                              once in the constructor instead of on every residual evaluation. */
 
   vector<su2double> TolSolADER;   /*!< \brief Vector, which stores the tolerances for the conserved
                                               variables in the ADER predictor step. */
@@ -180,9 +180,16 @@ class CFVMFlowSolverBase : public CSolver {
   vector<vector<su2double> > CPressure;         /*!< \brief Pressure coefficient for each boundary and vertex. */
   vector<vector<su2double> > CPressureTarget;   /*!< \brief Target Pressure coefficient for each boundary and vertex. */
   vector<vector<su2double> > YPlus;             /*!< \brief Yplus for each boundary and vertex. */
+  vector<vector<unsigned long> > OwnedVertices; /*!< \brief For each boundary, the vertices whose node is owned by this
+                                                            rank, so that the force integration can loop over them
+                                                            without testing the ownership of every vertex. */
   vector<vector<su2double> > UTau;                 /*!< \brief UTau for each boundary and vertex. */
   vector<vector<su2double> > EddyViscWall;         /*!< \brief Eddy viscosuty at the wall for each boundary and vertex. */
 
+  su2activematrix DualTimeResCache;  /*!< \brief Combination of the old time levels of the dual time source term,
+                                                 constant within a physical time step (static grids only). */
+  long DualTimeResCacheIter = -1;    /*!< \brief Time iteration the cached combination belongs to. */
+
   bool space_centered;       /*!< \brief True if space centered scheme used. */
   bool euler_implicit;       /*!< \brief True if euler implicit scheme used. */
   bool least_squares;        /*!< \brief True if computing gradients by least squares. */
@@ -248,6 +255,13 @@ class CFVMFlowSolverBase : public CSolver {
    */
   void AllocateTerribleLegacyTemporaryVariables();
 
+  /*!
+   * \brief Build the per-marker lists of vertices whose node is owned by this rank.
+   * \note The ownership of a point does not change during a run, the lists are
+   * built once and reused by the force integration routines.
+   */
+  void SetOwnedVertices(const CGeometry* geometry);
+
   /*!
    * \brief Communicate the initial solver state.
    */
@@ -352,64 +366,38 @@ class CFVMFlowSolverBase : public CSolver {
                                (config->GetTime_Marching() == TIME_MARCHING::DT_STEPPING_2ND);
     const su2double K_v = 0.25;
 
+    /*--- In explicit dual time the pseudo time step is limited by the physical
+     one. The limit can be applied directly in the main loop below, except on
+     the one iteration where the physical step is recomputed from the unsteady
+     CFL afterwards, in which case the separate clamp at the end is kept. ---*/
+
+    const bool clampDtLater = dual_time && !implicit && (Iteration == config->GetRestart_Iter()) &&
+                              (config->GetUnst_CFL() != 0.0) && (iMesh == MESH_0);
+    const bool clampDtInline = dual_time && !implicit && !clampDtLater;
+    const su2double Phys_Delta_Time = (2.0/3.0)*config->GetDelta_UnstTimeND();
+    const su2double Max_DeltaTime = config->GetMax_DeltaTime();
+
     /*--- Init thread-shared variables to compute min/max values.
      *    Critical sections are used for this instead of reduction
      *    clauses for compatibility with OpenMP 2.0 (Windows...). ---*/
 
     ompMasterAssignBarrier(Min_Delta_Time,1e30, Max_Delta_Time,0.0, Global_Delta_UnstTimeND,1e30);
 
-    /*--- Loop domain points. ---*/
-
-    SU2_OMP_FOR_DYN(omp_chunk_size)
-    for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint) {
-
-      /*--- Set maximum eigenvalues to zero. ---*/
-
-      nodes->SetMax_Lambda_Inv(iPoint,0.0);
-
-      if (viscous)
-        nodes->SetMax_Lambda_Visc(iPoint,0.0);
-
-      /*--- Loop over the neighbors of point i. ---*/
-
-      for (unsigned short iNeigh = 0; iNeigh < geometry->nodes->GetnPoint(iPoint); ++iNeigh)
-      {
-        auto jPoint = geometry->nodes->GetPoint(iPoint,iNeigh);
-
-        auto iEdge = geometry->nodes->GetEdge(iPoint,iNeigh);
-        auto Normal = geometry->edges->GetNormal(iEdge);
-        auto Area2 = GeometryToolbox::SquaredNorm(nDim, Normal);
-
-        /*--- Mean Values ---*/
-
-        su2double Mean_ProjVel = 0.5 * (nodes->GetProjVel(iPoint,Normal) + nodes->GetProjVel(jPoint,Normal));
-        su2double Mean_SoundSpeed = soundSpeed(*nodes, iPoint, jPoint) * sqrt(Area2);
-
-        /*--- Adjustment for grid movement ---*/
+    /*--- The boundary contributions are accumulated before the domain loop so
+     that the eigenvalues of each point are complete at the end of its
+     iteration there, which allows the time step to be computed in the same
+     pass while they are still in registers. Reset the eigenvalues of all
+     boundary points (of any type of marker, as only those are read back). ---*/
 
-        if (dynamic_grid) {
-          const su2double *GridVel_i = geometry->nodes->GetGridVel(iPoint);
-          const su2double *GridVel_j = geometry->nodes->GetGridVel(jPoint);
-
-          for (unsigned short iDim = 0; iDim < nDim; iDim++)
-            Mean_ProjVel -= 0.5 * (GridVel_i[iDim] + GridVel_j[iDim]) * Normal[iDim];
-        }
-
-        /*--- Inviscid contribution ---*/
-
-        su2double Lambda = fabs(Mean_ProjVel) + Mean_SoundSpeed;
-        nodes->AddMax_Lambda_Inv(iPoint,Lambda);
-
-        /*--- Viscous contribution ---*/
-
-        if (!viscous) continue;
-
-        Lambda = lambdaVisc(*nodes, iPoint, jPoint) * Area2;
-        nodes->AddMax_Lambda_Visc(iPoint, Lambda);
+    for (unsigned short iMarker = 0; iMarker < geometry->GetnMarker(); iMarker++) {
+      SU2_OMP_FOR_STAT(OMP_MIN_SIZE)
+      for (auto iVertex = 0ul; iVertex < geometry->GetnVertex(iMarker); iVertex++) {
+        auto iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+        nodes->SetMax_Lambda_Inv(iPoint,0.0);
+        if (viscous) nodes->SetMax_Lambda_Visc(iPoint,0.0);
       }
-
+      END_SU2_OMP_FOR
     }
-    END_SU2_OMP_FOR
 
     /*--- Loop boundary edges ---*/
 
@@ -457,28 +445,80 @@ class CFVMFlowSolverBase : public CSolver {
       }
     }
 
-    /*--- Each element uses their own speed, steady state simulation. ---*/
+    /*--- Loop domain points, fused with the time step computation.
+     Each element uses their own speed, steady state simulation. ---*/
     {
       /*--- Thread-local variables for min/max reduction. ---*/
       su2double minDt = 1e30, maxDt = 0.0;
 
-      SU2_OMP_FOR_(schedule(static,omp_chunk_size) SU2_NOWAIT)
-      for (auto iPoint = 0ul; iPoint < nPointDomain; iPoint++) {
+      SU2_OMP_FOR_(schedule(dynamic,omp_chunk_size) SU2_NOWAIT)
+      for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint) {
+
+        /*--- Start from the boundary contributions accumulated above. ---*/
+
+        const bool boundary = geometry->nodes->GetBoundary(iPoint);
+
+        su2double Lambda_Inv = boundary? nodes->GetMax_Lambda_Inv(iPoint) : su2double(0.0);
+        su2double Lambda_Visc = (viscous && boundary)? nodes->GetMax_Lambda_Visc(iPoint) : su2double(0.0);
+
+        /*--- Loop over the neighbors of point i. ---*/
+
+        for (unsigned short iNeigh = 0; iNeigh < geometry->nodes->GetnPoint(iPoint); ++iNeigh)
+        {
+          auto jPoint = geometry->nodes->GetPoint(iPoint,iNeigh);
+
+          auto iEdge = geometry->nodes->GetEdge(iPoint,iNeigh);
+          auto Normal = geometry->edges->GetNormal(iEdge);
+          auto Area2 = GeometryToolbox::SquaredNorm(nDim, Normal);
+
+          /*--- Mean Values ---*/
+
+          su2double Mean_ProjVel = 0.5 * (nodes->GetProjVel(iPoint,Normal) + nodes->GetProjVel(jPoint,Normal));
+          su2double Mean_SoundSpeed = soundSpeed(*nodes, iPoint, jPoint) * sqrt(Area2);
+
+          /*--- Adjustment for grid movement ---*/
+
+          if (dynamic_grid) {
+            const su2double *GridVel_i = geometry->nodes->GetGridVel(iPoint);
+            const su2double *GridVel_j = geometry->nodes->GetGridVel(jPoint);
+
+            for (unsigned short iDim = 0; iDim < nDim; iDim++)
+              Mean_ProjVel -= 0.5 * (GridVel_i[iDim] + GridVel_j[iDim]) * Normal[iDim];
+          }
+
+          /*--- Inviscid contribution ---*/
+
+          Lambda_Inv += fabs(Mean_ProjVel) + Mean_SoundSpeed;
+
+          /*--- Viscous contribution ---*/
+
+          if (!viscous) continue;
+
+          Lambda_Visc += lambdaVisc(*nodes, iPoint, jPoint) * Area2;
+        }
+
+        nodes->SetMax_Lambda_Inv(iPoint, Lambda_Inv);
+        if (viscous) nodes->SetMax_Lambda_Visc(iPoint, Lambda_Visc);
+
+        /*--- The eigenvalues of this point are now complete, compute its
+         time step while they are still in registers. ---*/
 
         su2double Vol = geometry->nodes->GetVolume(iPoint);
 
         if (Vol != 0.0) {
-          su2double Local_Delta_Time = nodes->GetLocalCFL(iPoint)*Vol / nodes->GetMax_Lambda_Inv(iPoint);
+          su2double Local_Delta_Time = nodes->GetLocalCFL(iPoint)*Vol / Lambda_Inv;
 
           if(viscous) {
-            su2double dt_visc = nodes->GetLocalCFL(iPoint)*K_v*Vol*Vol / nodes->GetMax_Lambda_Visc(iPoint);
+            su2double dt_visc = nodes->GetLocalCFL(iPoint)*K_v*Vol*Vol / Lambda_Visc;
             Local_Delta_Time = min(Local_Delta_Time, dt_visc);
           }
 
           minDt = min(minDt, Local_Delta_Time);
           maxDt = max(maxDt, Local_Delta_Time);
 
-          nodes->SetDelta_Time(iPoint, min(Local_Delta_Time, config->GetMax_DeltaTime()));
+          su2double dt = min(Local_Delta_Time, Max_DeltaTime);
+          if (clampDtInline) dt = min(dt, Phys_Delta_Time);
+          nodes->SetDelta_Time(iPoint, dt);
         }
         else {
           nodes->SetDelta_Time(iPoint,0.0);
@@ -531,6 +571,49 @@ class CFVMFlowSolverBase : public CSolver {
       END_SU2_OMP_MASTER
       SU2_OMP_BARRIER
 
+      /*--- One-time diagnostic of the spread of the stable local time steps, binned in
+       *    power-of-two classes of the global step (before it overwrites them below).
+       *    The resulting histogram measures the headroom a multi-rate integration would
+       *    have on this mesh. ---*/
+
+      if ((config->GetUnst_CFL() != 0.0) && (Iteration == config->GetRestart_Iter()) && (iMesh == MESH_0)) {
+        SU2_OMP_MASTER {
+          constexpr int NCLASS = 16;
+          unsigned long localCount[NCLASS] = {0}, globalCount[NCLASS] = {0};
+
+          for (auto iPoint = 0ul; iPoint < nPointDomain; iPoint++) {
+            const su2double ratio = nodes->GetDelta_Time(iPoint) / max(Min_Delta_Time, EPS);
+            int iClass = 0;
+            su2double bound = 2.0;
+            while ((iClass < NCLASS - 1) && (ratio >= bound)) {
+              iClass++;
+              bound *= 2.0;
+            }
+            localCount[iClass]++;
+          }
+          SU2_MPI::Reduce(localCount, globalCount, NCLASS, MPI_UNSIGNED_LONG, MPI_SUM,
+                          MASTER_NODE, SU2_MPI::GetComm());
+
+          if (rank == MASTER_NODE) {
+            unsigned long total = 0;
+            passivedouble work = 0.0;
+            for (int i = 0; i < NCLASS; i++) {
+              total += globalCount[i];
+              work += passivedouble(globalCount[i]) / pow(2.0, i);
+            }
+            cout << "Stable time-step classes (cells with local step in [2^k, 2^(k+1)) x global step):" << endl;
+            for (int i = 0; i < NCLASS; i++) {
+              if (globalCount[i] > 0) cout << "  k = " << i << ": " << globalCount[i] << " cells" << endl;
+            }
+            if (work > 0.0)
+              cout << "Ideal speedup of a multi-rate integration for this mesh: "
+                   << passivedouble(total) / work << "." << endl;
+          }
+        }
+        END_SU2_OMP_MASTER
+        SU2_OMP_BARRIER
+      }
+
       /*--- Sets the regular CFL equal to the unsteady CFL. ---*/
 
       SU2_OMP_FOR_STAT(omp_chunk_size)
@@ -570,9 +653,11 @@ class CFVMFlowSolverBase : public CSolver {
       SU2_OMP_BARRIER
     }
 
-    /*--- The pseudo local time (explicit integration) cannot be greater than the physical time ---*/
+    /*--- The pseudo local time (explicit integration) cannot be greater than the
+     physical time. In general this limit is applied inside the main loop above,
+     only the iteration that recomputes the physical time step needs this sweep. ---*/
 
-    if (dual_time && !implicit) {
+    if (clampDtLater) {
       SU2_OMP_FOR_STAT(omp_chunk_size)
       for (auto iPoint = 0ul; iPoint < nPointDomain; iPoint++) {
         su2double dt = min((2.0/3.0)*config->GetDelta_UnstTimeND(), nodes->GetDelta_Time(iPoint));
@@ -684,6 +769,8 @@ class CFVMFlowSolverBase : public CSolver {
 
   /*!
    * \brief Compute the dissipation sensor for centered schemes.
+   * \note The halo exchange of the sensor (SENSOR) is left to the caller,
+   *       so that the communication can be overlapped with other work.
    * \param[in] geometry - Geometrical definition of the problem.
    * \param[in] config - Definition of the particular problem.
    * \tparam SensVarFunc - Function object implementing (nodes, iPoint) to return the sensor variable, e.g. pressure.
@@ -745,12 +832,6 @@ class CFVMFlowSolverBase : public CSolver {
         nodes->SetSensor(iPoint, fabs(iPoint_UndLapl[iPoint]) / jPoint_UndLapl[iPoint]);
       END_SU2_OMP_FOR
     }
-
-    /*--- MPI parallelization ---*/
-
-    InitiateComms(geometry, config, SENSOR);
-    CompleteComms(geometry, config, SENSOR);
-
   }
 
   /*!
@@ -938,6 +1019,37 @@ class CFVMFlowSolverBase : public CSolver {
 
   }
 
+  /*!
+   * \brief Base per-point under-relaxation factor, limits the relative change of density and energy.
+   * \param[in] iPoint - Point index.
+   * \return The factor by which the update of the point should be scaled.
+   */
+  inline su2double UnderRelaxationFactor(unsigned long iPoint) const {
+    const su2double allowableRatio = 0.2;
+    su2double localUnderRelaxation = 1.0;
+
+    for (unsigned short iVar = 0; iVar < nVar; iVar++) {
+      /*--- We impose a limit on the maximum percentage that the
+       density and energy can change over a nonlinear iteration. ---*/
+
+      if ((iVar == 0) || (iVar == nVar - 1)) {
+        const unsigned long index = iPoint * nVar + iVar;
+        const su2double ratio = fabs(LinSysSol[index]) / (fabs(nodes->GetSolution(iPoint, iVar)) + EPS);
+        if (ratio > allowableRatio) {
+          localUnderRelaxation = min(allowableRatio / ratio, localUnderRelaxation);
+        }
+      }
+    }
+
+    /*--- Threshold the relaxation factor in the event that there is
+     a very small value. This helps avoid catastrophic crashes due
+     to non-realizable states by canceling the update. ---*/
+
+    if (localUnderRelaxation < 1e-10) localUnderRelaxation = 0.0;
+
+    return localUnderRelaxation;
+  }
+
   /*!
    * \brief Generic implementation to complete an implicit iteration, i.e. update the solution.
    * \tparam compute_ur - Whether to use automatic under-relaxation for the update.
@@ -945,15 +1057,29 @@ class CFVMFlowSolverBase : public CSolver {
   template<bool compute_ur>
   void CompleteImplicitIteration_impl(CGeometry *geometry, CConfig *config) {
 
-    if (compute_ur) ComputeUnderRelaxationFactor(config);
+    /*--- Update the solution with under-relaxation and communicate it. The base
+     under-relaxation factor is computed and stored in the same pass as the update
+     (one sweep instead of two, the CFL adaptation reads the stored factors later).
+     Solvers with their own strategy store the factors before calling this with
+     compute_ur = false. ---*/
 
-    /*--- Update solution with under-relaxation and communicate it. ---*/
+    const bool update = !config->GetContinuous_Adjoint();
 
-    if (!config->GetContinuous_Adjoint()) {
+    if (compute_ur || update) {
       SU2_OMP_FOR_STAT(omp_chunk_size)
       for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
-        for (unsigned short iVar = 0; iVar < nVar; iVar++) {
-          nodes->AddSolution(iPoint, iVar, nodes->GetUnderRelaxation(iPoint)*LinSysSol[iPoint*nVar+iVar]);
+        su2double underRelaxation = 1.0;
+        if (compute_ur) {
+          underRelaxation = UnderRelaxationFactor(iPoint);
+          nodes->SetUnderRelaxation(iPoint, underRelaxation);
+        }
+        else if (update) {
+          underRelaxation = nodes->GetUnderRelaxation(iPoint);
+        }
+        if (update) {
+          for (unsigned short iVar = 0; iVar < nVar; iVar++) {
+            nodes->AddSolution(iPoint, iVar, underRelaxation*LinSysSol[iPoint*nVar+iVar]);
+          }
         }
       }
       END_SU2_OMP_FOR
@@ -1032,6 +1158,26 @@ class CFVMFlowSolverBase : public CSolver {
    */
   void SetPrimitive_Limiter(CGeometry* geometry, const CConfig* config) final;
 
+  /*!
+   * \brief Compute the Green-Gauss reconstruction gradient and the limiter of the
+   *        primitive variables in a single fused sweep over the grid.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   * \return True if the fused kernel was applicable, false if the caller needs
+   *         to use the separate gradient and limiter computations instead.
+   */
+  bool SetPrimitive_GradientLimiter_Fused(CGeometry* geometry, const CConfig* config);
+
+  /*!
+   * \brief Compute the Green-Gauss gradient of the primitive variables together with the
+   *        solution gradients of the scalar (turbulence, species) solvers in one fused
+   *        sweep over the grid with a single round of halo exchanges.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver_container - Container vector with all the solutions.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void SetFused_Gradient_GG(CGeometry* geometry, CSolver** solver_container, const CConfig* config);
+
   /*!
    * \brief Implementation of implicit Euler iteration.
    */
@@ -29,6 +29,7 @@
 #include "../gradients/computeGradientsGreenGauss.hpp"
 #include "../gradients/computeGradientsLeastSquares.hpp"
 #include "../limiters/computeLimiters.hpp"
+#include "../limiters/computeLimitersFused.hpp"
 #include "../numerics_simd/CNumericsSIMD.hpp"
 #include "CFVMFlowSolverBase.hpp"
 
@@ -244,6 +245,22 @@ void CFVMFlowSolverBase<V, R>::AllocateTerribleLegacyTemporaryVariables() {
   }
 }
 
+template <class V, ENUM_REGIME R>
+void CFVMFlowSolverBase<V, R>::SetOwnedVertices(const CGeometry* geometry) {
+
+  if (OwnedVertices.size() == nMarker) return;
+
+  OwnedVertices.resize(nMarker);
+
+  for (auto iMarker = 0u; iMarker < nMarker; iMarker++) {
+    OwnedVertices[iMarker].reserve(geometry->nVertex[iMarker]);
+    for (auto iVertex = 0ul; iVertex < geometry->nVertex[iMarker]; iVertex++) {
+      const auto iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+      if (geometry->nodes->GetDomain(iPoint)) OwnedVertices[iMarker].push_back(iVertex);
+    }
+  }
+}
+
 template <class V, ENUM_REGIME R>
 void CFVMFlowSolverBase<V, R>::CommunicateInitialState(CGeometry* geometry, const CConfig* config) {
   /*--- Define solver parameters needed for execution of destructor ---*/
@@ -252,6 +269,10 @@ void CFVMFlowSolverBase<V, R>::CommunicateInitialState(CGeometry* geometry, cons
   euler_implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
   least_squares = (config->GetKind_Gradient_Method() == WEIGHTED_LEAST_SQUARES);
 
+  /*--- Build the owner-computes vertex lists for the force integration. ---*/
+
+  SetOwnedVertices(geometry);
+
   /*--- Communicate and store volume and the number of neighbors for
    any dual CVs that lie on on periodic markers. ---*/
 
@@ -288,27 +309,35 @@ void CFVMFlowSolverBase<V, R>::HybridParallelInitialization(const CConfig& confi
    *    sum the fluxes for each cell and set the diagonal of the system matrix. ---*/
 
   su2double parallelEff = 1.0;
+
+  /*--- When the reducer strategy is requested explicitly skip the coloring
+   *    altogether, natural edge order is thread-safe with that strategy. ---*/
+  if (config.GetEdgeReduction()) geometry.SetNaturalEdgeColoring();
+
   const auto& coloring = geometry.GetEdgeColoring(&parallelEff);
 
   /*--- The decision to use the strategy is local to each rank. ---*/
-  ReducerStrategy = parallelEff < COLORING_EFF_THRESH;
+  ReducerStrategy = (parallelEff < COLORING_EFF_THRESH) || config.GetEdgeReduction();
 
   /*--- When using the reducer force a single color to reduce the color loop overhead. ---*/
   if (ReducerStrategy && (coloring.getOuterSize() > 1)) geometry.SetNaturalEdgeColoring();
 
   if (!coloring.empty()) {
     /*--- If the reducer strategy is used we are not constrained by group
-     *    size as we have no other edge loops in the Euler/NS solvers. ---*/
-    auto groupSize = ReducerStrategy ? 1ul : geometry.GetEdgeColorGroupSize();
+     *    size as we have no other edge loops in the Euler/NS solvers.
+     *    Otherwise use the cost-adapted chunk size of each color. ---*/
     auto nColor = coloring.getOuterSize();
     EdgeColoring.reserve(nColor);
 
-    for (auto iColor = 0ul; iColor < nColor; ++iColor)
-      EdgeColoring.emplace_back(coloring.innerIdx(iColor), coloring.getNumNonZeros(iColor), groupSize);
+    for (auto iColor = 0ul; iColor < nColor; ++iColor) {
+      auto chunkSize = ReducerStrategy ? 1ul : geometry.GetEdgeColorChunkSize(iColor);
+      EdgeColoring.emplace_back(coloring.innerIdx(iColor), coloring.getNumNonZeros(iColor), chunkSize);
+    }
   }
 
-  /*--- If the reducer strategy is not being forced (by EDGE_COLORING_GROUP_SIZE=0) print some messages. ---*/
-  if (config.GetEdgeColoringGroupSize() != 1 << 30) {
+  /*--- If the reducer strategy is not being forced (by EDGE_COLORING_GROUP_SIZE=0
+   *    or USE_EDGE_REDUCTION=YES) print some messages. ---*/
+  if ((config.GetEdgeColoringGroupSize() != 1 << 30) && !config.GetEdgeReduction()) {
     su2double minEff = 1.0;
     SU2_MPI::Reduce(&parallelEff, &minEff, 1, MPI_DOUBLE, MPI_MIN, MASTER_NODE, SU2_MPI::GetComm());
 
@@ -401,6 +430,51 @@ void CFVMFlowSolverBase<V, R>::SetPrimitive_Limiter(CGeometry* geometry, const C
                   nPrimVarGrad, primitives, gradient, primMin, primMax, limiter);
 }
 
+template <class V, ENUM_REGIME R>
+bool CFVMFlowSolverBase<V, R>::SetPrimitive_GradientLimiter_Fused(CGeometry* geometry, const CConfig* config) {
+  const auto kindLimiter = config->GetKind_SlopeLimit_Flow();
+  const auto& primitives = nodes->GetPrimitive();
+  auto& gradient = nodes->GetGradient_Reconstruction();
+  auto& primMin = nodes->GetSolution_Min();
+  auto& primMax = nodes->GetSolution_Max();
+  auto& limiter = nodes->GetLimiter_Primitive();
+
+  return computeLimitersFused(kindLimiter, this, PRIMITIVE_GRAD_REC, PRIMITIVE_LIMITER, *geometry, *config, 0,
+                              nPrimVarGrad, primitives, gradient, primMin, primMax, limiter);
+}
+
+template <class V, ENUM_REGIME R>
+void CFVMFlowSolverBase<V, R>::SetFused_Gradient_GG(CGeometry* geometry, CSolver** solver_container,
+                                                    const CConfig* config) {
+  /*--- Batch the primitive gradient of the flow solver with the solution gradients of the
+   *    scalar solvers into one sweep over the grid and one round of halo exchanges. The
+   *    scalar solutions do not change between here and the preprocessing of their own
+   *    solvers, the gradients are therefore identical to the ones the scalar solvers
+   *    would compute, and they skip their own sweep (see CScalarSolver::CommonPreprocessing). ---*/
+
+  std::vector<CGreenGaussField> fields;
+
+  fields.push_back({this, &nodes->GetPrimitive(), &nodes->GetGradient_Primitive(),
+                    0, static_cast<size_t>(nPrimVarGrad), PRIMITIVE_GRADIENT, PERIODIC_PRIM_GG});
+
+  for (auto iSol : {TURB_SOL, SPECIES_SOL}) {
+    auto scalarSolver = solver_container[iSol];
+    if (scalarSolver == nullptr) continue;
+
+    auto scalarNodes = scalarSolver->GetNodes();
+    fields.push_back({scalarSolver, &scalarNodes->GetSolution(), &scalarNodes->GetGradient(),
+                      0, static_cast<size_t>(scalarSolver->GetnVar()), SOLUTION_GRADIENT, PERIODIC_SOL_GG});
+  }
+
+  SU2_OMP_MASTER {
+    for (const auto& field : fields)
+      if (field.solver != this) field.solver->SetGradientComputedExternally();
+  }
+  END_SU2_OMP_MASTER
+
+  computeGradientsGreenGaussFused(*geometry, *config, fields);
+}
+
 template <class V, ENUM_REGIME R>
 void CFVMFlowSolverBase<V, R>::Viscous_Residual_impl(unsigned long iEdge, CGeometry *geometry, CSolver **solver_container,
                                                      CNumerics *numerics, CConfig *config) {
@@ -532,36 +606,11 @@ void CFVMFlowSolverBase<V, R>::ComputeVerificationError(CGeometry* geometry, CCo
 template <class V, ENUM_REGIME R>
 void CFVMFlowSolverBase<V, R>::ComputeUnderRelaxationFactor(const CConfig* config) {
   /* Loop over the solution update given by relaxing the linear
-   system for this nonlinear iteration. */
-
-  const su2double allowableRatio = 0.2;
+   system for this nonlinear iteration, and store the factors. */
 
   SU2_OMP_FOR_STAT(omp_chunk_size)
   for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
-    su2double localUnderRelaxation = 1.0;
-
-    for (unsigned short iVar = 0; iVar < nVar; iVar++) {
-      /* We impose a limit on the maximum percentage that the
-       density and energy can change over a nonlinear iteration. */
-
-      if ((iVar == 0) || (iVar == nVar - 1)) {
-        const unsigned long index = iPoint * nVar + iVar;
-        su2double ratio = fabs(LinSysSol[index]) / (fabs(nodes->GetSolution(iPoint, iVar)) + EPS);
-        if (ratio > allowableRatio) {
-          localUnderRelaxation = min(allowableRatio / ratio, localUnderRelaxation);
-        }
-      }
-    }
-
-    /* Threshold the relaxation factor in the event that there is
-     a very small value. This helps avoid catastrophic crashes due
-     to non-realizable states by canceling the update. */
-
-    if (localUnderRelaxation < 1e-10) localUnderRelaxation = 0.0;
-
-    /* Store the under-relaxation factor for this point. */
-
-    nodes->SetUnderRelaxation(iPoint, localUnderRelaxation);
+    nodes->SetUnderRelaxation(iPoint, UnderRelaxationFactor(iPoint));
   }
   END_SU2_OMP_FOR
 }
@@ -569,7 +618,10 @@ void CFVMFlowSolverBase<V, R>::ComputeUnderRelaxationFactor(const CConfig* confi
 template <class V, ENUM_REGIME R>
 void CFVMFlowSolverBase<V, R>::ImplicitEuler_Iteration(CGeometry *geometry, CSolver**, CConfig *config) {
 
-  PrepareImplicitIteration(geometry, nullptr, config);
+  {
+    SU2_PROFILE_PHASE(JACOBIAN_ASSEMBLY);
+    PrepareImplicitIteration(geometry, nullptr, config);
+  }
 
   /*--- Solve or smooth the linear system. ---*/
 
@@ -589,7 +641,10 @@ void CFVMFlowSolverBase<V, R>::ImplicitEuler_Iteration(CGeometry *geometry, CSol
   END_SU2_OMP_MASTER
   SU2_OMP_BARRIER
 
-  CompleteImplicitIteration(geometry, nullptr, config);
+  {
+    SU2_PROFILE_PHASE(JACOBIAN_ASSEMBLY);
+    CompleteImplicitIteration(geometry, nullptr, config);
+  }
 }
 
 template <class V, ENUM_REGIME R>
@@ -758,10 +813,9 @@ su2double CFVMFlowSolverBase<V, R>::GetInletAtVertex(su2double* val_inlet, unsig
 template <class V, ENUM_REGIME R>
 void CFVMFlowSolverBase<V, R>::SetUniformInlet(const CConfig* config, unsigned short iMarker) {
   if (config->GetMarker_All_KindBC(iMarker) == INLET_FLOW) {
-    string Marker_Tag = config->GetMarker_All_TagBound(iMarker);
-    su2double p_total = config->GetInlet_Ptotal(Marker_Tag);
-    su2double t_total = config->GetInlet_Ttotal(Marker_Tag);
-    auto flow_dir = config->GetInlet_FlowDir(Marker_Tag);
+    su2double p_total = config->GetInlet_Ptotal(iMarker);
+    su2double t_total = config->GetInlet_Ttotal(iMarker);
+    auto flow_dir = config->GetInlet_FlowDir(iMarker);
 
     for (unsigned long iVertex = 0; iVertex < nVertex[iMarker]; iVertex++) {
       Inlet_Ttotal[iMarker][iVertex] = t_total;
@@ -800,8 +854,18 @@ void CFVMFlowSolverBase<V, R>::LoadRestart_impl(CGeometry **geometry, CSolver **
 
     /*--- Read the restart data from either an ASCII or binary SU2 file. ---*/
 
-    if (config->GetRead_Binary_Restart()) {
-      Read_SU2_Restart_Binary(geometry[MESH_0], config, restart_filename);
+    /*--- The flow solver only consumes the coordinates and its own variables,
+     unless grid velocities must be read for a dynamic grid restart (they are
+     stored behind the turbulence variables), the trailing output-only fields
+     are skipped during the binary read. ---*/
+
+    const unsigned short wantedFields =
+        (dynamic_grid && update_geo) ? 0 : skipVars + nVar_Restart;
+
+    if (config->GetRead_Surface_Restart()) {
+      Read_SU2_Restart_Surface(geometry[MESH_0], config, restart_filename);
+    } else if (config->GetRead_Binary_Restart()) {
+      Read_SU2_Restart_Binary(geometry[MESH_0], config, restart_filename, wantedFields);
     } else {
       Read_SU2_Restart_ASCII(geometry[MESH_0], config, restart_filename);
     }
@@ -818,81 +882,122 @@ void CFVMFlowSolverBase<V, R>::LoadRestart_impl(CGeometry **geometry, CSolver **
 
     /*--- Load data from the restart into correct containers. ---*/
 
-    unsigned long counter = 0;
-    for (auto iPoint_Global = 0ul; iPoint_Global < geometry[MESH_0]->GetGlobal_nPointDomain(); iPoint_Global++) {
+    if (config->GetRead_Surface_Restart()) {
 
-      /*--- Retrieve local index. If this node from the restart file lives
-      on the current processor, we will load and instantiate the vars. ---*/
+      /*--- Sparse surface restart, only the marker-adjacent points are in
+       the file and the interior keeps the free-stream values it was
+       constructed with. The file does not carry the interior grid. ---*/
 
-      const auto iPoint_Local = geometry[MESH_0]->GetGlobal_to_Local_Point(iPoint_Global);
-
-      if (iPoint_Local > -1) {
+      if ((dynamic_grid || static_fsi) && update_geo) {
+        SU2_MPI::Error(string("Surface restart files do not carry the interior grid,\n") +
+                       string("READ_SURFACE_RESTART cannot be combined with dynamic grids or FSI."),
+                       CURRENT_FUNCTION);
+      }
 
-        /*--- We need to store this point's data, so jump to the correct
-        offset in the buffer of data from the restart file and load it. ---*/
+      for (auto iRecord = 0ul; iRecord < Restart_Points.size(); iRecord++) {
 
-        auto index = counter * Restart_Vars[1] + skipVars;
+        const auto iPoint_Local = geometry[MESH_0]->GetGlobal_to_Local_Point(Restart_Points[iRecord]);
+        const auto index = iRecord * Restart_Vars[1] + skipVars;
 
         if (SolutionRestart == nullptr) {
           for (auto iVar = 0u; iVar < nVar_Restart; iVar++)
             nodes->SetSolution(iPoint_Local, iVar, Restart_Data[index+iVar]);
         }
         else {
-          /*--- Used as buffer, allows defaults for nVar > nVar_Restart. ---*/
           for (auto iVar = 0u; iVar < nVar_Restart; iVar++)
             SolutionRestart[iVar] = Restart_Data[index + iVar];
           nodes->SetSolution(iPoint_Local, SolutionRestart);
         }
+      }
 
-        /*--- For dynamic meshes, read in and store the
-        grid coordinates and grid velocities for each node. ---*/
+    } else {
 
-        if (dynamic_grid && update_geo) {
+      unsigned long counter = 0;
+      for (auto iPoint_Global = 0ul; iPoint_Global < geometry[MESH_0]->GetGlobal_nPointDomain(); iPoint_Global++) {
 
-          /*--- Read in the next 2 or 3 variables which are the grid velocities ---*/
-          /*--- If we are restarting the solution from a previously computed static calculation (no grid movement) ---*/
-          /*--- the grid velocities are set to 0. This is useful for FSI computations ---*/
+        /*--- Retrieve local index. If this node from the restart file lives
+        on the current processor, we will load and instantiate the vars. ---*/
 
-          /*--- Rewind the index to retrieve the Coords. ---*/
-          index = counter * Restart_Vars[1];
-          const auto* Coord = &Restart_Data[index];
-
-          su2double GridVel[MAXNDIM] = {0.0};
-          if (!steady_restart) {
-            /*--- Move the index forward to get the grid velocities. ---*/
-            index += skipVars + nVar_Restart + config->GetnTurbVar();
-            for (auto iDim = 0u; iDim < nDim; iDim++) { GridVel[iDim] = Restart_Data[index+iDim]; }
+        const auto iPoint_Local = geometry[MESH_0]->GetGlobal_to_Local_Point(iPoint_Global);
+
+        if (iPoint_Local > -1) {
+
+          /*--- We need to store this point's data, so jump to the correct
+          offset in the buffer of data from the restart file and load it. ---*/
+
+          auto index = counter * Restart_Vars[1] + skipVars;
+
+          if (SolutionRestart == nullptr) {
+            for (auto iVar = 0u; iVar < nVar_Restart; iVar++)
+              nodes->SetSolution(iPoint_Local, iVar, Restart_Data[index+iVar]);
+          }
+          else {
+            /*--- Used as buffer, allows defaults for nVar > nVar_Restart. ---*/
+            for (auto iVar = 0u; iVar < nVar_Restart; iVar++)
+              SolutionRestart[iVar] = Restart_Data[index + iVar];
+            nodes->SetSolution(iPoint_Local, SolutionRestart);
           }
 
-          for (auto iDim = 0u; iDim < nDim; iDim++) {
-            geometry[MESH_0]->nodes->SetCoord(iPoint_Local, iDim, Coord[iDim]);
-            geometry[MESH_0]->nodes->SetGridVel(iPoint_Local, iDim, GridVel[iDim]);
+          /*--- Dual-snapshot restart, the same file carries the previous time
+           step as a second data block, place it in the time-n container. ---*/
+
+          if (Restart_Data_n != nullptr) {
+            for (auto iVar = 0u; iVar < nVar_Restart; iVar++)
+              nodes->Set_Solution_time_n(iPoint_Local, iVar, Restart_Data_n[index+iVar]);
           }
-        }
 
-        /*--- For static FSI problems, grid_movement is 0 but we need to read in and store the
-        grid coordinates for each node (but not the grid velocities, as there are none). ---*/
+          /*--- For dynamic meshes, read in and store the
+          grid coordinates and grid velocities for each node. ---*/
+
+          if (dynamic_grid && update_geo) {
+
+            /*--- Read in the next 2 or 3 variables which are the grid velocities ---*/
+            /*--- If we are restarting the solution from a previously computed static calculation (no grid movement) ---*/
+            /*--- the grid velocities are set to 0. This is useful for FSI computations ---*/
 
-        if (static_fsi && update_geo) {
-        /*--- Rewind the index to retrieve the Coords. ---*/
-          index = counter*Restart_Vars[1];
-          const auto* Coord = &Restart_Data[index];
+            /*--- Rewind the index to retrieve the Coords. ---*/
+            index = counter * Restart_Vars[1];
+            const auto* Coord = &Restart_Data[index];
 
-          for (auto iDim = 0u; iDim < nDim; iDim++) {
-            geometry[MESH_0]->nodes->SetCoord(iPoint_Local, iDim, Coord[iDim]);
+            su2double GridVel[MAXNDIM] = {0.0};
+            if (!steady_restart) {
+              /*--- Move the index forward to get the grid velocities. ---*/
+              index += skipVars + nVar_Restart + config->GetnTurbVar();
+              for (auto iDim = 0u; iDim < nDim; iDim++) { GridVel[iDim] = Restart_Data[index+iDim]; }
+            }
+
+            for (auto iDim = 0u; iDim < nDim; iDim++) {
+              geometry[MESH_0]->nodes->SetCoord(iPoint_Local, iDim, Coord[iDim]);
+              geometry[MESH_0]->nodes->SetGridVel(iPoint_Local, iDim, GridVel[iDim]);
+            }
           }
-        }
 
-        /*--- Increment the overall counter for how many points have been loaded. ---*/
-        counter++;
+          /*--- For static FSI problems, grid_movement is 0 but we need to read in and store the
+          grid coordinates for each node (but not the grid velocities, as there are none). ---*/
+
+          if (static_fsi && update_geo) {
+          /*--- Rewind the index to retrieve the Coords. ---*/
+            index = counter*Restart_Vars[1];
+            const auto* Coord = &Restart_Data[index];
+
+            for (auto iDim = 0u; iDim < nDim; iDim++) {
+              geometry[MESH_0]->nodes->SetCoord(iPoint_Local, iDim, Coord[iDim]);
+            }
+          }
+
+          /*--- Increment the overall counter for how many points have been loaded. ---*/
+          counter++;
+        }
       }
-    }
 
-    /*--- Detect a wrong solution file ---*/
+      /*--- Detect a wrong solution file ---*/
+
+      if (counter != nPointDomain) {
+        SU2_MPI::Error(string("The solution file ") + restart_filename + string(" does not match with the mesh file.\n") +
+                       string("This can be caused by empty lines at the end of the file."), CURRENT_FUNCTION);
+      }
 
-    if (counter != nPointDomain) {
-      SU2_MPI::Error(string("The solution file ") + restart_filename + string(" does not match with the mesh file.\n") +
-                     string("This can be caused by empty lines at the end of the file."), CURRENT_FUNCTION);
+      Restart_TimeN_Loaded = (Restart_Data_n != nullptr);
     }
   }
   END_SU2_OMP_MASTER
@@ -979,8 +1084,7 @@ void CFVMFlowSolverBase<V, R>::LoadRestart_impl(CGeometry **geometry, CSolver **
 
     delete [] Restart_Vars;
     Restart_Vars = nullptr;
-    delete [] Restart_Data;
-    Restart_Data = nullptr;
+    FreeRestartData();
   }
   END_SU2_OMP_MASTER
   SU2_OMP_BARRIER
@@ -1049,12 +1153,38 @@ void CFVMFlowSolverBase<V, R>::PushSolutionBackInTime(unsigned long TimeIter, bo
   /*--- Push back the initial condition to previous solution containers
    for a 1st-order restart or when simply intitializing to freestream. ---*/
 
+  /*--- With a dual-snapshot restart (see DUAL_SNAPSHOT_RESTART) the single
+   file read already placed u(n-1) in the solution and u(n-2) in the time-n
+   container of the fine grid, push in reverse order so both levels survive
+   and skip the second restart file below. ---*/
+
+  const bool dual_snapshot = restart && (config->GetTime_Marching() == TIME_MARCHING::DT_STEPPING_2ND) &&
+                             config->GetDual_Snapshot_Restart() && config->GetRead_Binary_Restart() &&
+                             !config->GetRead_Surface_Restart() && !config->GetDynamic_Grid();
+
+  if (dual_snapshot &&
+      (!GetRestart_TimeN_Loaded() || (rans && !solver_container[MESH_0][TURB_SOL]->GetRestart_TimeN_Loaded()))) {
+    SU2_MPI::Error(string("DUAL_SNAPSHOT_RESTART is active but the restart file does not carry the\n") +
+                   string("previous time step (it predates the option or was written without it).\n") +
+                   string("Restart from a dual-snapshot file or disable the option."), CURRENT_FUNCTION);
+  }
+
   for (unsigned short iMesh = 0; iMesh <= config->GetnMGLevels(); iMesh++) {
-    solver_container[iMesh][FLOW_SOL]->GetNodes()->Set_Solution_time_n();
-    solver_container[iMesh][FLOW_SOL]->GetNodes()->Set_Solution_time_n1();
-    if (rans) {
-      solver_container[iMesh][TURB_SOL]->GetNodes()->Set_Solution_time_n();
-      solver_container[iMesh][TURB_SOL]->GetNodes()->Set_Solution_time_n1();
+    if (dual_snapshot && (iMesh == MESH_0)) {
+      solver_container[iMesh][FLOW_SOL]->GetNodes()->Set_Solution_time_n1();
+      solver_container[iMesh][FLOW_SOL]->GetNodes()->Set_Solution_time_n();
+      if (rans) {
+        solver_container[iMesh][TURB_SOL]->GetNodes()->Set_Solution_time_n1();
+        solver_container[iMesh][TURB_SOL]->GetNodes()->Set_Solution_time_n();
+      }
+    }
+    else {
+      solver_container[iMesh][FLOW_SOL]->GetNodes()->Set_Solution_time_n();
+      solver_container[iMesh][FLOW_SOL]->GetNodes()->Set_Solution_time_n1();
+      if (rans) {
+        solver_container[iMesh][TURB_SOL]->GetNodes()->Set_Solution_time_n();
+        solver_container[iMesh][TURB_SOL]->GetNodes()->Set_Solution_time_n1();
+      }
     }
 
     if (dynamic_grid) {
@@ -1068,7 +1198,7 @@ void CFVMFlowSolverBase<V, R>::PushSolutionBackInTime(unsigned long TimeIter, bo
     }
   }
 
-  if (restart && (config->GetTime_Marching() == TIME_MARCHING::DT_STEPPING_2ND)) {
+  if (restart && (config->GetTime_Marching() == TIME_MARCHING::DT_STEPPING_2ND) && !dual_snapshot) {
 
     /*--- Load an additional restart file for a 2nd-order restart. ---*/
 
@@ -1670,6 +1800,41 @@ void CFVMFlowSolverBase<V, FlowRegime>::SetResidual_DualTime(CGeometry *geometry
 
   if (!dynamic_grid) {
 
+    /*--- The combination of the old time levels is constant during the inner
+     iterations of a physical time step. Cache it so that each inner iteration
+     reads one array instead of the two old solution arrays. Not used while
+     recording, the tape needs the dependencies on the old solutions, which
+     are registered as inputs of the adjoint iteration. ---*/
+
+    const bool cache = !config->GetDiscrete_Adjoint();
+
+    if (cache && ((DualTimeResCacheIter != long(config->GetTimeIter())) ||
+                  (DualTimeResCache.rows() != nPointDomain))) {
+
+      SU2_OMP_MASTER {
+        if (DualTimeResCache.rows() != nPointDomain) DualTimeResCache.resize(nPointDomain, nVar);
+        DualTimeResCacheIter = config->GetTimeIter();
+      }
+      END_SU2_OMP_MASTER
+      SU2_OMP_BARRIER
+
+      SU2_OMP_FOR_STAT(omp_chunk_size)
+      for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+
+        U_time_nM1 = nodes->GetSolution_time_n1(iPoint);
+        U_time_n   = nodes->GetSolution_time_n(iPoint);
+        const su2double Volume = geometry->nodes->GetVolume(iPoint);
+
+        for (iVar = 0; iVar < nVar; iVar++) {
+          if (first_order)
+            DualTimeResCache(iPoint,iVar) = -U_time_n[iVar]*Volume / TimeStep;
+          if (second_order)
+            DualTimeResCache(iPoint,iVar) = (U_time_nM1[iVar] - 4.0*U_time_n[iVar])*Volume / (2.0*TimeStep);
+        }
+      }
+      END_SU2_OMP_FOR
+    }
+
     /*--- Loop over all nodes (excluding halos) ---*/
 
     AD::StartNoSharedReading();
@@ -1681,8 +1846,6 @@ void CFVMFlowSolverBase<V, FlowRegime>::SetResidual_DualTime(CGeometry *geometry
        we are currently iterating on U^n+1 and that U^n & U^n-1 are fixed,
        previous solutions that are stored in memory. ---*/
 
-      U_time_nM1 = nodes->GetSolution_time_n1(iPoint);
-      U_time_n   = nodes->GetSolution_time_n(iPoint);
       U_time_nP1 = nodes->GetSolution(iPoint);
 
       /*--- CV volume at time n+1. As we are on a static mesh, the volume
@@ -1693,12 +1856,29 @@ void CFVMFlowSolverBase<V, FlowRegime>::SetResidual_DualTime(CGeometry *geometry
       /*--- Compute the dual time-stepping source term based on the chosen
        time discretization scheme (1st- or 2nd-order).---*/
 
-      for (iVar = 0; iVar < nVar; iVar++) {
-        if (first_order)
-          LinSysRes(iPoint,iVar) += (U_time_nP1[iVar] - U_time_n[iVar])*Volume_nP1 / TimeStep;
-        if (second_order)
-          LinSysRes(iPoint,iVar) += ( 3.0*U_time_nP1[iVar] - 4.0*U_time_n[iVar]
-                                     +1.0*U_time_nM1[iVar])*Volume_nP1 / (2.0*TimeStep);
+      if (cache) {
+
+        /*--- Only the n+1 level changes between inner iterations. ---*/
+
+        for (iVar = 0; iVar < nVar; iVar++) {
+          if (first_order)
+            LinSysRes(iPoint,iVar) += U_time_nP1[iVar]*Volume_nP1/TimeStep + DualTimeResCache(iPoint,iVar);
+          if (second_order)
+            LinSysRes(iPoint,iVar) += 3.0*U_time_nP1[iVar]*Volume_nP1/(2.0*TimeStep) + DualTimeResCache(iPoint,iVar);
+        }
+      }
+      else {
+
+        U_time_nM1 = nodes->GetSolution_time_n1(iPoint);
+        U_time_n   = nodes->GetSolution_time_n(iPoint);
+
+        for (iVar = 0; iVar < nVar; iVar++) {
+          if (first_order)
+            LinSysRes(iPoint,iVar) += (U_time_nP1[iVar] - U_time_n[iVar])*Volume_nP1 / TimeStep;
+          if (second_order)
+            LinSysRes(iPoint,iVar) += ( 3.0*U_time_nP1[iVar] - 4.0*U_time_n[iVar]
+                                       +1.0*U_time_nM1[iVar])*Volume_nP1 / (2.0*TimeStep);
+        }
       }
 
       /*--- Compute the Jacobian contribution due to the dual time source term. ---*/
@@ -1903,19 +2083,25 @@ void CFVMFlowSolverBase<V, FlowRegime>::Pressure_Forces(const CGeometry* geometr
 
       NFPressOF = 0.0;
 
-      /*--- Loop over the vertices to compute the forces ---*/
+      /*--- Compute the pressure coefficient at all the vertices, including
+       the halo cells (for visualization purposes). ---*/
 
       for (iVertex = 0; iVertex < geometry->GetnVertex(iMarker); iVertex++) {
         iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
 
-        Pressure = nodes->GetPressure(iPoint);
+        CPressure[iMarker][iVertex] = (nodes->GetPressure(iPoint) - RefPressure) * factor * RefArea;
+      }
+
+      /*--- Loop over the owned vertices to compute the forces, the halo
+       vertices are excluded from the list so no ownership test is needed
+       per vertex. ---*/
 
-        CPressure[iMarker][iVertex] = (Pressure - RefPressure) * factor * RefArea;
+      if (Monitoring == YES) {
+        for (auto iVertex : OwnedVertices[iMarker]) {
+          iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
 
-        /*--- Note that the pressure coefficient is computed at the
-         halo cells (for visualization purposes), but not the forces ---*/
+          Pressure = nodes->GetPressure(iPoint);
 
-        if ((geometry->nodes->GetDomain(iPoint)) && (Monitoring == YES)) {
           Normal = geometry->vertex[iMarker][iVertex]->GetNormal();
           Coord = geometry->nodes->GetCoord(iPoint);
 
@@ -2049,70 +2235,86 @@ void CFVMFlowSolverBase<V, FlowRegime>::Pressure_Forces(const CGeometry* geometr
 
 #ifdef HAVE_MPI
 
-  /*--- Add AllBound information using all the nodes ---*/
+  /*--- Add AllBound and surface information using all the nodes. All the
+   coefficient groups are packed into one buffer so that a single reduction
+   is needed, with many monitored markers the latency of one reduction per
+   coefficient becomes significant. ---*/
 
   if (config->GetComm_Level() == COMM_FULL) {
-    auto Allreduce = [](su2double x) {
-      su2double tmp = x;
-      x = 0.0;
-      SU2_MPI::Allreduce(&tmp, &x, 1, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
-      return x;
+    const int nMarkerMon = config->GetnMarker_Monitoring();
+
+    vector<su2double> sendBuf;
+    sendBuf.reserve(15 + 9 * nMarkerMon);
+
+    auto pack = [&sendBuf](su2double x) { sendBuf.push_back(x); };
+    auto packArray = [&sendBuf, nMarkerMon](const su2double* x) { sendBuf.insert(sendBuf.end(), x, x + nMarkerMon); };
+
+    pack(AllBoundInvCoeff.CD);
+    pack(AllBoundInvCoeff.CL);
+    pack(AllBoundInvCoeff.CSF);
+    pack(AllBoundInvCoeff.CMx);
+    pack(AllBoundInvCoeff.CMy);
+    pack(AllBoundInvCoeff.CMz);
+    pack(AllBoundInvCoeff.CoPx);
+    pack(AllBoundInvCoeff.CoPy);
+    pack(AllBoundInvCoeff.CoPz);
+    pack(AllBoundInvCoeff.CFx);
+    pack(AllBoundInvCoeff.CFy);
+    pack(AllBoundInvCoeff.CFz);
+    pack(AllBoundInvCoeff.CT);
+    pack(AllBoundInvCoeff.CQ);
+    pack(AllBound_CNearFieldOF_Inv);
+
+    packArray(SurfaceInvCoeff.CL);
+    packArray(SurfaceInvCoeff.CD);
+    packArray(SurfaceInvCoeff.CSF);
+    packArray(SurfaceInvCoeff.CFx);
+    packArray(SurfaceInvCoeff.CFy);
+    packArray(SurfaceInvCoeff.CFz);
+    packArray(SurfaceInvCoeff.CMx);
+    packArray(SurfaceInvCoeff.CMy);
+    packArray(SurfaceInvCoeff.CMz);
+
+    vector<su2double> recvBuf(sendBuf.size());
+    SU2_MPI::Allreduce(sendBuf.data(), recvBuf.data(), sendBuf.size(), MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
+
+    size_t ii = 0;
+    auto unpack = [&recvBuf, &ii]() { return recvBuf[ii++]; };
+    auto unpackArray = [&recvBuf, &ii, nMarkerMon](su2double* x) {
+      for (int i = 0; i < nMarkerMon; ++i) x[i] = recvBuf[ii++];
     };
-    AllBoundInvCoeff.CD = Allreduce(AllBoundInvCoeff.CD);
-    AllBoundInvCoeff.CL = Allreduce(AllBoundInvCoeff.CL);
-    AllBoundInvCoeff.CSF = Allreduce(AllBoundInvCoeff.CSF);
-    AllBoundInvCoeff.CEff = AllBoundInvCoeff.CL / (AllBoundInvCoeff.CD + EPS);
-
-    AllBoundInvCoeff.CMx = Allreduce(AllBoundInvCoeff.CMx);
-    AllBoundInvCoeff.CMy = Allreduce(AllBoundInvCoeff.CMy);
-    AllBoundInvCoeff.CMz = Allreduce(AllBoundInvCoeff.CMz);
 
-    AllBoundInvCoeff.CoPx = Allreduce(AllBoundInvCoeff.CoPx);
-    AllBoundInvCoeff.CoPy = Allreduce(AllBoundInvCoeff.CoPy);
-    AllBoundInvCoeff.CoPz = Allreduce(AllBoundInvCoeff.CoPz);
-
-    AllBoundInvCoeff.CFx = Allreduce(AllBoundInvCoeff.CFx);
-    AllBoundInvCoeff.CFy = Allreduce(AllBoundInvCoeff.CFy);
-    AllBoundInvCoeff.CFz = Allreduce(AllBoundInvCoeff.CFz);
-
-    AllBoundInvCoeff.CT = Allreduce(AllBoundInvCoeff.CT);
-    AllBoundInvCoeff.CQ = Allreduce(AllBoundInvCoeff.CQ);
+    AllBoundInvCoeff.CD = unpack();
+    AllBoundInvCoeff.CL = unpack();
+    AllBoundInvCoeff.CSF = unpack();
+    AllBoundInvCoeff.CEff = AllBoundInvCoeff.CL / (AllBoundInvCoeff.CD + EPS);
+    AllBoundInvCoeff.CMx = unpack();
+    AllBoundInvCoeff.CMy = unpack();
+    AllBoundInvCoeff.CMz = unpack();
+    AllBoundInvCoeff.CoPx = unpack();
+    AllBoundInvCoeff.CoPy = unpack();
+    AllBoundInvCoeff.CoPz = unpack();
+    AllBoundInvCoeff.CFx = unpack();
+    AllBoundInvCoeff.CFy = unpack();
+    AllBoundInvCoeff.CFz = unpack();
+    AllBoundInvCoeff.CT = unpack();
+    AllBoundInvCoeff.CQ = unpack();
     AllBoundInvCoeff.CMerit = AllBoundInvCoeff.CT / (AllBoundInvCoeff.CQ + EPS);
-    AllBound_CNearFieldOF_Inv = Allreduce(AllBound_CNearFieldOF_Inv);
-  }
-
-  /*--- Add the forces on the surfaces using all the nodes ---*/
-
-  if (config->GetComm_Level() == COMM_FULL) {
-    int nMarkerMon = config->GetnMarker_Monitoring();
-
-    /*--- Use the same buffer for all reductions. We could avoid the copy back into
-     *    the original variable by swaping pointers, but it is safer this way... ---*/
-
-    su2double* buffer = new su2double[nMarkerMon];
-
-    auto Allreduce_inplace = [buffer](int size, su2double* x) {
-      SU2_MPI::Allreduce(x, buffer, size, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
-      for (int i = 0; i < size; ++i) x[i] = buffer[i];
-    };
-
-    Allreduce_inplace(nMarkerMon, SurfaceInvCoeff.CL);
-    Allreduce_inplace(nMarkerMon, SurfaceInvCoeff.CD);
-    Allreduce_inplace(nMarkerMon, SurfaceInvCoeff.CSF);
+    AllBound_CNearFieldOF_Inv = unpack();
+
+    unpackArray(SurfaceInvCoeff.CL);
+    unpackArray(SurfaceInvCoeff.CD);
+    unpackArray(SurfaceInvCoeff.CSF);
+    unpackArray(SurfaceInvCoeff.CFx);
+    unpackArray(SurfaceInvCoeff.CFy);
+    unpackArray(SurfaceInvCoeff.CFz);
+    unpackArray(SurfaceInvCoeff.CMx);
+    unpackArray(SurfaceInvCoeff.CMy);
+    unpackArray(SurfaceInvCoeff.CMz);
 
     for (iMarker_Monitoring = 0; iMarker_Monitoring < nMarkerMon; iMarker_Monitoring++)
       SurfaceInvCoeff.CEff[iMarker_Monitoring] =
           SurfaceInvCoeff.CL[iMarker_Monitoring] / (SurfaceInvCoeff.CD[iMarker_Monitoring] + EPS);
-
-    Allreduce_inplace(nMarkerMon, SurfaceInvCoeff.CFx);
-    Allreduce_inplace(nMarkerMon, SurfaceInvCoeff.CFy);
-    Allreduce_inplace(nMarkerMon, SurfaceInvCoeff.CFz);
-
-    Allreduce_inplace(nMarkerMon, SurfaceInvCoeff.CMx);
-    Allreduce_inplace(nMarkerMon, SurfaceInvCoeff.CMy);
-    Allreduce_inplace(nMarkerMon, SurfaceInvCoeff.CMz);
-
-    delete[] buffer;
   }
 
 #endif
@@ -2156,7 +2358,7 @@ void CFVMFlowSolverBase<V, FlowRegime>::Pressure_Forces(const CGeometry* geometr
 
 template <class V, ENUM_REGIME FlowRegime>
 void CFVMFlowSolverBase<V, FlowRegime>::Momentum_Forces(const CGeometry* geometry, const CConfig* config) {
-  unsigned long iVertex, iPoint;
+  unsigned long iPoint;
   unsigned short iDim, iMarker, Boundary, Monitoring, iMarker_Monitoring;
   su2double MassFlow, Density;
   const su2double *Normal = nullptr, *Coord = nullptr;
@@ -2201,15 +2403,14 @@ void CFVMFlowSolverBase<V, FlowRegime>::Momentum_Forces(const CGeometry* geometr
       su2double ForceMomentum[MAXNDIM] = {0.0}, MomentMomentum[MAXNDIM] = {0.0};
       su2double MomentX_Force[3] = {0.0}, MomentY_Force[3] = {0.0}, MomentZ_Force[3] = {0.0};
 
-      /*--- Loop over the vertices to compute the forces ---*/
-
-      for (iVertex = 0; iVertex < geometry->GetnVertex(iMarker); iVertex++) {
-        iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+      /*--- Loop over the owned vertices to compute the forces, the halo
+       vertices are excluded from the list so no ownership test is needed
+       per vertex. ---*/
 
-        /*--- Note that the pressure coefficient is computed at the
-         halo cells (for visualization purposes), but not the forces ---*/
+      if (Monitoring == YES) {
+        for (auto iVertex : OwnedVertices[iMarker]) {
+          iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
 
-        if ((geometry->nodes->GetDomain(iPoint)) && (Monitoring == YES)) {
           Normal = geometry->vertex[iMarker][iVertex]->GetNormal();
           Coord = geometry->nodes->GetCoord(iPoint);
           Density = nodes->GetDensity(iPoint);
@@ -2331,70 +2532,83 @@ void CFVMFlowSolverBase<V, FlowRegime>::Momentum_Forces(const CGeometry* geometr
 
 #ifdef HAVE_MPI
 
-  /*--- Add AllBound information using all the nodes ---*/
+  /*--- Add AllBound and surface information using all the nodes. All the
+   coefficient groups are packed into one buffer so that a single reduction
+   is needed, see Pressure_Forces. ---*/
 
   if (config->GetComm_Level() == COMM_FULL) {
-    auto Allreduce = [](su2double x) {
-      su2double tmp = x;
-      x = 0.0;
-      SU2_MPI::Allreduce(&tmp, &x, 1, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
-      return x;
+    const int nMarkerMon = config->GetnMarker_Monitoring();
+
+    vector<su2double> sendBuf;
+    sendBuf.reserve(14 + 9 * nMarkerMon);
+
+    auto pack = [&sendBuf](su2double x) { sendBuf.push_back(x); };
+    auto packArray = [&sendBuf, nMarkerMon](const su2double* x) { sendBuf.insert(sendBuf.end(), x, x + nMarkerMon); };
+
+    pack(AllBoundMntCoeff.CD);
+    pack(AllBoundMntCoeff.CL);
+    pack(AllBoundMntCoeff.CSF);
+    pack(AllBoundMntCoeff.CFx);
+    pack(AllBoundMntCoeff.CFy);
+    pack(AllBoundMntCoeff.CFz);
+    pack(AllBoundMntCoeff.CMx);
+    pack(AllBoundMntCoeff.CMy);
+    pack(AllBoundMntCoeff.CMz);
+    pack(AllBoundMntCoeff.CoPx);
+    pack(AllBoundMntCoeff.CoPy);
+    pack(AllBoundMntCoeff.CoPz);
+    pack(AllBoundMntCoeff.CT);
+    pack(AllBoundMntCoeff.CQ);
+
+    packArray(SurfaceMntCoeff.CL);
+    packArray(SurfaceMntCoeff.CD);
+    packArray(SurfaceMntCoeff.CSF);
+    packArray(SurfaceMntCoeff.CFx);
+    packArray(SurfaceMntCoeff.CFy);
+    packArray(SurfaceMntCoeff.CFz);
+    packArray(SurfaceMntCoeff.CMx);
+    packArray(SurfaceMntCoeff.CMy);
+    packArray(SurfaceMntCoeff.CMz);
+
+    vector<su2double> recvBuf(sendBuf.size());
+    SU2_MPI::Allreduce(sendBuf.data(), recvBuf.data(), sendBuf.size(), MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
+
+    size_t ii = 0;
+    auto unpack = [&recvBuf, &ii]() { return recvBuf[ii++]; };
+    auto unpackArray = [&recvBuf, &ii, nMarkerMon](su2double* x) {
+      for (int i = 0; i < nMarkerMon; ++i) x[i] = recvBuf[ii++];
     };
 
-    AllBoundMntCoeff.CD = Allreduce(AllBoundMntCoeff.CD);
-    AllBoundMntCoeff.CL = Allreduce(AllBoundMntCoeff.CL);
-    AllBoundMntCoeff.CSF = Allreduce(AllBoundMntCoeff.CSF);
+    AllBoundMntCoeff.CD = unpack();
+    AllBoundMntCoeff.CL = unpack();
+    AllBoundMntCoeff.CSF = unpack();
     AllBoundMntCoeff.CEff = AllBoundMntCoeff.CL / (AllBoundMntCoeff.CD + EPS);
-
-    AllBoundMntCoeff.CFx = Allreduce(AllBoundMntCoeff.CFx);
-    AllBoundMntCoeff.CFy = Allreduce(AllBoundMntCoeff.CFy);
-    AllBoundMntCoeff.CFz = Allreduce(AllBoundMntCoeff.CFz);
-
-    AllBoundMntCoeff.CMx = Allreduce(AllBoundMntCoeff.CMx);
-    AllBoundMntCoeff.CMy = Allreduce(AllBoundMntCoeff.CMy);
-    AllBoundMntCoeff.CMz = Allreduce(AllBoundMntCoeff.CMz);
-
-    AllBoundMntCoeff.CoPx = Allreduce(AllBoundMntCoeff.CoPx);
-    AllBoundMntCoeff.CoPy = Allreduce(AllBoundMntCoeff.CoPy);
-    AllBoundMntCoeff.CoPz = Allreduce(AllBoundMntCoeff.CoPz);
-
-    AllBoundMntCoeff.CT = Allreduce(AllBoundMntCoeff.CT);
-    AllBoundMntCoeff.CQ = Allreduce(AllBoundMntCoeff.CQ);
+    AllBoundMntCoeff.CFx = unpack();
+    AllBoundMntCoeff.CFy = unpack();
+    AllBoundMntCoeff.CFz = unpack();
+    AllBoundMntCoeff.CMx = unpack();
+    AllBoundMntCoeff.CMy = unpack();
+    AllBoundMntCoeff.CMz = unpack();
+    AllBoundMntCoeff.CoPx = unpack();
+    AllBoundMntCoeff.CoPy = unpack();
+    AllBoundMntCoeff.CoPz = unpack();
+    AllBoundMntCoeff.CT = unpack();
+    AllBoundMntCoeff.CQ = unpack();
     AllBoundMntCoeff.CMerit = AllBoundMntCoeff.CT / (AllBoundMntCoeff.CQ + EPS);
-  }
-
-  /*--- Add the forces on the surfaces using all the nodes ---*/
-
-  if (config->GetComm_Level() == COMM_FULL) {
-    int nMarkerMon = config->GetnMarker_Monitoring();
-
-    /*--- Use the same buffer for all reductions. We could avoid the copy back into
-     *    the original variable by swaping pointers, but it is safer this way... ---*/
 
-    su2double* buffer = new su2double[nMarkerMon];
-
-    auto Allreduce_inplace = [buffer](int size, su2double* x) {
-      SU2_MPI::Allreduce(x, buffer, size, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
-      for (int i = 0; i < size; ++i) x[i] = buffer[i];
-    };
-
-    Allreduce_inplace(nMarkerMon, SurfaceMntCoeff.CL);
-    Allreduce_inplace(nMarkerMon, SurfaceMntCoeff.CD);
-    Allreduce_inplace(nMarkerMon, SurfaceMntCoeff.CSF);
+    unpackArray(SurfaceMntCoeff.CL);
+    unpackArray(SurfaceMntCoeff.CD);
+    unpackArray(SurfaceMntCoeff.CSF);
+    unpackArray(SurfaceMntCoeff.CFx);
+    unpackArray(SurfaceMntCoeff.CFy);
+    unpackArray(SurfaceMntCoeff.CFz);
+    unpackArray(SurfaceMntCoeff.CMx);
+    unpackArray(SurfaceMntCoeff.CMy);
+    unpackArray(SurfaceMntCoeff.CMz);
 
     for (iMarker_Monitoring = 0; iMarker_Monitoring < nMarkerMon; iMarker_Monitoring++)
       SurfaceMntCoeff.CEff[iMarker_Monitoring] =
           SurfaceMntCoeff.CL[iMarker_Monitoring] / (SurfaceMntCoeff.CD[iMarker_Monitoring] + EPS);
-
-    Allreduce_inplace(nMarkerMon, SurfaceMntCoeff.CFx);
-    Allreduce_inplace(nMarkerMon, SurfaceMntCoeff.CFy);
-    Allreduce_inplace(nMarkerMon, SurfaceMntCoeff.CFz);
-
-    Allreduce_inplace(nMarkerMon, SurfaceMntCoeff.CMx);
-    Allreduce_inplace(nMarkerMon, SurfaceMntCoeff.CMy);
-    Allreduce_inplace(nMarkerMon, SurfaceMntCoeff.CMz);
-
-    delete[] buffer;
   }
 
 #endif
@@ -2510,9 +2724,15 @@ void CFVMFlowSolverBase<V, FlowRegime>::Friction_Forces(const CGeometry* geometr
 
     /* --- check if wall functions are used --- */
 
-    const bool wallfunctions = (config->GetWallFunction_Treatment(Marker_Tag) != WALL_FUNCTIONS::NONE);
+    const bool wallfunctions = (config->GetWallFunction_Treatment(iMarker) != WALL_FUNCTIONS::NONE);
 
-    /*--- Loop over the vertices to compute the forces ---*/
+    /*--- Loop over the vertices to compute the forces. The visualization
+     quantities are needed at the halo vertices as well, hence the loop is
+     over all the vertices with a cursor into the sorted owned-vertex list
+     instead of an ownership lookup per vertex. ---*/
+
+    const auto* ownedItr = OwnedVertices[iMarker].data();
+    const auto* ownedEnd = ownedItr + OwnedVertices[iMarker].size();
 
     for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
       iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
@@ -2534,7 +2754,7 @@ void CFVMFlowSolverBase<V, FlowRegime>::Friction_Forces(const CGeometry* geometr
       if (roughwall) {
         WALL_TYPE WallType;
         su2double Roughness_Height;
-        tie(WallType, Roughness_Height) = config->GetWallRoughnessProperties(Marker_Tag);
+        tie(WallType, Roughness_Height) = config->GetWallRoughnessProperties(iMarker);
         if (WallType == WALL_TYPE::ROUGH) Viscosity += nodes->GetEddyViscosity(iPoint);
       }
       Density = nodes->GetDensity(iPoint);
@@ -2631,7 +2851,10 @@ void CFVMFlowSolverBase<V, FlowRegime>::Friction_Forces(const CGeometry* geometr
       /*--- Note that y+, and heat are computed at the
        halo cells (for visualization purposes), but not the forces ---*/
 
-      if ((geometry->nodes->GetDomain(iPoint)) && (Monitoring == YES)) {
+      const bool owned = (ownedItr != ownedEnd) && (*ownedItr == iVertex);
+      if (owned) ++ownedItr;
+
+      if (owned && (Monitoring == YES)) {
         /*--- Axisymmetric simulations ---*/
 
         if (axisymmetric)
@@ -2754,75 +2977,91 @@ void CFVMFlowSolverBase<V, FlowRegime>::Friction_Forces(const CGeometry* geometr
 
 #ifdef HAVE_MPI
 
-  /*--- Add AllBound information using all the nodes ---*/
+  /*--- Add AllBound and surface information using all the nodes. All the
+   coefficient groups are packed into one buffer so that a single reduction
+   is needed, see Pressure_Forces. ---*/
 
   if (config->GetComm_Level() == COMM_FULL) {
-    auto Allreduce = [](su2double x) {
-      su2double tmp = x;
-      x = 0.0;
-      SU2_MPI::Allreduce(&tmp, &x, 1, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
-      return x;
+    const int nMarkerMon = config->GetnMarker_Monitoring();
+
+    vector<su2double> sendBuf;
+    sendBuf.reserve(16 + 11 * nMarkerMon);
+
+    auto pack = [&sendBuf](su2double x) { sendBuf.push_back(x); };
+    auto packArray = [&sendBuf, nMarkerMon](const su2double* x) { sendBuf.insert(sendBuf.end(), x, x + nMarkerMon); };
+
+    pack(AllBoundViscCoeff.CD);
+    pack(AllBoundViscCoeff.CL);
+    pack(AllBoundViscCoeff.CSF);
+    pack(AllBoundViscCoeff.CMx);
+    pack(AllBoundViscCoeff.CMy);
+    pack(AllBoundViscCoeff.CMz);
+    pack(AllBoundViscCoeff.CFx);
+    pack(AllBoundViscCoeff.CFy);
+    pack(AllBoundViscCoeff.CFz);
+    pack(AllBoundViscCoeff.CoPx);
+    pack(AllBoundViscCoeff.CoPy);
+    pack(AllBoundViscCoeff.CoPz);
+    pack(AllBoundViscCoeff.CT);
+    pack(AllBoundViscCoeff.CQ);
+    pack(AllBound_HF_Visc);
+    pack(pow(AllBound_MaxHF_Visc, MaxNorm));
+
+    packArray(SurfaceViscCoeff.CL);
+    packArray(SurfaceViscCoeff.CD);
+    packArray(SurfaceViscCoeff.CSF);
+    packArray(SurfaceViscCoeff.CFx);
+    packArray(SurfaceViscCoeff.CFy);
+    packArray(SurfaceViscCoeff.CFz);
+    packArray(SurfaceViscCoeff.CMx);
+    packArray(SurfaceViscCoeff.CMy);
+    packArray(SurfaceViscCoeff.CMz);
+    packArray(Surface_HF_Visc.data());
+    packArray(Surface_MaxHF_Visc.data());
+
+    vector<su2double> recvBuf(sendBuf.size());
+    SU2_MPI::Allreduce(sendBuf.data(), recvBuf.data(), sendBuf.size(), MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
+
+    size_t ii = 0;
+    auto unpack = [&recvBuf, &ii]() { return recvBuf[ii++]; };
+    auto unpackArray = [&recvBuf, &ii, nMarkerMon](su2double* x) {
+      for (int i = 0; i < nMarkerMon; ++i) x[i] = recvBuf[ii++];
     };
-    AllBoundViscCoeff.CD = Allreduce(AllBoundViscCoeff.CD);
-    AllBoundViscCoeff.CL = Allreduce(AllBoundViscCoeff.CL);
-    AllBoundViscCoeff.CSF = Allreduce(AllBoundViscCoeff.CSF);
-    AllBoundViscCoeff.CEff = AllBoundViscCoeff.CL / (AllBoundViscCoeff.CD + EPS);
-
-    AllBoundViscCoeff.CMx = Allreduce(AllBoundViscCoeff.CMx);
-    AllBoundViscCoeff.CMy = Allreduce(AllBoundViscCoeff.CMy);
-    AllBoundViscCoeff.CMz = Allreduce(AllBoundViscCoeff.CMz);
-
-    AllBoundViscCoeff.CFx = Allreduce(AllBoundViscCoeff.CFx);
-    AllBoundViscCoeff.CFy = Allreduce(AllBoundViscCoeff.CFy);
-    AllBoundViscCoeff.CFz = Allreduce(AllBoundViscCoeff.CFz);
-
-    AllBoundViscCoeff.CoPx = Allreduce(AllBoundViscCoeff.CoPx);
-    AllBoundViscCoeff.CoPy = Allreduce(AllBoundViscCoeff.CoPy);
-    AllBoundViscCoeff.CoPz = Allreduce(AllBoundViscCoeff.CoPz);
 
-    AllBoundViscCoeff.CT = Allreduce(AllBoundViscCoeff.CT);
-    AllBoundViscCoeff.CQ = Allreduce(AllBoundViscCoeff.CQ);
+    AllBoundViscCoeff.CD = unpack();
+    AllBoundViscCoeff.CL = unpack();
+    AllBoundViscCoeff.CSF = unpack();
+    AllBoundViscCoeff.CEff = AllBoundViscCoeff.CL / (AllBoundViscCoeff.CD + EPS);
+    AllBoundViscCoeff.CMx = unpack();
+    AllBoundViscCoeff.CMy = unpack();
+    AllBoundViscCoeff.CMz = unpack();
+    AllBoundViscCoeff.CFx = unpack();
+    AllBoundViscCoeff.CFy = unpack();
+    AllBoundViscCoeff.CFz = unpack();
+    AllBoundViscCoeff.CoPx = unpack();
+    AllBoundViscCoeff.CoPy = unpack();
+    AllBoundViscCoeff.CoPz = unpack();
+    AllBoundViscCoeff.CT = unpack();
+    AllBoundViscCoeff.CQ = unpack();
     AllBoundViscCoeff.CMerit = AllBoundViscCoeff.CT / (AllBoundViscCoeff.CQ + EPS);
-
-    AllBound_HF_Visc = Allreduce(AllBound_HF_Visc);
-    AllBound_MaxHF_Visc = pow(Allreduce(pow(AllBound_MaxHF_Visc, MaxNorm)), 1.0 / MaxNorm);
-  }
-
-  /*--- Add the forces on the surfaces using all the nodes ---*/
-
-  if (config->GetComm_Level() == COMM_FULL) {
-    int nMarkerMon = config->GetnMarker_Monitoring();
-
-    /*--- Use the same buffer for all reductions. We could avoid the copy back into
-     *    the original variable by swaping pointers, but it is safer this way... ---*/
-
-    su2double* buffer = new su2double[nMarkerMon];
-
-    auto Allreduce_inplace = [buffer](int size, su2double* x) {
-      SU2_MPI::Allreduce(x, buffer, size, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
-      for (int i = 0; i < size; ++i) x[i] = buffer[i];
-    };
-
-    Allreduce_inplace(nMarkerMon, SurfaceViscCoeff.CL);
-    Allreduce_inplace(nMarkerMon, SurfaceViscCoeff.CD);
-    Allreduce_inplace(nMarkerMon, SurfaceViscCoeff.CSF);
+    AllBound_HF_Visc = unpack();
+    AllBound_MaxHF_Visc = pow(unpack(), 1.0 / MaxNorm);
+
+    unpackArray(SurfaceViscCoeff.CL);
+    unpackArray(SurfaceViscCoeff.CD);
+    unpackArray(SurfaceViscCoeff.CSF);
+    unpackArray(SurfaceViscCoeff.CFx);
+    unpackArray(SurfaceViscCoeff.CFy);
+    unpackArray(SurfaceViscCoeff.CFz);
+    unpackArray(SurfaceViscCoeff.CMx);
+    unpackArray(SurfaceViscCoeff.CMy);
+    unpackArray(SurfaceViscCoeff.CMz);
+    unpackArray(Surface_HF_Visc.data());
+    unpackArray(Surface_MaxHF_Visc.data());
 
     for (iMarker_Monitoring = 0; iMarker_Monitoring < nMarkerMon; iMarker_Monitoring++)
       SurfaceViscCoeff.CEff[iMarker_Monitoring] =
           SurfaceViscCoeff.CL[iMarker_Monitoring] / (SurfaceViscCoeff.CD[iMarker_Monitoring] + EPS);
-
-    Allreduce_inplace(nMarkerMon, SurfaceViscCoeff.CFx);
-    Allreduce_inplace(nMarkerMon, SurfaceViscCoeff.CFy);
-    Allreduce_inplace(nMarkerMon, SurfaceViscCoeff.CFz);
-
-    Allreduce_inplace(nMarkerMon, SurfaceViscCoeff.CMx);
-    Allreduce_inplace(nMarkerMon, SurfaceViscCoeff.CMy);
-    Allreduce_inplace(nMarkerMon, SurfaceViscCoeff.CMz);
-
-    Allreduce_inplace(nMarkerMon, Surface_HF_Visc.data());
-    Allreduce_inplace(nMarkerMon, Surface_MaxHF_Visc.data());
-
-    delete[] buffer;
   }
 
 #endif
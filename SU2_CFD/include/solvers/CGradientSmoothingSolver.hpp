@@ -66,6 +66,16 @@ public:
 
   std::vector<bool> visited;                 /*! <\brief Stores already visited points for surface applications with multiple markers. */
 
+  /*--- Data for the matrix-free application of the volume smoothing operator. ---*/
+  su2vector<su2matvecscalar> edgeWeight;     /*!< \brief Finite-volume Laplacian weight of each edge (scaled face area over distance). */
+  CSysVector<su2matvecscalar> operDiag;      /*!< \brief Diagonal of the matrix-free smoothing operator. */
+  CSysVector<su2matvecscalar> interiorMask;  /*!< \brief One for interior points, zero where Dirichlet conditions apply. */
+  CSysVector<su2matvecscalar> matFreeRhs;    /*!< \brief Right hand side of the matrix-free smoothing system. */
+  CSysVector<su2matvecscalar> matFreeSol;    /*!< \brief Solution of the matrix-free smoothing system. */
+  passivedouble lambdaMin = 0.0;             /*!< \brief Lower spectral bound of the Jacobi-scaled operator (Chebyshev). */
+  passivedouble lambdaMax = 0.0;             /*!< \brief Gershgorin upper bound of the Jacobi-scaled operator (Chebyshev). */
+  bool matrixFreeReady = false;              /*!< \brief Whether the matrix-free operator data has been built. */
+
   /*!
    * \brief The highest level in the variable hierarchy all derived solvers can safely use,
    * CVariable is the common denominator between the FEA and Mesh deformationd variables.
@@ -153,6 +163,19 @@ public:
    */
   void Solve_Linear_System(CGeometry* geometry, const CConfig* config);
 
+  /*!
+   * \brief Build the edge weights, operator diagonal, Dirichlet mask, and spectral
+   * bounds needed to apply the volume smoothing operator matrix-free.
+   */
+  void Compute_MatrixFreeData(CGeometry* geometry, const CConfig* config);
+
+  /*!
+   * \brief Solve the volume smoothing system without assembling the stiffness matrix,
+   * the operator stencil is evaluated on the fly from edge data and the system is
+   * solved with CG accelerated by a Chebyshev polynomial preconditioner.
+   */
+  void Solve_Linear_System_MatrixFree(CGeometry* geometry, const CConfig* config);
+
   /*!
    * \brief Get the matrix vector product with the StiffnessMatrix
    * \note This always applies the stiffness matrix for all dimensions independent of each other!
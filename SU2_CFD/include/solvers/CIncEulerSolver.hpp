@@ -63,8 +63,17 @@ protected:
   void SetPreconditioner(const CConfig *config, unsigned long iPoint,
                          su2double delta, su2activematrix& preconditioner) const;
 
+  /*!
+   * \brief Instantiate a SIMD numerics object.
+   * \param[in] solvers - Container vector with all the solutions.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void InstantiateEdgeNumerics(const CSolver* const* solvers, const CConfig* config) final;
+
   /*!
    * \brief Compute a pressure sensor switch.
+   * \note The halo exchange of the sensor (SENSOR) is left to the caller,
+   *       so that the communication can be overlapped with other work.
    * \param[in] geometry - Geometrical definition of the problem.
    * \param[in] solver_container - Container vector with all the solutions.
    * \param[in] config - Definition of the particular problem.
@@ -32,6 +32,8 @@
 #include "../variables/CScalarVariable.hpp"
 #include "CSolver.hpp"
 
+class CNumericsSIMD;
+
 /*!
  * \class CScalarSolver
  * \brief Main class for defining a scalar solver.
@@ -71,6 +73,9 @@ class CScalarSolver : public CSolver {
   /*--- Edge fluxes for reducer strategy (see the notes in CEulerSolver.hpp). ---*/
   CSysVector<su2double> EdgeFluxes; /*!< \brief Flux across each edge. */
 
+  CNumericsSIMD* edgeNumerics = nullptr; /*!< \brief Object for vectorized edge flux computation. */
+  bool edgeNumericsChecked = false;      /*!< \brief If instantiation of the above was attempted. */
+
   /*!
    * \brief The highest level in the variable hierarchy this solver can safely use.
    */
@@ -171,6 +176,26 @@ class CScalarSolver : public CSolver {
    */
   void SumEdgeFluxes(CGeometry* geometry);
 
+  /*!
+   * \brief Method to compute the convective and viscous residual contributions
+   * with vectorized numerics, instantiating them on first use. If no vectorized
+   * implementation exists for the current model this method does nothing
+   * (edgeNumerics stays null) and callers should use the scalar path instead.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver_container - Container vector with all the solutions.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void EdgeFluxResidual(CGeometry* geometry, CSolver** solver_container, CConfig* config);
+
+  /*!
+   * \brief Instantiate the vectorized numerics for the model of the derived
+   * solver, the turbulence factory is the default (see the species solver for
+   * another family). Returns nullptr if no vectorized implementation applies.
+   * \param[in] solver_container - Container vector with all the solutions.
+   * \param[in] config - Definition of the particular problem.
+   */
+  virtual CNumericsSIMD* InstantiateEdgeNumerics(CSolver** solver_container, const CConfig* config) const;
+
   /*!
    * \brief Compute a suitable under-relaxation parameter to limit the change in the solution variables over
    * a nonlinear iteration for stability. Default value 1.0 set in ctor of CScalarVariable.
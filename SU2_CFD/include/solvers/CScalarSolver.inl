@@ -28,6 +28,7 @@
 #include "../../../Common/include/toolboxes/geometry_toolbox.hpp"
 #include "../../include/solvers/CScalarSolver.hpp"
 #include "../../include/variables/CFlowVariable.hpp"
+#include "../../include/numerics_simd/CNumericsSIMD.hpp"
 
 template <class VariableType>
 CScalarSolver<VariableType>::CScalarSolver(CGeometry* geometry, CConfig* config, bool conservative)
@@ -41,22 +42,28 @@ CScalarSolver<VariableType>::CScalarSolver(CGeometry* geometry, CConfig* config,
   /* A grid is defined as dynamic if there's rigid grid movement or grid deformation AND the problem is time domain */
   dynamic_grid = config->GetDynamic_Grid();
 
+  /*--- The scalar systems can use dedicated linear solver settings (TURB_LINEAR_SOLVER), e.g. a
+   line-implicit smoother for the near-tridiagonal wall-normal systems of RANS problems. ---*/
+  System.SetSolverMode(LINEAR_SOLVER_MODE::TURBULENT);
+
 #ifdef HAVE_OMP
   /*--- Get the edge coloring, see notes in CEulerSolver's constructor. ---*/
   su2double parallelEff = 1.0;
+  if (config->GetEdgeReduction()) geometry->SetNaturalEdgeColoring();
   const auto& coloring = geometry->GetEdgeColoring(&parallelEff);
 
-  ReducerStrategy = parallelEff < COLORING_EFF_THRESH;
+  ReducerStrategy = (parallelEff < COLORING_EFF_THRESH) || config->GetEdgeReduction();
 
   if (ReducerStrategy && (coloring.getOuterSize() > 1)) geometry->SetNaturalEdgeColoring();
 
   if (!coloring.empty()) {
-    auto groupSize = ReducerStrategy ? 1ul : geometry->GetEdgeColorGroupSize();
     auto nColor = coloring.getOuterSize();
     EdgeColoring.reserve(nColor);
 
-    for (auto iColor = 0ul; iColor < nColor; ++iColor)
-      EdgeColoring.emplace_back(coloring.innerIdx(iColor), coloring.getNumNonZeros(iColor), groupSize);
+    for (auto iColor = 0ul; iColor < nColor; ++iColor) {
+      auto chunkSize = ReducerStrategy ? 1ul : geometry->GetEdgeColorChunkSize(iColor);
+      EdgeColoring.emplace_back(coloring.innerIdx(iColor), coloring.getNumNonZeros(iColor), chunkSize);
+    }
   }
 
   nPoint = geometry->GetnPoint();
@@ -75,6 +82,7 @@ CScalarSolver<VariableType>::CScalarSolver(CGeometry* geometry, CConfig* config,
 template <class VariableType>
 CScalarSolver<VariableType>::~CScalarSolver() {
   delete nodes;
+  delete edgeNumerics;
 }
 
 template <class VariableType>
@@ -90,7 +98,13 @@ void CScalarSolver<VariableType>::CommonPreprocessing(CGeometry *geometry, const
    * reducer strategy as we write over the entire matrix. ---*/
   if (!ReducerStrategy && !Output) {
     LinSysRes.SetValZero();
-    if (implicit) {
+
+    /*--- With Jacobian lagging the matrix and its factorization may be
+     *    reused for several iterations, in which case it is not zeroed. ---*/
+    const auto jacLag = config->GetDiscrete_Adjoint()? 1 : config->GetJacobian_Lag_Turb();
+
+    if (implicit && JacobianRefreshDue(jacLag, config->GetJacobian_Lag_Growth(),
+                                       config->GetJacobian_Lag_Sol_Change())) {
       Jacobian.SetValZero();
     } else {
       SU2_OMP_BARRIER
@@ -107,9 +121,24 @@ void CScalarSolver<VariableType>::CommonPreprocessing(CGeometry *geometry, const
     }
   }
 
-  switch(config->GetKind_Gradient_Method()) {
-    case GREEN_GAUSS: SetSolution_Gradient_GG(geometry, config); break;
-    case WEIGHTED_LEAST_SQUARES: SetSolution_Gradient_LS(geometry, config); break;
+  /*--- The gradient may have been computed already by the fused multi-solver sweep
+   *    in the flow solver preprocessing (FUSED_SOLVER_GRADIENTS), in which case
+   *    this solver only clears the flag and skips its own sweep. ---*/
+
+  const bool fusedGradient = fusedGradientDone;
+
+  if (fusedGradient) {
+    SU2_OMP_BARRIER
+    SU2_OMP_MASTER {
+      fusedGradientDone = false;
+    }
+    END_SU2_OMP_MASTER
+  }
+  else {
+    switch(config->GetKind_Gradient_Method()) {
+      case GREEN_GAUSS: SetSolution_Gradient_GG(geometry, config); break;
+      case WEIGHTED_LEAST_SQUARES: SetSolution_Gradient_LS(geometry, config); break;
+    }
   }
 
   if (limiter && muscl) SetSolution_Limiter(geometry, config);
@@ -128,12 +157,45 @@ void CScalarSolver<VariableType>::Upwind_Residual(CGeometry* geometry, CSolver**
 
   /*--- Only reconstruct flow variables if MUSCL is on for flow (requires upwind) and turbulence. ---*/
   const bool musclFlow = config->GetMUSCL_Flow() && muscl && (config->GetKind_ConvNumScheme_Flow() == SPACE_UPWIND);
+
+  /*--- Use the vectorized kernel (fused convective + viscous) if one is
+   *    available for the current model, see EdgeFluxResidual. ---*/
+  if (config->GetUseVectorization()) {
+    EdgeFluxResidual(geometry, solver_container, config);
+    if (edgeNumerics) return;
+  }
   /*--- Only consider flow limiters for cell-based limiters, edge-based would need to be recomputed. ---*/
   const bool limiterFlow =
       (config->GetKind_SlopeLimit_Flow() != LIMITER::NONE) && (config->GetKind_SlopeLimit_Flow() != LIMITER::VAN_ALBADA_EDGE);
 
   auto* flowNodes = su2staticcast_p<CFlowVariable*>(solver_container[FLOW_SOL]->GetNodes());
 
+  /*--- Face-state cache shared by the scalar solvers. The face-normal velocity of the
+   *    scalar upwind schemes (and the flow reconstruction it is based on) only depends
+   *    on the flow primitives, hence the first scalar convective pass of an iteration
+   *    (e.g. turbulence) stores it per edge and subsequent passes (e.g. species) reuse
+   *    it. The cache lives on the flow solver, which invalidates it when the primitives
+   *    change. Only used when two scalar solvers are present, and not while recording a
+   *    tape, as the cached values would be intermediates of another preaccumulation. ---*/
+  auto* flowSolver = solver_container[FLOW_SOL];
+  const auto nPrimVarFlow = flowSolver->GetnPrimVarGrad();
+  const bool coupledScalars = (solver_container[TURB_SOL] != nullptr) && (solver_container[SPECIES_SOL] != nullptr) &&
+                              !config->GetDiscrete_Adjoint();
+  const bool useFaceVelCache = coupledScalars && flowSolver->EdgeFaceVelCacheValid(musclFlow);
+  const bool fillFaceVelCache = coupledScalars && !useFaceVelCache;
+
+  auto& edgeFaceVel = flowSolver->GetEdgeFaceVelCache();
+  auto& edgeFlowPrimVar = flowSolver->GetEdgeFlowPrimVarCache();
+
+  if (fillFaceVelCache) {
+    SU2_OMP_MASTER {
+      edgeFaceVel.resize(geometry->GetnEdge());
+      if (musclFlow) edgeFlowPrimVar.resize(geometry->GetnEdge(), 2 * nPrimVarFlow);
+    }
+    END_SU2_OMP_MASTER
+    SU2_OMP_BARRIER
+  }
+
   /*--- Pick one numerics object per thread. ---*/
   auto* numerics = numerics_container[CONV_TERM + omp_get_thread_num() * MAX_TERMS];
 
@@ -192,7 +254,13 @@ void CScalarSolver<VariableType>::Upwind_Residual(CGeometry* geometry, CSolver**
           Vector_ij[iDim] = 0.5 * (Coord_j[iDim] - Coord_i[iDim]);
         }
 
-        if (musclFlow) {
+        if (musclFlow && useFaceVelCache) {
+          /*--- Reuse the flow reconstruction of a previous scalar pass. ---*/
+
+          const su2double* cachedPrim = edgeFlowPrimVar[iEdge];
+          numerics->SetPrimitive(cachedPrim, cachedPrim + nPrimVarFlow);
+        }
+        else if (musclFlow) {
           /*--- Reconstruct mean flow primitive variables. ---*/
 
           auto Gradient_i = flowNodes->GetGradient_Reconstruction(iPoint);
@@ -203,7 +271,7 @@ void CScalarSolver<VariableType>::Upwind_Residual(CGeometry* geometry, CSolver**
             Limiter_j = flowNodes->GetLimiter_Primitive(jPoint);
           }
 
-          for (iVar = 0; iVar < solver_container[FLOW_SOL]->GetnPrimVarGrad(); iVar++) {
+          for (iVar = 0; iVar < nPrimVarFlow; iVar++) {
             su2double Project_Grad_i = 0.0, Project_Grad_j = 0.0;
             for (iDim = 0; iDim < nDim; iDim++) {
               Project_Grad_i += Vector_ij[iDim] * Gradient_i[iVar][iDim];
@@ -218,6 +286,14 @@ void CScalarSolver<VariableType>::Upwind_Residual(CGeometry* geometry, CSolver**
           }
 
           numerics->SetPrimitive(flowPrimVar_i, flowPrimVar_j);
+
+          if (fillFaceVelCache) {
+            su2double* cachedPrim = edgeFlowPrimVar[iEdge];
+            for (iVar = 0; iVar < nPrimVarFlow; iVar++) {
+              cachedPrim[iVar] = flowPrimVar_i[iVar];
+              cachedPrim[nPrimVarFlow + iVar] = flowPrimVar_j[iVar];
+            }
+          }
         }
 
         if (muscl) {
@@ -251,8 +327,12 @@ void CScalarSolver<VariableType>::Upwind_Residual(CGeometry* geometry, CSolver**
 
       /*--- Update convective residual value ---*/
 
+      if (useFaceVelCache) numerics->SetCachedFaceVel(edgeFaceVel[iEdge]);
+
       auto residual = numerics->ComputeResidual(config);
 
+      if (fillFaceVelCache) edgeFaceVel[iEdge] = numerics->GetFaceVel();
+
       if (ReducerStrategy) {
         EdgeFluxes.SetBlock(iEdge, residual);
         if (implicit) Jacobian.SetBlocks(iEdge, residual.jacobian_i, residual.jacobian_j);
@@ -270,6 +350,14 @@ void CScalarSolver<VariableType>::Upwind_Residual(CGeometry* geometry, CSolver**
     END_SU2_OMP_FOR
   }  // end color loop
 
+  /*--- Mark the face-state cache as filled for the scalar passes that follow. ---*/
+  if (fillFaceVelCache) {
+    SU2_OMP_BARRIER
+    SU2_OMP_MASTER
+    flowSolver->SetEdgeFaceVelCacheValid(musclFlow);
+    END_SU2_OMP_MASTER
+  }
+
   /*--- Restore preaccumulation and adjoint evaluation state. ---*/
   AD::ResumePreaccumulation(pausePreacc);
   if (!ReducerStrategy) AD::EndNoSharedReading();
@@ -296,6 +384,69 @@ void CScalarSolver<VariableType>::SumEdgeFluxes(CGeometry* geometry) {
   END_SU2_OMP_FOR
 }
 
+template <class VariableType>
+CNumericsSIMD* CScalarSolver<VariableType>::InstantiateEdgeNumerics(CSolver** solver_container,
+                                                                    const CConfig* config) const {
+  return CNumericsSIMD::CreateTurbNumerics(*config, nDim, solver_container[FLOW_SOL]->GetNodes());
+}
+
+template <class VariableType>
+void CScalarSolver<VariableType>::EdgeFluxResidual(CGeometry* geometry, CSolver** solver_container, CConfig* config) {
+  /*--- Try to instantiate the vectorized numerics on first use, not all
+   *    models have one, in which case the scalar path must be used. ---*/
+  if (!edgeNumericsChecked) {
+    SU2_OMP_BARRIER
+    SU2_OMP_MASTER {
+      edgeNumerics = InstantiateEdgeNumerics(solver_container, config);
+      edgeNumericsChecked = true;
+    }
+    END_SU2_OMP_MASTER
+    SU2_OMP_BARRIER
+  }
+  if (!edgeNumerics) return;
+
+  /*--- For hybrid parallel AD, pause preaccumulation if there is shared reading of
+   * variables, otherwise switch to the faster adjoint evaluation mode. ---*/
+  bool pausePreacc = false;
+  if (ReducerStrategy)
+    pausePreacc = AD::PausePreaccumulation();
+  else
+    AD::StartNoSharedReading();
+
+  /*--- Loop over edge colors. ---*/
+  for (auto color : EdgeColoring) {
+    /*--- Chunk size is at least OMP_MIN_SIZE and a multiple of the color group size. ---*/
+    SU2_OMP_FOR_DYN(nextMultiple(OMP_MIN_SIZE, color.groupSize))
+    for (auto k = 0ul; k < color.size; k += Double::Size) {
+      Int iEdge;
+      Double mask;
+      for (auto j = 0ul; j < Double::Size; ++j) {
+        bool in = (k + j < color.size);
+        mask[j] = in;
+        iEdge[j] = color.indices[k + j*in];
+      }
+
+      if (ReducerStrategy) {
+        edgeNumerics->ComputeFlux(iEdge, *config, *geometry, *nodes, UpdateType::REDUCTION, mask, EdgeFluxes, Jacobian);
+      } else {
+        edgeNumerics->ComputeFlux(iEdge, *config, *geometry, *nodes, UpdateType::COLORING, mask, LinSysRes, Jacobian);
+      }
+    }
+    END_SU2_OMP_FOR
+  }
+
+  /*--- Restore preaccumulation and adjoint evaluation state. ---*/
+  AD::ResumePreaccumulation(pausePreacc);
+  if (!ReducerStrategy) AD::EndNoSharedReading();
+
+  if (ReducerStrategy) {
+    SumEdgeFluxes(geometry);
+    if (config->GetKind_TimeIntScheme() == EULER_IMPLICIT) {
+      Jacobian.SetDiagonalAsColumnSum();
+    }
+  }
+}
+
 template <class VariableType>
 void CScalarSolver<VariableType>::BC_Periodic(CGeometry* geometry, CSolver** solver_container, CNumerics* numerics,
                                               CConfig* config) {
@@ -72,6 +72,14 @@ protected:
   unsigned short MGLevel;        /*!< \brief Multigrid level of this solver object. */
   unsigned short IterLinSolver;  /*!< \brief Linear solver iterations. */
   su2double ResLinSolver;        /*!< \brief Final linear solver residual. */
+  unsigned long JacRefreshCounter;     /*!< \brief Nonlinear iterations since the Jacobian was last rebuilt (0 = never built). */
+  unsigned short LinIterAtJacRefresh;  /*!< \brief Linear iterations right after the last rebuild, staleness baseline. */
+  bool JacRefreshNow;                  /*!< \brief Outcome of the last call to JacobianRefreshDue. */
+  su2activematrix SolAtJacRefresh;     /*!< \brief Solution snapshot at the last rebuild, for the solution-change trigger. */
+  unsigned long GradRefreshCounter;    /*!< \brief Inner iterations since the gradients were last computed (0 = never computed). */
+  su2double ResAtGradRefresh;          /*!< \brief RMS residual at the last gradient computation, staleness baseline. */
+  bool GradRefreshNow;                 /*!< \brief Outcome of the last call to GradientRefreshDue. */
+  bool fusedGradientDone;              /*!< \brief The solution gradient of the current iteration was computed by a fused multi-solver sweep. */
   unsigned short NonLinRes_Counter;   /*!< \brief Number of elements of the nonlinear residual indicator series. */
   vector<su2double> NonLinRes_Series; /*!< \brief Vector holding the nonlinear residual indicator series. */
   su2double Old_Func,  /*!< \brief Old value of the nonlinear residual indicator. */
@@ -97,6 +105,7 @@ protected:
   vector<unsigned long> Point_Max;     /*!< \brief Vector with the maximal residual for each variable. */
   vector<unsigned long> Point_Max_BGS; /*!< \brief Vector with the maximal residual for each variable. */
   su2activematrix Point_Max_Coord;     /*!< \brief Vector with pointers to the coords of the maximal residual for each variable. */
+  su2activematrix Residual_Sq;         /*!< \brief Per-point squared residuals for fixed-order reductions, empty unless DETERMINISTIC_REDUCTIONS is used. */
   su2activematrix Point_Max_Coord_BGS; /*!< \brief Vector with pointers to the coords of the maximal residual for each variable. */
 
   su2double Total_Custom_ObjFunc = 0.0; /*!< \brief Total custom objective function. */
@@ -135,11 +144,30 @@ protected:
   int *Restart_Vars;                /*!< \brief Auxiliary structure for holding the number of variables and points in a restart. */
   int Restart_ExtIter;              /*!< \brief Auxiliary structure for holding the external iteration offset from a restart. */
   passivedouble *Restart_Data;      /*!< \brief Auxiliary structure for holding the data values from a restart. */
+  void *Restart_Data_Map;           /*!< \brief Base address of a memory-mapped restart file, when set Restart_Data points into the mapping instead of heap memory. */
+  unsigned long Restart_Data_MapSize; /*!< \brief Size (in bytes) of the memory-mapped restart file. */
+  passivedouble *Restart_Data_n;    /*!< \brief Data values of the previous time step carried by a dual-snapshot restart file. */
+  bool Restart_TimeN_Loaded;        /*!< \brief The last restart load placed the previous time step in the time-n container. */
+  vector<unsigned long> Restart_Points; /*!< \brief Global indices of the local records of a sparse (surface) restart. */
   unsigned short nOutputVariables;  /*!< \brief Number of variables to write. */
 
   unsigned long nMarker;            /*!< \brief Total number of markers using the grid information. */
   vector<unsigned long> nVertex;    /*!< \brief Store nVertex at each marker for deallocation */
 
+  mutable vector<vector<unsigned long> > InletProfileMatch; /*!< \brief Profile row matched to each vertex of each inlet marker (point-matched profiles). */
+  mutable vector<unsigned long> InletProfileMatchRows;      /*!< \brief Number of profile rows each vertex-to-row map was built for. */
+
+  su2activematrix SolutionSnapshot; /*!< \brief In-memory copy of the solution for rollback of diverged iterations (see CFL_ADAPT_ROLLBACK). */
+  bool SolutionDiverged = false;    /*!< \brief The last nonlinear residual evaluation detected a divergence (only set when rollback is enabled). */
+
+  /*--- Face-state cache shared by the scalar (turbulence and species) convective passes, stored
+   *    on the flow solver. The first scalar pass of an iteration fills it, the others reuse it,
+   *    see CScalarSolver::Upwind_Residual. ---*/
+  su2activevector EdgeFaceVel;      /*!< \brief Face-normal velocity of the scalar upwind schemes, for each edge. */
+  su2activematrix EdgeFlowPrimVar;  /*!< \brief Reconstructed flow primitives on both sides of each edge (only with flow MUSCL). */
+  bool EdgeFaceVelValid = false;    /*!< \brief The cache holds values for the current flow primitives. */
+  bool EdgeFaceVelMuscl = false;    /*!< \brief The cached values were computed with reconstructed flow primitives. */
+
   bool rotate_periodic;    /*!< \brief Flag that controls whether the periodic solution needs to be rotated for the solver. */
   bool implicit_periodic;  /*!< \brief Flag that controls whether the implicit system should be treated by the periodic BC comms. */
 
@@ -165,6 +193,8 @@ protected:
 
   /*!
    * \brief Compute the undivided laplacian for the solution variables.
+   * \note The halo exchange of the Laplacian (UNDIVIDED_LAPLACIAN) is left to
+   *       the caller, so that the communication can be overlapped with other work.
    * \param[in] geometry - Geometrical definition of the problem.
    * \param[in] config - Definition of the particular problem.
    */
@@ -231,6 +261,51 @@ public:
     return base_nodes;
   }
 
+  /*!
+   * \brief Get the per-edge face-normal velocities of the face-state cache (see EdgeFaceVel).
+   */
+  inline su2activevector& GetEdgeFaceVelCache() { return EdgeFaceVel; }
+
+  /*!
+   * \brief Get the per-edge reconstructed flow primitives of the face-state cache (see EdgeFlowPrimVar).
+   */
+  inline su2activematrix& GetEdgeFlowPrimVarCache() { return EdgeFlowPrimVar; }
+
+  /*!
+   * \brief Check whether the face-state cache can be reused.
+   * \param[in] musclFlow - Whether the consumer reconstructs the flow primitives.
+   * \return True if the cache is filled, for the current flow primitives, with the same reconstruction setting.
+   */
+  inline bool EdgeFaceVelCacheValid(bool musclFlow) const {
+    return EdgeFaceVelValid && (EdgeFaceVelMuscl == musclFlow);
+  }
+
+  /*!
+   * \brief Mark the face-state cache as filled.
+   * \param[in] musclFlow - Whether the cached values were computed with reconstructed flow primitives.
+   */
+  inline void SetEdgeFaceVelCacheValid(bool musclFlow) {
+    EdgeFaceVelValid = true;
+    EdgeFaceVelMuscl = musclFlow;
+  }
+
+  /*!
+   * \brief Invalidate the face-state cache, must be called when the flow primitives change.
+   */
+  inline void InvalidateEdgeFaceVelCache() { EdgeFaceVelValid = false; }
+
+  /*!
+   * \brief Allocate the buffer for fixed-order residual reductions, making the RMS
+   *        residuals independent of the number of threads (see DETERMINISTIC_REDUCTIONS).
+   *        Called once after the solver is instantiated, no-op when the mode is off.
+   * \param[in] config - Definition of the particular problem.
+   */
+  inline void InitDeterministicReductions(const CConfig* config) {
+    if (config->GetDeterministicReductions() && nPoint != 0 && nVar != 0) {
+      Residual_Sq.resize(nPoint, nVar) = su2double(0.0);
+    }
+  }
+
   /*!
    * \brief Helper function to define the type and number of variables per point for each communication type.
    * \param[in] config - Definition of the particular problem.
@@ -303,12 +378,46 @@ public:
                              unsigned short val_periodic_index,
                              unsigned short commType);
 
+  /*!
+   * \brief Decide whether the Jacobian must be rebuilt this nonlinear iteration, or whether
+   *        the lagged Jacobian and its factorization can be reused (see SetFrozen of CSysMatrix).
+   *        The Jacobian is rebuilt every lagIter iterations, or earlier when the linear solver
+   *        needs more than growthTol times the iterations it needed right after the last rebuild.
+   * \note  Must be called by all threads of the parallel region (the decision is made once).
+   * \param[in] lagIter - Number of nonlinear iterations the Jacobian is reused (1 = rebuild always).
+   * \param[in] growthTol - Linear iteration growth factor that triggers an early rebuild.
+   * \param[in] solChangeTol - Relative local solution change that triggers an early rebuild (0 = disabled),
+   *            enabling it snapshots the solution at every rebuild.
+   * \return True if the Jacobian must be rebuilt (and zeroed by the caller).
+   */
+  bool JacobianRefreshDue(unsigned short lagIter, su2double growthTol, su2double solChangeTol = 0.0);
+
+  /*!
+   * \brief Decide whether the reconstruction gradients and limiters must be recomputed this
+   *        inner iteration, or whether the lagged ones can be reused. They are recomputed
+   *        every lagIter iterations, or earlier when the RMS residual grows beyond growthTol
+   *        times its value at the previous computation (the solution started to change
+   *        significantly again, e.g. at the start of a new dual time step).
+   * \note  Must be called by all threads of the parallel region (the decision is made once).
+   * \param[in] lagIter - Number of inner iterations the gradients are reused (1 = recompute always).
+   * \param[in] growthTol - RMS residual growth factor that triggers an early recompute.
+   * \return True if the gradients and limiters must be recomputed.
+   */
+  bool GradientRefreshDue(unsigned short lagIter, su2double growthTol);
+
   /*!
    * \brief Set number of linear solver iterations.
    * \param[in] val_iterlinsolver - Number of linear iterations.
    */
   inline void SetIterLinSolver(unsigned short val_iterlinsolver) { IterLinSolver = val_iterlinsolver; }
 
+  /*!
+   * \brief Flag that the solution gradient of the current iteration was already computed
+   *        by a fused multi-solver sweep (see FUSED_SOLVER_GRADIENTS), so that this
+   *        solver skips its own gradient sweep.
+   */
+  inline void SetGradientComputedExternally() { fusedGradientDone = true; }
+
   /*!
    * \brief Set the final linear solver residual.
    * \param[in] val_reslinsolver - Value of final linear solver residual.
@@ -1417,6 +1526,27 @@ public:
    */
   void ResetCFLAdapt();
 
+  /*!
+   * \brief Store an in-memory copy of the current solution, from which a
+   *        diverged nonlinear iteration can be retried (see CFL_ADAPT_ROLLBACK).
+   */
+  void SnapshotSolution();
+
+  /*!
+   * \brief Restore the solution stored by SnapshotSolution and reduce the local
+   *        CFL numbers, so the diverged iteration is retried at a safer time step.
+   * \param[in] cflFactor - Multiplicative CFL reduction factor (generally < 1).
+   * \param[in] cflMin - Lower bound for the reduced CFL numbers.
+   * \return True if a snapshot was available and the solution was restored.
+   */
+  bool RollbackSolution(su2double cflFactor, su2double cflMin);
+
+  /*!
+   * \brief Get whether the last nonlinear residual evaluation detected a divergence.
+   * \note Only set when CFL_ADAPT_ROLLBACK is enabled, otherwise divergence is fatal.
+   */
+  inline bool GetSolutionDiverged() const { return SolutionDiverged; }
+
   /*!
    * \brief A virtual member.
    * \param[in] geometry - Geometrical definition of the problem.
@@ -3402,10 +3532,60 @@ public:
    * \param[in] geometry - Geometrical definition of the problem.
    * \param[in] config - Definition of the particular problem.
    * \param[in] val_filename - String name of the restart file.
+   * \param[in] val_nFieldsWanted - If nonzero, only the first val_nFieldsWanted
+   *            columns of each point are read, the trailing fields (typically
+   *            output-only quantities) are skipped entirely and Restart_Vars[1]
+   *            reflects the reduced stride of Restart_Data.
    */
   void Read_SU2_Restart_Binary(CGeometry *geometry,
                                const CConfig *config,
-                               string val_filename);
+                               string val_filename,
+                               unsigned short val_nFieldsWanted = 0);
+
+  /*!
+   * \brief Read a sparse SU2 surface restart file (see the RESTART_SURFACE
+   *        output format). Only the records of locally owned points are kept,
+   *        their global indices are stored in Restart_Points.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] val_filename - String name of the restart file.
+   */
+  void Read_SU2_Restart_Surface(CGeometry *geometry,
+                                const CConfig *config,
+                                string val_filename);
+
+  /*!
+   * \brief Read an element-collocated high-order restart file of the FEM DG
+   *        solver (see the RESTART_HIGHORDER output format). The coordinate
+   *        columns are reconstructed from the grid and the element records
+   *        are verified against the mesh.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] val_filename - String name of the restart file.
+   */
+  void Read_SU2_Restart_HighOrder(CGeometry *geometry,
+                                  const CConfig *config,
+                                  string val_filename);
+
+  /*!
+   * \brief Release the memory used to hold the restart data, which may be
+   *        heap memory or a memory-mapped restart file.
+   */
+  void FreeRestartData();
+
+  /*!
+   * \brief Get whether the last restart load also filled the time-n container
+   *        from the second data block of a dual-snapshot restart file.
+   */
+  bool GetRestart_TimeN_Loaded(void) const { return Restart_TimeN_Loaded; }
+
+  /*!
+   * \brief Advise the OS to start reading a restart file into the page cache,
+   *        so the read overlaps with whatever work precedes the actual load.
+   *        A no-op on platforms without posix_fadvise.
+   * \param[in] val_filename - Name of the restart file, without extension.
+   */
+  static void PrefetchRestartFile(const string& val_filename);
 
   /*!
    * \brief Read the metadata from a native SU2 restart file (ASCII or binary).
@@ -4336,10 +4516,17 @@ protected:
    *  \param[in,out] resMax - increases to max(resMax, Residual)
    *  \param[in,out] idxMax - changes when resMax increases
    */
-  static inline void ResidualReductions_PerThread(unsigned long iPoint, unsigned short iVar, su2double res, su2double* resRMS, su2double* resMax,
-                                                  unsigned long* idxMax) {
+  inline void ResidualReductions_PerThread(unsigned long iPoint, unsigned short iVar, su2double res, su2double* resRMS, su2double* resMax,
+                                           unsigned long* idxMax) {
     res = fabs(res);
-    resRMS[iVar] += res * res;
+    if (Residual_Sq.size() != 0) {
+      /*--- Deterministic mode, store the squared residual instead of accumulating
+       *    it, the fixed-order sum happens in ResidualReductions_FromAllThreads. ---*/
+      Residual_Sq(iPoint, iVar) = res * res;
+    }
+    else {
+      resRMS[iVar] += res * res;
+    }
     if (res > resMax[iVar]) {
       resMax[iVar] = res;
       idxMax[iVar] = iPoint;
@@ -4361,6 +4548,21 @@ protected:
     END_SU2_OMP_CRITICAL
     SU2_OMP_BARRIER
 
+    if (Residual_Sq.size() != 0) {
+      /*--- Deterministic mode, sum the per-point squared residuals in a fixed
+       *    order, independent of how the points were partitioned over the
+       *    threads (the buffer is cleared on the fly for the next use, not
+       *    every update loop touches the same point range). ---*/
+      SU2_OMP_MASTER
+      for (auto iPoint = 0ul; iPoint < Residual_Sq.rows(); ++iPoint) {
+        for (unsigned short iVar = 0; iVar < nVar; iVar++) {
+          Residual_RMS[iVar] += Residual_Sq(iPoint, iVar);
+          Residual_Sq(iPoint, iVar) = 0.0;
+        }
+      }
+      END_SU2_OMP_MASTER
+    }
+
     /*--- Compute the root mean square residual ---*/
     SetResidual_RMS(geometry, config);
   }
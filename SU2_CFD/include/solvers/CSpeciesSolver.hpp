@@ -41,6 +41,14 @@ class CSpeciesSolver : public CScalarSolver<CSpeciesVariable> {
   unsigned short Inlet_Position;          /*!< \brief Column index for scalar variables in inlet files. */
   vector<su2activematrix> Inlet_SpeciesVars; /*!< \brief Species variables at inlet profiles. */
 
+  /*!
+   * \brief Instantiate the vectorized species transport numerics instead of
+   * the turbulence ones, see CScalarSolver::EdgeFluxResidual.
+   * \param[in] solver_container - Container vector with all the solutions.
+   * \param[in] config - Definition of the particular problem.
+   */
+  CNumericsSIMD* InstantiateEdgeNumerics(CSolver** solver_container, const CConfig* config) const override;
+
  public:
   /*!
    * \brief Constructor of the class.
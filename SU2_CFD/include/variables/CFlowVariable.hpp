@@ -66,6 +66,12 @@ class CFlowVariable : public CVariable {
                 unsigned long nprimvargrad, const CConfig* config);
 
  public:
+  /*!
+   * \brief Release the halo part of the multigrid and limiter scratch fields.
+   * \param[in] npointdomain - Number of points excluding halos.
+   */
+  void TrimHaloAllocation(unsigned long npointdomain) override;
+
   /*!
    * \brief Get a primitive variable.
    * \param[in] iPoint - Point index.
@@ -36,6 +36,10 @@ protected:
   VectorType WallDistance;  /*!< \brief Store the wall distance in reference coordinates. */
   MatrixType Mesh_Coord;    /*!< \brief Store the reference coordinates of the mesh. */
 
+  su2matrix<float> Disp_n_Compact;   /*!< \brief Single-precision displacements (relative to Mesh_Coord) at time n. */
+  su2matrix<float> Disp_n1_Compact;  /*!< \brief Single-precision displacements (relative to Mesh_Coord) at time n-1. */
+  bool compactHistory = false;       /*!< \brief Whether the displacement history is stored in single precision. */
+
   /*!
    * \brief Constructor of the class.
    * \param[in] npoint - Number of points/nodes/vertices in the domain.
@@ -85,6 +89,49 @@ public:
    */
   inline void SetWallDistance(unsigned long iPoint, su2double val_dist) final { WallDistance(iPoint) = val_dist; }
 
+  /*!
+   * \brief Get the mesh displacement at time n, reconstructed on-the-fly if stored in single precision.
+   * \param[in] iDim - Index of the dimension of interest.
+   * \return Value of the mesh displacement.
+   */
+  inline su2double GetDisp_time_n(unsigned long iPoint, unsigned long iDim) const final {
+    return compactHistory ? su2double(Disp_n_Compact(iPoint,iDim)) : Solution_time_n(iPoint,iDim);
+  }
+
+  /*!
+   * \brief Get the mesh displacement at time n-1, reconstructed on-the-fly if stored in single precision.
+   * \param[in] iDim - Index of the dimension of interest.
+   * \return Value of the mesh displacement.
+   */
+  inline su2double GetDisp_time_n1(unsigned long iPoint, unsigned long iDim) const final {
+    return compactHistory ? su2double(Disp_n1_Compact(iPoint,iDim)) : Solution_time_n1(iPoint,iDim);
+  }
+
+  /*!
+   * \brief Set the mesh displacement at time n.
+   * \param[in] iDim - Index of the dimension of interest.
+   * \param[in] val_disp - Value of the mesh displacement.
+   */
+  inline void SetDisp_time_n(unsigned long iPoint, unsigned long iDim, su2double val_disp) final {
+    if (compactHistory) Disp_n_Compact(iPoint,iDim) = SU2_TYPE::GetValue(val_disp);
+    else Solution_time_n(iPoint,iDim) = val_disp;
+  }
+
+  /*!
+   * \brief Set the mesh displacement at time n-1.
+   * \param[in] iDim - Index of the dimension of interest.
+   * \param[in] val_disp - Value of the mesh displacement.
+   */
+  inline void SetDisp_time_n1(unsigned long iPoint, unsigned long iDim, su2double val_disp) final {
+    if (compactHistory) Disp_n1_Compact(iPoint,iDim) = SU2_TYPE::GetValue(val_disp);
+    else Solution_time_n1(iPoint,iDim) = val_disp;
+  }
+
+  /*!
+   * \brief Shift the mesh displacement history (n -> n-1, n+1 -> n).
+   */
+  void Shift_DispHistory() final;
+
   /*!
    * \brief Register the reference coordinates of the mesh.
    */
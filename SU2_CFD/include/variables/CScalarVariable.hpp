@@ -52,6 +52,15 @@ class CScalarVariable : public CVariable {
    */
   CScalarVariable(unsigned long npoint, unsigned long ndim, unsigned long nvar, const CConfig* config);
 
+  /*!
+   * \brief Release the halo part of the limiter scratch fields.
+   * \param[in] npointdomain - Number of points excluding halos.
+   */
+  inline void TrimHaloAllocation(unsigned long npointdomain) override {
+    Solution_Max.resize(npointdomain, nVar) = su2double(0.0);
+    Solution_Min.resize(npointdomain, nVar) = su2double(0.0);
+  }
+
   /*!
    * \brief Get the array of the reconstruction variables gradient at a node.
    * \param[in] iPoint - Index of the current node.
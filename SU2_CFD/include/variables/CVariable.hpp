@@ -51,10 +51,24 @@ protected:
   using VectorType = C2DContainer<unsigned long, su2double, StorageType::ColumnMajor, 64, DynamicSize, 1>;
   using MatrixType = C2DContainer<unsigned long, su2double, StorageType::RowMajor,    64, DynamicSize, DynamicSize>;
 
+  /*--- Fields that are only accessed element-wise can use a structure-of-arrays
+   *    (column-major) layout, so that the values of one variable for consecutive
+   *    points are contiguous, which helps vectorization of the point loops in the
+   *    gradient and limiter kernels. Fields accessed through row pointers (e.g.
+   *    GetSolution(iPoint)) need to remain row-major. ---*/
+#ifdef USE_SOA_VARIABLES
+  using SoAMatrixType = C2DContainer<unsigned long, su2double, StorageType::ColumnMajor, 64, DynamicSize, DynamicSize>;
+#else
+  using SoAMatrixType = MatrixType;
+#endif
+
   MatrixType Solution;       /*!< \brief Solution of the problem. */
   MatrixType Solution_Old;   /*!< \brief Old solution of the problem R-K. */
 
-  MatrixType External;       /*!< \brief External (outer) contribution in discrete adjoint multizone problems. */
+  MatrixType External;       /*!< \brief External (outer) contribution in discrete adjoint multizone problems, materialized lazily on first write. */
+
+  static unsigned long ExternalPotentialBytes;    /*!< \brief Accounting, bytes the external containers would occupy if all were materialized. */
+  static unsigned long ExternalMaterializedBytes; /*!< \brief Accounting, bytes of external containers actually materialized. */
 
   su2vector<bool> Non_Physical;  /*!< \brief Non-physical points in the solution (force first order). */
   su2vector<unsigned short>
@@ -72,10 +86,10 @@ protected:
   C3DDoubleMatrix Rmatrix;   /*!< \brief Geometry-based matrix for weighted least squares gradient calculations. */
 
   MatrixType Limiter;        /*!< \brief Limiter of the solution of the problem. */
-  MatrixType Solution_Max;   /*!< \brief Max solution for limiter computation. */
-  MatrixType Solution_Min;   /*!< \brief Min solution for limiter computation. */
+  SoAMatrixType Solution_Max;   /*!< \brief Max solution for limiter computation. */
+  SoAMatrixType Solution_Min;   /*!< \brief Min solution for limiter computation. */
 
-  MatrixType AuxVar;             /*!< \brief Auxiliary variable for gradient computation. */
+  SoAMatrixType AuxVar;          /*!< \brief Auxiliary variable for gradient computation. */
   CVectorOfMatrix Grad_AuxVar;   /*!< \brief Gradient of the auxiliary variables of the problem. */
 
   VectorType Max_Lambda_Inv;   /*!< \brief Maximun inviscid eingenvalue. */
@@ -166,6 +180,13 @@ public:
    */
   virtual ~CVariable() = default;
 
+  /*!
+   * \brief Release the halo part of auxiliary fields that are only accessed for
+   *        domain points (see SLIM_HALO), derived classes shrink their fields.
+   * \param[in] npointdomain - Number of points excluding halos.
+   */
+  inline virtual void TrimHaloAllocation(unsigned long npointdomain) {}
+
   /*!
    * \brief Get the number of auxiliary variables.
    */
@@ -391,6 +412,25 @@ public:
    */
   void SetExternalZero();
 
+  /*!
+   * \brief Allocate (zero-initialized) the external contributions container on first use.
+   *        Callers of ::Add_External must materialize the container first; a container
+   *        that was never materialized reads as zero.
+   */
+  void MaterializeExternal();
+
+  /*!
+   * \brief Check whether the external contributions container has been materialized.
+   */
+  inline bool ExternalMaterialized() const { return External.size() != 0; }
+
+  /*!
+   * \brief Get the accounting of the lazily materialized external containers.
+   * \return Materialized and potential storage in bytes (all variable sets of this rank).
+   */
+  static unsigned long GetExternalMaterializedBytes() { return ExternalMaterializedBytes; }
+  static unsigned long GetExternalPotentialBytes() { return ExternalPotentialBytes; }
+
   /*!
    * \brief Set Dual-time derivative contributions to the external.
    */
@@ -581,7 +621,7 @@ public:
    * \brief Get the entire Aux matrix of the problem.
    * \return Reference to the aux var  matrix.
    */
-  inline const MatrixType& GetAuxVar(void) const { return AuxVar; }
+  inline const SoAMatrixType& GetAuxVar(void) const { return AuxVar; }
 
   /*!
    * \brief Get the Aux var value at Point i, variable j.
@@ -714,6 +754,7 @@ public:
    * \return Reference to gradient.
    */
   inline CVectorOfMatrix& GetGradient(void) { return Gradient; }
+  inline const CVectorOfMatrix& GetGradient(void) const { return Gradient; }
 
   /*!
    * \brief Get the value of the solution gradient.
@@ -780,15 +821,15 @@ public:
    * \brief Get the min solution.
    * \return Value of the min solution for the domain.
    */
-  inline MatrixType& GetSolution_Max() { return Solution_Max; }
-  inline const MatrixType& GetSolution_Max() const { return Solution_Max; }
+  inline SoAMatrixType& GetSolution_Max() { return Solution_Max; }
+  inline const SoAMatrixType& GetSolution_Max() const { return Solution_Max; }
 
   /*!
    * \brief Get the min solution.
    * \return Value of the min solution for the domain.
    */
-  inline MatrixType& GetSolution_Min() { return Solution_Min; }
-  inline const MatrixType& GetSolution_Min() const { return Solution_Min; }
+  inline SoAMatrixType& GetSolution_Min() { return Solution_Min; }
+  inline const SoAMatrixType& GetSolution_Min() const { return Solution_Min; }
 
   /*!
    * \brief Get the value of the wind gust
@@ -2038,6 +2079,39 @@ public:
    */
   inline virtual void SetWallDistance(unsigned long iPoint, su2double val_dist) { }
 
+  /*!
+   * \brief A virtual member. Get the mesh displacement at time n.
+   * \param[in] iDim - Index of the dimension of interest.
+   * \return Value of the mesh displacement.
+   */
+  inline virtual su2double GetDisp_time_n(unsigned long iPoint, unsigned long iDim) const { return 0.0; }
+
+  /*!
+   * \brief A virtual member. Get the mesh displacement at time n-1.
+   * \param[in] iDim - Index of the dimension of interest.
+   * \return Value of the mesh displacement.
+   */
+  inline virtual su2double GetDisp_time_n1(unsigned long iPoint, unsigned long iDim) const { return 0.0; }
+
+  /*!
+   * \brief A virtual member. Set the mesh displacement at time n.
+   * \param[in] iDim - Index of the dimension of interest.
+   * \param[in] val_disp - Value of the mesh displacement.
+   */
+  inline virtual void SetDisp_time_n(unsigned long iPoint, unsigned long iDim, su2double val_disp) { }
+
+  /*!
+   * \brief A virtual member. Set the mesh displacement at time n-1.
+   * \param[in] iDim - Index of the dimension of interest.
+   * \param[in] val_disp - Value of the mesh displacement.
+   */
+  inline virtual void SetDisp_time_n1(unsigned long iPoint, unsigned long iDim, su2double val_disp) { }
+
+  /*!
+   * \brief A virtual member. Shift the mesh displacement history (n -> n-1, n+1 -> n).
+   */
+  inline virtual void Shift_DispHistory() { }
+
   /*!
    * \brief A virtual member. Register the reference coordinates of the mesh.
    */
@@ -315,6 +315,18 @@ void CDiscAdjMultizoneDriver::Run() {
 
   const auto zeroGrad = EvaluateObjectiveFunctionGradient();
 
+  /*--- Report the accounting of the lazily materialized adjoint external storage,
+   *    at this point every solver that participates in the coupling has touched
+   *    its container (see CVariable::MaterializeExternal). ---*/
+
+  if (rank == MASTER_NODE) {
+    const passivedouble toMB = 1.0/(1024.0*1024.0);
+    cout << "Adjoint external storage (this rank): "
+         << CVariable::GetExternalMaterializedBytes()*toMB << " of "
+         << CVariable::GetExternalPotentialBytes()*toMB
+         << " MB materialized (lazy allocation).\n" << endl;
+  }
+
   if (zeroGrad && !time_domain) {
     if (rank == MASTER_NODE) {
       cout << "\nThe gradient of the objective function is numerically 0.";
@@ -372,10 +384,14 @@ void CDiscAdjMultizoneDriver::Run() {
       const bool no_restart = (iOuterIter > 0) || !restart;
       eval_transfer = false;
 
-      /*--- Reset QN driver for new inner iterations. ---*/
+      /*--- Reset QN driver for new inner iterations, or keep its samples
+       * to warm start them if history re-use is enabled. ---*/
 
       if (FixPtCorrector[iZone].size()) {
-        FixPtCorrector[iZone].reset();
+        if (config_container[iZone]->GetQuasiNewtonReuseHistory())
+          FixPtCorrector[iZone].newTimeStep();
+        else
+          FixPtCorrector[iZone].reset();
         if(restart && (iOuterIter==1)) GetAllSolutions(iZone, true, FixPtCorrector[iZone]);
       }
 
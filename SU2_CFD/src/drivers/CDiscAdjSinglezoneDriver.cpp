@@ -32,7 +32,7 @@
 #include "../../include/output/COutput.hpp"
 #include "../../include/iteration/CIterationFactory.hpp"
 #include "../../include/iteration/CTurboIteration.hpp"
-#include "../../../Common/include/toolboxes/CQuasiNewtonInvLeastSquares.hpp"
+#include "../../../Common/include/grid_movement/CSurfaceMovement.hpp"
 
 CDiscAdjSinglezoneDriver::CDiscAdjSinglezoneDriver(char* confFile,
                                                    unsigned short val_nZone,
@@ -133,6 +133,15 @@ void CDiscAdjSinglezoneDriver::Preprocess(unsigned long TimeIter) {
 
   config_container[ZONE_0]->SetTimeIter(TimeIter);
 
+  /*--- With checkpoint-based restarts, regenerate the direct solution files that the
+   *    unsteady preprocessing below expects but that were not kept on disk. ---*/
+
+  if ((config->GetAdjoint_Checkpoint_Interval() > 1) && config->GetTime_Domain() &&
+      (MainSolver == ADJFLOW_SOL) && !config->GetDynamic_Grid() && !config->GetDeform_Mesh() &&
+      !config->GetBoolTurbomachinery()) {
+    RecomputeDirectStates(TimeIter);
+  }
+
   /*--- Preprocess the adjoint iteration ---*/
 
   iteration->Preprocess(output_container[ZONE_0], integration_container, geometry_container,
@@ -149,15 +158,164 @@ void CDiscAdjSinglezoneDriver::Preprocess(unsigned long TimeIter) {
 
 }
 
+void CDiscAdjSinglezoneDriver::LoadDirectState(int DirectIter) {
+
+  auto solvers = solver_container[ZONE_0][INST_0];
+  auto geometries = geometry_container[ZONE_0][INST_0];
+
+  solvers[MESH_0][FLOW_SOL]->LoadRestart(geometries, solvers, config, DirectIter, true);
+
+  if (config->GetKind_Turb_Model() != TURB_MODEL::NONE) {
+    solvers[MESH_0][TURB_SOL]->LoadRestart(geometries, solvers, config, DirectIter, false);
+  }
+  if (config->GetKind_Species_Model() != SPECIES_MODEL::NONE) {
+    solvers[MESH_0][SPECIES_SOL]->LoadRestart(geometries, solvers, config, DirectIter, false);
+  }
+  if (config->GetWeakly_Coupled_Heat()) {
+    solvers[MESH_0][HEAT_SOL]->LoadRestart(geometries, solvers, config, DirectIter, false);
+  }
+}
+
+void CDiscAdjSinglezoneDriver::RecomputeDirectStates(unsigned long TimeIter) {
+
+  const long K = static_cast<long>(config->GetAdjoint_Checkpoint_Interval());
+  const bool dual_time_2nd = (config->GetTime_Marching() == TIME_MARCHING::DT_STEPPING_2ND);
+  const bool dual_time = (config->GetTime_Marching() == TIME_MARCHING::DT_STEPPING_1ST) || dual_time_2nd;
+  const bool turbulent = config->GetKind_Turb_Model() != TURB_MODEL::NONE;
+  const bool species = config->GetKind_Species_Model() != SPECIES_MODEL::NONE;
+  const bool heat = config->GetWeakly_Coupled_Heat();
+  const bool binary = config->GetRead_Binary_Restart();
+
+  if (!dual_time) return;
+
+  /*--- Push the currently loaded solution into the dual-time history arrays. ---*/
+
+  auto pushHistory = [&](bool also_n1) {
+    for (auto iMesh = 0u; iMesh <= config->GetnMGLevels(); iMesh++) {
+      auto solvers = solver_container[ZONE_0][INST_0][iMesh];
+      solvers[FLOW_SOL]->GetNodes()->Set_Solution_time_n();
+      if (also_n1) solvers[FLOW_SOL]->GetNodes()->Set_Solution_time_n1();
+      if (turbulent) {
+        solvers[TURB_SOL]->GetNodes()->Set_Solution_time_n();
+        if (also_n1) solvers[TURB_SOL]->GetNodes()->Set_Solution_time_n1();
+      }
+      if (species) {
+        solvers[SPECIES_SOL]->GetNodes()->Set_Solution_time_n();
+        if (also_n1) solvers[SPECIES_SOL]->GetNodes()->Set_Solution_time_n1();
+      }
+      if (heat) {
+        solvers[HEAT_SOL]->GetNodes()->Set_Solution_time_n();
+        if (also_n1) solvers[HEAT_SOL]->GetNodes()->Set_Solution_time_n1();
+      }
+    }
+  };
+
+  /*--- Steps the unsteady preprocessing is about to load from file, see
+   *    CDiscAdjFluidIteration::Preprocess. The final direct step is the highest
+   *    step the reverse sweep will ever request. ---*/
+
+  const long Direct_Iter = long(config->GetUnst_AdjointIter()) - long(TimeIter) - 2 + dual_time;
+  const long lastStep = long(config->GetUnst_AdjointIter()) - 2 + dual_time;
+  const long firstNeeded = Direct_Iter - 1 - dual_time_2nd;
+  const long lastNeeded = (TimeIter == 0) ? Direct_Iter : firstNeeded;
+
+  bool recomputed = false;
+
+  for (long step = lastNeeded; step >= max(firstNeeded, 0l); --step) {
+
+    /*--- Stored checkpoints and already regenerated windows need no work. ---*/
+
+    if (step % K == 0) continue;
+    const long windowStart = (step / K) * K;
+    if ((windowStart == RecomputedWindowStart) || (windowStart == CleanupWindowStart)) continue;
+
+    /*--- The volume output is only needed if files have to be regenerated. ---*/
+
+    if (RecomputedWindowStart < 0) direct_output->PreprocessVolumeOutput(config);
+
+    const long windowEnd = min(windowStart + K - 1, lastStep);
+
+    if (rank == MASTER_NODE)
+      cout << " Recomputing direct steps " << windowStart + 1 << " through " << windowEnd
+           << " from checkpoint " << windowStart << "." << endl;
+
+    /*--- Seed the dual-time history from the checkpoint and, for second order,
+     *    from its predecessor (which the primal run must also have stored). ---*/
+
+    if (dual_time_2nd) {
+      LoadDirectState(int(max(windowStart - 1, 0l)));
+      pushHistory(true);
+    }
+    LoadDirectState(int(windowStart));
+    pushHistory(false);
+
+    /*--- March the direct solver forward through the window, writing each step
+     *    with the solution-file name that the loading routines expect. ---*/
+
+    for (long n = windowStart + 1; n <= windowEnd; ++n) {
+
+      config->SetTimeIter(n);
+
+      direct_iteration->Solve(direct_output, integration_container, geometry_container, solver_container,
+                              numerics_container, config_container, surface_movement, grid_movement, FFDBox,
+                              ZONE_0, INST_0);
+
+      direct_output->Load_Data(geometry, config, solver);
+      direct_output->WriteToFile(config, geometry, binary ? OUTPUT_TYPE::RESTART_BINARY : OUTPUT_TYPE::RESTART_ASCII,
+                                 config->GetFilename(config->GetSolution_FileName(), "", int(n)));
+
+      direct_iteration->Update(direct_output, integration_container, geometry_container, solver_container,
+                               numerics_container, config_container, surface_movement, grid_movement, FFDBox,
+                               ZONE_0, INST_0);
+    }
+
+    /*--- Transient files two windows back cannot be requested anymore, delete
+     *    them so the disk footprint stays bounded by two windows. ---*/
+
+    if ((CleanupWindowStart >= 0) && (rank == MASTER_NODE)) {
+      const string ext = binary ? ".dat" : ".csv";
+      const long cleanupEnd = min(CleanupWindowStart + K - 1, lastStep);
+      for (long n = CleanupWindowStart + 1; n <= cleanupEnd; ++n)
+        remove((config->GetFilename(config->GetSolution_FileName(), "", int(n)) + ext).c_str());
+    }
+    CleanupWindowStart = RecomputedWindowStart;
+    RecomputedWindowStart = windowStart;
+    recomputed = true;
+  }
+
+  /*--- The recomputation overwrote the working arrays, restore the in-memory
+   *    states that the shift logic of the unsteady preprocessing relies on for
+   *    TimeIter > 0 (all three steps are available on disk at this point). ---*/
+
+  if (recomputed && (TimeIter > 0)) {
+    if (dual_time_2nd) {
+      LoadDirectState(int(max(Direct_Iter - 1, 0l)));
+      pushHistory(true);
+    }
+    LoadDirectState(int(max(Direct_Iter, 0l)));
+    pushHistory(false);
+    LoadDirectState(int(Direct_Iter + 1));
+  }
+
+  config->SetTimeIter(TimeIter);
+}
+
 void CDiscAdjSinglezoneDriver::Run() {
 
-  CQuasiNewtonInvLeastSquares<passivedouble> fixPtCorrector;
   if (config->GetnQuasiNewtonSamples() > 1) {
-    fixPtCorrector.resize(config->GetnQuasiNewtonSamples(),
-                          geometry_container[ZONE_0][INST_0][MESH_0]->GetnPoint(),
-                          GetTotalNumberOfVariables(ZONE_0,true),
-                          geometry_container[ZONE_0][INST_0][MESH_0]->GetnPointDomain());
-
+    if (!fixPtCorrector.size()) {
+      fixPtCorrector.resize(config->GetnQuasiNewtonSamples(),
+                            geometry_container[ZONE_0][INST_0][MESH_0]->GetnPoint(),
+                            GetTotalNumberOfVariables(ZONE_0,true),
+                            geometry_container[ZONE_0][INST_0][MESH_0]->GetnPointDomain());
+    }
+    else if (config->GetQuasiNewtonReuseHistory()) {
+      /*--- Keep the samples of the previous time step to warm start this one. ---*/
+      fixPtCorrector.newTimeStep();
+    }
+    else {
+      fixPtCorrector.reset();
+    }
     if (TimeIter != 0) GetAllSolutions(ZONE_0, true, fixPtCorrector);
   }
 
@@ -171,9 +329,11 @@ void CDiscAdjSinglezoneDriver::Run() {
 
     iteration->InitializeAdjoint(solver_container, geometry_container, config_container, ZONE_0, INST_0);
 
-    /*--- Initialize the adjoint of the objective function with 1.0. ---*/
+    /*--- Initialize the adjoint of the objective function with 1.0. With a compact main tape
+     *    the objective function is not on the tape, its cached gradient enters the iteration
+     *    through the External containers when the output adjoints are seeded. ---*/
 
-    SetAdj_ObjFunction();
+    if (!CompactMainTape) SetAdj_ObjFunction();
 
     /*--- Interpret the stored information by calling the corresponding routine of the AD tool. ---*/
 
@@ -224,6 +384,10 @@ void CDiscAdjSinglezoneDriver::Postprocess() {
 
       /*--- Compute the geometrical sensitivities ---*/
       SecondaryRecording();
+
+      /*--- Optionally project them onto the design variables in-process,
+       instead of a separate SU2_DOT_AD run. ---*/
+      if (config->GetProjectGradient()) ProjectSensitivityToDV();
       break;
 
     case MAIN_SOLVER::DISC_ADJ_FEM :
@@ -243,7 +407,7 @@ void CDiscAdjSinglezoneDriver::Postprocess() {
 
 }
 
-void CDiscAdjSinglezoneDriver::SetRecording(RECORDING kind_recording){
+void CDiscAdjSinglezoneDriver::SetRecording(RECORDING kind_recording, bool objective_function_tape){
 
   AD::Reset();
 
@@ -264,12 +428,25 @@ void CDiscAdjSinglezoneDriver::SetRecording(RECORDING kind_recording){
     case RECORDING::CLEAR_INDICES: cout << "Clearing the computational graph." << endl; break;
     case RECORDING::MESH_COORDS:   cout << "Storing computational graph wrt MESH COORDINATES." << endl; break;
     case RECORDING::SOLUTION_VARIABLES:
-      cout << "Direct iteration to store the primal computational graph." << endl;
-      cout << "Computing residuals to check the convergence of the direct problem." << endl; break;
+      if (objective_function_tape) {
+        cout << "Storing computational graph of the objective function." << endl;
+      } else {
+        cout << "Direct iteration to store the primal computational graph." << endl;
+        cout << "Computing residuals to check the convergence of the direct problem." << endl;
+      }
+      break;
     default: break;
     }
   }
 
+  /*--- Track the tape growth of each recording section to break down where
+   the tape memory goes (only reported with WRT_AD_STATISTICS). ---*/
+
+#ifdef CODI_REVERSE_TYPE
+  auto tapeMem = []() { return SU2_TYPE::GetValue(AD::getGlobalTape().getTapeValues().getUsedMemorySize()); };
+  passivedouble memInput = 0.0, memDeps = 0.0, memIter = 0.0, memOutput = 0.0;
+#endif
+
   /*---Enable recording and register input of the iteration --- */
 
   if (kind_recording != RECORDING::CLEAR_INDICES){
@@ -279,30 +456,65 @@ void CDiscAdjSinglezoneDriver::SetRecording(RECORDING kind_recording){
     iteration->RegisterInput(solver_container, geometry_container, config_container, ZONE_0, INST_0, kind_recording);
   }
 
+#ifdef CODI_REVERSE_TYPE
+  memInput = tapeMem();
+#endif
+
   /*--- Set the dependencies of the iteration ---*/
 
   iteration->SetDependencies(solver_container, geometry_container, numerics_container, config_container, ZONE_0,
                              INST_0, kind_recording);
 
-  /*--- Do one iteration of the direct solver ---*/
+#ifdef CODI_REVERSE_TYPE
+  memDeps = tapeMem();
+#endif
 
-  DirectRun(kind_recording);
+  if (objective_function_tape) {
 
-  /*--- Store the recording state ---*/
+    /*--- Record only the evaluation of the objective function at the converged solution,
+     *    the resulting tape does not hold an iteration of the direct solver. ---*/
 
-  RecordingState = kind_recording;
+    SetObjFunction();
 
-  /*--- Register Output of the iteration ---*/
+    RecordingState = RECORDING::CLEAR_INDICES;
+  }
+  else {
+
+    /*--- Do one iteration of the direct solver ---*/
+
+    DirectRun(kind_recording);
 
-  iteration->RegisterOutput(solver_container, geometry_container, config_container, ZONE_0, INST_0);
+#ifdef CODI_REVERSE_TYPE
+    memIter = tapeMem();
+#endif
 
-  /*--- Extract the objective function and store it --- */
+    /*--- Store the recording state ---*/
 
-  SetObjFunction();
+    RecordingState = kind_recording;
+
+    /*--- Register Output of the iteration ---*/
+
+    iteration->RegisterOutput(solver_container, geometry_container, config_container, ZONE_0, INST_0);
+
+    /*--- Extract the objective function and store it. With a compact main tape its gradient
+     *    was cached from a dedicated recording, see CacheObjFunctionGradient. --- */
+
+    if (!(CompactMainTape && (kind_recording == MainVariables))) SetObjFunction();
+  }
 
   if (kind_recording != RECORDING::CLEAR_INDICES && config_container[ZONE_0]->GetWrt_AD_Statistics()) {
     if (rank == MASTER_NODE) AD::PrintStatistics();
 #ifdef CODI_REVERSE_TYPE
+    memOutput = tapeMem();
+    if (rank == MASTER_NODE) {
+      cout << "Tape memory per recording section (rank 0)\n";
+      cout << "-------------------------------------\n";
+      cout << "  Input registration     :  " << memInput << " MB\n";
+      cout << "  Dependencies           :  " << memDeps - memInput << " MB\n";
+      if (memIter > 0.0) cout << "  Direct iteration       :  " << memIter - memDeps << " MB\n";
+      cout << "  Output + objective     :  " << memOutput - max(memIter, memDeps) << " MB\n";
+      cout << "-------------------------------------\n" << endl;
+    }
     if (size > SINGLE_NODE) {
       su2double myMem = AD::getGlobalTape().getTapeValues().getUsedMemorySize(), totMem = 0.0;
       SU2_MPI::Allreduce(&myMem, &totMem, 1, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
@@ -435,9 +647,21 @@ void CDiscAdjSinglezoneDriver::DirectRun(RECORDING kind_recording){
 
 void CDiscAdjSinglezoneDriver::MainRecording(){
   /*--- SetRecording stores the computational graph on one iteration of the direct problem. Calling it with
-   *    RECORDING::CLEAR_INDICES as argument ensures that all information from a previous recording is removed. ---*/
+   *    RECORDING::CLEAR_INDICES as argument ensures that all information from a previous recording is removed.
+   *    The clearing pass is one full direct evaluation, it is skipped if the graph is already clear,
+   *    e.g. on the first recording of a design cycle. ---*/
+
+  if (RecordingState != RECORDING::CLEAR_INDICES) SetRecording(RECORDING::CLEAR_INDICES);
+
+  /*--- With a compact main tape the gradient of the objective function is recorded and
+   *    evaluated once here, instead of being part of every fixed-point iteration. ---*/
 
-  SetRecording(RECORDING::CLEAR_INDICES);
+  CompactMainTape = UseCompactMainTape();
+
+  if (CompactMainTape) {
+    CacheObjFunctionGradient();
+    SetRecording(RECORDING::CLEAR_INDICES);
+  }
 
   /*--- Store the computational graph of one direct iteration with the solution variables as input. ---*/
 
@@ -445,16 +669,97 @@ void CDiscAdjSinglezoneDriver::MainRecording(){
 
 }
 
+bool CDiscAdjSinglezoneDriver::UseCompactMainTape() const {
+
+  if (!config->GetCompact_Adjoint_Tape()) return false;
+
+  /*--- The gradient of the objective function is only constant across the fixed-point
+   *    iterations for steady problems (no windowed time averaging, no dual-time terms
+   *    in the seeding of the output adjoints). ---*/
+
+  if (config->GetTime_Domain()) return false;
+
+  /*--- Restrict the optimization to the flow and heat adjoints, for which the objective
+   *    function is a plain evaluation at the converged solution. ---*/
+
+  switch (config->GetKind_Solver()) {
+    case MAIN_SOLVER::DISC_ADJ_EULER:     case MAIN_SOLVER::DISC_ADJ_NAVIER_STOKES:     case MAIN_SOLVER::DISC_ADJ_RANS:
+    case MAIN_SOLVER::DISC_ADJ_INC_EULER: case MAIN_SOLVER::DISC_ADJ_INC_NAVIER_STOKES: case MAIN_SOLVER::DISC_ADJ_INC_RANS:
+    case MAIN_SOLVER::DISC_ADJ_HEAT:
+      break;
+    default: return false;
+  }
+
+  /*--- Turbomachinery objectives are computed through legacy output structures. ---*/
+
+  if (config->GetBoolTurbomachinery()) return false;
+
+  /*--- The External containers do not cover extra adjoint degrees of freedom. ---*/
+
+  for (auto iSol = 0u; iSol < MAX_SOLS; iSol++) {
+    if (solver[iSol] && solver[iSol]->GetAdjoint() &&
+        (solver[iSol]->GetNodes()->GetSolutionExtra().size() != 0)) return false;
+  }
+
+  return true;
+}
+
+void CDiscAdjSinglezoneDriver::CacheObjFunctionGradient() {
+
+  /*--- Record the dependence of the objective function on the solution variables. ---*/
+
+  SetRecording(MainVariables, true);
+
+  /*--- Evaluate it once, seeding only the objective function. ---*/
+
+  AD::ClearAdjoints();
+  SetAdj_ObjFunction();
+  AD::ComputeAdjoint();
+
+  /*--- Extract the gradient into the External containers. The extraction overwrites the
+   *    adjoint solution (restart or previous design iteration), which is restored after. ---*/
+
+  su2passivematrix solutionSnapshot(geometry->GetnPoint(), GetTotalNumberOfVariables(ZONE_0, true));
+  GetAllSolutions(ZONE_0, true, solutionSnapshot);
+
+  /*--- Extract without relaxation (relaxation is not applied on the first inner iteration). ---*/
+
+  config->SetInnerIter(0);
+
+  iteration->IterateDiscAdj(geometry_container, solver_container, config_container, ZONE_0, INST_0, false);
+
+  for (auto iSol = 0u; iSol < MAX_SOLS; iSol++) {
+    if (solver[iSol] && solver[iSol]->GetAdjoint()) {
+      solver[iSol]->GetNodes()->SetExternalZero();
+      solver[iSol]->Add_Solution_To_External();
+    }
+  }
+
+  SetAllSolutions(ZONE_0, true, solutionSnapshot);
+
+  AD::ClearAdjoints();
+}
+
 void CDiscAdjSinglezoneDriver::SecondaryRecording(){
   /*--- SetRecording stores the computational graph on one iteration of the direct problem. Calling it with
-   *    RECORDING::CLEAR_INDICES as argument ensures that all information from a previous recording is removed. ---*/
+   *    RECORDING::CLEAR_INDICES as argument ensures that all information from a previous recording is removed.
+   *    See MainRecording for why the pass is conditional. ---*/
 
-  SetRecording(RECORDING::CLEAR_INDICES);
+  if (RecordingState != RECORDING::CLEAR_INDICES) SetRecording(RECORDING::CLEAR_INDICES);
 
   /*--- Store the computational graph of one direct iteration with the secondary variables as input. ---*/
 
   SetRecording(SecondaryVariables);
 
+  /*--- The secondary tape holds the objective function, clear the cached gradient so that
+   *    it is not seeded a second time through the External containers. ---*/
+
+  if (CompactMainTape) {
+    for (auto iSol = 0u; iSol < MAX_SOLS; iSol++) {
+      if (solver[iSol] && solver[iSol]->GetAdjoint()) solver[iSol]->GetNodes()->SetExternalZero();
+    }
+  }
+
   /*--- Initialize the adjoint of the output variables of the iteration with the adjoint solution
    *    of the current iteration. The values are passed to the AD tool. ---*/
 
@@ -482,3 +787,100 @@ void CDiscAdjSinglezoneDriver::SecondaryRecording(){
   AD::ClearAdjoints();
 
 }
+
+void CDiscAdjSinglezoneDriver::ProjectSensitivityToDV() {
+
+  const auto nDV = config->GetnDV();
+
+  if ((nDV == 0) || (config->GetDesign_Variable(0) == NONE) ||
+      (config->GetDesign_Variable(0) == SURFACE_FILE)) {
+    if (rank == MASTER_NODE)
+      cout << "\nPROJECT_GRADIENT is set but there are no projectable design variables, skipping." << endl;
+    return;
+  }
+
+  if (rank == MASTER_NODE)
+    cout << "\n--------------------- Gradient Projection (ZONE " << config->GetiZone()
+         << ") ---------------------" << endl;
+
+  /*--- Definition of the surface deformation, the boundary coordinates are
+   taken from the current (undeformed) mesh. ---*/
+
+  CSurfaceMovement surfaceMovement;
+  surfaceMovement.CopyBoundary(geometry, config);
+
+  /*--- Record the surface deformation at zero design variable values, so the
+   derivative is evaluated at the current design. The adjoint information of the
+   solution recording was already extracted, the tape can be reused. ---*/
+
+  AD::Reset();
+  AD::StartRecording();
+
+  for (auto iDV = 0u; iDV < nDV; iDV++) {
+    for (auto iDV_Value = 0u; iDV_Value < config->GetnDV_Value(iDV); iDV_Value++) {
+      config->SetDV_Value(iDV, iDV_Value, 0.0);
+      AD::RegisterInput(config->GetDV_Value(iDV, iDV_Value));
+    }
+  }
+
+  surfaceMovement.SetSurface_Deformation(geometry, config);
+
+  AD::StopRecording();
+
+  /*--- Seed the surface displacements with the volume sensitivities of the
+   adjoint solver. Markers share points, seed each point only once. ---*/
+
+  vector<bool> visited(geometry->GetnPoint(), false);
+
+  for (auto iMarker = 0u; iMarker < config->GetnMarker_All(); iMarker++) {
+    if (config->GetMarker_All_DV(iMarker) != YES) continue;
+
+    for (auto iVertex = 0ul; iVertex < geometry->nVertex[iMarker]; iVertex++) {
+      const auto iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+      if (visited[iPoint]) continue;
+      visited[iPoint] = true;
+
+      auto VarCoord = geometry->vertex[iMarker][iVertex]->GetVarCoord();
+      for (auto iDim = 0u; iDim < geometry->GetnDim(); iDim++) {
+        const su2double sens = solver[MainSolver]->GetNodes()->GetSensitivity(iPoint, iDim);
+        SU2_TYPE::SetDerivative(VarCoord[iDim], SU2_TYPE::GetValue(sens));
+      }
+    }
+  }
+
+  AD::ComputeAdjoint();
+
+  /*--- Extract and reduce the gradient, the master rank writes it in the same
+   format as SU2_DOT. ---*/
+
+  ofstream gradFile;
+  if (rank == MASTER_NODE) {
+    gradFile.open(config->GetObjFunc_Grad_FileName());
+    gradFile.precision(config->OptionIsSet("OUTPUT_PRECISION") ? config->GetOutput_Precision() : 6);
+    gradFile << config->GetObjFunc_Name() << " gradient " << endl;
+  }
+
+  for (auto iDV = 0u; iDV < nDV; iDV++) {
+    for (auto iDV_Value = 0u; iDV_Value < config->GetnDV_Value(iDV); iDV_Value++) {
+
+      su2double myGradient = SU2_TYPE::GetDerivative(config->GetDV_Value(iDV, iDV_Value));
+      su2double gradient;
+      SU2_MPI::Allreduce(&myGradient, &gradient, 1, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
+
+      /*--- The angle of attack gradient comes from the flow solution. ---*/
+
+      if ((config->GetDesign_Variable(iDV) == ANGLE_OF_ATTACK) ||
+          (config->GetDesign_Variable(iDV) == FFD_ANGLE_OF_ATTACK))
+        gradient += config->GetAoA_Sens();
+
+      if (rank == MASTER_NODE) gradFile << gradient << endl;
+    }
+  }
+
+  if (rank == MASTER_NODE) {
+    gradFile.close();
+    cout << "Gradient file written to " << config->GetObjFunc_Grad_FileName() << "." << endl;
+  }
+
+  AD::Reset();
+}
@@ -37,9 +37,14 @@
 
 #include "../../include/output/COutputFactory.hpp"
 #include "../../include/output/COutput.hpp"
+#include "../../include/output/filewriter/CParallelDataSorter.hpp"
 
 #include "../../include/output/COutputLegacy.hpp"
 
+#include "../../../Common/include/toolboxes/CPhaseProfiler.hpp"
+#include "../../../Common/include/toolboxes/allocation_toolbox.hpp"
+#include "../../../Common/include/linear_algebra/blas_structure.hpp"
+
 #include "../../../Common/include/interface_interpolation/CInterpolator.hpp"
 #include "../../../Common/include/interface_interpolation/CInterpolatorFactory.hpp"
 
@@ -144,6 +149,25 @@ CDriver::CDriver(char* confFile, unsigned short val_nZone, SU2_Comm MPICommunica
   Output_Preprocessing(config_container, driver_config, output_container, driver_output);
 
 
+  /*--- For unsteady restarts, advise the OS to start reading the restart
+   file(s) into the page cache now, the reads then overlap with the geometry
+   preprocessing below instead of stalling the solver setup. ---*/
+
+  for (iZone = 0; iZone < nZone; iZone++) {
+    const CConfig* config = config_container[iZone];
+    const bool adjoint = config->GetDiscrete_Adjoint() || config->GetContinuous_Adjoint();
+    if (config->GetTime_Domain() && !adjoint && (config->GetRestart() || config->GetRestart_Flow()) &&
+        config->GetRead_Binary_Restart() && !config->GetRead_Surface_Restart()) {
+      const bool dt_step_2nd = (config->GetTime_Marching() == TIME_MARCHING::DT_STEPPING_2ND) &&
+                               !config->GetStructuralProblem() && !config->GetFEMSolver();
+      const bool dual_snapshot = config->GetDual_Snapshot_Restart() && dt_step_2nd && !config->GetDynamic_Grid();
+      const int val_iter = config->GetRestart_Iter() - 1 - (dt_step_2nd && !dual_snapshot);
+      CSolver::PrefetchRestartFile(config->GetFilename(config->GetSolution_FileName(), "", val_iter));
+      if (dt_step_2nd && !dual_snapshot)
+        CSolver::PrefetchRestartFile(config->GetFilename(config->GetSolution_FileName(), "", val_iter + 1));
+    }
+  }
+
   for (iZone = 0; iZone < nZone; iZone++) {
 
     /*--- Read the number of instances for each zone ---*/
@@ -174,6 +198,11 @@ CDriver::CDriver(char* confFile, unsigned short val_nZone, SU2_Comm MPICommunica
       Geometrical_Preprocessing(config_container[iZone], geometry_container[iZone][iInst], dry_run);
 
     }
+
+    /*--- Now that the geometry has set the boundary marker tags, resolve the per-marker
+     positions of the config arrays so the BC loops can query them by marker index. ---*/
+
+    config_container[iZone]->SetMarker_PositionCaches();
   }
 
   /*--- Before we proceed with the zone loop we have to compute the wall distances.
@@ -269,6 +298,10 @@ CDriver::CDriver(char* confFile, unsigned short val_nZone, SU2_Comm MPICommunica
 
   PythonInterface_Preprocessing(config_container, geometry_container, solver_container);
 
+  /*--- Report how much of the memory allocated during the preprocessing ended
+   *    up in huge pages (Linux only, no output on other platforms). ---*/
+
+  if (rank == MASTER_NODE) MemoryAllocation::ReportHugepageCoverage();
 
   /*--- Preprocessing time is reported now, but not included in the next compute portion. ---*/
 
@@ -477,6 +510,12 @@ void CDriver::Postprocessing() {
 
   config_container[ZONE_0]->SetProfilingCSV();
   config_container[ZONE_0]->GEMMProfilingCSV();
+  CPhaseProfiler::GetProfiler().WriteProfile();
+
+  /*--- Append the machine-readable performance record of this run. ---*/
+
+  if (config_container[ZONE_0]->GetWrt_Performance_Record() && (output_container != nullptr))
+    output_container[ZONE_0]->WritePerformanceRecord(config_container[ZONE_0]);
 
   /*--- Deallocate config container ---*/
   if (config_container!= nullptr) {
@@ -512,6 +551,17 @@ void CDriver::Postprocessing() {
   UsedTime = StopTime-StartTime;
   UsedTimeCompute += UsedTime;
 
+  /*--- Average and maximum time spent in halo communication across the ranks,
+   *    only measured when the code is built with profiling support. ---*/
+
+  su2double commTimeAvg = 0.0, commTimeMax = 0.0;
+  if (wrt_perf) {
+    su2double commTime = CPhaseProfiler::GetProfiler().GetPhaseTime(ProfilingPhase::HALO_COMM);
+    SU2_MPI::Allreduce(&commTime, &commTimeAvg, 1, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
+    SU2_MPI::Allreduce(&commTime, &commTimeMax, 1, MPI_DOUBLE, MPI_MAX, SU2_MPI::GetComm());
+    commTimeAvg /= size;
+  }
+
   if ((rank == MASTER_NODE) && (wrt_perf)) {
     su2double TotalTime = UsedTimePreproc + UsedTimeCompute + UsedTimeOutput;
     cout.precision(6);
@@ -537,6 +587,14 @@ void CDriver::Postprocessing() {
       cout << setw(20) << "Avg. s/iter:" << setw(12)<< UsedTimeCompute/IterCount << endl;
       cout << setw(25) << "Core-s/iter/Mpoints:" << setw(12)<< size*UsedTimeCompute/IterCount/Mpoints << " | ";
       cout << setw(20) << "Mpoints/s:" << setw(12)<< Mpoints*IterCount/UsedTimeCompute << endl;
+      cout << setw(25) << "MDOFs/s:" << setw(12)<< DOFsPerPoint*Mpoints*IterCount/UsedTimeCompute << " | ";
+#ifdef PROFILE
+      cout << setw(20) << "Comm. fraction (%):" << setw(12)<< (100.0*commTimeAvg)/UsedTimeCompute << endl;
+      cout << setw(25) << "Halo comm. avg (s):" << setw(12)<< commTimeAvg << " | ";
+      cout << setw(20) << "Halo comm. max (s):" << setw(12)<< commTimeMax << endl;
+#else
+      cout << endl;
+#endif
     } else cout << endl;
     cout << endl;
     cout << "Output phase:" << endl;
@@ -779,6 +837,7 @@ void CDriver::Geometrical_Preprocessing_FVM(CConfig *config, CGeometry **&geomet
 
   if (rank == MASTER_NODE) cout << "Identifying edges and vertices." << endl;
   geometry[MESH_0]->SetEdges();
+  if (config->GetLocalityReordering()) geometry[MESH_0]->SortEdgesForLocality();
   geometry[MESH_0]->SetVertex(config);
 
   /*--- Create the control volume structures ---*/
@@ -849,6 +908,7 @@ void CDriver::Geometrical_Preprocessing_FVM(CConfig *config, CGeometry **&geomet
     /*--- Create the edge structure ---*/
 
     geometry[iMGlevel]->SetEdges();
+    if (config->GetLocalityReordering()) geometry[iMGlevel]->SortEdgesForLocality();
     geometry[iMGlevel]->SetVertex(geometry[iMGlevel-1], config);
 
     /*--- Create the control volume structures ---*/
@@ -1033,6 +1093,33 @@ void CDriver::Solver_Preprocessing(CConfig* config, CGeometry** geometry, CSolve
     solver[iMesh] = CSolverFactory::CreateSolverContainer(kindSolver, config, geometry[iMesh], iMesh);
   }
 
+  /*--- Release the halo part of auxiliary fields that are only used for
+   *    domain points. With periodic boundaries the limiter min/max fields
+   *    are exchanged at halo points and the full allocation is kept. ---*/
+
+  if (config->GetSlimHalo() && (config->GetnMarker_Periodic() == 0)) {
+    for (iMesh = 0; iMesh <= config->GetnMGLevels(); iMesh++) {
+      for (unsigned int iSol = 0; iSol < MAX_SOLS; iSol++) {
+        if (solver[iMesh][iSol] && solver[iMesh][iSol]->GetNodes()) {
+          solver[iMesh][iSol]->GetNodes()->TrimHaloAllocation(geometry[iMesh]->GetnPointDomain());
+        }
+      }
+    }
+  }
+
+  /*--- Fixed-order parallel reductions, making results independent of the
+   *    number of threads (the CSysVector setting is global but consistent,
+   *    all zones share the config option). ---*/
+
+  if (config->GetDeterministicReductions()) {
+    CSysVector<su2double>::SetFixedOrderReduction(true);
+    CSysVector<su2mixedfloat>::SetFixedOrderReduction(true);
+  }
+
+  for (iMesh = 0; iMesh <= config->GetnMGLevels(); iMesh++)
+    for (unsigned int iSol = 0; iSol < MAX_SOLS; iSol++)
+      if (solver[iMesh][iSol]) solver[iMesh][iSol]->InitDeterministicReductions(config);
+
   /*--- Count the number of DOFs per solution point. ---*/
 
   DOFsPerPoint = 0;
@@ -1140,20 +1227,37 @@ void CDriver::Solver_Restart(CSolver ***solver, CGeometry **geometry,
                            !config->GetStructuralProblem() && !config->GetFEMSolver() &&
                            !adjoint && time_domain;
 
+  /*--- With a dual-snapshot restart file both time levels of a 2nd-order
+   dual-time restart come from the single file at iter-1, so the chain starts
+   one file later (see DUAL_SNAPSHOT_RESTART). ---*/
+
+  const bool dual_snapshot = config->GetDual_Snapshot_Restart() && dt_step_2nd &&
+                             config->GetRead_Binary_Restart() && !config->GetRead_Surface_Restart() &&
+                             !config->GetDynamic_Grid();
+
   if (time_domain) {
     if (adjoint) val_iter = config->GetUnst_AdjointIter() - 1;
-    else val_iter = config->GetRestart_Iter() - 1 - dt_step_2nd;
+    else val_iter = config->GetRestart_Iter() - 1 - (dt_step_2nd && !dual_snapshot);
   }
 
   /*--- Restart direct solvers. ---*/
 
   if (restart || restart_flow) {
+
+    /*--- A 2nd-order restart reads a second file (at iter-1) after this one
+     and the geometry preprocessing in between, advise the OS to prefetch it
+     now so that read overlaps with the work up to it. ---*/
+
+    if (time_domain && !adjoint && dt_step_2nd && !dual_snapshot) {
+      CSolver::PrefetchRestartFile(config->GetFilename(config->GetSolution_FileName(), "", val_iter + 1));
+    }
+
     for (auto iSol = 0u; iSol < MAX_SOLS; ++iSol) {
       auto sol = solver[MESH_0][iSol];
       if (sol && !sol->GetAdjoint()) {
         /*--- Note that the mesh solver always loads the most recent file (and not -2). ---*/
         SU2_OMP_PARALLEL_(if(sol->GetHasHybridParallel()))
-        sol->LoadRestart(geometry, solver, config, val_iter + (iSol==MESH_SOL && dt_step_2nd), update_geo);
+        sol->LoadRestart(geometry, solver, config, val_iter + (iSol==MESH_SOL && dt_step_2nd && !dual_snapshot), update_geo);
         END_SU2_OMP_PARALLEL
       }
     }
@@ -2912,6 +3016,96 @@ void CDriver::Print_DirectResidual(RECORDING kind_recording) {
 
 }
 
+void CDriver::MonitorLoadBalance(unsigned long TimeIter) {
+
+  const auto* config = config_container[ZONE_0];
+  const auto freq = config->GetLoadBalanceMonitorFreq();
+
+  if ((freq == 0) || (size == SINGLE_NODE)) return;
+
+  /*--- The first call sets the start of the monitoring window. ---*/
+
+  if (lbWindowStart == 0.0) lbWindowStart = SU2_MPI::Wtime();
+
+  /*--- Ranks with less work arrive here earlier and wait for the slowest one,
+   *    the time spent in this synchronization approximates their idle time
+   *    (a lower bound, waits inside collective operations are not visible). ---*/
+
+  const passivedouble tSync = SU2_MPI::Wtime();
+  SU2_MPI::Barrier(SU2_MPI::GetComm());
+  lbWaitTime += SU2_MPI::Wtime() - tSync;
+
+  if ((TimeIter+1) % freq != 0) return;
+
+  /*--- Estimate the per-rank work time in the window and reduce it. ---*/
+
+  const passivedouble work = (SU2_MPI::Wtime() - lbWindowStart) - lbWaitTime;
+
+  passivedouble maxWork = 0.0, sumWork = 0.0;
+  SU2_MPI::Allreduce(&work, &maxWork, 1, MPI_DOUBLE, MPI_MAX, SU2_MPI::GetComm());
+  SU2_MPI::Allreduce(&work, &sumWork, 1, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
+
+  const passivedouble imbalance = maxWork * size / max(sumWork, 1e-12);
+
+  if (rank == MASTER_NODE) {
+    cout << "Parallel load balance: max/avg work time over the last " << freq
+         << " time iteration(s): " << imbalance << "." << endl;
+    if (imbalance > config->GetLoadBalanceThreshold()) {
+      cout << "WARNING: The load imbalance exceeds LOAD_BALANCE_THRESHOLD (= "
+           << config->GetLoadBalanceThreshold() << "),\n"
+           << "consider repartitioning on the next restart (the partitioning can be\n"
+           << "tuned via PARMETIS_POINT_WEIGHT / PARMETIS_EDGE_WEIGHT)." << endl;
+    }
+  }
+
+  /*--- Start a new monitoring window. ---*/
+
+  lbWindowStart = SU2_MPI::Wtime();
+  lbWaitTime = 0.0;
+}
+
+void CDriver::RegisterInSituCallback(InSituCallbackType callback, unsigned long frequency) {
+
+  inSituCallbacks.emplace_back(move(callback), max<unsigned long>(frequency, 1));
+}
+
+void CDriver::RunInSituCallbacks(unsigned long TimeIter) {
+
+  if (inSituCallbacks.empty()) return;
+
+  /*--- Check whether any callback is due at this iteration before paying for the data sort. ---*/
+
+  bool anyDue = false;
+  for (const auto& callback : inSituCallbacks)
+    anyDue |= (TimeIter % callback.second == 0);
+
+  if (!anyDue) return;
+
+  for (iZone = 0; iZone < nZone; iZone++) {
+
+    auto config = config_container[iZone];
+    auto geometry = geometry_container[iZone][INST_0][MESH_0];
+    auto output = output_container[iZone];
+
+    /*--- Load the current solution into the volume data sorter and sort it for the
+     linear partitioning. The callbacks consume the sorted buffers in place, so no
+     files are written and no extra copy of the data is made. ---*/
+
+    output->Load_Data(geometry, config, solver_container[iZone][INST_0][MESH_0]);
+
+    auto dataSorter = output->GetVolumeDataSorter();
+
+    /*--- The connectivity does not change unless the mesh does, sort it once. ---*/
+
+    if (!dataSorter->GetConnectivitySorted())
+      dataSorter->SortConnectivity(config, geometry, true);
+
+    for (const auto& callback : inSituCallbacks)
+      if (TimeIter % callback.second == 0)
+        callback.first(iZone, TimeIter, dataSorter);
+  }
+}
+
 CFluidDriver::CFluidDriver(char* confFile, unsigned short val_nZone, SU2_Comm MPICommunicator) : CDriver(confFile, val_nZone, MPICommunicator, false) {
   Max_Iter = config_container[ZONE_0]->GetnInner_Iter();
 }
@@ -3147,6 +3341,10 @@ bool CFluidDriver::Monitor(unsigned long ExtIter) {
 
   StopCalc = StopCalc || (ExtIter == Max_Iter - 1);
 
+  /*--- Hand the solution to any registered in-situ analysis callbacks. ---*/
+
+  RunInSituCallbacks(ExtIter);
+
   return StopCalc;
 
 }
@@ -3408,6 +3606,10 @@ bool CTurbomachineryDriver::Monitor(unsigned long ExtIter) {
 
   StopCalc = StopCalc || (ExtIter == Max_Iter - 1);
 
+  /*--- Hand the solution to any registered in-situ analysis callbacks. ---*/
+
+  RunInSituCallbacks(ExtIter);
+
   return StopCalc;
 
 }
@@ -3425,6 +3627,8 @@ CHBDriver::CHBDriver(char* confFile,
   /*--- allocate dynamic memory for the Harmonic Balance operator ---*/
   D = new su2double*[nInstHB]; for (kInst = 0; kInst < nInstHB; kInst++) D[kInst] = new su2double[nInstHB];
 
+  blasFunctions = new CBlasStructure;
+
   output_legacy = COutputFactory::CreateLegacyOutput(config_container[ZONE_0]);
 
   /*--- Open the convergence history file ---*/
@@ -3451,6 +3655,8 @@ CHBDriver::~CHBDriver(void) {
   for (kInst = 0; kInst < nInstHB; kInst++) delete [] D[kInst];
   delete [] D;
 
+  delete blasFunctions;
+
   if (rank == MASTER_NODE){
   /*--- Close the convergence history file. ---*/
   for (iZone = 0; iZone < nZone; iZone++) {
@@ -3491,11 +3697,8 @@ void CHBDriver::Run() {
 
 void CHBDriver::Update() {
 
-  for (iInst = 0; iInst < nInstHB; iInst++) {
-    /*--- Compute the harmonic balance terms across all zones ---*/
-    SetHarmonicBalance(iInst);
-
-  }
+  /*--- Compute the harmonic balance terms for all instances at once ---*/
+  SetHarmonicBalance();
 
   /*--- Precondition the harmonic balance source terms ---*/
   if (config_container[ZONE_0]->GetHB_Precondition() == YES) {
@@ -3542,9 +3745,9 @@ void CHBDriver::ResetConvergence() {
 
 }
 
-void CHBDriver::SetHarmonicBalance(unsigned short iInst) {
+void CHBDriver::SetHarmonicBalance() {
 
-  unsigned short iVar, jInst, iMGlevel;
+  unsigned short iVar, iInst, jInst, iMGlevel;
   unsigned short nVar = solver_container[ZONE_0][INST_0][MESH_0][FLOW_SOL]->GetnVar();
   unsigned long iPoint;
   bool implicit = (config_container[ZONE_0]->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
@@ -3553,116 +3756,120 @@ void CHBDriver::SetHarmonicBalance(unsigned short iInst) {
     implicit = (config_container[ZONE_0]->GetKind_TimeIntScheme_AdjFlow() == EULER_IMPLICIT);
   }
 
-  unsigned long InnerIter = config_container[ZONE_0]->GetInnerIter();
-
-  /*--- Retrieve values from the config file ---*/
-  su2double *U = new su2double[nVar];
-  su2double *U_old = new su2double[nVar];
-  su2double *Psi = new su2double[nVar];
-  su2double *Psi_old = new su2double[nVar];
-  su2double *Source = new su2double[nVar];
-  su2double deltaU, deltaPsi;
-
-  /*--- Compute period of oscillation ---*/
-  su2double period = config_container[ZONE_0]->GetHarmonicBalance_Period();
+  /*--- The operator only depends on the period and the chosen frequencies,
+   compute it once and keep the flat row-major copies used by the batched
+   application (the adjoint sources multiply by the transposed operator). ---*/
+  if (!hbOperatorReady) {
+    ComputeHB_Operator();
+    Dflat.resize(nInstHB*nInstHB);
+    if (adjoint) DflatAdj.resize(nInstHB*nInstHB);
+    for (iInst = 0; iInst < nInstHB; iInst++) {
+      for (jInst = 0; jInst < nInstHB; jInst++) {
+        Dflat[iInst*nInstHB+jInst] = D[iInst][jInst];
+        if (adjoint) DflatAdj[iInst*nInstHB+jInst] = D[jInst][iInst];
+      }
+    }
+    hbOperatorReady = true;
+  }
 
-  /*--- Non-dimensionalize the input period, if necessary.  */
-  period /= config_container[ZONE_0]->GetTime_Ref();
+  const int solSet = adjoint ? ADJFLOW_SOL : FLOW_SOL;
+  const su2double* Op = adjoint ? DflatAdj.data() : Dflat.data();
 
-  if (InnerIter == 0)
-    ComputeHB_Operator();
+  /*--- Work arrays holding a chunk of points for every instance, contiguously,
+   so that the operator is applied to the whole chunk as one small GEMM. ---*/
+  const unsigned long pointChunk = 64;
+  su2double *solBlock = new su2double[nInstHB*pointChunk*nVar];
+  su2double *srcBlock = new su2double[nInstHB*pointChunk*nVar];
 
   /*--- Compute various source terms for explicit direct, implicit direct, and adjoint problems ---*/
   /*--- Loop over all grid levels ---*/
   for (iMGlevel = 0; iMGlevel <= config_container[ZONE_0]->GetnMGLevels(); iMGlevel++) {
 
-    /*--- Loop over each node in the volume mesh ---*/
-    for (iPoint = 0; iPoint < geometry_container[ZONE_0][iInst][iMGlevel]->GetnPoint(); iPoint++) {
-
-      for (iVar = 0; iVar < nVar; iVar++) {
-        Source[iVar] = 0.0;
-      }
-
-      /*--- Step across the columns ---*/
-      for (jInst = 0; jInst < nInstHB; jInst++) {
-
-        /*--- Retrieve solution at this node in current zone ---*/
-        for (iVar = 0; iVar < nVar; iVar++) {
-
-          if (!adjoint) {
-            U[iVar] = solver_container[ZONE_0][jInst][iMGlevel][FLOW_SOL]->GetNodes()->GetSolution(iPoint, iVar);
-            Source[iVar] += U[iVar]*D[iInst][jInst];
-
-            if (implicit) {
-              U_old[iVar] = solver_container[ZONE_0][jInst][iMGlevel][FLOW_SOL]->GetNodes()->GetSolution_Old(iPoint, iVar);
-              deltaU = U[iVar] - U_old[iVar];
-              Source[iVar] += deltaU*D[iInst][jInst];
-            }
+    const unsigned long nPoint = geometry_container[ZONE_0][INST_0][iMGlevel]->GetnPoint();
 
-          }
+    /*--- Loop over chunks of nodes in the volume mesh ---*/
+    for (unsigned long startPoint = 0; startPoint < nPoint; startPoint += pointChunk) {
 
-          else {
-            Psi[iVar] = solver_container[ZONE_0][jInst][iMGlevel][ADJFLOW_SOL]->GetNodes()->GetSolution(iPoint, iVar);
-            Source[iVar] += Psi[iVar]*D[jInst][iInst];
+      const unsigned long nP = min(pointChunk, nPoint-startPoint);
 
-            if (implicit) {
-              Psi_old[iVar] = solver_container[ZONE_0][jInst][iMGlevel][ADJFLOW_SOL]->GetNodes()->GetSolution_Old(iPoint, iVar);
-              deltaPsi = Psi[iVar] - Psi_old[iVar];
-              Source[iVar] += deltaPsi*D[jInst][iInst];
-            }
+      /*--- Gather the solution of every instance into contiguous rows, for
+       implicit problems the delta between nonlinear iterations is added. ---*/
+      for (jInst = 0; jInst < nInstHB; jInst++) {
+        const auto nodes = solver_container[ZONE_0][jInst][iMGlevel][solSet]->GetNodes();
+        su2double* row = &solBlock[jInst*nP*nVar];
+        for (unsigned long jPoint = 0; jPoint < nP; jPoint++) {
+          iPoint = startPoint + jPoint;
+          for (iVar = 0; iVar < nVar; iVar++) {
+            su2double val = nodes->GetSolution(iPoint, iVar);
+            if (implicit) val += val - nodes->GetSolution_Old(iPoint, iVar);
+            row[jPoint*nVar+iVar] = val;
           }
         }
+      }
 
-        /*--- Store sources for current row ---*/
-        for (iVar = 0; iVar < nVar; iVar++) {
-          if (!adjoint) {
-            solver_container[ZONE_0][iInst][iMGlevel][FLOW_SOL]->GetNodes()->SetHarmonicBalance_Source(iPoint, iVar, Source[iVar]);
-          }
-          else {
-            solver_container[ZONE_0][iInst][iMGlevel][ADJFLOW_SOL]->GetNodes()->SetHarmonicBalance_Source(iPoint, iVar, Source[iVar]);
-          }
-        }
+      /*--- Apply the instance-coupling operator to the whole chunk. ---*/
+      blasFunctions->gemm(nInstHB, int(nP*nVar), nInstHB, Op, solBlock, srcBlock,
+                          config_container[ZONE_0]);
 
+      /*--- Scatter the source terms of every instance back to the nodes. ---*/
+      for (iInst = 0; iInst < nInstHB; iInst++) {
+        const auto nodes = solver_container[ZONE_0][iInst][iMGlevel][solSet]->GetNodes();
+        const su2double* row = &srcBlock[iInst*nP*nVar];
+        for (unsigned long jPoint = 0; jPoint < nP; jPoint++) {
+          iPoint = startPoint + jPoint;
+          for (iVar = 0; iVar < nVar; iVar++)
+            nodes->SetHarmonicBalance_Source(iPoint, iVar, row[jPoint*nVar+iVar]);
+        }
       }
+
     }
   }
 
+  delete [] solBlock;
+  delete [] srcBlock;
+
   /*--- Source term for a turbulence model ---*/
   if (config_container[ZONE_0]->GetKind_Solver() == MAIN_SOLVER::RANS) {
 
     /*--- Extra variables needed if we have a turbulence model. ---*/
     unsigned short nVar_Turb = solver_container[ZONE_0][INST_0][MESH_0][TURB_SOL]->GetnVar();
-    su2double *U_Turb = new su2double[nVar_Turb];
-    su2double *Source_Turb = new su2double[nVar_Turb];
+    const unsigned long nPoint = geometry_container[ZONE_0][INST_0][MESH_0]->GetnPoint();
+    su2double *solTurb = new su2double[nInstHB*pointChunk*nVar_Turb];
+    su2double *srcTurb = new su2double[nInstHB*pointChunk*nVar_Turb];
 
     /*--- Loop over only the finest mesh level (turbulence is always solved
      on the original grid only). ---*/
-    for (iPoint = 0; iPoint < geometry_container[ZONE_0][INST_0][MESH_0]->GetnPoint(); iPoint++) {
-      for (iVar = 0; iVar < nVar_Turb; iVar++) Source_Turb[iVar] = 0.0;
-      for (jInst = 0; jInst < nInstHB; jInst++) {
+    for (unsigned long startPoint = 0; startPoint < nPoint; startPoint += pointChunk) {
+
+      const unsigned long nP = min(pointChunk, nPoint-startPoint);
 
-        /*--- Retrieve solution at this node in current zone ---*/
-        for (iVar = 0; iVar < nVar_Turb; iVar++) {
-          U_Turb[iVar] = solver_container[ZONE_0][jInst][MESH_0][TURB_SOL]->GetNodes()->GetSolution(iPoint, iVar);
-          Source_Turb[iVar] += U_Turb[iVar]*D[iInst][jInst];
+      for (jInst = 0; jInst < nInstHB; jInst++) {
+        const auto nodes = solver_container[ZONE_0][jInst][MESH_0][TURB_SOL]->GetNodes();
+        su2double* row = &solTurb[jInst*nP*nVar_Turb];
+        for (unsigned long jPoint = 0; jPoint < nP; jPoint++) {
+          for (iVar = 0; iVar < nVar_Turb; iVar++)
+            row[jPoint*nVar_Turb+iVar] = nodes->GetSolution(startPoint+jPoint, iVar);
         }
       }
 
-      /*--- Store sources for current iZone ---*/
-      for (iVar = 0; iVar < nVar_Turb; iVar++)
-        solver_container[ZONE_0][iInst][MESH_0][TURB_SOL]->GetNodes()->SetHarmonicBalance_Source(iPoint, iVar, Source_Turb[iVar]);
+      blasFunctions->gemm(nInstHB, int(nP*nVar_Turb), nInstHB, Dflat.data(), solTurb, srcTurb,
+                          config_container[ZONE_0]);
+
+      /*--- Store sources for every instance at the current chunk of nodes. ---*/
+      for (iInst = 0; iInst < nInstHB; iInst++) {
+        const auto nodes = solver_container[ZONE_0][iInst][MESH_0][TURB_SOL]->GetNodes();
+        const su2double* row = &srcTurb[iInst*nP*nVar_Turb];
+        for (unsigned long jPoint = 0; jPoint < nP; jPoint++) {
+          for (iVar = 0; iVar < nVar_Turb; iVar++)
+            nodes->SetHarmonicBalance_Source(startPoint+jPoint, iVar, row[jPoint*nVar_Turb+iVar]);
+        }
+      }
     }
 
-    delete [] U_Turb;
-    delete [] Source_Turb;
+    delete [] solTurb;
+    delete [] srcTurb;
   }
 
-  delete [] Source;
-  delete [] U;
-  delete [] U_old;
-  delete [] Psi;
-  delete [] Psi_old;
-
 }
 
 void CHBDriver::StabilizeHarmonicBalance() {
@@ -28,6 +28,30 @@
 #include "../../include/drivers/CDummyDriver.hpp"
 #include "../../include/output/COutput.hpp"
 
+#include <fstream>
+#include <iomanip>
+
+namespace {
+
+/*--- Scan the global dimensions from an SU2 native mesh file without loading it, the
+ element and point lists themselves are only streamed over. ---*/
+bool ScanSU2MeshDims(const string& filename, unsigned short& nDim,
+                     unsigned long& nPoint, unsigned long& nElem) {
+  ifstream mesh_file(filename);
+  if (!mesh_file.good()) return false;
+
+  nDim = 0; nPoint = 0; nElem = 0;
+  string line;
+  while (getline(mesh_file, line)) {
+    if (line.compare(0, 6, "NDIME=") == 0) nDim = atoi(line.c_str()+6);
+    else if (line.compare(0, 6, "NELEM=") == 0) nElem = atol(line.c_str()+6);
+    else if (line.compare(0, 6, "NPOIN=") == 0) nPoint = atol(line.c_str()+6);
+    if ((nDim != 0) && (nPoint != 0) && (nElem != 0)) break;
+  }
+  return (nDim != 0) && (nPoint != 0) && (nElem != 0);
+}
+}
+
 CDummyDriver::CDummyDriver(char* confFile,
                          unsigned short val_nZone,
                          SU2_Comm MPICommunicator) : CDriver(confFile,
@@ -49,4 +73,130 @@ void CDummyDriver::StartSolver(){
     output_container[iZone]->PrintVolumeFields();
     output_container[iZone]->PrintHistoryFields();
   }
+
+  EstimateResources();
+}
+
+void CDummyDriver::EstimateResources() const {
+
+  if (rank != MASTER_NODE) return;
+
+  for (unsigned short jZone = 0; jZone < nZone; jZone++) {
+    const CConfig* config = config_container[jZone];
+
+    cout << "\n-------------------- Resource Estimate (zone " << jZone << ") ---------------------" << endl;
+
+    if (config->GetMesh_FileFormat() != SU2) {
+      cout << "Memory estimation is only available for the native SU2 mesh format." << endl;
+      continue;
+    }
+
+    unsigned short nDim = 0;
+    unsigned long nPointGlobal = 0, nElemGlobal = 0;
+    if (!ScanSU2MeshDims(config->GetMesh_FileName(), nDim, nPointGlobal, nElemGlobal)) {
+      cout << "Could not read the mesh dimensions from \"" << config->GetMesh_FileName() << "\"." << endl;
+      continue;
+    }
+
+    /*--- Size of the state vectors of the solvers that will be allocated, the model
+     assumes an unstructured FVM flow-type solver. ---*/
+
+    const unsigned short nVarFlow = nDim + 2;
+    unsigned short nVarTurb = 0;
+    switch (TurbModelFamily(config->GetKind_Turb_Model())) {
+      case TURB_FAMILY::SA: nVarTurb = 1; break;
+      case TURB_FAMILY::KW: nVarTurb = 2; break;
+      default: break;
+    }
+    const bool implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
+    const bool dualTime = config->GetTime_Domain();
+
+    const passivedouble pointsPerRank = passivedouble(nPointGlobal) / size;
+
+    /*--- Halo layer estimate from the surface-to-volume scaling of the partitions. ---*/
+
+    const passivedouble haloFrac = min(0.5, 3.0 * pow(pointsPerRank, -1.0/nDim));
+    const passivedouble localPoints = pointsPerRank * (1.0 + haloFrac);
+
+    /*--- Typical vertex degree (incl. the diagonal) of unstructured dual meshes, this
+     determines the number of nonzero blocks of the Jacobians. ---*/
+
+    const passivedouble avgDegree = (nDim == 3) ? 15.0 : 7.0;
+
+    const passivedouble B = 8.0, MB = 1.0e6;
+
+    /*--- Dual-grid geometry: coordinate copies, dual volumes and face normals, edge and
+     vertex structures, and the element connectivity. ---*/
+
+    passivedouble geometryMem = localPoints*(3.0*nDim + 40.0)*B +
+                                (passivedouble(nElemGlobal)/size)*((nDim == 3) ? 8.0 : 4.0)*B;
+
+    /*--- Solution variables: solution copies (incl. time levels), primitives,
+     gradients, and limiters, per solver. ---*/
+
+    auto variableMem = [&](unsigned short nVar) {
+      const passivedouble copies = 3.0 + (dualTime ? 2.0 : 0.0);
+      return localPoints*(nVar*(copies + nDim + 2.0) + 16.0)*B;
+    };
+    passivedouble variablesMem = variableMem(nVarFlow) + ((nVarTurb > 0) ? variableMem(nVarTurb) : 0.0);
+
+    /*--- Block Jacobian and its ILU factorization (same sparsity), per implicit solver. ---*/
+
+    auto jacobianMem = [&](unsigned short nVar) {
+      return implicit ? 2.0*localPoints*avgDegree*nVar*nVar*B : 0.0;
+    };
+    passivedouble jacobiansMem = jacobianMem(nVarFlow) + ((nVarTurb > 0) ? jacobianMem(nVarTurb) : 0.0);
+
+    /*--- Linear solver work vectors (residual, solution, Krylov basis). ---*/
+
+    const passivedouble linearMem = implicit ? localPoints*nVarFlow*(2.0 + 2.0*11.0)*B : 0.0;
+
+    /*--- Output data sorters and write buffers (owned points only). ---*/
+
+    const passivedouble outputMem = pointsPerRank*32.0*B;
+
+    /*--- Coarse multigrid levels add a geometric-series overhead. ---*/
+
+    if (config->GetnMGLevels() > 0) {
+      const passivedouble mgFactor = (nDim == 3) ? 1.15 : 1.35;
+      geometryMem *= mgFactor; variablesMem *= mgFactor; jacobiansMem *= mgFactor;
+    }
+
+    passivedouble totalMem = geometryMem + variablesMem + jacobiansMem + linearMem + outputMem;
+
+    /*--- The discrete adjoint roughly adds the tape and the adjoint variables on top. ---*/
+
+    if (config->GetDiscrete_Adjoint()) totalMem *= 2.5;
+
+    /*--- Imbalance forecast: integer partition sizes plus the usual partitioner tolerance. ---*/
+
+    const passivedouble imbalance =
+      ceil(passivedouble(nPointGlobal)/size)*size/passivedouble(nPointGlobal)*1.05 - 1.0;
+
+    /*--- Rank count suggestions: enough ranks to stay below ~2 GB each, but not so many
+     that the partitions drop below ~10k points and halo/latency overheads dominate. ---*/
+
+    const auto minRanks = static_cast<unsigned long>(max(1.0, ceil(totalMem*size/2.0e9)));
+    const auto maxRanks = max<unsigned long>(1, nPointGlobal/10000);
+
+    cout << "Mesh: " << nPointGlobal << " points, " << nElemGlobal << " elements (" << nDim << "D)." << endl;
+    cout << "At " << size << " rank(s): " << static_cast<unsigned long>(pointsPerRank)
+         << " points/rank, plus ~" << static_cast<unsigned long>(haloFrac*100.0) << "% halo points." << endl;
+    cout << "\nEstimated memory per rank:" << endl;
+    cout << "  Dual-grid geometry:     " << setw(9) << static_cast<unsigned long>(geometryMem/MB) << " MB" << endl;
+    cout << "  Solution variables:     " << setw(9) << static_cast<unsigned long>(variablesMem/MB) << " MB" << endl;
+    if (implicit) {
+      cout << "  Jacobians + ILU:        " << setw(9) << static_cast<unsigned long>(jacobiansMem/MB) << " MB" << endl;
+      cout << "  Linear solver vectors:  " << setw(9) << static_cast<unsigned long>(linearMem/MB) << " MB" << endl;
+    }
+    cout << "  Output buffers:         " << setw(9) << static_cast<unsigned long>(outputMem/MB) << " MB" << endl;
+    cout << "  Total:                  " << setw(9) << static_cast<unsigned long>(totalMem/MB) << " MB"
+         << (config->GetDiscrete_Adjoint() ? " (incl. discrete adjoint tape)" : "") << endl;
+    cout << "\nPartition imbalance forecast: ~" << static_cast<unsigned long>(imbalance*100.0 + 0.5)
+         << "% above the mean partition size." << endl;
+    cout << "Suggested rank range: " << minRanks << " (approx. 2 GB/rank) to "
+         << maxRanks << " (approx. 10k points/rank)." << endl;
+    cout << "\nThe estimates assume an unstructured FVM flow solver and carry an uncertainty" << endl;
+    cout << "of a few tens of percent, leave headroom when sizing the allocation." << endl;
+  }
 }
@@ -117,6 +117,82 @@ CMultizoneDriver::CMultizoneDriver(char* confFile, unsigned short val_nZone, SU2
     }
   }
 
+  SetZoneSolveOrder();
+
+  zoneConverged.assign(nZone, false);
+
+  /*--- Thread team size of each zone. Small (e.g. solid CHT) zones are solved
+   with a reduced team, the fork-join barriers of the full team otherwise
+   dominate their step cost (see setZoneTeamSize). ---*/
+
+  zoneTeamSize.assign(nZone, omp_get_max_threads());
+
+  for (iZone = 0; iZone < nZone; iZone++) {
+    zoneTeamSize[iZone] = computeZoneTeamSize(geometry_container[iZone][INST_0][MESH_0]->GetnPoint(),
+                                              omp_get_max_threads());
+    if ((rank == MASTER_NODE) && (zoneTeamSize[iZone] < omp_get_max_threads())) {
+      cout << "Zone " << iZone << " will be solved with " << zoneTeamSize[iZone]
+           << " of the " << omp_get_max_threads() << " threads." << endl;
+    }
+  }
+
+}
+
+void CMultizoneDriver::SetZoneSolveOrder() {
+
+  /*--- Build the zone dependency graph from the interface definitions, zone j
+   depends on zone i if i donates to j. When the graph is a DAG (e.g. one-way
+   coupled chains) sweeping the zones in topological order gives every zone
+   fresh donor data in the same outer iteration, which reduces the number of
+   outer iterations compared to the input order. Two-way coupled groups
+   (cycles) are kept in input order. ---*/
+
+  zoneOrder.clear();
+  zoneOrder.reserve(nZone);
+
+  vector<unsigned short> nDepend(nZone, 0);
+  for (auto jZone = 0u; jZone < nZone; jZone++)
+    for (auto iZone = 0u; iZone < nZone; iZone++)
+      if (iZone != jZone && interface_container[iZone][jZone] != nullptr)
+        nDepend[jZone]++;
+
+  vector<bool> placed(nZone, false);
+
+  while (zoneOrder.size() < nZone) {
+
+    /*--- Place the first zone without pending dependencies (Kahn's algorithm,
+     the lowest index keeps the order stable w.r.t. the input order). ---*/
+
+    auto nextZone = nZone;
+    for (auto iZone = 0u; iZone < nZone; iZone++) {
+      if (!placed[iZone] && nDepend[iZone] == 0) { nextZone = iZone; break; }
+    }
+
+    /*--- Only cycles remain, place them in input order without
+     removing their dependencies (their order cannot be improved). ---*/
+
+    if (nextZone == nZone) {
+      for (auto iZone = 0u; iZone < nZone; iZone++)
+        if (!placed[iZone]) { zoneOrder.push_back(iZone); placed[iZone] = true; }
+      break;
+    }
+
+    zoneOrder.push_back(nextZone);
+    placed[nextZone] = true;
+
+    for (auto jZone = 0u; jZone < nZone; jZone++)
+      if (!placed[jZone] && interface_container[nextZone][jZone] != nullptr)
+        nDepend[jZone]--;
+  }
+
+  bool reordered = false;
+  for (auto i = 0u; i < nZone; i++) reordered |= (zoneOrder[i] != i);
+
+  if (reordered && (rank == MASTER_NODE)) {
+    cout << "Zones solved in topological order of the coupling graph: ";
+    for (auto i = 0u; i < nZone; i++) cout << zoneOrder[i] << (i+1 < nZone ? ", " : ".\n");
+  }
+
 }
 
 CMultizoneDriver::~CMultizoneDriver(void) {
@@ -287,8 +363,10 @@ void CMultizoneDriver::Run_GaussSeidel() {
   /*--- Loop over the number of outer iterations ---*/
   for (auto iOuter_Iter = 0ul; iOuter_Iter < driver_config->GetnOuter_Iter(); iOuter_Iter++){
 
-    /*--- Loop over the number of zones (IZONE) ---*/
-    for (iZone = 0; iZone < nZone; iZone++){
+    /*--- Loop over the number of zones (IZONE), in topological
+     order of the coupling graph where possible. ---*/
+    for (auto iOrder = 0u; iOrder < nZone; iOrder++){
+      iZone = zoneOrder[iOrder];
 
       /*--- In principle, the mesh does not need to be updated ---*/
       UpdateMesh = 0;
@@ -298,10 +376,10 @@ void CMultizoneDriver::Run_GaussSeidel() {
       config_container[iZone]->Set_StartTime(SU2_MPI::Wtime());
       driver_config->SetOuterIter(iOuter_Iter);
 
-      /*--- Transfer from all the remaining zones ---*/
+      /*--- Transfer from all the zones that donate to this one ---*/
       for (auto jZone = 0u; jZone < nZone; jZone++){
         /*--- The target zone is iZone ---*/
-        if (jZone != iZone){
+        if (jZone != iZone && interface_container[jZone][iZone] != nullptr){
           DeformMesh = Transfer_Data(jZone, iZone);
           if (DeformMesh) UpdateMesh+=1;
         }
@@ -309,13 +387,21 @@ void CMultizoneDriver::Run_GaussSeidel() {
       /*--- If a mesh update is required due to the transfer of data ---*/
       if (UpdateMesh > 0) DynamicMeshUpdate(iZone, TimeIter);
 
-      /*--- Iterate the zone as a block, either to convergence or to a max number of iterations ---*/
+      /*--- A converged zone whose coupling inputs did not change does not need to be solved again ---*/
+      if (SkipZoneSolve(iZone, iOuter_Iter)) continue;
+
+      /*--- Iterate the zone as a block, either to convergence or to a max number of iterations,
+       with the thread team sized for the zone. ---*/
+      setZoneTeamSize(zoneTeamSize[iZone]);
       iteration_container[iZone][INST_0]->Solve(output_container[iZone], integration_container, geometry_container,
                                                 solver_container, numerics_container, config_container,
                                                 surface_movement, grid_movement, FFDBox, iZone, INST_0);
 
       /*--- A corrector step can help preventing numerical instabilities ---*/
       Corrector(iZone);
+      resetZoneTeamSize();
+
+      zoneConverged[iZone] = output_container[iZone]->GetConvergence();
 
     }
 
@@ -368,13 +454,21 @@ void CMultizoneDriver::Run_Jacobi() {
       config_container[iZone]->Set_StartTime(SU2_MPI::Wtime());
       driver_config->SetOuterIter(iOuter_Iter);
 
-      /*--- Iterate the zone as a block, either to convergence or to a max number of iterations ---*/
+      /*--- A converged zone whose coupling inputs did not change does not need to be solved again ---*/
+      if (SkipZoneSolve(iZone, iOuter_Iter)) continue;
+
+      /*--- Iterate the zone as a block, either to convergence or to a max number of iterations,
+       with the thread team sized for the zone. ---*/
+      setZoneTeamSize(zoneTeamSize[iZone]);
       iteration_container[iZone][INST_0]->Solve(output_container[iZone], integration_container, geometry_container,
                                                 solver_container, numerics_container, config_container,
                                                 surface_movement, grid_movement, FFDBox, iZone, INST_0);
 
       /*--- A corrector step can help preventing numerical instabilities ---*/
       Corrector(iZone);
+      resetZoneTeamSize();
+
+      zoneConverged[iZone] = output_container[iZone]->GetConvergence();
 
     }
 
@@ -384,6 +478,27 @@ void CMultizoneDriver::Run_Jacobi() {
 
 }
 
+bool CMultizoneDriver::SkipZoneSolve(unsigned short val_iZone, unsigned long OuterIter) const {
+
+  if (!driver_config->GetMultizone_SkipConverged()) return false;
+
+  /*--- Every zone is solved at least once per outer loop, and is not skipped
+   while its inner iteration has not converged. ---*/
+
+  if (OuterIter == 0 || !zoneConverged[val_iZone]) return false;
+
+  /*--- The zone is solved again as soon as any of its incoming transfers
+   changes by more than the tolerance (relative L2 change of the donor data). ---*/
+
+  const passivedouble tol = SU2_TYPE::GetValue(driver_config->GetMultizone_SkipTol());
+
+  for (auto jZone = 0u; jZone < nZone; jZone++) {
+    if (jZone == val_iZone || interface_container[jZone][val_iZone] == nullptr) continue;
+    if (interface_container[jZone][val_iZone]->GetRelativeChange() > tol) return false;
+  }
+  return true;
+}
+
 void CMultizoneDriver::Corrector(unsigned short val_iZone) {
 
   if (config_container[val_iZone]->GetRelaxation())
@@ -628,6 +743,14 @@ bool CMultizoneDriver::Transfer_Data(unsigned short donorZone, unsigned short ta
 
 bool CMultizoneDriver::Monitor(unsigned long TimeIter){
 
+  /*--- Monitor the parallel load balance. --- */
+
+  MonitorLoadBalance(TimeIter);
+
+  /*--- Hand the solution to any registered in-situ analysis callbacks. ---*/
+
+  RunInSituCallbacks(TimeIter);
+
   /*--- Check whether the inner solver has converged --- */
 
   if (driver_config->GetTime_Domain() == NO){
@@ -29,6 +29,7 @@
 #include "../../include/definition_structure.hpp"
 #include "../../include/output/COutput.hpp"
 #include "../../include/iteration/CIteration.hpp"
+#include "../../include/integration/CMultiGridIntegration.hpp"
 
 CSinglezoneDriver::CSinglezoneDriver(char* confFile,
                        unsigned short val_nZone,
@@ -67,6 +68,10 @@ void CSinglezoneDriver::StartSolver() {
   if (config_container[ZONE_0]->GetRestart() && driver_config->GetTime_Domain())
     TimeIter = config_container[ZONE_0]->GetRestart_Iter();
 
+  /*--- Grid sequencing startup, initializes the fine grid from the coarse multigrid levels. ---*/
+
+  GridSequencing();
+
   /*--- Run the problem until the number of time iterations required is reached. ---*/
   while ( TimeIter < config_container[ZONE_0]->GetnTime_Iter() ) {
 
@@ -110,6 +115,90 @@ void CSinglezoneDriver::StartSolver() {
 
 }
 
+void CSinglezoneDriver::GridSequencing() {
+
+  CConfig* config = config_container[ZONE_0];
+
+  const auto nSeqIter = config->GetGridSeq_Iter();
+  const auto nMGLevels = config->GetnMGLevels();
+
+  if ((nSeqIter == 0) || (nMGLevels == 0)) return;
+
+  /*--- Only for direct, steady problems that start from a uniform initialization,
+   *    a restarted solution does not need the coarse grid transient. ---*/
+
+  if (config->GetRestart() || config->GetTime_Domain() ||
+      config->GetDiscrete_Adjoint() || config->GetContinuous_Adjoint()) return;
+
+  /*--- Only the mean flow is iterated on the coarse levels, the turbulent
+   *    variables keep their free-stream values until the fine grid starts. ---*/
+
+  MAIN_SOLVER main_solver = MAIN_SOLVER::NONE;
+
+  switch (config->GetKind_Solver()) {
+    case MAIN_SOLVER::EULER:
+    case MAIN_SOLVER::INC_EULER:
+    case MAIN_SOLVER::NEMO_EULER:
+      main_solver = MAIN_SOLVER::EULER;
+      break;
+
+    case MAIN_SOLVER::NAVIER_STOKES:
+    case MAIN_SOLVER::INC_NAVIER_STOKES:
+    case MAIN_SOLVER::NEMO_NAVIER_STOKES:
+      main_solver = MAIN_SOLVER::NAVIER_STOKES;
+      break;
+
+    case MAIN_SOLVER::RANS:
+    case MAIN_SOLVER::INC_RANS:
+      main_solver = MAIN_SOLVER::RANS;
+      break;
+
+    default:
+      return;
+  }
+
+  auto* integration = dynamic_cast<CMultiGridIntegration*>(integration_container[ZONE_0][INST_0][FLOW_SOL]);
+  if (integration == nullptr) return;
+
+  if (rank == MASTER_NODE)
+    cout << endl << "---------------------------- Grid Sequencing ----------------------------" << endl;
+
+  /*--- Run the initial transient on each coarse level, coarsest first, and
+   *    prolongate the solution to initialize the next finer level. ---*/
+
+  for (auto iLevel = nMGLevels; iLevel >= 1; --iLevel) {
+
+    config->SetFinestMesh(iLevel);
+
+    if (rank == MASTER_NODE)
+      cout << "Running " << nSeqIter << " iteration(s) on multigrid level " << iLevel << "." << endl;
+
+    for (unsigned long iIter = 0; iIter < nSeqIter; ++iIter) {
+      config->SetGlobalParam(main_solver, RUNTIME_FLOW_SYS);
+      integration->MultiGrid_Iteration(geometry_container, solver_container, numerics_container,
+                                       config_container, RUNTIME_FLOW_SYS, ZONE_0, INST_0);
+    }
+
+    auto* sol_fine = solver_container[ZONE_0][INST_0][iLevel-1][FLOW_SOL];
+    auto* sol_coarse = solver_container[ZONE_0][INST_0][iLevel][FLOW_SOL];
+    auto* geo_fine = geometry_container[ZONE_0][INST_0][iLevel-1];
+    auto* geo_coarse = geometry_container[ZONE_0][INST_0][iLevel];
+
+    integration->SetProlongated_Solution(RUNTIME_FLOW_SYS, sol_fine, sol_coarse, geo_fine, geo_coarse, config);
+
+    /*--- The prolongation only covers the children of owned coarse points. ---*/
+
+    sol_fine->InitiateComms(geo_fine, config, SOLUTION);
+    sol_fine->CompleteComms(geo_fine, config, SOLUTION);
+  }
+
+  config->SetFinestMesh(MESH_0);
+
+  if (rank == MASTER_NODE)
+    cout << "Grid sequencing finished, starting fine grid iterations." << endl;
+
+}
+
 void CSinglezoneDriver::Preprocess(unsigned long TimeIter) {
 
   /*--- Set runtime option ---*/
@@ -305,6 +394,14 @@ bool CSinglezoneDriver::Monitor(unsigned long TimeIter){
 
   IterCount += config_container[ZONE_0]->GetInnerIter()+1;
 
+  /*--- Monitor the parallel load balance. --- */
+
+  MonitorLoadBalance(TimeIter);
+
+  /*--- Hand the solution to any registered in-situ analysis callbacks. ---*/
+
+  RunInSituCallbacks(TimeIter);
+
   return StopCalc;
 }
 
@@ -142,6 +142,25 @@ su2double CNEMOGas::ComputeGamma(){
 
 }
 
+void CNEMOGas::ComputeSpeciesEveBatch(unsigned long nPts, const su2double* val_T, su2double* val_eves) {
+
+  /*--- Fallback for libraries without a batched kernel, one state at a time. ---*/
+  for (unsigned long iPt = 0; iPt < nPts; ++iPt) {
+    const auto& val = ComputeSpeciesEve(val_T[iPt]);
+    for (unsigned short iVar = 0; iVar < nSpecies; ++iVar)
+      val_eves[iPt*nSpecies+iVar] = val[iVar];
+  }
+}
+
+void CNEMOGas::ComputeSpeciesCvVibEleBatch(unsigned long nPts, const su2double* val_T, su2double* val_cvves) {
+
+  for (unsigned long iPt = 0; iPt < nPts; ++iPt) {
+    const auto& val = ComputeSpeciesCvVibEle(val_T[iPt]);
+    for (unsigned short iVar = 0; iVar < nSpecies; ++iVar)
+      val_cvves[iPt*nSpecies+iVar] = val[iVar];
+  }
+}
+
 su2double CNEMOGas::ComputerhoCvve() {
 
     Cvves = ComputeSpeciesCvVibEle(Tve);
@@ -1031,6 +1031,12 @@ CSU2TCLib::CSU2TCLib(const CConfig* config, unsigned short val_nDim, bool viscou
 
   if (ionization) { nHeavy = nSpecies-1; nEl = 1; }
   else            { nHeavy = nSpecies;   nEl = 0; }
+
+  /*--- Precompute the species gas constants, the property evaluation
+   *    kernels are hot enough for the divisions to show up. ---*/
+  RuOverM.resize(nSpecies,0.0);
+  for (iSpecies = 0; iSpecies < nSpecies; iSpecies++)
+    RuOverM[iSpecies] = Ru/MolarMass[iSpecies];
 }
 
 CSU2TCLib::~CSU2TCLib(){}
@@ -1070,7 +1076,7 @@ vector<su2double>& CSU2TCLib::ComputeSpeciesCvVibEle(su2double val_T){
     /*--- If requesting electron specific heat ---*/
     if (ionization && iSpecies == iElectron) {
       Cvvs = 0.0;
-      Cves = 3.0/2.0 * Ru/MolarMass[iSpecies];
+      Cves = 3.0/2.0 * RuOverM[iSpecies];
     }
 
     /*--- Heavy particle specific heat ---*/
@@ -1079,27 +1085,29 @@ vector<su2double>& CSU2TCLib::ComputeSpeciesCvVibEle(su2double val_T){
       /*--- Vibrational energy ---*/
       if (CharVibTemp[iSpecies] != 0.0) {
         thoTve = CharVibTemp[iSpecies]/val_T;
-        exptv = exp(CharVibTemp[iSpecies]/val_T);
-        Cvvs  = Ru/MolarMass[iSpecies] * thoTve*thoTve * exptv / ((exptv-1.0)*(exptv-1.0));
+        exptv = exp(thoTve);
+        Cvvs  = RuOverM[iSpecies] * thoTve*thoTve * exptv / ((exptv-1.0)*(exptv-1.0));
       } else {
         Cvvs = 0.0;
       }
 
       /*--- Electronic energy ---*/
       if (nElStates[iSpecies] != 0) {
+        thoTve = CharElTemp[iSpecies][0]/val_T;
+        exptv = exp(-thoTve);
         num = 0.0; num2 = 0.0;
-        denom = ElDegeneracy[iSpecies][0] * exp(-CharElTemp[iSpecies][0]/val_T);
-        num3  = ElDegeneracy[iSpecies][0] * (CharElTemp[iSpecies][0]/(val_T*val_T))*exp(-CharElTemp[iSpecies][0]/val_T);
+        denom = ElDegeneracy[iSpecies][0] * exptv;
+        num3  = ElDegeneracy[iSpecies][0] * thoTve/val_T * exptv;
         for (iEl = 1; iEl < nElStates[iSpecies]; iEl++) {
           thoTve = CharElTemp[iSpecies][iEl]/val_T;
-          exptv = exp(-CharElTemp[iSpecies][iEl]/val_T);
+          exptv = exp(-thoTve);
 
           num   += ElDegeneracy[iSpecies][iEl] * CharElTemp[iSpecies][iEl] * exptv;
           denom += ElDegeneracy[iSpecies][iEl] * exptv;
           num2  += ElDegeneracy[iSpecies][iEl] * (thoTve*thoTve) * exptv;
           num3  += ElDegeneracy[iSpecies][iEl] * thoTve/val_T * exptv;
         }
-        Cves = Ru/MolarMass[iSpecies] * (num2/denom - num*num3/(denom*denom));
+        Cves = RuOverM[iSpecies] * (num2/denom - num*num3/(denom*denom));
       } else {
         Cves = 0.0;
       }
@@ -1137,7 +1145,7 @@ vector<su2double>& CSU2TCLib::ComputeMixtureEnergies(){
 
     // Species vibrational energy
     if (CharVibTemp[iSpecies] != 0.0)
-      Ev = Ru/MolarMass[iSpecies] * CharVibTemp[iSpecies] / (exp(CharVibTemp[iSpecies]/Tve)-1.0);
+      Ev = RuOverM[iSpecies] * CharVibTemp[iSpecies] / (exp(CharVibTemp[iSpecies]/Tve)-1.0);
     else
       Ev = 0.0;
 
@@ -1145,10 +1153,11 @@ vector<su2double>& CSU2TCLib::ComputeMixtureEnergies(){
     num = 0.0;
     denom = ElDegeneracy(iSpecies,0) * exp(-CharElTemp(iSpecies,0)/Tve);
     for (iEl = 1; iEl < nElStates[iSpecies]; iEl++) {
-      num   += ElDegeneracy(iSpecies,iEl) * CharElTemp(iSpecies,iEl) * exp(-CharElTemp(iSpecies,iEl)/Tve);
-      denom += ElDegeneracy(iSpecies,iEl) * exp(-CharElTemp(iSpecies,iEl)/Tve);
+      const su2double expel = exp(-CharElTemp(iSpecies,iEl)/Tve);
+      num   += ElDegeneracy(iSpecies,iEl) * CharElTemp(iSpecies,iEl) * expel;
+      denom += ElDegeneracy(iSpecies,iEl) * expel;
     }
-    Ee = Ru/MolarMass[iSpecies] * (num/denom);
+    Ee = RuOverM[iSpecies] * (num/denom);
 
     // Mixture total energy
     rhoEmix += rhos[iSpecies] * ((3.0/2.0+RotationModes[iSpecies]/2.0) * Ru/MolarMass[iSpecies] * (T-Ref_Temperature[iSpecies]) + Ev + Ee + Ef);
@@ -1176,10 +1185,10 @@ vector<su2double>& CSU2TCLib::ComputeSpeciesEve(su2double val_T, bool vibe_only)
     if ( ionization && (iSpecies == iElectron)) {
 
       /*--- Calculate formation energy ---*/
-      Ef = Enthalpy_Formation[iSpecies] - Ru/MolarMass[iSpecies] * Ref_Temperature[iSpecies];
+      Ef = Enthalpy_Formation[iSpecies] - RuOverM[iSpecies] * Ref_Temperature[iSpecies];
 
       /*--- Electron t-r mode contributes to mixture vib-el energy ---*/
-      Eel = (3.0/2.0) * Ru/MolarMass[iSpecies] * (val_T - Ref_Temperature[iSpecies]) + Ef;
+      Eel = (3.0/2.0) * RuOverM[iSpecies] * (val_T - Ref_Temperature[iSpecies]) + Ef;
       Ev  = 0.0;
     }
     /*--- Heavy particle energy ---*/
@@ -1187,7 +1196,7 @@ vector<su2double>& CSU2TCLib::ComputeSpeciesEve(su2double val_T, bool vibe_only)
 
       /*--- Calculate vibrational energy (harmonic-oscillator model) ---*/
       if (CharVibTemp[iSpecies] != 0.0)
-        Ev = Ru/MolarMass[iSpecies] * CharVibTemp[iSpecies] / (exp(CharVibTemp[iSpecies]/val_T)-1.0);
+        Ev = RuOverM[iSpecies] * CharVibTemp[iSpecies] / (exp(CharVibTemp[iSpecies]/val_T)-1.0);
       else
         Ev = 0.0;
 
@@ -1195,10 +1204,11 @@ vector<su2double>& CSU2TCLib::ComputeSpeciesEve(su2double val_T, bool vibe_only)
       num = 0.0;
       denom = ElDegeneracy[iSpecies][0] * exp(-CharElTemp[iSpecies][0]/val_T);
       for (iEl = 1; iEl < nElStates[iSpecies]; iEl++) {
-        num   += ElDegeneracy[iSpecies][iEl] * CharElTemp[iSpecies][iEl] * exp(-CharElTemp[iSpecies][iEl]/val_T);
-        denom += ElDegeneracy[iSpecies][iEl] * exp(-CharElTemp[iSpecies][iEl]/val_T);
+        const su2double expel = exp(-CharElTemp[iSpecies][iEl]/val_T);
+        num   += ElDegeneracy[iSpecies][iEl] * CharElTemp[iSpecies][iEl] * expel;
+        denom += ElDegeneracy[iSpecies][iEl] * expel;
       }
-      Eel = Ru/MolarMass[iSpecies] * (num/denom);
+      Eel = RuOverM[iSpecies] * (num/denom);
     }
     if (vibe_only == true) {eves[iSpecies] = Ev;}
     else {eves[iSpecies] = Ev + Eel;}
@@ -1207,6 +1217,143 @@ vector<su2double>& CSU2TCLib::ComputeSpeciesEve(su2double val_T, bool vibe_only)
   return eves;
 }
 
+void CSU2TCLib::ComputeSpeciesEveBatch(unsigned long nPts, const su2double* val_T, su2double* val_eves) {
+
+  /*--- Process the points in tiles with the species loop outside, the
+   *    exponentials of one species are then evaluated back-to-back over the
+   *    tile with constant coefficients, which the compiler can vectorize
+   *    (in passive builds) instead of the scalar ragged loops above. ---*/
+
+  constexpr unsigned long TILE = 32;
+
+  for (unsigned long base = 0; base < nPts; base += TILE) {
+
+    const unsigned long len = min(TILE, nPts-base);
+    const su2double* Tt = &val_T[base];
+    su2double* out = &val_eves[base*nSpecies];
+
+    for (unsigned short is = 0; is < nSpecies; ++is) {
+
+      /*--- Electron species energy ---*/
+      if (ionization && (is == 0)) {
+        const su2double Ef = Enthalpy_Formation[is] - RuOverM[is]*Ref_Temperature[is];
+        SU2_OMP_SIMD_IF_NOT_AD
+        for (unsigned long iPt = 0; iPt < len; ++iPt)
+          out[iPt*nSpecies+is] = (3.0/2.0) * RuOverM[is] * (Tt[iPt]-Ref_Temperature[is]) + Ef;
+        continue;
+      }
+
+      /*--- Vibrational energy (harmonic-oscillator model) ---*/
+      if (CharVibTemp[is] != 0.0) {
+        const su2double thv = CharVibTemp[is];
+        SU2_OMP_SIMD_IF_NOT_AD
+        for (unsigned long iPt = 0; iPt < len; ++iPt)
+          out[iPt*nSpecies+is] = RuOverM[is] * thv / (exp(thv/Tt[iPt])-1.0);
+      }
+      else {
+        for (unsigned long iPt = 0; iPt < len; ++iPt)
+          out[iPt*nSpecies+is] = 0.0;
+      }
+
+      /*--- Electronic energy ---*/
+      su2double num[TILE], denom[TILE];
+
+      SU2_OMP_SIMD_IF_NOT_AD
+      for (unsigned long iPt = 0; iPt < len; ++iPt) {
+        num[iPt] = 0.0;
+        denom[iPt] = ElDegeneracy[is][0] * exp(-CharElTemp[is][0]/Tt[iPt]);
+      }
+
+      for (iEl = 1; iEl < nElStates[is]; iEl++) {
+        const su2double g = ElDegeneracy[is][iEl];
+        const su2double the = CharElTemp[is][iEl];
+        SU2_OMP_SIMD_IF_NOT_AD
+        for (unsigned long iPt = 0; iPt < len; ++iPt) {
+          const su2double expel = exp(-the/Tt[iPt]);
+          num[iPt]   += g * the * expel;
+          denom[iPt] += g * expel;
+        }
+      }
+
+      SU2_OMP_SIMD_IF_NOT_AD
+      for (unsigned long iPt = 0; iPt < len; ++iPt)
+        out[iPt*nSpecies+is] += RuOverM[is] * num[iPt]/denom[iPt];
+    }
+  }
+}
+
+void CSU2TCLib::ComputeSpeciesCvVibEleBatch(unsigned long nPts, const su2double* val_T, su2double* val_cvves) {
+
+  /*--- Same tiling strategy as ComputeSpeciesEveBatch. ---*/
+
+  constexpr unsigned long TILE = 32;
+
+  for (unsigned long base = 0; base < nPts; base += TILE) {
+
+    const unsigned long len = min(TILE, nPts-base);
+    const su2double* Tt = &val_T[base];
+    su2double* out = &val_cvves[base*nSpecies];
+
+    for (unsigned short is = 0; is < nSpecies; ++is) {
+
+      /*--- Electron specific heat ---*/
+      if (ionization && (is == 0)) {
+        for (unsigned long iPt = 0; iPt < len; ++iPt)
+          out[iPt*nSpecies+is] = 3.0/2.0 * RuOverM[is];
+        continue;
+      }
+
+      /*--- Vibrational specific heat ---*/
+      if (CharVibTemp[is] != 0.0) {
+        const su2double thv = CharVibTemp[is];
+        SU2_OMP_SIMD_IF_NOT_AD
+        for (unsigned long iPt = 0; iPt < len; ++iPt) {
+          const su2double thoTve = thv/Tt[iPt];
+          const su2double exptv = exp(thoTve);
+          out[iPt*nSpecies+is] = RuOverM[is] * thoTve*thoTve * exptv / ((exptv-1.0)*(exptv-1.0));
+        }
+      }
+      else {
+        for (unsigned long iPt = 0; iPt < len; ++iPt)
+          out[iPt*nSpecies+is] = 0.0;
+      }
+
+      /*--- Electronic specific heat ---*/
+      if (nElStates[is] != 0) {
+
+        su2double num[TILE], num2[TILE], num3[TILE], denom[TILE];
+
+        SU2_OMP_SIMD_IF_NOT_AD
+        for (unsigned long iPt = 0; iPt < len; ++iPt) {
+          const su2double thoTve = CharElTemp[is][0]/Tt[iPt];
+          const su2double expel = exp(-thoTve);
+          num[iPt] = 0.0; num2[iPt] = 0.0;
+          denom[iPt] = ElDegeneracy[is][0] * expel;
+          num3[iPt]  = ElDegeneracy[is][0] * thoTve/Tt[iPt] * expel;
+        }
+
+        for (iEl = 1; iEl < nElStates[is]; iEl++) {
+          const su2double g = ElDegeneracy[is][iEl];
+          const su2double the = CharElTemp[is][iEl];
+          SU2_OMP_SIMD_IF_NOT_AD
+          for (unsigned long iPt = 0; iPt < len; ++iPt) {
+            const su2double thoTve = the/Tt[iPt];
+            const su2double expel = exp(-thoTve);
+            num[iPt]   += g * the * expel;
+            denom[iPt] += g * expel;
+            num2[iPt]  += g * (thoTve*thoTve) * expel;
+            num3[iPt]  += g * thoTve/Tt[iPt] * expel;
+          }
+        }
+
+        SU2_OMP_SIMD_IF_NOT_AD
+        for (unsigned long iPt = 0; iPt < len; ++iPt)
+          out[iPt*nSpecies+is] += RuOverM[is] * (num2[iPt]/denom[iPt] - num[iPt]*num3[iPt]/(denom[iPt]*denom[iPt]));
+      }
+    }
+  }
+}
+
 vector<su2double>& CSU2TCLib::ComputeNetProductionRates(bool implicit, const su2double *V, const su2double* eve,
                                                         const su2double* cvve, const su2double* dTdU, const su2double* dTvedU,
                                                         su2double **val_jacobian){
@@ -1750,6 +1897,10 @@ void CSU2TCLib::DiffusionCoeffGY(){
   su2double pi = PI_NUMBER;
   su2double kb = BOLTZMANN_CONSTANT;
 
+  /*--- The collision-integral curve fits are polynomials in log(T),
+   *    evaluate it once instead of per species pair. ---*/
+  const su2double lnT = log(T);
+
   /*--- Calculate mixture gas constant ---*/
   su2double gam_t = 0.0;
   for (iSpecies = 0; iSpecies < nSpecies; iSpecies++) {
@@ -1774,8 +1925,8 @@ void CSU2TCLib::DiffusionCoeffGY(){
 
         /*--- Calculate the Omega^(0,0)_ij collision cross section ---*/
         su2double Omega_ij = 1E-20 * Omega00(iSpecies,jSpecies,3)
-                            * pow(T, Omega00(iSpecies,jSpecies,0)*log(T)*log(T)
-                                   + Omega00(iSpecies,jSpecies,1)*log(T)
+                            * pow(T, Omega00(iSpecies,jSpecies,0)*lnT*lnT
+                                   + Omega00(iSpecies,jSpecies,1)*lnT
                                    + Omega00(iSpecies,jSpecies,2));
         /*--- Calculate "delta1_ij" ---*/
         su2double d1_ij = 8.0/3.0 * sqrt((2.0*Mi*Mj) / (pi*Ru*T*(Mi+Mj))) * Omega_ij;
@@ -1844,6 +1995,10 @@ void CSU2TCLib::ViscosityGY(){
   su2double Na = AVOGAD_CONSTANT;
   su2double Mu = 0.0;
 
+  /*--- Evaluate the logarithms of the curve-fit temperatures once. ---*/
+  const su2double lnT = log(T);
+  const su2double lnTve = log(Tve);
+
   /*--- Mixture viscosity via Gupta-Yos approximation ---*/
   for (iSpecies = 0; iSpecies < nHeavy; iSpecies++) {
 
@@ -1859,8 +2014,8 @@ void CSU2TCLib::ViscosityGY(){
 
       /*--- Calculate "delta" quantities ---*/
       su2double Omega_ij = 1E-20 * Omega11(iSpecies,jSpecies,3)
-          * pow(T, Omega11(iSpecies,jSpecies,0)*log(T)*log(T)
-          + Omega11(iSpecies,jSpecies,1)*log(T)
+          * pow(T, Omega11(iSpecies,jSpecies,0)*lnT*lnT
+          + Omega11(iSpecies,jSpecies,1)*lnT
           + Omega11(iSpecies,jSpecies,2));
       su2double d2_ij = 16.0/5.0 * sqrt((2.0*Mi*Mj) / (pi*Ru*T*(Mi+Mj))) * Omega_ij;
 
@@ -1874,8 +2029,8 @@ void CSU2TCLib::ViscosityGY(){
 
       /*--- Calculate "delta" quantities ---*/
       su2double Omega_ij = 1E-20 * Omega11(iSpecies,jSpecies,3)
-          * pow(Tve, Omega11(iSpecies,jSpecies,0)*log(Tve)*log(Tve)
-          + Omega11(iSpecies,jSpecies,1)*log(Tve)
+          * pow(Tve, Omega11(iSpecies,jSpecies,0)*lnTve*lnTve
+          + Omega11(iSpecies,jSpecies,1)*lnTve
           + Omega11(iSpecies,jSpecies,2));
       su2double d2_ij = 16.0/5.0 * sqrt((2.0*Mi*Mj) / (pi*Ru*Tve*(Mi+Mj))) * Omega_ij;
       denom += gam_j*d2_ij;
@@ -1915,6 +2070,9 @@ void CSU2TCLib::ThermalConductivitiesGY(){
   su2double Na   = AVOGAD_CONSTANT;
   su2double kb   = BOLTZMANN_CONSTANT;
 
+  /*--- Evaluate the logarithm of the curve-fit temperature once. ---*/
+  const su2double lnT = log(T);
+
   if (ionization) {
     SU2_MPI::Error("NEEDS REVISION w/ IONIZATION",CURRENT_FUNCTION);
   }
@@ -1951,8 +2109,8 @@ void CSU2TCLib::ThermalConductivitiesGY(){
 
       /*--- Calculate the Omega^(0,0)_ij collision cross section ---*/
       Omega_ij = 1E-20 * Omega00(iSpecies,jSpecies,3)
-          * pow(T, Omega00(iSpecies,jSpecies,0)*log(T)*log(T)
-          + Omega00(iSpecies,jSpecies,1)*log(T)
+          * pow(T, Omega00(iSpecies,jSpecies,0)*lnT*lnT
+          + Omega00(iSpecies,jSpecies,1)*lnT
           + Omega00(iSpecies,jSpecies,2));
 
       /*--- Calculate "delta1_ij" ---*/
@@ -1960,8 +2118,8 @@ void CSU2TCLib::ThermalConductivitiesGY(){
 
       /*--- Calculate the Omega^(1,1)_ij collision cross section ---*/
       Omega_ij = 1E-20 * Omega11(iSpecies,jSpecies,3)
-          * pow(T, Omega11(iSpecies,jSpecies,0)*log(T)*log(T)
-          + Omega11(iSpecies,jSpecies,1)*log(T)
+          * pow(T, Omega11(iSpecies,jSpecies,0)*lnT*lnT
+          + Omega11(iSpecies,jSpecies,1)*lnT
           + Omega11(iSpecies,jSpecies,2));
 
       /*--- Calculate "delta2_ij" ---*/
@@ -1988,7 +2146,12 @@ void CSU2TCLib::ThermalConductivitiesGY(){
 
 vector<su2double>& CSU2TCLib::ComputeTemperatures(vector<su2double>& val_rhos, su2double rhoE, su2double rhoEve, su2double rhoEvel){
 
-  vector<su2double> val_eves;
+  return ComputeTemperatures(val_rhos, rhoE, rhoEve, rhoEvel, 0.0);
+}
+
+vector<su2double>& CSU2TCLib::ComputeTemperatures(vector<su2double>& val_rhos, su2double rhoE, su2double rhoEve,
+                                                  su2double rhoEvel, su2double Tve_init){
+
   rhos = val_rhos;
 
   /*----------Translational temperature----------*/
@@ -2018,15 +2181,34 @@ vector<su2double>& CSU2TCLib::ComputeTemperatures(vector<su2double>& val_rhos, s
   //Initialize solution
   Tve = T;
 
+  /*--- Vibrational-electronic energy of the mixture at a given Tve. ---*/
+  auto rhoEveFromTve = [&](su2double val_Tve) {
+    const auto& eves_t = ComputeSpeciesEve(val_Tve);
+    su2double sum = 0.0;
+    for (iSpecies = 0; iSpecies < nSpecies; iSpecies++) sum += rhos[iSpecies] * eves_t[iSpecies];
+    return sum;
+  };
+
+  /*--- Warm start: the energy is monotone in Tve, so if a bracket around the
+   previous vibrational temperature still contains the solution, bisect that
+   instead of the full admissible range. The full range is then only needed
+   on strong changes of the state (or without a previous value). ---*/
+  if ((Tve_init > Tve_o) && (Tve_init < Tve2)) {
+    const su2double Tve_lo = max(Tve_o, 0.5*Tve_init);
+    const su2double Tve_hi = min(Tve2, 2.0*Tve_init);
+    if ((rhoEveFromTve(Tve_lo) <= rhoEve) && (rhoEveFromTve(Tve_hi) >= rhoEve)) {
+      Tve_o = Tve_lo;
+      Tve2  = Tve_hi;
+    }
+  }
+
   // Execute the root-finding method
   bool Bconvg = false;
   su2double rhoEve_t = 0.0;
 
   for (unsigned short iIter = 0; iIter < maxBIter; iIter++) {
     Tve      = (Tve_o+Tve2)/2.0;
-    val_eves = ComputeSpeciesEve(Tve);
-    rhoEve_t = 0.0;
-    for (iSpecies = 0; iSpecies < nSpecies; iSpecies++) rhoEve_t += rhos[iSpecies] * val_eves[iSpecies];
+    rhoEve_t = rhoEveFromTve(Tve);
     if (fabs(rhoEve_t - rhoEve) < Btol) {
       Bconvg = true;
       break;
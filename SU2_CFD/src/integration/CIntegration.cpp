@@ -27,6 +27,7 @@
 
 #include "../../include/integration/CIntegration.hpp"
 #include "../../../Common/include/parallelization/omp_structure.hpp"
+#include "../../../Common/include/toolboxes/CPhaseProfiler.hpp"
 
 
 CIntegration::CIntegration() {
@@ -43,6 +44,8 @@ void CIntegration::Space_Integration(CGeometry *geometry,
                                      CConfig *config, unsigned short iMesh,
                                      unsigned short iRKStep,
                                      unsigned short RunTime_EqSystem) {
+  SU2_PROFILE_PHASE(FLUX_ASSEMBLY);
+
   unsigned short iMarker, KindBC;
 
   unsigned short MainSolver = config->GetContainerPosition(RunTime_EqSystem);
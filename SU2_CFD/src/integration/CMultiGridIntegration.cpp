@@ -305,7 +305,6 @@ void CMultiGridIntegration::GetProlongated_Correction(unsigned short RunTime_EqS
                                                       CGeometry *geo_fine, CGeometry *geo_coarse, CConfig *config) {
   unsigned long Point_Fine, Point_Coarse, iVertex;
   unsigned short iMarker, iChildren, iVar;
-  su2double Area_Parent, Area_Children;
   const su2double *Solution_Fine = nullptr, *Solution_Coarse = nullptr;
 
   const unsigned short nVar = sol_coarse->GetnVar();
@@ -315,16 +314,14 @@ void CMultiGridIntegration::GetProlongated_Correction(unsigned short RunTime_EqS
   SU2_OMP_FOR_STAT(roundUpDiv(geo_coarse->GetnPointDomain(), omp_get_num_threads()))
   for (Point_Coarse = 0; Point_Coarse < geo_coarse->GetnPointDomain(); Point_Coarse++) {
 
-    Area_Parent = geo_coarse->nodes->GetVolume(Point_Coarse);
-
     for (iVar = 0; iVar < nVar; iVar++) Solution[iVar] = 0.0;
 
     for (iChildren = 0; iChildren < geo_coarse->nodes->GetnChildren_CV(Point_Coarse); iChildren++) {
       Point_Fine = geo_coarse->nodes->GetChildren_CV(Point_Coarse, iChildren);
-      Area_Children = geo_fine->nodes->GetVolume(Point_Fine);
+      const su2mgfloat VolFrac = geo_coarse->nodes->GetChildVolumeFrac(Point_Coarse, iChildren);
       Solution_Fine = sol_fine->GetNodes()->GetSolution(Point_Fine);
       for (iVar = 0; iVar < nVar; iVar++)
-        Solution[iVar] -= Solution_Fine[iVar]*Area_Children/Area_Parent;
+        Solution[iVar] -= Solution_Fine[iVar]*VolFrac;
     }
 
     Solution_Coarse = sol_coarse->GetNodes()->GetSolution(Point_Coarse);
@@ -360,10 +357,11 @@ void CMultiGridIntegration::GetProlongated_Correction(unsigned short RunTime_EqS
     }
   }
 
-  /*--- MPI the set solution old ---*/
+  /*--- MPI the set solution old. Only initiate the exchange here, the scatter to the
+        fine grid below involves only owned coarse points, so the (tiny) coarse-level
+        messages are in flight while it runs and their latency is hidden. ---*/
 
   sol_coarse->InitiateComms(geo_coarse, config, SOLUTION_OLD);
-  sol_coarse->CompleteComms(geo_coarse, config, SOLUTION_OLD);
 
   SU2_OMP_FOR_STAT(roundUpDiv(geo_coarse->GetnPointDomain(), omp_get_num_threads()))
   for (Point_Coarse = 0; Point_Coarse < geo_coarse->GetnPointDomain(); Point_Coarse++) {
@@ -374,6 +372,8 @@ void CMultiGridIntegration::GetProlongated_Correction(unsigned short RunTime_EqS
   }
   END_SU2_OMP_FOR
 
+  sol_coarse->CompleteComms(geo_coarse, config, SOLUTION_OLD);
+
 }
 
 void CMultiGridIntegration::SmoothProlongated_Correction(unsigned short RunTime_EqSystem, CSolver *solver, CGeometry *geometry,
@@ -531,6 +531,7 @@ void CMultiGridIntegration::SetForcing_Term(CSolver *sol_fine, CSolver *sol_coar
       SU2_OMP_FOR_STAT(32)
       for (iVertex = 0; iVertex < geo_coarse->nVertex[iMarker]; iVertex++) {
         Point_Coarse = geo_coarse->vertex[iMarker][iVertex]->GetNode();
+        if (!geo_coarse->nodes->GetDomain(Point_Coarse)) continue;
         sol_coarse->GetNodes()->SetVel_ResTruncError_Zero(Point_Coarse);
       }
       END_SU2_OMP_FOR
@@ -557,11 +558,11 @@ void CMultiGridIntegration::SetResidual_Term(CGeometry *geometry, CSolver *solve
 }
 
 void CMultiGridIntegration::SetRestricted_Solution(unsigned short RunTime_EqSystem, CSolver *sol_fine, CSolver *sol_coarse,
-                                                   CGeometry *geo_fine, CGeometry *geo_coarse, CConfig *config) {
+                                                   CGeometry *geo_fine, CGeometry *geo_coarse, CConfig *config,
+                                                   bool completeComms) {
 
   unsigned long iVertex, Point_Fine, Point_Coarse;
   unsigned short iMarker, iVar, iChildren;
-  su2double Area_Parent, Area_Children;
   const su2double *Solution_Fine = nullptr, *Grid_Vel = nullptr;
 
   const unsigned short Solver_Position = config->GetContainerPosition(RunTime_EqSystem);
@@ -575,17 +576,15 @@ void CMultiGridIntegration::SetRestricted_Solution(unsigned short RunTime_EqSyst
   SU2_OMP_FOR_STAT(roundUpDiv(geo_coarse->GetnPointDomain(), omp_get_num_threads()))
   for (Point_Coarse = 0; Point_Coarse < geo_coarse->GetnPointDomain(); Point_Coarse++) {
 
-    Area_Parent = geo_coarse->nodes->GetVolume(Point_Coarse);
-
     for (iVar = 0; iVar < nVar; iVar++) Solution[iVar] = 0.0;
 
     for (iChildren = 0; iChildren < geo_coarse->nodes->GetnChildren_CV(Point_Coarse); iChildren++) {
 
       Point_Fine = geo_coarse->nodes->GetChildren_CV(Point_Coarse, iChildren);
-      Area_Children = geo_fine->nodes->GetVolume(Point_Fine);
+      const su2mgfloat VolFrac = geo_coarse->nodes->GetChildVolumeFrac(Point_Coarse, iChildren);
       Solution_Fine = sol_fine->GetNodes()->GetSolution(Point_Fine);
       for (iVar = 0; iVar < nVar; iVar++) {
-        Solution[iVar] += Solution_Fine[iVar]*Area_Children/Area_Parent;
+        Solution[iVar] += Solution_Fine[iVar]*VolFrac;
       }
     }
 
@@ -631,10 +630,12 @@ void CMultiGridIntegration::SetRestricted_Solution(unsigned short RunTime_EqSyst
     }
   }
 
-  /*--- MPI the new interpolated solution ---*/
+  /*--- MPI the new interpolated solution. The exchange is optionally left in flight,
+        so the caller can overlap it with work that does not need the halo values. ---*/
 
   sol_coarse->InitiateComms(geo_coarse, config, SOLUTION);
-  sol_coarse->CompleteComms(geo_coarse, config, SOLUTION);
+  if (completeComms)
+    sol_coarse->CompleteComms(geo_coarse, config, SOLUTION);
 
 }
 
@@ -642,7 +643,6 @@ void CMultiGridIntegration::SetRestricted_Gradient(unsigned short RunTime_EqSyst
                                                    CGeometry *geo_fine, CGeometry *geo_coarse, CConfig *config) {
   unsigned long Point_Fine, Point_Coarse;
   unsigned short iVar, iDim, iChildren;
-  su2double Area_Parent, Area_Children;
 
   const unsigned short nDim = geo_coarse->GetnDim();
   const unsigned short nVar = sol_coarse->GetnVar();
@@ -653,7 +653,6 @@ void CMultiGridIntegration::SetRestricted_Gradient(unsigned short RunTime_EqSyst
 
   SU2_OMP_FOR_STAT(roundUpDiv(geo_coarse->GetnPoint(), omp_get_num_threads()))
   for (Point_Coarse = 0; Point_Coarse < geo_coarse->GetnPoint(); Point_Coarse++) {
-    Area_Parent = geo_coarse->nodes->GetVolume(Point_Coarse);
 
     for (iVar = 0; iVar < nVar; iVar++)
       for (iDim = 0; iDim < nDim; iDim++)
@@ -661,12 +660,12 @@ void CMultiGridIntegration::SetRestricted_Gradient(unsigned short RunTime_EqSyst
 
     for (iChildren = 0; iChildren < geo_coarse->nodes->GetnChildren_CV(Point_Coarse); iChildren++) {
       Point_Fine = geo_coarse->nodes->GetChildren_CV(Point_Coarse, iChildren);
-      Area_Children = geo_fine->nodes->GetVolume(Point_Fine);
+      const su2mgfloat VolFrac = geo_coarse->nodes->GetChildVolumeFrac(Point_Coarse, iChildren);
       auto Gradient_fine = sol_fine->GetNodes()->GetGradient(Point_Fine);
 
       for (iVar = 0; iVar < nVar; iVar++)
         for (iDim = 0; iDim < nDim; iDim++)
-          Gradient[iVar][iDim] += Gradient_fine[iVar][iDim]*Area_Children/Area_Parent;
+          Gradient[iVar][iDim] += Gradient_fine[iVar][iDim]*VolFrac;
     }
     sol_coarse->GetNodes()->SetGradient(Point_Coarse,Gradient);
   }
@@ -722,7 +721,36 @@ void CMultiGridIntegration::Adjoint_Setup(CGeometry ****geometry, CSolver *****s
 
   if ((RunTime_EqSystem != RUNTIME_ADJFLOW_SYS) || (Iteration != 0)) return;
 
-  for (unsigned short iMGLevel = 0; iMGLevel <= config[iZone]->GetnMGLevels(); iMGLevel++) {
+  const unsigned short nMGLevels = config[iZone]->GetnMGLevels();
+
+  for (unsigned short iMGLevel = 0; iMGLevel <= nMGLevels; iMGLevel++) {
+
+    /*--- Restrict the solution to the next coarser level and initiate the halo exchange
+     of that level. The restriction only involves owned points, so the exchange of a level
+     stays in flight while this level is processed and is completed one iteration later,
+     instead of paying the (tiny) coarse-level message latencies one level at a time. ---*/
+
+    if (iMGLevel != nMGLevels) {
+      SetRestricted_Solution(RUNTIME_FLOW_SYS,
+                             solver_container[iZone][INST_0][iMGLevel][FLOW_SOL],
+                             solver_container[iZone][INST_0][iMGLevel+1][FLOW_SOL],
+                             geometry[iZone][INST_0][iMGLevel],
+                             geometry[iZone][INST_0][iMGLevel+1],
+                             config[iZone], false);
+//        ToDo: The flow solvers do not use the conservative variable gradients
+//        SetRestricted_Gradient(RUNTIME_FLOW_SYS, solver_container[iZone][INST_0][iMGLevel][FLOW_SOL],
+//                               solver_container[iZone][INST_0][iMGLevel+1][FLOW_SOL],
+//                               geometry[iZone][INST_0][iMGLevel],
+//                               geometry[iZone][INST_0][iMGLevel+1],
+//                               config[iZone]);
+    }
+
+    /*--- Complete the halo exchange of the solution restricted to this level,
+     the time step computation below needs the halo values. ---*/
+
+    if (iMGLevel > 0)
+      solver_container[iZone][INST_0][iMGLevel][FLOW_SOL]->CompleteComms(geometry[iZone][INST_0][iMGLevel],
+                                                                         config[iZone], SOLUTION);
 
     /*--- Set the time step in all the MG levels ---*/
 
@@ -742,23 +770,6 @@ void CMultiGridIntegration::Adjoint_Setup(CGeometry ****geometry, CSolver *****s
     END_SU2_OMP_MASTER
     SU2_OMP_BARRIER
 
-    /*--- Restrict solution and gradients to the coarse levels ---*/
-
-    if (iMGLevel != config[iZone]->GetnMGLevels()) {
-      SetRestricted_Solution(RUNTIME_FLOW_SYS,
-                             solver_container[iZone][INST_0][iMGLevel][FLOW_SOL],
-                             solver_container[iZone][INST_0][iMGLevel+1][FLOW_SOL],
-                             geometry[iZone][INST_0][iMGLevel],
-                             geometry[iZone][INST_0][iMGLevel+1],
-                             config[iZone]);
-//        ToDo: The flow solvers do not use the conservative variable gradients
-//        SetRestricted_Gradient(RUNTIME_FLOW_SYS, solver_container[iZone][INST_0][iMGLevel][FLOW_SOL],
-//                               solver_container[iZone][INST_0][iMGLevel+1][FLOW_SOL],
-//                               geometry[iZone][INST_0][iMGLevel],
-//                               geometry[iZone][INST_0][iMGLevel+1],
-//                               config[iZone]);
-    }
-
   }
 
 }
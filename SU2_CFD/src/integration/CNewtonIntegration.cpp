@@ -107,11 +107,16 @@ void CNewtonIntegration::Setup() {
 
 void CNewtonIntegration::PerturbSolution(const CSysVector<Scalar>& dir, Scalar mag) {
 
+  /*--- Perturb relative to the state saved at the start of the iteration, such that
+   every product of the Krylov solve uses the same base state instead of compounding
+   the perturbations of the previous products. ---*/
+
   SU2_OMP_FOR_STAT(omp_chunk_size)
   for (auto iPoint = 0ul; iPoint < geometry->GetnPoint(); ++iPoint) {
     SU2_OMP_SIMD
     for (auto iVar = 0ul; iVar < solvers[FLOW_SOL]->GetnVar(); ++iVar)
-      solvers[FLOW_SOL]->GetNodes()->AddSolution(iPoint,iVar, mag*dir(iPoint,iVar));
+      solvers[FLOW_SOL]->GetNodes()->SetSolution(iPoint,iVar,
+          solvers[FLOW_SOL]->GetNodes()->GetSolution_Old(iPoint,iVar) + mag*dir(iPoint,iVar));
   }
   END_SU2_OMP_FOR
 }
@@ -253,6 +258,10 @@ void CNewtonIntegration::MultiGrid_Iteration(CGeometry ****geometry_, CSolver **
                                       CPreconditionerWrapper(this), eps, iter, eps, false, config);
     /*--- Scale back the residual to trick the CFL adaptation. ---*/
     eps /= toleranceFactor;
+
+    /*--- Restore the unperturbed solution left over from the last matrix-free
+     product, the implicit update below is applied on top of it. ---*/
+    solvers[FLOW_SOL]->GetNodes()->Set_Solution();
   }
   SetSolutionResult(solvers[FLOW_SOL]->LinSysSol);
 
@@ -63,98 +63,203 @@ void CInterface::BroadcastData(const CInterpolator& interpolator,
                                CSolver *donor_solution, CSolver *target_solution,
                                CGeometry *donor_geometry, CGeometry *target_geometry,
                                const CConfig *donor_config, const CConfig *target_config) {
-  static_assert(su2activematrix::Storage == StorageType::RowMajor,"");
 
   GetPhysical_Constants(donor_solution, target_solution, donor_geometry, target_geometry,
                         donor_config, target_config);
 
-  /*--- Loop over interface markers. ---*/
+  /*--- Accumulators to measure the relative change of the donor data w.r.t. the previous call,
+   * used by the multizone driver to detect stagnant coupling inputs. ---*/
 
-  for (auto iMarkerInt = 0u; iMarkerInt < donor_config->GetMarker_n_ZoneInterface()/2; iMarkerInt++) {
+  passivedouble changeNum = 0.0, changeDen = 0.0;
+  bool firstBroadcast = false;
+  const auto nMarkerInt = donor_config->GetMarker_n_ZoneInterface()/2;
+  prevDonorVar.resize(nMarkerInt);
 
-    /*--- Check if this interface connects the two zones, if not continue. ---*/
+  /*--- Gather the communication pattern on the first call: the markers that connect the two
+   * zones, the donor vertex counts of every rank, and the donor global indices (sorted for
+   * the binary searches below). None of this changes between calls, so afterwards the donor
+   * variables of all interface markers are exchanged with a single gather per call. ---*/
 
-    const auto markDonor = donor_config->FindInterfaceMarker(iMarkerInt);
-    const auto markTarget = target_config->FindInterfaceMarker(iMarkerInt);
+  if (!bcastComm.built) {
+    bcastComm.markers.resize(nMarkerInt);
+    bcastComm.sendCounts.assign(size, 0);
+    bcastComm.sendDispl.assign(size, 0);
 
-    if(!CInterpolator::CheckInterfaceBoundary(markDonor, markTarget)) continue;
+    for (auto iMarkerInt = 0u; iMarkerInt < nMarkerInt; iMarkerInt++) {
+      auto& pattern = bcastComm.markers[iMarkerInt];
 
-    /*--- Count donor vertices on this rank. ---*/
+      /*--- Check if this interface connects the two zones, if not continue. ---*/
 
-    int nLocalVertexDonor = 0;
-    if (markDonor >= 0) {
-      for (auto iVertex = 0ul; iVertex < donor_geometry->GetnVertex(markDonor); iVertex++) {
-        auto Point_Donor = donor_geometry->vertex[markDonor][iVertex]->GetNode();
-        /*--- Only domain points are donors. ---*/
-        nLocalVertexDonor += donor_geometry->nodes->GetDomain(Point_Donor);
+      const auto markDonor = donor_config->FindInterfaceMarker(iMarkerInt);
+      const auto markTarget = target_config->FindInterfaceMarker(iMarkerInt);
+
+      if(!CInterpolator::CheckInterfaceBoundary(markDonor, markTarget)) continue;
+      pattern.active = true;
+
+      /*--- Count donor vertices on this rank. ---*/
+
+      int nLocalVertexDonor = 0;
+      if (markDonor >= 0) {
+        for (auto iVertex = 0ul; iVertex < donor_geometry->GetnVertex(markDonor); iVertex++) {
+          auto Point_Donor = donor_geometry->vertex[markDonor][iVertex]->GetNode();
+          /*--- Only domain points are donors. ---*/
+          nLocalVertexDonor += donor_geometry->nodes->GetDomain(Point_Donor);
+        }
+      }
+
+      /*--- Gather donor counts and compute total sizes, and displacements (cumulative
+       * sums) to perform an Allgatherv of the donor indices. ---*/
+
+      vector<int> displIdx(size,0);
+      pattern.nAllVertexDonor.resize(size);
+      SU2_MPI::Allgather(&nLocalVertexDonor, 1, MPI_INT, pattern.nAllVertexDonor.data(), 1, MPI_INT, SU2_MPI::GetComm());
+
+      for (int i = 1; i < size; ++i) displIdx[i] = displIdx[i-1] + pattern.nAllVertexDonor[i-1];
+      pattern.nGlobalVertexDonor = displIdx.back() + pattern.nAllVertexDonor.back();
+
+      /*--- Gather the global indices of the donor vertices of every rank. ---*/
+
+      vector<unsigned long> sendDonorIdx(nLocalVertexDonor);
+
+      if (markDonor >= 0) {
+        for (auto iVertex = 0ul, iSend = 0ul; iVertex < donor_geometry->GetnVertex(markDonor); iVertex++) {
+          const auto iPoint = donor_geometry->vertex[markDonor][iVertex]->GetNode();
+
+          /*--- If this processor owns the node. ---*/
+          if (donor_geometry->nodes->GetDomain(iPoint))
+            sendDonorIdx[iSend++] = donor_geometry->nodes->GetGlobalIndex(iPoint);
+        }
       }
+
+      pattern.donorIdx.resize(pattern.nGlobalVertexDonor);
+      SU2_MPI::Allgatherv(sendDonorIdx.data(), sendDonorIdx.size(), MPI_UNSIGNED_LONG, pattern.donorIdx.data(),
+                          pattern.nAllVertexDonor.data(), displIdx.data(), MPI_UNSIGNED_LONG, SU2_MPI::GetComm());
+
+      /*--- The packed exchange holds the variables of this marker after those of the
+       * previous markers, within the segment of each rank. ---*/
+
+      for (int i = 0; i < size; ++i) bcastComm.sendCounts[i] += pattern.nAllVertexDonor[i] * nVar;
     }
 
-    /*--- Gather donor counts and compute total sizes, and displacements (cumulative
-     * sums) to perform an Allgatherv of donor indices and variables. ---*/
+    for (int i = 1; i < size; ++i) bcastComm.sendDispl[i] = bcastComm.sendDispl[i-1] + bcastComm.sendCounts[i-1];
+    bcastComm.sendBuf.resize(bcastComm.sendCounts[rank]);
+    bcastComm.recvBuf.resize(bcastComm.sendDispl.back() + bcastComm.sendCounts.back());
+
+    /*--- Precompute the positions of the donor data of each marker within the packed
+     * exchange buffer, both in gathered (rank) order and sorted by donor index to then
+     * use binary searches. ---*/
+
+    vector<unsigned long> segStart(bcastComm.sendDispl.begin(), bcastComm.sendDispl.end());
 
-    vector<int> nAllVertexDonor(size), nAllVarCounts(size), displIdx(size,0), displVar(size);
-    SU2_MPI::Allgather(&nLocalVertexDonor, 1, MPI_INT, nAllVertexDonor.data(), 1, MPI_INT, SU2_MPI::GetComm());
+    for (auto iMarkerInt = 0u; iMarkerInt < nMarkerInt; iMarkerInt++) {
+      auto& pattern = bcastComm.markers[iMarkerInt];
+      if (!pattern.active) continue;
 
-    for (int i = 0; i < size; ++i) {
-      nAllVarCounts[i] = nAllVertexDonor[i] * nVar;
-      if(i) displIdx[i] = displIdx[i-1] + nAllVertexDonor[i-1];
-      displVar[i] = displIdx[i] * nVar;
+      pattern.gatherOffset.resize(pattern.nGlobalVertexDonor);
+      auto iVertex = 0ul;
+      for (int i = 0; i < size; ++i) {
+        for (int j = 0; j < pattern.nAllVertexDonor[i]; ++j) {
+          pattern.gatherOffset[iVertex++] = segStart[i];
+          segStart[i] += nVar;
+        }
+      }
+
+      /*--- Sort the donor information by index, keeping the permutation to address
+       * the gathered variables in the same order. ---*/
+
+      vector<size_t> order(pattern.donorIdx.size());
+      iota(order.begin(), order.end(), 0ul);
+      sort(order.begin(), order.end(),
+           [&pattern](size_t i, size_t j) {return pattern.donorIdx[i] < pattern.donorIdx[j];} );
+
+      vector<unsigned long> sortedIdx(pattern.donorIdx.size());
+      pattern.sortedOffset.resize(pattern.donorIdx.size());
+      for (auto i = 0ul; i < order.size(); ++i) {
+        sortedIdx[i] = pattern.donorIdx[order[i]];
+        pattern.sortedOffset[i] = pattern.gatherOffset[order[i]];
+      }
+      pattern.donorIdx = move(sortedIdx);
     }
 
-    /*--- Fill send buffers. ---*/
+    bcastComm.built = true;
+  }
+
+  /*--- Packs the donor variables of all interface markers of this rank. ---*/
+
+  auto packDonorData = [&]() {
+    auto* sendBuf = bcastComm.sendBuf.data();
+
+    for (auto iMarkerInt = 0u; iMarkerInt < nMarkerInt; iMarkerInt++) {
+      if (!bcastComm.markers[iMarkerInt].active) continue;
 
-    vector<unsigned long> sendDonorIdx(nLocalVertexDonor);
-    su2activematrix sendDonorVar(nLocalVertexDonor, nVar);
+      const auto markDonor = donor_config->FindInterfaceMarker(iMarkerInt);
+      if (markDonor < 0) continue;
 
-    if (markDonor >= 0) {
-      for (auto iVertex = 0ul, iSend = 0ul; iVertex < donor_geometry->GetnVertex(markDonor); iVertex++) {
+      for (auto iVertex = 0ul; iVertex < donor_geometry->GetnVertex(markDonor); iVertex++) {
         const auto iPoint = donor_geometry->vertex[markDonor][iVertex]->GetNode();
 
         /*--- If this processor owns the node. ---*/
-        if (donor_geometry->nodes->GetDomain(iPoint)) {
-
-          GetDonor_Variable(donor_solution, donor_geometry, donor_config, markDonor, iVertex, iPoint);
-          for (auto iVar = 0u; iVar < nVar; iVar++) sendDonorVar(iSend, iVar) = Donor_Variable[iVar];
+        if (!donor_geometry->nodes->GetDomain(iPoint)) continue;
 
-          sendDonorIdx[iSend] = donor_geometry->nodes->GetGlobalIndex(iPoint);
-          ++iSend;
-        }
+        GetDonor_Variable(donor_solution, donor_geometry, donor_config, markDonor, iVertex, iPoint);
+        for (auto iVar = 0u; iVar < nVar; iVar++) *sendBuf++ = Donor_Variable[iVar];
       }
     }
+  };
 
-    /*--- Gather data. ---*/
+  /*--- In the asynchronous mode the donor data is gathered with a nonblocking operation that is
+   * started at the end of this call and consumed at the beginning of the next one. The target then
+   * sees donor data that is one transfer old (as in a block-Jacobi iteration), in exchange the
+   * interface communication overlaps with the zone solves in between. Only interfaces that
+   * tolerate the lag offer this mode, and the first call seeds it with a synchronous exchange. ---*/
 
-    const auto nGlobalVertexDonor = displIdx.back() + nAllVertexDonor.back();
+  const bool asyncTransfer = allowAsyncTransfer && donor_config->GetCHT_AsyncCoupling() &&
+                             target_config->GetCHT_AsyncCoupling();
 
-    vector<unsigned long> donorIdx(nGlobalVertexDonor);
-    su2activematrix donorVar(nGlobalVertexDonor, nVar);
+  if (bcastComm.asyncPending) {
+    SU2_MPI::Wait(&bcastComm.asyncReq, MPI_STATUS_IGNORE);
+    bcastComm.asyncPending = false;
+  }
+  else {
+    packDonorData();
 
-    SU2_MPI::Allgatherv(sendDonorIdx.data(), sendDonorIdx.size(), MPI_UNSIGNED_LONG, donorIdx.data(),
-                        nAllVertexDonor.data(), displIdx.data(), MPI_UNSIGNED_LONG, SU2_MPI::GetComm());
+    /*--- Gather the data of all markers with a single message per direction. ---*/
 
-    SU2_MPI::Allgatherv(sendDonorVar.data(), sendDonorVar.size(), MPI_DOUBLE, donorVar.data(),
-                        nAllVarCounts.data(), displVar.data(), MPI_DOUBLE, SU2_MPI::GetComm());
+    SU2_MPI::Allgatherv(bcastComm.sendBuf.data(), bcastComm.sendBuf.size(), MPI_DOUBLE, bcastComm.recvBuf.data(),
+                        bcastComm.sendCounts.data(), bcastComm.sendDispl.data(), MPI_DOUBLE, SU2_MPI::GetComm());
+  }
 
-    /*--- This rank does not need to do more work. ---*/
-    if (markTarget < 0) continue;
+  /*--- Interpolate onto the target markers. ---*/
+
+  for (auto iMarkerInt = 0u; iMarkerInt < nMarkerInt; iMarkerInt++) {
 
-    /*--- Sort the donor information by index to then use binary searches. ---*/
+    const auto& pattern = bcastComm.markers[iMarkerInt];
+    if (!pattern.active) continue;
 
-    vector<size_t> order(donorIdx.size());
-    iota(order.begin(), order.end(), 0ul);
-    sort(order.begin(), order.end(), [&donorIdx](size_t i, size_t j) {return donorIdx[i] < donorIdx[j];} );
+    const auto markTarget = target_config->FindInterfaceMarker(iMarkerInt);
 
-    /*--- inplace permutation. ---*/
-    for (size_t i = 0; i < order.size(); ++i) {
-      auto j = order[i];
-      while (j < i) j = order[j];
-      if (i == j) continue;
-      swap(donorIdx[i], donorIdx[j]);
-      for (auto iVar = 0u; iVar < nVar; ++iVar)
-        swap(donorVar(i,iVar), donorVar(j,iVar));
+    /*--- Compare the gathered data with that of the previous call (addressed in a
+     * rank-consistent order). Done on all ranks for consistency. ---*/
+
+    auto& prevVar = prevDonorVar[iMarkerInt];
+    if (prevVar.size() != pattern.nGlobalVertexDonor * nVar) {
+      firstBroadcast = true;
+      prevVar.resize(pattern.nGlobalVertexDonor * nVar);
+    }
+    for (auto i = 0ul, k = 0ul; i < pattern.nGlobalVertexDonor; ++i) {
+      for (auto iVar = 0u; iVar < nVar; ++iVar, ++k) {
+        const passivedouble val = SU2_TYPE::GetValue(bcastComm.recvBuf[pattern.gatherOffset[i] + iVar]);
+        changeNum += pow(val - prevVar[k], 2);
+        changeDen += pow(val, 2);
+        prevVar[k] = val;
+      }
     }
 
+    /*--- This rank does not need to do more work. ---*/
+    if (markTarget < 0) continue;
+
+    const auto& donorIdx = pattern.donorIdx;
+
     /*--- Loop over target vertices. ---*/
 
     for (auto iVertex = 0ul; iVertex < target_geometry->GetnVertex(markTarget); iVertex++) {
@@ -181,7 +286,7 @@ void CInterface::BroadcastData(const CInterpolator& interpolator,
         assert(idx < static_cast<long>(donorIdx.size()));
 
         /*--- Recover the Target_Variable from the buffer of variables. ---*/
-        RecoverTarget_Variable(donorVar[idx], donorCoeff);
+        RecoverTarget_Variable(&bcastComm.recvBuf[pattern.sortedOffset[idx]], donorCoeff);
 
         /*--- If the value is not directly aggregated in the previous function. ---*/
         if (!valAggregated)
@@ -193,6 +298,22 @@ void CInterface::BroadcastData(const CInterpolator& interpolator,
         SetTarget_Variable(target_solution, target_geometry, target_config, markTarget, iVertex, iPoint);
     }
   }
+
+  /*--- On the first broadcast there is nothing to compare against, report a large change. ---*/
+
+  if (firstBroadcast) relativeChange = 1e30;
+  else relativeChange = sqrt(changeNum) / max(sqrt(changeDen), 1e-30);
+
+  /*--- Start the gather of the current donor data, to be consumed on the next call. The
+   * buffers are not touched again until then, so no copies are needed. ---*/
+
+  if (asyncTransfer) {
+    packDonorData();
+    SU2_MPI::Iallgatherv(bcastComm.sendBuf.data(), bcastComm.sendBuf.size(), MPI_DOUBLE, bcastComm.recvBuf.data(),
+                         bcastComm.sendCounts.data(), bcastComm.sendDispl.data(), MPI_DOUBLE, SU2_MPI::GetComm(),
+                         &bcastComm.asyncReq);
+    bcastComm.asyncPending = true;
+  }
 }
 
 void CInterface::PreprocessAverage(CGeometry *donor_geometry, CGeometry *target_geometry,
@@ -34,6 +34,9 @@
 
 CConjugateHeatInterface::CConjugateHeatInterface(unsigned short val_nVar, unsigned short val_nConst) :
   CInterface(val_nVar, val_nConst) {
+
+  /*--- CHT coupling tolerates lagged donor data, allow the asynchronous transfer mode. ---*/
+  allowAsyncTransfer = true;
 }
 
 void CConjugateHeatInterface::GetDonor_Variable(CSolver *donor_solution, CGeometry *donor_geometry,
@@ -102,26 +102,56 @@ void CFluidIteration::Iterate(COutput* output, CIntegration**** integration, CGe
   }
   config[val_iZone]->SetGlobalParam(main_solver, RUNTIME_FLOW_SYS);
 
-  /*--- Solve the Euler, Navier-Stokes or Reynolds-averaged Navier-Stokes (RANS) equations (one iteration) ---*/
+  /*--- Store an in-memory snapshot of all active solvers, so a diverged iteration
+   can be retried from it at a reduced CFL number instead of aborting the run. ---*/
 
-  integration[val_iZone][val_iInst][FLOW_SOL]->MultiGrid_Iteration(geometry, solver, numerics, config, RUNTIME_FLOW_SYS,
-                                                                   val_iZone, val_iInst);
+  const bool rollback =
+      (config[val_iZone]->GetCFL_Adapt() == YES) && config[val_iZone]->GetCFL_AdaptRollback() && (!disc_adj);
 
-  /*--- If the flow integration is not fully coupled, run the various single grid integrations. ---*/
+  if (rollback) {
+    for (unsigned short iMesh = 0; iMesh <= config[val_iZone]->GetnMGLevels(); iMesh++) {
+      for (unsigned short iSol = 0; iSol < MAX_SOLS; iSol++) {
+        auto solverState = solver[val_iZone][val_iInst][iMesh][iSol];
+        if (solverState != nullptr) solverState->SnapshotSolution();
+      }
+    }
+  }
 
-  if ((main_solver == MAIN_SOLVER::RANS) && !frozen_visc) {
-    /*--- Solve the turbulence model ---*/
+  /*--- Number of flow-turbulence block-Gauss-Seidel sweeps of this iteration. Each
+   extra sweep re-solves the flow and turbulence implicit systems with the freshest
+   data of the other, strengthening the segregated coupling so the CFL number can be
+   raised further (see COUPLED_FLOW_TURB_SWEEPS). ---*/
 
-    config[val_iZone]->SetGlobalParam(main_solver, RUNTIME_TURB_SYS);
-    integration[val_iZone][val_iInst][TURB_SOL]->SingleGrid_Iteration(geometry, solver, numerics, config,
-                                                                      RUNTIME_TURB_SYS, val_iZone, val_iInst);
+  unsigned short nSweeps = 1;
+  if ((main_solver == MAIN_SOLVER::RANS) && !frozen_visc &&
+      (InnerIter >= config[val_iZone]->GetCoupled_FlowTurb_StartIter()))
+    nSweeps = max<unsigned short>(config[val_iZone]->GetCoupled_FlowTurb_Sweeps(), 1);
 
-    /*--- Solve transition model ---*/
+  for (auto iSweep = 0u; iSweep < nSweeps; iSweep++) {
 
-    if (config[val_iZone]->GetKind_Trans_Model() == TURB_TRANS_MODEL::LM) {
-      config[val_iZone]->SetGlobalParam(main_solver, RUNTIME_TRANS_SYS);
-      integration[val_iZone][val_iInst][TRANS_SOL]->SingleGrid_Iteration(geometry, solver, numerics, config,
-                                                                         RUNTIME_TRANS_SYS, val_iZone, val_iInst);
+    if (iSweep > 0) config[val_iZone]->SetGlobalParam(main_solver, RUNTIME_FLOW_SYS);
+
+    /*--- Solve the Euler, Navier-Stokes or Reynolds-averaged Navier-Stokes (RANS) equations (one iteration) ---*/
+
+    integration[val_iZone][val_iInst][FLOW_SOL]->MultiGrid_Iteration(geometry, solver, numerics, config,
+                                                                     RUNTIME_FLOW_SYS, val_iZone, val_iInst);
+
+    /*--- If the flow integration is not fully coupled, run the various single grid integrations. ---*/
+
+    if ((main_solver == MAIN_SOLVER::RANS) && !frozen_visc) {
+      /*--- Solve the turbulence model ---*/
+
+      config[val_iZone]->SetGlobalParam(main_solver, RUNTIME_TURB_SYS);
+      integration[val_iZone][val_iInst][TURB_SOL]->SingleGrid_Iteration(geometry, solver, numerics, config,
+                                                                        RUNTIME_TURB_SYS, val_iZone, val_iInst);
+
+      /*--- Solve transition model ---*/
+
+      if (config[val_iZone]->GetKind_Trans_Model() == TURB_TRANS_MODEL::LM) {
+        config[val_iZone]->SetGlobalParam(main_solver, RUNTIME_TRANS_SYS);
+        integration[val_iZone][val_iInst][TRANS_SOL]->SingleGrid_Iteration(geometry, solver, numerics, config,
+                                                                           RUNTIME_TRANS_SYS, val_iZone, val_iInst);
+      }
     }
   }
 
@@ -154,9 +184,42 @@ void CFluidIteration::Iterate(COutput* output, CIntegration**** integration, CGe
                                                                      RUNTIME_RADIATION_SYS, val_iZone, val_iInst);
   }
 
+  /*--- If the nonlinear iteration diverged, restore the snapshot and reduce the
+   local CFL numbers so the iteration is retried at a safer time step. ---*/
+
+  bool diverged = false;
+
+  if (rollback) {
+    unsigned short myDiverged = 0, globalDiverged = 0;
+    for (unsigned short iSol = 0; iSol < MAX_SOLS; iSol++) {
+      auto solverState = solver[val_iZone][val_iInst][MESH_0][iSol];
+      if ((solverState != nullptr) && solverState->GetSolutionDiverged()) myDiverged = 1;
+    }
+
+    /*--- With reduced MPI comms the residuals are local, make the decision collectively. ---*/
+
+    SU2_MPI::Allreduce(&myDiverged, &globalDiverged, 1, MPI_UNSIGNED_SHORT, MPI_MAX, SU2_MPI::GetComm());
+    diverged = (globalDiverged != 0);
+
+    if (diverged) {
+      const su2double cflFactor = config[val_iZone]->GetCFL_AdaptParam(0);
+      const su2double cflMin = config[val_iZone]->GetCFL_AdaptParam(2);
+
+      for (unsigned short iMesh = 0; iMesh <= config[val_iZone]->GetnMGLevels(); iMesh++) {
+        for (unsigned short iSol = 0; iSol < MAX_SOLS; iSol++) {
+          auto solverState = solver[val_iZone][val_iInst][iMesh][iSol];
+          if (solverState != nullptr) solverState->RollbackSolution(cflFactor, cflMin);
+        }
+      }
+
+      if (rank == MASTER_NODE)
+        cout << "WARNING: Solver diverged, restoring the solution snapshot and reducing the CFL number." << endl;
+    }
+  }
+
   /*--- Adapt the CFL number using an exponential progression with under-relaxation approach. ---*/
 
-  if ((config[val_iZone]->GetCFL_Adapt() == YES) && (!disc_adj)) {
+  if ((config[val_iZone]->GetCFL_Adapt() == YES) && (!disc_adj) && (!diverged)) {
     SU2_OMP_PARALLEL
     solver[val_iZone][val_iInst][MESH_0][FLOW_SOL]->AdaptCFLNumber(geometry[val_iZone][val_iInst],
                                                                    solver[val_iZone][val_iInst], config[val_iZone]);
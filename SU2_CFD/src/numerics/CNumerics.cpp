@@ -46,8 +46,6 @@ CNumerics::CNumerics(void) {
 CNumerics::CNumerics(unsigned short val_nDim, unsigned short val_nVar,
                      const CConfig* config) {
 
-  unsigned short iDim;
-
   nDim = val_nDim;
   nVar = val_nVar;
 
@@ -57,11 +55,9 @@ CNumerics::CNumerics(unsigned short val_nDim, unsigned short val_nVar,
   Prandtl_Turb = config->GetPrandtl_Turb();
   Gas_Constant = config->GetGas_ConstantND();
 
-  tau = new su2double* [nDim];
-  for (iDim = 0; iDim < nDim; iDim++)
-    tau[iDim] = new su2double [nDim] ();
+  tau = ScratchMemory.Allocate2D<su2double,true>(nDim, nDim);
 
-  Proj_Flux_Tensor = new su2double [nVar] ();
+  Proj_Flux_Tensor = ScratchMemory.Allocate<su2double,true>(nVar);
 
   turb_ke_i = 0.0;
   turb_ke_j = 0.0;
@@ -78,15 +74,7 @@ CNumerics::CNumerics(unsigned short val_nDim, unsigned short val_nVar,
 }
 
 CNumerics::~CNumerics(void) {
-
-  // visc
-  delete [] Proj_Flux_Tensor;
-
-  if (tau) {
-    for (unsigned short iDim = 0; iDim < nDim; iDim++)
-      delete [] tau[iDim];
-    delete [] tau;
-  }
+  /*--- The scratch arrays live in ScratchMemory, which frees them. ---*/
 }
 
 void CNumerics::GetInviscidProjFlux(const su2double *val_density,
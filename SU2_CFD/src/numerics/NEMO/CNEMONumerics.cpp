@@ -52,6 +52,10 @@ CNEMONumerics::CNEMONumerics(unsigned short val_nDim, unsigned short val_nVar,
     LAM_VISC_INDEX  = nSpecies+nDim+8;
     EDDY_VISC_INDEX = nSpecies+nDim+9;
 
+    /*--- Scratch space for the viscous flux tensor, sized once here instead of
+     *    being allocated on every GetViscousProjFlux call. ---*/
+    Flux_Tensor.resize(nVar,nDim) = su2double(0.0);
+
     /*--- Read from CConfig ---*/
     implicit   = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
 
@@ -237,8 +241,6 @@ void CNEMONumerics::GetViscousProjFlux(const su2double *val_primvar,
   su2double mu, ktr, kve, rho, T, Tve, RuSI, Ru;
   auto& Ms = fluidmodel->GetSpeciesMolarMass();
 
-  su2activematrix Flux_Tensor(nVar,nDim);
-
   /*--- Initialize ---*/
   for (iVar = 0; iVar < nVar; iVar++) {
     Proj_Flux_Tensor[iVar] = 0.0;
@@ -50,6 +50,8 @@ CSource_NEMO::CSource_NEMO(unsigned short val_nDim,
   for(unsigned short iVar = 0; iVar < nVar; ++iVar)
     jacobian[iVar] = new su2double [nVar]();
 
+  rhos.resize(nSpecies, 0.0);
+
 }
 
 CSource_NEMO::~CSource_NEMO(void) {
@@ -76,9 +78,6 @@ CNumerics::ResidualType<> CSource_NEMO::ComputeChemistry(const CConfig *config)
   unsigned short iSpecies, iVar;
   unsigned short jVar;
 
-  vector<su2double> rhos;
-  rhos.resize(nSpecies,0.0);
-
   /*--- Initialize residual and Jacobian arrays ---*/
   for (iVar = 0; iVar < nVar; iVar++) {
     residual[iVar] = 0.0;
@@ -128,9 +127,6 @@ CNumerics::ResidualType<> CSource_NEMO::ComputeVibRelaxation(const CConfig *conf
   su2double res_min = -1E6;
   su2double res_max = 1E6;
 
-  vector<su2double> rhos;
-  rhos.resize(nSpecies,0.0);
-
   /*--- Initialize residual and Jacobian arrays ---*/
   for (iVar = 0; iVar < nVar; iVar++) {
     residual[iVar] = 0.0;
@@ -120,6 +120,7 @@ void CFEALinearElasticity::Compute_Tangent_Matrix(CElement *element, const CConf
       /*--- Compute the BT.D Matrix ---*/
 
       for (iVar = 0; iVar < nDim; iVar++) {
+        SU2_OMP_SIMD_IF_NOT_AD
         for (jVar = 0; jVar < bDim; jVar++) {
           AuxMatrix[iVar][jVar] = 0.0;
           for (kVar = 0; kVar < bDim; kVar++) {
@@ -149,6 +150,7 @@ void CFEALinearElasticity::Compute_Tangent_Matrix(CElement *element, const CConf
         }
 
         for (iVar = 0; iVar < nDim; iVar++) {
+          SU2_OMP_SIMD_IF_NOT_AD
           for (jVar = 0; jVar < nDim; jVar++) {
             KAux_ab[iVar][jVar] = 0.0;
             for (kVar = 0; kVar < bDim; kVar++) {
@@ -176,6 +178,7 @@ void CFEALinearElasticity::Compute_Tangent_Matrix(CElement *element, const CConf
     {
       const su2double *Kab = element->Get_Kab(iNode,jNode);
 
+      SU2_OMP_SIMD_IF_NOT_AD
       for (iVar = 0; iVar < nVar; iVar++) {
         res_aux[iVar] = 0.0;
         for (jVar = 0; jVar < nVar; jVar++)
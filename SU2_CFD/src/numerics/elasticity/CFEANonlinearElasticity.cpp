@@ -337,6 +337,7 @@ void CFEANonlinearElasticity::Compute_Tangent_Matrix(CElement *element, const CC
     /*--- Compute the left Cauchy deformation tensor ---*/
 
     for (iVar = 0; iVar < 3; iVar++) {
+      SU2_OMP_SIMD_IF_NOT_AD
       for (jVar = 0; jVar < 3; jVar++) {
         for (kVar = 0; kVar < 3; kVar++) {
           b_Mat[iVar][jVar] += F_Mat[iVar][kVar]*F_Mat[jVar][kVar];
@@ -359,6 +360,7 @@ void CFEANonlinearElasticity::Compute_Tangent_Matrix(CElement *element, const CC
         /*--- Compute the nodal stress term for each gaussian point and for each node, ---*/
         /*--- and add it to the element structure to be retrieved from the solver      ---*/
 
+      SU2_OMP_SIMD_IF_NOT_AD
       for (iVar = 0; iVar < nDim; iVar++) {
         KAux_t_a[iVar] = 0.0;
         for (jVar = 0; jVar < nDim; jVar++) {
@@ -393,6 +395,7 @@ void CFEANonlinearElasticity::Compute_Tangent_Matrix(CElement *element, const CC
         /*--- Compute the BT.D Matrix ---*/
 
       for (iVar = 0; iVar < nDim; iVar++) {
+        SU2_OMP_SIMD_IF_NOT_AD
         for (jVar = 0; jVar < bDim; jVar++) {
           AuxMatrixKc[iVar][jVar] = 0.0;
           for (kVar = 0; kVar < bDim; kVar++) {
@@ -432,6 +435,7 @@ void CFEANonlinearElasticity::Compute_Tangent_Matrix(CElement *element, const CC
 
         /*--- KAux_ab is the term for the constitutive part of the tangent matrix ---*/
         for (iVar = 0; iVar < nDim; iVar++) {
+          SU2_OMP_SIMD_IF_NOT_AD
           for (jVar = 0; jVar < nDim; jVar++) {
             KAux_ab[iVar][jVar] = 0.0;
             for (kVar = 0; kVar < bDim; kVar++) {
@@ -559,6 +563,7 @@ void CFEANonlinearElasticity::Compute_NodalStress_Term(CElement *element, const
     /*--- Compute the left Cauchy deformation tensor ---*/
 
     for (iVar = 0; iVar < 3; iVar++) {
+      SU2_OMP_SIMD_IF_NOT_AD
       for (jVar = 0; jVar < 3; jVar++) {
         for (kVar = 0; kVar < 3; kVar++) {
           b_Mat[iVar][jVar] += F_Mat[iVar][kVar]*F_Mat[jVar][kVar];
@@ -838,6 +843,7 @@ su2double CFEANonlinearElasticity::Compute_Averaged_NodalStress(CElement *elemen
     /*--- Compute the left Cauchy deformation tensor ---*/
 
     for (iVar = 0; iVar < 3; iVar++) {
+      SU2_OMP_SIMD_IF_NOT_AD
       for (jVar = 0; jVar < 3; jVar++) {
         for (kVar = 0; kVar < 3; kVar++) {
           b_Mat[iVar][jVar] += F_Mat[iVar][kVar]*F_Mat[jVar][kVar];
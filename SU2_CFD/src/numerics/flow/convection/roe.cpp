@@ -41,46 +41,25 @@ CUpwRoeBase_Flow::CUpwRoeBase_Flow(unsigned short val_nDim, unsigned short val_n
 
   roe_low_dissipation = val_low_dissipation;
 
-  Flux = new su2double [nVar];
-  Diff_U = new su2double [nVar];
-  ProjFlux_i = new su2double [nVar];
-  ProjFlux_j = new su2double [nVar];
-  Conservatives_i = new su2double [nVar];
-  Conservatives_j = new su2double [nVar];
-  Lambda = new su2double [nVar];
-  P_Tensor = new su2double* [nVar];
-  invP_Tensor = new su2double* [nVar];
-  Jacobian_i = new su2double* [nVar];
-  Jacobian_j = new su2double* [nVar];
-  for (unsigned short iVar = 0; iVar < nVar; iVar++) {
-    P_Tensor[iVar] = new su2double [nVar];
-    invP_Tensor[iVar] = new su2double [nVar];
-    Jacobian_i[iVar] = new su2double [nVar];
-    Jacobian_j[iVar] = new su2double [nVar];
-  }
+  /*--- All the scratch arrays of the scheme come from the instance arena,
+   so that they are packed contiguously in memory. ---*/
+
+  Flux = ScratchMemory.Allocate<su2double>(nVar);
+  Diff_U = ScratchMemory.Allocate<su2double>(nVar);
+  ProjFlux_i = ScratchMemory.Allocate<su2double>(nVar);
+  ProjFlux_j = ScratchMemory.Allocate<su2double>(nVar);
+  Conservatives_i = ScratchMemory.Allocate<su2double>(nVar);
+  Conservatives_j = ScratchMemory.Allocate<su2double>(nVar);
+  Lambda = ScratchMemory.Allocate<su2double>(nVar);
+  P_Tensor = ScratchMemory.Allocate2D<su2double>(nVar, nVar);
+  invP_Tensor = ScratchMemory.Allocate2D<su2double>(nVar, nVar);
+  Jacobian_i = ScratchMemory.Allocate2D<su2double>(nVar, nVar);
+  Jacobian_j = ScratchMemory.Allocate2D<su2double>(nVar, nVar);
 
 }
 
 CUpwRoeBase_Flow::~CUpwRoeBase_Flow(void) {
-
-  delete [] Flux;
-  delete [] Diff_U;
-  delete [] ProjFlux_i;
-  delete [] ProjFlux_j;
-  delete [] Conservatives_i;
-  delete [] Conservatives_j;
-  delete [] Lambda;
-  for (unsigned short iVar = 0; iVar < nVar; iVar++) {
-    delete [] P_Tensor[iVar];
-    delete [] invP_Tensor[iVar];
-    delete [] Jacobian_i[iVar];
-    delete [] Jacobian_j[iVar];
-  }
-  delete [] P_Tensor;
-  delete [] invP_Tensor;
-  delete [] Jacobian_i;
-  delete [] Jacobian_j;
-
+  /*--- The scratch arrays live in ScratchMemory, which frees them. ---*/
 }
 
 void CUpwRoeBase_Flow::FinalizeResidual(su2double *val_residual, su2double **val_Jacobian_i,
@@ -450,61 +429,26 @@ CUpwTurkel_Flow::CUpwTurkel_Flow(unsigned short val_nDim, unsigned short val_nVa
   Beta_min = config->GetminTurkelBeta();
   Beta_max = config->GetmaxTurkelBeta();
 
-  Flux = new su2double [nVar];
-  Diff_U = new su2double [nVar];
-  Velocity_i = new su2double [nDim];
-  Velocity_j = new su2double [nDim];
-  RoeVelocity = new su2double [nDim];
-  ProjFlux_i = new su2double [nVar];
-  ProjFlux_j = new su2double [nVar];
-  Lambda = new su2double [nVar];
-  Epsilon = new su2double [nVar];
-  absPeJac = new su2double* [nVar];
-  invRinvPe = new su2double* [nVar];
-  R_Tensor  = new su2double* [nVar];
-  Matrix    = new su2double* [nVar];
-  Art_Visc  = new su2double* [nVar];
-  Jacobian_i = new su2double* [nVar];
-  Jacobian_j = new su2double* [nVar];
-  for (iVar = 0; iVar < nVar; iVar++) {
-    absPeJac[iVar] = new su2double [nVar];
-    invRinvPe[iVar] = new su2double [nVar];
-    Matrix[iVar] = new su2double [nVar];
-    Art_Visc[iVar] = new su2double [nVar];
-    R_Tensor[iVar] = new su2double [nVar];
-    Jacobian_i[iVar] = new su2double [nVar];
-    Jacobian_j[iVar] = new su2double [nVar];
-  }
+  Flux = ScratchMemory.Allocate<su2double>(nVar);
+  Diff_U = ScratchMemory.Allocate<su2double>(nVar);
+  Velocity_i = ScratchMemory.Allocate<su2double>(nDim);
+  Velocity_j = ScratchMemory.Allocate<su2double>(nDim);
+  RoeVelocity = ScratchMemory.Allocate<su2double>(nDim);
+  ProjFlux_i = ScratchMemory.Allocate<su2double>(nVar);
+  ProjFlux_j = ScratchMemory.Allocate<su2double>(nVar);
+  Lambda = ScratchMemory.Allocate<su2double>(nVar);
+  Epsilon = ScratchMemory.Allocate<su2double>(nVar);
+  absPeJac = ScratchMemory.Allocate2D<su2double>(nVar, nVar);
+  invRinvPe = ScratchMemory.Allocate2D<su2double>(nVar, nVar);
+  R_Tensor = ScratchMemory.Allocate2D<su2double>(nVar, nVar);
+  Matrix = ScratchMemory.Allocate2D<su2double>(nVar, nVar);
+  Art_Visc = ScratchMemory.Allocate2D<su2double>(nVar, nVar);
+  Jacobian_i = ScratchMemory.Allocate2D<su2double>(nVar, nVar);
+  Jacobian_j = ScratchMemory.Allocate2D<su2double>(nVar, nVar);
 }
 
 CUpwTurkel_Flow::~CUpwTurkel_Flow(void) {
-
-  delete [] Flux;
-  delete [] Diff_U;
-  delete [] Velocity_i;
-  delete [] Velocity_j;
-  delete [] RoeVelocity;
-  delete [] ProjFlux_i;
-  delete [] ProjFlux_j;
-  delete [] Lambda;
-  delete [] Epsilon;
-  for (iVar = 0; iVar < nVar; iVar++) {
-    delete [] absPeJac[iVar];
-    delete [] invRinvPe[iVar];
-    delete [] Matrix[iVar];
-    delete [] Art_Visc[iVar];
-    delete [] R_Tensor[iVar];
-    delete [] Jacobian_i[iVar];
-    delete [] Jacobian_j[iVar];
-  }
-  delete [] Matrix;
-  delete [] Art_Visc;
-  delete [] absPeJac;
-  delete [] invRinvPe;
-  delete [] R_Tensor;
-  delete [] Jacobian_i;
-  delete [] Jacobian_j;
-
+  /*--- The scratch arrays live in ScratchMemory, which frees them. ---*/
 }
 
 CNumerics::ResidualType<> CUpwTurkel_Flow::ComputeResidual(const CConfig* config) {
@@ -686,53 +630,25 @@ CUpwGeneralRoe_Flow::CUpwGeneralRoe_Flow(unsigned short val_nDim, unsigned short
   kappa = config->GetRoe_Kappa(); // 1 is unstable
 
 
-  Flux = new su2double [nVar];
-  Diff_U = new su2double [nVar];
-  Velocity_i = new su2double [nDim];
-  Velocity_j = new su2double [nDim];
-  RoeVelocity = new su2double [nDim];
-  delta_vel  = new su2double [nDim];
-  delta_wave = new su2double [nVar];
-  ProjFlux_i = new su2double [nVar];
-  ProjFlux_j = new su2double [nVar];
-  Lambda = new su2double [nVar];
-  Epsilon = new su2double [nVar];
-  P_Tensor = new su2double* [nVar];
-  invP_Tensor = new su2double* [nVar];
-  Jacobian_i = new su2double* [nVar];
-  Jacobian_j = new su2double* [nVar];
-  for (iVar = 0; iVar < nVar; iVar++) {
-    P_Tensor[iVar] = new su2double [nVar];
-    invP_Tensor[iVar] = new su2double [nVar];
-    Jacobian_i[iVar] = new su2double [nVar];
-    Jacobian_j[iVar] = new su2double [nVar];
-  }
+  Flux = ScratchMemory.Allocate<su2double>(nVar);
+  Diff_U = ScratchMemory.Allocate<su2double>(nVar);
+  Velocity_i = ScratchMemory.Allocate<su2double>(nDim);
+  Velocity_j = ScratchMemory.Allocate<su2double>(nDim);
+  RoeVelocity = ScratchMemory.Allocate<su2double>(nDim);
+  delta_vel = ScratchMemory.Allocate<su2double>(nDim);
+  delta_wave = ScratchMemory.Allocate<su2double>(nVar);
+  ProjFlux_i = ScratchMemory.Allocate<su2double>(nVar);
+  ProjFlux_j = ScratchMemory.Allocate<su2double>(nVar);
+  Lambda = ScratchMemory.Allocate<su2double>(nVar);
+  Epsilon = ScratchMemory.Allocate<su2double>(nVar);
+  P_Tensor = ScratchMemory.Allocate2D<su2double>(nVar, nVar);
+  invP_Tensor = ScratchMemory.Allocate2D<su2double>(nVar, nVar);
+  Jacobian_i = ScratchMemory.Allocate2D<su2double>(nVar, nVar);
+  Jacobian_j = ScratchMemory.Allocate2D<su2double>(nVar, nVar);
 }
 
 CUpwGeneralRoe_Flow::~CUpwGeneralRoe_Flow(void) {
-
-  delete [] Flux;
-  delete [] Diff_U;
-  delete [] Velocity_i;
-  delete [] Velocity_j;
-  delete [] RoeVelocity;
-  delete [] delta_vel;
-  delete [] delta_wave;
-  delete [] ProjFlux_i;
-  delete [] ProjFlux_j;
-  delete [] Lambda;
-  delete [] Epsilon;
-  for (iVar = 0; iVar < nVar; iVar++) {
-    delete [] P_Tensor[iVar];
-    delete [] invP_Tensor[iVar];
-    delete [] Jacobian_i[iVar];
-    delete [] Jacobian_j[iVar];
-  }
-  delete [] P_Tensor;
-  delete [] invP_Tensor;
-  delete [] Jacobian_i;
-  delete [] Jacobian_j;
-
+  /*--- The scratch arrays live in ScratchMemory, which frees them. ---*/
 }
 
 CNumerics::ResidualType<> CUpwGeneralRoe_Flow::ComputeResidual(const CConfig* config) {
@@ -38,66 +38,30 @@ CAvgGrad_Base::CAvgGrad_Base(unsigned short val_nDim,
       nPrimVar(val_nPrimVar),
       correct_gradient(val_correct_grad) {
 
-  unsigned short iVar, iDim;
-
   implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
 
   TauWall_i = 0; TauWall_j = 0;
 
-  Mean_PrimVar = new su2double [nPrimVar];
+  /*--- All the scratch arrays of the scheme come from the instance arena,
+   so that they are packed contiguously in memory. ---*/
 
-  Mean_GradPrimVar = new su2double* [nPrimVar];
-  for (iVar = 0; iVar < nPrimVar; iVar++)
-    Mean_GradPrimVar[iVar] = new su2double [nDim];
+  Mean_PrimVar = ScratchMemory.Allocate<su2double>(nPrimVar);
 
-  Proj_Mean_GradPrimVar_Edge = new su2double[val_nPrimVar];
+  Mean_GradPrimVar = ScratchMemory.Allocate2D<su2double>(nPrimVar, nDim);
 
-  tau_jacobian_i = new su2double* [nDim];
-  for (iDim = 0; iDim < nDim; iDim++) {
-    tau_jacobian_i[iDim] = new su2double [nVar];
-  }
+  Proj_Mean_GradPrimVar_Edge = ScratchMemory.Allocate<su2double>(val_nPrimVar);
 
-  heat_flux_jac_i = new su2double[nVar];
+  tau_jacobian_i = ScratchMemory.Allocate2D<su2double>(nDim, nVar);
 
-  Jacobian_i = new su2double* [nVar];
-  Jacobian_j = new su2double* [nVar];
-  for (iVar = 0; iVar < nVar; iVar++) {
-    Jacobian_i[iVar] = new su2double [nVar];
-    Jacobian_j[iVar] = new su2double [nVar];
-  }
+  heat_flux_jac_i = ScratchMemory.Allocate<su2double>(nVar);
+
+  Jacobian_i = ScratchMemory.Allocate2D<su2double>(nVar, nVar);
+  Jacobian_j = ScratchMemory.Allocate2D<su2double>(nVar, nVar);
 
 }
 
 CAvgGrad_Base::~CAvgGrad_Base() {
-
-  delete [] Mean_PrimVar;
-
-  if (Mean_GradPrimVar != nullptr) {
-    for (unsigned short iVar = 0; iVar < nPrimVar; iVar++)
-      delete [] Mean_GradPrimVar[iVar];
-    delete [] Mean_GradPrimVar;
-  }
-
-  delete [] Proj_Mean_GradPrimVar_Edge;
-
-  if (tau_jacobian_i != nullptr) {
-    for (unsigned short iDim = 0; iDim < nDim; iDim++) {
-      delete [] tau_jacobian_i[iDim];
-    }
-    delete [] tau_jacobian_i;
-  }
-
-  delete [] heat_flux_jac_i;
-
-  if (Jacobian_i != nullptr) {
-    for (unsigned short iVar = 0; iVar < nVar; iVar++) {
-      delete [] Jacobian_i[iVar];
-      delete [] Jacobian_j[iVar];
-    }
-    delete [] Jacobian_i;
-    delete [] Jacobian_j;
-  }
-
+  /*--- The scratch arrays live in ScratchMemory, which frees them. ---*/
 }
 
 void CAvgGrad_Base::CorrectGradient(su2double** GradPrimVar,
@@ -0,0 +1,184 @@
+/*!
+ * \file CAcousticOutput.cpp
+ * \brief Acoustic surface sampling (time histories on FWH-type surfaces).
+ * \version 7.3.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2022, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../include/output/CAcousticOutput.hpp"
+
+#include <cstdio>
+#include <utility>
+
+#include "../../../Common/include/CConfig.hpp"
+#include "../../../Common/include/geometry/CGeometry.hpp"
+#include "../../include/solvers/CSolver.hpp"
+
+CAcousticOutput::CAcousticOutput(CGeometry* geometry, const CConfig* config) {
+
+  rank = SU2_MPI::GetRank();
+  nDim = geometry->GetnDim();
+  nVar = nDim + 2;
+  bufferSteps = max(config->GetAcoustic_Buffer_Steps(), 1ul);
+  restart = config->GetRestart();
+
+  /*--- Each rank streams its own file, the rank is encoded in the name so the
+   flush thread never needs to communicate. ---*/
+
+  fileName = config->GetAcoustic_FileName();
+  const auto dot = fileName.find_last_of('.');
+  const string suffix = "_rank" + to_string(rank);
+  if (dot != string::npos) fileName.insert(dot, suffix);
+  else fileName += suffix;
+
+  /*--- Resolve the acoustic markers to the vertices owned by this rank and
+   cache the static surface metadata (coordinates and area-scaled normals). ---*/
+
+  for (unsigned short iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
+
+    if (config->GetMarker_All_KindBC(iMarker) == SEND_RECEIVE) continue;
+
+    bool sampled = false;
+    for (unsigned short jMarker = 0; jMarker < config->GetnAcoustic_Markers(); jMarker++)
+      sampled = sampled || (config->GetMarker_All_TagBound(iMarker) == config->GetAcoustic_Markers()[jMarker]);
+    if (!sampled) continue;
+
+    for (unsigned long iVertex = 0; iVertex < geometry->GetnVertex(iMarker); iVertex++) {
+      const auto iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+      if (!geometry->nodes->GetDomain(iPoint)) continue;
+
+      points.push_back(iPoint);
+      for (unsigned short iDim = 0; iDim < nDim; iDim++)
+        metadata.push_back(SU2_TYPE::GetValue(geometry->nodes->GetCoord(iPoint, iDim)));
+      const auto* normal = geometry->vertex[iMarker][iVertex]->GetNormal();
+      for (unsigned short iDim = 0; iDim < nDim; iDim++)
+        metadata.push_back(SU2_TYPE::GetValue(normal[iDim]));
+    }
+  }
+
+  nPoints = points.size();
+  recordSize = 2 + nPoints*nVar;
+  ringBuffer.resize(bufferSteps*recordSize);
+
+  unsigned long nGlobalPoints = 0;
+  SU2_MPI::Allreduce(&nPoints, &nGlobalPoints, 1, MPI_UNSIGNED_LONG, MPI_SUM, SU2_MPI::GetComm());
+
+  if (rank == MASTER_NODE) {
+    cout << "Sampling " << nGlobalPoints << " acoustic surface points every time step ("
+         << config->GetAcoustic_FileName() << ", " << bufferSteps << " steps buffered per rank)." << endl;
+    if (nGlobalPoints == 0)
+      cout << " Warning: no vertices found on the markers listed in ACOUSTIC_MARKERS." << endl;
+  }
+}
+
+CAcousticOutput::~CAcousticOutput() {
+
+  if (flushThread.joinable()) flushThread.join();
+
+  /*--- Write any partial buffer synchronously, errors are ignored at this
+   point since throwing from a destructor would terminate the run anyway. ---*/
+
+  if ((stepsInBuffer > 0) && !flushFailed) {
+    if (!fileReady) PrepareFile();
+    FILE* file = fopen(fileName.c_str(), "ab");
+    if (file != nullptr) {
+      fwrite(ringBuffer.data(), sizeof(passivedouble), stepsInBuffer*recordSize, file);
+      fclose(file);
+    }
+  }
+}
+
+void CAcousticOutput::PrepareFile() {
+
+  /*--- On a restart append to the existing history, otherwise create the file. ---*/
+
+  if (restart) {
+    FILE* file = fopen(fileName.c_str(), "rb");
+    if (file != nullptr) {
+      fclose(file);
+      fileReady = true;
+      return;
+    }
+  }
+
+  FILE* file = fopen(fileName.c_str(), "wb");
+  if (file == nullptr)
+    SU2_MPI::Error(string("Unable to open acoustic output file ") + fileName, CURRENT_FUNCTION);
+
+  const unsigned long header[4] = {535538, nPoints, nVar, nDim};
+  fwrite(header, sizeof(unsigned long), 4, file);
+  fwrite(metadata.data(), sizeof(passivedouble), metadata.size(), file);
+
+  fclose(file);
+  fileReady = true;
+}
+
+void CAcousticOutput::Sample(CSolver** solver, unsigned long iter, su2double curTime) {
+
+  if (nPoints == 0) return;
+
+  auto* nodes = solver[FLOW_SOL]->GetNodes();
+
+  /*--- Pack the surface state into the next slot of the ring buffer, the
+   variables (rho, v, p) are what the FWH integration consumes. ---*/
+
+  passivedouble* slot = ringBuffer.data() + stepsInBuffer*recordSize;
+  slot[0] = SU2_TYPE::GetValue(curTime);
+  slot[1] = iter;
+  unsigned long jj = 2;
+
+  for (unsigned long i = 0; i < nPoints; i++) {
+    const auto iPoint = points[i];
+    slot[jj++] = SU2_TYPE::GetValue(nodes->GetDensity(iPoint));
+    for (unsigned short iDim = 0; iDim < nDim; iDim++)
+      slot[jj++] = SU2_TYPE::GetValue(nodes->GetVelocity(iPoint, iDim));
+    slot[jj++] = SU2_TYPE::GetValue(nodes->GetPressure(iPoint));
+  }
+
+  stepsInBuffer++;
+  if (stepsInBuffer == bufferSteps) Flush();
+}
+
+void CAcousticOutput::Flush() {
+
+  /*--- Wait for the previous flush before reusing its buffer, any I/O error
+   it hit is raised here on the main thread. ---*/
+
+  if (flushThread.joinable()) flushThread.join();
+  if (flushFailed)
+    SU2_MPI::Error(string("Unable to append to acoustic output file ") + fileName, CURRENT_FUNCTION);
+
+  if (!fileReady) PrepareFile();
+
+  const unsigned long count = stepsInBuffer*recordSize;
+  flushBuffer.assign(ringBuffer.begin(), ringBuffer.begin() + count);
+  stepsInBuffer = 0;
+
+  /*--- The thread only performs file I/O, no MPI threading support needed. ---*/
+
+  flushThread = std::thread([this, count]() {
+    FILE* file = fopen(fileName.c_str(), "ab");
+    if (file == nullptr) { flushFailed = true; return; }
+    if (fwrite(flushBuffer.data(), sizeof(passivedouble), count, file) != count) flushFailed = true;
+    fclose(file);
+  });
+}
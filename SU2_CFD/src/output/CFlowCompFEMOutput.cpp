@@ -257,7 +257,8 @@ void CFlowCompFEMOutput::LoadHistoryData(CConfig *config, CGeometry *geometry, C
 
   /*--- Set the analyse surface history values --- */
 
-  SetAnalyzeSurface(solver, geometry, config, false);
+  if (HistoryGroupNeeded("FLOW_COEFF", config) || HistoryGroupNeeded("FLOW_COEFF_SURF", config))
+    SetAnalyzeSurface(solver, geometry, config, false);
 
   /*--- Set aeroydnamic coefficients --- */
 
@@ -424,7 +424,8 @@ void CFlowCompOutput::LoadHistoryData(CConfig *config, CGeometry *geometry, CSol
 
   /*--- Set the analyse surface history values --- */
 
-  SetAnalyzeSurface(solver, geometry, config, false);
+  if (HistoryGroupNeeded("FLOW_COEFF", config) || HistoryGroupNeeded("FLOW_COEFF_SURF", config))
+    SetAnalyzeSurface(solver, geometry, config, false);
 
   /*--- Set aerodynamic coefficients --- */
 
@@ -434,19 +435,23 @@ void CFlowCompOutput::LoadHistoryData(CConfig *config, CGeometry *geometry, CSol
     SetHistoryOutputValue("BUFFET", flow_solver->GetTotal_Buffet_Metric());
   }
 
-  SetHeatCoefficients(config, flow_solver);
+  if (HistoryGroupNeeded("HEAT", config))
+    SetHeatCoefficients(config, flow_solver);
 
   /*--- Set rotating frame coefficients --- */
 
-  SetRotatingFrameCoefficients(flow_solver);
+  if (HistoryGroupNeeded("ROTATING_FRAME", config))
+    SetRotatingFrameCoefficients(flow_solver);
 
   /*--- Set Cp diff fields ---*/
 
-  Set_CpInverseDesign(flow_solver, geometry, config);
+  if (HistoryGroupNeeded("CP_DIFF", config))
+    Set_CpInverseDesign(flow_solver, geometry, config);
 
   /*--- Set nearfield diff fields ---*/
 
-  if (config->GetEquivArea()) Set_NearfieldInverseDesign(flow_solver, geometry, config);
+  if (config->GetEquivArea() && HistoryGroupNeeded("EQUIVALENT_AREA", config))
+    Set_NearfieldInverseDesign(flow_solver, geometry, config);
 
   /*--- Keep this as last, since it uses the history values that were set. ---*/
 
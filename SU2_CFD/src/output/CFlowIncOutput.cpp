@@ -266,7 +266,8 @@ void CFlowIncOutput::LoadHistoryData(CConfig *config, CGeometry *geometry, CSolv
 
   /*--- Set the analyse surface history values --- */
 
-  SetAnalyzeSurface(solver, geometry, config, false);
+  if (HistoryGroupNeeded("FLOW_COEFF", config) || HistoryGroupNeeded("FLOW_COEFF_SURF", config))
+    SetAnalyzeSurface(solver, geometry, config, false);
 
   /*--- Set aeroydnamic coefficients --- */
 
@@ -274,7 +275,8 @@ void CFlowIncOutput::LoadHistoryData(CConfig *config, CGeometry *geometry, CSolv
 
   /*--- Set rotating frame coefficients --- */
 
-  SetRotatingFrameCoefficients(flow_solver);
+  if (HistoryGroupNeeded("ROTATING_FRAME", config))
+    SetRotatingFrameCoefficients(flow_solver);
 
   /*--- Keep this as last, since it uses the history values that were set. ---*/
 
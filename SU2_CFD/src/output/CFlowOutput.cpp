@@ -1007,14 +1007,20 @@ void CFlowOutput::LoadVolumeData_Scalar(const CConfig* config, const CSolver* co
   const auto* Node_Geo = geometry->nodes;
 
   if (config->GetViscous()) {
+
+    /*--- The vorticity computed by the solver is shared by all the vortex
+     identification fields, the Q-criterion only adds the strain part. ---*/
+
+    const su2double* Vorticity = Node_Flow->GetVorticity(iPoint);
+
     if (nDim == 3){
-      SetVolumeOutputValue("VORTICITY_X", iPoint, Node_Flow->GetVorticity(iPoint)[0]);
-      SetVolumeOutputValue("VORTICITY_Y", iPoint, Node_Flow->GetVorticity(iPoint)[1]);
-      SetVolumeOutputValue("VORTICITY_Z", iPoint, Node_Flow->GetVorticity(iPoint)[2]);
+      SetVolumeOutputValue("VORTICITY_X", iPoint, Vorticity[0]);
+      SetVolumeOutputValue("VORTICITY_Y", iPoint, Vorticity[1]);
+      SetVolumeOutputValue("VORTICITY_Z", iPoint, Vorticity[2]);
     } else {
-      SetVolumeOutputValue("VORTICITY", iPoint, Node_Flow->GetVorticity(iPoint)[2]);
+      SetVolumeOutputValue("VORTICITY", iPoint, Vorticity[2]);
     }
-    SetVolumeOutputValue("Q_CRITERION", iPoint, GetQ_Criterion(Node_Flow->GetVelocityGradient(iPoint)));
+    SetVolumeOutputValue("Q_CRITERION", iPoint, GetQ_Criterion(Node_Flow->GetVelocityGradient(iPoint), Vorticity));
   }
 
   const bool limiter = (config->GetKind_SlopeLimit_Turb() != LIMITER::NONE);
@@ -1081,6 +1087,12 @@ void CFlowOutput::LoadSurfaceData(CConfig *config, CGeometry *geometry, CSolver
     SetVolumeOutputValue("SKIN_FRICTION-Z", iPoint, solver[FLOW_SOL]->GetCSkinFriction(iMarker, iVertex, 2));
   SetVolumeOutputValue("HEAT_FLUX", iPoint, solver[heat_sol]->GetHeatFlux(iMarker, iVertex));
   SetVolumeOutputValue("Y_PLUS", iPoint, solver[FLOW_SOL]->GetYPlus(iMarker, iVertex));
+
+  /*--- The fields are only registered by the solvers that call SetTimeAveragedFields. ---*/
+
+  if (config->GetTime_Domain() && (volumeOutput_Map.count("MEAN_PRESSURE_COEFF") > 0)){
+    LoadTimeAveragedSurfaceData(solver, iPoint, iMarker, iVertex);
+  }
 }
 
 void CFlowOutput::AddAerodynamicCoefficients(const CConfig* config) {
@@ -1834,6 +1846,22 @@ void CFlowOutput::WriteMetaData(const CConfig *config){
     if(config->GetKind_Streamwise_Periodic() == ENUM_STREAMWISE_PERIODIC::MASSFLOW) {
       meta_file << "STREAMWISE_PERIODIC_PRESSURE_DROP=" << GetHistoryFieldValue("STREAMWISE_DP") << endl;
     }
+
+    /*--- Save the state of the windowed-time averages so that the statistics
+     continue seamlessly when the run is restarted from this point. For
+     non-trivial windows the past samples are re-weighted every time step,
+     so the whole sample series has to be stored. ---*/
+
+    if (config->GetTime_Domain()) {
+      for (const auto& avg : windowedTimeAverages) {
+        if (avg.second.GetLastTimeIter() > curTimeIter) continue;  // Averaging has not started yet.
+        const auto& samples = avg.second.GetSamples();
+        meta_file << "WND_TAVG_" << avg.first << "= " << avg.second.GetLastTimeIter()
+                  << " " << avg.second.GetVal() << " " << samples.size();
+        for (const auto& sample : samples) meta_file << " " << sample;
+        meta_file << endl;
+      }
+    }
   }
 
   meta_file.close();
@@ -3332,6 +3360,17 @@ void CFlowOutput::SetTimeAveragedFields(){
     AddVolumeOutput("UWPRIME", "w'u'", "TIME_AVERAGE", "Mean Reynolds-stress component w'u'");
     AddVolumeOutput("VWPRIME", "w'v'", "TIME_AVERAGE", "Mean Reynolds-stress component w'v'");
   }
+
+  /*--- Running surface statistics, accumulated in-situ so that time averaged
+   *    Cp/Cf do not require writing the surface solution every time step. ---*/
+
+  AddVolumeOutput("MEAN_PRESSURE_COEFF", "MeanPressure_Coefficient", "TIME_AVERAGE", "Mean pressure coefficient");
+  AddVolumeOutput("RMS_CP", "RMS[Cp]", "TIME_AVERAGE", "RMS pressure coefficient");
+  AddVolumeOutput("CPPRIME", "Cp'Cp'", "TIME_AVERAGE", "Mean pressure coefficient fluctuation Cp'Cp'");
+  AddVolumeOutput("MEAN_SKIN_FRICTION-X", "MeanSkin_Friction_Coefficient_x", "TIME_AVERAGE", "Mean skin friction coefficient x-component");
+  AddVolumeOutput("MEAN_SKIN_FRICTION-Y", "MeanSkin_Friction_Coefficient_y", "TIME_AVERAGE", "Mean skin friction coefficient y-component");
+  if (nDim == 3)
+    AddVolumeOutput("MEAN_SKIN_FRICTION-Z", "MeanSkin_Friction_Coefficient_z", "TIME_AVERAGE", "Mean skin friction coefficient z-component");
 }
 
 void CFlowOutput::LoadTimeAveragedData(unsigned long iPoint, const CVariable *Node_Flow){
@@ -3376,6 +3415,24 @@ void CFlowOutput::LoadTimeAveragedData(unsigned long iPoint, const CVariable *No
   }
 }
 
+void CFlowOutput::LoadTimeAveragedSurfaceData(CSolver** solver, unsigned long iPoint, unsigned short iMarker,
+                                              unsigned long iVertex){
+  const su2double cp = GetVolumeOutputValue("PRESSURE_COEFF", iPoint);
+
+  SetAvgVolumeOutputValue("MEAN_PRESSURE_COEFF", iPoint, cp);
+  SetAvgVolumeOutputValue("RMS_CP", iPoint, pow(cp,2));
+
+  const su2double cpmean  = GetVolumeOutputValue("MEAN_PRESSURE_COEFF", iPoint);
+  const su2double cpcpmean = GetVolumeOutputValue("RMS_CP", iPoint);
+
+  SetVolumeOutputValue("CPPRIME", iPoint, -(cpmean*cpmean - cpcpmean));
+
+  SetAvgVolumeOutputValue("MEAN_SKIN_FRICTION-X", iPoint, solver[FLOW_SOL]->GetCSkinFriction(iMarker, iVertex, 0));
+  SetAvgVolumeOutputValue("MEAN_SKIN_FRICTION-Y", iPoint, solver[FLOW_SOL]->GetCSkinFriction(iMarker, iVertex, 1));
+  if (nDim == 3)
+    SetAvgVolumeOutputValue("MEAN_SKIN_FRICTION-Z", iPoint, solver[FLOW_SOL]->GetCSkinFriction(iMarker, iVertex, 2));
+}
+
 void CFlowOutput::SetFixedCLScreenOutput(const CConfig *config){
   PrintingToolbox::CTablePrinter FixedCLSummary(&cout);
 
@@ -438,19 +438,23 @@ void CNEMOCompOutput::LoadHistoryData(CConfig *config, CGeometry *geometry, CSol
 
   /*--- Set the analyse surface history values --- */
 
-  SetAnalyzeSurface(solver, geometry, config, false);
+  if (HistoryGroupNeeded("FLOW_COEFF", config) || HistoryGroupNeeded("FLOW_COEFF_SURF", config))
+    SetAnalyzeSurface(solver, geometry, config, false);
 
   /*--- Set aeroydnamic coefficients --- */
 
   SetAerodynamicCoefficients(config, NEMO_solver);
 
-  SetHeatCoefficients(config, NEMO_solver);
+  if (HistoryGroupNeeded("HEAT", config))
+    SetHeatCoefficients(config, NEMO_solver);
 
-  SetRotatingFrameCoefficients(NEMO_solver);
+  if (HistoryGroupNeeded("ROTATING_FRAME", config))
+    SetRotatingFrameCoefficients(NEMO_solver);
 
   /*--- Set Cp diff fields ---*/
 
-  Set_CpInverseDesign(NEMO_solver, geometry, config);
+  if (HistoryGroupNeeded("CP_DIFF", config))
+    Set_CpInverseDesign(NEMO_solver, geometry, config);
 
   /*--- Keep this as last, since it uses the history values that were set. ---*/
 
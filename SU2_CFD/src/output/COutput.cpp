@@ -25,10 +25,18 @@
  * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <ctime>
+#ifndef _WIN32
+#include <sys/resource.h>
+#endif
+
 #include "../../../Common/include/geometry/CGeometry.hpp"
+#include "../../../Common/include/toolboxes/CPhaseProfiler.hpp"
 #include "../../include/solvers/CSolver.hpp"
 
 #include "../../include/output/COutput.hpp"
+#include "../../include/output/CProbeOutput.hpp"
+#include "../../include/output/CAcousticOutput.hpp"
 #include "../../include/output/filewriter/CFVMDataSorter.hpp"
 #include "../../include/output/filewriter/CFEMDataSorter.hpp"
 #include "../../include/output/filewriter/CCGNSFileWriter.hpp"
@@ -44,7 +52,16 @@
 #include "../../include/output/filewriter/CCSVFileWriter.hpp"
 #include "../../include/output/filewriter/CSU2FileWriter.hpp"
 #include "../../include/output/filewriter/CSU2BinaryFileWriter.hpp"
+#include "../../include/output/filewriter/CSU2TimeSeriesFileWriter.hpp"
+#include "../../include/output/filewriter/CSU2SurfaceRestartFileWriter.hpp"
+#include "../../include/output/filewriter/CSU2HighOrderFileWriter.hpp"
 #include "../../include/output/filewriter/CSU2MeshFileWriter.hpp"
+#include "../../include/output/filewriter/CRegionFVMDataSorter.hpp"
+
+/*--- The writer thread makes raw MPI calls, which the AD types do not support. ---*/
+#if defined(HAVE_MPI) && !defined(CODI_REVERSE_TYPE) && !defined(CODI_FORWARD_TYPE)
+#define HAVE_ASYNC_MPI_OUTPUT
+#endif
 
 COutput::COutput(const CConfig *config, unsigned short ndim, bool fem_output):
   rank(SU2_MPI::GetRank()),
@@ -58,6 +75,13 @@ COutput::COutput(const CConfig *config, unsigned short ndim, bool fem_output):
 
   cauchyTimeConverged = false;
 
+  lazyHistoryEval = false;
+  historyEvalFreq = 1;
+
+  outputFileComm = SU2_MPI::GetComm();
+  outputFileCommDuplicated = false;
+  curTimeStamp = 0.0;
+
   convergenceTable = new PrintingToolbox::CTablePrinter(&std::cout);
   multiZoneHeaderTable = new PrintingToolbox::CTablePrinter(&std::cout);
   fileWritingTable = new PrintingToolbox::CTablePrinter(&std::cout);
@@ -166,19 +190,34 @@ COutput::COutput(const CConfig *config, unsigned short ndim, bool fem_output):
   curTimeIter  = 0;
 
   volumeDataSorter = nullptr;
+  regionDataSorter = nullptr;
   surfaceDataSorter = nullptr;
 
+  volumeConnSortedFor = -1;
+  regionConnSortedFor = -1;
+  surfaceDataSorted = false;
+  regionDataSorted = false;
+
   headerNeeded = false;
 
 }
 
 COutput::~COutput(void) {
 
+  WaitForAsyncFileWrites();
+
+#ifdef HAVE_ASYNC_MPI_OUTPUT
+  if (outputFileCommDuplicated) MPI_Comm_free(&outputFileComm);
+#endif
+
+  FlushMonitoringOutput();
+
   delete convergenceTable;
   delete multiZoneHeaderTable;
   delete fileWritingTable;
   delete historyFileTable;
   delete volumeDataSorter;
+  delete regionDataSorter;
   delete surfaceDataSorter;
 
 }
@@ -259,7 +298,40 @@ void COutput::OutputScreenAndHistory(CConfig *config) {
 
     if (WriteScreen_Output(config)) SetScreen_Output(config);
 
+    /*--- Move the buffered lines to the terminal and disk every N iterations. ---*/
+
+    if (++monitorLinesBuffered >= monitorFlushFreq) FlushMonitoringOutput();
+
+  }
+}
+
+void COutput::SetDeferredMonitoring(const CConfig *config) {
+
+  monitorFlushFreq = max<unsigned long>(1, config->GetMonitoringFlushFreq());
+
+  /*--- Re-point the convergence tables to an in-memory buffer, the formatted
+   *    lines are moved to the terminal in batches (FlushMonitoringOutput)
+   *    instead of hitting the I/O streams every iteration. ---*/
+
+  if (monitorFlushFreq > 1) {
+    delete convergenceTable;
+    convergenceTable = new PrintingToolbox::CTablePrinter(&screenBuf);
+    delete multiZoneHeaderTable;
+    multiZoneHeaderTable = new PrintingToolbox::CTablePrinter(&screenBuf);
+  }
+}
+
+void COutput::FlushMonitoringOutput() {
+
+  if (monitorFlushFreq > 1) {
+    const auto lines = screenBuf.str();
+    if (!lines.empty()) {
+      cout << lines << std::flush;
+      screenBuf.str("");
+    }
   }
+  if (histFile.is_open()) histFile.flush();
+  monitorLinesBuffered = 0;
 }
 
 void COutput::SetupCustomHistoryOutput(const std::string& expression, CustomHistoryOutput& output) const {
@@ -336,6 +408,69 @@ void COutput::AllocateDataSorters(CConfig *config, CGeometry *geometry){
 
   }
 
+  /*--- Optionally release the field data buffers between outputs, they hold all
+   requested fields for the whole mesh and can dominate the resident memory. ---*/
+
+  volumeDataSorter->SetTransientBuffers(config->GetWrt_Transient_Output_Buffers());
+  surfaceDataSorter->SetTransientBuffers(config->GetWrt_Transient_Output_Buffers());
+
+}
+
+CParallelDataSorter* COutput::GetVizVolumeSorter(CConfig *config, CGeometry *geometry, bool val_sort){
+
+  /*--- Without a region of interest (and for the FEM solver, where it is not
+   implemented) the visualization files read from the volume sorter directly. ---*/
+
+  if ((config->GetnOutputROIBox() == 0) || femOutput) {
+    SortVolumeConnectivity(config, geometry, val_sort);
+    return volumeDataSorter;
+  }
+
+  if (regionDataSorter == nullptr)
+    regionDataSorter = new CRegionFVMDataSorter(config, geometry,
+                                                dynamic_cast<CFVMDataSorter*>(volumeDataSorter));
+
+  /*--- The region subset is rebuilt from the current sorted volume data,
+   the points have to be extracted before the connectivity. All writers of
+   one snapshot share the extraction and, if they agree on the element
+   ordering, the connectivity sort. ---*/
+
+  if (!regionDataSorted) {
+    regionDataSorter->SortOutputData();
+    regionDataSorted = true;
+  }
+
+  if (regionConnSortedFor != short(val_sort)) {
+    regionDataSorter->SortConnectivity(config, geometry, val_sort);
+    regionConnSortedFor = short(val_sort);
+  }
+
+  return regionDataSorter;
+}
+
+void COutput::InvalidateSortedData() {
+
+  volumeConnSortedFor = -1;
+  regionConnSortedFor = -1;
+  surfaceDataSorted = false;
+  regionDataSorted = false;
+}
+
+void COutput::SortVolumeConnectivity(CConfig *config, CGeometry *geometry, bool val_sort) {
+
+  if (volumeConnSortedFor == short(val_sort)) return;
+
+  volumeDataSorter->SortConnectivity(config, geometry, val_sort);
+  volumeConnSortedFor = short(val_sort);
+}
+
+void COutput::SortSurfaceData(CConfig *config, CGeometry *geometry) {
+
+  if (surfaceDataSorted) return;
+
+  surfaceDataSorter->SortConnectivity(config, geometry);
+  surfaceDataSorter->SortOutputData();
+  surfaceDataSorted = true;
 }
 
 void COutput::Load_Data(CGeometry *geometry, CConfig *config, CSolver** solver_container){
@@ -347,6 +482,7 @@ void COutput::Load_Data(CGeometry *geometry, CConfig *config, CSolver** solver_c
   /*--- Loop over all points and store the requested volume output data into the data sorter objects ---*/
 
   LoadDataIntoSorter(config, geometry, solver_container);
+  InvalidateSortedData();
 
   /*--- Partition and sort the volume output data -- */
 
@@ -358,6 +494,10 @@ void COutput::WriteToFile(CConfig *config, CGeometry *geometry, OUTPUT_TYPE form
 
   CFileWriter *fileWriter = nullptr;
 
+  /*--- Sorter the volume visualization formats read from, either the plain volume
+   sorter or the region-of-interest subset, see GetVizVolumeSorter(). ---*/
+  CParallelDataSorter* vizSorter = nullptr;
+
   /*--- if it is still present, strip the extension (suffix) from the filename ---*/
   unsigned short lastindex = fileName.find_last_of(".");
   fileName = fileName.substr(0, lastindex);
@@ -371,6 +511,7 @@ void COutput::WriteToFile(CConfig *config, CGeometry *geometry, OUTPUT_TYPE form
     case OUTPUT_TYPE::SURFACE_CSV:
 
       extension = CSU2FileWriter::fileExt;
+      if (config->GetWrt_CSV_Compressed()) extension += ".gz";
 
       if (fileName.empty())
         fileName = config->GetFilename(surfaceFilename, "", curTimeIter);
@@ -378,8 +519,7 @@ void COutput::WriteToFile(CConfig *config, CGeometry *geometry, OUTPUT_TYPE form
       if (!config->GetWrt_Surface_Overwrite())
         filename_iter = config->GetFilename_Iter(fileName,curInnerIter, curOuterIter);
 
-      surfaceDataSorter->SortConnectivity(config, geometry);
-      surfaceDataSorter->SortOutputData();
+      SortSurfaceData(config, geometry);
 
       if (rank == MASTER_NODE) {
         (*fileWritingTable) << "CSV file" << fileName + extension;
@@ -388,7 +528,59 @@ void COutput::WriteToFile(CConfig *config, CGeometry *geometry, OUTPUT_TYPE form
           (*fileWritingTable) << "CSV file + iter" << filename_iter + extension;
       }
 
-      fileWriter = new CSU2FileWriter(surfaceDataSorter);
+      fileWriter = new CSU2FileWriter(surfaceDataSorter, config->GetWrt_CSV_Compressed());
+
+      break;
+
+    case OUTPUT_TYPE::SURFACE_TIMESERIES:
+
+      extension = CSU2TimeSeriesFileWriter::fileExt;
+
+      /*--- The file grows over the entire run, so the name carries no
+       iteration suffix, only the zone/instance decoration. ---*/
+
+      if (fileName.empty()){
+        fileName = surfaceFilename;
+        if (config->GetMultizone_Problem())
+          fileName = config->GetMultizone_FileName(fileName, config->GetiZone(), "");
+        if (config->GetnTimeInstances() > 1)
+          fileName = config->GetMultiInstance_FileName(fileName, config->GetiInst(), "");
+      }
+
+      SortSurfaceData(config, geometry);
+
+      if (rank == MASTER_NODE) {
+        (*fileWritingTable) << "Time series" << fileName + extension;
+      }
+
+      fileWriter = new CSU2TimeSeriesFileWriter(surfaceDataSorter, curTimeIter,
+                      config->GetTime_Domain() ? SU2_TYPE::GetValue(GetHistoryFieldValue("CUR_TIME")) : 0.0);
+
+      break;
+
+    case OUTPUT_TYPE::RESTART_SURFACE:
+
+      extension = CSU2SurfaceRestartFileWriter::fileExt;
+
+      /*--- The file carries the restart name, so that READ_SURFACE_RESTART
+       finds it next to (or instead of) the full volume restart. ---*/
+
+      if (fileName.empty())
+        fileName = config->GetFilename(restartFilename, "", curTimeIter);
+
+      if (!config->GetWrt_Restart_Overwrite())
+        filename_iter = config->GetFilename_Iter(fileName,curInnerIter, curOuterIter);
+
+      SortSurfaceData(config, geometry);
+
+      if (rank == MASTER_NODE) {
+        (*fileWritingTable) << "SU2 surface restart" << fileName + extension;
+
+        if (!config->GetWrt_Restart_Overwrite())
+          (*fileWritingTable) << "SU2 surface restart + iter" << filename_iter + extension;
+      }
+
+      fileWriter = new CSU2SurfaceRestartFileWriter(surfaceDataSorter);
 
       break;
 
@@ -433,11 +625,39 @@ void COutput::WriteToFile(CConfig *config, CGeometry *geometry, OUTPUT_TYPE form
 
       }
 
-      fileWriter = new CSU2BinaryFileWriter(volumeDataSorter);
+      fileWriter = new CSU2BinaryFileWriter(volumeDataSorter, config->GetWrt_Snapshot_SinglePrec(),
+                                            config->GetWrt_Snapshot_Delta(),
+                                            config->GetSnapshot_Keyframe_Freq(),
+                                            config->GetDual_Snapshot_Restart() &&
+                                            (config->GetTime_Marching() == TIME_MARCHING::DT_STEPPING_2ND));
 
 
       break;
 
+    case OUTPUT_TYPE::RESTART_HIGHORDER:
+
+      extension = CSU2HighOrderFileWriter::fileExt;
+
+      /*--- The file carries the restart name, so that READ_HIGHORDER_RESTART
+       finds it next to (or instead of) the standard volume restart. ---*/
+
+      if (fileName.empty())
+        fileName = config->GetFilename(restartFilename, "", curTimeIter);
+
+      if (!config->GetWrt_Restart_Overwrite())
+        filename_iter = config->GetFilename_Iter(fileName,curInnerIter, curOuterIter);
+
+      if (rank == MASTER_NODE) {
+        (*fileWritingTable) << "SU2 high-order restart" << fileName + extension;
+
+        if (!config->GetWrt_Restart_Overwrite())
+          (*fileWritingTable) << "SU2 high-order restart + iter" << filename_iter + extension;
+      }
+
+      fileWriter = new CSU2HighOrderFileWriter(volumeDataSorter);
+
+      break;
+
     case OUTPUT_TYPE::MESH:
 
       extension = CSU2MeshFileWriter::fileExt;
@@ -450,7 +670,7 @@ void COutput::WriteToFile(CConfig *config, CGeometry *geometry, OUTPUT_TYPE form
 
       /*--- Load and sort the output data and connectivity. ---*/
 
-      volumeDataSorter->SortConnectivity(config, geometry, true);
+      SortVolumeConnectivity(config, geometry, true);
 
       /*--- Set the mesh ASCII format ---*/
       if (rank == MASTER_NODE) {
@@ -478,7 +698,7 @@ void COutput::WriteToFile(CConfig *config, CGeometry *geometry, OUTPUT_TYPE form
 
       /*--- Load and sort the output data and connectivity. ---*/
 
-      volumeDataSorter->SortConnectivity(config, geometry, false);
+      vizSorter = GetVizVolumeSorter(config, geometry, false);
 
       /*--- Write tecplot binary ---*/
       if (rank == MASTER_NODE) {
@@ -488,8 +708,9 @@ void COutput::WriteToFile(CConfig *config, CGeometry *geometry, OUTPUT_TYPE form
           (*fileWritingTable) << "Tecplot binary + iter" << filename_iter + extension;
       }
 
-      fileWriter = new CTecplotBinaryFileWriter(volumeDataSorter,
-                                                curTimeIter, GetHistoryFieldValue("TIME_STEP"));
+      fileWriter = new CTecplotBinaryFileWriter(vizSorter,
+                                                curTimeIter, GetHistoryFieldValue("TIME_STEP"),
+                                                config->GetWrt_Tecplot_Shared_Grid());
 
       break;
 
@@ -505,7 +726,7 @@ void COutput::WriteToFile(CConfig *config, CGeometry *geometry, OUTPUT_TYPE form
 
       /*--- Load and sort the output data and connectivity. ---*/
 
-      volumeDataSorter->SortConnectivity(config, geometry, true);
+      vizSorter = GetVizVolumeSorter(config, geometry, true);
 
       /*--- Write tecplot ascii ---*/
       if (rank == MASTER_NODE) {
@@ -515,7 +736,7 @@ void COutput::WriteToFile(CConfig *config, CGeometry *geometry, OUTPUT_TYPE form
           (*fileWritingTable) << "Tecplot ASCII + iter" << filename_iter + extension;
       }
 
-      fileWriter = new CTecplotFileWriter(volumeDataSorter,
+      fileWriter = new CTecplotFileWriter(vizSorter,
                                           curTimeIter, GetHistoryFieldValue("TIME_STEP"));
 
       break;
@@ -532,7 +753,7 @@ void COutput::WriteToFile(CConfig *config, CGeometry *geometry, OUTPUT_TYPE form
 
       /*--- Load and sort the output data and connectivity. ---*/
 
-      volumeDataSorter->SortConnectivity(config, geometry, true);
+      vizSorter = GetVizVolumeSorter(config, geometry, true);
 
       /*--- Write paraview binary ---*/
       if (rank == MASTER_NODE) {
@@ -542,7 +763,7 @@ void COutput::WriteToFile(CConfig *config, CGeometry *geometry, OUTPUT_TYPE form
           (*fileWritingTable) << "Paraview + iter" << filename_iter + extension;
       }
 
-      fileWriter = new CParaviewXMLFileWriter(volumeDataSorter);
+      fileWriter = new CParaviewXMLFileWriter(vizSorter, config->GetWrt_Paraview_Compressed());
 
       break;
 
@@ -558,7 +779,7 @@ void COutput::WriteToFile(CConfig *config, CGeometry *geometry, OUTPUT_TYPE form
 
       /*--- Load and sort the output data and connectivity. ---*/
 
-      volumeDataSorter->SortConnectivity(config, geometry, true);
+      vizSorter = GetVizVolumeSorter(config, geometry, true);
 
       /*--- Write paraview binary ---*/
       if (rank == MASTER_NODE) {
@@ -568,7 +789,7 @@ void COutput::WriteToFile(CConfig *config, CGeometry *geometry, OUTPUT_TYPE form
           (*fileWritingTable) << "Paraview binary + iter" << filename_iter + extension;
       }
 
-      fileWriter = new CParaviewBinaryFileWriter(volumeDataSorter);
+      fileWriter = new CParaviewBinaryFileWriter(vizSorter);
 
       break;
 
@@ -586,7 +807,7 @@ void COutput::WriteToFile(CConfig *config, CGeometry *geometry, OUTPUT_TYPE form
 
         /*--- Sort volume connectivity ---*/
 
-        volumeDataSorter->SortConnectivity(config, geometry, true);
+        vizSorter = GetVizVolumeSorter(config, geometry, true);
 
         if (rank == MASTER_NODE) {
           (*fileWritingTable) << "Paraview Multiblock" << fileName + extension;
@@ -605,11 +826,11 @@ void COutput::WriteToFile(CConfig *config, CGeometry *geometry, OUTPUT_TYPE form
         CParaviewVTMFileWriter* vtmWriter = dynamic_cast<CParaviewVTMFileWriter*>(fileWriter);
 
         /*--- then we write the data into the folder---*/
-        vtmWriter->WriteFolderData(fileName, config, multiZoneHeaderString, volumeDataSorter,surfaceDataSorter, geometry);
+        vtmWriter->WriteFolderData(fileName, config, multiZoneHeaderString, vizSorter,surfaceDataSorter, geometry);
 
         /*--- and we write the data into the folder with the iteration number ---*/
         if (!config->GetWrt_Volume_Overwrite())
-          vtmWriter->WriteFolderData(filename_iter, config, multiZoneHeaderString, volumeDataSorter,surfaceDataSorter, geometry);
+          vtmWriter->WriteFolderData(filename_iter, config, multiZoneHeaderString, vizSorter,surfaceDataSorter, geometry);
 
       }
 
@@ -628,7 +849,7 @@ void COutput::WriteToFile(CConfig *config, CGeometry *geometry, OUTPUT_TYPE form
 
       /*--- Load and sort the output data and connectivity. ---*/
 
-      volumeDataSorter->SortConnectivity(config, geometry, true);
+      vizSorter = GetVizVolumeSorter(config, geometry, true);
 
       /*--- Write paraview ascii ---*/
       if (rank == MASTER_NODE) {
@@ -638,7 +859,7 @@ void COutput::WriteToFile(CConfig *config, CGeometry *geometry, OUTPUT_TYPE form
           (*fileWritingTable) << "Paraview ASCII + iter" << filename_iter + extension;
       }
 
-      fileWriter = new CParaviewFileWriter(volumeDataSorter);
+      fileWriter = new CParaviewFileWriter(vizSorter);
 
       break;
 
@@ -655,8 +876,7 @@ void COutput::WriteToFile(CConfig *config, CGeometry *geometry, OUTPUT_TYPE form
 
       /*--- Load and sort the output data and connectivity. ---*/
 
-      surfaceDataSorter->SortConnectivity(config, geometry);
-      surfaceDataSorter->SortOutputData();
+      SortSurfaceData(config, geometry);
 
       /*--- Write surface paraview ascii ---*/
       if (rank == MASTER_NODE) {
@@ -683,8 +903,7 @@ void COutput::WriteToFile(CConfig *config, CGeometry *geometry, OUTPUT_TYPE form
 
       /*--- Load and sort the output data and connectivity. ---*/
 
-      surfaceDataSorter->SortConnectivity(config, geometry);
-      surfaceDataSorter->SortOutputData();
+      SortSurfaceData(config, geometry);
 
       /*--- Write surface paraview binary ---*/
       if (rank == MASTER_NODE) {
@@ -711,8 +930,7 @@ void COutput::WriteToFile(CConfig *config, CGeometry *geometry, OUTPUT_TYPE form
 
       /*--- Load and sort the output data and connectivity. ---*/
 
-      surfaceDataSorter->SortConnectivity(config, geometry);
-      surfaceDataSorter->SortOutputData();
+      SortSurfaceData(config, geometry);
 
       /*--- Write paraview binary ---*/
       if (rank == MASTER_NODE) {
@@ -722,7 +940,7 @@ void COutput::WriteToFile(CConfig *config, CGeometry *geometry, OUTPUT_TYPE form
           (*fileWritingTable) << "Paraview surface + iter" << filename_iter + extension;
       }
 
-      fileWriter = new CParaviewXMLFileWriter(surfaceDataSorter);
+      fileWriter = new CParaviewXMLFileWriter(surfaceDataSorter, config->GetWrt_Paraview_Compressed());
 
       break;
 
@@ -739,8 +957,7 @@ void COutput::WriteToFile(CConfig *config, CGeometry *geometry, OUTPUT_TYPE form
 
       /*--- Load and sort the output data and connectivity. ---*/
 
-      surfaceDataSorter->SortConnectivity(config, geometry);
-      surfaceDataSorter->SortOutputData();
+      SortSurfaceData(config, geometry);
 
       /*--- Write surface tecplot ascii ---*/
       if (rank == MASTER_NODE) {
@@ -769,8 +986,7 @@ void COutput::WriteToFile(CConfig *config, CGeometry *geometry, OUTPUT_TYPE form
 
       /*--- Load and sort the output data and connectivity. ---*/
 
-      surfaceDataSorter->SortConnectivity(config, geometry);
-      surfaceDataSorter->SortOutputData();
+      SortSurfaceData(config, geometry);
 
       /*--- Write surface tecplot binary ---*/
       if (rank == MASTER_NODE) {
@@ -782,7 +998,8 @@ void COutput::WriteToFile(CConfig *config, CGeometry *geometry, OUTPUT_TYPE form
       }
 
       fileWriter = new CTecplotBinaryFileWriter(surfaceDataSorter,
-                                                curTimeIter, GetHistoryFieldValue("TIME_STEP"));
+                                                curTimeIter, GetHistoryFieldValue("TIME_STEP"),
+                                                config->GetWrt_Tecplot_Shared_Grid());
 
       break;
 
@@ -799,8 +1016,7 @@ void COutput::WriteToFile(CConfig *config, CGeometry *geometry, OUTPUT_TYPE form
 
       /*--- Load and sort the output data and connectivity. ---*/
 
-      surfaceDataSorter->SortConnectivity(config, geometry);
-      surfaceDataSorter->SortOutputData();
+      SortSurfaceData(config, geometry);
 
       /*--- Write ASCII STL ---*/
       if (rank == MASTER_NODE) {
@@ -827,7 +1043,7 @@ void COutput::WriteToFile(CConfig *config, CGeometry *geometry, OUTPUT_TYPE form
 
 
       /*--- Load and sort the output data and connectivity. ---*/
-      volumeDataSorter->SortConnectivity(config, geometry, true);
+      vizSorter = GetVizVolumeSorter(config, geometry, true);
 
       /*--- Write CGNS ---*/
       if (rank == MASTER_NODE) {
@@ -838,7 +1054,7 @@ void COutput::WriteToFile(CConfig *config, CGeometry *geometry, OUTPUT_TYPE form
 
       }
 
-      fileWriter = new CCGNSFileWriter(volumeDataSorter);
+      fileWriter = new CCGNSFileWriter(vizSorter);
 
       break;
 
@@ -854,8 +1070,7 @@ void COutput::WriteToFile(CConfig *config, CGeometry *geometry, OUTPUT_TYPE form
 
 
       /*--- Load and sort the output data and connectivity. ---*/
-      surfaceDataSorter->SortConnectivity(config, geometry);
-      surfaceDataSorter->SortOutputData();
+      SortSurfaceData(config, geometry);
 
       /*--- Write SURFACE_CGNS ---*/
       if (rank == MASTER_NODE) {
@@ -876,10 +1091,33 @@ void COutput::WriteToFile(CConfig *config, CGeometry *geometry, OUTPUT_TYPE form
 
   if (fileWriter != nullptr){
 
+    /*--- Hand the writer the communicator for the file I/O, this is a duplicate
+     of the global communicator if we are writing on the dedicated thread. ---*/
+
+    fileWriter->SetComm(outputFileComm);
+
+    /*--- Funnel the output through one writer rank per node if requested. ---*/
+
+    fileWriter->SetAggregation(config->GetWrt_Aggregate_Output());
+
+    /*--- Land the volume data redistribution, in case the writer reads from the
+     volume sorter directly and no derived sorter has completed it yet. ---*/
+
+    volumeDataSorter->CompleteSortOutputData();
+
     /*--- Write data to file ---*/
 
     fileWriter->Write_Data(fileName);
 
+    /*--- For unsteady paraview output, maintain a time series (.pvd) collection
+     referencing the snapshots, so they can be animated directly. ---*/
+
+    if (config->GetTime_Domain() &&
+        (format == OUTPUT_TYPE::PARAVIEW_XML || format == OUTPUT_TYPE::SURFACE_PARAVIEW_XML)){
+      const string seriesName = (format == OUTPUT_TYPE::PARAVIEW_XML) ? volumeFilename : surfaceFilename;
+      CParaviewXMLFileWriter::WriteTimeSeries(seriesName, fileName + extension, curTimeStamp);
+    }
+
     su2double BandWidth = fileWriter->Get_Bandwidth();
 
     /*--- Write data with iteration number to file ---*/
@@ -925,42 +1163,120 @@ bool COutput::GetCauchyCorrectedTimeConvergence(const CConfig *config){
 
 bool COutput::SetResult_Files(CGeometry *geometry, CConfig *config, CSolver** solver_container,
                               unsigned long iter, bool force_writing){
+  SU2_PROFILE_PHASE(OUTPUT);
+
+  nDOFGlobal = geometry->GetGlobal_nPointDomain();
 
   bool isFileWrite=false;
   unsigned short nVolumeFiles = config->GetnVolumeOutputFiles();
   auto VolumeFiles = config->GetVolumeOutputFiles();
 
+  /*--- Sample the probe time histories (the probes are resolved to their containing
+   elements once, subsequent samples only interpolate and append to the file). ---*/
+
+  if ((config->GetnProbe_Locations() > 0) && config->GetFluidProblem()) {
+    if (!probeOutput) probeOutput.reset(new CProbeOutput(geometry, config));
+    if ((iter % config->GetProbe_Wrt_Freq()) == 0 || force_writing)
+      probeOutput->Sample(solver_container, config, iter);
+  }
+
+  /*--- Sample the acoustic surfaces every step, the samples are packed into a
+   per-rank ring buffer and flushed to disk by a background thread. ---*/
+
+  if ((config->GetnAcoustic_Markers() > 0) && config->GetFluidProblem()) {
+    if (!acousticOutput) acousticOutput.reset(new CAcousticOutput(geometry, config));
+    acousticOutput->Sample(solver_container, iter, GetHistoryFieldValue("CUR_TIME"));
+  }
+
   /*--- Check if the data sorters are allocated, if not, allocate them. --- */
   AllocateDataSorters(config, geometry);
 
+  /*--- Wait until the volume files of a previous call have been written, the writer
+   thread reads the frozen data snapshot that SortOutputData would overwrite. ---*/
+
+  WaitForAsyncFileWrites();
+
+  const bool asyncWrite = AsyncFileWritesPossible(config);
+  vector<OUTPUT_TYPE> asyncFiles;
+
+  /*--- Capture the physical time of this snapshot: the writer thread must not
+   read the history fields, which the solver keeps updating. ---*/
+
+  if (config->GetTime_Domain())
+    curTimeStamp = SU2_TYPE::GetValue(GetHistoryFieldValue("CUR_TIME"));
+
+  /*--- The physical output trigger temporarily raises the volume output frequency
+   when the monitored history field changes fast, it requests the extra snapshots
+   through the force flag so that all file types honor it. ---*/
+
+  const bool triggerWrite = EvaluateOutputTrigger(config, iter);
+
+  /*--- Determine the writer set of this snapshot up front: all files written in
+   this call read from the same solver state, so the data is collected from the
+   solvers and redistributed once and the sorted result is shared by every
+   writer (sort once, write many). ---*/
+
+  vector<bool> writeFile(nVolumeFiles, false);
+  bool writeAnyFile = false;
+
   for (unsigned short iFile = 0; iFile < nVolumeFiles; iFile++){
+    writeFile[iFile] = WriteVolume_Output(config, iter, force_writing || cauchyTimeConverged || triggerWrite, iFile);
+    writeAnyFile = writeAnyFile || writeFile[iFile];
+  }
 
-    /*--- Collect the volume data from the solvers.
-     *  If time-domain is enabled, we also load the data although we don't output it,
-     *  since we might want to do time-averaging. ---*/
-    if (WriteVolume_Output(config, iter, force_writing || cauchyTimeConverged, iFile) || config->GetTime_Domain())
-      LoadDataIntoSorter(config, geometry, solver_container);
+  /*--- Collect the volume data from the solvers.
+   *  If time-domain is enabled, we also load the data although we don't output it,
+   *  since we might want to do time-averaging. ---*/
 
-    if (!(WriteVolume_Output(config, iter, force_writing || cauchyTimeConverged, iFile))) continue;
+  if ((writeAnyFile || config->GetTime_Domain()) && (nVolumeFiles > 0)) {
 
-    /*--- Partition and sort the data --- */
+    /*--- The send buffers cannot be refilled while a redistribution of a
+     previous call is still in flight. ---*/
 
-    volumeDataSorter->SortOutputData();
+    volumeDataSorter->CompleteSortOutputData();
 
-    if (rank == MASTER_NODE && !isFileWrite){
-      fileWritingTable->SetAlign(PrintingToolbox::CTablePrinter::CENTER);
-      fileWritingTable->PrintHeader();
-      fileWritingTable->SetAlign(PrintingToolbox::CTablePrinter::LEFT);
-    }
+    LoadDataIntoSorter(config, geometry, solver_container);
+    InvalidateSortedData();
+  }
+
+  if (writeAnyFile) {
+
+    /*--- Start partitioning and sorting the data. The redistribution is completed
+     lazily by the consumers of the sorted data, so that the connectivity sorting
+     in WriteToFile overlaps with the communication. --- */
+
+    volumeDataSorter->InitiateSortOutputData();
+  }
+
+  for (unsigned short iFile = 0; iFile < nVolumeFiles; iFile++){
+
+    if (!writeFile[iFile]) continue;
+
+    if (asyncWrite) {
+
+      /*--- Defer the file writes to the dedicated writer thread. ---*/
+
+      asyncFiles.push_back(VolumeFiles[iFile]);
 
-    /*--- Loop through all requested output files and write
-     * the partitioned and sorted data stored in the data sorters. ---*/
+    } else {
+
+      if (rank == MASTER_NODE && !isFileWrite){
+        FlushMonitoringOutput();
+        fileWritingTable->SetAlign(PrintingToolbox::CTablePrinter::CENTER);
+        fileWritingTable->PrintHeader();
+        fileWritingTable->SetAlign(PrintingToolbox::CTablePrinter::LEFT);
+      }
 
-    WriteToFile(config, geometry, VolumeFiles[iFile]);
+      /*--- Loop through all requested output files and write
+       * the partitioned and sorted data stored in the data sorters. ---*/
+
+      WriteToFile(config, geometry, VolumeFiles[iFile]);
+
+      if (rank == MASTER_NODE && !isFileWrite){
+        fileWritingTable->PrintFooter();
+        headerNeeded = true;
+      }
 
-    if (rank == MASTER_NODE && !isFileWrite){
-      fileWritingTable->PrintFooter();
-      headerNeeded = true;
     }
 
     /*--- Write any additonal files defined in the child class ----*/
@@ -970,11 +1286,228 @@ bool COutput::SetResult_Files(CGeometry *geometry, CConfig *config, CSolver** so
     isFileWrite = true;
   }
 
+  /*--- Freeze a copy of the sorted data and write the files on a dedicated thread
+   while the solver advances the next time steps. ---*/
+
+  if (!asyncFiles.empty()) {
+
+    volumeDataSorter->SnapshotData();
+
+    /*--- Complete the connectivity sorting of the deferred formats here: the
+     data sorters communicate on the global communicator, which the solver
+     keeps using while the writes are in flight. Together with the completed
+     data redistribution above, this turns the sort requests of the writer
+     thread into no-ops, so that only file I/O (on its own communicator)
+     happens off the main thread. ---*/
+
+    for (const auto format : asyncFiles) {
+      if ((format == OUTPUT_TYPE::PARAVIEW_XML) ||
+          (format == OUTPUT_TYPE::PARAVIEW_LEGACY_BINARY)) {
+        GetVizVolumeSorter(config, geometry, true);
+      }
+    }
+
+#ifdef HAVE_ASYNC_MPI_OUTPUT
+    /*--- The writer thread communicates concurrently with the solver and therefore
+     needs its own communicator, one duplicate is kept for the entire run. ---*/
+
+    if (!outputFileCommDuplicated){
+      MPI_Comm_dup(SU2_MPI::GetComm(), &outputFileComm);
+      outputFileCommDuplicated = true;
+    }
+#endif
+
+    /*--- Determine the filenames on this thread, the iteration counters advance
+     while the writes are in flight. ---*/
+
+    vector<string> asyncFileNames;
+    for (const auto format : asyncFiles) {
+      if (format == OUTPUT_TYPE::RESTART_BINARY)
+        asyncFileNames.push_back(config->GetFilename(restartFilename, "", curTimeIter));
+      else
+        asyncFileNames.push_back(config->GetFilename(volumeFilename, "", curTimeIter));
+    }
+
+    headerNeeded = true;
+
+    if (rank == MASTER_NODE) FlushMonitoringOutput();
+
+    asyncWriteThread = std::thread([this, config, geometry, asyncFiles, asyncFileNames]() {
+
+      if (rank == MASTER_NODE){
+        fileWritingTable->SetAlign(PrintingToolbox::CTablePrinter::CENTER);
+        fileWritingTable->PrintHeader();
+        fileWritingTable->SetAlign(PrintingToolbox::CTablePrinter::LEFT);
+      }
+
+      for (size_t iFile = 0; iFile < asyncFiles.size(); iFile++)
+        WriteToFile(config, geometry, asyncFiles[iFile], asyncFileNames[iFile]);
+
+      if (rank == MASTER_NODE) fileWritingTable->PrintFooter();
+
+    });
+
+  }
+
+  /*--- With transient buffers the field data is released until the next output. The
+   asynchronous writes above read from the frozen snapshot, not the live buffers. ---*/
+
+  volumeDataSorter->ReleaseDataBuffers();
+  surfaceDataSorter->ReleaseDataBuffers();
+
   return isFileWrite;
 }
 
+bool COutput::AsyncFileWritesPossible(const CConfig *config) const {
+
+  if (!config->GetWrt_AsyncOutput()) return false;
+
+#if defined(CODI_REVERSE_TYPE) || defined(CODI_FORWARD_TYPE)
+
+  /*--- The AD tape is not thread-safe, always write synchronously. ---*/
+
+  const bool possible = false;
+
+#else
+  bool possible = true;
+
+  /*--- Only formats that write through the common MPI file routines can run on the
+   writer thread, the remaining writers communicate on the global communicator.
+   Writing files "per iteration" reads the iteration counters at write time,
+   which advance while the writes are in flight. ---*/
+
+  if (!config->GetWrt_Restart_Overwrite() || !config->GetWrt_Volume_Overwrite()) possible = false;
+
+  for (unsigned short iFile = 0; iFile < config->GetnVolumeOutputFiles(); iFile++){
+    switch (config->GetVolumeOutputFiles()[iFile]) {
+      case OUTPUT_TYPE::RESTART_BINARY:
+      case OUTPUT_TYPE::PARAVIEW_LEGACY_BINARY:
+      case OUTPUT_TYPE::PARAVIEW_XML:
+        break;
+      default:
+        possible = false;
+        break;
+    }
+  }
+
+#ifdef HAVE_MPI
+
+  /*--- The writer thread makes MPI calls concurrently with the solver, which is
+   only allowed with full thread support (run SU2_CFD with --thread_multiple). ---*/
+
+  int provided = 0;
+  MPI_Query_thread(&provided);
+  if (provided != MPI_THREAD_MULTIPLE) possible = false;
+
+#endif
+#endif
+
+  if (!possible && (rank == MASTER_NODE)) {
+    static bool warned = false;
+    if (!warned) {
+      cout << "WARNING: Falling back to synchronous output file writing.\n"
+           << "WRT_ASYNC_OUTPUT supports the binary restart and Paraview volume formats with\n"
+           << "overwriting enabled, and with MPI it requires MPI_THREAD_MULTIPLE support." << endl;
+      warned = true;
+    }
+  }
+
+  return possible;
+}
+
+void COutput::WaitForAsyncFileWrites() {
+
+  if (asyncWriteThread.joinable()) asyncWriteThread.join();
+
+  /*--- The data accessors of the sorter read the live buffer again. ---*/
+
+  if (volumeDataSorter != nullptr) volumeDataSorter->ReleaseSnapshot();
+
+}
+
+void COutput::WritePerformanceRecord(const CConfig *config) {
+
+  /*--- Per-rank quantities: the phase times of the instrumentation (zero unless
+   built with profiling support) and the memory high-water mark. ---*/
+
+  constexpr auto nPhase = size_t(ProfilingPhase::COUNT);
+  const char* phaseNames[nPhase] = {"gradients", "limiters", "flux_assembly", "jacobian_assembly",
+                                    "linear_solve", "halo_comm", "output"};
+
+  passivedouble localPhase[nPhase], maxPhase[nPhase];
+  for (size_t iPhase = 0; iPhase < nPhase; ++iPhase)
+    localPhase[iPhase] = CPhaseProfiler::GetProfiler().GetPhaseTime(ProfilingPhase(iPhase));
+
+  passivedouble memKB = 0.0;
+#ifndef _WIN32
+  rusage usage;
+  getrusage(RUSAGE_SELF, &usage);
+  memKB = usage.ru_maxrss;
+#endif
+
+  passivedouble minMem = 0.0, sumMem = 0.0, maxMem = 0.0;
+  SU2_MPI::Reduce(localPhase, maxPhase, nPhase, MPI_DOUBLE, MPI_MAX, MASTER_NODE, SU2_MPI::GetComm());
+  SU2_MPI::Reduce(&memKB, &minMem, 1, MPI_DOUBLE, MPI_MIN, MASTER_NODE, SU2_MPI::GetComm());
+  SU2_MPI::Reduce(&memKB, &sumMem, 1, MPI_DOUBLE, MPI_SUM, MASTER_NODE, SU2_MPI::GetComm());
+  SU2_MPI::Reduce(&memKB, &maxMem, 1, MPI_DOUBLE, MPI_MAX, MASTER_NODE, SU2_MPI::GetComm());
+
+  if (rank != MASTER_NODE) return;
+
+  /*--- Throughput and linear solver statistics from the history fields
+   (last values of the run, WALL_TIME is already an average per iteration). ---*/
+
+  auto fieldOrZero = [&](const string& name) {
+    return historyOutput_Map.count(name) ? SU2_TYPE::GetValue(historyOutput_Map.at(name).value) : 0.0;
+  };
+
+  const passivedouble timePerIter = fieldOrZero("WALL_TIME");
+  const passivedouble dofPerSec = (timePerIter > 0.0) ? nDOFGlobal / timePerIter : 0.0;
+
+  passivedouble totalPhase = 0.0;
+  for (size_t iPhase = 0; iPhase < nPhase; ++iPhase) totalPhase += maxPhase[iPhase];
+  const passivedouble commFraction =
+      (totalPhase > 0.0) ? maxPhase[size_t(ProfilingPhase::HALO_COMM)] / totalPhase : 0.0;
+
+  /*--- Append one self-contained JSON object per run, the config hash and the
+   version string key the record across cases and code releases. ---*/
+
+  const string fileName = config->GetPerformance_Record_FileName();
+  ofstream recordFile(fileName, ios::app);
+  if (recordFile.fail()) {
+    cout << "Warning: unable to append to performance record file " << fileName << "." << endl;
+    return;
+  }
+
+  recordFile.precision(6);
+  recordFile << "{\"version\": \"7.3.1 Blackbird\""
+             << ", \"case\": \"" << config->GetCaseName() << "\""
+             << ", \"config_hash\": \"" << hex << config->GetConfig_Hash() << dec << "\""
+             << ", \"timestamp\": " << time(nullptr)
+             << ", \"nranks\": " << size
+             << ", \"nthreads\": " << omp_get_max_threads()
+             << ", \"ndof\": " << nDOFGlobal
+             << ", \"time_iter\": " << curTimeIter
+             << ", \"inner_iter\": " << curInnerIter
+             << ", \"time_per_iter_s\": " << timePerIter
+             << ", \"dof_per_sec\": " << dofPerSec
+             << ", \"linsol_iter\": " << fieldOrZero("LINSOL_ITER")
+             << ", \"linsol_residual\": " << fieldOrZero("LINSOL_RESIDUAL")
+             << ", \"comm_fraction\": " << commFraction
+             << ", \"mem_highwater_kb\": {\"min\": " << minMem << ", \"avg\": " << sumMem/size
+             << ", \"max\": " << maxMem << "}"
+             << ", \"phase_times_s\": {";
+  for (size_t iPhase = 0; iPhase < nPhase; ++iPhase)
+    recordFile << (iPhase > 0 ? ", " : "") << "\"" << phaseNames[iPhase] << "\": " << maxPhase[iPhase];
+  recordFile << "}}\n";
+  recordFile.close();
+
+  cout << "Performance record appended to " << fileName << "." << endl;
+}
+
 void COutput::PrintConvergenceSummary(){
 
+  FlushMonitoringOutput();
+
   PrintingToolbox::CTablePrinter  ConvSummary(&cout);
 
   ConvSummary.AddColumn("Convergence Field", 28);
@@ -1241,9 +1774,7 @@ void COutput::SetHistoryFile_Output(const CConfig *config) {
     (*historyFileTable) << *valPtr;
   }
 
-  /*--- Print the string to file and remove the last two characters (a separator and a space) ---*/
-
-  histFile.flush();
+  /*--- The stream is flushed by FlushMonitoringOutput at the configured frequency. ---*/
 }
 
 void COutput::SetScreen_Header(const CConfig *config) {
@@ -1297,6 +1828,8 @@ void COutput::PreprocessHistoryOutput(CConfig *config, bool wrt){
 
   noWriting = !wrt;
 
+  SetDeferredMonitoring(config);
+
   /*--- Set the common output fields ---*/
 
   SetCommonHistoryFields();
@@ -1320,6 +1853,10 @@ void COutput::PreprocessHistoryOutput(CConfig *config, bool wrt){
 
   CheckHistoryOutput();
 
+  /*--- Determine the output groups that have to be evaluated if lazy evaluation is used ---*/
+
+  SetHistoryGroupsNeeded(config);
+
   if (rank == MASTER_NODE && !noWriting){
 
     /*--- Open history file and print the header ---*/
@@ -1344,6 +1881,8 @@ void COutput::PreprocessMultizoneHistoryOutput(COutput **output, CConfig **confi
 
   noWriting = !wrt;
 
+  SetDeferredMonitoring(driver_config);
+
   /*--- Set the common history fields for all solvers ---*/
 
   SetCommonHistoryFields();
@@ -1607,6 +2146,117 @@ void COutput::CheckHistoryOutput() {
   }
 }
 
+void COutput::SetHistoryGroupsNeeded(const CConfig *config) {
+
+  /*--- The multizone driver reads the history fields of each zone to assemble its own
+   *    output, hence lazy evaluation is restricted to single zone problems. ---*/
+
+  lazyHistoryEval = config->GetLazyHistoryOutput() && !config->GetMultizone_Problem();
+  historyEvalFreq = max<unsigned long>(1, config->GetHistory_Eval_Freq());
+
+  neededHistoryGroups.clear();
+  requestedHistoryGroups.clear();
+
+  if (!lazyHistoryEval) return;
+
+  /*--- Helper returning the group of a history field, empty string if the name is unknown. ---*/
+
+  auto GroupOfField = [&](const string& name) {
+    const auto it = historyOutput_Map.find(name);
+    if (it != historyOutput_Map.end()) return it->second.outputGroup;
+    const auto itPerSurf = historyOutputPerSurface_Map.find(name);
+    if (itPerSurf != historyOutputPerSurface_Map.end()) return itPerSurf->second.front().outputGroup;
+    return string();
+  };
+
+  /*--- Derived fields (running averages, relative residuals, sensitivities) are accumulated
+   *    in Postprocess_HistoryData from the current value of their base field, which therefore
+   *    has to stay up to date every iteration. Their groups carry the base group name with a
+   *    prefix (possibly more than one, e.g. D_TAVG_). ---*/
+
+  auto AddGroup = [&](const string& group, std::set<string>& groups) {
+    if (group.empty()) return;
+    groups.insert(group);
+    string base = group;
+    bool stripped = true;
+    while (stripped) {
+      stripped = false;
+      for (const char* prefix : {"TAVG_", "REL_", "AVG_", "D_"}) {
+        const auto len = strlen(prefix);
+        if (base.compare(0, len, prefix) == 0) {
+          base.erase(0, len);
+          stripped = true;
+        }
+      }
+    }
+    if (base != group) neededHistoryGroups.insert(base);
+  };
+
+  /*--- Convergence monitoring fields drive the stopping criterion every iteration. ---*/
+
+  for (const auto& field : convFields) AddGroup(GroupOfField(field), neededHistoryGroups);
+  for (const auto& field : wndConvFields) AddGroup(GroupOfField(field), neededHistoryGroups);
+
+  /*--- Fields referenced by the expression of a custom objective function. ---*/
+
+  if (config->GetKind_ObjFunc() == CUSTOM_OBJFUNC && !config->GetCustomObjFunc().empty()) {
+    std::vector<std::string> symbols;
+    mel::Parse<passivedouble>(config->GetCustomObjFunc(), symbols);
+    for (const auto& symbol : symbols) {
+      /*--- Per-surface symbols carry an index that is not part of the field name. ---*/
+      const auto pos = symbol.find('[');
+      const auto name = (pos == std::string::npos) ? symbol : std::string(symbol, 0, pos);
+      AddGroup(GroupOfField(name), neededHistoryGroups);
+    }
+  }
+
+  /*--- Some objective functions are evaluated from results that the output computes
+   *    (surface analysis and inverse design), those must not be skipped. ---*/
+
+  for (auto iObj = 0u; iObj < config->GetnObj(); iObj++) {
+    switch (config->GetKind_ObjFunc(iObj)) {
+      case SURFACE_TOTAL_PRESSURE: case SURFACE_STATIC_PRESSURE: case SURFACE_STATIC_TEMPERATURE:
+      case SURFACE_MASSFLOW: case SURFACE_MACH: case SURFACE_UNIFORMITY: case SURFACE_SECONDARY:
+      case SURFACE_MOM_DISTORTION: case SURFACE_SECOND_OVER_UNIFORM: case SURFACE_PRESSURE_DROP:
+      case SURFACE_SPECIES_0: case SURFACE_SPECIES_VARIANCE: case AVG_TEMPERATURE:
+        neededHistoryGroups.insert("FLOW_COEFF");
+        neededHistoryGroups.insert("FLOW_COEFF_SURF");
+        break;
+      case INVERSE_DESIGN_PRESSURE:
+        neededHistoryGroups.insert("CP_DIFF");
+        break;
+      case EQUIVALENT_AREA:
+        neededHistoryGroups.insert("EQUIVALENT_AREA");
+        break;
+      default:
+        break;
+    }
+  }
+
+  /*--- Groups that only feed the screen and the history file. Screen requests were expanded
+   *    to field names in CheckHistoryOutput, history file requests are group names. ---*/
+
+  for (const auto& field : requestedScreenFields) AddGroup(GroupOfField(field), requestedHistoryGroups);
+  for (const auto& request : requestedHistoryFields) {
+    const auto group = GroupOfField(request);
+    AddGroup(group.empty() ? request : group, requestedHistoryGroups);
+  }
+}
+
+bool COutput::HistoryGroupNeeded(const string& group, const CConfig *config) {
+
+  if (!lazyHistoryEval) return true;
+
+  if (neededHistoryGroups.count(group) > 0) return true;
+  if (requestedHistoryGroups.count(group) == 0) return false;
+
+  /*--- Requested groups are refreshed at the evaluation frequency and on iterations
+   *    where the screen or the history file are written. ---*/
+
+  if (curInnerIter % historyEvalFreq == 0) return true;
+  return WriteHistoryFile_Output(config) || WriteScreen_Output(config);
+}
+
 void COutput::PreprocessVolumeOutput(CConfig *config){
 
   /*--- Set the volume output fields using a virtual function call to the child implementation ---*/
@@ -1708,6 +2358,10 @@ void COutput::LoadDataIntoSorter(CConfig* config, CGeometry* geometry, CSolver**
   unsigned long iPoint = 0, jPoint = 0;
   unsigned long iVertex = 0;
 
+  /*--- With transient buffers the field data was released after the previous output. ---*/
+
+  volumeDataSorter->AllocateDataBuffers();
+
   /*--- Reset the offset cache and index --- */
   cachePosition = 0;
   fieldIndexCache.clear();
@@ -1892,50 +2546,145 @@ void COutput::SetAvgVolumeOutputValue(string name, unsigned long iPoint, su2doub
 
 void COutput::Postprocess_HistoryData(CConfig *config){
 
-  map<string, pair<su2double, int> > Average;
-  map<string, int> Count;
+  /*--- On the first call, resolve the links between the fields and their derived fields
+   (relative residuals, group averages, time averages, derivatives). The string keys of
+   the derived fields are built and hashed only here, the per-iteration loop below then
+   works with direct references. ---*/
 
-  for (unsigned short iField = 0; iField < historyOutput_List.size(); iField++){
-    const string &fieldIdentifier = historyOutput_List[iField];
-    const HistoryOutputField &currentField = historyOutput_Map.at(fieldIdentifier);
-    if (currentField.fieldType == HistoryFieldType::RESIDUAL){
-      if ( SetInit_Residuals(config) || (currentField.value > initialResiduals[fieldIdentifier]) ) {
-        initialResiduals[fieldIdentifier] = currentField.value;
-      }
-      SetHistoryOutputValue("REL_" + fieldIdentifier,
-                            currentField.value - initialResiduals[fieldIdentifier]);
+  if (!derivedFieldLinksReady) {
 
-      Average[currentField.outputGroup].first += currentField.value;
-      Average[currentField.outputGroup].second++;
+    /*--- On a restart, pre-populate the windowed-time averages with the state saved in the
+     metadata of the previous run. The inserts below then link to the restored averages. ---*/
 
-    }
+    if (config->GetTime_Domain() && config->GetRestart())
+      LoadWindowedTimeAverages(config);
 
-    if (currentField.fieldType == HistoryFieldType::COEFFICIENT){
-      if (config->GetTime_Domain()){
-        auto it = windowedTimeAverages.find(fieldIdentifier);
-        if (it == windowedTimeAverages.end()) {
-          it = windowedTimeAverages.insert({fieldIdentifier, CWindowedAverage(config->GetKindWindow())}).first;
+    vector<string> avgGroupNames;
+
+    for (unsigned short iField = 0; iField < historyOutput_List.size(); iField++){
+      const string &fieldIdentifier = historyOutput_List[iField];
+      HistoryOutputField &currentField = historyOutput_Map.at(fieldIdentifier);
+
+      if (currentField.fieldType == HistoryFieldType::RESIDUAL){
+        DerivedFieldLink link;
+        link.field = &currentField;
+        link.relField = &historyOutput_Map.at("REL_" + fieldIdentifier);
+        link.initResidual = &initialResiduals[fieldIdentifier];
+
+        /*--- Group averages only exist for some residual groups. ---*/
+        const auto itAvg = historyOutput_Map.find("AVG_" + currentField.outputGroup);
+        if (itAvg != historyOutput_Map.end()) {
+          auto pos = find(avgGroupNames.begin(), avgGroupNames.end(), currentField.outputGroup);
+          if (pos == avgGroupNames.end()) {
+            avgGroupNames.push_back(currentField.outputGroup);
+            avgGroupFields.push_back(&itAvg->second);
+            pos = avgGroupNames.end() - 1;
+          }
+          link.avgGroup = static_cast<short>(pos - avgGroupNames.begin());
         }
-        auto& timeAverage = it->second;
-        timeAverage.addValue(currentField.value,config->GetTimeIter(), config->GetStartWindowIteration()); //Collecting Values for Windowing
-        SetHistoryOutputValue("TAVG_" + fieldIdentifier, timeAverage.GetVal());
-        if (config->GetDirectDiff() != NO_DERIVATIVE) {
-          SetHistoryOutputValue("D_TAVG_" + fieldIdentifier, SU2_TYPE::GetDerivative(timeAverage.GetVal()));
+        derivedFieldLinks.push_back(link);
+      }
+
+      if (currentField.fieldType == HistoryFieldType::COEFFICIENT){
+        DerivedFieldLink link;
+        link.field = &currentField;
+        if (config->GetTime_Domain()){
+          link.timeAverage = &windowedTimeAverages.insert(
+              {fieldIdentifier, CWindowedAverage(config->GetKindWindow())}).first->second;
+          link.tavgField = &historyOutput_Map.at("TAVG_" + fieldIdentifier);
+          if (config->GetDirectDiff() != NO_DERIVATIVE)
+            link.dtavgField = &historyOutput_Map.at("D_TAVG_" + fieldIdentifier);
         }
+        if (config->GetDirectDiff() != NO_DERIVATIVE)
+          link.dField = &historyOutput_Map.at("D_" + fieldIdentifier);
+        derivedFieldLinks.push_back(link);
       }
-      if (config->GetDirectDiff() != NO_DERIVATIVE){
-        SetHistoryOutputValue("D_" + fieldIdentifier, SU2_TYPE::GetDerivative(currentField.value));
+    }
+    derivedFieldLinksReady = true;
+  }
+
+  vector<pair<su2double, int> > Average(avgGroupFields.size(), make_pair(0.0, 0));
+
+  const bool initResiduals = SetInit_Residuals(config);
+
+  for (auto& link : derivedFieldLinks) {
+    if (link.field->fieldType == HistoryFieldType::RESIDUAL){
+      if ( initResiduals || (link.field->value > *link.initResidual) ) {
+        *link.initResidual = link.field->value;
+      }
+      link.relField->value = link.field->value - *link.initResidual;
+
+      if (link.avgGroup >= 0) {
+        Average[link.avgGroup].first += link.field->value;
+        Average[link.avgGroup].second++;
       }
     }
+    else {
+      if (link.timeAverage){
+        link.timeAverage->addValue(link.field->value, config->GetTimeIter(),
+                                   config->GetStartWindowIteration()); //Collecting Values for Windowing
+        link.tavgField->value = link.timeAverage->GetVal();
+        if (link.dtavgField)
+          link.dtavgField->value = SU2_TYPE::GetDerivative(link.timeAverage->GetVal());
+      }
+      if (link.dField)
+        link.dField->value = SU2_TYPE::GetDerivative(link.field->value);
+    }
   }
 
-  map<string, pair<su2double, int> >::iterator it = Average.begin();
-  for (it = Average.begin(); it != Average.end(); it++){
-    const su2double& value = it->second.first;
-    const int& count = it->second.second;
-    const su2double average = value/count;
-    if (historyOutput_Map.count("AVG_" + it->first) > 0 )
-      SetHistoryOutputValue("AVG_" + it->first, average);
+  for (unsigned long iGroup = 0; iGroup < avgGroupFields.size(); ++iGroup){
+    avgGroupFields[iGroup]->value = Average[iGroup].first/Average[iGroup].second;
+  }
+}
+
+void COutput::LoadWindowedTimeAverages(CConfig *config){
+
+  /*--- The metadata of the last iteration computed before the restart holds the averaging state. ---*/
+
+  const int restartIter = SU2_TYPE::Int(config->GetRestart_Iter()) - 1;
+  const string filename = config->GetFilename("flow", ".meta", restartIter);
+
+  ifstream meta_file(filename.c_str());
+  if (meta_file.fail()) {
+    if (rank == MASTER_NODE) {
+      cout << " Warning: There is no restart metadata file (" << filename << ")." << endl;
+      cout << " The windowed-time averages will restart from scratch." << endl;
+    }
+    return;
+  }
+
+  unsigned long nRestored = 0;
+  string text_line;
+
+  while (getline(meta_file, text_line)) {
+
+    if (text_line.compare(0, 9, "WND_TAVG_") != 0) continue;
+
+    const auto position = text_line.find("=", 9);
+    if (position == string::npos) continue;
+    const string fieldIdentifier = text_line.substr(9, position - 9);
+
+    unsigned long lastIter = 0, nSamples = 0;
+    passivedouble in = 0.0;
+    stringstream state(text_line.substr(position + 1));
+    state >> lastIter >> in >> nSamples;
+    const su2double avgVal = in;
+
+    vector<su2double> samples(nSamples);
+    for (auto& sample : samples) { state >> in; sample = in; }
+    if (state.fail()) continue;
+
+    /*--- Insert the average under its field identifier (the links built in
+     Postprocess_HistoryData pick it up) and restore its state. ---*/
+
+    auto& average = windowedTimeAverages.insert(
+        {fieldIdentifier, CWindowedAverage(config->GetKindWindow())}).first->second;
+    average.RestoreState(avgVal, lastIter, move(samples));
+    nRestored++;
+  }
+
+  if ((rank == MASTER_NODE) && (nRestored > 0)) {
+    cout << "Restored " << nRestored << " windowed-time average(s) from " << filename << "." << endl;
   }
 }
 
@@ -2161,6 +2910,55 @@ bool COutput::WriteVolume_Output(CConfig *config, unsigned long Iter, bool force
   }
 }
 
+bool COutput::EvaluateOutputTrigger(CConfig *config, unsigned long iter) {
+
+  const string& fieldName = config->GetOutput_Trigger_Field();
+
+  if (fieldName == "NONE" || triggerFieldMissing) return false;
+
+  if (historyOutput_Map.count(fieldName) == 0) {
+
+    /*--- Warn once and disable the trigger, an unknown name would otherwise
+     silently suppress the raised frequency for the whole run. ---*/
+
+    if (rank == MASTER_NODE) {
+      cout << "WARNING: Output trigger field " << fieldName
+           << " is not a history output field, the output trigger is disabled." << endl;
+    }
+    triggerFieldMissing = true;
+    return false;
+  }
+
+  const su2double value = historyOutput_Map.at(fieldName).value;
+  bool fired = false;
+
+  if (triggerFieldOldValid) {
+
+    /*--- Relative change of the monitored field over one call. ---*/
+
+    const passivedouble eps = numeric_limits<passivedouble>::epsilon();
+    const su2double delta = fabs(value - triggerFieldOldValue);
+    const su2double ref = max(fabs(triggerFieldOldValue), su2double(eps));
+
+    fired = (delta > config->GetOutput_Trigger_Threshold() * ref);
+  }
+  triggerFieldOldValue = value;
+  triggerFieldOldValid = true;
+
+  if (fired) {
+
+    /*--- Capture the onset immediately and keep the raised frequency
+     for the hold interval after the last firing. ---*/
+
+    triggerEverFired = true;
+    triggerActiveUntil = iter + config->GetOutput_Trigger_Hold();
+    return true;
+  }
+
+  return triggerEverFired && (iter <= triggerActiveUntil) &&
+         (iter % config->GetOutput_Trigger_Wrt_Freq() == 0);
+}
+
 void COutput::SetCommonHistoryFields() {
 
   /// BEGIN_GROUP: ITERATION, DESCRIPTION: Iteration identifier.
@@ -2183,21 +2981,32 @@ void COutput::SetCommonHistoryFields() {
 
   AddHistoryOutput("NONPHYSICAL_POINTS", "Nonphysical_Points", ScreenOutputFormat::INTEGER, "NONPHYSICAL_POINTS", "The number of non-physical points in the solution");
 
+  /*--- Resolve the integer handles of the common fields once, they are set every iteration. ---*/
+
+  commonFieldHandles.timeIter  = GetHistoryFieldHandle("TIME_ITER");
+  commonFieldHandles.outerIter = GetHistoryFieldHandle("OUTER_ITER");
+  commonFieldHandles.innerIter = GetHistoryFieldHandle("INNER_ITER");
+  commonFieldHandles.curTime   = GetHistoryFieldHandle("CUR_TIME");
+  commonFieldHandles.timeStep  = GetHistoryFieldHandle("TIME_STEP");
+  commonFieldHandles.wallTime  = GetHistoryFieldHandle("WALL_TIME");
+  commonFieldHandles.nonphysicalPoints = GetHistoryFieldHandle("NONPHYSICAL_POINTS");
 }
 
 void COutput::LoadCommonHistoryData(const CConfig *config) {
 
-  SetHistoryOutputValue("TIME_STEP", config->GetDelta_UnstTimeND()*config->GetTime_Ref());
+  SetHistoryOutputValue(commonFieldHandles.timeStep, config->GetDelta_UnstTimeND()*config->GetTime_Ref());
 
   /*--- Update the current time only if the time iteration has changed ---*/
 
-  if (SU2_TYPE::Int(GetHistoryFieldValue("TIME_ITER")) != static_cast<int>(curTimeIter)) {
-    SetHistoryOutputValue("CUR_TIME",  GetHistoryFieldValue("CUR_TIME") + GetHistoryFieldValue("TIME_STEP"));
+  if (SU2_TYPE::Int(GetHistoryFieldValue(commonFieldHandles.timeIter)) != static_cast<int>(curTimeIter)) {
+    SetHistoryOutputValue(commonFieldHandles.curTime,
+                          GetHistoryFieldValue(commonFieldHandles.curTime) +
+                          GetHistoryFieldValue(commonFieldHandles.timeStep));
   }
 
-  SetHistoryOutputValue("TIME_ITER",  curTimeIter);
-  SetHistoryOutputValue("INNER_ITER", curInnerIter);
-  SetHistoryOutputValue("OUTER_ITER", curOuterIter);
+  SetHistoryOutputValue(commonFieldHandles.timeIter,  curTimeIter);
+  SetHistoryOutputValue(commonFieldHandles.innerIter, curInnerIter);
+  SetHistoryOutputValue(commonFieldHandles.outerIter, curOuterIter);
 
   su2double StopTime, UsedTime;
 
@@ -2205,9 +3014,9 @@ void COutput::LoadCommonHistoryData(const CConfig *config) {
 
   UsedTime = (StopTime - config->Get_StartTime())/(curInnerIter+1);
 
-  SetHistoryOutputValue("WALL_TIME", UsedTime);
+  SetHistoryOutputValue(commonFieldHandles.wallTime, UsedTime);
 
-  SetHistoryOutputValue("NONPHYSICAL_POINTS", config->GetNonphysical_Points());
+  SetHistoryOutputValue(commonFieldHandles.nonphysicalPoints, config->GetNonphysical_Points());
 }
 
 
@@ -0,0 +1,181 @@
+/*!
+ * \file CProbeOutput.cpp
+ * \brief Probe output (point time histories).
+ * \version 7.3.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2022, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../include/output/CProbeOutput.hpp"
+
+#include <limits>
+
+#include "../../../Common/include/CConfig.hpp"
+#include "../../../Common/include/adt/CADTElemClass.hpp"
+#include "../../../Common/include/geometry/CGeometry.hpp"
+#include "../../include/solvers/CSolver.hpp"
+
+CProbeOutput::CProbeOutput(CGeometry* geometry, const CConfig* config) {
+
+  rank = SU2_MPI::GetRank();
+  nDim = geometry->GetnDim();
+  fileName = config->GetProbe_FileName();
+
+  const auto nLocations = config->GetnProbe_Locations();
+  if (nLocations % nDim != 0)
+    SU2_MPI::Error("The number of values in PROBE_LOCATIONS must be a multiple of the number of dimensions.",
+                   CURRENT_FUNCTION);
+  nProbes = nLocations / nDim;
+  probes.resize(nProbes);
+
+  /*--- Build a local ADT over the volume elements of this rank. ---*/
+
+  const auto nPoint = geometry->GetnPoint();
+  const auto nElem = geometry->GetnElem();
+
+  vector<su2double> volCoor(nDim*nPoint);
+  unsigned long jj = 0;
+  for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++)
+    for (unsigned short iDim = 0; iDim < nDim; iDim++, jj++)
+      volCoor[jj] = geometry->nodes->GetCoord(iPoint, iDim);
+
+  vector<unsigned long> elemConn, elemID(nElem);
+  vector<unsigned short> VTK_TypeElem(nElem), markerID(nElem, 0);
+
+  for (unsigned long iElem = 0; iElem < nElem; iElem++) {
+    VTK_TypeElem[iElem] = geometry->elem[iElem]->GetVTK_Type();
+    elemID[iElem] = iElem;
+    for (unsigned short iNode = 0; iNode < geometry->elem[iElem]->GetnNodes(); iNode++)
+      elemConn.push_back(geometry->elem[iElem]->GetNode(iNode));
+  }
+
+  CADTElemClass VolumeADT(nDim, volCoor, elemConn, VTK_TypeElem, markerID, elemID, false);
+
+  /*--- Resolve each probe to its containing element and cache the interpolation
+   weights. Halo layers can make an element available on several ranks, the
+   lowest rank that finds a probe becomes its unique owner. ---*/
+
+  vector<int> myOwner(nProbes, std::numeric_limits<int>::max());
+  vector<int> owner(nProbes);
+
+  for (unsigned long iProbe = 0; iProbe < nProbes; iProbe++) {
+
+    su2double coor[3] = {0.0}, parCoor[3] = {0.0}, weights[8] = {0.0};
+    for (unsigned short iDim = 0; iDim < nDim; iDim++)
+      coor[iDim] = config->GetProbe_Locations()[iProbe*nDim + iDim];
+
+    unsigned short dummyMarker;
+    unsigned long containingElem;
+    int dummyRank;
+
+    if (VolumeADT.DetermineContainingElement(coor, dummyMarker, containingElem, dummyRank, parCoor, weights)) {
+      myOwner[iProbe] = rank;
+      auto& probe = probes[iProbe];
+      probe.nNodes = geometry->elem[containingElem]->GetnNodes();
+      for (unsigned short iNode = 0; iNode < probe.nNodes; iNode++) {
+        probe.nodes[iNode] = geometry->elem[containingElem]->GetNode(iNode);
+        probe.weights[iNode] = weights[iNode];
+      }
+    }
+  }
+
+  SU2_MPI::Allreduce(myOwner.data(), owner.data(), nProbes, MPI_INT, MPI_MIN, SU2_MPI::GetComm());
+
+  unsigned long nNotFound = 0;
+  for (unsigned long iProbe = 0; iProbe < nProbes; iProbe++) {
+    probes[iProbe].owned = (owner[iProbe] == rank) && (myOwner[iProbe] == rank);
+    if (owner[iProbe] == std::numeric_limits<int>::max()) nNotFound++;
+  }
+
+  if (rank == MASTER_NODE) {
+    cout << "Located " << nProbes - nNotFound << " of " << nProbes << " probes (" << fileName << ")." << endl;
+    if (nNotFound > 0)
+      cout << " Warning: " << nNotFound << " probe(s) lie outside the domain, their histories will be zero." << endl;
+  }
+}
+
+void CProbeOutput::PrepareFile(const CConfig* config) {
+
+  /*--- On a restart append to the existing history, otherwise create the file. ---*/
+
+  if (config->GetRestart()) {
+    FILE* file = fopen(fileName.c_str(), "rb");
+    if (file != nullptr) {
+      fclose(file);
+      fileReady = true;
+      return;
+    }
+  }
+
+  FILE* file = fopen(fileName.c_str(), "wb");
+  if (file == nullptr)
+    SU2_MPI::Error(string("Unable to open probe output file ") + fileName, CURRENT_FUNCTION);
+
+  const unsigned long header[4] = {535537, nProbes, nVar, nDim};
+  fwrite(header, sizeof(unsigned long), 4, file);
+
+  vector<passivedouble> coords(nProbes*nDim);
+  for (unsigned long i = 0; i < nProbes*nDim; i++)
+    coords[i] = SU2_TYPE::GetValue(config->GetProbe_Locations()[i]);
+  fwrite(coords.data(), sizeof(passivedouble), coords.size(), file);
+
+  fclose(file);
+  fileReady = true;
+}
+
+void CProbeOutput::Sample(CSolver** solver, const CConfig* config, unsigned long iter) {
+
+  auto* nodes = solver[FLOW_SOL]->GetNodes();
+  nVar = solver[FLOW_SOL]->GetnVar();
+
+  /*--- Interpolate the owned probes, the reduction assembles the full record on
+   the master rank (each probe has a unique owner, the other ranks add zeros). ---*/
+
+  vector<passivedouble> values(nProbes*nVar, 0.0);
+
+  for (unsigned long iProbe = 0; iProbe < nProbes; iProbe++) {
+    const auto& probe = probes[iProbe];
+    if (!probe.owned) continue;
+
+    for (unsigned short iVar = 0; iVar < nVar; iVar++) {
+      su2double value = 0.0;
+      for (unsigned short iNode = 0; iNode < probe.nNodes; iNode++)
+        value += probe.weights[iNode] * nodes->GetSolution(probe.nodes[iNode], iVar);
+      values[iProbe*nVar + iVar] = SU2_TYPE::GetValue(value);
+    }
+  }
+
+  vector<passivedouble> record(rank == MASTER_NODE ? nProbes*nVar : 0);
+  SU2_MPI::Reduce(values.data(), record.data(), nProbes*nVar, MPI_DOUBLE, MPI_SUM, MASTER_NODE, SU2_MPI::GetComm());
+
+  if (rank != MASTER_NODE) return;
+
+  if (!fileReady) PrepareFile(config);
+
+  FILE* file = fopen(fileName.c_str(), "ab");
+  if (file == nullptr)
+    SU2_MPI::Error(string("Unable to append to probe output file ") + fileName, CURRENT_FUNCTION);
+
+  const passivedouble iterVal = iter;
+  fwrite(&iterVal, sizeof(passivedouble), 1, file);
+  fwrite(record.data(), sizeof(passivedouble), record.size(), file);
+  fclose(file);
+}
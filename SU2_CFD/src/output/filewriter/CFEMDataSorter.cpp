@@ -59,6 +59,14 @@ CFEMDataSorter::CFEMDataSorter(CConfig *config, CGeometry *geometry, const vecto
 
       nLocalPointsBeforeSort++;
     }
+
+    /* Store the element record for the high-order (element-collocated)
+       restart format, see CSU2HighOrderFileWriter. */
+
+    highOrderElemInfo.push_back(volElem[l].VTK_Type);
+    highOrderElemInfo.push_back(volElem[l].nPolySol);
+    highOrderElemInfo.push_back(volElem[l].nDOFsSol);
+    highOrderElemInfo.push_back(volElem[l].offsetDOFsSolGlobal);
   }
 
   SU2_MPI::Allreduce(&nLocalPointsBeforeSort, &nGlobalPointBeforeSort, 1,
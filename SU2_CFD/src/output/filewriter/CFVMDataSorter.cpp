@@ -164,6 +164,14 @@ void CFVMDataSorter::SortVolumetricConnectivity(CConfig *config,
       SU2_MPI::Error("Unrecognized element type", CURRENT_FUNCTION);
   }
 
+  /*--- Contiguous range of elements of this type, so that the loops below
+   do not have to scan (and dispatch on) the entire mixed-element mesh. ---*/
+
+  const auto& elemOrder = geometry->GetElemTypeOrder();
+  const auto typePos = CGeometry::GetElemTypePosition(Elem_Type);
+  const auto elemBegin = geometry->GetElemTypeBegin(typePos);
+  const auto elemEnd = geometry->GetElemTypeEnd(typePos);
+
   /*--- We start with the connectivity distributed across all procs with
    no particular ordering assumed. We need to loop through our local partition
    and decide how many elements we must send to each other rank in order to
@@ -180,46 +188,45 @@ void CFVMDataSorter::SortVolumetricConnectivity(CConfig *config,
   }
   nElem_Send[size] = 0; nElem_Cum[size] = 0;
 
-  for (int ii = 0; ii < (int)geometry->GetnElem(); ii++ ) {
-    if (geometry->elem[ii]->GetVTK_Type() == Elem_Type) {
-      for ( int jj = 0; jj < NODES_PER_ELEMENT; jj++ ) {
-
-        /*--- Get the index of the current point. ---*/
+  for (auto iOrder = elemBegin; iOrder < elemEnd; iOrder++) {
+    const int ii = (int)elemOrder[iOrder];
+    for ( int jj = 0; jj < NODES_PER_ELEMENT; jj++ ) {
 
-        iPoint = geometry->elem[ii]->GetNode(jj);
-        Global_Index = geometry->nodes->GetGlobalIndex(iPoint);
+      /*--- Get the index of the current point. ---*/
 
-        /*--- Search for the lowest global index in this element. We
-         send the element to the processor owning the range that includes
-         the lowest global index value. ---*/
+      iPoint = geometry->elem[ii]->GetNode(jj);
+      Global_Index = geometry->nodes->GetGlobalIndex(iPoint);
 
-        for (int kk = 0; kk < NODES_PER_ELEMENT; kk++) {
-          jPoint = geometry->elem[ii]->GetNode(kk);
-          unsigned long newID = geometry->nodes->GetGlobalIndex(jPoint);
-          if (newID < Global_Index) Global_Index = newID;
-        }
+      /*--- Search for the lowest global index in this element. We
+       send the element to the processor owning the range that includes
+       the lowest global index value. ---*/
 
-        /*--- Search for the processor that owns this point. If we are
-         sorting the elements, we use the linear partitioning to find
-         the rank, otherwise, we simply have the current rank load its
-         own elements into the connectivity data structure. ---*/
+      for (int kk = 0; kk < NODES_PER_ELEMENT; kk++) {
+        jPoint = geometry->elem[ii]->GetNode(kk);
+        unsigned long newID = geometry->nodes->GetGlobalIndex(jPoint);
+        if (newID < Global_Index) Global_Index = newID;
+      }
 
-        if (val_sort) {
-          iProcessor = linearPartitioner.GetRankContainingIndex(Global_Index);
-        } else {
-          iProcessor = rank;
-        }
+      /*--- Search for the processor that owns this point. If we are
+       sorting the elements, we use the linear partitioning to find
+       the rank, otherwise, we simply have the current rank load its
+       own elements into the connectivity data structure. ---*/
 
+      if (val_sort) {
+        iProcessor = linearPartitioner.GetRankContainingIndex(Global_Index);
+      } else {
+        iProcessor = rank;
+      }
 
-        /*--- If we have not visited this element yet, increment our
-         number of elements that must be sent to a particular proc. ---*/
 
-        if ((nElem_Flag[iProcessor] != ii)) {
-          nElem_Flag[iProcessor] = ii;
-          nElem_Send[iProcessor+1]++;
-        }
+      /*--- If we have not visited this element yet, increment our
+       number of elements that must be sent to a particular proc. ---*/
 
+      if ((nElem_Flag[iProcessor] != ii)) {
+        nElem_Flag[iProcessor] = ii;
+        nElem_Send[iProcessor+1]++;
       }
+
     }
   }
 
@@ -267,65 +274,64 @@ void CFVMDataSorter::SortVolumetricConnectivity(CConfig *config,
   /*--- Loop through our elements and load the elems and their
    additional data that we will send to the other procs. ---*/
 
-  for (int ii = 0; ii < (int)geometry->GetnElem(); ii++) {
-    if (geometry->elem[ii]->GetVTK_Type() == Elem_Type) {
-      for ( int jj = 0; jj < NODES_PER_ELEMENT; jj++ ) {
+  for (auto iOrder = elemBegin; iOrder < elemEnd; iOrder++) {
+    const int ii = (int)elemOrder[iOrder];
+    for ( int jj = 0; jj < NODES_PER_ELEMENT; jj++ ) {
 
-        /*--- Get the index of the current point. ---*/
+      /*--- Get the index of the current point. ---*/
 
-        iPoint = geometry->elem[ii]->GetNode(jj);
-        Global_Index = geometry->nodes->GetGlobalIndex(iPoint);
+      iPoint = geometry->elem[ii]->GetNode(jj);
+      Global_Index = geometry->nodes->GetGlobalIndex(iPoint);
 
-        /*--- Search for the lowest global index in this element. We
-         send the element to the processor owning the range that includes
-         the lowest global index value. ---*/
+      /*--- Search for the lowest global index in this element. We
+       send the element to the processor owning the range that includes
+       the lowest global index value. ---*/
 
-        for (int kk = 0; kk < NODES_PER_ELEMENT; kk++) {
-          jPoint = geometry->elem[ii]->GetNode(kk);
-          unsigned long newID = geometry->nodes->GetGlobalIndex(jPoint);
-          if (newID < Global_Index) Global_Index = newID;
-        }
+      for (int kk = 0; kk < NODES_PER_ELEMENT; kk++) {
+        jPoint = geometry->elem[ii]->GetNode(kk);
+        unsigned long newID = geometry->nodes->GetGlobalIndex(jPoint);
+        if (newID < Global_Index) Global_Index = newID;
+      }
 
-        /*--- Search for the processor that owns this point. If we are
-         sorting the elements, we use the linear partitioning to find
-         the rank, otherwise, we simply have the current rank load its
-         own elements into the connectivity data structure. ---*/
+      /*--- Search for the processor that owns this point. If we are
+       sorting the elements, we use the linear partitioning to find
+       the rank, otherwise, we simply have the current rank load its
+       own elements into the connectivity data structure. ---*/
 
-        if (val_sort) {
-          iProcessor = linearPartitioner.GetRankContainingIndex(Global_Index);
-        } else {
-          iProcessor = rank;
-        }
+      if (val_sort) {
+        iProcessor = linearPartitioner.GetRankContainingIndex(Global_Index);
+      } else {
+        iProcessor = rank;
+      }
 
-        /*--- Load connectivity into the buffer for sending ---*/
+      /*--- Load connectivity into the buffer for sending ---*/
 
-        if (nElem_Flag[iProcessor] != ii) {
+      if (nElem_Flag[iProcessor] != ii) {
 
-          nElem_Flag[iProcessor] = ii;
-          unsigned long nn = index[iProcessor];
-          unsigned long mm = haloIndex[iProcessor];
+        nElem_Flag[iProcessor] = ii;
+        unsigned long nn = index[iProcessor];
+        unsigned long mm = haloIndex[iProcessor];
 
-          /*--- Load the connectivity values. ---*/
+        /*--- Load the connectivity values. ---*/
 
-          for (int kk = 0; kk < NODES_PER_ELEMENT; kk++) {
-            iPoint = geometry->elem[ii]->GetNode(kk);
-            connSend[nn] = geometry->nodes->GetGlobalIndex(iPoint); nn++;
+        for (int kk = 0; kk < NODES_PER_ELEMENT; kk++) {
+          iPoint = geometry->elem[ii]->GetNode(kk);
+          connSend[nn] = geometry->nodes->GetGlobalIndex(iPoint); nn++;
 
-            /*--- Check if this is a halo node. If so, flag this element
-             as a halo cell. We will use this later to sort and remove
-             any duplicates from the connectivity list. Note that just checking
-             whether the point is a halo point is not enough, since we want to keep
-             elements on one side of the send receive boundary. ---*/
+          /*--- Check if this is a halo node. If so, flag this element
+           as a halo cell. We will use this later to sort and remove
+           any duplicates from the connectivity list. Note that just checking
+           whether the point is a halo point is not enough, since we want to keep
+           elements on one side of the send receive boundary. ---*/
 
-            if (Local_Halo[iPoint]) haloSend[mm] = true;
-          }
+          if (Local_Halo[iPoint]) haloSend[mm] = true;
+        }
 
-          /*--- Increment the index by the message length ---*/
+        /*--- Increment the index by the message length ---*/
 
-          index[iProcessor]    += NODES_PER_ELEMENT;
-          haloIndex[iProcessor]++;
+        index[iProcessor]    += NODES_PER_ELEMENT;
+        haloIndex[iProcessor]++;
 
-        }
       }
     }
   }
@@ -27,6 +27,7 @@
 
 #include "../../../include/output/filewriter/CParallelDataSorter.hpp"
 #include <cassert>
+#include <cstring>
 #include <numeric>
 
 CParallelDataSorter::CParallelDataSorter(CConfig *config, const vector<string> &valFieldNames) :
@@ -47,9 +48,20 @@ CParallelDataSorter::CParallelDataSorter(CConfig *config, const vector<string> &
   Index        = nullptr;
   connSend     = nullptr;
   dataBuffer   = nullptr;
+  dataBufferSnapshot = nullptr;
+  snapshotSize = 0;
+  dataView     = nullptr;
+  deltaBaseBuffer = nullptr;
+  deltaBaseSize = 0;
+  nSnapshotsWritten = 0;
   idSend       = nullptr;
   nSends = 0;
   nRecvs = 0;
+  sortOngoing  = false;
+  dataScratch  = nullptr;
+  connSendSize = 0;
+  dataBufferSize = 0;
+  transientBuffers = false;
 
   nLocalPointsBeforeSort  = 0;
   nGlobalPointBeforeSort = 0;
@@ -87,94 +99,137 @@ CParallelDataSorter::~CParallelDataSorter(){
 
   delete [] connSend;
   delete [] dataBuffer;
+  delete [] dataScratch;
+  delete [] dataBufferSnapshot;
+  delete [] deltaBaseBuffer;
   delete [] Index;
   delete [] idSend;
 
 }
 
+void CParallelDataSorter::SnapshotData() {
+
+  /*--- Make sure an in-flight redistribution has landed before freezing the data. ---*/
+
+  CompleteSortOutputData();
+
+  /*--- The accessors only expose the points owned after sorting, copying those is enough. ---*/
+
+  const unsigned long bufSize = nPoints*GlobalField_Counter;
+
+  if (bufSize > snapshotSize){
+    delete [] dataBufferSnapshot;
+    dataBufferSnapshot = new passivedouble[bufSize];
+    snapshotSize = bufSize;
+  }
+
+  memcpy(dataBufferSnapshot, dataBuffer, bufSize*sizeof(passivedouble));
+
+  dataView = dataBufferSnapshot;
+
+}
+
+void CParallelDataSorter::AllocateDataBuffers() {
+
+  if (connSend == nullptr && connSendSize > 0) connSend = new passivedouble[connSendSize] ();
+
+  if (dataBuffer == nullptr && dataBufferSize > 0) dataBuffer = new passivedouble[dataBufferSize] ();
+
+}
+
+void CParallelDataSorter::ReleaseDataBuffers() {
+
+  if (!transientBuffers) return;
+
+  /*--- Make sure an in-flight redistribution has landed before freeing its buffers. ---*/
+
+  CompleteSortOutputData();
+
+  /*--- The field data is rebuilt from the solvers before every output, only the
+   frozen snapshot of an asynchronous write may outlive this point. ---*/
+
+  delete [] connSend;
+  connSend = nullptr;
+
+  delete [] dataBuffer;
+  dataBuffer = nullptr;
+
+  delete [] dataScratch;
+  dataScratch = nullptr;
+
+}
+
+void CParallelDataSorter::UpdateDeltaBase() {
+
+  /*--- Keep the reference at full precision, so that the rounding of
+   reduced-precision deltas does not accumulate on the writer side. ---*/
+
+  const unsigned long bufSize = nPoints*GlobalField_Counter;
+
+  if (bufSize > deltaBaseSize){
+    delete [] deltaBaseBuffer;
+    deltaBaseBuffer = new passivedouble[bufSize];
+    deltaBaseSize = bufSize;
+  }
+
+  memcpy(deltaBaseBuffer, GetData(), bufSize*sizeof(passivedouble));
+
+}
+
 void CParallelDataSorter::SortOutputData() {
 
+  InitiateSortOutputData();
+  CompleteSortOutputData();
+
+}
+
+void CParallelDataSorter::InitiateSortOutputData() {
+
+  /*--- Finish a redistribution that is still in flight before reusing the buffers. ---*/
+
+  if (sortOngoing) CompleteSortOutputData();
+
   const int VARS_PER_POINT = GlobalField_Counter;
 
-  /*--- Allocate the memory that we need for receiving the conn
-   values and then cue up the non-blocking receives. Note that
-   we do not include our own rank in the communications. We will
-   directly copy our own data later. ---*/
+  /*--- Allocate the memory that we need for receiving the global IDs. ---*/
 
-  vector<unsigned long> idRecv(nPoint_Recv[size], 0);
+  idRecv.assign(nPoint_Recv[size], 0);
 
 #ifdef HAVE_MPI
   /*--- NOTE: This function calls MPI routines directly, instead of via SU2_MPI::,
    * because it communicates passivedoubles and not AD types. This avoids some
    * creative C++ to communicate AD types and then convert to passive. ---*/
 
-  /*--- We need double the number of messages to send both the conn. and the global IDs. ---*/
-
-  auto send_req = new MPI_Request[2*nSends];
-  auto recv_req = new MPI_Request[2*nRecvs];
-
-  unsigned long iMessage = 0;
-  for (int ii=0; ii<size; ii++) {
-    if ((ii != rank) && (nPoint_Recv[ii+1] > nPoint_Recv[ii])) {
-      int ll     = VARS_PER_POINT*nPoint_Recv[ii];
-      int kk     = nPoint_Recv[ii+1] - nPoint_Recv[ii];
-      int count  = VARS_PER_POINT*kk;
-      int source = ii;
-      int tag    = ii + 1;
-      MPI_Irecv(&(dataBuffer[ll]), count, MPI_DOUBLE, source, tag,
-                SU2_MPI::GetComm(), &(recv_req[iMessage]));
-      iMessage++;
-    }
-  }
+  /*--- Redistribute the data and the global IDs with non-blocking all-to-alls,
+   so that independent work (in particular the connectivity sort) can proceed
+   while the messages are in flight. The own-rank section is handled by MPI.
+   The counts and displacements have to stay alive until completion. ---*/
 
-  /*--- Launch the non-blocking sends of the connectivity. ---*/
-
-  iMessage = 0;
-  for (int ii=0; ii<size; ii++) {
-    if ((ii != rank) && (nPoint_Send[ii+1] > nPoint_Send[ii])) {
-      int ll = VARS_PER_POINT*nPoint_Send[ii];
-      int kk = nPoint_Send[ii+1] - nPoint_Send[ii];
-      int count  = VARS_PER_POINT*kk;
-      int dest   = ii;
-      int tag    = rank + 1;
-      MPI_Isend(&(connSend[ll]), count, MPI_DOUBLE, dest, tag,
-                SU2_MPI::GetComm(), &(send_req[iMessage]));
-      iMessage++;
-    }
-  }
+  sendCount.resize(size);   sendDispl.resize(size);
+  recvCount.resize(size);   recvDispl.resize(size);
+  idSendCount.resize(size); idSendDispl.resize(size);
+  idRecvCount.resize(size); idRecvDispl.resize(size);
 
-  /*--- Repeat the process to communicate the global IDs. ---*/
-
-  iMessage = 0;
-  for (int ii=0; ii<size; ii++) {
-    if ((ii != rank) && (nPoint_Recv[ii+1] > nPoint_Recv[ii])) {
-      int ll     = nPoint_Recv[ii];
-      int kk     = nPoint_Recv[ii+1] - nPoint_Recv[ii];
-      int count  = kk;
-      int source = ii;
-      int tag    = ii + 1;
-      MPI_Irecv(&(idRecv[ll]), count, MPI_UNSIGNED_LONG, source, tag,
-                SU2_MPI::GetComm(), &(recv_req[iMessage+nRecvs]));
-      iMessage++;
-    }
+  for (int ii = 0; ii < size; ii++) {
+    idSendCount[ii] = nPoint_Send[ii+1] - nPoint_Send[ii];
+    idSendDispl[ii] = nPoint_Send[ii];
+    idRecvCount[ii] = nPoint_Recv[ii+1] - nPoint_Recv[ii];
+    idRecvDispl[ii] = nPoint_Recv[ii];
+
+    sendCount[ii] = VARS_PER_POINT*idSendCount[ii];
+    sendDispl[ii] = VARS_PER_POINT*idSendDispl[ii];
+    recvCount[ii] = VARS_PER_POINT*idRecvCount[ii];
+    recvDispl[ii] = VARS_PER_POINT*idRecvDispl[ii];
   }
 
-  /*--- Launch the non-blocking sends of the global IDs. ---*/
-
-  iMessage = 0;
-  for (int ii=0; ii<size; ii++) {
-    if ((ii != rank) && (nPoint_Send[ii+1] > nPoint_Send[ii])) {
-      int ll = nPoint_Send[ii];
-      int kk = nPoint_Send[ii+1] - nPoint_Send[ii];
-      int count  = kk;
-      int dest   = ii;
-      int tag    = rank + 1;
-      MPI_Isend(&(idSend[ll]), count, MPI_UNSIGNED_LONG, dest, tag,
-                SU2_MPI::GetComm(), &(send_req[iMessage+nSends]));
-      iMessage++;
-    }
-  }
-#endif
+  MPI_Ialltoallv(connSend, sendCount.data(), sendDispl.data(), MPI_DOUBLE,
+                 dataBuffer, recvCount.data(), recvDispl.data(), MPI_DOUBLE,
+                 SU2_MPI::GetComm(), &sortRequest[0]);
+
+  MPI_Ialltoallv(idSend, idSendCount.data(), idSendDispl.data(), MPI_UNSIGNED_LONG,
+                 idRecv.data(), idRecvCount.data(), idRecvDispl.data(), MPI_UNSIGNED_LONG,
+                 SU2_MPI::GetComm(), &sortRequest[1]);
+#else
 
   /*--- Copy my own rank's data into the recv buffer directly. ---*/
 
@@ -189,38 +244,39 @@ void CParallelDataSorter::SortOutputData() {
   kk = nPoint_Send[rank+1];
 
   for (int nn=ll; nn<kk; nn++, mm++) idRecv[mm] = idSend[nn];
+#endif
 
-  /*--- Wait for the non-blocking sends and recvs to complete. ---*/
+  sortOngoing = true;
 
-#ifdef HAVE_MPI
-  MPI_Status status;
-  int ind;
+}
+
+void CParallelDataSorter::CompleteSortOutputData() const {
 
-  int number = 2*nSends;
-  for (int ii = 0; ii < number; ii++)
-    MPI_Waitany(number, send_req, &ind, &status);
+  if (!sortOngoing) return;
+  sortOngoing = false;
+
+  const int VARS_PER_POINT = GlobalField_Counter;
 
-  number = 2*nRecvs;
-  for (int ii = 0; ii < number; ii++)
-    MPI_Waitany(number, recv_req, &ind, &status);
+  /*--- Wait for the non-blocking all-to-alls to complete. ---*/
 
-  delete [] send_req;
-  delete [] recv_req;
+#ifdef HAVE_MPI
+  MPI_Waitall(2, sortRequest, MPI_STATUSES_IGNORE);
 #endif
 
-  /*--- Reorder the data in the buffer. ---*/
+  /*--- Reorder the data into partition order in a single pass, copying whole
+   per-point rows so that reads and writes are contiguous, instead of one
+   strided sweep over the buffer per field. The scratch buffer is swapped
+   with the data buffer to avoid a copy back. ---*/
 
-  vector<passivedouble> tmpBuffer(nPoint_Recv[size]);
+  if (dataScratch == nullptr) dataScratch = new passivedouble[VARS_PER_POINT*nPoint_Recv[size]];
 
-  for (int jj = 0; jj < VARS_PER_POINT; jj++){
-    for (int ii = 0; ii < nPoint_Recv[size]; ii++){
-      tmpBuffer[idRecv[ii]] = dataBuffer[ii*VARS_PER_POINT+jj];
-    }
-    for (int ii = 0; ii < nPoint_Recv[size]; ii++){
-      dataBuffer[ii*VARS_PER_POINT+jj] = tmpBuffer[ii];
-    }
+  for (int ii = 0; ii < nPoint_Recv[size]; ii++) {
+    memcpy(&dataScratch[idRecv[ii]*VARS_PER_POINT], &dataBuffer[ii*VARS_PER_POINT],
+           VARS_PER_POINT*sizeof(passivedouble));
   }
 
+  std::swap(dataBuffer, dataScratch);
+
   /*--- Store the total number of local points my rank has for
    the current section after completing the communications. ---*/
 
@@ -281,12 +337,14 @@ void CParallelDataSorter::PrepareSendBuffers(std::vector<unsigned long>& globalI
   /*--- Allocate memory to hold the connectivity that we are
    sending. ---*/
 
-  connSend = new passivedouble[VARS_PER_POINT*nPoint_Send[size]] ();
+  connSendSize = VARS_PER_POINT*nPoint_Send[size];
+  connSend = new passivedouble[connSendSize] ();
 
   /*--- Allocate the data buffer to hold the sorted data. We have to make it large enough
    * to hold passivedoubles and su2doubles ---*/
 
-  dataBuffer = new passivedouble[VARS_PER_POINT*nPoint_Recv[size]] ();
+  dataBufferSize = VARS_PER_POINT*nPoint_Recv[size];
+  dataBuffer = new passivedouble[dataBufferSize] ();
 
   /*--- Allocate arrays for sending the global ID. ---*/
 
@@ -363,6 +421,25 @@ unsigned long CParallelDataSorter::GetElem_Connectivity(GEO_TYPE type, unsigned
   return 0;
 }
 
+const int *CParallelDataSorter::GetConnectivityBuffer(GEO_TYPE type) const {
+
+  switch (type) {
+    case LINE:          return Conn_Line_Par;
+    case TRIANGLE:      return Conn_Tria_Par;
+    case QUADRILATERAL: return Conn_Quad_Par;
+    case TETRAHEDRON:   return Conn_Tetr_Par;
+    case HEXAHEDRON:    return Conn_Hexa_Par;
+    case PRISM:         return Conn_Pris_Par;
+    case PYRAMID:       return Conn_Pyra_Par;
+    default:
+      break;
+  }
+
+  SU2_MPI::Error("GEO_TYPE not found", CURRENT_FUNCTION);
+
+  return nullptr;
+}
+
 void CParallelDataSorter::SetTotalElements(){
 
   /*--- Reduce the total number of cells we will be writing in the output files. ---*/
@@ -34,6 +34,8 @@ CFileWriter::CFileWriter(CParallelDataSorter *valDataSorter, string valFileExt):
   rank = SU2_MPI::GetRank();
   size = SU2_MPI::GetSize();
 
+  fileComm = SU2_MPI::GetComm();
+
   fileSize = 0.0;
   bandwidth = 0.0;
 
@@ -45,6 +47,8 @@ CFileWriter::CFileWriter(string valFileExt):
   rank = SU2_MPI::GetRank();
   size = SU2_MPI::GetSize();
 
+  fileComm = SU2_MPI::GetComm();
+
   fileSize = 0.0;
   bandwidth = 0.0;
 
@@ -52,6 +56,11 @@ CFileWriter::CFileWriter(string valFileExt):
 
 CFileWriter::~CFileWriter(){
 
+#ifdef HAVE_MPI
+  if (nodeComm != MPI_COMM_NULL) MPI_Comm_free(&nodeComm);
+  if (writerComm != MPI_COMM_NULL) MPI_Comm_free(&writerComm);
+#endif
+
 }
 
 bool CFileWriter::WriteMPIBinaryDataAll(const void *data, unsigned long sizeInBytes,
@@ -59,6 +68,9 @@ bool CFileWriter::WriteMPIBinaryDataAll(const void *data, unsigned long sizeInBy
 
 #ifdef HAVE_MPI
 
+  if (aggregateOutput)
+    return WriteMPIBinaryDataAggregated(data, sizeInBytes, totalSizeInBytes, offsetInBytes);
+
   startTime = SU2_MPI::Wtime();
 
   MPI_Datatype filetype;
@@ -109,6 +121,82 @@ bool CFileWriter::WriteMPIBinaryDataAll(const void *data, unsigned long sizeInBy
 
 }
 
+#ifdef HAVE_MPI
+bool CFileWriter::WriteMPIBinaryDataAggregated(const void *data, unsigned long sizeInBytes,
+                                               unsigned long totalSizeInBytes, unsigned long offsetInBytes){
+
+  startTime = SU2_MPI::Wtime();
+
+  int nodeRank, nodeSize;
+  MPI_Comm_rank(nodeComm, &nodeRank);
+  MPI_Comm_size(nodeComm, &nodeSize);
+
+  /*--- The writer of the node needs the chunk size and the file offset of
+   every rank on the node to reproduce the file layout of the collective
+   version exactly. ---*/
+
+  unsigned long myChunk[2] = {sizeInBytes, offsetInBytes};
+  vector<unsigned long> chunks(2*nodeSize, 0);
+
+  MPI_Gather(myChunk, 2, MPI_UNSIGNED_LONG, chunks.data(), 2,
+             MPI_UNSIGNED_LONG, 0, nodeComm);
+
+  int ierr = MPI_SUCCESS;
+
+  if (!isWriter) {
+
+    /*--- Funnel our chunk to the writer of the node, which is reached over
+     shared memory. Only the writers touch the filesystem. ---*/
+
+    if (sizeInBytes > 0)
+      MPI_Send(data, int(sizeInBytes), MPI_BYTE, 0, nodeRank, nodeComm);
+
+  } else {
+
+    /*--- Restore the default file view so that explicit byte offsets can be
+     used, this is collective over the writer ranks that opened the file. ---*/
+
+    MPI_File_set_view(fhw, 0, MPI_BYTE, MPI_BYTE,
+                      (char*)"native", MPI_INFO_NULL);
+
+    /*--- Write our own chunk, then receive and write the chunk of each other
+     rank of the node. Receiving one chunk at a time bounds the memory
+     overhead of the aggregation by the largest chunk on the node. ---*/
+
+    if (sizeInBytes > 0) {
+      int err = MPI_File_write_at(fhw, disp + MPI_Offset(offsetInBytes), data,
+                                  int(sizeInBytes), MPI_BYTE, MPI_STATUS_IGNORE);
+      if (err != MPI_SUCCESS) ierr = err;
+    }
+
+    vector<char> chunkData;
+
+    for (int iRank = 1; iRank < nodeSize; iRank++) {
+      const unsigned long chunkSize = chunks[2*iRank];
+      if (chunkSize == 0) continue;
+
+      chunkData.resize(chunkSize);
+      MPI_Recv(chunkData.data(), int(chunkSize), MPI_BYTE, iRank, iRank,
+               nodeComm, MPI_STATUS_IGNORE);
+
+      int err = MPI_File_write_at(fhw, disp + MPI_Offset(chunks[2*iRank+1]),
+                                  chunkData.data(), int(chunkSize),
+                                  MPI_BYTE, MPI_STATUS_IGNORE);
+      if (err != MPI_SUCCESS) ierr = err;
+    }
+  }
+
+  disp      += totalSizeInBytes;
+  fileSize  += sizeInBytes;
+
+  stopTime = SU2_MPI::Wtime();
+
+  usedTime += stopTime - startTime;
+
+  return (ierr == MPI_SUCCESS);
+}
+#endif
+
 bool CFileWriter::WriteMPIBinaryData(const void *data, unsigned long sizeInBytes, unsigned short processor){
 
 #ifdef HAVE_MPI
@@ -117,13 +205,19 @@ bool CFileWriter::WriteMPIBinaryData(const void *data, unsigned long sizeInBytes
 
   int ierr = MPI_SUCCESS;
 
-  /*--- Reset the file view. ---*/
+  /*--- With aggregation only the writer ranks have the file open. Note that
+   the writing processor (usually MASTER_NODE) is always a writer. ---*/
 
-  MPI_File_set_view(fhw, 0, MPI_BYTE, MPI_BYTE,
-                    (char*)"native", MPI_INFO_NULL);
+  if (!aggregateOutput || isWriter) {
+
+    /*--- Reset the file view. ---*/
+
+    MPI_File_set_view(fhw, 0, MPI_BYTE, MPI_BYTE,
+                      (char*)"native", MPI_INFO_NULL);
 
-  if (rank == processor)
-    ierr = MPI_File_write_at(fhw, disp, data, int(sizeInBytes), MPI_BYTE, MPI_STATUS_IGNORE);
+    if (rank == processor)
+      ierr = MPI_File_write_at(fhw, disp, data, int(sizeInBytes), MPI_BYTE, MPI_STATUS_IGNORE);
+  }
 
   disp     += sizeInBytes;
   fileSize += sizeInBytes;
@@ -161,14 +255,20 @@ bool CFileWriter::WriteMPIString(const string &str, unsigned short processor){
 
   int ierr = MPI_SUCCESS;
 
-  /*--- Reset the file view. ---*/
+  /*--- With aggregation only the writer ranks have the file open. Note that
+   the writing processor (usually MASTER_NODE) is always a writer. ---*/
 
-  MPI_File_set_view(fhw, 0, MPI_BYTE, MPI_BYTE,
-                    (char*)"native", MPI_INFO_NULL);
+  if (!aggregateOutput || isWriter) {
+
+    /*--- Reset the file view. ---*/
 
-  if (SU2_MPI::GetRank() == processor)
-    ierr = MPI_File_write_at(fhw, disp, str.c_str(), str.size(),
-                      MPI_CHAR, MPI_STATUS_IGNORE);
+    MPI_File_set_view(fhw, 0, MPI_BYTE, MPI_BYTE,
+                      (char*)"native", MPI_INFO_NULL);
+
+    if (SU2_MPI::GetRank() == processor)
+      ierr = MPI_File_write_at(fhw, disp, str.c_str(), str.size(),
+                        MPI_CHAR, MPI_STATUS_IGNORE);
+  }
 
   disp += str.size()*sizeof(char);
   fileSize += sizeof(char)*str.size();
@@ -207,19 +307,42 @@ bool CFileWriter::OpenMPIFile(string val_filename){
   int ierr;
   disp     = 0.0;
 
+  /*--- With node-level aggregation we elect one writer rank per node by
+   splitting the file communicator into its shared-memory islands. Only the
+   writers open the file and touch the filesystem, the other ranks funnel
+   their data to the writer of their node. The lowest global rank of each
+   node becomes its writer, hence rank 0 is always a writer. ---*/
+
+  SU2_MPI::Comm openComm = fileComm;
+
+  if (aggregateOutput) {
+    if (nodeComm == MPI_COMM_NULL) {
+      MPI_Comm_split_type(fileComm, MPI_COMM_TYPE_SHARED, rank, MPI_INFO_NULL, &nodeComm);
+      int nodeRank; MPI_Comm_rank(nodeComm, &nodeRank);
+      isWriter = (nodeRank == 0);
+      MPI_Comm_split(fileComm, isWriter ? 0 : MPI_UNDEFINED, rank, &writerComm);
+    }
+    if (!isWriter) {
+      fileSize = 0.0;
+      usedTime = 0;
+      return true;
+    }
+    openComm = writerComm;
+  }
+
   /*--- All ranks open the file using MPI. Here, we try to open the file with
    exclusive so that an error is generated if the file exists. We always want
    to write a fresh output file, so we delete any existing files and create
    a new one. ---*/
 
-  ierr = MPI_File_open(SU2_MPI::GetComm(), val_filename.c_str(),
+  ierr = MPI_File_open(openComm, val_filename.c_str(),
                        MPI_MODE_CREATE|MPI_MODE_EXCL|MPI_MODE_WRONLY,
                        MPI_INFO_NULL, &fhw);
   if (ierr != MPI_SUCCESS)  {
     MPI_File_close(&fhw);
     if (rank == 0)
       MPI_File_delete(val_filename.c_str(), MPI_INFO_NULL);
-    ierr = MPI_File_open(SU2_MPI::GetComm(), val_filename.c_str(),
+    ierr = MPI_File_open(openComm, val_filename.c_str(),
                          MPI_MODE_CREATE|MPI_MODE_EXCL|MPI_MODE_WRONLY,
                          MPI_INFO_NULL, &fhw);
   }
@@ -246,12 +369,80 @@ bool CFileWriter::OpenMPIFile(string val_filename){
   return true;
 }
 
+bool CFileWriter::OpenMPIFileAppend(string val_filename, unsigned long &existingSize){
+
+  /*--- We append the pre-defined suffix (extension) to the filename (prefix) ---*/
+  val_filename.append(fileExt);
+
+  /*--- The master determines the current size of the file, all ranks position
+   their writes behind the existing content. ---*/
+
+  existingSize = 0;
+  if (rank == MASTER_NODE) {
+    const unsigned long statSize = Determine_Filesize(val_filename);
+    if (statSize != (unsigned long)-1) existingSize = statSize;
+  }
+  SU2_MPI::Bcast(&existingSize, 1, MPI_UNSIGNED_LONG, MASTER_NODE, fileComm);
+
+#ifdef HAVE_MPI
+  int ierr;
+  disp     = MPI_Offset(existingSize);
+
+  /*--- Elect the writer ranks exactly as in OpenMPIFile, see there. ---*/
+
+  SU2_MPI::Comm openComm = fileComm;
+
+  if (aggregateOutput) {
+    if (nodeComm == MPI_COMM_NULL) {
+      MPI_Comm_split_type(fileComm, MPI_COMM_TYPE_SHARED, rank, MPI_INFO_NULL, &nodeComm);
+      int nodeRank; MPI_Comm_rank(nodeComm, &nodeRank);
+      isWriter = (nodeRank == 0);
+      MPI_Comm_split(fileComm, isWriter ? 0 : MPI_UNDEFINED, rank, &writerComm);
+    }
+    if (!isWriter) {
+      fileSize = 0.0;
+      usedTime = 0;
+      return true;
+    }
+    openComm = writerComm;
+  }
+
+  /*--- Unlike OpenMPIFile we never delete an existing file, the growing
+   file formats continue writing behind its current end. ---*/
+
+  ierr = MPI_File_open(openComm, val_filename.c_str(),
+                       MPI_MODE_CREATE|MPI_MODE_WRONLY,
+                       MPI_INFO_NULL, &fhw);
+
+  /*--- Error check opening the file. ---*/
+
+  if (ierr) {
+    SU2_MPI::Error(string("Unable to open file ") +
+                   val_filename, CURRENT_FUNCTION);
+  }
+#else
+  fhw = fopen(val_filename.c_str(), "ab");
+  /*--- Error check for opening the file. ---*/
+
+  if (!fhw) {
+    SU2_MPI::Error(string("Unable to open file ") +
+                   val_filename, CURRENT_FUNCTION);
+  }
+#endif
+
+  fileSize = 0.0;
+  usedTime = 0;
+
+  return true;
+}
+
 bool CFileWriter::CloseMPIFile(){
 
 #ifdef HAVE_MPI
-  /*--- All ranks close the file after writing. ---*/
+  /*--- All ranks that opened the file close it after writing. ---*/
 
-  MPI_File_close(&fhw);
+  if (!aggregateOutput || isWriter)
+    MPI_File_close(&fhw);
 #else
   fclose(fhw);
 #endif
@@ -260,7 +451,7 @@ bool CFileWriter::CloseMPIFile(){
 
   su2double my_fileSize = fileSize;
   SU2_MPI::Allreduce(&my_fileSize, &fileSize, 1,
-                     MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
+                     MPI_DOUBLE, MPI_SUM, fileComm);
 
   /*--- Compute and store the bandwidth ---*/
 
@@ -34,6 +34,10 @@
 
 const string CParaviewVTMFileWriter::fileExt = ".vtm";
 
+map<string, string> CParaviewVTMFileWriter::pendingBlocks;
+
+set<string> CParaviewVTMFileWriter::createdFolders;
+
 CParaviewVTMFileWriter::CParaviewVTMFileWriter(su2double valTime,
                                                unsigned short valiZone, unsigned short valnZone)
   : CFileWriter(fileExt), iZone(valiZone), nZone(valnZone), curTime(valTime){
@@ -52,28 +56,27 @@ void CParaviewVTMFileWriter::Write_Data(string val_filename){
   /*--- We append the pre-defined suffix (extension) to the filename (prefix) ---*/
   val_filename.append(fileExt);
 
-  /*--- If we are in the first zone, create new file and write the file header,
-   * otherwise append to already existing file ---*/
+  /*--- Collect the blocks of each zone in memory and assemble the file in one shot
+   * once the last zone has contributed, instead of re-opening and appending to the
+   * vtm file once per zone ---*/
 
   if (rank == MASTER_NODE){
-   ofstream multiBlockFile;
-    if (iZone == 0)
-      multiBlockFile.open (val_filename.c_str());
-    else
-      multiBlockFile.open(val_filename.c_str(), ios::app);
 
-    if (iZone == 0){
+    string& pendingOutput = pendingBlocks[val_filename];
+    pendingOutput += output.str();
+
+    /*--- If we are in the last zone, write the complete file and release the buffer ---*/
+
+    if (iZone == nZone-1){
+      ofstream multiBlockFile(val_filename.c_str());
+
       multiBlockFile << "<VTKFile type=\"vtkMultiBlockDataSet\" version=\"1.0\">" << endl;
       multiBlockFile << "<vtkMultiBlockDataSet>" << endl;
-    }
-
-    /*--- Write all blocks that have been added ---*/
 
-    multiBlockFile << output.str();
+      /*--- Write all blocks that have been added for any of the zones ---*/
 
-    /*--- If we are in the last zone, write the additional data and close all blocks ---*/
+      multiBlockFile << pendingOutput;
 
-    if (iZone == nZone-1){
       multiBlockFile << "</vtkMultiBlockDataSet>" << endl;
       multiBlockFile << "<FieldData>" << endl;
       multiBlockFile << "<DataArray type='Float32' Name='TimeValue'>" << endl;
@@ -81,12 +84,28 @@ void CParaviewVTMFileWriter::Write_Data(string val_filename){
       multiBlockFile << "</DataArray>" << endl;
       multiBlockFile << "</FieldData>" << endl;
       multiBlockFile << "</VTKFile>" << endl;
+      multiBlockFile.close();
+
+      pendingBlocks.erase(val_filename);
     }
-    multiBlockFile.close();
   }
 
 }
 
+void CParaviewVTMFileWriter::CreateFolder(const string& name){
+
+  /*--- Each folder is only created on its first use, repeated snapshots into the
+   * same folder and the zones after the first skip the (metadata-heavy) mkdir ---*/
+
+  if (createdFolders.insert(name).second){
+#if defined(_WIN32) || defined(_WIN64) || defined (__WINDOWS__)
+    _mkdir(name.c_str());
+#else
+    mkdir(name.c_str(), 0777);
+#endif
+  }
+}
+
 void CParaviewVTMFileWriter::AddDataset(string foldername, string name, string file, CParallelDataSorter* dataSorter){
 
   /*--- Construct the full file name incl. folder ---*/
@@ -121,14 +140,8 @@ void CParaviewVTMFileWriter::WriteFolderData(string foldername, CConfig *config,
                                              CGeometry *geometry){
 
   if (rank == MASTER_NODE){
-#if defined(_WIN32) || defined(_WIN64) || defined (__WINDOWS__)
-    _mkdir(foldername.c_str());
-    _mkdir((foldername + "/zone_" + to_string(iZone)).c_str());
-#else
-    mkdir(foldername.c_str(), 0777);
-    //mkdir((this->folderName + "/zone_" + to_string(valiZone)).c_str(), 0777);
-    mkdir((foldername + "/zone_" + to_string(iZone)).c_str(), 0777);
-#endif
+    CreateFolder(foldername);
+    CreateFolder(foldername + "/zone_" + to_string(iZone));
   }
 
    /*--- Open a block for the zone ---*/
@@ -143,6 +156,40 @@ void CParaviewVTMFileWriter::WriteFolderData(string foldername, CConfig *config,
 
   StartBlock("Boundary");
 
+  if (config->GetWrt_Packed_Multiblock()){
+
+    /*--- Pack all boundary markers of the zone into a single surface dataset
+     * (the granularity of the surface output), so each snapshot consists of two
+     * files per zone instead of one file per marker per zone ---*/
+
+    vector<string> markerList;
+    for (unsigned short iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++){
+      if (config->GetMarker_All_KindBC(iMarker) != SEND_RECEIVE){
+        markerList.push_back(config->GetMarker_All_TagBound(iMarker));
+      }
+    }
+
+    /*--- Only sort if there is at least one processor that has a boundary marker ---*/
+
+    int globalMarkerSize = 0, localMarkerSize = markerList.size();
+    SU2_MPI::Allreduce(&localMarkerSize, &globalMarkerSize, 1, MPI_INT, MPI_SUM, SU2_MPI::GetComm());
+
+    if (globalMarkerSize > 0){
+
+      surfaceDataSorter->SortConnectivity(config, geometry, markerList);
+      surfaceDataSorter->SortOutputData();
+
+      AddDataset(foldername, "Boundary", "Boundary", surfaceDataSorter);
+    }
+
+    /*--- End "Boundary" block ---*/
+    EndBlock();
+    /*--- End "Zone" block ---*/
+    EndBlock();
+
+    return;
+  }
+
   /*--- Loop over all markers used in the config file ---*/
 
   for (unsigned short iMarker = 0; iMarker < config->GetnMarker_CfgFile(); iMarker++){
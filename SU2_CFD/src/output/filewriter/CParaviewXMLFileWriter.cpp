@@ -28,10 +28,16 @@
 #include "../../../include/output/filewriter/CParaviewXMLFileWriter.hpp"
 #include "../../../../Common/include/toolboxes/printing_toolbox.hpp"
 
+#ifdef HAVE_ZLIB
+#include <zlib.h>
+#endif
+
 const string CParaviewXMLFileWriter::fileExt = ".vtu";
 
-CParaviewXMLFileWriter::CParaviewXMLFileWriter(CParallelDataSorter *valDataSorter) :
-  CFileWriter(valDataSorter, fileExt){
+map<string, vector<pair<passivedouble, string> > > CParaviewXMLFileWriter::timeSeries;
+
+CParaviewXMLFileWriter::CParaviewXMLFileWriter(CParallelDataSorter *valDataSorter, bool valCompressed) :
+  CFileWriter(valDataSorter, fileExt), compressed(valCompressed){
 
   /* Check for big endian. We have to swap bytes otherwise.
    * Since size of character is 1 byte when the character pointer
@@ -43,6 +49,12 @@ CParaviewXMLFileWriter::CParaviewXMLFileWriter(CParallelDataSorter *valDataSorte
   if (*c) bigEndian = false;
   else bigEndian = true;
 
+#ifndef HAVE_ZLIB
+  if (compressed)
+    SU2_MPI::Error("SU2 was not compiled with zlib support (-Denable-zlib=true), "
+                   "compressed paraview output is not available.", CURRENT_FUNCTION);
+#endif
+
 }
 
 CParaviewXMLFileWriter::~CParaviewXMLFileWriter(){
@@ -51,6 +63,14 @@ CParaviewXMLFileWriter::~CParaviewXMLFileWriter(){
 
 void CParaviewXMLFileWriter::Write_Data(string val_filename){
 
+  /*--- Compressed appended data needs a different flow, the compressed
+   sizes must be known before the XML part can be written. ---*/
+
+  if (compressed) {
+    WriteDataCompressed(val_filename);
+    return;
+  }
+
   if (!dataSorter->GetConnectivitySorted()){
     SU2_MPI::Error("Connectivity must be sorted.", CURRENT_FUNCTION);
   }
@@ -67,8 +87,6 @@ void CParaviewXMLFileWriter::Write_Data(string val_filename){
 
   unsigned long iPoint, iElem;
 
-  char str_buf[255];
-
   OpenMPIFile(val_filename);
 
   dataOffset = 0;
@@ -105,25 +123,180 @@ void CParaviewXMLFileWriter::Write_Data(string val_filename){
   * which means that all data is appended at the end of the file in one binary blob.
   */
 
-  if (!bigEndian){
-    WriteMPIString("<VTKFile type=\"UnstructuredGrid\" version=\"1.0\" byte_order=\"LittleEndian\" header_type=\"UInt64\">\n", MASTER_NODE);
-  } else {
-    WriteMPIString("<VTKFile type=\"UnstructuredGrid\" version=\"1.0\" byte_order=\"BigEndian\" header_type=\"UInt64\">\n", MASTER_NODE);
+  WriteXMLHeader(myPoint, GlobalPoint, myElem, myElemStorage, GlobalElem, GlobalElemStorage);
+
+  /*--- Load/write the 1D buffer of point coordinates. Note that we
+   always have 3 coordinate dimensions, even for 2D problems. ---*/
+
+  vector<float> dataBufferFloat(myPoint*NCOORDS);
+  for (iPoint = 0; iPoint < myPoint; iPoint++) {
+    for (iDim = 0; iDim < NCOORDS; iDim++) {
+      if (nDim == 2 && iDim == 2) {
+        dataBufferFloat[iPoint*NCOORDS + iDim] = 0.0;
+      } else {
+        float val = (float)dataSorter->GetData(iDim, iPoint);
+        dataBufferFloat[iPoint*NCOORDS + iDim] = val;
+      }
+    }
+  }
+
+  WriteDataArray(dataBufferFloat.data(), VTKDatatype::FLOAT32, NCOORDS*myPoint, GlobalPoint*NCOORDS,
+                 dataSorter->GetnPointCumulative(rank)*NCOORDS);
+
+  /*--- Load/write 1D buffers for the connectivity of each element type. ---*/
+
+  vector<int> connBuf(myElemStorage);
+  vector<int> offsetBuf(myElem);
+  unsigned long iStorage = 0, iElemID = 0;
+  unsigned short iNode = 0;
+
+  auto copyToBuffer = [&](GEO_TYPE type, unsigned long nElem, unsigned short nPoints){
+    for (iElem = 0; iElem < nElem; iElem++) {
+      for (iNode = 0; iNode < nPoints; iNode++){
+        connBuf[iStorage+iNode] = int(dataSorter->GetElem_Connectivity(type, iElem, iNode)-1);
+      }
+      iStorage += nPoints;
+      offsetBuf[iElemID++] = int(iStorage + dataSorter->GetnElemConnCumulative(rank));
+    }
+  };
+
+  copyToBuffer(LINE,          nParallel_Line, N_POINTS_LINE);
+  copyToBuffer(TRIANGLE,      nParallel_Tria, N_POINTS_TRIANGLE);
+  copyToBuffer(QUADRILATERAL, nParallel_Quad, N_POINTS_QUADRILATERAL);
+  copyToBuffer(TETRAHEDRON,   nParallel_Tetr, N_POINTS_TETRAHEDRON);
+  copyToBuffer(HEXAHEDRON,    nParallel_Hexa, N_POINTS_HEXAHEDRON);
+  copyToBuffer(PRISM,         nParallel_Pris, N_POINTS_PRISM);
+  copyToBuffer(PYRAMID,       nParallel_Pyra, N_POINTS_PYRAMID);
+
+  WriteDataArray(connBuf.data(), VTKDatatype::INT32, myElemStorage, GlobalElemStorage,
+                 dataSorter->GetnElemConnCumulative(rank));
+  WriteDataArray(offsetBuf.data(), VTKDatatype::INT32, myElem, GlobalElem, dataSorter->GetnElemCumulative(rank));
+
+  /*--- Load/write the cell type for all elements in the file. ---*/
+
+  vector<uint8_t> typeBuf(myElem);
+  vector<uint8_t>::iterator typeIter = typeBuf.begin();
+
+  std::fill(typeIter, typeIter+nParallel_Line, LINE);          typeIter += nParallel_Line;
+  std::fill(typeIter, typeIter+nParallel_Tria, TRIANGLE);      typeIter += nParallel_Tria;
+  std::fill(typeIter, typeIter+nParallel_Quad, QUADRILATERAL); typeIter += nParallel_Quad;
+  std::fill(typeIter, typeIter+nParallel_Tetr, TETRAHEDRON);   typeIter += nParallel_Tetr;
+  std::fill(typeIter, typeIter+nParallel_Hexa, HEXAHEDRON);    typeIter += nParallel_Hexa;
+  std::fill(typeIter, typeIter+nParallel_Pris, PRISM);         typeIter += nParallel_Pris;
+  std::fill(typeIter, typeIter+nParallel_Pyra, PYRAMID);       typeIter += nParallel_Pyra;
+
+  WriteDataArray(typeBuf.data(), VTKDatatype::UINT8, myElem, GlobalElem, dataSorter->GetnElemCumulative(rank));
+
+  /*--- Loop over all variables that have been registered in the output. ---*/
+
+  unsigned short varStart = 2;
+  if (nDim == 3) varStart++;
+
+  unsigned short iField, VarCounter = varStart;
+  for (iField = varStart; iField < fieldNames.size(); iField++) {
+
+    /*--- Check whether this field is a vector or scalar. ---*/
+
+    bool output_variable = true, isVector = false;
+    size_t found = fieldNames[iField].find("_x");
+    if (found!=string::npos) {
+      output_variable = true;
+      isVector        = true;
+    }
+    found = fieldNames[iField].find("_y");
+    if (found!=string::npos) {
+      /*--- We have found a vector, so skip the Y component. ---*/
+      output_variable = false;
+      VarCounter++;
+    }
+    found = fieldNames[iField].find("_z");
+    if (found!=string::npos) {
+      /*--- We have found a vector, so skip the Z component. ---*/
+      output_variable = false;
+      VarCounter++;
+    }
+
+    /*--- Write the point data as an <X,Y,Z> vector or a scalar. ---*/
+
+    if (output_variable && isVector) {
+
+      /*--- Load up the buffer for writing this rank's vector data. ---*/
+
+      float val = 0.0;
+      for (iPoint = 0; iPoint < myPoint; iPoint++) {
+        for (iDim = 0; iDim < NCOORDS; iDim++) {
+          if (nDim == 2 && iDim == 2) {
+            dataBufferFloat[iPoint*NCOORDS + iDim] = 0.0;
+          } else {
+            val = (float)dataSorter->GetData(VarCounter+iDim,iPoint);
+            dataBufferFloat[iPoint*NCOORDS + iDim] = val;
+          }
+        }
+      }
+
+      WriteDataArray(dataBufferFloat.data(), VTKDatatype::FLOAT32, myPoint*NCOORDS, GlobalPoint*NCOORDS,
+                     dataSorter->GetnPointCumulative(rank)*NCOORDS);
+
+      VarCounter++;
+
+    } else if (output_variable) {
+
+
+      /*--- For now, create a temp 1D buffer to load up the data for writing.
+       This will be replaced with a derived data type most likely. ---*/
+
+      for (iPoint = 0; iPoint < myPoint; iPoint++) {
+        float val = (float)dataSorter->GetData(VarCounter,iPoint);
+        dataBufferFloat[iPoint] = val;
+      }
+
+      WriteDataArray(dataBufferFloat.data(), VTKDatatype::FLOAT32, myPoint, GlobalPoint,
+                     dataSorter->GetnPointCumulative(rank));
+
+      VarCounter++;
+    }
+
   }
 
+  WriteMPIString("</AppendedData>\n", MASTER_NODE);
+  WriteMPIString("</VTKFile>\n", MASTER_NODE);
+
+  CloseMPIFile();
+
+}
+
+void CParaviewXMLFileWriter::WriteXMLHeader(unsigned long myPoint, unsigned long globalPoint,
+                                            unsigned long myElem, unsigned long myElemStorage,
+                                            unsigned long globalElem, unsigned long globalElemStorage){
+
+  const int NCOORDS = 3;
+  const unsigned short nDim = dataSorter->GetnDim();
+
+  /*--- Array containing the field names we want to output ---*/
+
+  const vector<string>& fieldNames = dataSorter->GetFieldNames();
+
+  char str_buf[255];
+
+  const string byteOrder = bigEndian ? "BigEndian" : "LittleEndian";
+  const string compressor = compressed ? " compressor=\"vtkZLibDataCompressor\"" : "";
+
+  WriteMPIString(string("<VTKFile type=\"UnstructuredGrid\" version=\"1.0\" byte_order=\"") +
+                 byteOrder + string("\" header_type=\"UInt64\"") + compressor + string(">\n"), MASTER_NODE);
+
   WriteMPIString("<UnstructuredGrid>\n", MASTER_NODE);
 
   SPRINTF(str_buf, "<Piece NumberOfPoints=\"%i\" NumberOfCells=\"%i\">\n",
-          SU2_TYPE::Int(GlobalPoint), SU2_TYPE::Int(GlobalElem));
+          SU2_TYPE::Int(globalPoint), SU2_TYPE::Int(globalElem));
 
   WriteMPIString(std::string(str_buf), MASTER_NODE);
   WriteMPIString("<Points>\n", MASTER_NODE);
-  AddDataArray(VTKDatatype::FLOAT32, "", NCOORDS, myPoint*NCOORDS, GlobalPoint*NCOORDS);
+  AddDataArray(VTKDatatype::FLOAT32, "", NCOORDS, myPoint*NCOORDS, globalPoint*NCOORDS);
   WriteMPIString("</Points>\n", MASTER_NODE);
   WriteMPIString("<Cells>\n", MASTER_NODE);
-  AddDataArray(VTKDatatype::INT32, "connectivity", 1, myElemStorage, GlobalElemStorage);
-  AddDataArray(VTKDatatype::INT32, "offsets", 1, myElem, GlobalElem);
-  AddDataArray(VTKDatatype::UINT8, "types", 1, myElem, GlobalElem);
+  AddDataArray(VTKDatatype::INT32, "connectivity", 1, myElemStorage, globalElemStorage);
+  AddDataArray(VTKDatatype::INT32, "offsets", 1, myElem, globalElem);
+  AddDataArray(VTKDatatype::UINT8, "types", 1, myElem, globalElem);
   WriteMPIString("</Cells>\n", MASTER_NODE);
 
   WriteMPIString("<PointData>\n", MASTER_NODE);
@@ -171,11 +344,11 @@ void CParaviewXMLFileWriter::Write_Data(string val_filename){
 
       fieldname.erase(fieldname.end()-2,fieldname.end());
 
-      AddDataArray(VTKDatatype::FLOAT32, fieldname, NCOORDS, myPoint*NCOORDS, GlobalPoint*NCOORDS);
+      AddDataArray(VTKDatatype::FLOAT32, fieldname, NCOORDS, myPoint*NCOORDS, globalPoint*NCOORDS);
 
     } else if (output_variable) {
 
-      AddDataArray(VTKDatatype::FLOAT32, fieldname, 1, myPoint, GlobalPoint);
+      AddDataArray(VTKDatatype::FLOAT32, fieldname, 1, myPoint, globalPoint);
 
     }
 
@@ -188,7 +361,122 @@ void CParaviewXMLFileWriter::Write_Data(string val_filename){
 
   WriteMPIString("<AppendedData encoding=\"raw\">\n_", MASTER_NODE);
 
-  /*--- Load/write the 1D buffer of point coordinates. Note that we
+}
+
+void CParaviewXMLFileWriter::WriteDataArray(void* data, VTKDatatype type, unsigned long arraySize,
+                                            unsigned long globalSize, unsigned long offset){
+
+  std::string typeStr;
+  unsigned long typeSize = 0;
+
+  GetTypeInfo(type, typeStr, typeSize);
+
+  /*--- Compute the size of the data to write in bytes ---*/
+
+  size_t byteSize = arraySize*typeSize;
+
+  /*--- The total data size ---*/
+  size_t totalByteSize = globalSize*typeSize;
+
+  /*--- Only the master node writes the total size in bytes as unsigned long in front of the array data ---*/
+
+  if (!WriteMPIBinaryData(&totalByteSize, sizeof(size_t), MASTER_NODE)){
+    SU2_MPI::Error("Writing array size failed", CURRENT_FUNCTION);
+  }
+
+  /*--- Collectively write all the data ---*/
+
+  if (!WriteMPIBinaryDataAll(data, byteSize, totalByteSize, offset*typeSize)){
+    SU2_MPI::Error("Writing data array failed", CURRENT_FUNCTION);
+  }
+}
+
+void CParaviewXMLFileWriter::AddDataArray(VTKDatatype type, string name,
+                                          unsigned short nComponents, unsigned long arraySize, unsigned long globalSize){
+
+  /*--- Add quotation marks around the arguments ---*/
+
+  name = "\"" + name + "\"";
+
+  string nComp ="\"" + PrintingToolbox::to_string(nComponents) + "\"";
+
+  /*--- Full precision ASCII output of offset for 32 bit integer ---*/
+
+  stringstream ss;
+  ss.precision(10); ss.setf(std::ios::fixed, std::ios::floatfield);
+  ss <<  "\"" << dataOffset <<  "\"";
+  string offsetStr = ss.str();
+
+  std::string typeStr;
+  unsigned long typeSize = 0;
+
+  GetTypeInfo(type, typeStr, typeSize);
+
+  /*--- Write the ASCII XML header information for this array ---*/
+
+  WriteMPIString(string("<DataArray type=") + typeStr +
+                 string(" Name=") + name +
+                 string(" NumberOfComponents= ") + nComp +
+                 string(" offset=") + offsetStr +
+                 string(" format=\"appended\"/>\n"), MASTER_NODE);
+
+  if (compressed) {
+
+    /*--- The arrays were staged and compressed before writing the XML part,
+     the offset advances by the block header plus the compressed blocks. ---*/
+
+    const auto& array = compressedArrays[currentArray++];
+    dataOffset += array.header.size()*sizeof(unsigned long) + array.totalCompressedSize;
+  }
+  else {
+    dataOffset += globalSize*typeSize + sizeof(size_t);
+  }
+
+}
+
+void CParaviewXMLFileWriter::WriteDataCompressed(string val_filename){
+
+  if (!dataSorter->GetConnectivitySorted()){
+    SU2_MPI::Error("Connectivity must be sorted.", CURRENT_FUNCTION);
+  }
+
+  /*--- We always have 3 coords, independent of the actual value of nDim ---*/
+
+  const int NCOORDS = 3;
+  const unsigned short nDim = dataSorter->GetnDim();
+  unsigned short iDim = 0;
+
+  const vector<string>& fieldNames = dataSorter->GetFieldNames();
+
+  unsigned long iPoint, iElem;
+
+  unsigned long myPoint, GlobalPoint;
+
+  GlobalPoint = dataSorter->GetnPointsGlobal();
+  myPoint     = dataSorter->GetnPoints();
+
+  unsigned long myElem, myElemStorage, GlobalElem, GlobalElemStorage;
+
+  unsigned long nParallel_Line = dataSorter->GetnElem(LINE),
+                nParallel_Tria = dataSorter->GetnElem(TRIANGLE),
+                nParallel_Quad = dataSorter->GetnElem(QUADRILATERAL),
+                nParallel_Tetr = dataSorter->GetnElem(TETRAHEDRON),
+                nParallel_Hexa = dataSorter->GetnElem(HEXAHEDRON),
+                nParallel_Pris = dataSorter->GetnElem(PRISM),
+                nParallel_Pyra = dataSorter->GetnElem(PYRAMID);
+
+  myElem            = dataSorter->GetnElem();
+  myElemStorage     = dataSorter->GetnConn();
+  GlobalElem        = dataSorter->GetnElemGlobal();
+  GlobalElemStorage = dataSorter->GetnConnGlobal();
+
+  /*--- Stage and compress all appended data arrays before opening the file, the
+   XML part references the compressed sizes and must be written first. ---*/
+
+  compressedArrays.clear();
+  currentArray = 0;
+
+  /*--- Load/compress the 1D buffer of point coordinates. Note that we
    always have 3 coordinate dimensions, even for 2D problems. ---*/
 
   vector<float> dataBufferFloat(myPoint*NCOORDS);
@@ -203,10 +491,10 @@ void CParaviewXMLFileWriter::Write_Data(string val_filename){
     }
   }
 
-  WriteDataArray(dataBufferFloat.data(), VTKDatatype::FLOAT32, NCOORDS*myPoint, GlobalPoint*NCOORDS,
-                 dataSorter->GetnPointCumulative(rank)*NCOORDS);
+  CompressDataArray(dataBufferFloat.data(), VTKDatatype::FLOAT32, NCOORDS*myPoint, GlobalPoint*NCOORDS,
+                    dataSorter->GetnPointCumulative(rank)*NCOORDS);
 
-  /*--- Load/write 1D buffers for the connectivity of each element type. ---*/
+  /*--- Load/compress 1D buffers for the connectivity of each element type. ---*/
 
   vector<int> connBuf(myElemStorage);
   vector<int> offsetBuf(myElem);
@@ -231,11 +519,11 @@ void CParaviewXMLFileWriter::Write_Data(string val_filename){
   copyToBuffer(PRISM,         nParallel_Pris, N_POINTS_PRISM);
   copyToBuffer(PYRAMID,       nParallel_Pyra, N_POINTS_PYRAMID);
 
-  WriteDataArray(connBuf.data(), VTKDatatype::INT32, myElemStorage, GlobalElemStorage,
-                 dataSorter->GetnElemConnCumulative(rank));
-  WriteDataArray(offsetBuf.data(), VTKDatatype::INT32, myElem, GlobalElem, dataSorter->GetnElemCumulative(rank));
+  CompressDataArray(connBuf.data(), VTKDatatype::INT32, myElemStorage, GlobalElemStorage,
+                    dataSorter->GetnElemConnCumulative(rank));
+  CompressDataArray(offsetBuf.data(), VTKDatatype::INT32, myElem, GlobalElem, dataSorter->GetnElemCumulative(rank));
 
-  /*--- Load/write the cell type for all elements in the file. ---*/
+  /*--- Load/compress the cell type for all elements in the file. ---*/
 
   vector<uint8_t> typeBuf(myElem);
   vector<uint8_t>::iterator typeIter = typeBuf.begin();
@@ -248,11 +536,14 @@ void CParaviewXMLFileWriter::Write_Data(string val_filename){
   std::fill(typeIter, typeIter+nParallel_Pris, PRISM);         typeIter += nParallel_Pris;
   std::fill(typeIter, typeIter+nParallel_Pyra, PYRAMID);       typeIter += nParallel_Pyra;
 
-  WriteDataArray(typeBuf.data(), VTKDatatype::UINT8, myElem, GlobalElem, dataSorter->GetnElemCumulative(rank));
+  CompressDataArray(typeBuf.data(), VTKDatatype::UINT8, myElem, GlobalElem, dataSorter->GetnElemCumulative(rank));
 
   /*--- Loop over all variables that have been registered in the output. ---*/
 
-  VarCounter = varStart;
+  unsigned short varStart = 2;
+  if (nDim == 3) varStart++;
+
+  unsigned short iField, VarCounter = varStart;
   for (iField = varStart; iField < fieldNames.size(); iField++) {
 
     /*--- Check whether this field is a vector or scalar. ---*/
@@ -276,7 +567,7 @@ void CParaviewXMLFileWriter::Write_Data(string val_filename){
       VarCounter++;
     }
 
-    /*--- Write the point data as an <X,Y,Z> vector or a scalar. ---*/
+    /*--- Compress the point data as an <X,Y,Z> vector or a scalar. ---*/
 
     if (output_variable && isVector) {
 
@@ -294,30 +585,49 @@ void CParaviewXMLFileWriter::Write_Data(string val_filename){
         }
       }
 
-      WriteDataArray(dataBufferFloat.data(), VTKDatatype::FLOAT32, myPoint*NCOORDS, GlobalPoint*NCOORDS,
-                     dataSorter->GetnPointCumulative(rank)*NCOORDS);
+      CompressDataArray(dataBufferFloat.data(), VTKDatatype::FLOAT32, myPoint*NCOORDS, GlobalPoint*NCOORDS,
+                        dataSorter->GetnPointCumulative(rank)*NCOORDS);
 
       VarCounter++;
 
     } else if (output_variable) {
 
-
-      /*--- For now, create a temp 1D buffer to load up the data for writing.
-       This will be replaced with a derived data type most likely. ---*/
-
       for (iPoint = 0; iPoint < myPoint; iPoint++) {
         float val = (float)dataSorter->GetData(VarCounter,iPoint);
         dataBufferFloat[iPoint] = val;
       }
 
-      WriteDataArray(dataBufferFloat.data(), VTKDatatype::FLOAT32, myPoint, GlobalPoint,
-                     dataSorter->GetnPointCumulative(rank));
+      CompressDataArray(dataBufferFloat.data(), VTKDatatype::FLOAT32, myPoint, GlobalPoint,
+                        dataSorter->GetnPointCumulative(rank));
 
       VarCounter++;
     }
 
   }
 
+  /*--- Write the XML part of the file, AddDataArray picks up the compressed sizes. ---*/
+
+  OpenMPIFile(val_filename);
+
+  dataOffset = 0;
+
+  WriteXMLHeader(myPoint, GlobalPoint, myElem, myElemStorage, GlobalElem, GlobalElemStorage);
+
+  /*--- Write the block header and compressed blocks of each staged array. ---*/
+
+  for (const auto& array : compressedArrays) {
+
+    if (!WriteMPIBinaryData(array.header.data(), array.header.size()*sizeof(unsigned long), MASTER_NODE)){
+      SU2_MPI::Error("Writing block header failed", CURRENT_FUNCTION);
+    }
+
+    if (!WriteMPIBinaryDataAll(array.data.data(), array.data.size(),
+                               array.totalCompressedSize, array.writeOffset)){
+      SU2_MPI::Error("Writing compressed data array failed", CURRENT_FUNCTION);
+    }
+  }
+  vector<CompressedDataArray>().swap(compressedArrays);
+
   WriteMPIString("</AppendedData>\n", MASTER_NODE);
   WriteMPIString("</VTKFile>\n", MASTER_NODE);
 
@@ -325,67 +635,136 @@ void CParaviewXMLFileWriter::Write_Data(string val_filename){
 
 }
 
-void CParaviewXMLFileWriter::WriteDataArray(void* data, VTKDatatype type, unsigned long arraySize,
-                                            unsigned long globalSize, unsigned long offset){
+void CParaviewXMLFileWriter::CompressDataArray(const void *data, VTKDatatype type, unsigned long arraySize,
+                                               unsigned long globalSize, unsigned long offset){
+#ifdef HAVE_ZLIB
 
   std::string typeStr;
   unsigned long typeSize = 0;
 
   GetTypeInfo(type, typeStr, typeSize);
 
-  /*--- Compute the size of the data to write in bytes ---*/
+  const unsigned long blockSize = compressionBlockSize;
+  const unsigned long totalBytes = globalSize*typeSize;
+  unsigned long myStart = offset*typeSize;
+  unsigned long myBytes = arraySize*typeSize;
 
-  size_t byteSize = arraySize*typeSize;
+  const char* myData = static_cast<const char*>(data);
+  vector<char> alignedData;
 
-  /*--- The total data size ---*/
-  size_t totalByteSize = globalSize*typeSize;
+#ifdef HAVE_MPI
+  if (size > 1) {
 
-  /*--- Only the master node writes the total size in bytes as unsigned long in front of the array data ---*/
+    /*--- Redistribute the data such that compression blocks do not straddle rank
+     boundaries, each rank takes ownership of the blocks that start in its chunk. ---*/
 
-  if (!WriteMPIBinaryData(&totalByteSize, sizeof(size_t), MASTER_NODE)){
-    SU2_MPI::Error("Writing array size failed", CURRENT_FUNCTION);
-  }
+    vector<unsigned long> oldStart(size+1);
+    SU2_MPI::Allgather(&myStart, 1, MPI_UNSIGNED_LONG, oldStart.data(), 1, MPI_UNSIGNED_LONG, fileComm);
+    oldStart[size] = totalBytes;
 
-  /*--- Collectively write all the data ---*/
+    vector<unsigned long> newStart(size+1);
+    newStart[0] = 0;
+    for (int i = 1; i <= size; ++i)
+      newStart[i] = min(((oldStart[i] + blockSize - 1) / blockSize) * blockSize, totalBytes);
 
-  if (!WriteMPIBinaryDataAll(data, byteSize, totalByteSize, offset*typeSize)){
-    SU2_MPI::Error("Writing data array failed", CURRENT_FUNCTION);
+    auto overlap = [](unsigned long lo1, unsigned long hi1, unsigned long lo2, unsigned long hi2){
+      return (min(hi1,hi2) > max(lo1,lo2))? int(min(hi1,hi2) - max(lo1,lo2)) : 0;
+    };
+
+    vector<int> sendCounts(size), sendDispl(size,0), recvCounts(size), recvDispl(size,0);
+    for (int i = 0; i < size; ++i) {
+      sendCounts[i] = overlap(myStart, myStart+myBytes, newStart[i], newStart[i+1]);
+      recvCounts[i] = overlap(newStart[rank], newStart[rank+1], oldStart[i], oldStart[i+1]);
+      if (sendCounts[i] > 0) sendDispl[i] = int(max(newStart[i], myStart) - myStart);
+      if (recvCounts[i] > 0) recvDispl[i] = int(max(oldStart[i], newStart[rank]) - newStart[rank]);
+    }
+
+    alignedData.resize(newStart[rank+1] - newStart[rank]);
+    SU2_MPI::Alltoallv(myData, sendCounts.data(), sendDispl.data(), MPI_CHAR,
+                       alignedData.data(), recvCounts.data(), recvDispl.data(), MPI_CHAR, fileComm);
+
+    myStart = newStart[rank];
+    myBytes = alignedData.size();
+    myData  = alignedData.data();
   }
-}
+#endif
 
-void CParaviewXMLFileWriter::AddDataArray(VTKDatatype type, string name,
-                                          unsigned short nComponents, unsigned long arraySize, unsigned long globalSize){
+  /*--- Deflate each block independently, as expected by the vtk library. ---*/
 
-  /*--- Add quotation marks around the arguments ---*/
+  CompressedDataArray array;
+  const unsigned long nBlocksLocal = (myBytes + blockSize - 1) / blockSize;
+  vector<unsigned long> blockSizes(nBlocksLocal);
 
-  name = "\"" + name + "\"";
+  vector<unsigned char> blockBuf(compressBound(blockSize));
+  for (unsigned long iBlock = 0; iBlock < nBlocksLocal; ++iBlock) {
+    const unsigned long srcBytes = min(blockSize, myBytes - iBlock*blockSize);
+    uLongf destBytes = blockBuf.size();
+    if (compress2(blockBuf.data(), &destBytes, reinterpret_cast<const Bytef*>(myData + iBlock*blockSize),
+                  srcBytes, Z_DEFAULT_COMPRESSION) != Z_OK){
+      SU2_MPI::Error("Data compression failed", CURRENT_FUNCTION);
+    }
+    blockSizes[iBlock] = destBytes;
+    array.data.insert(array.data.end(), blockBuf.begin(), blockBuf.begin()+destBytes);
+  }
 
-  string nComp ="\"" + PrintingToolbox::to_string(nComponents) + "\"";
+  /*--- Build the block header, all ranks need the compressed sizes
+   of all blocks to determine their offsets in the file. ---*/
 
-  /*--- Full precision ASCII output of offset for 32 bit integer ---*/
+  const unsigned long nBlocks = (totalBytes + blockSize - 1) / blockSize;
 
-  stringstream ss;
-  ss.precision(10); ss.setf(std::ios::fixed, std::ios::floatfield);
-  ss <<  "\"" << dataOffset <<  "\"";
-  string offsetStr = ss.str();
+  array.header.resize(3+nBlocks);
+  array.header[0] = nBlocks;
+  array.header[1] = blockSize;
+  array.header[2] = totalBytes % blockSize;
 
-  std::string typeStr;
-  unsigned long typeSize = 0;
+#ifdef HAVE_MPI
+  if (size > 1) {
+    vector<int> counts(size), displ(size,0);
+    const int nLocal = int(nBlocksLocal);
+    SU2_MPI::Allgather(&nLocal, 1, MPI_INT, counts.data(), 1, MPI_INT, fileComm);
+    for (int i = 1; i < size; ++i) displ[i] = displ[i-1] + counts[i-1];
+    SU2_MPI::Allgatherv(blockSizes.data(), nLocal, MPI_UNSIGNED_LONG, array.header.data()+3,
+                        counts.data(), displ.data(), MPI_UNSIGNED_LONG, fileComm);
+  }
+  else
+#endif
+  {
+    copy(blockSizes.begin(), blockSizes.end(), array.header.begin()+3);
+  }
 
-  GetTypeInfo(type, typeStr, typeSize);
+  /*--- The write offset of this rank skips the compressed blocks of the lower ranks. ---*/
 
-  /*--- Total data size ---*/
+  const unsigned long firstBlock = myStart / blockSize;
+  array.writeOffset = 0;
+  array.totalCompressedSize = 0;
+  for (unsigned long iBlock = 0; iBlock < nBlocks; ++iBlock) {
+    if (iBlock < firstBlock) array.writeOffset += array.header[3+iBlock];
+    array.totalCompressedSize += array.header[3+iBlock];
+  }
 
-  size_t totalByteSize = globalSize*typeSize;
+  compressedArrays.push_back(move(array));
+#endif
+}
 
-  /*--- Write the ASCII XML header information for this array ---*/
+void CParaviewXMLFileWriter::WriteTimeSeries(const string& seriesName, const string& fileName,
+                                             passivedouble timeValue){
 
-  WriteMPIString(string("<DataArray type=") + typeStr +
-                 string(" Name=") + name +
-                 string(" NumberOfComponents= ") + nComp +
-                 string(" offset=") + offsetStr +
-                 string(" format=\"appended\"/>\n"), MASTER_NODE);
+  if (SU2_MPI::GetRank() != MASTER_NODE) return;
+
+  auto& entries = timeSeries[seriesName];
+  entries.emplace_back(timeValue, fileName);
 
-  dataOffset += totalByteSize + sizeof(size_t);
+  /*--- Rewrite the collection from scratch, it only holds one line per snapshot. ---*/
+
+  ofstream pvdFile(seriesName + ".pvd");
+  pvdFile.precision(12);
+  pvdFile << "<VTKFile type=\"Collection\" version=\"1.0\">\n";
+  pvdFile << "<Collection>\n";
+  for (const auto& entry : entries) {
+    pvdFile << "<DataSet timestep=\"" << entry.first << "\" part=\"0\" file=\""
+            << entry.second << "\"/>\n";
+  }
+  pvdFile << "</Collection>\n";
+  pvdFile << "</VTKFile>\n";
 
 }
@@ -0,0 +1,547 @@
+/*!
+ * \file CRegionFVMDataSorter.cpp
+ * \brief Region-of-interest datasorter for FVM solvers.
+ * \author T. Albring
+ * \version 7.3.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2022, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../../include/output/filewriter/CRegionFVMDataSorter.hpp"
+#include "../../../../Common/include/geometry/CGeometry.hpp"
+
+namespace {
+/*--- Block length of the prefix counts used to renumber global point indices,
+ a full index-to-index map would require too much memory on large meshes. ---*/
+constexpr unsigned long ROI_BLOCK_SIZE = 1024;
+}
+
+CRegionFVMDataSorter::CRegionFVMDataSorter(CConfig *config, CGeometry* geometry, const CFVMDataSorter* valVolumeSorter) :
+  CParallelDataSorter(config, valVolumeSorter->GetFieldNames()),
+  volumeSorter(valVolumeSorter) {
+
+  nDim = geometry->GetnDim();
+
+  nGlobalPointBeforeSort = geometry->GetGlobal_nPointDomain();
+  nLocalPointsBeforeSort = geometry->GetnPointDomain();
+
+  /*--- The elements are routed by their original global indices, which follow the
+   linear partitioning of the volume sorter. ---*/
+
+  linearPartitioner.Initialize(nGlobalPointBeforeSort, 0);
+
+  if (config->GetnOutputROIBox() != 2*nDim)
+    SU2_MPI::Error("OUTPUT_ROI_BOX requires 2*nDim values (min corner, max corner).", CURRENT_FUNCTION);
+
+  for (unsigned short iDim = 0; iDim < nDim; iDim++) {
+    boxMin[iDim] = SU2_TYPE::GetValue(config->GetOutputROIBox(iDim));
+    boxMax[iDim] = SU2_TYPE::GetValue(config->GetOutputROIBox(nDim+iDim));
+    if (boxMin[iDim] > boxMax[iDim])
+      SU2_MPI::Error("The minimum corner of OUTPUT_ROI_BOX must not exceed the maximum corner.", CURRENT_FUNCTION);
+  }
+
+}
+
+void CRegionFVMDataSorter::SortOutputData() {
+
+  /*--- The volume redistribution may still be in flight (overlapped with the
+   connectivity sort), it has to land before the sorted data is read. ---*/
+
+  volumeSorter->CompleteSortOutputData();
+
+  const int VARS_PER_POINT = GlobalField_Counter;
+
+  /*--- The sorted volume data of this rank is a linear chunk of the global points,
+   flag the points of the chunk that are inside the region of interest. The first
+   nDim fields of the sorted data are the coordinates. ---*/
+
+  const passivedouble* volumeData = volumeSorter->GetData();
+  const unsigned long nVolumePoints = volumeSorter->GetnPoints();
+
+  keepLocal.assign(nVolumePoints, 0);
+
+  unsigned long myPoints = 0;
+
+  for (unsigned long iPoint = 0; iPoint < nVolumePoints; iPoint++) {
+    keepLocal[iPoint] = InsideRegion(&volumeData[iPoint*VARS_PER_POINT]);
+    myPoints += keepLocal[iPoint];
+  }
+
+  /*--- Communicate the number of kept points per rank and build the cumulative
+   counts, which define the renumbered partitioning (reusing nPoint_Recv for the
+   storage, like the surface sorters do). ---*/
+
+  int nPointSend = int(myPoints);
+  vector<int> nPointRank(size);
+
+  SU2_MPI::Allgather(&nPointSend, 1, MPI_INT, nPointRank.data(), 1, MPI_INT, SU2_MPI::GetComm());
+
+  nPoint_Recv[0] = 0;
+  for (int iRank = 0; iRank < size; iRank++)
+    nPoint_Recv[iRank+1] = nPoint_Recv[iRank] + nPointRank[iRank];
+
+  nPoints = myPoints;
+  nPointsGlobal = nPoint_Recv[size];
+
+  /*--- Compact the kept points of the chunk into the local data buffer and store
+   their original global indices. ---*/
+
+  delete [] dataBuffer;
+  dataBuffer = new passivedouble[nPoints*VARS_PER_POINT];
+
+  renumberOld.resize(nPoints);
+
+  unsigned long newPoint = 0;
+  for (unsigned long iPoint = 0; iPoint < nVolumePoints; iPoint++) {
+    if (!keepLocal[iPoint]) continue;
+
+    for (int iVar = 0; iVar < VARS_PER_POINT; iVar++)
+      dataBuffer[newPoint*VARS_PER_POINT+iVar] = volumeData[iPoint*VARS_PER_POINT+iVar];
+
+    renumberOld[newPoint] = volumeSorter->GetGlobalIndex(iPoint);
+    newPoint++;
+  }
+
+}
+
+void CRegionFVMDataSorter::SortConnectivity(CConfig *config, CGeometry *geometry, bool val_sort) {
+
+  if (keepLocal.size() != volumeSorter->GetnPoints())
+    SU2_MPI::Error("SortOutputData must be called before sorting the region connectivity.", CURRENT_FUNCTION);
+
+  /*--- Gather the region flags of all linear partitions, so that any global point
+   index appearing in the connectivity can be tested and renumbered locally. ---*/
+
+  vector<int> nPointLinear(size), offsetLinear(size);
+  for (int iRank = 0; iRank < size; iRank++) {
+    nPointLinear[iRank] = int(volumeSorter->GetnPointLinear(iRank));
+    offsetLinear[iRank] = int(volumeSorter->GetnPointCumulative(iRank));
+  }
+
+  vector<char> keepGlobal(nGlobalPointBeforeSort);
+
+  SU2_MPI::Allgatherv(keepLocal.data(), int(keepLocal.size()), MPI_CHAR, keepGlobal.data(),
+                      nPointLinear.data(), offsetLinear.data(), MPI_CHAR, SU2_MPI::GetComm());
+
+  /*--- Blocked prefix counts of the flags, the renumbered index of a global point
+   is the number of kept points before it. ---*/
+
+  const unsigned long nBlocks = nGlobalPointBeforeSort/ROI_BLOCK_SIZE + 1;
+  vector<unsigned long> regionOffset(nBlocks, 0);
+
+  for (unsigned long iBlock = 1; iBlock < nBlocks; iBlock++) {
+    regionOffset[iBlock] = regionOffset[iBlock-1];
+    const unsigned long begin = (iBlock-1)*ROI_BLOCK_SIZE;
+    const unsigned long end = min(iBlock*ROI_BLOCK_SIZE, nGlobalPointBeforeSort);
+    for (unsigned long iPoint = begin; iPoint < end; iPoint++)
+      regionOffset[iBlock] += keepGlobal[iPoint];
+  }
+
+  /*--- Sort the connectivity of the elements inside the region for each type. ---*/
+
+  nElemPerType.fill(0);
+
+  SortVolumetricConnectivity(config, geometry, TRIANGLE,      val_sort, keepGlobal, regionOffset);
+  SortVolumetricConnectivity(config, geometry, QUADRILATERAL, val_sort, keepGlobal, regionOffset);
+  SortVolumetricConnectivity(config, geometry, TETRAHEDRON,   val_sort, keepGlobal, regionOffset);
+  SortVolumetricConnectivity(config, geometry, HEXAHEDRON,    val_sort, keepGlobal, regionOffset);
+  SortVolumetricConnectivity(config, geometry, PRISM,         val_sort, keepGlobal, regionOffset);
+  SortVolumetricConnectivity(config, geometry, PYRAMID,       val_sort, keepGlobal, regionOffset);
+
+  SetTotalElements();
+
+  connectivitySorted = true;
+
+}
+
+void CRegionFVMDataSorter::SortVolumetricConnectivity(CConfig *config, CGeometry *geometry,
+                                                      unsigned short Elem_Type, bool val_sort,
+                                                      const vector<char>& keepGlobal,
+                                                      const vector<unsigned long>& regionOffset) {
+
+  unsigned long iProcessor;
+  unsigned short NODES_PER_ELEMENT = 0;
+  unsigned long iPoint, jPoint;
+  unsigned long nElem_Total = 0, Global_Index;
+
+  int *Conn_Elem  = nullptr;
+
+#ifdef HAVE_MPI
+  SU2_MPI::Request *send_req, *recv_req;
+  SU2_MPI::Status status;
+  int ind;
+#endif
+
+  switch (Elem_Type) {
+    case TRIANGLE:
+      NODES_PER_ELEMENT = N_POINTS_TRIANGLE;
+      break;
+    case QUADRILATERAL:
+      NODES_PER_ELEMENT = N_POINTS_QUADRILATERAL;
+      break;
+    case TETRAHEDRON:
+      NODES_PER_ELEMENT = N_POINTS_TETRAHEDRON;
+      break;
+    case HEXAHEDRON:
+      NODES_PER_ELEMENT = N_POINTS_HEXAHEDRON;
+      break;
+    case PRISM:
+      NODES_PER_ELEMENT = N_POINTS_PRISM;
+      break;
+    case PYRAMID:
+      NODES_PER_ELEMENT = N_POINTS_PYRAMID;
+      break;
+    default:
+      SU2_MPI::Error("Unrecognized element type", CURRENT_FUNCTION);
+  }
+
+  /*--- An element belongs to the region if all of its nodes are inside,
+   so the region elements reference only points that are written. ---*/
+
+  auto elemInRegion = [&](int ii) {
+    for (int kk = 0; kk < NODES_PER_ELEMENT; kk++) {
+      const auto globalIndex = geometry->nodes->GetGlobalIndex(geometry->elem[ii]->GetNode(kk));
+      if (!keepGlobal[globalIndex]) return false;
+    }
+    return true;
+  };
+
+  /*--- The renumbered index of a point is the number of kept points before it,
+   from the blocked prefix counts plus a scan of the last partial block. ---*/
+
+  auto newGlobalIndex = [&](unsigned long globalIndex) {
+    unsigned long newIndex = regionOffset[globalIndex/ROI_BLOCK_SIZE];
+    for (auto kk = globalIndex - globalIndex%ROI_BLOCK_SIZE; kk < globalIndex; kk++)
+      newIndex += keepGlobal[kk];
+    return newIndex;
+  };
+
+  /*--- The communication pattern mirrors the volume sorter: elements are sent to the
+   rank owning the linear partition of their lowest global node index, which also owns
+   the corresponding chunk of the renumbered points. First count the sends. ---*/
+
+  int *nElem_Flag = new int[size]();
+
+  for (int ii=0; ii < size; ii++) {
+    nElem_Send[ii] = 0;
+    nElem_Cum[ii] = 0;
+    nElem_Flag[ii]= -1;
+  }
+  nElem_Send[size] = 0; nElem_Cum[size] = 0;
+
+  for (int ii = 0; ii < (int)geometry->GetnElem(); ii++ ) {
+    if ((geometry->elem[ii]->GetVTK_Type() == Elem_Type) && elemInRegion(ii)) {
+      for ( int jj = 0; jj < NODES_PER_ELEMENT; jj++ ) {
+
+        /*--- Get the index of the current point. ---*/
+
+        iPoint = geometry->elem[ii]->GetNode(jj);
+        Global_Index = geometry->nodes->GetGlobalIndex(iPoint);
+
+        /*--- Search for the lowest global index in this element. ---*/
+
+        for (int kk = 0; kk < NODES_PER_ELEMENT; kk++) {
+          jPoint = geometry->elem[ii]->GetNode(kk);
+          unsigned long newID = geometry->nodes->GetGlobalIndex(jPoint);
+          if (newID < Global_Index) Global_Index = newID;
+        }
+
+        /*--- Search for the processor that owns this point. ---*/
+
+        if (val_sort) {
+          iProcessor = linearPartitioner.GetRankContainingIndex(Global_Index);
+        } else {
+          iProcessor = rank;
+        }
+
+        /*--- If we have not visited this element yet, increment our
+         number of elements that must be sent to a particular proc. ---*/
+
+        if ((nElem_Flag[iProcessor] != ii)) {
+          nElem_Flag[iProcessor] = ii;
+          nElem_Send[iProcessor+1]++;
+        }
+
+      }
+    }
+  }
+
+  /*--- Communicate the number of cells to be sent/recv'd amongst
+   all processors. ---*/
+
+  SU2_MPI::Alltoall(&(nElem_Send[1]), 1, MPI_INT,
+                    &(nElem_Cum[1]), 1, MPI_INT, SU2_MPI::GetComm());
+
+  /*--- Put the counters into cumulative storage format. ---*/
+
+  int nSends = 0, nRecvs = 0;
+  for (int ii=0; ii < size; ii++) nElem_Flag[ii] = -1;
+
+  for (int ii = 0; ii < size; ii++) {
+    if ((ii != rank) && (nElem_Send[ii+1] > 0)) nSends++;
+    if ((ii != rank) && (nElem_Cum[ii+1] > 0)) nRecvs++;
+
+    nElem_Send[ii+1] += nElem_Send[ii];
+    nElem_Cum[ii+1] += nElem_Cum[ii];
+  }
+
+  /*--- Allocate memory to hold the connectivity and halo flags that we are sending. ---*/
+
+  auto connSendElem = new unsigned long[NODES_PER_ELEMENT*nElem_Send[size]]();
+
+  auto haloSend = new unsigned short[nElem_Send[size]]();
+
+  unsigned long *index = new unsigned long[size]();
+  for (int ii=0; ii < size; ii++) index[ii] = NODES_PER_ELEMENT*nElem_Send[ii];
+
+  unsigned long *haloIndex = new unsigned long[size]();
+  for (int ii=0; ii < size; ii++) haloIndex[ii] = nElem_Send[ii];
+
+  /*--- Loop through our elements and load the elems and their
+   additional data that we will send to the other procs. ---*/
+
+  for (int ii = 0; ii < (int)geometry->GetnElem(); ii++) {
+    if ((geometry->elem[ii]->GetVTK_Type() == Elem_Type) && elemInRegion(ii)) {
+      for ( int jj = 0; jj < NODES_PER_ELEMENT; jj++ ) {
+
+        /*--- Get the index of the current point. ---*/
+
+        iPoint = geometry->elem[ii]->GetNode(jj);
+        Global_Index = geometry->nodes->GetGlobalIndex(iPoint);
+
+        /*--- Search for the lowest global index in this element. ---*/
+
+        for (int kk = 0; kk < NODES_PER_ELEMENT; kk++) {
+          jPoint = geometry->elem[ii]->GetNode(kk);
+          unsigned long newID = geometry->nodes->GetGlobalIndex(jPoint);
+          if (newID < Global_Index) Global_Index = newID;
+        }
+
+        /*--- Search for the processor that owns this point. ---*/
+
+        if (val_sort) {
+          iProcessor = linearPartitioner.GetRankContainingIndex(Global_Index);
+        } else {
+          iProcessor = rank;
+        }
+
+        /*--- Load connectivity into the buffer for sending, already renumbered
+         to the region indices. ---*/
+
+        if (nElem_Flag[iProcessor] != ii) {
+
+          nElem_Flag[iProcessor] = ii;
+          unsigned long nn = index[iProcessor];
+          unsigned long mm = haloIndex[iProcessor];
+
+          /*--- Load the connectivity values. ---*/
+
+          for (int kk = 0; kk < NODES_PER_ELEMENT; kk++) {
+            iPoint = geometry->elem[ii]->GetNode(kk);
+            connSendElem[nn] = newGlobalIndex(geometry->nodes->GetGlobalIndex(iPoint)); nn++;
+
+            /*--- Check if this is a halo node, the flagged elements are removed
+             after the communication to avoid duplicates. ---*/
+
+            if (volumeSorter->GetHalo(iPoint)) haloSend[mm] = true;
+          }
+
+          /*--- Increment the index by the message length ---*/
+
+          index[iProcessor]    += NODES_PER_ELEMENT;
+          haloIndex[iProcessor]++;
+
+        }
+      }
+    }
+  }
+
+  /*--- Free memory after loading up the send buffer. ---*/
+
+  delete [] index;
+  delete [] haloIndex;
+
+  /*--- Allocate the memory that we need for receiving the conn
+   values and then cue up the non-blocking receives. ---*/
+
+  auto connRecv = new unsigned long[NODES_PER_ELEMENT*nElem_Cum[size]]();
+
+  auto haloRecv = new unsigned short[nElem_Cum[size]]();
+
+#ifdef HAVE_MPI
+
+  send_req = new SU2_MPI::Request[2*nSends];
+  recv_req = new SU2_MPI::Request[2*nRecvs];
+
+  /*--- Launch the non-blocking recv's for the connectivity. ---*/
+
+  unsigned long iMessage = 0;
+  for (int ii=0; ii<size; ii++) {
+    if ((ii != rank) && (nElem_Cum[ii+1] > nElem_Cum[ii])) {
+      int ll     = NODES_PER_ELEMENT*nElem_Cum[ii];
+      int kk     = nElem_Cum[ii+1] - nElem_Cum[ii];
+      int count  = NODES_PER_ELEMENT*kk;
+      int source = ii;
+      int tag    = ii + 1;
+      SU2_MPI::Irecv(&(connRecv[ll]), count, MPI_UNSIGNED_LONG, source, tag,
+                     SU2_MPI::GetComm(), &(recv_req[iMessage]));
+      iMessage++;
+    }
+  }
+
+  /*--- Launch the non-blocking sends of the connectivity. ---*/
+
+  iMessage = 0;
+  for (int ii=0; ii<size; ii++) {
+    if ((ii != rank) && (nElem_Send[ii+1] > nElem_Send[ii])) {
+      int ll = NODES_PER_ELEMENT*nElem_Send[ii];
+      int kk = nElem_Send[ii+1] - nElem_Send[ii];
+      int count  = NODES_PER_ELEMENT*kk;
+      int dest = ii;
+      int tag    = rank + 1;
+      SU2_MPI::Isend(&(connSendElem[ll]), count, MPI_UNSIGNED_LONG, dest, tag,
+                     SU2_MPI::GetComm(), &(send_req[iMessage]));
+      iMessage++;
+    }
+  }
+
+  /*--- Repeat the process to communicate the halo flags. ---*/
+
+  iMessage = 0;
+  for (int ii=0; ii<size; ii++) {
+    if ((ii != rank) && (nElem_Cum[ii+1] > nElem_Cum[ii])) {
+      int ll     = nElem_Cum[ii];
+      int kk     = nElem_Cum[ii+1] - nElem_Cum[ii];
+      int count  = kk;
+      int source = ii;
+      int tag    = ii + 1;
+      SU2_MPI::Irecv(&(haloRecv[ll]), count, MPI_UNSIGNED_SHORT, source, tag,
+                     SU2_MPI::GetComm(), &(recv_req[iMessage+nRecvs]));
+      iMessage++;
+    }
+  }
+
+  /*--- Launch the non-blocking sends of the halo flags. ---*/
+
+  iMessage = 0;
+  for (int ii=0; ii<size; ii++) {
+    if ((ii != rank) && (nElem_Send[ii+1] > nElem_Send[ii])) {
+      int ll = nElem_Send[ii];
+      int kk = nElem_Send[ii+1] - nElem_Send[ii];
+      int count  = kk;
+      int dest   = ii;
+      int tag    = rank + 1;
+      SU2_MPI::Isend(&(haloSend[ll]), count, MPI_UNSIGNED_SHORT, dest, tag,
+                     SU2_MPI::GetComm(), &(send_req[iMessage+nSends]));
+      iMessage++;
+    }
+  }
+#endif
+
+  /*--- Copy my own rank's data into the recv buffer directly. ---*/
+
+  int mm = NODES_PER_ELEMENT*nElem_Cum[rank];
+  int ll = NODES_PER_ELEMENT*nElem_Send[rank];
+  int kk = NODES_PER_ELEMENT*nElem_Send[rank+1];
+
+  for (int nn=ll; nn<kk; nn++, mm++) connRecv[mm] = connSendElem[nn];
+
+  mm = nElem_Cum[rank];
+  ll = nElem_Send[rank];
+  kk = nElem_Send[rank+1];
+
+  for (int nn=ll; nn<kk; nn++, mm++) haloRecv[mm] = haloSend[nn];
+
+  /*--- Wait for the non-blocking sends and recvs to complete. ---*/
+
+#ifdef HAVE_MPI
+  int number = 2*nSends;
+  for (int ii = 0; ii < number; ii++)
+    SU2_MPI::Waitany(number, send_req, &ind, &status);
+
+  number = 2*nRecvs;
+  for (int ii = 0; ii < number; ii++)
+    SU2_MPI::Waitany(number, recv_req, &ind, &status);
+
+  delete [] send_req;
+  delete [] recv_req;
+#endif
+
+  /*--- Store the connectivity for this rank in the proper data
+   structure. Note that we add 1 here to the connectivity for
+   vizualization packages. ---*/
+
+  if (nElem_Cum[size] > 0) Conn_Elem = new int[NODES_PER_ELEMENT*nElem_Cum[size]]();
+  int count = 0; nElem_Total = 0;
+  for (int ii = 0; ii < nElem_Cum[size]; ii++) {
+    if (!haloRecv[ii]) {
+      nElem_Total++;
+      for (int jj = 0; jj < NODES_PER_ELEMENT; jj++) {
+        Conn_Elem[count] = (int)connRecv[ii*NODES_PER_ELEMENT+jj] + 1;
+        count++;
+      }
+    }
+  }
+
+  nElemPerType[TypeMap.at(Elem_Type)] = nElem_Total;
+
+  /*--- Store the particular global element count in the class data,
+   and set the class data pointer to the connectivity array. ---*/
+
+  switch (Elem_Type) {
+    case TRIANGLE:
+      delete [] Conn_Tria_Par;
+      Conn_Tria_Par = Conn_Elem;
+      break;
+    case QUADRILATERAL:
+      delete [] Conn_Quad_Par;
+      Conn_Quad_Par = Conn_Elem;
+      break;
+    case TETRAHEDRON:
+      delete [] Conn_Tetr_Par;
+      Conn_Tetr_Par = Conn_Elem;
+      break;
+    case HEXAHEDRON:
+      delete [] Conn_Hexa_Par;
+      Conn_Hexa_Par = Conn_Elem;
+      break;
+    case PRISM:
+      delete [] Conn_Pris_Par;
+      Conn_Pris_Par = Conn_Elem;
+      break;
+    case PYRAMID:
+      delete [] Conn_Pyra_Par;
+      Conn_Pyra_Par = Conn_Elem;
+      break;
+    default:
+      SU2_MPI::Error("Unrecognized element type", CURRENT_FUNCTION);
+      break;
+  }
+
+  /*--- Free temporary memory from communications ---*/
+
+  delete [] connSendElem;
+  delete [] connRecv;
+  delete [] haloSend;
+  delete [] haloRecv;
+  delete [] nElem_Flag;
+
+}
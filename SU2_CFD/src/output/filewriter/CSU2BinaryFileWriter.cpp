@@ -29,8 +29,11 @@
 
 const string CSU2BinaryFileWriter::fileExt = ".dat";
 
-CSU2BinaryFileWriter::CSU2BinaryFileWriter(CParallelDataSorter *valDataSorter)  :
-  CFileWriter(valDataSorter, fileExt){}
+CSU2BinaryFileWriter::CSU2BinaryFileWriter(CParallelDataSorter *valDataSorter, bool valSinglePrec,
+                                           bool valDeltaMode, unsigned long valKeyframeFreq,
+                                           bool valDualSnapshot)  :
+  CFileWriter(valDataSorter, fileExt), singlePrec(valSinglePrec), deltaMode(valDeltaMode),
+  keyframeFreq(valKeyframeFreq), dualSnapshot(valDualSnapshot){}
 
 
 CSU2BinaryFileWriter::~CSU2BinaryFileWriter(){
@@ -58,6 +61,36 @@ void CSU2BinaryFileWriter::Write_Data(string val_filename){
   int var_buf_size = 5;
   int var_buf[5] = {535532, nVar, (int)nPoint_Global, 0, 0};
 
+  /*--- Decide whether this write is a keyframe. Keyframes are ordinary
+   full-precision snapshots, so they remain usable for restarts, while the
+   writes in between may be stored in single precision and/or as differences
+   w.r.t. the previously written step. The first write and every
+   keyframeFreq-th write are keyframes. ---*/
+
+  const bool reduced = singlePrec || deltaMode;
+  const bool keyframe = !reduced || (keyframeFreq < 2) ||
+                        (dataSorter->GetnSnapshotsWritten() % keyframeFreq == 0) ||
+                        (deltaMode && (dataSorter->GetDeltaBase() == nullptr));
+
+  /*--- Mark reduced snapshots in one of the spare header ints, so that the
+   readers can reject them with a clear message. Keyframes keep a zero there
+   and are bit-identical to the standard format. ---*/
+
+  if (!keyframe) {
+    if (singlePrec) var_buf[3] |= FLAG_SINGLE_PRECISION;
+    if (deltaMode)  var_buf[3] |= FLAG_DELTA;
+  }
+
+  /*--- In dual-snapshot mode the previously written snapshot is appended as a
+   second full-precision data block, so that an unsteady restart can read both
+   time levels from a single contiguous file. The last spare header int marks
+   the presence of the second block, keeping flag-zero files bit-identical to
+   the standard format. The first write of a calculation has no previous
+   snapshot cached and produces a plain single-block file. ---*/
+
+  const bool writePrev = dualSnapshot && !reduced && (dataSorter->GetDeltaBase() != nullptr);
+  if (writePrev) var_buf[4] = 1;
+
   /*--- Open the file using MPI I/O ---*/
 
   OpenMPIFile(val_filename);
@@ -79,14 +112,49 @@ void CSU2BinaryFileWriter::Write_Data(string val_filename){
 
   /*--- Compute various data sizes --- */
 
-  unsigned long sizeInBytesPerPoint = sizeof(passivedouble)*nVar;
+  const unsigned long sizePerEntry  = (var_buf[3] & FLAG_SINGLE_PRECISION)? sizeof(float) : sizeof(passivedouble);
+  unsigned long sizeInBytesPerPoint = sizePerEntry*nVar;
   unsigned long sizeInBytesLocal    = sizeInBytesPerPoint*nParallel_Poin;
   unsigned long sizeInBytesGlobal   = sizeInBytesPerPoint*nPoint_Global;
   unsigned long offsetInBytes       = sizeInBytesPerPoint*dataSorter->GetnPointCumulative(rank);
 
+  /*--- Prepare the data of this snapshot, delta-encoding against the
+   full-precision reference before any cast to single precision. ---*/
+
+  const unsigned long nEntries = nVar*nParallel_Poin;
+  const passivedouble* data = dataSorter->GetData();
+
+  vector<passivedouble> deltaData;
+  if (var_buf[3] & FLAG_DELTA) {
+    const passivedouble* base = dataSorter->GetDeltaBase();
+    deltaData.resize(nEntries);
+    for (unsigned long i = 0; i < nEntries; ++i) deltaData[i] = data[i] - base[i];
+    data = deltaData.data();
+  }
+
   /*--- Collectively write the actual data to file ---*/
 
-  WriteMPIBinaryDataAll(dataSorter->GetData(), sizeInBytesLocal, sizeInBytesGlobal, offsetInBytes);
+  if (var_buf[3] & FLAG_SINGLE_PRECISION) {
+    vector<float> floatData(nEntries);
+    for (unsigned long i = 0; i < nEntries; ++i) floatData[i] = static_cast<float>(data[i]);
+    WriteMPIBinaryDataAll(floatData.data(), sizeInBytesLocal, sizeInBytesGlobal, offsetInBytes);
+  }
+  else {
+    WriteMPIBinaryDataAll(data, sizeInBytesLocal, sizeInBytesGlobal, offsetInBytes);
+  }
+
+  /*--- Append the previous snapshot as a second data block. The displacement
+   advanced past the first block, so the collective write lands right after it. ---*/
+
+  if (writePrev) {
+    WriteMPIBinaryDataAll(dataSorter->GetDeltaBase(), sizeInBytesLocal, sizeInBytesGlobal, offsetInBytes);
+  }
+
+  /*--- Update the cached snapshot for the next delta/dual-snapshot write and
+   count the write for the keyframe cadence. ---*/
+
+  if (deltaMode || dualSnapshot) dataSorter->UpdateDeltaBase();
+  if (reduced) dataSorter->CountSnapshotWrite();
 
   /*--- Close the file ---*/
 
@@ -27,53 +27,82 @@
 
 #include "../../../include/output/filewriter/CSU2FileWriter.hpp"
 
+#ifdef HAVE_ZLIB
+#include <zlib.h>
+#endif
+
+#include <sstream>
+
 const string CSU2FileWriter::fileExt = ".csv";
 
-CSU2FileWriter::CSU2FileWriter(CParallelDataSorter *valDataSorter) :
-  CFileWriter(valDataSorter, fileExt){}
+CSU2FileWriter::CSU2FileWriter(CParallelDataSorter *valDataSorter, bool valCompressed) :
+  CFileWriter(valDataSorter, valCompressed ? fileExt + ".gz" : fileExt), compressed(valCompressed){
+
+#ifndef HAVE_ZLIB
+  if (compressed)
+    SU2_MPI::Error("SU2 was not compiled with zlib support (-Denable-zlib=true), "
+                   "compressed CSV output is not available.", CURRENT_FUNCTION);
+#endif
+}
 
 void CSU2FileWriter::Write_Data(string val_filename){
 
-  ofstream restart_file;
   const vector<string> fieldNames = dataSorter->GetFieldNames();
   /*--- We append the pre-defined suffix (extension) to the filename (prefix) ---*/
   val_filename.append(fileExt);
+  if (compressed) val_filename.append(".gz");
 
   /*--- Set a timer for the file writing. ---*/
 
   startTime = SU2_MPI::Wtime();
 
+  /*--- Format the local rows into a single in-memory buffer, so that every rank
+   issues one large (optionally compressed) write instead of streaming many small
+   chunks through the filesystem. ---*/
+
+  stringstream buffer;
+  buffer.precision(15);
+
   /*--- Only the FIRST node writes the header (it does not matter if that is the master). ---*/
 
   if (rank == 0) {
-    restart_file.open(val_filename);
-    restart_file << "\"PointID\"";
-    for (auto& field : fieldNames) restart_file << ",\"" << field << "\"";
-    restart_file << "\n";
-    restart_file.close();
+    buffer << "\"PointID\"";
+    for (auto& field : fieldNames) buffer << ",\"" << field << "\"";
+    buffer << "\n";
   }
 
-  /*--- Serialize the writes to the restart file. ---*/
+  for (auto iPoint = 0ul; iPoint < dataSorter->GetnPoints(); iPoint++) {
 
-  for (int iProcessor = 0; iProcessor < size; iProcessor++) {
-    if (rank == iProcessor) {
-      restart_file.open(val_filename, ios::app);
-      restart_file.precision(15);
+    /*--- Write global index of the current point. ---*/
 
-      for (auto iPoint = 0ul; iPoint < dataSorter->GetnPoints(); iPoint++) {
+    buffer << dataSorter->GetGlobalIndex(iPoint);
 
-        /*--- Write global index of the current point. ---*/
+    /*--- Loop over the variables and write the values to file. ---*/
 
-        restart_file << dataSorter->GetGlobalIndex(iPoint);
+    for (size_t iVar = 0; iVar < fieldNames.size(); iVar++)
+      buffer << ", " << scientific << dataSorter->GetData(iVar, iPoint);
+    buffer << "\n";
+  }
 
-        /*--- Loop over the variables and write the values to file. ---*/
+  const string localData = buffer.str();
 
-        for (size_t iVar = 0; iVar < fieldNames.size(); iVar++)
-          restart_file << ", " << scientific << dataSorter->GetData(iVar, iPoint);
-        restart_file << "\n";
-      }
+  /*--- Serialize the writes to the file. Each rank appends one gzip member when
+   compression is active, the concatenation is a valid gzip stream. ---*/
 
-      restart_file.close();
+  for (int iProcessor = 0; iProcessor < size; iProcessor++) {
+    if ((rank == iProcessor) && !localData.empty()) {
+      if (compressed) {
+#ifdef HAVE_ZLIB
+        gzFile zFile = gzopen(val_filename.c_str(), (rank == 0) ? "wb" : "ab");
+        gzwrite(zFile, localData.data(), static_cast<unsigned>(localData.size()));
+        gzclose(zFile);
+#endif
+      }
+      else {
+        ofstream restart_file(val_filename, (rank == 0) ? ios::out : ios::app);
+        restart_file.write(localData.data(), localData.size());
+        restart_file.close();
+      }
     }
 
     /*--- Wait for iProcessor to finish and close the file. ---*/
@@ -0,0 +1,133 @@
+/*!
+ * \file CSU2HighOrderFileWriter.cpp
+ * \brief Filewriter class for the SU2 high-order (element-collocated) restart format.
+ * \version 7.3.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2022, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../../include/output/filewriter/CSU2HighOrderFileWriter.hpp"
+
+const string CSU2HighOrderFileWriter::fileExt = ".hdat";
+
+CSU2HighOrderFileWriter::CSU2HighOrderFileWriter(CParallelDataSorter *valDataSorter) :
+  CFileWriter(valDataSorter, fileExt){}
+
+void CSU2HighOrderFileWriter::Write_Data(string val_filename){
+
+  /*--- Local variables ---*/
+
+  unsigned short iVar;
+
+  const vector<string>& fieldNames = dataSorter->GetFieldNames();
+  const unsigned short nVar = fieldNames.size();
+  const unsigned short nDim = dataSorter->GetnDim();
+  const unsigned long nParallel_Poin = dataSorter->GetnPoints();
+  const unsigned long nPoint_Global = dataSorter->GetnPointsGlobal();
+
+  char str_buf[CGNS_STRING_SIZE];
+
+  /*--- The element records are only provided by the FEM data sorters. ---*/
+
+  const vector<unsigned long>* elemInfo = dataSorter->GetHighOrderElemInfo();
+
+  if (elemInfo == nullptr)
+    SU2_MPI::Error("The high-order restart format is only available for the FEM DG solver.",
+                   CURRENT_FUNCTION);
+
+  /*--- The coordinate columns (the first nDim fields) are not stored, they
+   are implied by the mesh and the collocation points of the standard
+   elements. ---*/
+
+  const unsigned short nVarData = nVar - nDim;
+
+  /*--- Determine the global element count and the offset of this rank's
+   slice of the element table, the records are simply concatenated in rank
+   order since every record carries its global DOF offset. ---*/
+
+  const unsigned long nRecordVals = 4;
+  unsigned long nElemLocal = elemInfo->size()/nRecordVals;
+
+  vector<unsigned long> nElemAllRanks(size);
+  SU2_MPI::Allgather(&nElemLocal, 1, MPI_UNSIGNED_LONG, nElemAllRanks.data(), 1,
+                     MPI_UNSIGNED_LONG, SU2_MPI::GetComm());
+
+  unsigned long nElem_Global = 0, elemOffset = 0;
+  for (int iRank = 0; iRank < size; iRank++) {
+    if (iRank < rank) elemOffset += nElemAllRanks[iRank];
+    nElem_Global += nElemAllRanks[iRank];
+  }
+
+  /*--- Prepare the first ints containing the counts. The magic number
+   distinguishes the high-order restart from the standard binary restart.
+   The remaining values are the number of data fields (without coordinates),
+   the number of solution DOFs, the number of elements, and the spatial
+   dimension. ---*/
+
+  int var_buf_size = 5;
+  int var_buf[5] = {fileMagic, nVarData, (int)nPoint_Global, (int)nElem_Global, nDim};
+
+  /*--- Open the file using MPI I/O ---*/
+
+  OpenMPIFile(val_filename);
+
+  /*--- Only the master rank writes the header and the names of the data
+   fields, the coordinate names are not stored. ---*/
+
+  WriteMPIBinaryData(var_buf, var_buf_size*sizeof(int), MASTER_NODE);
+
+  for (iVar = nDim; iVar < nVar; iVar++) {
+    strncpy(str_buf, fieldNames[iVar].c_str(), CGNS_STRING_SIZE);
+    WriteMPIBinaryData(str_buf, CGNS_STRING_SIZE*sizeof(char), MASTER_NODE);
+  }
+
+  /*--- Collectively write the element table. ---*/
+
+  const unsigned long sizePerRecord = nRecordVals*sizeof(unsigned long);
+
+  WriteMPIBinaryDataAll(elemInfo->data(), sizePerRecord*nElemLocal,
+                        sizePerRecord*nElem_Global, sizePerRecord*elemOffset);
+
+  /*--- Compute various data sizes --- */
+
+  unsigned long sizeInBytesPerPoint = sizeof(passivedouble)*nVarData;
+  unsigned long sizeInBytesLocal    = sizeInBytesPerPoint*nParallel_Poin;
+  unsigned long sizeInBytesGlobal   = sizeInBytesPerPoint*nPoint_Global;
+  unsigned long offsetInBytes       = sizeInBytesPerPoint*dataSorter->GetnPointCumulative(rank);
+
+  /*--- Repack the sorted DOF data without the coordinate columns. ---*/
+
+  vector<passivedouble> buf(nVarData*nParallel_Poin);
+
+  for (unsigned long iPoint = 0; iPoint < nParallel_Poin; iPoint++) {
+    for (iVar = 0; iVar < nVarData; iVar++)
+      buf[iPoint*nVarData + iVar] = dataSorter->GetData(iVar+nDim, iPoint);
+  }
+
+  /*--- Collectively write the actual data to file ---*/
+
+  WriteMPIBinaryDataAll(buf.data(), sizeInBytesLocal, sizeInBytesGlobal, offsetInBytes);
+
+  /*--- Close the file ---*/
+
+  CloseMPIFile();
+
+}
@@ -0,0 +1,103 @@
+/*!
+ * \file CSU2SurfaceRestartFileWriter.cpp
+ * \brief Filewriter class for the SU2 surface (sparse) restart format.
+ * \version 7.3.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2022, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../../include/output/filewriter/CSU2SurfaceRestartFileWriter.hpp"
+
+const string CSU2SurfaceRestartFileWriter::fileExt = ".sdat";
+
+CSU2SurfaceRestartFileWriter::CSU2SurfaceRestartFileWriter(CParallelDataSorter *valDataSorter) :
+  CFileWriter(valDataSorter, fileExt){}
+
+void CSU2SurfaceRestartFileWriter::Write_Data(string val_filename){
+
+  /*--- Local variables ---*/
+
+  unsigned short iVar;
+
+  const vector<string>& fieldNames = dataSorter->GetFieldNames();
+  const unsigned short nVar = fieldNames.size();
+  const unsigned long nParallel_Poin = dataSorter->GetnPoints();
+  const unsigned long nPoint_Global = dataSorter->GetnPointsGlobal();
+
+  char str_buf[CGNS_STRING_SIZE];
+
+  /*--- The records carry the global point index as their first column, so
+   the file has one column more than the sorter has fields. ---*/
+
+  const unsigned short nCols = nVar+1;
+
+  /*--- Prepare the first ints containing the counts. The magic number
+   distinguishes the sparse surface restart from the standard (full volume)
+   binary restart. The second two values are number of columns (including
+   the point index) and number of surface points. ---*/
+
+  int var_buf_size = 5;
+  int var_buf[5] = {fileMagic, nCols, (int)nPoint_Global, 0, 0};
+
+  /*--- Open the file using MPI I/O ---*/
+
+  OpenMPIFile(val_filename);
+
+  /*--- Only the master rank writes the header, the point index column is
+   named like in the ASCII restart. ---*/
+
+  WriteMPIBinaryData(var_buf, var_buf_size*sizeof(int), MASTER_NODE);
+
+  strncpy(str_buf, "Point_ID", CGNS_STRING_SIZE);
+  WriteMPIBinaryData(str_buf, CGNS_STRING_SIZE*sizeof(char), MASTER_NODE);
+
+  for (iVar = 0; iVar < nVar; iVar++) {
+    strncpy(str_buf, fieldNames[iVar].c_str(), CGNS_STRING_SIZE);
+    WriteMPIBinaryData(str_buf, CGNS_STRING_SIZE*sizeof(char), MASTER_NODE);
+  }
+
+  /*--- Compute various data sizes --- */
+
+  unsigned long sizeInBytesPerPoint = sizeof(passivedouble)*nCols;
+  unsigned long sizeInBytesLocal    = sizeInBytesPerPoint*nParallel_Poin;
+  unsigned long sizeInBytesGlobal   = sizeInBytesPerPoint*nPoint_Global;
+  unsigned long offsetInBytes       = sizeInBytesPerPoint*dataSorter->GetnPointCumulative(rank);
+
+  /*--- Assemble the records, the global volume point index is stored as a
+   passivedouble so that the data section stays homogeneous. ---*/
+
+  vector<passivedouble> buf(nCols*nParallel_Poin);
+
+  for (unsigned long iPoint = 0; iPoint < nParallel_Poin; iPoint++) {
+    buf[iPoint*nCols] = passivedouble(dataSorter->GetGlobalIndex(iPoint));
+    for (iVar = 0; iVar < nVar; iVar++)
+      buf[iPoint*nCols + iVar+1] = dataSorter->GetData(iVar, iPoint);
+  }
+
+  /*--- Collectively write the actual data to file ---*/
+
+  WriteMPIBinaryDataAll(buf.data(), sizeInBytesLocal, sizeInBytesGlobal, offsetInBytes);
+
+  /*--- Close the file ---*/
+
+  CloseMPIFile();
+
+}
@@ -0,0 +1,120 @@
+/*!
+ * \file CSU2TimeSeriesFileWriter.cpp
+ * \brief Filewriter class for an appendable binary time series format.
+ * \version 7.3.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2022, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../../include/output/filewriter/CSU2TimeSeriesFileWriter.hpp"
+
+const string CSU2TimeSeriesFileWriter::fileExt = ".tdat";
+
+CSU2TimeSeriesFileWriter::CSU2TimeSeriesFileWriter(CParallelDataSorter *valDataSorter,
+                                                   unsigned long valTimeIter, passivedouble valTime) :
+  CFileWriter(valDataSorter, fileExt), timeIter(valTimeIter), curTime(valTime){}
+
+
+CSU2TimeSeriesFileWriter::~CSU2TimeSeriesFileWriter(){
+
+}
+
+void CSU2TimeSeriesFileWriter::Write_Data(string val_filename){
+
+  /*--- Local variables ---*/
+
+  unsigned short iVar;
+
+  const vector<string>& fieldNames = dataSorter->GetFieldNames();
+  unsigned short nVar = fieldNames.size();
+  unsigned long nParallel_Poin = dataSorter->GetnPoints();
+  unsigned long nPoint_Global = dataSorter->GetnPointsGlobal();
+
+  char str_buf[CGNS_STRING_SIZE];
+
+  /*--- Fixed layout of the growing file: one header when the file is
+   created, then one fixed-size record appended per write. This way a reader
+   can seek to any record knowing only the header. ---*/
+
+  const unsigned long headerSize = 5*sizeof(int) + nVar*CGNS_STRING_SIZE*sizeof(char);
+  const unsigned long recordSize = 2*sizeof(passivedouble) +
+                                   nVar*nPoint_Global*sizeof(passivedouble);
+
+  /*--- Open the file using MPI I/O in append mode, an existing file from the
+   previous writes (or from the run we restarted from) is continued. ---*/
+
+  unsigned long existingSize = 0;
+  OpenMPIFileAppend(val_filename, existingSize);
+
+  if (existingSize == 0) {
+
+    /*--- New file, write the header. The magic number is the one of the SU2
+     binary restart format plus one, so that neither reader mistakes the
+     files for one another. ---*/
+
+    int var_buf[5] = {535533, nVar, (int)nPoint_Global, 0, 0};
+
+    WriteMPIBinaryData(var_buf, 5*sizeof(int), MASTER_NODE);
+
+    /*--- Write the variable names to the file. Note that we are adopting a
+     fixed length of 33 for the string length to match with CGNS. ---*/
+
+    for (iVar = 0; iVar < nVar; iVar++) {
+      strncpy(str_buf, fieldNames[iVar].c_str(), CGNS_STRING_SIZE);
+      WriteMPIBinaryData(str_buf, CGNS_STRING_SIZE*sizeof(char), MASTER_NODE);
+    }
+
+  }
+  else if ((existingSize < headerSize) || ((existingSize - headerSize) % recordSize != 0)) {
+
+    /*--- The existing file does not consist of whole records of the current
+     layout, appending to it would produce an unreadable file. This happens
+     e.g. when the output fields or the surface changed w.r.t. the run that
+     created the file. ---*/
+
+    SU2_MPI::Error(string("Existing time series file ") + val_filename + fileExt +
+                   string(" does not match the current output layout,\n") +
+                   string("delete or move it to start a new time series."), CURRENT_FUNCTION);
+  }
+
+  /*--- Fixed-size record header: the physical time and the time iteration,
+   both stored as doubles to keep the record layout homogeneous. ---*/
+
+  passivedouble recHeader[2] = {curTime, passivedouble(timeIter)};
+
+  WriteMPIBinaryData(recHeader, 2*sizeof(passivedouble), MASTER_NODE);
+
+  /*--- Compute various data sizes --- */
+
+  unsigned long sizeInBytesPerPoint = sizeof(passivedouble)*nVar;
+  unsigned long sizeInBytesLocal    = sizeInBytesPerPoint*nParallel_Poin;
+  unsigned long sizeInBytesGlobal   = sizeInBytesPerPoint*nPoint_Global;
+  unsigned long offsetInBytes       = sizeInBytesPerPoint*dataSorter->GetnPointCumulative(rank);
+
+  /*--- Collectively append the actual data of this write ---*/
+
+  WriteMPIBinaryDataAll(dataSorter->GetData(), sizeInBytesLocal, sizeInBytesGlobal, offsetInBytes);
+
+  /*--- Close the file ---*/
+
+  CloseMPIFile();
+
+}
@@ -68,6 +68,11 @@ CSurfaceFEMDataSorter::CSurfaceFEMDataSorter(CConfig *config, CGeometry *geometr
 
 void CSurfaceFEMDataSorter::SortOutputData() {
 
+  /*--- The volume redistribution may still be in flight (overlapped with the
+   connectivity sort), it has to land before the sorted data is read. ---*/
+
+  volumeSorter->CompleteSortOutputData();
+
   if (!connectivitySorted){
     SU2_MPI::Error("Connectivity must be sorted before sorting output data", CURRENT_FUNCTION);
   }
@@ -49,6 +49,11 @@ CSurfaceFVMDataSorter::CSurfaceFVMDataSorter(CConfig *config, CGeometry *geometr
 
 void CSurfaceFVMDataSorter::SortOutputData() {
 
+  /*--- The volume redistribution may still be in flight (overlapped with the
+   connectivity sort), it has to land before the sorted data is read. ---*/
+
+  volumeSorter->CompleteSortOutputData();
+
   unsigned long iProcessor;
   unsigned long iPoint, iElem;
   unsigned long Global_Index;
@@ -63,6 +68,24 @@ void CSurfaceFVMDataSorter::SortOutputData() {
   int ind;
 #endif
 
+  /*--- If the maps of a previous sort are still valid (static mesh, see
+   SortConnectivity), only the data itself has to be refreshed. Gather it
+   from the sorted volume data through the cached vertex map, the stored
+   connectivity already carries the surface renumbering. ---*/
+
+  if (surfaceMapsCached) {
+
+    if (dataBuffer == nullptr) dataBuffer = new passivedouble[nPoints*VARS_PER_POINT];
+
+    for (int jj = 0; jj < VARS_PER_POINT; jj++) {
+      for (unsigned long ii = 0; ii < nPoints; ii++) {
+        dataBuffer[ii*VARS_PER_POINT + jj] = volumeSorter->GetData(jj, surfIndex[ii]);
+      }
+    }
+
+    return;
+  }
+
   const unsigned long nElemLine = GetnElem(LINE);
   const unsigned long nElemTria = GetnElem(TRIANGLE);
   const unsigned long nElemQuad = GetnElem(QUADRILATERAL);
@@ -393,6 +416,7 @@ void CSurfaceFVMDataSorter::SortOutputData() {
 
   nPoints = 0;
   Renumber2Global.clear();
+  surfIndex.clear();
 
   for (iPoint = 0; iPoint < volumeSorter->GetnPoints(); iPoint++) {
     if (surfPoint[iPoint] != -1) {
@@ -401,6 +425,12 @@ void CSurfaceFVMDataSorter::SortOutputData() {
 
       Renumber2Global[nPoints] = surfPoint[iPoint];
 
+      /*--- Remember where in the sorted volume data the surface points live,
+       so that repeated sorts on a static mesh can skip straight to the
+       data gather. ---*/
+
+      surfIndex.push_back(iPoint);
+
       /*--- Increment total number of surface points found locally. ---*/
 
       nPoints++;
@@ -1065,6 +1095,12 @@ void CSurfaceFVMDataSorter::SortOutputData() {
   delete [] nElem_Flag;
   delete [] Local_Halo;
 
+  /*--- Everything above only depends on the connectivity and the linear
+   partitioning, not on the data, so the resulting maps can be re-used by
+   the next sort as long as the connectivity does not change. ---*/
+
+  surfaceMapsCached = true;
+
 }
 
 void CSurfaceFVMDataSorter::SortConnectivity(CConfig *config, CGeometry *geometry, bool val_sort) {
@@ -1085,6 +1121,16 @@ void CSurfaceFVMDataSorter::SortConnectivity(CConfig *config, CGeometry *geometr
 
 void CSurfaceFVMDataSorter::SortConnectivity(CConfig *config, CGeometry *geometry, const vector<string> &markerList) {
 
+  /*--- On static meshes the surface connectivity, and with it the global
+   renumbering and communication schedule that SortOutputData derives from
+   it, do not change between output calls. Keep both as long as the same
+   markers are requested, SortOutputData then only re-gathers the data. ---*/
+
+  if (surfaceMapsCached && !config->GetDynamic_Grid() && (markerList == cachedMarkerList)) return;
+
+  surfaceMapsCached = false;
+  cachedMarkerList = markerList;
+
   /*--- Sort connectivity for each type of element (excluding halos). Note
    In these routines, we sort the connectivity into a linear partitioning
    across all processors based on the global index of the grid nodes. ---*/
@@ -29,13 +29,47 @@
 #ifdef HAVE_TECIO
   #include "TECIO.h"
 #endif
+#include <map>
 #include <set>
 
 const string CTecplotBinaryFileWriter::fileExt = ".szplt";
 
+#ifdef HAVE_TECIO
+namespace {
+
+/*--- Grid files of the shared-grid (grid + solution) output, by file name. Each one is
+      written once, and its handle is kept open for the rest of the run so that the
+      solution-only files of the following snapshots can reference its zones. ---*/
+
+struct SharedGridFile {
+  void* handle = nullptr;
+  int64_t num_nodes = 0;
+  int64_t num_cells = 0;
+};
+
+map<string, SharedGridFile> sharedGridFiles;
+
+/*--- Strip the time-iteration suffix of the solution file name so that every snapshot
+      of a time series maps to the same grid file. ---*/
+
+string SharedGridFilename(const string& val_filename) {
+  string base = val_filename.substr(0, val_filename.size() - CTecplotBinaryFileWriter::fileExt.size());
+  const size_t pos = base.find_last_of('_');
+  if (pos != string::npos && pos + 1 < base.size() &&
+      base.find_first_not_of("0123456789", pos + 1) == string::npos) {
+    base.erase(pos);
+  }
+  return base + "_grid" + CTecplotBinaryFileWriter::fileExt;
+}
+
+}
+#endif
+
 CTecplotBinaryFileWriter::CTecplotBinaryFileWriter(CParallelDataSorter *valDataSorter,
-                                                   unsigned long valTimeIter, su2double valTimeStep) :
-  CFileWriter(valDataSorter, fileExt), timeIter(valTimeIter), timeStep(valTimeStep){}
+                                                   unsigned long valTimeIter, su2double valTimeStep,
+                                                   bool valSharedGrid) :
+  CFileWriter(valDataSorter, fileExt), timeIter(valTimeIter), timeStep(valTimeStep),
+  sharedGrid(valSharedGrid){}
 
 CTecplotBinaryFileWriter::~CTecplotBinaryFileWriter(){}
 
@@ -75,22 +109,6 @@ void CTecplotBinaryFileWriter::Write_Data(string val_filename){
 
   string data_set_title = "Visualization of the solution";
 
-  ostringstream tecplot_variable_names;
-  for (size_t iVar = 0; iVar < fieldNames.size()-1; ++iVar) {
-    tecplot_variable_names << fieldNames[iVar] << ",";
-  }
-  tecplot_variable_names << fieldNames[fieldNames.size()-1];
-
-  void* file_handle = NULL;
-  int32_t err = tecFileWriterOpen(val_filename.c_str(), data_set_title.c_str(), tecplot_variable_names.str().c_str(),
-    FILEFORMAT_SZL, FILETYPE_FULL, (int32_t)FieldDataType_Double, NULL, &file_handle);
-  if (err) cout << "Error opening Tecplot file '" << val_filename << "'" << endl;
-
-#ifdef HAVE_MPI
-  err = tecMPIInitialize(file_handle, SU2_MPI::GetComm(), MASTER_NODE);
-  if (err) cout << "Error initializing Tecplot parallel output." << endl;
-#endif
-
   /*--- Define the zone(s). For 2D, and for 3D surfaces, each rank outputs a separate zone. ---*/
 
   int64_t num_nodes;
@@ -126,15 +144,36 @@ void CTecplotBinaryFileWriter::Write_Data(string val_filename){
     solution_time = SU2_TYPE::GetValue(timeStep)*timeIter;
   }
 
-  int32_t zone;
-  vector<int32_t> value_locations(fieldNames.size(), 1); /* Nodal variables. */
-  err = tecZoneCreateFE(file_handle, "Zone", zone_type, num_nodes, num_cells, NULL, NULL, &value_locations[0], NULL, 0, 0, 0, &zone);
-  if (err) cout << rank << ": Error creating Tecplot zone." << endl;
-  if (is_unsteady) {
-    err = tecZoneSetUnsteadyOptions(file_handle, zone, solution_time, timeIter + 1);
-    if (err) cout << rank << ": Error setting Tecplot zone unsteady options." << std::endl;
+  /*--- For shared-grid output the coordinates and the connectivity go to a grid file
+        that is written once and kept open for the run, while the file of this snapshot
+        only receives the remaining variables. Fall back to a self-contained file
+        whenever the cached grid file does not match the current zone, e.g. after the
+        mesh was adapted between snapshots. ---*/
+
+  const unsigned short nDim = dataSorter->GetnDim();
+  bool shared_grid = sharedGrid && (fieldNames.size() > nDim);
+  bool write_grid = true;
+  void* grid_handle = NULL;
+  string grid_filename;
+
+  if (shared_grid) {
+    grid_filename = SharedGridFilename(val_filename);
+    auto cached = sharedGridFiles.find(grid_filename);
+    if (cached != sharedGridFiles.end()) {
+      if (cached->second.num_nodes == num_nodes && cached->second.num_cells == num_cells) {
+        grid_handle = cached->second.handle;
+        write_grid = false;
+      }
+      else {
+        shared_grid = false;
+      }
+    }
   }
 
+  const unsigned short firstVar = shared_grid ? nDim : 0;
+
+  int32_t err = 0;
+
 #ifdef HAVE_MPI
 
   unsigned long nParallel_Line = dataSorter->GetnElem(LINE);
@@ -147,15 +186,14 @@ void CTecplotBinaryFileWriter::Write_Data(string val_filename){
   vector<int> num_nodes_to_receive(size, 0);
   vector<int> values_to_receive_displacements(size);
 
-  if (zone_type == ZONETYPE_FEBRICK) {
+  int64_t partition_num_nodes = 0;
+  int64_t partition_num_cells = 0;
+  size_t num_halo_nodes = 0;
+  vector<int64_t> halo_node_local_numbers;
+  vector<int32_t> neighbor_partitions;
+  vector<int64_t> neighbor_nodes;
 
-    /* We output a single, partitioned zone where each rank outputs one partition. */
-    vector<int32_t> partition_owners;
-    partition_owners.reserve(size);
-    for (int32_t iRank = 0; iRank < size; ++iRank)
-      partition_owners.push_back(iRank);
-    err = tecZoneMapPartitionsToMPIRanks(file_handle, zone, size, &partition_owners[0]);
-    if (err) cout << rank << ": Error assigning MPI ranks for Tecplot zone partitions." << endl;
+  if (zone_type == ZONETYPE_FEBRICK) {
 
     /* Gather a list of nodes we refer to but are not outputting. */
 
@@ -193,15 +231,15 @@ void CTecplotBinaryFileWriter::Write_Data(string val_filename){
     sorted_halo_nodes.assign(halo_nodes.begin(), halo_nodes.end());
 
     /* Have to include all nodes our cells refer to or TecIO will barf, so add the halo node count to the number of local nodes. */
-    int64_t partition_num_nodes = dataSorter->GetNodeEnd(rank) - dataSorter->GetNodeBegin(rank) + static_cast<int64_t>(halo_nodes.size());
-    int64_t partition_num_cells = nParallel_Tetr + nParallel_Hexa + nParallel_Pris + nParallel_Pyra;
+    partition_num_nodes = dataSorter->GetNodeEnd(rank) - dataSorter->GetNodeBegin(rank) + static_cast<int64_t>(halo_nodes.size());
+    partition_num_cells = nParallel_Tetr + nParallel_Hexa + nParallel_Pris + nParallel_Pyra;
 
     /*--- We effectively tack the halo nodes onto the end of the node list for this partition.
       TecIO will later replace them with references to nodes in neighboring partitions. */
-    size_t num_halo_nodes = sorted_halo_nodes.size();
-    vector<int64_t> halo_node_local_numbers(max((size_t)1, num_halo_nodes)); /* Min size 1 to avoid crashes when we access these vectors below. */
-    vector<int32_t> neighbor_partitions(max((size_t)1, num_halo_nodes));
-    vector<int64_t> neighbor_nodes(max((size_t)1, num_halo_nodes));
+    num_halo_nodes = sorted_halo_nodes.size();
+    halo_node_local_numbers.resize(max((size_t)1, num_halo_nodes)); /* Min size 1 to avoid crashes when we access these vectors below. */
+    neighbor_partitions.resize(max((size_t)1, num_halo_nodes));
+    neighbor_nodes.resize(max((size_t)1, num_halo_nodes));
     for(int64_t i = 0; i < static_cast<int64_t>(num_halo_nodes); ++i) {
       halo_node_local_numbers[i] = dataSorter->GetNodeEnd(rank) - dataSorter->GetNodeBegin(rank) + i + 1;
       int owning_rank;
@@ -210,9 +248,6 @@ void CTecplotBinaryFileWriter::Write_Data(string val_filename){
       neighbor_partitions[i] = owning_rank + 1; /* Partition numbers are 1-based. */
       neighbor_nodes[i] = static_cast<int64_t>(node_number);
     }
-    err = tecFEPartitionCreate64(file_handle, zone, rank + 1, partition_num_nodes, partition_num_cells,
-      static_cast<int64_t>(num_halo_nodes), &halo_node_local_numbers[0], &neighbor_partitions[0], &neighbor_nodes[0], 0, NULL);
-    if (err) cout << rank << ": Error creating Tecplot zone partition." << endl;
 
     /* Gather halo node data. First, tell each rank how many nodes' worth of data we need from them. */
     for (size_t i = 0; i < num_halo_nodes; ++i)
@@ -266,320 +301,409 @@ void CTecplotBinaryFileWriter::Write_Data(string val_filename){
                        &halo_var_data[0], &num_values_to_receive[0], &values_to_receive_displacements[0], MPI_DOUBLE,
                        SU2_MPI::GetComm());
   }
-  else {
-    /* Zone will be gathered to and output by MASTER_NODE */
-    int32_t partition_owner = MASTER_NODE;
-    err = tecZoneMapPartitionsToMPIRanks(file_handle, zone, 1, &partition_owner);
-  }
 
-  /*--- Write surface and volumetric solution data. ---*/
+#endif /* HAVE_MPI */
+
+  /*--- The remainder is parameterized over the output file, so that the grid file (when
+        it is first written) and the per-snapshot file receive the same zone layout. ---*/
 
-  if (zone_type == ZONETYPE_FEBRICK) {
-    std::vector<passivedouble> values_to_write(dataSorter->GetnPoints());
-    for (iVar = 0; err == 0 && iVar < fieldNames.size(); iVar++) {
-      for(unsigned long i = 0; i < dataSorter->GetnPoints(); ++i)
-        values_to_write[i] = dataSorter->GetData(iVar, i);
-      err = tecZoneVarWriteDoubleValues(file_handle, zone, iVar + 1, rank + 1, dataSorter->GetnPoints(), &values_to_write[0]);
-      if (err) cout << rank << ": Error outputting Tecplot variable values." << endl;
-      for (int iRank = 0; err == 0 && iRank < size; ++iRank) {
-        if (num_nodes_to_receive[iRank] > 0) {
-          int var_data_offset = values_to_receive_displacements[iRank] + num_nodes_to_receive[iRank] * iVar;
-          err = tecZoneVarWriteDoubleValues(file_handle, zone, iVar + 1, rank + 1, static_cast<int64_t>(num_nodes_to_receive[iRank]), &halo_var_data[var_data_offset]);
-          if (err) cout << rank << ": Error outputting Tecplot halo values." << endl;
+  /*--- Open an output file holding the given range of the field variables. ---*/
+
+  auto open_file = [&](const string& filename, int32_t file_type,
+                       unsigned short varBegin, unsigned short varEnd,
+                       void* grid, void** handle) {
+    ostringstream tecplot_variable_names;
+    for (unsigned short jVar = varBegin; jVar < varEnd; ++jVar) {
+      if (jVar > varBegin) tecplot_variable_names << ",";
+      tecplot_variable_names << fieldNames[jVar];
+    }
+    err = tecFileWriterOpen(filename.c_str(), data_set_title.c_str(), tecplot_variable_names.str().c_str(),
+      FILEFORMAT_SZL, file_type, (int32_t)FieldDataType_Double, grid, handle);
+    if (err) cout << "Error opening Tecplot file '" << filename << "'" << endl;
+
+#ifdef HAVE_MPI
+    err = tecMPIInitialize(*handle, SU2_MPI::GetComm(), MASTER_NODE);
+    if (err) cout << "Error initializing Tecplot parallel output." << endl;
+#endif
+  };
+
+  /*--- Create the zone in a given file and, in parallel, assign its partitions to the MPI ranks. ---*/
+
+  auto create_zone = [&](void* handle, unsigned short varBegin, unsigned short varEnd, bool solution_zone) {
+    int32_t zone = 0;
+    vector<int32_t> value_locations(varEnd - varBegin, 1); /* Nodal variables. */
+    err = tecZoneCreateFE(handle, "Zone", zone_type, num_nodes, num_cells, NULL, NULL, &value_locations[0], NULL, 0, 0, 0, &zone);
+    if (err) cout << rank << ": Error creating Tecplot zone." << endl;
+    if (is_unsteady && solution_zone) {
+      /* The snapshots of a shared-grid series are linked to the grid zone through a common strand. */
+      int32_t strand_id = shared_grid ? 1 : static_cast<int32_t>(timeIter + 1);
+      err = tecZoneSetUnsteadyOptions(handle, zone, solution_time, strand_id);
+      if (err) cout << rank << ": Error setting Tecplot zone unsteady options." << std::endl;
+    }
+
+#ifdef HAVE_MPI
+    if (zone_type == ZONETYPE_FEBRICK) {
+
+      /* We output a single, partitioned zone where each rank outputs one partition. */
+      vector<int32_t> partition_owners;
+      partition_owners.reserve(size);
+      for (int32_t iRank = 0; iRank < size; ++iRank)
+        partition_owners.push_back(iRank);
+      err = tecZoneMapPartitionsToMPIRanks(handle, zone, size, &partition_owners[0]);
+      if (err) cout << rank << ": Error assigning MPI ranks for Tecplot zone partitions." << endl;
+
+      err = tecFEPartitionCreate64(handle, zone, rank + 1, partition_num_nodes, partition_num_cells,
+        static_cast<int64_t>(num_halo_nodes), &halo_node_local_numbers[0], &neighbor_partitions[0], &neighbor_nodes[0], 0, NULL);
+      if (err) cout << rank << ": Error creating Tecplot zone partition." << endl;
+    }
+    else {
+      /* Zone will be gathered to and output by MASTER_NODE */
+      int32_t partition_owner = MASTER_NODE;
+      err = tecZoneMapPartitionsToMPIRanks(handle, zone, 1, &partition_owner);
+    }
+#endif
+
+    return zone;
+  };
+
+  /*--- Write surface and volumetric solution data, remapping the field range to the
+        one-based variable numbers of the target file. ---*/
+
+  auto write_vars = [&](void* handle, int32_t zone, unsigned short varBegin, unsigned short varEnd) {
+
+#ifdef HAVE_MPI
+    if (zone_type == ZONETYPE_FEBRICK) {
+      std::vector<passivedouble> values_to_write(dataSorter->GetnPoints());
+      for (unsigned short jVar = varBegin; err == 0 && jVar < varEnd; jVar++) {
+        for(unsigned long i = 0; i < dataSorter->GetnPoints(); ++i)
+          values_to_write[i] = dataSorter->GetData(jVar, i);
+        err = tecZoneVarWriteDoubleValues(handle, zone, jVar - varBegin + 1, rank + 1, dataSorter->GetnPoints(), &values_to_write[0]);
+        if (err) cout << rank << ": Error outputting Tecplot variable values." << endl;
+        for (int iRank = 0; err == 0 && iRank < size; ++iRank) {
+          if (num_nodes_to_receive[iRank] > 0) {
+            int var_data_offset = values_to_receive_displacements[iRank] + num_nodes_to_receive[iRank] * jVar;
+            err = tecZoneVarWriteDoubleValues(handle, zone, jVar - varBegin + 1, rank + 1, static_cast<int64_t>(num_nodes_to_receive[iRank]), &halo_var_data[var_data_offset]);
+            if (err) cout << rank << ": Error outputting Tecplot halo values." << endl;
+          }
         }
       }
-    }
-  } else {
-    if (rank == MASTER_NODE) {
-      vector<passivedouble> var_data;
-      unsigned long nPoint = dataSorter->GetnPoints();
-      vector<unsigned long> num_points(size);
-      SU2_MPI::Gather(&nPoint, 1, MPI_UNSIGNED_LONG, &num_points[0], 1, MPI_UNSIGNED_LONG, MASTER_NODE, SU2_MPI::GetComm());
-
-      for(int iRank = 0; iRank < size; ++iRank) {
-        int64_t rank_num_points = num_points[iRank];
-
-        if (rank_num_points > 0) {
-          if (iRank == rank) { /* Output local data. */
-            std::vector<passivedouble> values_to_write;
-            for (iVar = 0; err == 0 && iVar < fieldNames.size(); iVar++) {
-              values_to_write.resize(rank_num_points);
-              for(unsigned long i = 0; i < (unsigned long)rank_num_points; ++i)
-                values_to_write[i] = dataSorter->GetData(iVar,i);
-              err = tecZoneVarWriteDoubleValues(file_handle, zone, iVar + 1, 0, rank_num_points, &values_to_write[0]);
-              if (err) cout << rank << ": Error outputting Tecplot variable values." << endl;
+    } else {
+      const int64_t num_file_vars = varEnd - varBegin;
+      if (rank == MASTER_NODE) {
+        vector<passivedouble> var_data;
+        unsigned long nPoint = dataSorter->GetnPoints();
+        vector<unsigned long> num_points(size);
+        SU2_MPI::Gather(&nPoint, 1, MPI_UNSIGNED_LONG, &num_points[0], 1, MPI_UNSIGNED_LONG, MASTER_NODE, SU2_MPI::GetComm());
+
+        for(int iRank = 0; iRank < size; ++iRank) {
+          int64_t rank_num_points = num_points[iRank];
+
+          if (rank_num_points > 0) {
+            if (iRank == rank) { /* Output local data. */
+              std::vector<passivedouble> values_to_write;
+              for (unsigned short jVar = varBegin; err == 0 && jVar < varEnd; jVar++) {
+                values_to_write.resize(rank_num_points);
+                for(unsigned long i = 0; i < (unsigned long)rank_num_points; ++i)
+                  values_to_write[i] = dataSorter->GetData(jVar,i);
+                err = tecZoneVarWriteDoubleValues(handle, zone, jVar - varBegin + 1, 0, rank_num_points, &values_to_write[0]);
+                if (err) cout << rank << ": Error outputting Tecplot variable values." << endl;
+              }
             }
-          }
-          else { /* Receive data from other rank. */
-            var_data.resize(max((int64_t)1, (int64_t)fieldNames.size() * rank_num_points));
-            CBaseMPIWrapper::Recv(&var_data[0], fieldNames.size() * rank_num_points, MPI_DOUBLE, iRank, iRank, SU2_MPI::GetComm(), MPI_STATUS_IGNORE);
-            for (iVar = 0; err == 0 && iVar < fieldNames.size(); iVar++) {
-              err = tecZoneVarWriteDoubleValues(file_handle, zone, iVar + 1, 0, rank_num_points, &var_data[iVar * rank_num_points]);
-              if (err) cout << rank << ": Error outputting Tecplot surface variable values." << endl;
+            else { /* Receive data from other rank. */
+              var_data.resize(max((int64_t)1, num_file_vars * rank_num_points));
+              CBaseMPIWrapper::Recv(&var_data[0], num_file_vars * rank_num_points, MPI_DOUBLE, iRank, iRank, SU2_MPI::GetComm(), MPI_STATUS_IGNORE);
+              for (unsigned short jVar = varBegin; err == 0 && jVar < varEnd; jVar++) {
+                err = tecZoneVarWriteDoubleValues(handle, zone, jVar - varBegin + 1, 0, rank_num_points, &var_data[(jVar - varBegin) * rank_num_points]);
+                if (err) cout << rank << ": Error outputting Tecplot surface variable values." << endl;
+              }
             }
           }
         }
       }
-    }
-    else { /* Send data to MASTER_NODE */
-      unsigned long nPoint = dataSorter->GetnPoints();
+      else { /* Send data to MASTER_NODE */
+        unsigned long nPoint = dataSorter->GetnPoints();
 
-      SU2_MPI::Gather(&nPoint, 1, MPI_UNSIGNED_LONG, NULL, 1, MPI_UNSIGNED_LONG, MASTER_NODE, SU2_MPI::GetComm());
+        SU2_MPI::Gather(&nPoint, 1, MPI_UNSIGNED_LONG, NULL, 1, MPI_UNSIGNED_LONG, MASTER_NODE, SU2_MPI::GetComm());
 
-      vector<passivedouble> var_data;
-      size_t var_data_size = fieldNames.size() * dataSorter->GetnPoints();
-      var_data.reserve(var_data_size);
-      for (iVar = 0; err == 0 && iVar < fieldNames.size() ; iVar++)
-          for(unsigned long i = 0; i < dataSorter->GetnPoints(); ++i)
-            var_data.push_back(dataSorter->GetData(iVar,i));
+        vector<passivedouble> var_data;
+        size_t var_data_size = num_file_vars * dataSorter->GetnPoints();
+        var_data.reserve(var_data_size);
+        for (unsigned short jVar = varBegin; err == 0 && jVar < varEnd ; jVar++)
+            for(unsigned long i = 0; i < dataSorter->GetnPoints(); ++i)
+              var_data.push_back(dataSorter->GetData(jVar,i));
 
-      if (var_data.size() > 0)
-        CBaseMPIWrapper::Send(&var_data[0], static_cast<int>(var_data.size()), MPI_DOUBLE, MASTER_NODE, rank, SU2_MPI::GetComm());
+        if (var_data.size() > 0)
+          CBaseMPIWrapper::Send(&var_data[0], static_cast<int>(var_data.size()), MPI_DOUBLE, MASTER_NODE, rank, SU2_MPI::GetComm());
+      }
     }
-  }
 
 #else
 
-  unsigned short iVar;
-
-  vector<passivedouble> var_data;
-  size_t var_data_size = fieldNames.size() * dataSorter->GetnPoints();
-  var_data.reserve(var_data_size);
-
-
-  for (iVar = 0; err == 0 && iVar <  fieldNames.size(); iVar++) {
-    for(unsigned long i = 0; i < dataSorter->GetnPoints(); ++i)
-      var_data.push_back(dataSorter->GetData(iVar,i));
-    err = tecZoneVarWriteDoubleValues(file_handle, zone, iVar + 1, 0, dataSorter->GetnPoints(), &var_data[iVar * dataSorter->GetnPoints()]);
-    if (err) cout << rank << ": Error outputting Tecplot variable value." << endl;
-  }
+    vector<passivedouble> values_to_write(dataSorter->GetnPoints());
 
+    for (unsigned short jVar = varBegin; err == 0 && jVar < varEnd; jVar++) {
+      for(unsigned long i = 0; i < dataSorter->GetnPoints(); ++i)
+        values_to_write[i] = dataSorter->GetData(jVar,i);
+      err = tecZoneVarWriteDoubleValues(handle, zone, jVar - varBegin + 1, 0, dataSorter->GetnPoints(), &values_to_write[0]);
+      if (err) cout << rank << ": Error outputting Tecplot variable value." << endl;
+    }
 
 #endif /* HAVE_MPI */
+  };
 
   /*--- Write connectivity data. ---*/
 
-  unsigned long iElem;
+  auto write_conn = [&](void* handle, int32_t zone) {
+
+    unsigned long iElem;
 
 #ifdef HAVE_MPI
-  if (zone_type == ZONETYPE_FEBRICK) {
+    if (zone_type == ZONETYPE_FEBRICK) {
 
-    int64_t nodes[8];
+      int64_t nodes[8];
 
-    /**
-     *  Each rank writes node numbers relative to the partition it is outputting (starting with node number 1).
-     *  Ghost (halo) nodes identified above are numbered sequentially just beyond the end of the actual, local nodes.
-     *  Note that beg_node and end_node refer to zero-based node numbering, but Conn_* contain one-based node numbers.
-     */
+      /**
+       *  Each rank writes node numbers relative to the partition it is outputting (starting with node number 1).
+       *  Ghost (halo) nodes identified above are numbered sequentially just beyond the end of the actual, local nodes.
+       *  Note that beg_node and end_node refer to zero-based node numbering, but Conn_* contain one-based node numbers.
+       */
 #define MAKE_LOCAL(n) dataSorter->GetNodeBegin(rank) < (unsigned long)n && (unsigned long)n <= dataSorter->GetNodeEnd(rank) \
   ? (int64_t)((unsigned long)n - dataSorter->GetNodeBegin(rank)) \
   : GetHaloNodeNumber(n, dataSorter->GetNodeEnd(rank) - dataSorter->GetNodeBegin(rank), sorted_halo_nodes)
 
-    for (iElem = 0; err == 0 && iElem < nParallel_Tetr; iElem++) {
-      nodes[0] = MAKE_LOCAL(dataSorter->GetElem_Connectivity(TETRAHEDRON, iElem, 0));
-      nodes[1] = MAKE_LOCAL(dataSorter->GetElem_Connectivity(TETRAHEDRON, iElem, 1));
-      nodes[2] = MAKE_LOCAL(dataSorter->GetElem_Connectivity(TETRAHEDRON, iElem, 2));
-      nodes[3] = nodes[2];
-      nodes[4] = MAKE_LOCAL(dataSorter->GetElem_Connectivity(TETRAHEDRON, iElem, 3));
-      nodes[5] = nodes[4];
-      nodes[6] = nodes[4];
-      nodes[7] = nodes[4];
-      err = tecZoneNodeMapWrite64(file_handle, zone, rank + 1, 1, 8, nodes);
-      if (err) cout << rank << ": Error outputting Tecplot node values." << endl;
-    }
+      for (iElem = 0; err == 0 && iElem < nParallel_Tetr; iElem++) {
+        nodes[0] = MAKE_LOCAL(dataSorter->GetElem_Connectivity(TETRAHEDRON, iElem, 0));
+        nodes[1] = MAKE_LOCAL(dataSorter->GetElem_Connectivity(TETRAHEDRON, iElem, 1));
+        nodes[2] = MAKE_LOCAL(dataSorter->GetElem_Connectivity(TETRAHEDRON, iElem, 2));
+        nodes[3] = nodes[2];
+        nodes[4] = MAKE_LOCAL(dataSorter->GetElem_Connectivity(TETRAHEDRON, iElem, 3));
+        nodes[5] = nodes[4];
+        nodes[6] = nodes[4];
+        nodes[7] = nodes[4];
+        err = tecZoneNodeMapWrite64(handle, zone, rank + 1, 1, 8, nodes);
+        if (err) cout << rank << ": Error outputting Tecplot node values." << endl;
+      }
 
-    for (iElem = 0; err == 0 && iElem < nParallel_Hexa; iElem++) {
-      nodes[0] = MAKE_LOCAL(dataSorter->GetElem_Connectivity(HEXAHEDRON, iElem, 0));
-      nodes[1] = MAKE_LOCAL(dataSorter->GetElem_Connectivity(HEXAHEDRON, iElem, 1));
-      nodes[2] = MAKE_LOCAL(dataSorter->GetElem_Connectivity(HEXAHEDRON, iElem, 2));
-      nodes[3] = MAKE_LOCAL(dataSorter->GetElem_Connectivity(HEXAHEDRON, iElem, 3));
-      nodes[4] = MAKE_LOCAL(dataSorter->GetElem_Connectivity(HEXAHEDRON, iElem, 4));
-      nodes[5] = MAKE_LOCAL(dataSorter->GetElem_Connectivity(HEXAHEDRON, iElem, 5));
-      nodes[6] = MAKE_LOCAL(dataSorter->GetElem_Connectivity(HEXAHEDRON, iElem, 6));
-      nodes[7] = MAKE_LOCAL(dataSorter->GetElem_Connectivity(HEXAHEDRON, iElem, 7));
-      err = tecZoneNodeMapWrite64(file_handle, zone, rank + 1, 1, 8, nodes);
-      if (err) cout << rank << ": Error outputting Tecplot node values." << endl;
-    }
+      for (iElem = 0; err == 0 && iElem < nParallel_Hexa; iElem++) {
+        nodes[0] = MAKE_LOCAL(dataSorter->GetElem_Connectivity(HEXAHEDRON, iElem, 0));
+        nodes[1] = MAKE_LOCAL(dataSorter->GetElem_Connectivity(HEXAHEDRON, iElem, 1));
+        nodes[2] = MAKE_LOCAL(dataSorter->GetElem_Connectivity(HEXAHEDRON, iElem, 2));
+        nodes[3] = MAKE_LOCAL(dataSorter->GetElem_Connectivity(HEXAHEDRON, iElem, 3));
+        nodes[4] = MAKE_LOCAL(dataSorter->GetElem_Connectivity(HEXAHEDRON, iElem, 4));
+        nodes[5] = MAKE_LOCAL(dataSorter->GetElem_Connectivity(HEXAHEDRON, iElem, 5));
+        nodes[6] = MAKE_LOCAL(dataSorter->GetElem_Connectivity(HEXAHEDRON, iElem, 6));
+        nodes[7] = MAKE_LOCAL(dataSorter->GetElem_Connectivity(HEXAHEDRON, iElem, 7));
+        err = tecZoneNodeMapWrite64(handle, zone, rank + 1, 1, 8, nodes);
+        if (err) cout << rank << ": Error outputting Tecplot node values." << endl;
+      }
 
-    for (iElem = 0; err == 0 && iElem < nParallel_Pris; iElem++) {
-      nodes[0] = MAKE_LOCAL(dataSorter->GetElem_Connectivity(PRISM, iElem, 0));
-      nodes[1] = MAKE_LOCAL(dataSorter->GetElem_Connectivity(PRISM, iElem, 1));
-      nodes[2] = nodes[1];
-      nodes[3] = MAKE_LOCAL(dataSorter->GetElem_Connectivity(PRISM, iElem, 2));
-      nodes[4] = MAKE_LOCAL(dataSorter->GetElem_Connectivity(PRISM, iElem, 3));
-      nodes[5] = MAKE_LOCAL(dataSorter->GetElem_Connectivity(PRISM, iElem, 4));
-      nodes[6] = nodes[5];
-      nodes[7] = MAKE_LOCAL(dataSorter->GetElem_Connectivity(PRISM, iElem, 5));
-      err = tecZoneNodeMapWrite64(file_handle, zone, rank + 1, 1, 8, nodes);
-      if (err) cout << rank << ": Error outputting Tecplot node values." << endl;
-    }
+      for (iElem = 0; err == 0 && iElem < nParallel_Pris; iElem++) {
+        nodes[0] = MAKE_LOCAL(dataSorter->GetElem_Connectivity(PRISM, iElem, 0));
+        nodes[1] = MAKE_LOCAL(dataSorter->GetElem_Connectivity(PRISM, iElem, 1));
+        nodes[2] = nodes[1];
+        nodes[3] = MAKE_LOCAL(dataSorter->GetElem_Connectivity(PRISM, iElem, 2));
+        nodes[4] = MAKE_LOCAL(dataSorter->GetElem_Connectivity(PRISM, iElem, 3));
+        nodes[5] = MAKE_LOCAL(dataSorter->GetElem_Connectivity(PRISM, iElem, 4));
+        nodes[6] = nodes[5];
+        nodes[7] = MAKE_LOCAL(dataSorter->GetElem_Connectivity(PRISM, iElem, 5));
+        err = tecZoneNodeMapWrite64(handle, zone, rank + 1, 1, 8, nodes);
+        if (err) cout << rank << ": Error outputting Tecplot node values." << endl;
+      }
 
-    for (iElem = 0; err == 0 && iElem < nParallel_Pyra; iElem++) {
-      nodes[0] = MAKE_LOCAL(dataSorter->GetElem_Connectivity(PYRAMID, iElem, 0));
-      nodes[1] = MAKE_LOCAL(dataSorter->GetElem_Connectivity(PYRAMID, iElem, 1));
-      nodes[2] = MAKE_LOCAL(dataSorter->GetElem_Connectivity(PYRAMID, iElem, 2));
-      nodes[3] = MAKE_LOCAL(dataSorter->GetElem_Connectivity(PYRAMID, iElem, 3));
-      nodes[4] = MAKE_LOCAL(dataSorter->GetElem_Connectivity(PYRAMID, iElem, 4));
-      nodes[5] = nodes[4];
-      nodes[6] = nodes[4];
-      nodes[7] = nodes[4];
-      err = tecZoneNodeMapWrite64(file_handle, zone, rank + 1, 1, 8, nodes);
-      if (err) cout << rank << ": Error outputting Tecplot node values." << endl;
-    }
-  } else {
-    if (rank == MASTER_NODE) {
-
-      /* Non-hexahedral output by the master node. Output local data directly, and gather other data from the other ranks. */
-
-      int64_t nodes[4];
-
-      vector<unsigned long> connectivity_sizes(size);
-      unsigned long unused = 0;
-      SU2_MPI::Gather(&unused, 1, MPI_UNSIGNED_LONG, &connectivity_sizes[0], 1, MPI_UNSIGNED_LONG, MASTER_NODE, SU2_MPI::GetComm());
-      vector<int64_t> connectivity;
-      for(int iRank = 0; iRank < size; ++iRank) {
-        if (iRank == rank) {
-          for (iElem = 0; err == 0 && iElem < nParallel_Line; iElem++) {
-            nodes[0] = dataSorter->GetElem_Connectivity(LINE, iElem, 0);
-            nodes[1] = dataSorter->GetElem_Connectivity(LINE, iElem, 1);
-            err = tecZoneNodeMapWrite64(file_handle, zone, 0, 1, 2, nodes);
-            if (err) cout << rank << ": Error outputting Tecplot node values." << endl;
-          }
+      for (iElem = 0; err == 0 && iElem < nParallel_Pyra; iElem++) {
+        nodes[0] = MAKE_LOCAL(dataSorter->GetElem_Connectivity(PYRAMID, iElem, 0));
+        nodes[1] = MAKE_LOCAL(dataSorter->GetElem_Connectivity(PYRAMID, iElem, 1));
+        nodes[2] = MAKE_LOCAL(dataSorter->GetElem_Connectivity(PYRAMID, iElem, 2));
+        nodes[3] = MAKE_LOCAL(dataSorter->GetElem_Connectivity(PYRAMID, iElem, 3));
+        nodes[4] = MAKE_LOCAL(dataSorter->GetElem_Connectivity(PYRAMID, iElem, 4));
+        nodes[5] = nodes[4];
+        nodes[6] = nodes[4];
+        nodes[7] = nodes[4];
+        err = tecZoneNodeMapWrite64(handle, zone, rank + 1, 1, 8, nodes);
+        if (err) cout << rank << ": Error outputting Tecplot node values." << endl;
+      }
+    } else {
+      if (rank == MASTER_NODE) {
+
+        /* Non-hexahedral output by the master node. Output local data directly, and gather other data from the other ranks. */
+
+        int64_t nodes[4];
+
+        vector<unsigned long> connectivity_sizes(size);
+        unsigned long unused = 0;
+        SU2_MPI::Gather(&unused, 1, MPI_UNSIGNED_LONG, &connectivity_sizes[0], 1, MPI_UNSIGNED_LONG, MASTER_NODE, SU2_MPI::GetComm());
+        vector<int64_t> connectivity;
+        for(int iRank = 0; iRank < size; ++iRank) {
+          if (iRank == rank) {
+            for (iElem = 0; err == 0 && iElem < nParallel_Line; iElem++) {
+              nodes[0] = dataSorter->GetElem_Connectivity(LINE, iElem, 0);
+              nodes[1] = dataSorter->GetElem_Connectivity(LINE, iElem, 1);
+              err = tecZoneNodeMapWrite64(handle, zone, 0, 1, 2, nodes);
+              if (err) cout << rank << ": Error outputting Tecplot node values." << endl;
+            }
 
-          for (iElem = 0; err == 0 && iElem < nParallel_Tria; iElem++) {
-            nodes[0] = dataSorter->GetElem_Connectivity(TRIANGLE, iElem, 0);
-            nodes[1] = dataSorter->GetElem_Connectivity(TRIANGLE, iElem, 1);
-            nodes[2] = dataSorter->GetElem_Connectivity(TRIANGLE, iElem, 2);
-            nodes[3] = dataSorter->GetElem_Connectivity(TRIANGLE, iElem, 2);
-            err = tecZoneNodeMapWrite64(file_handle, zone, 0, 1, 4, nodes);
-            if (err) cout << rank << ": Error outputting Tecplot node values." << endl;
-          }
+            for (iElem = 0; err == 0 && iElem < nParallel_Tria; iElem++) {
+              nodes[0] = dataSorter->GetElem_Connectivity(TRIANGLE, iElem, 0);
+              nodes[1] = dataSorter->GetElem_Connectivity(TRIANGLE, iElem, 1);
+              nodes[2] = dataSorter->GetElem_Connectivity(TRIANGLE, iElem, 2);
+              nodes[3] = dataSorter->GetElem_Connectivity(TRIANGLE, iElem, 2);
+              err = tecZoneNodeMapWrite64(handle, zone, 0, 1, 4, nodes);
+              if (err) cout << rank << ": Error outputting Tecplot node values." << endl;
+            }
 
-          for (iElem = 0; err == 0 && iElem < nParallel_Quad; iElem++) {
-            nodes[0] = dataSorter->GetElem_Connectivity(QUADRILATERAL, iElem, 0);
-            nodes[1] = dataSorter->GetElem_Connectivity(QUADRILATERAL, iElem, 1);
-            nodes[2] = dataSorter->GetElem_Connectivity(QUADRILATERAL, iElem, 2);
-            nodes[3] = dataSorter->GetElem_Connectivity(QUADRILATERAL, iElem, 3);
-            err = tecZoneNodeMapWrite64(file_handle, zone, 0, 1, 4, nodes);
+            for (iElem = 0; err == 0 && iElem < nParallel_Quad; iElem++) {
+              nodes[0] = dataSorter->GetElem_Connectivity(QUADRILATERAL, iElem, 0);
+              nodes[1] = dataSorter->GetElem_Connectivity(QUADRILATERAL, iElem, 1);
+              nodes[2] = dataSorter->GetElem_Connectivity(QUADRILATERAL, iElem, 2);
+              nodes[3] = dataSorter->GetElem_Connectivity(QUADRILATERAL, iElem, 3);
+              err = tecZoneNodeMapWrite64(handle, zone, 0, 1, 4, nodes);
+              if (err) cout << rank << ": Error outputting Tecplot node values." << endl;
+            }
+
+          } else { /* Receive node map and write out. */
+            connectivity.resize(max((unsigned long)1, connectivity_sizes[iRank]));
+            SU2_MPI::Recv(&connectivity[0], connectivity_sizes[iRank], MPI_UNSIGNED_LONG, iRank, iRank, SU2_MPI::GetComm(), MPI_STATUS_IGNORE);
+            err = tecZoneNodeMapWrite64(handle, zone, 0, 1, connectivity_sizes[iRank], &connectivity[0]);
             if (err) cout << rank << ": Error outputting Tecplot node values." << endl;
           }
-
-        } else { /* Receive node map and write out. */
-          connectivity.resize(max((unsigned long)1, connectivity_sizes[iRank]));
-          SU2_MPI::Recv(&connectivity[0], connectivity_sizes[iRank], MPI_UNSIGNED_LONG, iRank, iRank, SU2_MPI::GetComm(), MPI_STATUS_IGNORE);
-          err = tecZoneNodeMapWrite64(file_handle, zone, 0, 1, connectivity_sizes[iRank], &connectivity[0]);
-          if (err) cout << rank << ": Error outputting Tecplot node values." << endl;
         }
-      }
-    } else {
-
-      /* Non-hexahedral output by non-master node. Send what we've got to the master node. */
+      } else {
+
+        /* Non-hexahedral output by non-master node. Send what we've got to the master node. */
+
+        unsigned long connectivity_size;
+        connectivity_size = 2 * nParallel_Line + 4 * (nParallel_Tria + nParallel_Quad);
+        SU2_MPI::Gather(&connectivity_size, 1, MPI_UNSIGNED_LONG, NULL, 1, MPI_UNSIGNED_LONG, MASTER_NODE, SU2_MPI::GetComm());
+        vector<int64_t> connectivity;
+        connectivity.reserve(connectivity_size);
+        for (iElem = 0; err == 0 && iElem < nParallel_Line; iElem++) {
+          connectivity.push_back(dataSorter->GetElem_Connectivity(LINE, iElem, 0));
+          connectivity.push_back(dataSorter->GetElem_Connectivity(LINE, iElem, 0));
+        }
 
-      unsigned long connectivity_size;
-      connectivity_size = 2 * nParallel_Line + 4 * (nParallel_Tria + nParallel_Quad);
-      SU2_MPI::Gather(&connectivity_size, 1, MPI_UNSIGNED_LONG, NULL, 1, MPI_UNSIGNED_LONG, MASTER_NODE, SU2_MPI::GetComm());
-      vector<int64_t> connectivity;
-      connectivity.reserve(connectivity_size);
-      for (iElem = 0; err == 0 && iElem < nParallel_Line; iElem++) {
-        connectivity.push_back(dataSorter->GetElem_Connectivity(LINE, iElem, 0));
-        connectivity.push_back(dataSorter->GetElem_Connectivity(LINE, iElem, 0));
-      }
+        for (iElem = 0; err == 0 && iElem < nParallel_Tria; iElem++) {
+          connectivity.push_back(dataSorter->GetElem_Connectivity(TRIANGLE, iElem, 0));
+          connectivity.push_back(dataSorter->GetElem_Connectivity(TRIANGLE, iElem, 1));
+          connectivity.push_back(dataSorter->GetElem_Connectivity(TRIANGLE, iElem, 2));
+          connectivity.push_back(dataSorter->GetElem_Connectivity(TRIANGLE, iElem, 2));
+        }
 
-      for (iElem = 0; err == 0 && iElem < nParallel_Tria; iElem++) {
-        connectivity.push_back(dataSorter->GetElem_Connectivity(TRIANGLE, iElem, 0));
-        connectivity.push_back(dataSorter->GetElem_Connectivity(TRIANGLE, iElem, 1));
-        connectivity.push_back(dataSorter->GetElem_Connectivity(TRIANGLE, iElem, 2));
-        connectivity.push_back(dataSorter->GetElem_Connectivity(TRIANGLE, iElem, 2));
-      }
+        for (iElem = 0; err == 0 && iElem < nParallel_Quad; iElem++) {
+          connectivity.push_back(dataSorter->GetElem_Connectivity(QUADRILATERAL, iElem, 0));
+          connectivity.push_back(dataSorter->GetElem_Connectivity(QUADRILATERAL, iElem, 1));
+          connectivity.push_back(dataSorter->GetElem_Connectivity(QUADRILATERAL, iElem, 2));
+          connectivity.push_back(dataSorter->GetElem_Connectivity(QUADRILATERAL, iElem, 3));
+        }
 
-      for (iElem = 0; err == 0 && iElem < nParallel_Quad; iElem++) {
-        connectivity.push_back(dataSorter->GetElem_Connectivity(QUADRILATERAL, iElem, 0));
-        connectivity.push_back(dataSorter->GetElem_Connectivity(QUADRILATERAL, iElem, 1));
-        connectivity.push_back(dataSorter->GetElem_Connectivity(QUADRILATERAL, iElem, 2));
-        connectivity.push_back(dataSorter->GetElem_Connectivity(QUADRILATERAL, iElem, 3));
+        if (connectivity.empty()) connectivity.resize(1); /* Avoid crash */
+        SU2_MPI::Send(&connectivity[0], connectivity_size, MPI_UNSIGNED_LONG, MASTER_NODE, rank, SU2_MPI::GetComm());
       }
-
-      if (connectivity.empty()) connectivity.resize(1); /* Avoid crash */
-      SU2_MPI::Send(&connectivity[0], connectivity_size, MPI_UNSIGNED_LONG, MASTER_NODE, rank, SU2_MPI::GetComm());
     }
-  }
 #else
 
-  int64_t nodes[8];
+    int64_t nodes[8];
 
-  for (iElem = 0; err == 0 && iElem < nParallel_Tria; iElem++) {
-    nodes[0] = dataSorter->GetElem_Connectivity(TRIANGLE, iElem, 0);
-    nodes[1] = dataSorter->GetElem_Connectivity(TRIANGLE, iElem, 1);
-    nodes[2] = dataSorter->GetElem_Connectivity(TRIANGLE, iElem, 2);
-    nodes[3] = dataSorter->GetElem_Connectivity(TRIANGLE, iElem, 2);
-    err = tecZoneNodeMapWrite64(file_handle, zone, rank, 1, 4, nodes);
-    if (err) cout << rank << ": Error outputting Tecplot node values." << endl;
-  }
+    for (iElem = 0; err == 0 && iElem < nParallel_Tria; iElem++) {
+      nodes[0] = dataSorter->GetElem_Connectivity(TRIANGLE, iElem, 0);
+      nodes[1] = dataSorter->GetElem_Connectivity(TRIANGLE, iElem, 1);
+      nodes[2] = dataSorter->GetElem_Connectivity(TRIANGLE, iElem, 2);
+      nodes[3] = dataSorter->GetElem_Connectivity(TRIANGLE, iElem, 2);
+      err = tecZoneNodeMapWrite64(handle, zone, rank, 1, 4, nodes);
+      if (err) cout << rank << ": Error outputting Tecplot node values." << endl;
+    }
 
-  for (iElem = 0; err == 0 && iElem < nParallel_Quad; iElem++) {
-    nodes[0] = dataSorter->GetElem_Connectivity(QUADRILATERAL, iElem, 0);
-    nodes[1] = dataSorter->GetElem_Connectivity(QUADRILATERAL, iElem, 1);
-    nodes[2] = dataSorter->GetElem_Connectivity(QUADRILATERAL, iElem, 2);
-    nodes[3] = dataSorter->GetElem_Connectivity(QUADRILATERAL, iElem, 3);
-    err = tecZoneNodeMapWrite64(file_handle, zone, rank, 1, 4, nodes);
-    if (err) cout << rank << ": Error outputting Tecplot node values." << endl;
-  }
+    for (iElem = 0; err == 0 && iElem < nParallel_Quad; iElem++) {
+      nodes[0] = dataSorter->GetElem_Connectivity(QUADRILATERAL, iElem, 0);
+      nodes[1] = dataSorter->GetElem_Connectivity(QUADRILATERAL, iElem, 1);
+      nodes[2] = dataSorter->GetElem_Connectivity(QUADRILATERAL, iElem, 2);
+      nodes[3] = dataSorter->GetElem_Connectivity(QUADRILATERAL, iElem, 3);
+      err = tecZoneNodeMapWrite64(handle, zone, rank, 1, 4, nodes);
+      if (err) cout << rank << ": Error outputting Tecplot node values." << endl;
+    }
 
-  for (iElem = 0; err == 0 && iElem < nParallel_Tetr; iElem++) {
-    nodes[0] = dataSorter->GetElem_Connectivity(TETRAHEDRON, iElem, 0);
-    nodes[1] = dataSorter->GetElem_Connectivity(TETRAHEDRON, iElem, 1);
-    nodes[2] = dataSorter->GetElem_Connectivity(TETRAHEDRON, iElem, 2);
-    nodes[3] = dataSorter->GetElem_Connectivity(TETRAHEDRON, iElem, 2);
-    nodes[4] = dataSorter->GetElem_Connectivity(TETRAHEDRON, iElem, 3);
-    nodes[5] = dataSorter->GetElem_Connectivity(TETRAHEDRON, iElem, 3);
-    nodes[6] = dataSorter->GetElem_Connectivity(TETRAHEDRON, iElem, 3);
-    nodes[7] = dataSorter->GetElem_Connectivity(TETRAHEDRON, iElem, 3);
-    err = tecZoneNodeMapWrite64(file_handle, zone, rank, 1, 8, nodes);
-    if (err) cout << rank << ": Error outputting Tecplot node values." << endl;
-  }
+    for (iElem = 0; err == 0 && iElem < nParallel_Tetr; iElem++) {
+      nodes[0] = dataSorter->GetElem_Connectivity(TETRAHEDRON, iElem, 0);
+      nodes[1] = dataSorter->GetElem_Connectivity(TETRAHEDRON, iElem, 1);
+      nodes[2] = dataSorter->GetElem_Connectivity(TETRAHEDRON, iElem, 2);
+      nodes[3] = dataSorter->GetElem_Connectivity(TETRAHEDRON, iElem, 2);
+      nodes[4] = dataSorter->GetElem_Connectivity(TETRAHEDRON, iElem, 3);
+      nodes[5] = dataSorter->GetElem_Connectivity(TETRAHEDRON, iElem, 3);
+      nodes[6] = dataSorter->GetElem_Connectivity(TETRAHEDRON, iElem, 3);
+      nodes[7] = dataSorter->GetElem_Connectivity(TETRAHEDRON, iElem, 3);
+      err = tecZoneNodeMapWrite64(handle, zone, rank, 1, 8, nodes);
+      if (err) cout << rank << ": Error outputting Tecplot node values." << endl;
+    }
 
-  for (iElem = 0; err == 0 && iElem < nParallel_Hexa; iElem++) {
-    nodes[0] = dataSorter->GetElem_Connectivity(HEXAHEDRON, iElem, 0);
-    nodes[1] = dataSorter->GetElem_Connectivity(HEXAHEDRON, iElem, 1);
-    nodes[2] = dataSorter->GetElem_Connectivity(HEXAHEDRON, iElem, 2);
-    nodes[3] = dataSorter->GetElem_Connectivity(HEXAHEDRON, iElem, 3);
-    nodes[4] = dataSorter->GetElem_Connectivity(HEXAHEDRON, iElem, 4);
-    nodes[5] = dataSorter->GetElem_Connectivity(HEXAHEDRON, iElem, 5);
-    nodes[6] = dataSorter->GetElem_Connectivity(HEXAHEDRON, iElem, 6);
-    nodes[7] = dataSorter->GetElem_Connectivity(HEXAHEDRON, iElem, 7);
-    err = tecZoneNodeMapWrite64(file_handle, zone, rank, 1, 8, nodes);
-    if (err) cout << rank << ": Error outputting Tecplot node values." << endl;
-  }
+    for (iElem = 0; err == 0 && iElem < nParallel_Hexa; iElem++) {
+      nodes[0] = dataSorter->GetElem_Connectivity(HEXAHEDRON, iElem, 0);
+      nodes[1] = dataSorter->GetElem_Connectivity(HEXAHEDRON, iElem, 1);
+      nodes[2] = dataSorter->GetElem_Connectivity(HEXAHEDRON, iElem, 2);
+      nodes[3] = dataSorter->GetElem_Connectivity(HEXAHEDRON, iElem, 3);
+      nodes[4] = dataSorter->GetElem_Connectivity(HEXAHEDRON, iElem, 4);
+      nodes[5] = dataSorter->GetElem_Connectivity(HEXAHEDRON, iElem, 5);
+      nodes[6] = dataSorter->GetElem_Connectivity(HEXAHEDRON, iElem, 6);
+      nodes[7] = dataSorter->GetElem_Connectivity(HEXAHEDRON, iElem, 7);
+      err = tecZoneNodeMapWrite64(handle, zone, rank, 1, 8, nodes);
+      if (err) cout << rank << ": Error outputting Tecplot node values." << endl;
+    }
 
-  for (iElem = 0; err == 0 && iElem < nParallel_Pris; iElem++) {
-    nodes[0] = dataSorter->GetElem_Connectivity(PRISM, iElem, 0);
-    nodes[1] = dataSorter->GetElem_Connectivity(PRISM, iElem, 1);
-    nodes[2] = dataSorter->GetElem_Connectivity(PRISM, iElem, 1);
-    nodes[3] = dataSorter->GetElem_Connectivity(PRISM, iElem, 2);
-    nodes[4] = dataSorter->GetElem_Connectivity(PRISM, iElem, 3);
-    nodes[5] = dataSorter->GetElem_Connectivity(PRISM, iElem, 4);
-    nodes[6] = dataSorter->GetElem_Connectivity(PRISM, iElem, 4);
-    nodes[7] = dataSorter->GetElem_Connectivity(PRISM, iElem, 5);
-    err = tecZoneNodeMapWrite64(file_handle, zone, rank, 1, 8, nodes);
-    if (err) cout << rank << ": Error outputting Tecplot node values." << endl;
-  }
+    for (iElem = 0; err == 0 && iElem < nParallel_Pris; iElem++) {
+      nodes[0] = dataSorter->GetElem_Connectivity(PRISM, iElem, 0);
+      nodes[1] = dataSorter->GetElem_Connectivity(PRISM, iElem, 1);
+      nodes[2] = dataSorter->GetElem_Connectivity(PRISM, iElem, 1);
+      nodes[3] = dataSorter->GetElem_Connectivity(PRISM, iElem, 2);
+      nodes[4] = dataSorter->GetElem_Connectivity(PRISM, iElem, 3);
+      nodes[5] = dataSorter->GetElem_Connectivity(PRISM, iElem, 4);
+      nodes[6] = dataSorter->GetElem_Connectivity(PRISM, iElem, 4);
+      nodes[7] = dataSorter->GetElem_Connectivity(PRISM, iElem, 5);
+      err = tecZoneNodeMapWrite64(handle, zone, rank, 1, 8, nodes);
+      if (err) cout << rank << ": Error outputting Tecplot node values." << endl;
+    }
 
-  for (iElem = 0; err == 0 && iElem < nParallel_Pyra; iElem++) {
-    nodes[0] = dataSorter->GetElem_Connectivity(PYRAMID, iElem, 0);
-    nodes[1] = dataSorter->GetElem_Connectivity(PYRAMID, iElem, 1);
-    nodes[2] = dataSorter->GetElem_Connectivity(PYRAMID, iElem, 2);
-    nodes[3] = dataSorter->GetElem_Connectivity(PYRAMID, iElem, 3);
-    nodes[4] = dataSorter->GetElem_Connectivity(PYRAMID, iElem, 4);
-    nodes[5] = dataSorter->GetElem_Connectivity(PYRAMID, iElem, 4);
-    nodes[6] = dataSorter->GetElem_Connectivity(PYRAMID, iElem, 4);
-    nodes[7] = dataSorter->GetElem_Connectivity(PYRAMID, iElem, 4);
-    err = tecZoneNodeMapWrite64(file_handle, zone, rank, 1, 8, nodes);
-    if (err) cout << rank << ": Error outputting Tecplot node values." << endl;
+    for (iElem = 0; err == 0 && iElem < nParallel_Pyra; iElem++) {
+      nodes[0] = dataSorter->GetElem_Connectivity(PYRAMID, iElem, 0);
+      nodes[1] = dataSorter->GetElem_Connectivity(PYRAMID, iElem, 1);
+      nodes[2] = dataSorter->GetElem_Connectivity(PYRAMID, iElem, 2);
+      nodes[3] = dataSorter->GetElem_Connectivity(PYRAMID, iElem, 3);
+      nodes[4] = dataSorter->GetElem_Connectivity(PYRAMID, iElem, 4);
+      nodes[5] = dataSorter->GetElem_Connectivity(PYRAMID, iElem, 4);
+      nodes[6] = dataSorter->GetElem_Connectivity(PYRAMID, iElem, 4);
+      nodes[7] = dataSorter->GetElem_Connectivity(PYRAMID, iElem, 4);
+      err = tecZoneNodeMapWrite64(handle, zone, rank, 1, 8, nodes);
+      if (err) cout << rank << ": Error outputting Tecplot node values." << endl;
+    }
+
+#endif /* HAVE_MPI */
+  };
+
+  /*--- Write the shared grid file on the first snapshot, the coordinates and the
+        connectivity are only stored there. The handle stays open for the rest of the
+        run, TecIO flushes the grid zones to disk as soon as the first solution file
+        below is opened against it. ---*/
+
+  if (shared_grid && write_grid) {
+    open_file(grid_filename, FILETYPE_GRID, 0, nDim, NULL, &grid_handle);
+    int32_t grid_zone = create_zone(grid_handle, 0, nDim, false);
+    write_vars(grid_handle, grid_zone, 0, nDim);
+    write_conn(grid_handle, grid_zone);
+
+    SharedGridFile grid_file;
+    grid_file.handle = grid_handle;
+    grid_file.num_nodes = num_nodes;
+    grid_file.num_cells = num_cells;
+    sharedGridFiles[grid_filename] = grid_file;
   }
 
+  /*--- Write the file of this snapshot: either a self-contained one, or a solution-only
+        file holding the non-coordinate variables of a zone shared with the grid file. ---*/
 
+  void* file_handle = NULL;
+  open_file(val_filename, shared_grid ? FILETYPE_SOLUTION : FILETYPE_FULL, firstVar,
+            static_cast<unsigned short>(fieldNames.size()), shared_grid ? grid_handle : NULL, &file_handle);
 
-#endif
+  int32_t zone = create_zone(file_handle, firstVar, static_cast<unsigned short>(fieldNames.size()), true);
+  write_vars(file_handle, zone, firstVar, static_cast<unsigned short>(fieldNames.size()));
+  if (!shared_grid) write_conn(file_handle, zone);
 
   err = tecFileWriterClose(&file_handle);
   if (err) cout << rank << ": Error finishing Tecplot file output." << endl;
@@ -610,4 +734,3 @@ int64_t CTecplotBinaryFileWriter::GetHaloNodeNumber(unsigned long global_node_nu
   assert(offset >= 0);
   return (int64_t)(last_local_node + offset + 1);
 }
-
@@ -28,6 +28,7 @@
 
 #include "../include/drivers/CDriver.hpp"
 #include "../include/drivers/CSinglezoneDriver.hpp"
+#include "../include/output/COutput.hpp"
 #include "../../Common/include/toolboxes/geometry_toolbox.hpp"
 
 void CDriver::PythonInterface_Preprocessing(CConfig **config, CGeometry ****geometry, CSolver *****solver){
@@ -228,6 +229,25 @@ vector<passivedouble> CDriver::GetInitialMeshCoord(unsigned short iMarker, unsig
   return coord_passive;
 }
 
+vector<passivedouble> CDriver::GetMarkerCoordinates(unsigned short iMarker) const {
+
+  CGeometry *geometry = geometry_container[ZONE_0][INST_0][MESH_0];
+  const auto nVertex = geometry->nVertex[iMarker];
+
+  /*--- Gather the coordinates of the whole marker in a flat vector, with
+   nDim components per vertex, to avoid one call per vertex from Python. ---*/
+
+  vector<passivedouble> values(nVertex*nDim, 0.0);
+
+  for (auto iVertex = 0ul; iVertex < nVertex; iVertex++) {
+    const auto iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+    for (auto iDim = 0u; iDim < nDim; iDim++)
+      values[iVertex*nDim + iDim] = SU2_TYPE::GetValue(geometry->nodes->GetCoord(iPoint, iDim));
+  }
+
+  return values;
+}
+
 vector<passivedouble> CDriver::GetVertexNormal(unsigned short iMarker, unsigned long iVertex, bool unitNormal) const {
 
   su2double *Normal;
@@ -309,6 +329,40 @@ void CDriver::SetVertexTemperature(unsigned short iMarker, unsigned long iVertex
   geometry_container[ZONE_0][INST_0][MESH_0]->SetCustomBoundaryTemperature(iMarker, iVertex, val_WallTemp);
 }
 
+vector<passivedouble> CDriver::GetMarkerTemperatures(unsigned short iMarker) const {
+
+  CGeometry *geometry = geometry_container[ZONE_0][INST_0][MESH_0];
+  const auto nVertex = geometry->nVertex[iMarker];
+
+  bool compressible = (config_container[ZONE_0]->GetKind_Regime() == ENUM_REGIME::COMPRESSIBLE);
+
+  vector<passivedouble> values(nVertex, 0.0);
+
+  if (!compressible) return values;
+
+  for (auto iVertex = 0ul; iVertex < nVertex; iVertex++) {
+    const auto iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+    if (geometry->nodes->GetDomain(iPoint)) {
+      values[iVertex] = SU2_TYPE::GetValue(
+          solver_container[ZONE_0][INST_0][MESH_0][FLOW_SOL]->GetNodes()->GetTemperature(iPoint));
+    }
+  }
+
+  return values;
+}
+
+void CDriver::SetMarkerTemperatures(unsigned short iMarker, const vector<passivedouble>& values) {
+
+  CGeometry *geometry = geometry_container[ZONE_0][INST_0][MESH_0];
+  const auto nVertex = geometry->nVertex[iMarker];
+
+  if (values.size() != nVertex)
+    SU2_MPI::Error("Expected one temperature per vertex of the marker.", CURRENT_FUNCTION);
+
+  for (auto iVertex = 0ul; iVertex < nVertex; iVertex++)
+    geometry->SetCustomBoundaryTemperature(iMarker, iVertex, values[iVertex]);
+}
+
 vector<passivedouble> CDriver::GetVertexHeatFluxes(unsigned short iMarker, unsigned long iVertex) const {
 
   unsigned long iPoint;
@@ -603,6 +657,41 @@ void CDriver::ResetConvergence() {
 
 }
 
+void CDriver::WarmRestart(bool reset_solution) {
+
+  /*--- Reset the time iteration so that StartSolver() can be called again,
+   keeping the geometry and solver allocations of this driver alive. ---*/
+
+  TimeIter = 0;
+
+  /*--- Clear the convergence monitors of the previous solve. ---*/
+
+  ResetConvergence();
+
+  for (iZone = 0; iZone < nZone; iZone++) {
+
+    config_container[iZone]->SetTimeIter(0);
+    config_container[iZone]->SetInnerIter(0);
+    output_container[iZone]->SetConvergence(false);
+
+    /*--- Optionally reset the solution to the free-stream state on all grid
+     levels, e.g. when the new operating point is far from the previous one.
+     Otherwise the result of the previous solve is kept as the initial
+     condition, which is the usual choice in design loops. ---*/
+
+    if (reset_solution) {
+      for (unsigned short iMesh = 0; iMesh <= config_container[iZone]->GetnMGLevels(); iMesh++) {
+        for (unsigned int iSol = 0; iSol < MAX_SOLS; iSol++) {
+          auto solver = solver_container[iZone][INST_0][iMesh][iSol];
+          if (solver != nullptr) solver->SetFreeStream_Solution(config_container[iZone]);
+        }
+      }
+    }
+
+  }
+
+}
+
 void CSinglezoneDriver::SetInitialMesh() {
 
   DynamicMeshUpdate(0);
@@ -624,9 +713,9 @@ void CSinglezoneDriver::SetInitialMesh() {
       geometry_container[ZONE_0][INST_0][iMesh]->nodes->SetVolume_n();
       geometry_container[ZONE_0][INST_0][iMesh]->nodes->SetVolume_nM1();
     }
-    /*--- Push back the solution so that there is no fictious velocity at the next step. ---*/
-    solver_container[ZONE_0][INST_0][MESH_0][MESH_SOL]->GetNodes()->Set_Solution_time_n();
-    solver_container[ZONE_0][INST_0][MESH_0][MESH_SOL]->GetNodes()->Set_Solution_time_n1();
+    /*--- Push back the solution twice so that there is no fictious velocity at the next step. ---*/
+    solver_container[ZONE_0][INST_0][MESH_0][MESH_SOL]->GetNodes()->Shift_DispHistory();
+    solver_container[ZONE_0][INST_0][MESH_0][MESH_SOL]->GetNodes()->Shift_DispHistory();
   }
   END_SU2_OMP_PARALLEL
 }
@@ -662,6 +751,24 @@ void CDriver::SetFEA_Loads(unsigned short iMarker, unsigned long iVertex, passiv
 
 }
 
+void CDriver::SetMarkerFEALoads(unsigned short iMarker, const vector<passivedouble>& values) {
+
+  CGeometry *geometry = geometry_container[ZONE_0][INST_0][MESH_0];
+  const auto nVertex = geometry->nVertex[iMarker];
+
+  if (values.size() != nVertex*nDim)
+    SU2_MPI::Error("Expected nDim load components per vertex of the marker.", CURRENT_FUNCTION);
+
+  for (auto iVertex = 0ul; iVertex < nVertex; iVertex++) {
+    su2double NodalForce[3] = {0.0,0.0,0.0};
+    for (auto iDim = 0u; iDim < nDim; iDim++)
+      NodalForce[iDim] = values[iVertex*nDim + iDim];
+
+    const auto iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+    solver_container[ZONE_0][INST_0][MESH_0][FEA_SOL]->GetNodes()->Set_FlowTraction(iPoint,NodalForce);
+  }
+}
+
 vector<passivedouble> CDriver::GetFEA_Displacements(unsigned short iMarker, unsigned long iVertex) const {
 
   unsigned long iPoint;
@@ -687,6 +794,23 @@ vector<passivedouble> CDriver::GetFEA_Displacements(unsigned short iMarker, unsi
 }
 
 
+vector<passivedouble> CDriver::GetMarkerFEADisplacements(unsigned short iMarker) const {
+
+  CGeometry *geometry = geometry_container[ZONE_0][INST_0][MESH_0];
+  CSolver *solver = solver_container[ZONE_0][INST_0][MESH_0][FEA_SOL];
+  const auto nVertex = geometry->nVertex[iMarker];
+
+  vector<passivedouble> values(nVertex*nDim, 0.0);
+
+  for (auto iVertex = 0ul; iVertex < nVertex; iVertex++) {
+    const auto iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+    for (auto iDim = 0u; iDim < nDim; iDim++)
+      values[iVertex*nDim + iDim] = SU2_TYPE::GetValue(solver->GetNodes()->GetSolution(iPoint, iDim));
+  }
+
+  return values;
+}
+
 vector<passivedouble> CDriver::GetFEA_Velocity(unsigned short iMarker, unsigned long iVertex) const {
 
   unsigned long iPoint;
@@ -856,6 +980,24 @@ void CDriver::SetMeshDisplacement(unsigned short iMarker, unsigned long iVertex,
 
 }
 
+void CDriver::SetMarkerMeshDisplacements(unsigned short iMarker, const vector<passivedouble>& values) {
+
+  CGeometry *geometry = geometry_container[ZONE_0][INST_0][MESH_0];
+  const auto nVertex = geometry->nVertex[iMarker];
+
+  if (values.size() != nVertex*nDim)
+    SU2_MPI::Error("Expected nDim displacement components per vertex of the marker.", CURRENT_FUNCTION);
+
+  for (auto iVertex = 0ul; iVertex < nVertex; iVertex++) {
+    su2double MeshDispl[3] = {0.0,0.0,0.0};
+    for (auto iDim = 0u; iDim < nDim; iDim++)
+      MeshDispl[iDim] = values[iVertex*nDim + iDim];
+
+    const auto iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+    solver_container[ZONE_0][INST_0][MESH_0][MESH_SOL]->GetNodes()->SetBound_Disp(iPoint,MeshDispl);
+  }
+}
+
 void CDriver::CommunicateMeshDisplacement(void) {
 
   solver_container[ZONE_0][INST_0][MESH_0][MESH_SOL]->InitiateComms(geometry_container[ZONE_0][INST_0][MESH_0],
@@ -893,3 +1035,21 @@ vector<passivedouble> CDriver::GetFlowLoad(unsigned short iMarker, unsigned long
   return FlowLoad_passive;
 
 }
+
+vector<passivedouble> CDriver::GetMarkerFlowLoads(unsigned short iMarker) const {
+
+  CGeometry *geometry = geometry_container[ZONE_0][INST_0][MESH_0];
+  CSolver *solver = solver_container[ZONE_0][INST_0][MESH_0][FLOW_SOL];
+  const auto nVertex = geometry->nVertex[iMarker];
+
+  vector<passivedouble> values(nVertex*nDim, 0.0);
+
+  if (!config_container[ZONE_0]->GetSolid_Wall(iMarker)) return values;
+
+  for (auto iVertex = 0ul; iVertex < nVertex; iVertex++) {
+    for (auto iDim = 0u; iDim < nDim; iDim++)
+      values[iVertex*nDim + iDim] = SU2_TYPE::GetValue(solver->GetVertexTractions(iMarker, iVertex, iDim));
+  }
+
+  return values;
+}
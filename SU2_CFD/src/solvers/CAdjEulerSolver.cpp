@@ -1005,6 +1005,8 @@ void CAdjEulerSolver::Preprocessing(CGeometry *geometry, CSolver **solver_contai
     if ((center_jst) && (iMesh == MESH_0)) {
       SetCentered_Dissipation_Sensor(geometry, config);
       SetUndivided_Laplacian(geometry, config);
+      InitiateComms(geometry, config, UNDIVIDED_LAPLACIAN);
+      CompleteComms(geometry, config, UNDIVIDED_LAPLACIAN);
       if (config->GetKind_Gradient_Method() == GREEN_GAUSS) SetSolution_Gradient_GG(geometry, config);
       if (config->GetKind_Gradient_Method() == WEIGHTED_LEAST_SQUARES) SetSolution_Gradient_LS(geometry, config);
     }
@@ -1029,20 +1031,40 @@ void CAdjEulerSolver::Preprocessing(CGeometry *geometry, CSolver **solver_contai
 void CAdjEulerSolver::Centered_Residual(CGeometry *geometry, CSolver **solver_container, CNumerics **numerics_container,
                                         CConfig *config, unsigned short iMesh, unsigned short iRKStep) {
 
-  CNumerics* numerics = numerics_container[CONV_TERM];
+  const bool implicit = (config->GetKind_TimeIntScheme() == EULER_IMPLICIT);
+  const bool jst_scheme = ((config->GetKind_Centered_AdjFlow() == JST) && (iMesh == MESH_0));
+  const bool grid_movement  = config->GetGrid_Movement();
 
-  unsigned long iEdge, iPoint, jPoint;
+  auto* flowNodes = solver_container[FLOW_SOL]->GetNodes();
 
-  bool implicit = (config->GetKind_TimeIntScheme() == EULER_IMPLICIT);
-  bool jst_scheme = ((config->GetKind_Centered_AdjFlow() == JST) && (iMesh == MESH_0));
-  bool grid_movement  = config->GetGrid_Movement();
+  /*--- The continuous adjoint does not use the full hybrid-parallel framework
+   of the primal solvers, but its edge loops run multi-threaded over the edge
+   colors of the grid, with one numerics object and thread-local scratch
+   arrays. With an inefficient coloring the loop runs with a single thread
+   (the reducer strategy of the primal solvers is not implemented here). ---*/
 
-  for (iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
+  su2double parallelEff = 1.0;
+  const auto& coloring = geometry->GetEdgeColoring(&parallelEff);
+  const bool useOmp = (parallelEff >= COLORING_EFF_THRESH) && !coloring.empty();
+
+  SU2_OMP_PARALLEL_(if(useOmp))
+  {
+  CNumerics* numerics = numerics_container[CONV_TERM + omp_get_thread_num()*MAX_TERMS];
+
+  su2double resConv_i[MAXNVAR], resVisc_i[MAXNVAR], resConv_j[MAXNVAR], resVisc_j[MAXNVAR];
+  su2double jacBuf[4][MAXNVAR][MAXNVAR];
+  su2double *jac_ii[MAXNVAR], *jac_ij[MAXNVAR], *jac_ji[MAXNVAR], *jac_jj[MAXNVAR];
+  for (unsigned short iVar = 0; iVar < nVar; iVar++) {
+    jac_ii[iVar] = jacBuf[0][iVar]; jac_ij[iVar] = jacBuf[1][iVar];
+    jac_ji[iVar] = jacBuf[2][iVar]; jac_jj[iVar] = jacBuf[3][iVar];
+  }
+
+  auto EdgeResidual = [&](unsigned long iEdge) {
 
     /*--- Points in edge, normal, and neighbors---*/
 
-    iPoint = geometry->edges->GetNode(iEdge,0);
-    jPoint = geometry->edges->GetNode(iEdge,1);
+    const auto iPoint = geometry->edges->GetNode(iEdge,0);
+    const auto jPoint = geometry->edges->GetNode(iEdge,1);
     numerics->SetNormal(geometry->edges->GetNormal(iEdge));
     numerics->SetNeighbor(geometry->nodes->GetnNeighbor(iPoint), geometry->nodes->GetnNeighbor(jPoint));
 
@@ -1052,17 +1074,12 @@ void CAdjEulerSolver::Centered_Residual(CGeometry *geometry, CSolver **solver_co
 
     /*--- Conservative variables w/o reconstruction ---*/
 
-    numerics->SetConservative(solver_container[FLOW_SOL]->GetNodes()->GetSolution(iPoint),
-                              solver_container[FLOW_SOL]->GetNodes()->GetSolution(jPoint));
-
-    numerics->SetSoundSpeed(solver_container[FLOW_SOL]->GetNodes()->GetSoundSpeed(iPoint),
-                            solver_container[FLOW_SOL]->GetNodes()->GetSoundSpeed(jPoint));
-    numerics->SetEnthalpy(solver_container[FLOW_SOL]->GetNodes()->GetEnthalpy(iPoint),
-                          solver_container[FLOW_SOL]->GetNodes()->GetEnthalpy(jPoint));
+    numerics->SetConservative(flowNodes->GetSolution(iPoint), flowNodes->GetSolution(jPoint));
 
+    numerics->SetSoundSpeed(flowNodes->GetSoundSpeed(iPoint), flowNodes->GetSoundSpeed(jPoint));
+    numerics->SetEnthalpy(flowNodes->GetEnthalpy(iPoint), flowNodes->GetEnthalpy(jPoint));
 
-    numerics->SetLambda(solver_container[FLOW_SOL]->GetNodes()->GetLambda(iPoint),
-                        solver_container[FLOW_SOL]->GetNodes()->GetLambda(jPoint));
+    numerics->SetLambda(flowNodes->GetLambda(iPoint), flowNodes->GetLambda(jPoint));
 
     if (jst_scheme) {
       numerics->SetUndivided_Laplacian(nodes->GetUndivided_Laplacian(iPoint), nodes->GetUndivided_Laplacian(jPoint));
@@ -1077,63 +1094,94 @@ void CAdjEulerSolver::Centered_Residual(CGeometry *geometry, CSolver **solver_co
 
     /*--- Compute residuals ---*/
 
-    numerics->ComputeResidual(Res_Conv_i, Res_Visc_i, Res_Conv_j, Res_Visc_j,
-                              Jacobian_ii, Jacobian_ij, Jacobian_ji, Jacobian_jj, config);
+    numerics->ComputeResidual(resConv_i, resVisc_i, resConv_j, resVisc_j,
+                              jac_ii, jac_ij, jac_ji, jac_jj, config);
 
     /*--- Update convective and artificial dissipation residuals ---*/
 
-    LinSysRes.SubtractBlock(iPoint, Res_Conv_i);
-    LinSysRes.SubtractBlock(jPoint, Res_Conv_j);
-    LinSysRes.SubtractBlock(iPoint, Res_Visc_i);
-    LinSysRes.SubtractBlock(jPoint, Res_Visc_j);
+    LinSysRes.SubtractBlock(iPoint, resConv_i);
+    LinSysRes.SubtractBlock(jPoint, resConv_j);
+    LinSysRes.SubtractBlock(iPoint, resVisc_i);
+    LinSysRes.SubtractBlock(jPoint, resVisc_j);
 
     /*--- Implicit contribution to the residual ---*/
 
     if (implicit) {
-      Jacobian.SubtractBlock2Diag(iPoint, Jacobian_ii);
-      Jacobian.SubtractBlock(iPoint, jPoint, Jacobian_ij);
-      Jacobian.SubtractBlock(jPoint, iPoint, Jacobian_ji);
-      Jacobian.SubtractBlock2Diag(jPoint, Jacobian_jj);
+      Jacobian.SubtractBlock2Diag(iPoint, jac_ii);
+      Jacobian.UpdateBlocksOffDiag(iEdge, jac_ij, jac_ji, -1.0, -1.0);
+      Jacobian.SubtractBlock2Diag(jPoint, jac_jj);
     }
-
+  };
+
+  if (useOmp) {
+    /*--- Loop over edge colors, no two edges of one color share a point. ---*/
+    for (auto iColor = 0ul; iColor < coloring.getOuterSize(); ++iColor) {
+      SU2_OMP_FOR_DYN(nextMultiple(OMP_MIN_SIZE, geometry->GetEdgeColorChunkSize(iColor)))
+      for (auto k = 0ul; k < coloring.getNumNonZeros(iColor); ++k) {
+        EdgeResidual(coloring.innerIdx(iColor)[k]);
+      }
+      END_SU2_OMP_FOR
+    }
+  }
+  else {
+    for (auto iEdge = 0ul; iEdge < geometry->GetnEdge(); iEdge++) EdgeResidual(iEdge);
   }
+  }
+  END_SU2_OMP_PARALLEL
 }
 
 
 void CAdjEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_container,
                                       CNumerics **numerics_container, CConfig *config, unsigned short iMesh) {
 
-  CNumerics* numerics = numerics_container[CONV_TERM];
+  const bool implicit         = (config->GetKind_TimeIntScheme() == EULER_IMPLICIT);
+  const bool muscl            = (config->GetMUSCL_AdjFlow() && (iMesh == MESH_0));
+  const bool limiter          = (config->GetKind_SlopeLimit_AdjFlow() != LIMITER::NONE);
+  const bool grid_movement    = config->GetGrid_Movement();
+
+  auto* flowNodes = solver_container[FLOW_SOL]->GetNodes();
+
+  unsigned long counter_local = 0, counter_global = 0;
+
+  /*--- Multi-threaded edge loop over the edge colors, see the notes in
+   Centered_Residual. ---*/
 
-  su2double Project_Grad_i, Project_Grad_j, *Limiter_i = nullptr,
-  *Limiter_j = nullptr, *Psi_i = nullptr, *Psi_j = nullptr, *V_i, *V_j;
-  unsigned long iEdge, iPoint, jPoint, counter_local = 0, counter_global = 0;
-  unsigned short iDim, iVar;
+  su2double parallelEff = 1.0;
+  const auto& coloring = geometry->GetEdgeColoring(&parallelEff);
+  const bool useOmp = (parallelEff >= COLORING_EFF_THRESH) && !coloring.empty();
+
+  SU2_OMP_PARALLEL_(if(useOmp))
+  {
+  CNumerics* numerics = numerics_container[CONV_TERM + omp_get_thread_num()*MAX_TERMS];
+
+  su2double solution_i[MAXNVAR], solution_j[MAXNVAR], res_i[MAXNVAR], res_j[MAXNVAR];
+  su2double vector_i[MAXNDIM], vector_j[MAXNDIM];
+  su2double jacBuf[4][MAXNVAR][MAXNVAR];
+  su2double *jac_ii[MAXNVAR], *jac_ij[MAXNVAR], *jac_ji[MAXNVAR], *jac_jj[MAXNVAR];
+  for (unsigned short iVar = 0; iVar < nVar; iVar++) {
+    jac_ii[iVar] = jacBuf[0][iVar]; jac_ij[iVar] = jacBuf[1][iVar];
+    jac_ji[iVar] = jacBuf[2][iVar]; jac_jj[iVar] = jacBuf[3][iVar];
+  }
 
-  bool implicit         = (config->GetKind_TimeIntScheme() == EULER_IMPLICIT);
-  bool muscl            = (config->GetMUSCL_AdjFlow() && (iMesh == MESH_0));
-  bool limiter          = (config->GetKind_SlopeLimit_AdjFlow() != LIMITER::NONE);
-  bool grid_movement    = config->GetGrid_Movement();
+  auto EdgeResidual = [&](unsigned long iEdge) {
 
-  for (iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
+    unsigned short iDim, iVar;
 
     /*--- Points in edge and normal vectors ---*/
 
-    iPoint = geometry->edges->GetNode(iEdge,0);
-    jPoint = geometry->edges->GetNode(iEdge,1);
+    const auto iPoint = geometry->edges->GetNode(iEdge,0);
+    const auto jPoint = geometry->edges->GetNode(iEdge,1);
     numerics->SetNormal(geometry->edges->GetNormal(iEdge));
 
     /*--- Adjoint variables w/o reconstruction ---*/
 
-    Psi_i = nodes->GetSolution(iPoint);
-    Psi_j = nodes->GetSolution(jPoint);
+    su2double* Psi_i = nodes->GetSolution(iPoint);
+    su2double* Psi_j = nodes->GetSolution(jPoint);
     numerics->SetAdjointVar(Psi_i, Psi_j);
 
     /*--- Primitive variables w/o reconstruction ---*/
 
-    V_i = solver_container[FLOW_SOL]->GetNodes()->GetPrimitive(iPoint);
-    V_j = solver_container[FLOW_SOL]->GetNodes()->GetPrimitive(jPoint);
-    numerics->SetPrimitive(V_i, V_j);
+    numerics->SetPrimitive(flowNodes->GetPrimitive(iPoint), flowNodes->GetPrimitive(jPoint));
 
     /*--- Grid velocities for dynamic meshes ---*/
 
@@ -1146,8 +1194,8 @@ void CAdjEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_cont
     if (muscl) {
 
       for (iDim = 0; iDim < nDim; iDim++) {
-        Vector_i[iDim] = 0.5*(geometry->nodes->GetCoord(jPoint, iDim) - geometry->nodes->GetCoord(iPoint, iDim));
-        Vector_j[iDim] = 0.5*(geometry->nodes->GetCoord(iPoint, iDim) - geometry->nodes->GetCoord(jPoint, iDim));
+        vector_i[iDim] = 0.5*(geometry->nodes->GetCoord(jPoint, iDim) - geometry->nodes->GetCoord(iPoint, iDim));
+        vector_j[iDim] = 0.5*(geometry->nodes->GetCoord(iPoint, iDim) - geometry->nodes->GetCoord(jPoint, iDim));
       }
 
       /*--- Adjoint variables using gradient reconstruction and limiters ---*/
@@ -1155,24 +1203,25 @@ void CAdjEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_cont
       const auto Gradient_i = nodes->GetGradient_Reconstruction(iPoint);
       const auto Gradient_j = nodes->GetGradient_Reconstruction(jPoint);
 
+      const su2double *Limiter_i = nullptr, *Limiter_j = nullptr;
       if (limiter) {
         Limiter_i = nodes->GetLimiter(iPoint);
         Limiter_j = nodes->GetLimiter(jPoint);
       }
 
       for (iVar = 0; iVar < nVar; iVar++) {
-        Project_Grad_i = 0; Project_Grad_j = 0;
+        su2double Project_Grad_i = 0, Project_Grad_j = 0;
         for (iDim = 0; iDim < nDim; iDim++) {
-          Project_Grad_i += Vector_i[iDim]*Gradient_i[iVar][iDim];
-          Project_Grad_j += Vector_j[iDim]*Gradient_j[iVar][iDim];
+          Project_Grad_i += vector_i[iDim]*Gradient_i[iVar][iDim];
+          Project_Grad_j += vector_j[iDim]*Gradient_j[iVar][iDim];
         }
         if (limiter) {
-          Solution_i[iVar] = Psi_i[iVar] + Project_Grad_i*Limiter_i[iDim];
-          Solution_j[iVar] = Psi_j[iVar] + Project_Grad_j*Limiter_j[iDim];
+          solution_i[iVar] = Psi_i[iVar] + Project_Grad_i*Limiter_i[iDim];
+          solution_j[iVar] = Psi_j[iVar] + Project_Grad_j*Limiter_j[iDim];
         }
         else {
-          Solution_i[iVar] = Psi_i[iVar] + Project_Grad_i;
-          Solution_j[iVar] = Psi_j[iVar] + Project_Grad_j;
+          solution_i[iVar] = Psi_i[iVar] + Project_Grad_i;
+          solution_j[iVar] = Psi_j[iVar] + Project_Grad_j;
         }
       }
 
@@ -1180,8 +1229,8 @@ void CAdjEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_cont
        adjoint density. */
 
       su2double adj_limit = config->GetAdjointLimit();
-      bool phi_bound_i = (fabs(Solution_i[0]) > adj_limit);
-      bool phi_bound_j = (fabs(Solution_j[0]) > adj_limit);
+      bool phi_bound_i = (fabs(solution_i[0]) > adj_limit);
+      bool phi_bound_j = (fabs(solution_j[0]) > adj_limit);
 
       if (phi_bound_i) nodes->SetNon_Physical(iPoint, true);
       else             nodes->SetNon_Physical(iPoint, false);
@@ -1193,39 +1242,54 @@ void CAdjEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_cont
        from previous iterations. */
 
       if (nodes->GetNon_Physical(iPoint)) {
+        SU2_OMP_ATOMIC
         counter_local++;
         for (iVar = 0; iVar < nVar; iVar++)
-          Solution_i[iVar] = Psi_i[iVar];
+          solution_i[iVar] = Psi_i[iVar];
       }
       if (nodes->GetNon_Physical(jPoint)) {
+        SU2_OMP_ATOMIC
         counter_local++;
         for (iVar = 0; iVar < nVar; iVar++)
-          Solution_j[iVar] = Psi_j[iVar];
+          solution_j[iVar] = Psi_j[iVar];
       }
 
-      numerics->SetAdjointVar(Solution_i, Solution_j);
+      numerics->SetAdjointVar(solution_i, solution_j);
 
     }
 
     /*--- Compute the residual---*/
 
-    numerics->ComputeResidual(Residual_i, Residual_j, Jacobian_ii, Jacobian_ij, Jacobian_ji, Jacobian_jj, config);
+    numerics->ComputeResidual(res_i, res_j, jac_ii, jac_ij, jac_ji, jac_jj, config);
 
     /*--- Add and Subtract Residual ---*/
 
-    LinSysRes.SubtractBlock(iPoint, Residual_i);
-    LinSysRes.SubtractBlock(jPoint, Residual_j);
+    LinSysRes.SubtractBlock(iPoint, res_i);
+    LinSysRes.SubtractBlock(jPoint, res_j);
 
     /*--- Implicit contribution to the residual ---*/
 
     if (implicit) {
-      Jacobian.SubtractBlock2Diag(iPoint, Jacobian_ii);
-      Jacobian.SubtractBlock(iPoint, jPoint, Jacobian_ij);
-      Jacobian.SubtractBlock(jPoint, iPoint, Jacobian_ji);
-      Jacobian.SubtractBlock2Diag(jPoint, Jacobian_jj);
+      Jacobian.SubtractBlock2Diag(iPoint, jac_ii);
+      Jacobian.UpdateBlocksOffDiag(iEdge, jac_ij, jac_ji, -1.0, -1.0);
+      Jacobian.SubtractBlock2Diag(jPoint, jac_jj);
     }
+  };
 
+  if (useOmp) {
+    for (auto iColor = 0ul; iColor < coloring.getOuterSize(); ++iColor) {
+      SU2_OMP_FOR_DYN(nextMultiple(OMP_MIN_SIZE, geometry->GetEdgeColorChunkSize(iColor)))
+      for (auto k = 0ul; k < coloring.getNumNonZeros(iColor); ++k) {
+        EdgeResidual(coloring.innerIdx(iColor)[k]);
+      }
+      END_SU2_OMP_FOR
+    }
+  }
+  else {
+    for (auto iEdge = 0ul; iEdge < geometry->GetnEdge(); iEdge++) EdgeResidual(iEdge);
+  }
   }
+  END_SU2_OMP_PARALLEL
 
   /*--- Warning message about non-physical reconstructions. ---*/
 
@@ -3944,9 +4008,8 @@ void CAdjEulerSolver::LoadRestart(CGeometry **geometry, CSolver ***solver, CConf
 
   /*--- Delete the class memory that is used to load the restart. ---*/
 
-  delete [] Restart_Vars;
-  delete [] Restart_Data;
-  Restart_Vars = nullptr; Restart_Data = nullptr;
+  delete [] Restart_Vars; Restart_Vars = nullptr;
+  FreeRestartData();
 
 }
 
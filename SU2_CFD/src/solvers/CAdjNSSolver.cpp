@@ -383,6 +383,8 @@ void CAdjNSSolver::Preprocessing(CGeometry *geometry, CSolver **solver_container
   if (center_jst && (iMesh == MESH_0)) {
     SetCentered_Dissipation_Sensor(geometry, config);
     SetUndivided_Laplacian(geometry, config);
+    InitiateComms(geometry, config, UNDIVIDED_LAPLACIAN);
+    CompleteComms(geometry, config, UNDIVIDED_LAPLACIAN);
   }
 
   /*--- Initialize the Jacobian for implicit integration ---*/
@@ -404,26 +406,42 @@ void CAdjNSSolver::Preprocessing(CGeometry *geometry, CSolver **solver_container
 void CAdjNSSolver::Viscous_Residual(CGeometry *geometry, CSolver **solver_container, CNumerics **numerics_container,
                                     CConfig *config, unsigned short iMesh, unsigned short iRKStep) {
 
-  CNumerics* numerics = numerics_container[VISC_TERM];
+  const bool implicit = (config->GetKind_TimeIntScheme() == EULER_IMPLICIT);
 
-  unsigned long iPoint, jPoint, iEdge;
+  auto* flowNodes = solver_container[FLOW_SOL]->GetNodes();
 
-  bool implicit = (config->GetKind_TimeIntScheme() == EULER_IMPLICIT);
+  /*--- Multi-threaded edge loop over the edge colors, see the notes in
+   CAdjEulerSolver::Centered_Residual. ---*/
+
+  su2double parallelEff = 1.0;
+  const auto& coloring = geometry->GetEdgeColoring(&parallelEff);
+  const bool useOmp = (parallelEff >= COLORING_EFF_THRESH) && !coloring.empty();
+
+  SU2_OMP_PARALLEL_(if(useOmp))
+  {
+  CNumerics* numerics = numerics_container[VISC_TERM + omp_get_thread_num()*MAX_TERMS];
+
+  su2double res_i[MAXNVAR], res_j[MAXNVAR];
+  su2double jacBuf[4][MAXNVAR][MAXNVAR];
+  su2double *jac_ii[MAXNVAR], *jac_ij[MAXNVAR], *jac_ji[MAXNVAR], *jac_jj[MAXNVAR];
+  for (unsigned short iVar = 0; iVar < nVar; iVar++) {
+    jac_ii[iVar] = jacBuf[0][iVar]; jac_ij[iVar] = jacBuf[1][iVar];
+    jac_ji[iVar] = jacBuf[2][iVar]; jac_jj[iVar] = jacBuf[3][iVar];
+  }
 
-  for (iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
+  auto EdgeResidual = [&](unsigned long iEdge) {
 
     /*--- Points in edge, coordinates and normal vector---*/
 
-    iPoint = geometry->edges->GetNode(iEdge,0);
-    jPoint = geometry->edges->GetNode(iEdge,1);
+    const auto iPoint = geometry->edges->GetNode(iEdge,0);
+    const auto jPoint = geometry->edges->GetNode(iEdge,1);
 
     numerics->SetCoord(geometry->nodes->GetCoord(iPoint), geometry->nodes->GetCoord(jPoint));
     numerics->SetNormal(geometry->edges->GetNormal(iEdge));
 
     /*--- Primitive variables w/o reconstruction and adjoint variables w/o reconstruction---*/
 
-    numerics->SetPrimitive(solver_container[FLOW_SOL]->GetNodes()->GetPrimitive(iPoint),
-                           solver_container[FLOW_SOL]->GetNodes()->GetPrimitive(jPoint));
+    numerics->SetPrimitive(flowNodes->GetPrimitive(iPoint), flowNodes->GetPrimitive(jPoint));
 
     numerics->SetAdjointVar(nodes->GetSolution(iPoint), nodes->GetSolution(jPoint));
 
@@ -433,22 +451,34 @@ void CAdjNSSolver::Viscous_Residual(CGeometry *geometry, CSolver **solver_contai
 
     /*--- Compute residual ---*/
 
-    numerics->ComputeResidual(Residual_i, Residual_j, Jacobian_ii, Jacobian_ij, Jacobian_ji, Jacobian_jj, config);
+    numerics->ComputeResidual(res_i, res_j, jac_ii, jac_ij, jac_ji, jac_jj, config);
 
     /*--- Update adjoint viscous residual ---*/
 
-    LinSysRes.SubtractBlock(iPoint, Residual_i);
-    LinSysRes.AddBlock(jPoint, Residual_j);
+    LinSysRes.SubtractBlock(iPoint, res_i);
+    LinSysRes.AddBlock(jPoint, res_j);
 
     if (implicit) {
-      Jacobian.SubtractBlock2Diag(iPoint, Jacobian_ii);
-      Jacobian.SubtractBlock(iPoint, jPoint, Jacobian_ij);
-      Jacobian.AddBlock(jPoint, iPoint, Jacobian_ji);
-      Jacobian.AddBlock2Diag(jPoint, Jacobian_jj);
+      Jacobian.SubtractBlock2Diag(iPoint, jac_ii);
+      Jacobian.UpdateBlocksOffDiag(iEdge, jac_ij, jac_ji, -1.0, 1.0);
+      Jacobian.AddBlock2Diag(jPoint, jac_jj);
     }
+  };
 
+  if (useOmp) {
+    for (auto iColor = 0ul; iColor < coloring.getOuterSize(); ++iColor) {
+      SU2_OMP_FOR_DYN(nextMultiple(OMP_MIN_SIZE, geometry->GetEdgeColorChunkSize(iColor)))
+      for (auto k = 0ul; k < coloring.getNumNonZeros(iColor); ++k) {
+        EdgeResidual(coloring.innerIdx(iColor)[k]);
+      }
+      END_SU2_OMP_FOR
+    }
   }
-
+  else {
+    for (auto iEdge = 0ul; iEdge < geometry->GetnEdge(); iEdge++) EdgeResidual(iEdge);
+  }
+  }
+  END_SU2_OMP_PARALLEL
 }
 
 void CAdjNSSolver::Source_Residual(CGeometry *geometry, CSolver **solver_container,
@@ -315,8 +315,7 @@ void CAdjTurbSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_conta
     LinSysRes.AddBlock(iPoint, Residual_i);
     LinSysRes.AddBlock(jPoint, Residual_j);
     Jacobian.AddBlock2Diag(iPoint, Jacobian_ii);
-    Jacobian.AddBlock(iPoint, jPoint, Jacobian_ij);
-    Jacobian.AddBlock(jPoint, iPoint, Jacobian_ji);
+    Jacobian.UpdateBlocksOffDiag(iEdge, Jacobian_ij, Jacobian_ji, 1.0, 1.0);
     Jacobian.AddBlock2Diag(jPoint, Jacobian_jj);
 
   }
@@ -364,8 +363,7 @@ void CAdjTurbSolver::Viscous_Residual(CGeometry *geometry, CSolver **solver_cont
     LinSysRes.AddBlock(jPoint, Residual_j);
 
     Jacobian.AddBlock2Diag(iPoint, Jacobian_ii);
-    Jacobian.AddBlock(iPoint, jPoint, Jacobian_ij);
-    Jacobian.AddBlock(jPoint, iPoint, Jacobian_ji);
+    Jacobian.UpdateBlocksOffDiag(iEdge, Jacobian_ij, Jacobian_ji, 1.0, 1.0);
     Jacobian.AddBlock2Diag(jPoint, Jacobian_jj);
 
   }
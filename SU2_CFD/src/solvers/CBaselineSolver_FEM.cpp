@@ -105,9 +105,20 @@ void CBaselineSolver_FEM::SetOutputVariables(CGeometry *geometry, CConfig *confi
     filename = config->GetUnsteady_FileName(filename, SU2_TYPE::Int(TimeIter), ".dat");
   }
 
+  /*--- High-order restarts live next to the standard name with their own
+   extension, the coordinate columns are reconstructed on read. ---*/
+
+  const bool highOrderRestart = config->GetRead_HighOrder_Restart();
+
+  if (highOrderRestart) {
+    const size_t lastDot = filename.rfind('.');
+    if (lastDot != string::npos) filename.erase(lastDot);
+    filename += ".hdat";
+  }
+
   /*--- Read only the number of variables in the restart file. ---*/
 
-  if (config->GetRead_Binary_Restart()) {
+  if (config->GetRead_Binary_Restart() || highOrderRestart) {
 
     int nVar_Buf = 5;
     int var_buf[5];
@@ -134,9 +145,10 @@ void CBaselineSolver_FEM::SetOutputVariables(CGeometry *geometry, CConfig *confi
     }
 
     /*--- Check that this is an SU2 binary file. SU2 binary files
-     have the hex representation of "SU2" as the first int in the file. ---*/
+     have the hex representation of "SU2" as the first int in the file,
+     high-order restart files carry their own magic number. ---*/
 
-    if (var_buf[0] != 535532)
+    if (var_buf[0] != (highOrderRestart ? 535535 : 535532))
       SU2_MPI::Error(string("File ") + filename + string(" is not a binary SU2 restart file.\n") +
                      string("SU2 reads/writes binary restart files by default.\n") +
                      string("Note that backward compatibility for ASCII restart files is\n") +
@@ -177,9 +189,10 @@ void CBaselineSolver_FEM::SetOutputVariables(CGeometry *geometry, CConfig *confi
     SU2_MPI::Bcast(var_buf, nVar_Buf, MPI_INT, MASTER_NODE, SU2_MPI::GetComm());
 
     /*--- Check that this is an SU2 binary file. SU2 binary files
-     have the hex representation of "SU2" as the first int in the file. ---*/
+     have the hex representation of "SU2" as the first int in the file,
+     high-order restart files carry their own magic number. ---*/
 
-    if (var_buf[0] != 535532)
+    if (var_buf[0] != (highOrderRestart ? 535535 : 535532))
       SU2_MPI::Error(string("File ") + filename + string(" is not a binary SU2 restart file.\n") +
                      string("SU2 reads/writes binary restart files by default.\n") +
                      string("Note that backward compatibility for ASCII restart files is\n") +
@@ -192,9 +205,10 @@ void CBaselineSolver_FEM::SetOutputVariables(CGeometry *geometry, CConfig *confi
 #endif
 
     /*--- Set the number of variables, one per field in the
-     restart file (without including the PointID) ---*/
+     restart file (without including the PointID). The high-order format
+     does not store the coordinate columns, the reader adds them back. ---*/
 
-    nVar = var_buf[1];
+    nVar = highOrderRestart ? var_buf[1] + var_buf[4] : var_buf[1];
 
   } else {
 
@@ -327,9 +341,12 @@ void CBaselineSolver_FEM::LoadRestart(CGeometry **geometry, CSolver ***solver, C
   unsigned short rbuf_NotMatching = 0;
   unsigned long nDOF_Read = 0;
 
-  /*--- Read the restart data from either an ASCII or binary SU2 file. ---*/
+  /*--- Read the restart data from a high-order (element-collocated) file,
+   or from either an ASCII or binary SU2 file. ---*/
 
-  if (config->GetRead_Binary_Restart()) {
+  if (config->GetRead_HighOrder_Restart()) {
+    Read_SU2_Restart_HighOrder(geometry[MESH_0], config, restart_filename);
+  } else if (config->GetRead_Binary_Restart()) {
     Read_SU2_Restart_Binary(geometry[MESH_0], config, restart_filename);
   } else {
     Read_SU2_Restart_ASCII(geometry[MESH_0], config, restart_filename);
@@ -379,9 +396,8 @@ void CBaselineSolver_FEM::LoadRestart(CGeometry **geometry, CSolver ***solver, C
 
   /*--- Delete the class memory that is used to load the restart. ---*/
 
-  delete [] Restart_Vars;
-  delete [] Restart_Data;
-  Restart_Vars = nullptr; Restart_Data = nullptr;
+  delete [] Restart_Vars; Restart_Vars = nullptr;
+  FreeRestartData();
 
 }
 
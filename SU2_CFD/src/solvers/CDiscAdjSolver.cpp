@@ -473,6 +473,14 @@ void CDiscAdjSolver::SetAdjoint_Output(CGeometry *geometry, CConfig *config) {
       }
     }
 
+    /*--- In single-zone runs with a compact main tape the objective function is not part of
+     *    the tape, its cached gradient enters the fixed point through the seeding here. ---*/
+    if (!multizone && nodes->ExternalMaterialized()) {
+      for (auto iVar = 0u; iVar < nVar; iVar++) {
+        Solution[iVar] += nodes->Get_External(iPoint)[iVar];
+      }
+    }
+
     /*--- Set the adjoint values of the primal solution. ---*/
 
     direct_solver->GetNodes()->SetAdjointSolution(iPoint,Solution);
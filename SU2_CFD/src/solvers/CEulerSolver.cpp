@@ -26,6 +26,7 @@
  */
 
 #include "../../include/solvers/CEulerSolver.hpp"
+#include "../../include/numerics_simd/flow/boundary.hpp"
 #include "../../include/variables/CNSVariable.hpp"
 #include "../../../Common/include/toolboxes/geometry_toolbox.hpp"
 #include "../../../Common/include/toolboxes/printing_toolbox.hpp"
@@ -198,6 +199,11 @@ CEulerSolver::CEulerSolver(CGeometry *geometry, CConfig *config,
   AllocVectorOfVectors(nVertex, ActDisk_Fy);
   AllocVectorOfVectors(nVertex, ActDisk_Fz);
 
+  /*--- Actuator Disk radial tables and precomputed interpolation weights ---*/
+  ActDisk_RadialLoad.resize(nMarker);
+  AllocVectorOfVectors(nVertex, ActDisk_Station);
+  AllocVectorOfVectors(nVertex, ActDisk_StationWeight);
+
   /*--- Store the value of the Delta P at the Actuator Disk ---*/
 
   AllocVectorOfVectors(nVertex, ActDisk_DeltaP);
@@ -1503,6 +1509,10 @@ void CEulerSolver::CommonPreprocessing(CGeometry *geometry, CSolver **solver_con
 
   SU2_OMP_MASTER { /*--- Ops that are not OpenMP parallel go in this block. ---*/
 
+    /*--- The primitives changed, the scalar solvers must not reuse their face-state cache. ---*/
+
+    InvalidateEdgeFaceVelCache();
+
     if ((iMesh == MESH_0) && (config->GetComm_Level() == COMM_FULL)) {
       unsigned long tmp = ErrorCounter;
       SU2_MPI::Allreduce(&tmp, &ErrorCounter, 1, MPI_UNSIGNED_LONG, MPI_SUM, SU2_MPI::GetComm());
@@ -1536,8 +1546,19 @@ void CEulerSolver::CommonPreprocessing(CGeometry *geometry, CSolver **solver_con
   if (center && !Output) {
     if (!center_jst_mat) SetMax_Eigenvalue(geometry, config);
     if (center_jst || center_jst_ke || center_jst_mat) {
+      /*--- Compute the sensor and the undivided Laplacian and fuse their
+       *    halo exchanges into a single message, the per-message latency of
+       *    two small exchanges costs more than the extra bandwidth. ---*/
       SetCentered_Dissipation_Sensor(geometry, config);
-      if (!center_jst_ke) SetUndivided_Laplacian(geometry, config);
+      if (!center_jst_ke) {
+        SetUndivided_Laplacian(geometry, config);
+        InitiateComms(geometry, config, LAPLACIAN_SENSOR);
+        CompleteComms(geometry, config, LAPLACIAN_SENSOR);
+      }
+      else {
+        InitiateComms(geometry, config, SENSOR);
+        CompleteComms(geometry, config, SENSOR);
+      }
     }
   }
 
@@ -1555,7 +1576,14 @@ void CEulerSolver::CommonPreprocessing(CGeometry *geometry, CSolver **solver_con
 
   if(!ReducerStrategy && !Output) {
     LinSysRes.SetValZero();
-    if (implicit) Jacobian.SetValZero();
+
+    /*--- With Jacobian lagging the matrix and its factorization may be
+     *    reused for several iterations, in which case it is not zeroed. ---*/
+    const auto jacLag = config->GetDiscrete_Adjoint()? 1 : config->GetJacobian_Lag_Flow();
+
+    if (implicit && JacobianRefreshDue(jacLag, config->GetJacobian_Lag_Growth(),
+                                       config->GetJacobian_Lag_Sol_Change()))
+      Jacobian.SetValZero();
     else {SU2_OMP_BARRIER} // because of "nowait" in LinSysRes
   }
 
@@ -1577,6 +1605,20 @@ void CEulerSolver::Preprocessing(CGeometry *geometry, CSolver **solver_container
 
   if (!Output && muscl && !center) {
 
+    /*--- Staleness-controlled reuse: late in the inner iterations of a dual
+     *    time step the solution changes little per iteration and the
+     *    reconstruction gradients and limiters may be lagged (see GRADIENT_LAG). ---*/
+
+    const auto gradLag = config->GetDiscrete_Adjoint() ? 1 : config->GetGradient_Lag();
+    if (!GradientRefreshDue(gradLag, config->GetGradient_Lag_Growth())) return;
+
+    /*--- Fused gradient and limiter computation in one sweep over the grid,
+     *    falls back to the separate kernels if not applicable. ---*/
+
+    if (limiter && !van_albada && config->GetFused_Gradient_Limiter() &&
+        (config->GetKind_Gradient_Method_Recon() == GREEN_GAUSS) &&
+        SetPrimitive_GradientLimiter_Fused(geometry, config)) return;
+
     /*--- Gradient computation for MUSCL reconstruction. ---*/
 
     switch (config->GetKind_Gradient_Method_Recon()) {
@@ -2272,6 +2314,12 @@ void CEulerSolver::SetUndivided_Laplacian(CGeometry *geometry, const CConfig *co
   for (unsigned long iPoint = 0; iPoint < nPointDomain; ++iPoint) {
 
     const bool boundary_i = geometry->nodes->GetPhysicalBoundary(iPoint);
+
+    /*--- Cannot preaccumulate if hybrid parallel due to shared reading. ---*/
+    if (AD::Active && (omp_get_num_threads() == 1)) AD::StartPreacc();
+    AD::SetPreaccIn(nodes->GetSolution(iPoint), nVar);
+    AD::SetPreaccIn(nodes->GetPrimitive(iPoint), nPrimVar);
+
     const su2double Pressure_i = nodes->GetPressure(iPoint);
 
     /*--- Initialize. ---*/
@@ -2286,6 +2334,9 @@ void CEulerSolver::SetUndivided_Laplacian(CGeometry *geometry, const CConfig *co
       /*--- If iPoint is boundary it only takes contributions from other boundary points. ---*/
       if (boundary_i && !boundary_j) continue;
 
+      AD::SetPreaccIn(nodes->GetSolution(jPoint), nVar);
+      AD::SetPreaccIn(nodes->GetPrimitive(jPoint), nPrimVar);
+
       /*--- Add solution differences, with correction for compressible flows which use the enthalpy. ---*/
 
       for (unsigned short iVar = 0; iVar < nVar; iVar++)
@@ -2294,6 +2345,9 @@ void CEulerSolver::SetUndivided_Laplacian(CGeometry *geometry, const CConfig *co
       su2double Pressure_j = nodes->GetPressure(jPoint);
       nodes->AddUnd_Lapl(iPoint, nVar-1, Pressure_j-Pressure_i);
     }
+
+    AD::SetPreaccOut(nodes->GetUndivided_Laplacian(iPoint), nVar);
+    AD::EndPreacc();
   }
   END_SU2_OMP_FOR
 
@@ -2303,12 +2357,6 @@ void CEulerSolver::SetUndivided_Laplacian(CGeometry *geometry, const CConfig *co
     InitiatePeriodicComms(geometry, config, iPeriodic, PERIODIC_LAPLACIAN);
     CompletePeriodicComms(geometry, config, iPeriodic, PERIODIC_LAPLACIAN);
   }
-
-  /*--- MPI parallelization ---*/
-
-  InitiateComms(geometry, config, UNDIVIDED_LAPLACIAN);
-  CompleteComms(geometry, config, UNDIVIDED_LAPLACIAN);
-
 }
 
 void CEulerSolver::SetCentered_Dissipation_Sensor(CGeometry *geometry, const CConfig *config) {
@@ -2334,11 +2382,17 @@ void CEulerSolver::SetUpwind_Ducros_Sensor(CGeometry *geometry, CConfig *config)
     su2double Ducros_i = 0.0;
     const auto nNeigh = geometry->nodes->GetnPoint(iPoint);
 
+    /*--- Cannot preaccumulate if hybrid parallel due to shared reading. ---*/
+    if (AD::Active && (omp_get_num_threads() == 1)) AD::StartPreacc();
+
     for (unsigned short iNeigh = 0; iNeigh <= nNeigh; iNeigh++) {
 
       auto jPoint = iPoint; // when iNeigh == nNeigh
       if (iNeigh < nNeigh) jPoint = geometry->nodes->GetPoint(iPoint, iNeigh);
 
+      AD::SetPreaccIn(nodes->GetGradient_Primitive(jPoint), nPrimVarGrad, nDim);
+      AD::SetPreaccIn(nodes->GetVorticity(jPoint), 3);
+
       /*---- Dilatation for jPoint ---*/
 
       su2double uixi=0.0;
@@ -2366,6 +2420,9 @@ void CEulerSolver::SetUpwind_Ducros_Sensor(CGeometry *geometry, CConfig *config)
       Ducros_i = max(Ducros_i, Ducros_j);
     }
 
+    AD::SetPreaccOut(Ducros_i);
+    AD::EndPreacc();
+
     nodes->SetSensor(iPoint, Ducros_i);
   }
   END_SU2_OMP_FOR
@@ -3836,6 +3893,10 @@ void CEulerSolver::ReadActDisk_InputFile(CGeometry *geometry, CSolver **solver_c
 
       /*--- Get the marker tag of the current BC marker. ---*/
       Marker_Tag = config->GetMarker_All_TagBound(iMarker);
+
+      /*--- The radial table of this disk was already parsed, it does not change during the run. ---*/
+      if (ActDisk_RadialLoad[iMarker].size() != 0) continue;
+
       ifstream ActDisk_file;
       /*--- Open the file that contains the propeller data. ---*/
       ActDisk_file.open(ActDisk_filename.data(), ios::in);
@@ -3949,62 +4010,104 @@ void CEulerSolver::ReadActDisk_InputFile(CGeometry *geometry, CSolver **solver_c
                       (pow(AD_J,2)*PI_NUMBER*rad_v[iEl])) / config->GetPressure_Ref();
           }
 
-          /*--- Loop over the marker nodes. ---*/
-          for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
-            /*--- Get the coordinates of the current node. ---*/
-            iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
-            P = geometry->nodes->GetCoord(iPoint);
-
-            /*--- Computation of the radius coordinates for the current node. ---*/
-            GeometryToolbox::Distance(nDim, P, AD_Center, r);
-
-            /*--- Computation of the non-dimensional radius for the current node. ---*/
-            r_ = GeometryToolbox::Norm(nDim, r) / AD_Radius;
-
-            /*--- Loop over the actuator disk radial stations. ---*/
-            for (iEl = 0; iEl < nRow; iEl++){
-              /*--- Check if the current node is located between rad_v[iEl] and rad_v[iEl-1]. ---*/
-              if (r_ <= rad_v[iEl]){
-                /*--- h is the dinstance of the current node from the previous radial element (iEl-1)
-                      divided by the length of the radial element in which the node is contained. ---*/
-                h = (r_-rad_v[iEl-1])/(rad_v[iEl]-rad_v[iEl-1]);
-                /*--- Fx, Fy and Fz are the x, y and z components of the tangential and radial forces
-                      per unit area resultant. ---*/
-                if(r_ == 0.0){
-                  Fx = 0.0;
-                  Fy = 0.0;
-                  Fz = 0.0;
-                }
-                /*--- _inf is the value of the previous radial element. _sup is the value of the
-                      following radial element. ---*/
-                else{
-                  Fx_inf = (Ft[iEl-1]+Fr[iEl-1])*(r[0]/(r_*AD_Radius));
-                  Fy_inf = (Ft[iEl-1]+Fr[iEl-1])*(r[2]/(r_*AD_Radius));
-                  Fz_inf = -(Ft[iEl-1]+Fr[iEl-1])*(r[1]/(r_*AD_Radius));
-                  Fx_sup = (Ft[iEl]+Fr[iEl])*(r[0]/(r_*AD_Radius));
-                  Fy_sup = (Ft[iEl]+Fr[iEl])*(r[2]/(r_*AD_Radius));
-                  Fz_sup = -(Ft[iEl]+Fr[iEl])*(r[1]/(r_*AD_Radius));
-
-                  /*--- Fx, Fy and Fz at the current node are evaluated using a linear interpolation between
-                        the end vaues of the radial element in which the current node is contained. ---*/
-                  Fx = Fx_inf + (Fx_sup - Fx_inf)*h;
-                  Fy = Fy_inf + (Fy_sup - Fy_inf)*h;
-                  Fz = Fz_inf + (Fz_sup - Fz_inf)*h;
-                }
-                /*--- Set the values of Fa, Fx, Fy and Fz. Fa is evaluated using a linear interpolation. ---*/
-                ActDisk_Fa[iMarker][iVertex] = Fa[iEl-1] + (Fa[iEl]-Fa[iEl-1])*h;
-                ActDisk_Fx[iMarker][iVertex] = Fx;
-                ActDisk_Fy[iMarker][iVertex] = Fy;
-                ActDisk_Fz[iMarker][iVertex] = Fz;
-
-                break;
-              }
-            }
+          /*--- Store the radial table of this disk for the interpolation below,
+                it stays constant during the run. ---*/
+          ActDisk_RadialLoad[iMarker].resize(nRow,4);
+          for (iRow = 0; iRow < nRow; iRow++){
+            ActDisk_RadialLoad[iMarker](iRow,0) = rad_v[iRow];
+            ActDisk_RadialLoad[iMarker](iRow,1) = Fa[iRow];
+            ActDisk_RadialLoad[iMarker](iRow,2) = Ft[iRow];
+            ActDisk_RadialLoad[iMarker](iRow,3) = Fr[iRow];
           }
         }
       }
     }
   }
+
+  /*--- Evaluate the loads at the marker nodes using the stored radial tables. On static
+        grids this interpolation is performed only once, grid motion invalidates the cached
+        values and the stored stations give a warm start to the radial search. ---*/
+
+  if (ActDisk_LoadsCached && !dynamic_grid) return;
+
+  for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
+    if ((config->GetMarker_All_KindBC(iMarker) != ACTDISK_INLET) &&
+        (config->GetMarker_All_KindBC(iMarker) != ACTDISK_OUTLET)) continue;
+
+    const su2activematrix& table = ActDisk_RadialLoad[iMarker];
+    const int nStation = static_cast<int>(table.rows());
+    if (nStation == 0) continue;
+
+    AD_Radius = ActDisk_R(iMarker);
+    for (iDim = 0; iDim < nDim; iDim++) AD_Center[iDim] = ActDisk_C(iMarker, iDim);
+
+    /*--- Loop over the marker nodes. ---*/
+    for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
+      /*--- Get the coordinates of the current node. ---*/
+      iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+      P = geometry->nodes->GetCoord(iPoint);
+
+      /*--- Computation of the radius coordinates for the current node. ---*/
+      GeometryToolbox::Distance(nDim, P, AD_Center, r);
+
+      /*--- Computation of the non-dimensional radius for the current node. ---*/
+      r_ = GeometryToolbox::Norm(nDim, r) / AD_Radius;
+
+      /*--- Locate the radial station that contains the current node, reusing the
+            cached station as a warm start when its bracket is still valid. ---*/
+      iEl = static_cast<int>(ActDisk_Station[iMarker][iVertex]);
+      if ((iEl < 1) || (iEl >= nStation) || (r_ > table(iEl,0)) || (r_ <= table(iEl-1,0))) {
+        for (iEl = 0; iEl < nStation; iEl++)
+          if (r_ <= table(iEl,0)) break;
+        /*--- Clamp to the first radial element, the disk center is handled below. ---*/
+        if (iEl == 0) iEl = 1;
+      }
+
+      /*--- Node outside of the radial table, keep the default (zero) loads. ---*/
+      if (iEl == nStation) {
+        ActDisk_Station[iMarker][iVertex] = nStation;
+        continue;
+      }
+
+      /*--- h is the dinstance of the current node from the previous radial element (iEl-1)
+            divided by the length of the radial element in which the node is contained. ---*/
+      h = (r_ - table(iEl-1,0))/(table(iEl,0) - table(iEl-1,0));
+
+      ActDisk_Station[iMarker][iVertex] = iEl;
+      ActDisk_StationWeight[iMarker][iVertex] = h;
+
+      /*--- Fx, Fy and Fz are the x, y and z components of the tangential and radial forces
+            per unit area resultant. ---*/
+      if (r_ == 0.0){
+        Fx = 0.0;
+        Fy = 0.0;
+        Fz = 0.0;
+      }
+      /*--- _inf is the value of the previous radial element. _sup is the value of the
+            following radial element. ---*/
+      else{
+        Fx_inf = (table(iEl-1,2)+table(iEl-1,3))*(r[0]/(r_*AD_Radius));
+        Fy_inf = (table(iEl-1,2)+table(iEl-1,3))*(r[2]/(r_*AD_Radius));
+        Fz_inf = -(table(iEl-1,2)+table(iEl-1,3))*(r[1]/(r_*AD_Radius));
+        Fx_sup = (table(iEl,2)+table(iEl,3))*(r[0]/(r_*AD_Radius));
+        Fy_sup = (table(iEl,2)+table(iEl,3))*(r[2]/(r_*AD_Radius));
+        Fz_sup = -(table(iEl,2)+table(iEl,3))*(r[1]/(r_*AD_Radius));
+
+        /*--- Fx, Fy and Fz at the current node are evaluated using a linear interpolation between
+              the end vaues of the radial element in which the current node is contained. ---*/
+        Fx = Fx_inf + (Fx_sup - Fx_inf)*h;
+        Fy = Fy_inf + (Fy_sup - Fy_inf)*h;
+        Fz = Fz_inf + (Fz_sup - Fz_inf)*h;
+      }
+      /*--- Set the values of Fa, Fx, Fy and Fz. Fa is evaluated using a linear interpolation. ---*/
+      ActDisk_Fa[iMarker][iVertex] = table(iEl-1,1) + (table(iEl,1)-table(iEl-1,1))*h;
+      ActDisk_Fx[iMarker][iVertex] = Fx;
+      ActDisk_Fy[iMarker][iVertex] = Fy;
+      ActDisk_Fz[iMarker][iVertex] = Fz;
+    }
+  }
+
+  ActDisk_LoadsCached = true;
 }
 
 void CEulerSolver::SetFarfield_AoA(CGeometry *geometry, CSolver **solver_container,
@@ -4291,6 +4394,24 @@ void CEulerSolver::BC_Far_Field(CGeometry *geometry, CSolver **solver_container,
   bool viscous        = config->GetViscous();
   bool tkeNeeded = (config->GetKind_Turb_Model() == TURB_MODEL::SST) || (config->GetKind_Turb_Model() == TURB_MODEL::SST_SUST);
 
+  /*--- When the vectorized edge loop is active, apply the convective part of the
+     boundary condition with the batched SIMD kernel (same Roe scheme), the scalar
+     loop below then only needs to handle the viscous contribution. ---*/
+
+  const bool batchedBC = config->GetUseVectorization() && !dynamic_grid &&
+                         (config->GetKind_Upwind_Flow() == ROE);
+
+  if (batchedBC) {
+    const su2double tkeInf = tkeNeeded? GetTke_Inf() : su2double(0.0);
+    if (nDim == 2) computeFarfieldBCFluxes<2>(*config, *geometry, *nodes, val_marker, Velocity_Inf,
+                                              Density_Inf, Pressure_Inf, tkeInf,
+                                              CharacPrimVar[val_marker], LinSysRes, Jacobian);
+    else computeFarfieldBCFluxes<3>(*config, *geometry, *nodes, val_marker, Velocity_Inf,
+                                    Density_Inf, Pressure_Inf, tkeInf,
+                                    CharacPrimVar[val_marker], LinSysRes, Jacobian);
+    if (!viscous) return;
+  }
+
   su2double *Normal = new su2double[nDim];
 
   /*--- Loop over all the vertices on this boundary marker ---*/
@@ -4314,165 +4435,170 @@ void CEulerSolver::BC_Far_Field(CGeometry *geometry, CSolver **solver_container,
 
       geometry->vertex[val_marker][iVertex]->GetNormal(Normal);
       for (iDim = 0; iDim < nDim; iDim++) Normal[iDim] = -Normal[iDim];
-      conv_numerics->SetNormal(Normal);
 
       /*--- Retrieve solution at the farfield boundary node ---*/
       V_domain = nodes->GetPrimitive(iPoint);
 
-      /*--- Construct solution state at infinity for compressible flow by
-         using Riemann invariants, and then impose a weak boundary condition
-         by computing the flux using this new state for U. See CFD texts by
-         Hirsch or Blazek for more detail. Adapted from an original
-         implementation in the Stanford University multi-block (SUmb) solver
-         in the routine bcFarfield.f90 written by Edwin van der Weide,
-         last modified 06-12-2005. First, compute the unit normal at the
-         boundary nodes. ---*/
+      if (!batchedBC) {
 
-      Area = GeometryToolbox::Norm(nDim, Normal);
-      for (iDim = 0; iDim < nDim; iDim++)
-        UnitNormal[iDim] = Normal[iDim]/Area;
+        conv_numerics->SetNormal(Normal);
 
-      /*--- Store primitive variables (density, velocities, velocity squared,
-         energy, pressure, and sound speed) at the boundary node, and set some
-         other quantities for clarity. Project the current flow velocity vector
-         at this boundary node into the local normal direction, i.e. compute
-         v_bound.n.  ---*/
+        /*--- Construct solution state at infinity for compressible flow by
+           using Riemann invariants, and then impose a weak boundary condition
+           by computing the flux using this new state for U. See CFD texts by
+           Hirsch or Blazek for more detail. Adapted from an original
+           implementation in the Stanford University multi-block (SUmb) solver
+           in the routine bcFarfield.f90 written by Edwin van der Weide,
+           last modified 06-12-2005. First, compute the unit normal at the
+           boundary nodes. ---*/
 
-      Density_Bound = V_domain[nDim+2];
-      Vel2_Bound = 0.0; Vn_Bound = 0.0;
-      for (iDim = 0; iDim < nDim; iDim++) {
-        Vel_Bound[iDim] = V_domain[iDim+1];
-        Vel2_Bound     += Vel_Bound[iDim]*Vel_Bound[iDim];
-        Vn_Bound       += Vel_Bound[iDim]*UnitNormal[iDim];
-      }
-      Pressure_Bound   = nodes->GetPressure(iPoint);
-      SoundSpeed_Bound = sqrt(Gamma*Pressure_Bound/Density_Bound);
-      Entropy_Bound    = pow(Density_Bound, Gamma)/Pressure_Bound;
+        Area = GeometryToolbox::Norm(nDim, Normal);
+        for (iDim = 0; iDim < nDim; iDim++)
+          UnitNormal[iDim] = Normal[iDim]/Area;
 
-      /*--- Store the primitive variable state for the freestream. Project
-         the freestream velocity vector into the local normal direction,
-         i.e. compute v_infty.n. ---*/
+        /*--- Store primitive variables (density, velocities, velocity squared,
+           energy, pressure, and sound speed) at the boundary node, and set some
+           other quantities for clarity. Project the current flow velocity vector
+           at this boundary node into the local normal direction, i.e. compute
+           v_bound.n.  ---*/
 
-      Density_Infty = GetDensity_Inf();
-      Vel2_Infty = 0.0; Vn_Infty = 0.0;
-      for (iDim = 0; iDim < nDim; iDim++) {
-        Vel_Infty[iDim] = GetVelocity_Inf(iDim);
-        Vel2_Infty     += Vel_Infty[iDim]*Vel_Infty[iDim];
-        Vn_Infty       += Vel_Infty[iDim]*UnitNormal[iDim];
-      }
-      Pressure_Infty   = GetPressure_Inf();
-      SoundSpeed_Infty = sqrt(Gamma*Pressure_Infty/Density_Infty);
-      Entropy_Infty    = pow(Density_Infty, Gamma)/Pressure_Infty;
+        Density_Bound = V_domain[nDim+2];
+        Vel2_Bound = 0.0; Vn_Bound = 0.0;
+        for (iDim = 0; iDim < nDim; iDim++) {
+          Vel_Bound[iDim] = V_domain[iDim+1];
+          Vel2_Bound     += Vel_Bound[iDim]*Vel_Bound[iDim];
+          Vn_Bound       += Vel_Bound[iDim]*UnitNormal[iDim];
+        }
+        Pressure_Bound   = nodes->GetPressure(iPoint);
+        SoundSpeed_Bound = sqrt(Gamma*Pressure_Bound/Density_Bound);
+        Entropy_Bound    = pow(Density_Bound, Gamma)/Pressure_Bound;
 
-      /*--- Adjust the normal freestream velocity for grid movement ---*/
+        /*--- Store the primitive variable state for the freestream. Project
+           the freestream velocity vector into the local normal direction,
+           i.e. compute v_infty.n. ---*/
 
-      Qn_Infty = Vn_Infty;
-      if (dynamic_grid) {
-        GridVel = geometry->nodes->GetGridVel(iPoint);
-        for (iDim = 0; iDim < nDim; iDim++)
-          Qn_Infty -= GridVel[iDim]*UnitNormal[iDim];
-      }
+        Density_Infty = GetDensity_Inf();
+        Vel2_Infty = 0.0; Vn_Infty = 0.0;
+        for (iDim = 0; iDim < nDim; iDim++) {
+          Vel_Infty[iDim] = GetVelocity_Inf(iDim);
+          Vel2_Infty     += Vel_Infty[iDim]*Vel_Infty[iDim];
+          Vn_Infty       += Vel_Infty[iDim]*UnitNormal[iDim];
+        }
+        Pressure_Infty   = GetPressure_Inf();
+        SoundSpeed_Infty = sqrt(Gamma*Pressure_Infty/Density_Infty);
+        Entropy_Infty    = pow(Density_Infty, Gamma)/Pressure_Infty;
 
-      /*--- Compute acoustic Riemann invariants: R = u.n +/- 2c/(gamma-1).
-         These correspond with the eigenvalues (u+c) and (u-c), respectively,
-         which represent the acoustic waves. Positive characteristics are
-         incoming, and a physical boundary condition is imposed (freestream
-         state). This occurs when either (u.n+c) > 0 or (u.n-c) > 0. Negative
-         characteristics are leaving the domain, and numerical boundary
-         conditions are required by extrapolating from the interior state
-         using the Riemann invariants. This occurs when (u.n+c) < 0 or
-         (u.n-c) < 0. Note that grid movement is taken into account when
-         checking the sign of the eigenvalue. ---*/
-
-      /*--- Check whether (u.n+c) is greater or less than zero ---*/
-
-      if (Qn_Infty > -SoundSpeed_Infty) {
-        /*--- Subsonic inflow or outflow ---*/
-        RiemannPlus = Vn_Bound + 2.0*SoundSpeed_Bound/Gamma_Minus_One;
-      } else {
-        /*--- Supersonic inflow ---*/
-        RiemannPlus = Vn_Infty + 2.0*SoundSpeed_Infty/Gamma_Minus_One;
-      }
+        /*--- Adjust the normal freestream velocity for grid movement ---*/
 
-      /*--- Check whether (u.n-c) is greater or less than zero ---*/
+        Qn_Infty = Vn_Infty;
+        if (dynamic_grid) {
+          GridVel = geometry->nodes->GetGridVel(iPoint);
+          for (iDim = 0; iDim < nDim; iDim++)
+            Qn_Infty -= GridVel[iDim]*UnitNormal[iDim];
+        }
 
-      if (Qn_Infty > SoundSpeed_Infty) {
-        /*--- Supersonic outflow ---*/
-        RiemannMinus = Vn_Bound - 2.0*SoundSpeed_Bound/Gamma_Minus_One;
-      } else {
-        /*--- Subsonic outflow ---*/
-        RiemannMinus = Vn_Infty - 2.0*SoundSpeed_Infty/Gamma_Minus_One;
-      }
+        /*--- Compute acoustic Riemann invariants: R = u.n +/- 2c/(gamma-1).
+           These correspond with the eigenvalues (u+c) and (u-c), respectively,
+           which represent the acoustic waves. Positive characteristics are
+           incoming, and a physical boundary condition is imposed (freestream
+           state). This occurs when either (u.n+c) > 0 or (u.n-c) > 0. Negative
+           characteristics are leaving the domain, and numerical boundary
+           conditions are required by extrapolating from the interior state
+           using the Riemann invariants. This occurs when (u.n+c) < 0 or
+           (u.n-c) < 0. Note that grid movement is taken into account when
+           checking the sign of the eigenvalue. ---*/
+
+        /*--- Check whether (u.n+c) is greater or less than zero ---*/
+
+        if (Qn_Infty > -SoundSpeed_Infty) {
+          /*--- Subsonic inflow or outflow ---*/
+          RiemannPlus = Vn_Bound + 2.0*SoundSpeed_Bound/Gamma_Minus_One;
+        } else {
+          /*--- Supersonic inflow ---*/
+          RiemannPlus = Vn_Infty + 2.0*SoundSpeed_Infty/Gamma_Minus_One;
+        }
 
-      /*--- Compute a new value for the local normal velocity and speed of
-         sound from the Riemann invariants. ---*/
+        /*--- Check whether (u.n-c) is greater or less than zero ---*/
 
-      Vn = 0.5 * (RiemannPlus + RiemannMinus);
-      SoundSpeed = 0.25 * (RiemannPlus - RiemannMinus)*Gamma_Minus_One;
+        if (Qn_Infty > SoundSpeed_Infty) {
+          /*--- Supersonic outflow ---*/
+          RiemannMinus = Vn_Bound - 2.0*SoundSpeed_Bound/Gamma_Minus_One;
+        } else {
+          /*--- Subsonic outflow ---*/
+          RiemannMinus = Vn_Infty - 2.0*SoundSpeed_Infty/Gamma_Minus_One;
+        }
 
-      /*--- Construct the primitive variable state at the boundary for
-         computing the flux for the weak boundary condition. The values
-         that we choose to construct the solution (boundary or freestream)
-         depend on whether we are at an inflow or outflow. At an outflow, we
-         choose boundary information (at most one characteristic is incoming),
-         while at an inflow, we choose infinity values (at most one
-         characteristic is outgoing). ---*/
+        /*--- Compute a new value for the local normal velocity and speed of
+           sound from the Riemann invariants. ---*/
 
-      if (Qn_Infty > 0.0)   {
-        /*--- Outflow conditions ---*/
-        for (iDim = 0; iDim < nDim; iDim++)
-          Velocity[iDim] = Vel_Bound[iDim] + (Vn-Vn_Bound)*UnitNormal[iDim];
-        Entropy = Entropy_Bound;
-      } else  {
-        /*--- Inflow conditions ---*/
-        for (iDim = 0; iDim < nDim; iDim++)
-          Velocity[iDim] = Vel_Infty[iDim] + (Vn-Vn_Infty)*UnitNormal[iDim];
-        Entropy = Entropy_Infty;
-      }
+        Vn = 0.5 * (RiemannPlus + RiemannMinus);
+        SoundSpeed = 0.25 * (RiemannPlus - RiemannMinus)*Gamma_Minus_One;
 
-      /*--- Recompute the primitive variables. ---*/
+        /*--- Construct the primitive variable state at the boundary for
+           computing the flux for the weak boundary condition. The values
+           that we choose to construct the solution (boundary or freestream)
+           depend on whether we are at an inflow or outflow. At an outflow, we
+           choose boundary information (at most one characteristic is incoming),
+           while at an inflow, we choose infinity values (at most one
+           characteristic is outgoing). ---*/
 
-      Density = pow(Entropy*SoundSpeed*SoundSpeed/Gamma,1.0/Gamma_Minus_One);
-      Velocity2 = 0.0;
-      for (iDim = 0; iDim < nDim; iDim++) {
-        Velocity2 += Velocity[iDim]*Velocity[iDim];
-      }
-      Pressure = Density*SoundSpeed*SoundSpeed/Gamma;
-      Energy   = Pressure/(Gamma_Minus_One*Density) + 0.5*Velocity2;
-      if (tkeNeeded) Energy += GetTke_Inf();
+        if (Qn_Infty > 0.0)   {
+          /*--- Outflow conditions ---*/
+          for (iDim = 0; iDim < nDim; iDim++)
+            Velocity[iDim] = Vel_Bound[iDim] + (Vn-Vn_Bound)*UnitNormal[iDim];
+          Entropy = Entropy_Bound;
+        } else  {
+          /*--- Inflow conditions ---*/
+          for (iDim = 0; iDim < nDim; iDim++)
+            Velocity[iDim] = Vel_Infty[iDim] + (Vn-Vn_Infty)*UnitNormal[iDim];
+          Entropy = Entropy_Infty;
+        }
 
-      /*--- Store new primitive state for computing the flux. ---*/
+        /*--- Recompute the primitive variables. ---*/
 
-      V_infty[0] = Pressure/(Gas_Constant*Density);
-      for (iDim = 0; iDim < nDim; iDim++)
-        V_infty[iDim+1] = Velocity[iDim];
-      V_infty[nDim+1] = Pressure;
-      V_infty[nDim+2] = Density;
-      V_infty[nDim+3] = Energy + Pressure/Density;
+        Density = pow(Entropy*SoundSpeed*SoundSpeed/Gamma,1.0/Gamma_Minus_One);
+        Velocity2 = 0.0;
+        for (iDim = 0; iDim < nDim; iDim++) {
+          Velocity2 += Velocity[iDim]*Velocity[iDim];
+        }
+        Pressure = Density*SoundSpeed*SoundSpeed/Gamma;
+        Energy   = Pressure/(Gamma_Minus_One*Density) + 0.5*Velocity2;
+        if (tkeNeeded) Energy += GetTke_Inf();
 
+        /*--- Store new primitive state for computing the flux. ---*/
 
+        V_infty[0] = Pressure/(Gas_Constant*Density);
+        for (iDim = 0; iDim < nDim; iDim++)
+          V_infty[iDim+1] = Velocity[iDim];
+        V_infty[nDim+1] = Pressure;
+        V_infty[nDim+2] = Density;
+        V_infty[nDim+3] = Energy + Pressure/Density;
 
-      /*--- Set various quantities in the numerics class ---*/
 
-      conv_numerics->SetPrimitive(V_domain, V_infty);
 
-      if (dynamic_grid) {
-        conv_numerics->SetGridVel(geometry->nodes->GetGridVel(iPoint),
-                                  geometry->nodes->GetGridVel(iPoint));
-      }
+        /*--- Set various quantities in the numerics class ---*/
 
-      /*--- Compute the convective residual using an upwind scheme ---*/
+        conv_numerics->SetPrimitive(V_domain, V_infty);
 
-      auto residual = conv_numerics->ComputeResidual(config);
+        if (dynamic_grid) {
+          conv_numerics->SetGridVel(geometry->nodes->GetGridVel(iPoint),
+                                    geometry->nodes->GetGridVel(iPoint));
+        }
 
-      /*--- Update residual value ---*/
+        /*--- Compute the convective residual using an upwind scheme ---*/
 
-      LinSysRes.AddBlock(iPoint, residual);
+        auto residual = conv_numerics->ComputeResidual(config);
 
-      /*--- Convective Jacobian contribution for implicit integration ---*/
+        /*--- Update residual value ---*/
 
-      if (implicit)
-        Jacobian.AddBlock2Diag(iPoint, residual.jacobian_i);
+        LinSysRes.AddBlock(iPoint, residual);
+
+        /*--- Convective Jacobian contribution for implicit integration ---*/
+
+        if (implicit)
+          Jacobian.AddBlock2Diag(iPoint, residual.jacobian_i);
+
+      }
 
       /*--- Viscous residual contribution ---*/
 
@@ -6761,7 +6887,6 @@ void CEulerSolver::BC_Outlet(CGeometry *geometry, CSolver **solver_container,
 
   bool implicit           = (config->GetKind_TimeIntScheme() == EULER_IMPLICIT);
   su2double Gas_Constant     = config->GetGas_ConstantND();
-  string Marker_Tag       = config->GetMarker_All_TagBound(val_marker);
   bool gravity = (config->GetGravityForce());
   bool tkeNeeded = (config->GetKind_Turb_Model() == TURB_MODEL::SST) || (config->GetKind_Turb_Model() == TURB_MODEL::SST_SUST);
   su2double *Normal = new su2double[nDim];
@@ -6794,8 +6919,8 @@ void CEulerSolver::BC_Outlet(CGeometry *geometry, CSolver **solver_container,
       /*--- Build the fictitious inlet state based on characteristics ---*/
 
       /*--- Retrieve the specified back pressure for this outlet. ---*/
-      if (gravity) P_Exit = config->GetOutlet_Pressure(Marker_Tag) - geometry->nodes->GetCoord(iPoint, nDim-1)*STANDARD_GRAVITY;
-      else P_Exit = config->GetOutlet_Pressure(Marker_Tag);
+      if (gravity) P_Exit = config->GetOutlet_Pressure(val_marker) - geometry->nodes->GetCoord(iPoint, nDim-1)*STANDARD_GRAVITY;
+      else P_Exit = config->GetOutlet_Pressure(val_marker);
 
       /*--- Non-dim. the inputs if necessary. ---*/
       P_Exit = P_Exit/config->GetPressure_Ref();
@@ -6933,7 +7058,6 @@ void CEulerSolver::BC_Supersonic_Inlet(CGeometry *geometry, CSolver **solver_con
   su2double Gas_Constant = config->GetGas_ConstantND();
 
   bool implicit = (config->GetKind_TimeIntScheme() == EULER_IMPLICIT);
-  string Marker_Tag = config->GetMarker_All_TagBound(val_marker);
   bool tkeNeeded = (config->GetKind_Turb_Model() == TURB_MODEL::SST) || (config->GetKind_Turb_Model() == TURB_MODEL::SST_SUST);
   su2double *Normal = new su2double[nDim];
   su2double *Velocity = new su2double[nDim];
@@ -6942,9 +7066,9 @@ void CEulerSolver::BC_Supersonic_Inlet(CGeometry *geometry, CSolver **solver_con
    so all flow variables can be imposed at the inlet.
    First, retrieve the specified values for the primitive variables. ---*/
 
-  auto Temperature = config->GetInlet_Temperature(Marker_Tag);
-  auto Pressure    = config->GetInlet_Pressure(Marker_Tag);
-  auto Vel         = config->GetInlet_Velocity(Marker_Tag);
+  auto Temperature = config->GetInlet_Temperature(val_marker);
+  auto Pressure    = config->GetInlet_Pressure(val_marker);
+  auto Vel         = config->GetInlet_Velocity(val_marker);
 
   /*--- Non-dim. the inputs if necessary. ---*/
 
@@ -8639,6 +8763,14 @@ void CEulerSolver::TurboAverageProcess(CSolver **solver, CGeometry *geometry, CC
 
   const auto nSpanWiseSections = config->GetnSpanWiseSections();
 
+  /*--- The spanwise sums of all spans are packed into one buffer and reduced with a
+   single collective for the entire call, instead of ~20 reductions per span whose
+   latency dominates the averaging at scale (it grows with span and rank count). ---*/
+
+  const unsigned short nTurbScalar = 15;
+  const unsigned long spanStride = nTurbScalar + nVar + 3*nDim;
+  vector<su2double> spanBuffer((nSpanWiseSections + 1)*spanStride, 0.0);
+
   for (iSpan= 0; iSpan < nSpanWiseSections + 1; iSpan++){
 
     /*--- Forces initialization for contenitors ---*/
@@ -8832,49 +8964,55 @@ void CEulerSolver::TurboAverageProcess(CSolver **solver, CGeometry *geometry, CC
       }
     }
 
-#ifdef HAVE_MPI
+    /*--- Pack the local sums of this span into the fused reduction buffer. ---*/
 
-    /*--- Add information using all the nodes ---*/
+    su2double* packSums = &spanBuffer[iSpan*spanStride];
+
+    packSums[0]  = TotalDensity;      packSums[1]  = TotalPressure;
+    packSums[2]  = TotalAreaDensity;  packSums[3]  = TotalAreaPressure;
+    packSums[4]  = TotalMassDensity;  packSums[5]  = TotalMassPressure;
+    packSums[6]  = TotalNu;           packSums[7]  = TotalKine;         packSums[8]  = TotalOmega;
+    packSums[9]  = TotalAreaNu;       packSums[10] = TotalAreaKine;     packSums[11] = TotalAreaOmega;
+    packSums[12] = TotalMassNu;       packSums[13] = TotalMassKine;     packSums[14] = TotalMassOmega;
 
-    auto Allreduce = [](su2double x) {
-      su2double tmp = x; x = 0.0;
-      SU2_MPI::Allreduce(&tmp, &x, 1, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
-      return x;
-    };
+    unsigned long packOffset = nTurbScalar;
+    for (iVar = 0; iVar < nVar; iVar++) packSums[packOffset++] = TotalFluxes[iVar];
+    for (iDim = 0; iDim < nDim; iDim++) packSums[packOffset++] = TotalVelocity[iDim];
+    for (iDim = 0; iDim < nDim; iDim++) packSums[packOffset++] = TotalAreaVelocity[iDim];
+    for (iDim = 0; iDim < nDim; iDim++) packSums[packOffset++] = TotalMassVelocity[iDim];
+  }
+
+#ifdef HAVE_MPI
 
-    TotalDensity = Allreduce(TotalDensity);
-    TotalPressure = Allreduce(TotalPressure);
-    TotalAreaDensity = Allreduce(TotalAreaDensity);
-    TotalAreaPressure = Allreduce(TotalAreaPressure);
-    TotalMassDensity = Allreduce(TotalMassDensity);
-    TotalMassPressure = Allreduce(TotalMassPressure);
+  /*--- Add information using all the nodes, one fused reduction for all spans. ---*/
 
-    TotalNu = Allreduce(TotalNu);
-    TotalKine = Allreduce(TotalKine);
-    TotalOmega = Allreduce(TotalOmega);
-    TotalAreaNu = Allreduce(TotalAreaNu);
-    TotalAreaKine = Allreduce(TotalAreaKine);
-    TotalAreaOmega = Allreduce(TotalAreaOmega);
+  {
+    vector<su2double> recvBuffer(spanBuffer.size());
+    SU2_MPI::Allreduce(spanBuffer.data(), recvBuffer.data(), static_cast<int>(spanBuffer.size()),
+                       MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
+    spanBuffer = std::move(recvBuffer);
+  }
 
-    TotalMassNu = Allreduce(TotalMassNu);
-    TotalMassKine = Allreduce(TotalMassKine);
-    TotalMassOmega = Allreduce(TotalMassOmega);
+#endif
 
-    su2double* buffer = new su2double[max(nVar,nDim)];
+  for (iSpan= 0; iSpan < nSpanWiseSections + 1; iSpan++){
 
-    auto Allreduce_inplace = [buffer](int size, su2double* x) {
-      SU2_MPI::Allreduce(x, buffer, size, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
-      for(int i=0; i<size; ++i) x[i] = buffer[i];
-    };
+    /*--- Unpack the reduced sums of this span. ---*/
 
-    Allreduce_inplace(nVar, TotalFluxes);
-    Allreduce_inplace(nDim, TotalVelocity);
-    Allreduce_inplace(nDim, TotalAreaVelocity);
-    Allreduce_inplace(nDim, TotalMassVelocity);
+    const su2double* sums = &spanBuffer[iSpan*spanStride];
 
-    delete [] buffer;
+    TotalDensity      = sums[0];  TotalPressure     = sums[1];
+    TotalAreaDensity  = sums[2];  TotalAreaPressure = sums[3];
+    TotalMassDensity  = sums[4];  TotalMassPressure = sums[5];
+    TotalNu      = sums[6];  TotalKine     = sums[7];  TotalOmega     = sums[8];
+    TotalAreaNu  = sums[9];  TotalAreaKine = sums[10]; TotalAreaOmega = sums[11];
+    TotalMassNu  = sums[12]; TotalMassKine = sums[13]; TotalMassOmega = sums[14];
 
-#endif
+    unsigned long unpackOffset = nTurbScalar;
+    for (iVar = 0; iVar < nVar; iVar++) TotalFluxes[iVar] = sums[unpackOffset++];
+    for (iDim = 0; iDim < nDim; iDim++) TotalVelocity[iDim] = sums[unpackOffset++];
+    for (iDim = 0; iDim < nDim; iDim++) TotalAreaVelocity[iDim] = sums[unpackOffset++];
+    for (iDim = 0; iDim < nDim; iDim++) TotalMassVelocity[iDim] = sums[unpackOffset++];
 
     for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++){
       for (iMarkerTP=1; iMarkerTP < config->GetnMarker_Turbomachinery()+1; iMarkerTP++){
@@ -9256,27 +9394,70 @@ void CEulerSolver::GatherInOutAverageValues(CConfig *config, CGeometry *geometry
 
   const auto nSpanWiseSections = config->GetnSpanWiseSections();
 
+  /*--- All spanwise sections are packed into a single buffer (8 inflow values, 8 outflow
+   *    values, and the turbomachinery marker per span) so that only one collective is
+   *    needed for the entire routine instead of three gathers per span. ---*/
+  const unsigned short nPerfIn = 8, nPerfOut = 8;
+  const unsigned long spanStride = nPerfIn + nPerfOut + 1;
+  const unsigned long sendCount = (nSpanWiseSections + 1)*spanStride;
+  vector<su2double> sendBuffer(sendCount, -1.0);
+
   for (iSpan= 0; iSpan < nSpanWiseSections + 1 ; iSpan++) {
 
+    su2double* perfIn  = &sendBuffer[iSpan*spanStride];
+    su2double* perfOut = perfIn + nPerfIn;
+
+    for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++){
+      for (iMarkerTP = 1; iMarkerTP < config->GetnMarker_Turbomachinery()+1; iMarkerTP++){
+        if (config->GetMarker_All_Turbomachinery(iMarker) == iMarkerTP){
+          if (config->GetMarker_All_TurbomachineryFlag(iMarker) == INFLOW){
+            perfIn[0]  = DensityIn[iMarkerTP -1][iSpan];
+            perfIn[1]  = PressureIn[iMarkerTP -1][iSpan];
+            perfIn[2]  = TurboVelocityIn[iMarkerTP -1][iSpan][0];
+            perfIn[3]  = TurboVelocityIn[iMarkerTP -1][iSpan][1];
+            if (nDim ==3){
+              perfIn[4] = TurboVelocityIn[iMarkerTP -1][iSpan][2];
+            }
+            perfIn[5]  = KineIn[iMarkerTP -1][iSpan];
+            perfIn[6]  = OmegaIn[iMarkerTP -1][iSpan];
+            perfIn[7]  = NuIn[iMarkerTP -1][iSpan];
+
+            perfOut[nPerfOut] = su2double(iMarkerTP);
+          }
+
+          /*--- retrieve outlet information ---*/
+          if (config->GetMarker_All_TurbomachineryFlag(iMarker) == OUTFLOW){
+            perfOut[0]  = DensityOut[iMarkerTP -1][iSpan];
+            perfOut[1]  = PressureOut[iMarkerTP -1][iSpan];
+            perfOut[2]  = TurboVelocityOut[iMarkerTP -1][iSpan][0];
+            perfOut[3]  = TurboVelocityOut[iMarkerTP -1][iSpan][1];
+            if (nDim ==3){
+              perfOut[4] = TurboVelocityOut[iMarkerTP -1][iSpan][2];
+            }
+            perfOut[5]  = KineOut[iMarkerTP -1][iSpan];
+            perfOut[6]  = OmegaOut[iMarkerTP -1][iSpan];
+            perfOut[7]  = NuOut[iMarkerTP -1][iSpan];
+          }
+        }
+      }
+    }
+  }
+
+  vector<su2double> recvBuffer;
+
 #ifdef HAVE_MPI
-    unsigned short i, n1, n2, n1t,n2t;
-    su2double *TurbPerfIn= NULL,*TurbPerfOut= NULL;
-    su2double *TotTurbPerfIn = NULL,*TotTurbPerfOut = NULL;
-    int *TotMarkerTP = NULL;
-
-    n1          = 8;
-    n2          = 8;
-    n1t         = n1*size;
-    n2t         = n2*size;
-    TurbPerfIn  = new su2double[n1];
-    TurbPerfOut = new su2double[n2];
-
-    for (i=0;i<n1;i++)
-      TurbPerfIn[i]    = -1.0;
-    for (i=0;i<n2;i++)
-      TurbPerfOut[i]   = -1.0;
+  if (rank == MASTER_NODE) recvBuffer.resize(sendCount*size, -1.0);
+  SU2_MPI::Gather(sendBuffer.data(), static_cast<int>(sendCount), MPI_DOUBLE,
+                  recvBuffer.data(), static_cast<int>(sendCount), MPI_DOUBLE,
+                  MASTER_NODE, SU2_MPI::GetComm());
+#else
+  recvBuffer = std::move(sendBuffer);
 #endif
 
+  if (rank != MASTER_NODE) return;
+
+  for (iSpan= 0; iSpan < nSpanWiseSections + 1 ; iSpan++) {
+
     densityIn            = -1.0;
     pressureIn           = -1.0;
     normalVelocityIn     = -1.0;
@@ -9296,114 +9477,35 @@ void CEulerSolver::GatherInOutAverageValues(CConfig *config, CGeometry *geometry
 
     markerTP             = -1;
 
-    for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++){
-      for (iMarkerTP = 1; iMarkerTP < config->GetnMarker_Turbomachinery()+1; iMarkerTP++){
-        if (config->GetMarker_All_Turbomachinery(iMarker) == iMarkerTP){
-          if (config->GetMarker_All_TurbomachineryFlag(iMarker) == INFLOW){
-            markerTP            = iMarkerTP;
-            densityIn           = DensityIn[iMarkerTP -1][iSpan];
-            pressureIn          = PressureIn[iMarkerTP -1][iSpan];
-            normalVelocityIn    = TurboVelocityIn[iMarkerTP -1][iSpan][0];
-            tangVelocityIn      = TurboVelocityIn[iMarkerTP -1][iSpan][1];
-            if (nDim ==3){
-              radialVelocityIn  = TurboVelocityIn[iMarkerTP -1][iSpan][2];
-            }
-            kineIn              = KineIn[iMarkerTP -1][iSpan];
-            omegaIn             = OmegaIn[iMarkerTP -1][iSpan];
-            nuIn                = NuIn[iMarkerTP -1][iSpan];
-
-#ifdef HAVE_MPI
-            TurbPerfIn[0]  = densityIn;
-            TurbPerfIn[1]  = pressureIn;
-            TurbPerfIn[2]  = normalVelocityIn;
-            TurbPerfIn[3]  = tangVelocityIn;
-            TurbPerfIn[4]  = radialVelocityIn;
-            TurbPerfIn[5]  = kineIn;
-            TurbPerfIn[6]  = omegaIn;
-            TurbPerfIn[7]  = nuIn;
-#endif
-          }
-
-          /*--- retrieve outlet information ---*/
-          if (config->GetMarker_All_TurbomachineryFlag(iMarker) == OUTFLOW){
-            densityOut           = DensityOut[iMarkerTP -1][iSpan];
-            pressureOut          = PressureOut[iMarkerTP -1][iSpan];
-            normalVelocityOut    = TurboVelocityOut[iMarkerTP -1][iSpan][0];
-            tangVelocityOut      = TurboVelocityOut[iMarkerTP -1][iSpan][1];
-            if (nDim ==3){
-              radialVelocityOut  = TurboVelocityOut[iMarkerTP -1][iSpan][2];
-            }
-            kineOut              = KineOut[iMarkerTP -1][iSpan];
-            omegaOut             = OmegaOut[iMarkerTP -1][iSpan];
-            nuOut                = NuOut[iMarkerTP -1][iSpan];
-
-#ifdef HAVE_MPI
-            TurbPerfOut[0]  = densityOut;
-            TurbPerfOut[1]  = pressureOut;
-            TurbPerfOut[2]  = normalVelocityOut;
-            TurbPerfOut[3]  = tangVelocityOut;
-            TurbPerfOut[4]  = radialVelocityOut;
-            TurbPerfOut[5]  = kineOut;
-            TurbPerfOut[6]  = omegaOut;
-            TurbPerfOut[7]  = nuOut;
-#endif
-          }
-        }
-      }
-    }
-
-#ifdef HAVE_MPI
-    if (rank == MASTER_NODE){
-      TotTurbPerfIn       = new su2double[n1t];
-      TotTurbPerfOut      = new su2double[n2t];
-      for (i=0;i<n1t;i++)
-        TotTurbPerfIn[i]  = -1.0;
-      for (i=0;i<n2t;i++)
-        TotTurbPerfOut[i] = -1.0;
-      TotMarkerTP = new int[size];
-      for(int i=0; i<size; i++){
-        TotMarkerTP[i]    = -1;
+    for (int i=0; i<size; i++){
+      const su2double* perfIn  = &recvBuffer[i*sendCount + iSpan*spanStride];
+      const su2double* perfOut = perfIn + nPerfIn;
+
+      if (perfIn[0] > 0.0){
+        densityIn        = perfIn[0];
+        pressureIn       = perfIn[1];
+        normalVelocityIn = perfIn[2];
+        tangVelocityIn   = perfIn[3];
+        radialVelocityIn = perfIn[4];
+        kineIn           = perfIn[5];
+        omegaIn          = perfIn[6];
+        nuIn             = perfIn[7];
+        markerTP         = static_cast<int>(SU2_TYPE::GetValue(perfOut[nPerfOut]));
       }
-    }
-    SU2_MPI::Gather(TurbPerfIn, n1, MPI_DOUBLE, TotTurbPerfIn, n1, MPI_DOUBLE, MASTER_NODE, SU2_MPI::GetComm());
-    SU2_MPI::Gather(TurbPerfOut, n2, MPI_DOUBLE,TotTurbPerfOut, n2, MPI_DOUBLE, MASTER_NODE, SU2_MPI::GetComm());
-    SU2_MPI::Gather(&markerTP, 1, MPI_INT,TotMarkerTP, 1, MPI_INT, MASTER_NODE, SU2_MPI::GetComm());
-    if (rank == MASTER_NODE){
-      delete [] TurbPerfIn, delete [] TurbPerfOut;
-    }
 
-    if (rank == MASTER_NODE){
-      for (int i=0;i<size;i++){
-        if(TotTurbPerfIn[n1*i] > 0.0){
-          densityIn        = TotTurbPerfIn[n1*i];
-          pressureIn       = TotTurbPerfIn[n1*i+1];
-          normalVelocityIn = TotTurbPerfIn[n1*i+2];
-          tangVelocityIn   = TotTurbPerfIn[n1*i+3];
-          radialVelocityIn = TotTurbPerfIn[n1*i+4];
-          kineIn           = TotTurbPerfIn[n1*i+5];
-          omegaIn          = TotTurbPerfIn[n1*i+6];
-          nuIn             = TotTurbPerfIn[n1*i+7];
-          markerTP         = TotMarkerTP[i];
-        }
-
-        if(TotTurbPerfOut[n2*i] > 0.0){
-          densityOut        = TotTurbPerfOut[n1*i];
-          pressureOut       = TotTurbPerfOut[n1*i+1];
-          normalVelocityOut = TotTurbPerfOut[n1*i+2];
-          tangVelocityOut   = TotTurbPerfOut[n1*i+3];
-          radialVelocityOut = TotTurbPerfOut[n1*i+4];
-          kineOut           = TotTurbPerfOut[n1*i+5];
-          omegaOut          = TotTurbPerfOut[n1*i+6];
-          nuOut             = TotTurbPerfOut[n1*i+7];
-        }
+      if (perfOut[0] > 0.0){
+        densityOut        = perfOut[0];
+        pressureOut       = perfOut[1];
+        normalVelocityOut = perfOut[2];
+        tangVelocityOut   = perfOut[3];
+        radialVelocityOut = perfOut[4];
+        kineOut           = perfOut[5];
+        omegaOut          = perfOut[6];
+        nuOut             = perfOut[7];
       }
-
-      delete [] TotTurbPerfIn, delete [] TotTurbPerfOut; delete [] TotMarkerTP;
     }
 
-#endif
-
-    if (rank == MASTER_NODE && markerTP > -1){
+    if (markerTP > -1){
       /*----Quantities needed for computing the turbomachinery performance -----*/
       DensityIn[markerTP -1][iSpan]              = densityIn;
       PressureIn[markerTP -1][iSpan]             = pressureIn;
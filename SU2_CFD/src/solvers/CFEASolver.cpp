@@ -254,8 +254,25 @@ void CFEASolver::HybridParallelInitialization(CGeometry* geometry) {
     auto nColor = coloring.getOuterSize();
     ElemColoring.reserve(nColor);
 
-    for(auto iColor = 0ul; iColor < nColor; ++iColor)
-      ElemColoring.emplace_back(coloring.innerIdx(iColor), coloring.getNumNonZeros(iColor), groupSize);
+    /*--- Group the elements of each color by VTK type, so the assembly loops run
+     *    over batches of the same element kind, keeping one set of kernels hot
+     *    instead of bouncing between them element by element. Reordering within
+     *    a color is safe since its elements do not share nodes. ---*/
+
+    ElemTypeSortedIdx.resize(coloring.getNumNonZeros());
+    unsigned long offset = 0;
+
+    for(auto iColor = 0ul; iColor < nColor; ++iColor) {
+      const auto nElemColor = coloring.getNumNonZeros(iColor);
+      auto* idx = ElemTypeSortedIdx.data() + offset;
+      const auto* src = coloring.innerIdx(iColor);
+      copy(src, src + nElemColor, idx);
+      stable_sort(idx, idx + nElemColor, [geometry](unsigned long iElem, unsigned long jElem) {
+        return geometry->elem[iElem]->GetVTK_Type() < geometry->elem[jElem]->GetVTK_Type();
+      });
+      ElemColoring.emplace_back(idx, nElemColor, groupSize);
+      offset += nElemColor;
+    }
   }
 
   su2double minEff = 1.0;
@@ -3138,7 +3155,7 @@ void CFEASolver::LoadRestart(CGeometry **geometry, CSolver ***solver, CConfig *c
   /*--- Delete the class memory that is used to load the restart. ---*/
 
   delete [] Restart_Vars; Restart_Vars = nullptr;
-  delete [] Restart_Data; Restart_Data = nullptr;
+  FreeRestartData();
 
 }
 
@@ -261,6 +261,12 @@ CFEM_DG_EulerSolver::CFEM_DG_EulerSolver(CGeometry *geometry, CConfig *config, u
     sizeWorkArray = max(sizeWorkArray, sizePredictorADER);
   }
 
+  /*--- Allocate the persistent work array. It is initialized to zero to avoid
+        warnings in debug mode about uninitialized memory when padding is
+        applied. The allocation is done once here, such that the residual
+        evaluations do not pay for it every time step. ---*/
+  workArrayVec.assign(sizeWorkArray, 0.0);
+
   /*--- Perform the non-dimensionalization for the flow equations using the
         specified reference values. ---*/
   SetNondimensionalization(config, iMesh, true);
@@ -3793,9 +3799,8 @@ void CFEM_DG_EulerSolver::ProcessTaskList_DG(CGeometry *geometry,  CSolver **sol
      not the tasks from the list have been completed. */
   vector<bool> taskCompleted(tasksList.size(), false);
 
-  /* Allocate the memory for the work array and initialize it to zero to avoid
-     warnings in debug mode  about uninitialized memory when padding is applied. */
-  vector<su2double> workArrayVec(sizeWorkArray, 0.0);
+  /* Set the pointer to the persistent work array, which is allocated
+     in the constructor. */
   su2double *workArray = workArrayVec.data();
 
   /* While loop to carry out all the tasks in tasksList. */
@@ -5803,13 +5808,28 @@ void CFEM_DG_EulerSolver::Volume_Residual(CConfig             *config,
 
     MetaDataChunkOfElem(volElem, l, elemEnd, nElemSimul, nPadMin, lEnd, ind, llEnd, NPad);
 
-    /* Get the required data from the corresponding standard element. */
+    /* Get the required data from the corresponding standard element. The
+       transposed operators for the redistribution have the integration
+       weights fused into their columns, so the weights do not appear in
+       the flux and source term computations below. */
     const unsigned short nInt            = standardElementsSol[ind].GetNIntegration();
     const unsigned short nDOFs           = volElem[l].nDOFsSol;
     const su2double *matBasisInt         = standardElementsSol[ind].GetMatBasisFunctionsIntegration();
-    const su2double *matBasisIntTrans    = standardElementsSol[ind].GetBasisFunctionsIntegrationTrans();
-    const su2double *matDerBasisIntTrans = standardElementsSol[ind].GetDerMatBasisFunctionsIntTrans();
-    const su2double *weights             = standardElementsSol[ind].GetWeightsIntegration();
+    const su2double *matBasisIntTrans    = standardElementsSol[ind].GetWeightedBasisFunctionsIntegrationTrans();
+    const su2double *matDerBasisIntTrans = standardElementsSol[ind].GetWeightedDerMatBasisFunctionsIntTrans();
+
+    /* Check if the matrix products can be carried out with sum factorization,
+       which is the case for quadrilaterals and hexahedra, and retrieve the
+       corresponding 1D operators. This reduces the operation count of the
+       interpolation and redistribution steps from O(p^(2*nDim)) to
+       O(p^(nDim+1)) per element. */
+    const bool useSumFactorization = standardElementsSol[ind].SumFactorizationPossible();
+
+    const unsigned short nDOFs1D = standardElementsSol[ind].GetNDOFs1D();
+    const unsigned short nInt1D  = standardElementsSol[ind].GetNIntegration1D();
+    const su2double *lagBasis1D         = standardElementsSol[ind].GetBasisFunctionsIntegration1D();
+    const su2double *lagBasisTrans1D    = standardElementsSol[ind].GetBasisFunctionsIntegrationTransWeighted1D();
+    const su2double *derLagBasisTrans1D = standardElementsSol[ind].GetDrBasisFunctionsIntegrationTransWeighted1D();
 
     /*--- Set the pointers for the local arrays. ---*/
     su2double *solDOFs = workArray;
@@ -5838,14 +5858,26 @@ void CFEM_DG_EulerSolver::Volume_Residual(CConfig             *config,
           solDOFs[i*NPad+llNVar+mm] = solDOFsElem[i*nVar+mm];
     }
 
-    /* Call the general function to carry out the matrix product to determine
-       the solution in the integration points of the chunk of elements. */
-    blasFunctions->gemm(nInt, NPad, nDOFs, matBasisInt, solDOFs, solInt, config);
+    /* Interpolate the solution to the integration points of the chunk of
+       elements. Use the tensor products of the 1D basis functions, if sum
+       factorization can be applied. Otherwise call the general function to
+       carry out the full matrix product. */
+    if( useSumFactorization ) {
+      if(nDim == 2)
+        blasFunctions->tensorProduct2D(nInt1D, nDOFs1D, NPad, lagBasis1D,
+                                       lagBasis1D, solDOFs, NPad, solInt, false);
+      else
+        blasFunctions->tensorProduct3D(nInt1D, nDOFs1D, NPad, lagBasis1D,
+                                       lagBasis1D, lagBasis1D, solDOFs, NPad,
+                                       solInt, false);
+    }
+    else
+      blasFunctions->gemm(nInt, NPad, nDOFs, matBasisInt, solDOFs, solInt, config);
 
     /*------------------------------------------------------------------------*/
-    /*--- Step 2: Compute the inviscid fluxes, multiplied by minus the     ---*/
-    /*---         integration weight, in the integration points.           ---*/
-    /*---         If needed, also the source terms are computed.           ---*/
+    /*--- Step 2: Compute minus the inviscid fluxes in the integration     ---*/
+    /*---         points. The integration weights are part of the          ---*/
+    /*---         operators. If needed, also the source terms are computed. ---*/
     /*------------------------------------------------------------------------*/
 
     /* Make a distinction between two and three space dimensions
@@ -5870,14 +5902,14 @@ void CFEM_DG_EulerSolver::Volume_Residual(CConfig             *config,
             const su2double Jac          = metricTerms[0];
             const su2double *gridVel     = volElem[lInd].gridVelocities.data() + i*nDim;
 
-            /* Compute the metric terms multiplied by minus the integration weight.
-               The minus sign comes from the integration by parts in the weak
-               formulation. */
-            const su2double wDrdx = -weights[i]*metricTerms[1];
-            const su2double wDrdy = -weights[i]*metricTerms[2];
+            /* Compute minus the metric terms. The minus sign comes from the
+               integration by parts in the weak formulation, the integration
+               weights are fused into the redistribution operators. */
+            const su2double wDrdx = -metricTerms[1];
+            const su2double wDrdy = -metricTerms[2];
 
-            const su2double wDsdx = -weights[i]*metricTerms[3];
-            const su2double wDsdy = -weights[i]*metricTerms[4];
+            const su2double wDsdx = -metricTerms[3];
+            const su2double wDsdy = -metricTerms[4];
 
             /* Easier storage of the location where the solution data of this
                integration point starts. */
@@ -5925,13 +5957,12 @@ void CFEM_DG_EulerSolver::Volume_Residual(CConfig             *config,
                   term the absolute velocity must be taken and not the
                   relative. ---*/
             if( body_force ) {
-              su2double *source         = sources + iNPad + llNVar;
-              const su2double weightJac = weights[i]*Jac;
+              su2double *source = sources + iNPad + llNVar;
 
               source[0] =  0.0;
-              source[1] = -weightJac*body_force_vector[0];
-              source[2] = -weightJac*body_force_vector[1];
-              source[3] = -weightJac*(u*body_force_vector[0] + v*body_force_vector[1]);
+              source[1] = -Jac*body_force_vector[0];
+              source[2] = -Jac*body_force_vector[1];
+              source[3] = -Jac*(u*body_force_vector[0] + v*body_force_vector[1]);
             }
           }
         }
@@ -5958,20 +5989,20 @@ void CFEM_DG_EulerSolver::Volume_Residual(CConfig             *config,
             const su2double Jac          = metricTerms[0];
             const su2double *gridVel     = volElem[lInd].gridVelocities.data() + i*nDim;
 
-            /* Compute the metric terms multiplied by minus the integration weight.
-               The minus sign comes from the integration by parts in the weak
-               formulation. */
-            const su2double wDrdx = -weights[i]*metricTerms[1];
-            const su2double wDrdy = -weights[i]*metricTerms[2];
-            const su2double wDrdz = -weights[i]*metricTerms[3];
+            /* Compute minus the metric terms. The minus sign comes from the
+               integration by parts in the weak formulation, the integration
+               weights are fused into the redistribution operators. */
+            const su2double wDrdx = -metricTerms[1];
+            const su2double wDrdy = -metricTerms[2];
+            const su2double wDrdz = -metricTerms[3];
 
-            const su2double wDsdx = -weights[i]*metricTerms[4];
-            const su2double wDsdy = -weights[i]*metricTerms[5];
-            const su2double wDsdz = -weights[i]*metricTerms[6];
+            const su2double wDsdx = -metricTerms[4];
+            const su2double wDsdy = -metricTerms[5];
+            const su2double wDsdz = -metricTerms[6];
 
-            const su2double wDtdx = -weights[i]*metricTerms[7];
-            const su2double wDtdy = -weights[i]*metricTerms[8];
-            const su2double wDtdz = -weights[i]*metricTerms[9];
+            const su2double wDtdx = -metricTerms[7];
+            const su2double wDtdy = -metricTerms[8];
+            const su2double wDtdz = -metricTerms[9];
 
             /* Easier storage of the location where the solution data of this
                integration point starts. */
@@ -6033,15 +6064,14 @@ void CFEM_DG_EulerSolver::Volume_Residual(CConfig             *config,
                   term the absolute velocity must be taken and not the
                   relative. ---*/
             if( body_force ) {
-              su2double *source         = sources + iNPad + llNVar;
-              const su2double weightJac = weights[i]*Jac;
+              su2double *source = sources + iNPad + llNVar;
 
               source[0] =  0.0;
-              source[1] = -weightJac*body_force_vector[0];
-              source[2] = -weightJac*body_force_vector[1];
-              source[3] = -weightJac*body_force_vector[2];
-              source[4] = -weightJac*(u*body_force_vector[0] + v*body_force_vector[1]
-                        +             w*body_force_vector[2]);
+              source[1] = -Jac*body_force_vector[0];
+              source[2] = -Jac*body_force_vector[1];
+              source[3] = -Jac*body_force_vector[2];
+              source[4] = -Jac*(u*body_force_vector[0] + v*body_force_vector[1]
+                        +       w*body_force_vector[2]);
             }
           }
         }
@@ -6074,10 +6104,11 @@ void CFEM_DG_EulerSolver::Volume_Residual(CConfig             *config,
           for(unsigned short i=0; i<nInt; ++i) {
             const unsigned short iNPad = i*NPad;
 
-            /* Determine the integration weight multiplied by the Jacobian. */
+            /* Determine the Jacobian, the integration weight is fused into
+               the redistribution operator. */
             const su2double *metricTerms = volElem[lInd].metricTerms.data()
                                          + i*nMetricPerPoint;
-            const su2double weightJac    = weights[i]*metricTerms[0];
+            const su2double Jac          = metricTerms[0];
 
             /* Set the pointer to the coordinates in this integration point and
                call the function to compute the source terms for the manufactured
@@ -6089,12 +6120,12 @@ void CFEM_DG_EulerSolver::Volume_Residual(CConfig             *config,
             VerificationSolution->GetMMSSourceTerm(coor, time, sourceMan);
 
             /*--- Subtract the source term of the manufactured solution, multiplied
-                  by the appropriate weight, from the possibly earlier computed
-                  source term. It is subtracted in order to be consistent with
-                  the definition of the residual used in this code. ---*/
+                  by the Jacobian, from the possibly earlier computed source term.
+                  It is subtracted in order to be consistent with the definition
+                  of the residual used in this code. ---*/
             su2double *source = sources + iNPad + llNVar;
             for(unsigned short k=0; k<nVar; ++k)
-              source[k] -= weightJac*sourceMan[k];
+              source[k] -= Jac*sourceMan[k];
           }
         }
       }
@@ -6105,16 +6136,55 @@ void CFEM_DG_EulerSolver::Volume_Residual(CConfig             *config,
     /*---         integration over the volume element.                     ---*/
     /*------------------------------------------------------------------------*/
 
-    /* Call the general function to carry out the matrix product.
-       Use solDOFs as a temporary storage for the matrix product. */
-    blasFunctions->gemm(nDOFs, NPad, nInt*nDim, matDerBasisIntTrans, fluxes, solDOFs, config);
+    /* Carry out the multiplication of the fluxes with the transpose of the
+       derivative matrix of the basis functions. Use solDOFs as a temporary
+       storage for the matrix product. When sum factorization can be applied,
+       the multiplication is carried out per parametric direction with the
+       appropriate tensor products of the transposed 1D operators. As the
+       fluxes of the parametric directions are interleaved per integration
+       point, the stride between the rows of the fluxes is nDim*NPad. */
+    if( useSumFactorization ) {
+      if(nDim == 2) {
+        blasFunctions->tensorProduct2D(nDOFs1D, nInt1D, NPad, derLagBasisTrans1D,
+                                       lagBasisTrans1D, fluxes, nDim*NPad,
+                                       solDOFs, false);
+        blasFunctions->tensorProduct2D(nDOFs1D, nInt1D, NPad, lagBasisTrans1D,
+                                       derLagBasisTrans1D, fluxes+NPad, nDim*NPad,
+                                       solDOFs, true);
+      }
+      else {
+        blasFunctions->tensorProduct3D(nDOFs1D, nInt1D, NPad, derLagBasisTrans1D,
+                                       lagBasisTrans1D, lagBasisTrans1D, fluxes,
+                                       nDim*NPad, solDOFs, false);
+        blasFunctions->tensorProduct3D(nDOFs1D, nInt1D, NPad, lagBasisTrans1D,
+                                       derLagBasisTrans1D, lagBasisTrans1D,
+                                       fluxes+NPad, nDim*NPad, solDOFs, true);
+        blasFunctions->tensorProduct3D(nDOFs1D, nInt1D, NPad, lagBasisTrans1D,
+                                       lagBasisTrans1D, derLagBasisTrans1D,
+                                       fluxes+2*NPad, nDim*NPad, solDOFs, true);
+      }
+    }
+    else
+      blasFunctions->gemm(nDOFs, NPad, nInt*nDim, matDerBasisIntTrans, fluxes, solDOFs, config);
 
     /* Add the contribution from the source terms, if needed. Use solInt
        as temporary storage for the matrix product. */
     if( addSourceTerms ) {
 
-      /* Call the general function to carry out the matrix product. */
-      blasFunctions->gemm(nDOFs, NPad, nInt, matBasisIntTrans, sources, solInt, config);
+      /* Carry out the matrix product with the transpose of the basis functions,
+         again with sum factorization if possible. */
+      if( useSumFactorization ) {
+        if(nDim == 2)
+          blasFunctions->tensorProduct2D(nDOFs1D, nInt1D, NPad, lagBasisTrans1D,
+                                         lagBasisTrans1D, sources, NPad,
+                                         solInt, false);
+        else
+          blasFunctions->tensorProduct3D(nDOFs1D, nInt1D, NPad, lagBasisTrans1D,
+                                         lagBasisTrans1D, lagBasisTrans1D,
+                                         sources, NPad, solInt, false);
+      }
+      else
+        blasFunctions->gemm(nDOFs, NPad, nInt, matBasisIntTrans, sources, solInt, config);
 
       /* Add the residuals due to source terms to the volume residuals */
       for(unsigned short i=0; i<(nDOFs*NPad); ++i)
@@ -6714,9 +6784,8 @@ void CFEM_DG_EulerSolver::MultiplyResidualByInverseMassMatrix(
 
 void CFEM_DG_EulerSolver::Pressure_Forces(const CGeometry* geometry, const CConfig* config) {
 
-  /* Allocate the memory for the work array and initialize it to zero to avoid
-     warnings in debug mode  about uninitialized memory when padding is applied. */
-  vector<su2double> workArrayVec(sizeWorkArray, 0.0);
+  /* Set the pointer to the persistent work array, which is allocated
+     in the constructor. */
   su2double *workArray = workArrayVec.data();
 
   /* Determine the number of faces that are treated simultaneously
@@ -9407,9 +9476,12 @@ void CFEM_DG_EulerSolver::LoadRestart(CGeometry **geometry, CSolver ***solver, C
 
   restart_filename = config->GetFilename(restart_filename, "", val_iter);
 
-  /*--- Read the restart data from either an ASCII or binary SU2 file. ---*/
+  /*--- Read the restart data from a high-order (element-collocated) file,
+   or from either an ASCII or binary SU2 file. ---*/
 
-  if (config->GetRead_Binary_Restart()) {
+  if (config->GetRead_HighOrder_Restart()) {
+    Read_SU2_Restart_HighOrder(geometry[MESH_0], config, restart_filename);
+  } else if (config->GetRead_Binary_Restart()) {
     Read_SU2_Restart_Binary(geometry[MESH_0], config, restart_filename);
   } else {
     Read_SU2_Restart_ASCII(geometry[MESH_0], config, restart_filename);
@@ -9502,8 +9574,7 @@ void CFEM_DG_EulerSolver::LoadRestart(CGeometry **geometry, CSolver ***solver, C
 
   /*--- Delete the class memory that is used to load the restart. ---*/
 
-  delete [] Restart_Vars;
-  delete [] Restart_Data;
-  Restart_Vars = nullptr; Restart_Data = nullptr;
+  delete [] Restart_Vars; Restart_Vars = nullptr;
+  FreeRestartData();
 
 }
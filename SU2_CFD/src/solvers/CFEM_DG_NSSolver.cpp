@@ -182,9 +182,8 @@ CFEM_DG_NSSolver::~CFEM_DG_NSSolver(void) {
 
 void CFEM_DG_NSSolver::Friction_Forces(const CGeometry* geometry, const CConfig* config) {
 
-  /* Allocate the memory for the work array and initialize it to zero to avoid
-     warnings in debug mode  about uninitialized memory when padding is applied. */
-  vector<su2double> workArrayVec(sizeWorkArray, 0.0);
+  /* Set the pointer to the persistent work array, which is allocated
+     in the constructor. */
   su2double *workArray = workArrayVec.data();
 
   /*--------------------------------------------------------------------------*/
@@ -895,9 +894,8 @@ void CFEM_DG_NSSolver::SetTime_Step(CGeometry *geometry, CSolver **solver_contai
   /* Check whether or not a time stepping scheme is used. */
   const bool time_stepping = config->GetTime_Marching() == TIME_MARCHING::TIME_STEPPING;
 
-  /* Allocate the memory for the work array and initialize it to zero to avoid
-     warnings in debug mode  about uninitialized memory when padding is applied. */
-  vector<su2double> workArrayVec(sizeWorkArray, 0.0);
+  /* Set the pointer to the persistent work array, which is allocated
+     in the constructor. */
   su2double *workArray = workArrayVec.data();
 
   /* Constant factor present in the heat flux vector, namely the ratio of
@@ -3188,13 +3186,15 @@ void CFEM_DG_NSSolver::Volume_Residual(CConfig             *config,
 
     MetaDataChunkOfElem(volElem, l, elemEnd, nElemSimul, nPadMin, lEnd, ind, llEnd, NPad);
 
-    /* Get the required data from the corresponding standard element. */
+    /* Get the required data from the corresponding standard element. The
+       transposed operators for the redistribution have the integration
+       weights fused into their columns, so the weights do not appear in
+       the flux and source term computations below. */
     const unsigned short nInt            = standardElementsSol[ind].GetNIntegration();
     const unsigned short nDOFs           = volElem[l].nDOFsSol;
     const su2double *matBasisInt         = standardElementsSol[ind].GetMatBasisFunctionsIntegration();
-    const su2double *matDerBasisIntTrans = standardElementsSol[ind].GetDerMatBasisFunctionsIntTrans();
-    const su2double *matBasisIntTrans    = standardElementsSol[ind].GetBasisFunctionsIntegrationTrans();
-    const su2double *weights             = standardElementsSol[ind].GetWeightsIntegration();
+    const su2double *matDerBasisIntTrans = standardElementsSol[ind].GetWeightedDerMatBasisFunctionsIntTrans();
+    const su2double *matBasisIntTrans    = standardElementsSol[ind].GetWeightedBasisFunctionsIntegrationTrans();
 
     unsigned short nPoly = standardElementsSol[ind].GetNPoly();
     if(nPoly == 0) nPoly = 1;
@@ -3233,9 +3233,9 @@ void CFEM_DG_NSSolver::Volume_Residual(CConfig             *config,
     blasFunctions->gemm(nInt*(nDim+1), NPad, nDOFs, matBasisInt, solDOFs, solAndGradInt, config);
 
     /*------------------------------------------------------------------------*/
-    /*--- Step 2: Compute the total fluxes (inviscid fluxes minus the      ---*/
-    /*---         viscous fluxes), multiplied by minus the integration     ---*/
-    /*---         weight, in the integration points.                       ---*/
+    /*--- Step 2: Compute minus the total fluxes (inviscid fluxes minus    ---*/
+    /*---         the viscous fluxes) in the integration points. The       ---*/
+    /*---         integration weights are part of the operators.           ---*/
     /*------------------------------------------------------------------------*/
 
     /* Determine the offset between the solution variables and the r-derivatives,
@@ -3273,14 +3273,14 @@ void CFEM_DG_NSSolver::Volume_Residual(CConfig             *config,
             const su2double dsdx = JacInv*metricTerms[3];
             const su2double dsdy = JacInv*metricTerms[4];
 
-            /* Compute the metric terms multiplied by minus the integration weight.
-               The minus sign comes from the integration by parts in the weak
-               formulation. */
-            const su2double wDrdx = -weights[i]*metricTerms[1];
-            const su2double wDrdy = -weights[i]*metricTerms[2];
+            /* Compute minus the metric terms. The minus sign comes from the
+               integration by parts in the weak formulation, the integration
+               weights are fused into the redistribution operators. */
+            const su2double wDrdx = -metricTerms[1];
+            const su2double wDrdy = -metricTerms[2];
 
-            const su2double wDsdx = -weights[i]*metricTerms[3];
-            const su2double wDsdy = -weights[i]*metricTerms[4];
+            const su2double wDsdx = -metricTerms[3];
+            const su2double wDsdy = -metricTerms[4];
 
             /* Easier storage of the location where the solution data of this
                integration point starts. */
@@ -3394,13 +3394,12 @@ void CFEM_DG_NSSolver::Volume_Residual(CConfig             *config,
                   term the absolute velocity must be taken and not the
                   relative. ---*/
             if( body_force ) {
-              su2double *source         = sources + iNPad + llNVar;
-              const su2double weightJac = weights[i]*Jac;
+              su2double *source = sources + iNPad + llNVar;
 
               source[0] =  0.0;
-              source[1] = -weightJac*body_force_vector[0];
-              source[2] = -weightJac*body_force_vector[1];
-              source[3] = -weightJac*(u*body_force_vector[0] + v*body_force_vector[1]);
+              source[1] = -Jac*body_force_vector[0];
+              source[2] = -Jac*body_force_vector[1];
+              source[3] = -Jac*(u*body_force_vector[0] + v*body_force_vector[1]);
             }
           }
         }
@@ -3442,20 +3441,20 @@ void CFEM_DG_NSSolver::Volume_Residual(CConfig             *config,
             const su2double dtdy = JacInv*metricTerms[8];
             const su2double dtdz = JacInv*metricTerms[9];
 
-            /* Compute the metric terms multiplied by minus the integration weight.
-               The minus sign comes from the integration by parts in the weak
-               formulation. */
-            const su2double wDrdx = -weights[i]*metricTerms[1];
-            const su2double wDrdy = -weights[i]*metricTerms[2];
-            const su2double wDrdz = -weights[i]*metricTerms[3];
+            /* Compute minus the metric terms. The minus sign comes from the
+               integration by parts in the weak formulation, the integration
+               weights are fused into the redistribution operators. */
+            const su2double wDrdx = -metricTerms[1];
+            const su2double wDrdy = -metricTerms[2];
+            const su2double wDrdz = -metricTerms[3];
 
-            const su2double wDsdx = -weights[i]*metricTerms[4];
-            const su2double wDsdy = -weights[i]*metricTerms[5];
-            const su2double wDsdz = -weights[i]*metricTerms[6];
+            const su2double wDsdx = -metricTerms[4];
+            const su2double wDsdy = -metricTerms[5];
+            const su2double wDsdz = -metricTerms[6];
 
-            const su2double wDtdx = -weights[i]*metricTerms[7];
-            const su2double wDtdy = -weights[i]*metricTerms[8];
-            const su2double wDtdz = -weights[i]*metricTerms[9];
+            const su2double wDtdx = -metricTerms[7];
+            const su2double wDtdy = -metricTerms[8];
+            const su2double wDtdz = -metricTerms[9];
 
             /* Easier storage of the location where the solution data of this
                integration point starts. */
@@ -3611,15 +3610,14 @@ void CFEM_DG_NSSolver::Volume_Residual(CConfig             *config,
                   term the absolute velocity must be taken and not the
                   relative. ---*/
             if( body_force ) {
-              su2double *source         = sources + iNPad + llNVar;
-              const su2double weightJac = weights[i]*Jac;
+              su2double *source = sources + iNPad + llNVar;
 
               source[0] =  0.0;
-              source[1] = -weightJac*body_force_vector[0];
-              source[2] = -weightJac*body_force_vector[1];
-              source[3] = -weightJac*body_force_vector[2];
-              source[4] = -weightJac*(u*body_force_vector[0] + v*body_force_vector[1]
-                        +             w*body_force_vector[2]);
+              source[1] = -Jac*body_force_vector[0];
+              source[2] = -Jac*body_force_vector[1];
+              source[3] = -Jac*body_force_vector[2];
+              source[4] = -Jac*(u*body_force_vector[0] + v*body_force_vector[1]
+                        +       w*body_force_vector[2]);
             }
           }
         }
@@ -3652,10 +3650,11 @@ void CFEM_DG_NSSolver::Volume_Residual(CConfig             *config,
           for(unsigned short i=0; i<nInt; ++i) {
             const unsigned short iNPad = i*NPad;
 
-            /* Determine the integration weight multiplied by the Jacobian. */
+            /* Determine the Jacobian, the integration weight is fused into
+               the redistribution operator. */
             const su2double *metricTerms = volElem[lInd].metricTerms.data()
                                          + i*nMetricPerPoint;
-            const su2double weightJac    = weights[i]*metricTerms[0];
+            const su2double Jac          = metricTerms[0];
 
             /* Set the pointer to the coordinates in this integration point and
                call the function to compute the source terms for the manufactured
@@ -3667,12 +3666,12 @@ void CFEM_DG_NSSolver::Volume_Residual(CConfig             *config,
             VerificationSolution->GetMMSSourceTerm(coor, time, sourceMan);
 
             /*--- Subtract the source term of the manufactured solution, multiplied
-                  by the appropriate weight, from the possibly earlier computed
-                  source term. It is subtracted in order to be consistent with
-                  the definition of the residual used in this code. ---*/
+                  by the Jacobian, from the possibly earlier computed source term.
+                  It is subtracted in order to be consistent with the definition
+                  of the residual used in this code. ---*/
             su2double *source = sources + iNPad + llNVar;
             for(unsigned short k=0; k<nVar; ++k)
-              source[k] -= weightJac*sourceMan[k];
+              source[k] -= Jac*sourceMan[k];
           }
         }
       }
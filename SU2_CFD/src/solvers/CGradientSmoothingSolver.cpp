@@ -27,6 +27,7 @@
 
 #include <algorithm>
 
+#include "../../../Common/include/linear_algebra/CPreconditioner.hpp"
 #include "../../../Common/include/toolboxes/geometry_toolbox.hpp"
 #include "../../include/solvers/CGradientSmoothingSolver.hpp"
 #include "../../include/variables/CSobolevSmoothingVariable.hpp"
@@ -54,6 +55,119 @@ void ReadVectorToGeometry(const CGeometry* geometry, CSysVector<su2matvecscalar>
     }
   }
 }
+
+/*!
+ * \brief Matrix-free application of the volume smoothing operator, the stencil
+ * (lumped mass plus finite-volume Laplacian) is evaluated on the fly from edge
+ * data, no matrix is stored. Rows are independent so the loop parallelizes and
+ * vectorizes cleanly, Dirichlet points are decoupled via the interior mask.
+ */
+class CSobolevOperator final : public CMatrixVectorProduct<CGradientSmoothingSolver::su2matvecscalar> {
+private:
+  using Scalar = CGradientSmoothingSolver::su2matvecscalar;
+  CGeometry* geometry;
+  const CConfig* config;
+  const su2vector<Scalar>& edgeWeight;
+  const CSysVector<Scalar>& diagonal;
+  const CSysVector<Scalar>& interior;
+
+public:
+  CSobolevOperator(CGeometry* geometry_, const CConfig* config_, const su2vector<Scalar>& edgeWeight_,
+                   const CSysVector<Scalar>& diagonal_, const CSysVector<Scalar>& interior_) :
+    geometry(geometry_), config(config_), edgeWeight(edgeWeight_), diagonal(diagonal_), interior(interior_) {}
+
+  inline void operator()(const CSysVector<Scalar>& u, CSysVector<Scalar>& v) const override {
+    const auto nVar = u.GetNVar();
+
+    /*--- The halo values of u are current because the halos of every product
+     *    are refreshed below (same contract as CSysMatrix). ---*/
+    SU2_OMP_BARRIER
+
+    SU2_OMP_FOR_STAT(1024)
+    for (auto iPoint = 0ul; iPoint < geometry->GetnPointDomain(); ++iPoint) {
+
+      for (auto iVar = 0ul; iVar < nVar; ++iVar)
+        v(iPoint, iVar) = diagonal[iPoint] * u(iPoint, iVar);
+
+      const Scalar maskI = interior[iPoint];
+
+      for (unsigned short iNeigh = 0; iNeigh < geometry->nodes->GetnPoint(iPoint); ++iNeigh) {
+        const auto jPoint = geometry->nodes->GetPoint(iPoint, iNeigh);
+        const auto iEdge = geometry->nodes->GetEdge(iPoint, iNeigh);
+        const Scalar w = edgeWeight[iEdge] * maskI * interior[jPoint];
+
+        for (auto iVar = 0ul; iVar < nVar; ++iVar)
+          v(iPoint, iVar) -= w * u(jPoint, iVar);
+      }
+    }
+    END_SU2_OMP_FOR
+
+    CSysMatrixComms::Initiate(v, geometry, config);
+    CSysMatrixComms::Complete(v, geometry, config);
+  }
+};
+
+/*!
+ * \brief Chebyshev polynomial preconditioner for the matrix-free smoothing operator,
+ * needs only operator applications and the operator diagonal (Jacobi scaling), the
+ * spectral bounds refer to the Jacobi-scaled operator.
+ */
+class CChebyshevPreconditioner final : public CPreconditioner<CGradientSmoothingSolver::su2matvecscalar> {
+private:
+  using Scalar = CGradientSmoothingSolver::su2matvecscalar;
+  enum : unsigned long { DEGREE = 4 }; /*!< \brief Degree of the Chebyshev polynomial. */
+  const CSobolevOperator& oper;
+  const CSysVector<Scalar>& diagonal;
+  const Scalar lambdaMin, lambdaMax;
+  mutable CSysVector<Scalar> r, d, q;  /*!< \brief Work vectors of the recurrence. */
+
+  /*!
+   * \brief d = a*d + b * D^{-1} r, over all points so the halos of d stay current.
+   */
+  void UpdateDirection(Scalar a, Scalar b) const {
+    SU2_OMP_BARRIER
+    SU2_OMP_FOR_STAT(1024)
+    for (auto iPoint = 0ul; iPoint < r.GetNBlk(); ++iPoint)
+      for (auto iVar = 0ul; iVar < r.GetNVar(); ++iVar)
+        d(iPoint, iVar) = a * d(iPoint, iVar) + b * r(iPoint, iVar) / diagonal[iPoint];
+    END_SU2_OMP_FOR
+  }
+
+public:
+  /*--- Construct outside of parallel regions, the work vectors are allocated here. ---*/
+  CChebyshevPreconditioner(const CSobolevOperator& oper_, const CSysVector<Scalar>& diagonal_,
+                           Scalar lambdaMin_, Scalar lambdaMax_, const CSysVector<Scalar>& model) :
+    oper(oper_), diagonal(diagonal_), lambdaMin(lambdaMin_), lambdaMax(lambdaMax_) {
+    r.Initialize(model.GetNBlk(), model.GetNBlkDomain(), model.GetNVar(), Scalar(0));
+    d.Initialize(model.GetNBlk(), model.GetNBlkDomain(), model.GetNVar(), Scalar(0));
+    q.Initialize(model.GetNBlk(), model.GetNBlkDomain(), model.GetNVar(), Scalar(0));
+  }
+
+  inline void operator()(const CSysVector<Scalar>& u, CSysVector<Scalar>& v) const override {
+    const Scalar theta = 0.5 * (lambdaMax + lambdaMin);
+    const Scalar delta = 0.5 * (lambdaMax - lambdaMin);
+    const Scalar sigma = theta / delta;
+    Scalar rhoOld = 1.0 / sigma;
+
+    /*--- Chebyshev iteration for "A v = u" starting from v = 0 (Saad, Iterative
+     *    Methods for Sparse Linear Systems, alg. 12.1), all threads compute the
+     *    same scalar recurrence. ---*/
+    v = Scalar(0);
+    r = u;
+    UpdateDirection(0.0, 1.0 / theta);
+
+    for (auto k = 1ul; k < DEGREE; ++k) {
+      v += d;
+      oper(d, q);
+      r -= q;
+      const Scalar rho = 1.0 / (2.0 * sigma - rhoOld);
+      UpdateDirection(rho * rhoOld, 2.0 * rho / delta);
+      rhoOld = rho;
+    }
+    v += d;
+  }
+};
+
 } // namespace CGradientSmoothingSolverDetails
 
 CGradientSmoothingSolver::CGradientSmoothingSolver(CGeometry *geometry, CConfig *config) : CFEASolverBase(LINEAR_SOLVER_MODE::GRADIENT_MODE) {
@@ -174,6 +288,29 @@ void CGradientSmoothingSolver::ApplyGradientSmoothingVolume(CGeometry* geometry,
   /*--- current dimension if we run consecutive on each dimension ---*/
   unsigned int iDim = 0;
 
+  /*--- Matrix-free variant: the operator stencil is evaluated on the fly from
+   *    edge data, no stiffness matrix is assembled or stored. ---*/
+  if (config->GetSmoothMatrixFree()) {
+    LinSysSol.SetValZero();
+    LinSysRes.SetValZero();
+
+    if (config->GetSmoothSepDim()) {
+      for (iDim = 0; iDim < nDim; iDim++) {
+        SetCurrentDim(iDim);
+        Compute_Residual(geometry, config);
+        Solve_Linear_System_MatrixFree(geometry, config);
+        WriteSensitivity(geometry, config);
+        LinSysSol.SetValZero();
+        LinSysRes.SetValZero();
+      }
+    } else {
+      Compute_Residual(geometry, config);
+      Solve_Linear_System_MatrixFree(geometry, config);
+      WriteSensitivity(geometry, config);
+    }
+    return;
+  }
+
   /*--- Set vector and sparse matrix to 0 ---*/
   LinSysSol.SetValZero();
   LinSysRes.SetValZero();
@@ -677,6 +814,120 @@ void CGradientSmoothingSolver::Solve_Linear_System(CGeometry* geometry, const CC
   END_SU2_OMP_PARALLEL
 }
 
+void CGradientSmoothingSolver::Compute_MatrixFreeData(CGeometry* geometry, const CConfig* config) {
+  unsigned long iPoint, iEdge, iVertex;
+  unsigned int iMarker;
+
+  /*--- The data only depends on the mesh, build it once. ---*/
+  if (matrixFreeReady) return;
+
+  const passivedouble eps1 = SU2_TYPE::GetValue(config->GetSmoothingEps1());
+  const passivedouble eps2 = SU2_TYPE::GetValue(config->GetSmoothingEps2());
+
+  edgeWeight.resize(geometry->GetnEdge());
+  operDiag.Initialize(nPoint, nPointDomain, 1, su2matvecscalar(0));
+  interiorMask.Initialize(nPoint, nPointDomain, 1, su2matvecscalar(1));
+
+  /*--- Mark the points of the Dirichlet markers, they are decoupled from the
+   *    system by the mask (analog to BC_Dirichlet for the assembled matrix). ---*/
+  for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
+    if (config->GetMarker_All_SobolevBC(iMarker) == YES) {
+      for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
+        iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+        interiorMask[iPoint] = su2matvecscalar(0);
+      }
+    }
+  }
+
+  /*--- Finite-volume Laplacian weight of each edge (dual face area over the
+   *    distance of the nodes), scaled by the Laplace parameter. The weights
+   *    are accumulated into the diagonal of both adjacent rows. ---*/
+  for (iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
+    const auto jPoint = geometry->edges->GetNode(iEdge, 0);
+    const auto kPoint = geometry->edges->GetNode(iEdge, 1);
+    const su2double area = GeometryToolbox::Norm(nDim, geometry->edges->GetNormal(iEdge));
+    const su2double dist = GeometryToolbox::Distance(nDim, geometry->nodes->GetCoord(jPoint),
+                                                     geometry->nodes->GetCoord(kPoint));
+    edgeWeight[iEdge] = SU2_TYPE::GetValue(eps2 * area / dist);
+    operDiag[jPoint] += edgeWeight[iEdge];
+    operDiag[kPoint] += edgeWeight[iEdge];
+  }
+
+  /*--- Add the lumped mass term and compute the spectral bounds of the
+   *    Jacobi-scaled operator for the Chebyshev preconditioner, the upper
+   *    bound is rigorous (Gershgorin), the lower one only affects efficiency. ---*/
+  passivedouble lmax = 1.0, lmin = 1.0;
+
+  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    const passivedouble lap = SU2_TYPE::GetValue(operDiag[iPoint]);
+    const passivedouble mass = eps1 * SU2_TYPE::GetValue(geometry->nodes->GetVolume(iPoint));
+    operDiag[iPoint] = su2matvecscalar(mass + lap);
+    lmax = max(lmax, 1.0 + lap / (mass + lap));
+    lmin = min(lmin, mass / (mass + lap));
+  }
+
+  passivedouble bound = lmax;
+  SU2_MPI::Allreduce(&bound, &lambdaMax, 1, MPI_DOUBLE, MPI_MAX, SU2_MPI::GetComm());
+  bound = lmin;
+  SU2_MPI::Allreduce(&bound, &lambdaMin, 1, MPI_DOUBLE, MPI_MIN, SU2_MPI::GetComm());
+
+  /*--- Make the halo values of the diagonal and of the mask consistent, the
+   *    local edge loop does not see all the neighbors of halo points. ---*/
+  CSysMatrixComms::Initiate(operDiag, geometry, config);
+  CSysMatrixComms::Complete(operDiag, geometry, config);
+  CSysMatrixComms::Initiate(interiorMask, geometry, config);
+  CSysMatrixComms::Complete(interiorMask, geometry, config);
+
+  matrixFreeReady = true;
+}
+
+void CGradientSmoothingSolver::Solve_Linear_System_MatrixFree(CGeometry* geometry, const CConfig* config) {
+  unsigned long iPoint;
+  unsigned int iVar;
+
+  Compute_MatrixFreeData(geometry, config);
+
+  /*--- Convert the right hand side and initial solution, imposing the
+   *    Dirichlet conditions through the mask. ---*/
+  matFreeRhs.PassiveCopy(LinSysRes);
+  matFreeSol.PassiveCopy(LinSysSol);
+
+  for (iPoint = 0; iPoint < nPointDomain; iPoint++)
+    for (iVar = 0; iVar < matFreeRhs.GetNVar(); iVar++)
+      matFreeRhs(iPoint, iVar) *= interiorMask[iPoint];
+
+  CSysMatrixComms::Initiate(matFreeRhs, geometry, config);
+  CSysMatrixComms::Complete(matFreeRhs, geometry, config);
+
+  /*--- Setup the matrix-free operator and the Chebyshev preconditioner
+   *    (only operator applications, no matrix storage). ---*/
+  CGradientSmoothingSolverDetails::CSobolevOperator oper(geometry, config, edgeWeight, operDiag, interiorMask);
+  CGradientSmoothingSolverDetails::CChebyshevPreconditioner precond(
+      oper, operDiag, su2matvecscalar(lambdaMin), su2matvecscalar(lambdaMax), matFreeRhs);
+
+  const auto tol = SU2_TYPE::GetValue(config->GetGrad_Linear_Solver_Error());
+  const auto maxIter = config->GetGrad_Linear_Solver_Iter();
+
+  SU2_OMP_PARALLEL
+  {
+    su2matvecscalar residual = 0.0;
+    auto iter = System.CG_LinSolver(matFreeRhs, matFreeSol, oper, precond, tol, maxIter, residual, false, config);
+
+    SU2_OMP_MASTER
+    {
+      SetIterLinSolver(iter);
+      SetResLinSolver(residual);
+    }
+    END_SU2_OMP_MASTER
+  }
+  END_SU2_OMP_PARALLEL
+
+  /*--- Copy the solution into the su2double view used downstream. ---*/
+  for (iPoint = 0; iPoint < nPoint; iPoint++)
+    for (iVar = 0; iVar < LinSysSol.GetNVar(); iVar++)
+      LinSysSol(iPoint, iVar) = matFreeSol(iPoint, iVar);
+}
+
 template <typename scalar_type>
 CSysMatrixVectorProduct<scalar_type> CGradientSmoothingSolver::GetStiffnessMatrixVectorProduct(CGeometry* geometry,
                                                                                                CNumerics* numerics,
@@ -191,6 +191,8 @@ void CHeatSolver::Preprocessing(CGeometry *geometry, CSolver **solver_container,
 
   if (config->GetKind_ConvNumScheme_Heat() == SPACE_CENTERED) {
     SetUndivided_Laplacian(geometry, config);
+    InitiateComms(geometry, config, UNDIVIDED_LAPLACIAN);
+    CompleteComms(geometry, config, UNDIVIDED_LAPLACIAN);
   }
 
   for (auto iPoint = 0ul; iPoint < nPoint; iPoint ++) {
@@ -310,8 +312,7 @@ void CHeatSolver::LoadRestart(CGeometry **geometry, CSolver ***solver, CConfig *
 
   delete[] Restart_Vars;
   Restart_Vars = nullptr;
-  delete[] Restart_Data;
-  Restart_Data = nullptr;
+  FreeRestartData();
 }
 
 void CHeatSolver::Centered_Residual(CGeometry *geometry, CSolver **solver_container,  CNumerics **numerics_container,
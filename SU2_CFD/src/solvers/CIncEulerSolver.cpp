@@ -32,6 +32,7 @@
 #include "../../include/fluid/CIncIdealGasPolynomial.hpp"
 #include "../../include/variables/CIncNSVariable.hpp"
 #include "../../include/limiters/CLimiterDetails.hpp"
+#include "../../include/numerics_simd/CNumericsSIMD.hpp"
 #include "../../../Common/include/toolboxes/geometry_toolbox.hpp"
 
 
@@ -874,6 +875,12 @@ void CIncEulerSolver::CommonPreprocessing(CGeometry *geometry, CSolver **solver_
   SU2_OMP_ATOMIC
   ErrorCounter += SetPrimitive_Variables(solver_container, config);
 
+  /*--- The primitives changed, the scalar solvers must not reuse their face-state cache. ---*/
+
+  SU2_OMP_MASTER
+  InvalidateEdgeFaceVelCache();
+  END_SU2_OMP_MASTER
+
   if ((iMesh == MESH_0) && (config->GetComm_Level() == COMM_FULL)) {
     SU2_OMP_BARRIER
     SU2_OMP_MASTER
@@ -891,8 +898,13 @@ void CIncEulerSolver::CommonPreprocessing(CGeometry *geometry, CSolver **solver_
   if (center && !Output) {
     SetMax_Eigenvalue(geometry, config);
     if (center_jst) {
+      /*--- Compute the sensor and the undivided Laplacian and fuse their
+       *    halo exchanges into a single message, the per-message latency of
+       *    two small exchanges costs more than the extra bandwidth. ---*/
       SetCentered_Dissipation_Sensor(geometry, config);
       SetUndivided_Laplacian(geometry, config);
+      InitiateComms(geometry, config, LAPLACIAN_SENSOR);
+      CompleteComms(geometry, config, LAPLACIAN_SENSOR);
     }
   }
 
@@ -914,7 +926,14 @@ void CIncEulerSolver::CommonPreprocessing(CGeometry *geometry, CSolver **solver_
 
   if(!ReducerStrategy && !Output) {
     LinSysRes.SetValZero();
-    if (implicit) Jacobian.SetValZero();
+
+    /*--- With Jacobian lagging the matrix and its factorization may be
+     *    reused for several iterations, in which case it is not zeroed. ---*/
+    const auto jacLag = config->GetDiscrete_Adjoint()? 1 : config->GetJacobian_Lag_Flow();
+
+    if (implicit && JacobianRefreshDue(jacLag, config->GetJacobian_Lag_Growth(),
+                                       config->GetJacobian_Lag_Sol_Change()))
+      Jacobian.SetValZero();
     else {SU2_OMP_BARRIER} // because of "nowait" in LinSysRes
   }
 }
@@ -935,6 +954,13 @@ void CIncEulerSolver::Preprocessing(CGeometry *geometry, CSolver **solver_contai
 
   if (!Output && muscl && !center) {
 
+    /*--- Staleness-controlled reuse: late in the inner iterations of a dual
+     time step the solution changes little per iteration and the
+     reconstruction gradients and limiters may be lagged (see GRADIENT_LAG). ---*/
+
+    const auto gradLag = config->GetDiscrete_Adjoint() ? 1 : config->GetGradient_Lag();
+    if (!GradientRefreshDue(gradLag, config->GetGradient_Lag_Growth())) return;
+
     /*--- Gradient computation for MUSCL reconstruction. ---*/
 
     switch (config->GetKind_Gradient_Method_Recon()) {
@@ -1122,9 +1148,33 @@ void CIncEulerSolver::Centered_Residual(CGeometry *geometry, CSolver **solver_co
 
 }
 
+void CIncEulerSolver::InstantiateEdgeNumerics(const CSolver* const* solver_container, const CConfig* config) {
+
+  SU2_OMP_BARRIER
+  SU2_OMP_MASTER {
+
+  if (solver_container[TURB_SOL])
+    edgeNumerics = CNumericsSIMD::CreateNumerics(*config, nDim, MGLevel, solver_container[TURB_SOL]->GetNodes());
+  else
+    edgeNumerics = CNumericsSIMD::CreateNumerics(*config, nDim, MGLevel);
+
+  if (!edgeNumerics)
+    SU2_MPI::Error("The convective numerical scheme in use does not "
+                   "support vectorization.", CURRENT_FUNCTION);
+
+  }
+  END_SU2_OMP_MASTER
+  SU2_OMP_BARRIER
+}
+
 void CIncEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_container,
                                       CNumerics **numerics_container, CConfig *config, unsigned short iMesh) {
 
+  if (config->GetUseVectorization()) {
+    EdgeFluxResidual(geometry, solver_container, config);
+    return;
+  }
+
   CNumerics* numerics = numerics_container[CONV_TERM + omp_get_thread_num()*MAX_TERMS];
 
   /*--- Static arrays of MUSCL-reconstructed primitives and secondaries (thread safety). ---*/
@@ -2161,9 +2211,16 @@ void CIncEulerSolver::BC_Inlet(CGeometry *geometry, CSolver **solver_container,
   const bool implicit = (config->GetKind_TimeIntScheme() == EULER_IMPLICIT);
   const bool viscous = config->GetViscous();
 
-  string Marker_Tag = config->GetMarker_All_TagBound(val_marker);
+  INLET_TYPE Kind_Inlet = config->GetKind_Inc_Inlet(val_marker);
+
+  /*--- Resolve marker-constant config data once, outside of the vertex loop. ---*/
 
-  INLET_TYPE Kind_Inlet = config->GetKind_Inc_Inlet(Marker_Tag);
+  const su2double Velocity_Ref = config->GetVelocity_Ref();
+  const su2double Temperature_Ref = config->GetTemperature_Ref();
+  const su2double Pressure_Ref = config->GetPressure_Ref();
+  const bool useNormal = config->GetInc_Inlet_UseNormal();
+  const bool sst = (config->GetKind_Turb_Model() == TURB_MODEL::SST) ||
+                   (config->GetKind_Turb_Model() == TURB_MODEL::SST_SUST);
 
   su2double Normal[MAXNDIM] = {0.0};
 
@@ -2222,7 +2279,7 @@ void CIncEulerSolver::BC_Inlet(CGeometry *geometry, CSolver **solver_container,
 
         /*--- Retrieve the specified velocity and temperature for the inlet. ---*/
 
-        Vel_Mag  = Inlet_Ptotal[val_marker][iVertex]/config->GetVelocity_Ref();
+        Vel_Mag  = Inlet_Ptotal[val_marker][iVertex]/Velocity_Ref;
 
         /*--- Store the velocity in the primitive variable vector. ---*/
 
@@ -2231,7 +2288,7 @@ void CIncEulerSolver::BC_Inlet(CGeometry *geometry, CSolver **solver_container,
 
         /*--- Dirichlet condition for temperature (if energy is active) ---*/
 
-        V_inlet[prim_idx.Temperature()] = Inlet_Ttotal[val_marker][iVertex]/config->GetTemperature_Ref();
+        V_inlet[prim_idx.Temperature()] = Inlet_Ttotal[val_marker][iVertex]/Temperature_Ref;
 
         break;
 
@@ -2241,7 +2298,7 @@ void CIncEulerSolver::BC_Inlet(CGeometry *geometry, CSolver **solver_container,
 
         /*--- Retrieve the specified total pressure for the inlet. ---*/
 
-        P_total = Inlet_Ptotal[val_marker][iVertex]/config->GetPressure_Ref();
+        P_total = Inlet_Ptotal[val_marker][iVertex]/Pressure_Ref;
 
         /*--- Store the current static pressure for clarity. ---*/
 
@@ -2261,7 +2318,7 @@ void CIncEulerSolver::BC_Inlet(CGeometry *geometry, CSolver **solver_container,
 
           /*--- Back flow: use the prescribed P_total as static pressure. ---*/
 
-          V_inlet[prim_idx.Pressure()] = Inlet_Ptotal[val_marker][iVertex]/config->GetPressure_Ref();
+          V_inlet[prim_idx.Pressure()] = Inlet_Ptotal[val_marker][iVertex]/Pressure_Ref;
 
           /*--- Neumann condition for velocity. ---*/
 
@@ -2281,7 +2338,7 @@ void CIncEulerSolver::BC_Inlet(CGeometry *geometry, CSolver **solver_container,
           /*--- If requested, use the local boundary normal (negative),
            instead of the prescribed flow direction in the config. ---*/
 
-          if (config->GetInc_Inlet_UseNormal()) {
+          if (useNormal) {
             for (iDim = 0; iDim < nDim; iDim++)
               UnitFlowDir[iDim] = -Normal[iDim]/Area;
           }
@@ -2371,7 +2428,7 @@ void CIncEulerSolver::BC_Inlet(CGeometry *geometry, CSolver **solver_container,
 
     /*--- Turbulent kinetic energy ---*/
 
-    if ((config->GetKind_Turb_Model() == TURB_MODEL::SST) || (config->GetKind_Turb_Model() == TURB_MODEL::SST_SUST))
+    if (sst)
       visc_numerics->SetTurbKineticEnergy(solver_container[TURB_SOL]->GetNodes()->GetSolution(iPoint,0),
                                           solver_container[TURB_SOL]->GetNodes()->GetSolution(iPoint,0));
 
@@ -2394,16 +2451,46 @@ void CIncEulerSolver::BC_Outlet(CGeometry *geometry, CSolver **solver_container,
   unsigned short iDim;
   unsigned long iVertex, iPoint, Point_Normal;
   su2double *V_outlet, *V_domain, P_Outlet = 0.0, P_domain;
-  su2double mDot_Target, mDot_Old, dP, Density_Avg, Area_Outlet;
+  su2double mDot_Target, mDot_Old, Density_Avg, Area_Outlet;
+  su2double dP = 0.0;
   su2double Damping = config->GetInc_Outlet_Damping();
 
   const bool implicit = (config->GetKind_TimeIntScheme() == EULER_IMPLICIT);
   const bool viscous = config->GetViscous();
+  const bool sst = (config->GetKind_Turb_Model() == TURB_MODEL::SST) ||
+                   (config->GetKind_Turb_Model() == TURB_MODEL::SST_SUST);
   string Marker_Tag  = config->GetMarker_All_TagBound(val_marker);
 
   su2double Normal[MAXNDIM] = {0.0};
 
-  INC_OUTLET_TYPE Kind_Outlet = config->GetKind_Inc_Outlet(Marker_Tag);
+  INC_OUTLET_TYPE Kind_Outlet = config->GetKind_Inc_Outlet(val_marker);
+
+  /*--- Resolve the marker-constant outlet data once, outside of the vertex loop.
+   These getters look the marker up in per-marker config arrays, which is
+   far too expensive to repeat for every vertex on large outlets. ---*/
+
+  const su2double P_Outlet_Spec = config->GetOutlet_Pressure(val_marker)/config->GetPressure_Ref();
+
+  if (Kind_Outlet == INC_OUTLET_TYPE::MASS_FLOW_OUTLET) {
+
+    /*--- Retrieve the specified target mass flow at the outlet. ---*/
+
+    mDot_Target = config->GetOutlet_Pressure(val_marker)/(config->GetDensity_Ref() * config->GetVelocity_Ref());
+
+    /*--- Retrieve the old mass flow, density, and area of the outlet,
+     which has been computed in a preprocessing step. These values
+     were stored in non-dim. form in the config container. ---*/
+
+    mDot_Old    = config->GetOutlet_MassFlow(Marker_Tag);
+    Density_Avg = config->GetOutlet_Density(Marker_Tag);
+    Area_Outlet = config->GetOutlet_Area(Marker_Tag);
+
+    /*--- Compute the pressure increment based on the difference
+     between the current and target mass flow. Note that increasing
+     pressure decreases flow speed. ---*/
+
+    dP = 0.5*Density_Avg*(mDot_Old*mDot_Old - mDot_Target*mDot_Target)/((Density_Avg*Area_Outlet)*(Density_Avg*Area_Outlet));
+  }
 
   /*--- Loop over all the vertices on this boundary marker ---*/
 
@@ -2446,9 +2533,9 @@ void CIncEulerSolver::BC_Outlet(CGeometry *geometry, CSolver **solver_container,
 
       case INC_OUTLET_TYPE::PRESSURE_OUTLET:
 
-        /*--- Retrieve the specified back pressure for this outlet. ---*/
+        /*--- The prescribed back pressure is applied at the outlet. ---*/
 
-        P_Outlet = config->GetOutlet_Pressure(Marker_Tag)/config->GetPressure_Ref();
+        P_Outlet = P_Outlet_Spec;
 
         /*--- The pressure is prescribed at the outlet. ---*/
 
@@ -2466,25 +2553,8 @@ void CIncEulerSolver::BC_Outlet(CGeometry *geometry, CSolver **solver_container,
 
       case INC_OUTLET_TYPE::MASS_FLOW_OUTLET:
 
-        /*--- Retrieve the specified target mass flow at the outlet. ---*/
-
-        mDot_Target = config->GetOutlet_Pressure(Marker_Tag)/(config->GetDensity_Ref() * config->GetVelocity_Ref());
-
-        /*--- Retrieve the old mass flow, density, and area of the outlet,
-         which has been computed in a preprocessing step. These values
-         were stored in non-dim. form in the config container. ---*/
-
-        mDot_Old    = config->GetOutlet_MassFlow(Marker_Tag);
-        Density_Avg = config->GetOutlet_Density(Marker_Tag);
-        Area_Outlet = config->GetOutlet_Area(Marker_Tag);
-
-        /*--- Compute the pressure increment based on the difference
-         between the current and target mass flow. Note that increasing
-         pressure decreases flow speed. ---*/
-
-        dP = 0.5*Density_Avg*(mDot_Old*mDot_Old - mDot_Target*mDot_Target)/((Density_Avg*Area_Outlet)*(Density_Avg*Area_Outlet));
-
-        /*--- Update the new outlet pressure. Note that we use damping
+        /*--- Update the new outlet pressure using the marker-wide pressure
+         increment computed before the loop. Note that we use damping
          here to improve stability/convergence. ---*/
 
         P_Outlet = P_domain + Damping*dP;
@@ -2569,7 +2639,7 @@ void CIncEulerSolver::BC_Outlet(CGeometry *geometry, CSolver **solver_container,
 
     /*--- Turbulent kinetic energy ---*/
 
-    if ((config->GetKind_Turb_Model() == TURB_MODEL::SST) || (config->GetKind_Turb_Model() == TURB_MODEL::SST_SUST))
+    if (sst)
       visc_numerics->SetTurbKineticEnergy(solver_container[TURB_SOL]->GetNodes()->GetSolution(iPoint,0),
                                           solver_container[TURB_SOL]->GetNodes()->GetSolution(iPoint,0));
 
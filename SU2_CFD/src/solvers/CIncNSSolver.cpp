@@ -74,9 +74,17 @@ void CIncNSSolver::Preprocessing(CGeometry *geometry, CSolver **solver_container
 
   CommonPreprocessing(geometry, solver_container, config, iMesh, iRKStep, RunTime_EqSystem, Output);
 
+  /*--- Staleness-controlled reuse: late in the inner iterations of a dual
+   time step the solution changes little per iteration and the gradients,
+   limiters, and derived quantities may be lagged (see GRADIENT_LAG). The
+   Output calls always compute, they feed the turbulence solver and post. ---*/
+
+  const auto gradLag = (config->GetDiscrete_Adjoint() || Output) ? 1 : config->GetGradient_Lag();
+  const bool gradRefresh = GradientRefreshDue(gradLag, config->GetGradient_Lag_Growth());
+
   /*--- Compute gradient for MUSCL reconstruction ---*/
 
-  if (config->GetReconstructionGradientRequired() && muscl && !center) {
+  if (gradRefresh && config->GetReconstructionGradientRequired() && muscl && !center) {
     switch (config->GetKind_Gradient_Method_Recon()) {
       case GREEN_GAUSS:
         SetPrimitive_Gradient_GG(geometry, config, true); break;
@@ -89,20 +97,24 @@ void CIncNSSolver::Preprocessing(CGeometry *geometry, CSolver **solver_container
 
   /*--- Compute gradient of the primitive variables ---*/
 
-  if (config->GetKind_Gradient_Method() == GREEN_GAUSS) {
-    SetPrimitive_Gradient_GG(geometry, config);
+  if (gradRefresh && config->GetKind_Gradient_Method() == GREEN_GAUSS) {
+    /*--- Optionally batch the sweep with the solution gradients of the scalar solvers. ---*/
+    if (config->GetFused_Solver_Gradients() && (iMesh == MESH_0) && !Output && !config->GetDiscrete_Adjoint())
+      SetFused_Gradient_GG(geometry, solver_container, config);
+    else
+      SetPrimitive_Gradient_GG(geometry, config);
   }
-  else if (config->GetKind_Gradient_Method() == WEIGHTED_LEAST_SQUARES) {
+  else if (gradRefresh && config->GetKind_Gradient_Method() == WEIGHTED_LEAST_SQUARES) {
     SetPrimitive_Gradient_LS(geometry, config);
   }
 
   /*--- Compute the limiters ---*/
 
-  if (muscl && !center && limiter && !van_albada && !Output) {
+  if (gradRefresh && muscl && !center && limiter && !van_albada && !Output) {
     SetPrimitive_Limiter(geometry, config);
   }
 
-  ComputeVorticityAndStrainMag(*config, iMesh);
+  if (gradRefresh) ComputeVorticityAndStrainMag(*config, iMesh);
 
   /*--- Compute the TauWall from the wall functions ---*/
 
@@ -342,28 +354,24 @@ void CIncNSSolver::BC_Wall_Generic(const CGeometry *geometry, const CConfig *con
   su2double Cp, thermal_conductivity, dot_product, scalar_factor;
 
 
-  /*--- Identify the boundary by string name ---*/
-
-  const auto Marker_Tag = config->GetMarker_All_TagBound(val_marker);
-
   /*--- Get the specified wall heat flux, temperature or heat transfer coefficient from config ---*/
 
   su2double Wall_HeatFlux = 0.0, Twall = 0.0, Tinfinity = 0.0, Transfer_Coefficient = 0.0;
 
   switch (kind_boundary) {
     case HEAT_FLUX:
-      Wall_HeatFlux = config->GetWall_HeatFlux(Marker_Tag) / config->GetHeat_Flux_Ref();
+      Wall_HeatFlux = config->GetWall_HeatFlux(val_marker) / config->GetHeat_Flux_Ref();
       if (config->GetIntegrated_HeatFlux()) {
         Wall_HeatFlux /= geometry->GetSurfaceArea(config, val_marker);
       }
       break;
     case ISOTHERMAL:
-      Twall = config->GetIsothermal_Temperature(Marker_Tag) / config->GetTemperature_Ref();
+      Twall = config->GetIsothermal_Temperature(val_marker) / config->GetTemperature_Ref();
       break;
     case HEAT_TRANSFER:
-      Transfer_Coefficient = config->GetWall_HeatTransfer_Coefficient(Marker_Tag) * config->GetTemperature_Ref() /
+      Transfer_Coefficient = config->GetWall_HeatTransfer_Coefficient(val_marker) * config->GetTemperature_Ref() /
                              config->GetHeat_Flux_Ref();
-      Tinfinity = config->GetWall_HeatTransfer_Temperature(Marker_Tag) / config->GetTemperature_Ref();
+      Tinfinity = config->GetWall_HeatTransfer_Temperature(val_marker) / config->GetTemperature_Ref();
       break;
     default:
       SU2_MPI::Error("Unknown type of boundary condition.", CURRENT_FUNCTION);
@@ -522,13 +530,9 @@ void CIncNSSolver::BC_ConjugateHeat_Interface(CGeometry *geometry, CSolver **sol
   const bool implicit = (config->GetKind_TimeIntScheme() == EULER_IMPLICIT);
   const bool energy = config->GetEnergy_Equation();
 
-  /*--- Identify the boundary ---*/
-
-  const auto Marker_Tag = config->GetMarker_All_TagBound(val_marker);
-
   /*--- Retrieve the specified wall function treatment.---*/
 
-  if (config->GetWallFunction_Treatment(Marker_Tag) != WALL_FUNCTIONS::NONE) {
+  if (config->GetWallFunction_Treatment(val_marker) != WALL_FUNCTIONS::NONE) {
     SU2_MPI::Error("Wall function treatment not implemented yet.", CURRENT_FUNCTION);
   }
 
@@ -636,13 +640,9 @@ void CIncNSSolver::SetTau_Wall_WF(CGeometry *geometry, CSolver **solver_containe
 
     if (!config->GetViscous_Wall(iMarker)) continue;
 
-    /*--- Identify the boundary by string name ---*/
-
-    const auto Marker_Tag = config->GetMarker_All_TagBound(iMarker);
-
     /*--- Jump to another BC if it is not wall function ---*/
 
-    if (config->GetWallFunction_Treatment(Marker_Tag) != WALL_FUNCTIONS::STANDARD_FUNCTION)
+    if (config->GetWallFunction_Treatment(iMarker) != WALL_FUNCTIONS::STANDARD_FUNCTION)
       continue;
 
     /*--- Loop over all of the vertices on this boundary marker ---*/
@@ -712,12 +712,12 @@ void CIncNSSolver::SetTau_Wall_WF(CGeometry *geometry, CSolver **solver_containe
         q_w = Conductivity_Wall * (T_Wall - T_n) / (WallDistMod);
       }
       else if (config->GetMarker_All_KindBC(iMarker) == HEAT_FLUX) {
-        q_w = config->GetWall_HeatFlux(Marker_Tag) / config->GetHeat_Flux_Ref();
+        q_w = config->GetWall_HeatFlux(iMarker) / config->GetHeat_Flux_Ref();
       }
       else if (config->GetMarker_All_KindBC(iMarker) == HEAT_TRANSFER) {
-        const su2double Transfer_Coefficient = config->GetWall_HeatTransfer_Coefficient(Marker_Tag) *
+        const su2double Transfer_Coefficient = config->GetWall_HeatTransfer_Coefficient(iMarker) *
                                                config->GetTemperature_Ref()/config->GetHeat_Flux_Ref();
-        const su2double Tinfinity = config->GetWall_HeatTransfer_Temperature(Marker_Tag) / config->GetTemperature_Ref();
+        const su2double Tinfinity = config->GetWall_HeatTransfer_Temperature(iMarker) / config->GetTemperature_Ref();
         q_w = Transfer_Coefficient * (Tinfinity - T_Wall);
       }
 
@@ -631,21 +631,22 @@ void CMeshSolver::ComputeGridVelocity(CGeometry **geometry, const CConfig *confi
   SU2_OMP_FOR_STAT(omp_chunk_size)
   for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++) {
 
-    /*--- Coordinates of the current point at n+1, n, & n-1 time levels. ---*/
+    /*--- Displacements of the current point at the n+1, n, & n-1 time levels,
+     the older levels are reconstructed on-the-fly if stored in single precision. ---*/
 
-    const su2double* Disp_nM1 = nodes->GetSolution_time_n1(iPoint);
-    const su2double* Disp_n   = nodes->GetSolution_time_n(iPoint);
     const su2double* Disp_nP1 = nodes->GetSolution(iPoint);
 
     /*--- Compute mesh velocity for this point with 1st or 2nd-order approximation. ---*/
 
     for (unsigned short iDim = 0; iDim < nDim; iDim++) {
 
+      const su2double Disp_n = nodes->GetDisp_time_n(iPoint, iDim);
+
       su2double GridVel = 0.0;
       if (firstOrder)
-        GridVel = (Disp_nP1[iDim] - Disp_n[iDim]) * invTimeStep;
+        GridVel = (Disp_nP1[iDim] - Disp_n) * invTimeStep;
       else if (secondOrder)
-        GridVel = (1.5*Disp_nP1[iDim] - 2.0*Disp_n[iDim] + 0.5*Disp_nM1[iDim]) * invTimeStep;
+        GridVel = (1.5*Disp_nP1[iDim] - 2.0*Disp_n + 0.5*nodes->GetDisp_time_n1(iPoint, iDim)) * invTimeStep;
 
       geometry[MESH_0]->nodes->SetGridVel(iPoint, iDim, GridVel);
     }
@@ -761,8 +762,7 @@ void CMeshSolver::SetBoundaryDisplacements(CGeometry *geometry, CConfig *config,
 
 void CMeshSolver::SetDualTime_Mesh(void){
 
-  nodes->Set_Solution_time_n1();
-  nodes->Set_Solution_time_n();
+  nodes->Shift_DispHistory();
 }
 
 void CMeshSolver::LoadRestart(CGeometry **geometry, CSolver ***solver, CConfig *config, int val_iter, bool val_update_geo) {
@@ -862,7 +862,7 @@ void CMeshSolver::LoadRestart(CGeometry **geometry, CSolver ***solver, CConfig *
   /*--- Delete the class memory that is used to load the restart. ---*/
 
   delete [] Restart_Vars; Restart_Vars = nullptr;
-  delete [] Restart_Data; Restart_Data = nullptr;
+  FreeRestartData();
 
 }
 
@@ -900,8 +900,8 @@ void CMeshSolver::RestartOldGeometry(CGeometry *geometry, const CConfig *config)
 
       for (unsigned long iPoint = 0; iPoint < nPoint; ++iPoint) {
         for (unsigned short iDim = 0; iDim < nDim; iDim++) {
-          if(iStep == 1) nodes->Set_Solution_time_n(iPoint, iDim, 0.0);
-          else nodes->Set_Solution_time_n1(iPoint, iDim, 0.0);
+          if(iStep == 1) nodes->SetDisp_time_n(iPoint, iDim, 0.0);
+          else nodes->SetDisp_time_n1(iPoint, iDim, 0.0);
         }
       }
     }
@@ -939,9 +939,9 @@ void CMeshSolver::RestartOldGeometry(CGeometry *geometry, const CConfig *config)
             su2double displ = curr_coord - nodes->GetMesh_Coord(iPoint_Local,iDim);
 
             if(iStep==1)
-              nodes->Set_Solution_time_n(iPoint_Local, iDim, displ);
+              nodes->SetDisp_time_n(iPoint_Local, iDim, displ);
             else
-              nodes->Set_Solution_time_n1(iPoint_Local, iDim, displ);
+              nodes->SetDisp_time_n1(iPoint_Local, iDim, displ);
           }
 
           /*--- Increment the overall counter for how many points have been loaded. ---*/
@@ -961,7 +961,7 @@ void CMeshSolver::RestartOldGeometry(CGeometry *geometry, const CConfig *config)
     /*--- Delete the class memory that is used to load the restart. ---*/
 
     delete [] Restart_Vars; Restart_Vars = nullptr;
-    delete [] Restart_Data; Restart_Data = nullptr;
+    FreeRestartData();
 
     InitiateComms(geometry, config, CommType);
     CompleteComms(geometry, config, CommType);
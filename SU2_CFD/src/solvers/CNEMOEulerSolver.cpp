@@ -259,6 +259,10 @@ void CNEMOEulerSolver::CommonPreprocessing(CGeometry *geometry, CSolver **solver
 
   SU2_OMP_MASTER { /*--- Ops that are not OpenMP parallel go in this block. ---*/
 
+    /*--- The primitives changed, the scalar solvers must not reuse their face-state cache. ---*/
+
+    InvalidateEdgeFaceVelCache();
+
     if ((iMesh == MESH_0) && (config->GetComm_Level() == COMM_FULL)) {
       unsigned long tmp = ErrorCounter;
       SU2_MPI::Allreduce(&tmp, &ErrorCounter, 1, MPI_UNSIGNED_LONG, MPI_SUM, SU2_MPI::GetComm());
@@ -304,6 +308,11 @@ void CNEMOEulerSolver::Preprocessing(CGeometry *geometry, CSolver **solver_conta
   /*--- Upwind second order reconstruction ---*/
   if (muscl && !center && !Output) {
 
+    /*--- Staleness-controlled reuse: the reconstruction gradients and limiters
+     may be lagged over inner iterations (see GRADIENT_LAG). ---*/
+    const auto gradLag = config->GetDiscrete_Adjoint() ? 1 : config->GetGradient_Lag();
+    if (!GradientRefreshDue(gradLag, config->GetGradient_Lag_Growth())) return;
+
     /*--- Calculate the gradients ---*/
     if (config->GetKind_Gradient_Method() == GREEN_GAUSS) {
       SetPrimitive_Gradient_GG(geometry, config, true);
@@ -669,13 +678,8 @@ su2double CNEMOEulerSolver::ComputeConsistentExtrapolation(CNEMOGas *fluidmodel,
   /*--- Set new fluid state ---*/
   fluidmodel->SetTDStateRhosTTv(rhos, V[T_INDEX], V[TVE_INDEX]);
 
-  /*---Compute the secondary values ---*/
-  // This block of code copies a vector to corresponding pointer.
-  auto it = val_eves;
-  auto& ref = fluidmodel->ComputeSpeciesEve(V[TVE_INDEX]);
-  for (auto v : ref) {
-    *it = v;  ++it;
-  }
+  /*---Compute the secondary values, written directly into the output buffer ---*/
+  fluidmodel->ComputeSpeciesEveBatch(1, &V[TVE_INDEX], val_eves);
 
   val_gamma = fluidmodel->ComputeGamma();
 
@@ -939,7 +943,11 @@ void CNEMOEulerSolver::PrepareImplicitIteration(CGeometry *geometry, CSolver**,
 
 void CNEMOEulerSolver::CompleteImplicitIteration(CGeometry *geometry, CSolver**, CConfig *config) {
 
-  CompleteImplicitIteration_impl<true>(geometry, config);
+  /*--- The species-aware under-relaxation strategy below replaces the fused base
+   strategy, the factors are stored ahead of the solution update. ---*/
+  ComputeUnderRelaxationFactor(config);
+
+  CompleteImplicitIteration_impl<false>(geometry, config);
 }
 
 void CNEMOEulerSolver::ComputeUnderRelaxationFactor(const CConfig *config) {
@@ -68,9 +68,15 @@ void CNEMONSSolver::Preprocessing(CGeometry *geometry, CSolver **solver_containe
 
   CommonPreprocessing(geometry, solver_container, config, iMesh, iRKStep, RunTime_EqSystem, Output);
 
+  /*--- Staleness-controlled reuse: the gradients, limiters, and derived
+   quantities may be lagged over inner iterations (see GRADIENT_LAG). ---*/
+
+  const auto gradLag = (config->GetDiscrete_Adjoint() || Output) ? 1 : config->GetGradient_Lag();
+  const bool gradRefresh = GradientRefreshDue(gradLag, config->GetGradient_Lag_Growth());
+
   /*--- Compute gradient for MUSCL reconstruction. ---*/
 
-  if (config->GetReconstructionGradientRequired() && muscl && !center) {
+  if (gradRefresh && config->GetReconstructionGradientRequired() && muscl && !center) {
     switch (config->GetKind_Gradient_Method_Recon()) {
       case GREEN_GAUSS:
         SetPrimitive_Gradient_GG(geometry, config, true); break;
@@ -83,22 +89,22 @@ void CNEMONSSolver::Preprocessing(CGeometry *geometry, CSolver **solver_containe
 
   /*--- Compute gradient of the primitive variables ---*/
 
-  if (config->GetKind_Gradient_Method() == GREEN_GAUSS) {
+  if (gradRefresh && config->GetKind_Gradient_Method() == GREEN_GAUSS) {
     SetPrimitive_Gradient_GG(geometry, config);
   }
-  else if (config->GetKind_Gradient_Method() == WEIGHTED_LEAST_SQUARES) {
+  else if (gradRefresh && config->GetKind_Gradient_Method() == WEIGHTED_LEAST_SQUARES) {
     SetPrimitive_Gradient_LS(geometry, config);
   }
 
   /*--- Compute the limiters ---*/
 
-  if (muscl && !center && limiter && !van_albada && !Output) {
+  if (gradRefresh && muscl && !center && limiter && !van_albada && !Output) {
     SetPrimitive_Limiter(geometry, config);
   }
 
   /*--- Compute vorticity and strain mag. ---*/
 
-  ComputeVorticityAndStrainMag(*config, iMesh);
+  if (gradRefresh) ComputeVorticityAndStrainMag(*config, iMesh);
 
   /*--- Compute the TauWall from the wall functions ---*/
 
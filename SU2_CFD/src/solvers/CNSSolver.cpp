@@ -82,13 +82,21 @@ void CNSSolver::Preprocessing(CGeometry *geometry, CSolver **solver_container, C
 
   CommonPreprocessing(geometry, solver_container, config, iMesh, iRKStep, RunTime_EqSystem, Output);
 
+  /*--- Staleness-controlled reuse: late in the inner iterations of a dual
+   time step the solution changes little per iteration and the gradients,
+   limiters, and derived quantities may be lagged (see GRADIENT_LAG). The
+   Output calls always compute, they feed the turbulence solver and post. ---*/
+
+  const auto gradLag = (config->GetDiscrete_Adjoint() || Output) ? 1 : config->GetGradient_Lag();
+  const bool gradRefresh = GradientRefreshDue(gradLag, config->GetGradient_Lag_Growth());
+
   /*--- Compute gradient for MUSCL reconstruction, for output (i.e. the
    turbulence solver, and post) only temperature and velocity are needed ---*/
 
   const auto nPrimVarGrad_bak = nPrimVarGrad;
   if (Output) ompMasterAssignBarrier(nPrimVarGrad, 1+nDim);
 
-  if (config->GetReconstructionGradientRequired() && muscl && !center) {
+  if (gradRefresh && config->GetReconstructionGradientRequired() && muscl && !center) {
     switch (config->GetKind_Gradient_Method_Recon()) {
       case GREEN_GAUSS:
         SetPrimitive_Gradient_GG(geometry, config, true); break;
@@ -101,10 +109,14 @@ void CNSSolver::Preprocessing(CGeometry *geometry, CSolver **solver_container, C
 
   /*--- Compute gradient of the primitive variables ---*/
 
-  if (config->GetKind_Gradient_Method() == GREEN_GAUSS) {
-    SetPrimitive_Gradient_GG(geometry, config);
+  if (gradRefresh && config->GetKind_Gradient_Method() == GREEN_GAUSS) {
+    /*--- Optionally batch the sweep with the solution gradients of the scalar solvers. ---*/
+    if (config->GetFused_Solver_Gradients() && (iMesh == MESH_0) && !Output && !config->GetDiscrete_Adjoint())
+      SetFused_Gradient_GG(geometry, solver_container, config);
+    else
+      SetPrimitive_Gradient_GG(geometry, config);
   }
-  else if (config->GetKind_Gradient_Method() == WEIGHTED_LEAST_SQUARES) {
+  else if (gradRefresh && config->GetKind_Gradient_Method() == WEIGHTED_LEAST_SQUARES) {
     SetPrimitive_Gradient_LS(geometry, config);
   }
 
@@ -112,11 +124,11 @@ void CNSSolver::Preprocessing(CGeometry *geometry, CSolver **solver_container, C
 
   /*--- Compute the limiters ---*/
 
-  if (muscl && !center && limiter && !van_albada && !Output) {
+  if (gradRefresh && muscl && !center && limiter && !van_albada && !Output) {
     SetPrimitive_Limiter(geometry, config);
   }
 
-  ComputeVorticityAndStrainMag(*config, iMesh);
+  if (gradRefresh) ComputeVorticityAndStrainMag(*config, iMesh);
 
   /*--- Compute the TauWall from the wall functions ---*/
 
@@ -427,22 +439,21 @@ void CNSSolver::BC_HeatFlux_Wall_Generic(const CGeometry* geometry, const CConfi
    heat flux from config as well as the wall function treatment. ---*/
 
   const bool implicit = (config->GetKind_TimeIntScheme() == EULER_IMPLICIT);
-  const auto Marker_Tag = config->GetMarker_All_TagBound(val_marker);
 
   /*--- Get the specified wall heat flux, temperature or heat transfer coefficient from config ---*/
 
   su2double Wall_HeatFlux = 0.0, Tinfinity = 0.0, Transfer_Coefficient = 0.0;
 
   if (kind_boundary == HEAT_FLUX) {
-    Wall_HeatFlux = config->GetWall_HeatFlux(Marker_Tag) / config->GetHeat_Flux_Ref();
+    Wall_HeatFlux = config->GetWall_HeatFlux(val_marker) / config->GetHeat_Flux_Ref();
     if (config->GetIntegrated_HeatFlux()) {
       Wall_HeatFlux /= geometry->GetSurfaceArea(config, val_marker);
     }
   } else if (kind_boundary == HEAT_TRANSFER) {
     /*--- The required heatflux will be computed for each iPoint individually based on local Temperature. ---*/
-    Transfer_Coefficient = config->GetWall_HeatTransfer_Coefficient(Marker_Tag) * config->GetTemperature_Ref() /
+    Transfer_Coefficient = config->GetWall_HeatTransfer_Coefficient(val_marker) * config->GetTemperature_Ref() /
                            config->GetHeat_Flux_Ref();
-    Tinfinity = config->GetWall_HeatTransfer_Temperature(Marker_Tag) / config->GetTemperature_Ref();
+    Tinfinity = config->GetWall_HeatTransfer_Temperature(val_marker) / config->GetTemperature_Ref();
   }
 
 //  Wall_Function = config->GetWallFunction_Treatment(Marker_Tag);
@@ -627,10 +638,9 @@ void CNSSolver::BC_Isothermal_Wall_Generic(CGeometry *geometry, CSolver **solver
   /*--- Identify the boundary and retrieve the specified wall temperature from
    the config (for non-CHT problems) as well as the wall function treatment. ---*/
 
-  const auto Marker_Tag = config->GetMarker_All_TagBound(val_marker);
   su2double Twall = 0.0;
   if (!cht_mode) {
-    Twall = config->GetIsothermal_Temperature(Marker_Tag) / Temperature_Ref;
+    Twall = config->GetIsothermal_Temperature(val_marker) / Temperature_Ref;
   }
 
 //  Wall_Function = config->GetWallFunction_Treatment(Marker_Tag);
@@ -813,210 +823,267 @@ void CNSSolver::SetTau_Wall_WF(CGeometry *geometry, CSolver **solver_container,
 
     if (!config->GetViscous_Wall(iMarker)) continue;
 
-    /*--- Identify the boundary by string name ---*/
-
-    const auto Marker_Tag = config->GetMarker_All_TagBound(iMarker);
-
     /*--- Jump to another BC if it is not wall function ---*/
 
-    if (config->GetWallFunction_Treatment(Marker_Tag) != WALL_FUNCTIONS::STANDARD_FUNCTION)
+    if (config->GetWallFunction_Treatment(iMarker) != WALL_FUNCTIONS::STANDARD_FUNCTION)
       continue;
 
-    /*--- Loop over all of the vertices on this boundary marker ---*/
+    /*--- Values that are uniform over the marker. ---*/
 
-    SU2_OMP_FOR_DYN(OMP_MIN_SIZE)
-    for (auto iVertex = 0u; iVertex < geometry->nVertex[iMarker]; iVertex++) {
+    const bool isothermal = (config->GetMarker_All_KindBC(iMarker) == ISOTHERMAL);
 
-      const auto iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
-      const auto Point_Normal = geometry->vertex[iMarker][iVertex]->GetNormal_Neighbor();
+    su2double q_w = 0.0;
 
-      /*--- Check if the node belongs to the domain (i.e, not a halo node)
-       *    and the neighbor is not part of the physical boundary ---*/
+    if (config->GetMarker_All_KindBC(iMarker) == HEAT_FLUX) {
+      q_w = config->GetWall_HeatFlux(iMarker) / config->GetHeat_Flux_Ref();
+    }
 
-      if (!geometry->nodes->GetDomain(iPoint)) continue;
+    /*--- Convergence criterium for the Newton solver, note that 1e-10 is too large ---*/
+    const su2double tol = 1e-12;
 
-      /*--- Get coordinates of the current vertex and nearest normal point ---*/
+    /*--- Loop over the vertices of this boundary marker in small tiles. The
+     *    vertices of a tile are gathered first, their Newton iterations are
+     *    then advanced together with convergence masking, so the
+     *    transcendental-heavy updates run back-to-back over the tile, and the
+     *    results are scattered at the end. ---*/
 
-      const auto Coord = geometry->nodes->GetCoord(iPoint);
-      const auto Coord_Normal = geometry->nodes->GetCoord(Point_Normal);
+    constexpr unsigned long TILE = 8;
+    const unsigned long nVertexWF = geometry->nVertex[iMarker];
+    const unsigned long nTiles = (nVertexWF + TILE - 1) / TILE;
 
-      /*--- Compute dual-grid area and boundary normal ---*/
+    SU2_OMP_FOR_DYN(roundUpDiv(OMP_MIN_SIZE,TILE))
+    for (auto iTile = 0ul; iTile < nTiles; iTile++) {
 
-      const auto Normal = geometry->vertex[iMarker][iVertex]->GetNormal();
+      /*--- Per-lane state of the tile. ---*/
 
-      const su2double Area = GeometryToolbox::Norm(nDim, Normal);
+      unsigned long pointLane[TILE], vertexLane[TILE];
+      su2double velTangLane[TILE], wallDistLane[TILE], lamViscWLane[TILE], lamViscNLane[TILE],
+                conductLane[TILE], tNormalLane[TILE], pWallLane[TILE], tWallLane[TILE],
+                densWLane[TILE], uTauLane[TILE], yPlusLane[TILE], eddyViscLane[TILE], diffLane[TILE];
+      bool activeLane[TILE] = {false};
+      unsigned long nLane = 0, nActive = 0;
 
-      su2double UnitNormal[MAXNDIM] = {0.0};
-      for (auto iDim = 0u; iDim < nDim; iDim++)
-        UnitNormal[iDim] = -Normal[iDim]/Area;
+      /*--- Gather phase, everything that does not change during the iteration. ---*/
 
-      /*--- Get the velocity, pressure, and temperature at the nearest
-       (normal) interior point. ---*/
+      for (auto iVertex = iTile*TILE; iVertex < min(nVertexWF, (iTile+1)*TILE); iVertex++) {
 
-      su2double Vel[MAXNDIM] = {0.0};
-      for (auto iDim = 0u; iDim < nDim; iDim++)
-        Vel[iDim] = nodes->GetVelocity(Point_Normal,iDim);
+        const auto iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+        const auto Point_Normal = geometry->vertex[iMarker][iVertex]->GetNormal_Neighbor();
 
-      const su2double P_Normal = nodes->GetPressure(Point_Normal);
-      const su2double T_Normal = nodes->GetTemperature(Point_Normal);
+        /*--- Check if the node belongs to the domain (i.e, not a halo node)
+         *    and the neighbor is not part of the physical boundary ---*/
 
-      /*--- Compute the wall-parallel velocity at first point off the wall ---*/
+        if (!geometry->nodes->GetDomain(iPoint)) continue;
 
-      const su2double VelNormal = GeometryToolbox::DotProduct(int(MAXNDIM), Vel, UnitNormal);
+        /*--- Get coordinates of the current vertex and nearest normal point ---*/
 
-      su2double VelTang[MAXNDIM] = {0.0};
-      for (auto iDim = 0u; iDim < nDim; iDim++)
-        VelTang[iDim] = Vel[iDim] - VelNormal*UnitNormal[iDim];
+        const auto Coord = geometry->nodes->GetCoord(iPoint);
+        const auto Coord_Normal = geometry->nodes->GetCoord(Point_Normal);
 
-      const su2double VelTangMod = GeometryToolbox::Norm(int(MAXNDIM), VelTang);
+        /*--- Compute dual-grid area and boundary normal ---*/
 
-      /*--- Compute normal distance of the interior point from the wall ---*/
+        const auto Normal = geometry->vertex[iMarker][iVertex]->GetNormal();
 
-      su2double WallDist[MAXNDIM] = {0.0};
-      GeometryToolbox::Distance(nDim, Coord, Coord_Normal, WallDist);
+        const su2double Area = GeometryToolbox::Norm(nDim, Normal);
 
-      const su2double WallDistMod = GeometryToolbox::Norm(int(MAXNDIM), WallDist);
+        su2double UnitNormal[MAXNDIM] = {0.0};
+        for (auto iDim = 0u; iDim < nDim; iDim++)
+          UnitNormal[iDim] = -Normal[iDim]/Area;
 
-      /*--- Initial value for wall temperature ---*/
+        /*--- Get the velocity, pressure, and temperature at the nearest
+         (normal) interior point. ---*/
 
-      su2double q_w = 0.0;
+        su2double Vel[MAXNDIM] = {0.0};
+        for (auto iDim = 0u; iDim < nDim; iDim++)
+          Vel[iDim] = nodes->GetVelocity(Point_Normal,iDim);
 
-      if (config->GetMarker_All_KindBC(iMarker) == HEAT_FLUX) {
-        q_w = config->GetWall_HeatFlux(Marker_Tag) / config->GetHeat_Flux_Ref();
-      }
+        const su2double P_Normal = nodes->GetPressure(Point_Normal);
+        const su2double T_Normal = nodes->GetTemperature(Point_Normal);
 
-      /*--- Extrapolate the pressure from the interior & compute the
-       wall density using the equation of state ---*/
+        /*--- Compute the wall-parallel velocity at first point off the wall ---*/
 
-      /*--- Compressible formulation ---*/
+        const su2double VelNormal = GeometryToolbox::DotProduct(int(MAXNDIM), Vel, UnitNormal);
 
-      su2double T_Wall = nodes->GetTemperature(iPoint);
-      const su2double P_Wall = P_Normal;
-      su2double Density_Wall = P_Wall / (Gas_Constant * T_Wall);
-      const su2double Lam_Visc_Normal = nodes->GetLaminarViscosity(Point_Normal);
-      const su2double Conductivity_Wall = nodes->GetThermalConductivity(iPoint);
+        su2double VelTang[MAXNDIM] = {0.0};
+        for (auto iDim = 0u; iDim < nDim; iDim++)
+          VelTang[iDim] = Vel[iDim] - VelNormal*UnitNormal[iDim];
 
+        const su2double VelTangMod = GeometryToolbox::Norm(int(MAXNDIM), VelTang);
 
-      /*--- Compute the shear stress at the wall in the regular fashion
-       *    by using the stress tensor on the surface ---*/
+        /*--- Compute normal distance of the interior point from the wall ---*/
 
-      su2double tau[MAXNDIM][MAXNDIM] = {{0.0}};
-      const su2double Lam_Visc_Wall = nodes->GetLaminarViscosity(iPoint);
-      su2double Eddy_Visc_Wall = nodes->GetEddyViscosity(iPoint);
+        su2double WallDist[MAXNDIM] = {0.0};
+        GeometryToolbox::Distance(nDim, Coord, Coord_Normal, WallDist);
 
-      CNumerics::ComputeStressTensor(nDim, tau, nodes->GetVelocityGradient(iPoint), Lam_Visc_Wall);
+        const su2double WallDistMod = GeometryToolbox::Norm(int(MAXNDIM), WallDist);
 
-      su2double TauTangent[MAXNDIM] = {0.0};
-      GeometryToolbox::TangentProjection(nDim, tau, UnitNormal, TauTangent);
+        /*--- Extrapolate the pressure from the interior & compute the
+         wall density using the equation of state ---*/
 
-      const su2double WallShearStress = GeometryToolbox::Norm(int(MAXNDIM), TauTangent);
+        /*--- Compressible formulation ---*/
 
-      /*--- Calculate the quantities from boundary layer theory and
-       *    iteratively solve for a new wall shear stress. Use the current wall
-       *    shear stress as a starting guess for the wall function. ---*/
+        const su2double T_Wall = nodes->GetTemperature(iPoint);
+        const su2double P_Wall = P_Normal;
+        const su2double Density_Wall = P_Wall / (Gas_Constant * T_Wall);
 
-      unsigned long counter = 0;
-      su2double diff = 1.0;
-      su2double U_Tau = max(1.0e-6,sqrt(WallShearStress/Density_Wall));
-      /*--- Use minimum y+ as defined in the config, in case the routine below for computing y+ does not converge ---*/
-      su2double Y_Plus = 0.99*config->GetwallModel_MinYPlus(); // use clipping value as minimum
+        /*--- Compute the shear stress at the wall in the regular fashion
+         *    by using the stress tensor on the surface ---*/
+
+        su2double tau[MAXNDIM][MAXNDIM] = {{0.0}};
+        const su2double Lam_Visc_Wall = nodes->GetLaminarViscosity(iPoint);
 
-      const su2double Y_Plus_Start = Density_Wall * U_Tau * WallDistMod / Lam_Visc_Wall;
+        CNumerics::ComputeStressTensor(nDim, tau, nodes->GetVelocityGradient(iPoint), Lam_Visc_Wall);
 
-      /*--- Automatic switch off when y+ < "limit" according to Nichols & Nelson (2004) ---*/
+        su2double TauTangent[MAXNDIM] = {0.0};
+        GeometryToolbox::TangentProjection(nDim, tau, UnitNormal, TauTangent);
 
-      if (Y_Plus_Start < config->GetwallModel_MinYPlus()) {
-        smallYPlusCounter++;
-        continue;
+        const su2double WallShearStress = GeometryToolbox::Norm(int(MAXNDIM), TauTangent);
+
+        /*--- Use the current wall shear stress as a starting guess for the
+         *    wall function, the switch-off criterion is based on it. ---*/
+
+        const su2double U_Tau_0 = max(1.0e-6,sqrt(WallShearStress/Density_Wall));
+
+        const su2double Y_Plus_Start = Density_Wall * U_Tau_0 * WallDistMod / Lam_Visc_Wall;
+
+        /*--- Automatic switch off when y+ < "limit" according to Nichols & Nelson (2004) ---*/
+
+        if (Y_Plus_Start < config->GetwallModel_MinYPlus()) {
+          smallYPlusCounter++;
+          continue;
+        }
+
+        /*--- Fill the next lane of the tile, warm-started with the friction
+         *    velocity this vertex converged to on the previous evaluation. ---*/
+
+        const auto lane = nLane++;
+        pointLane[lane]    = iPoint;
+        vertexLane[lane]   = iVertex;
+        velTangLane[lane]  = VelTangMod;
+        wallDistLane[lane] = WallDistMod;
+        lamViscWLane[lane] = Lam_Visc_Wall;
+        lamViscNLane[lane] = nodes->GetLaminarViscosity(Point_Normal);
+        conductLane[lane]  = nodes->GetThermalConductivity(iPoint);
+        tNormalLane[lane]  = T_Normal;
+        pWallLane[lane]    = P_Wall;
+        tWallLane[lane]    = T_Wall;
+        densWLane[lane]    = Density_Wall;
+        uTauLane[lane]     = (UTau[iMarker][iVertex] > 0.0)? UTau[iMarker][iVertex] : U_Tau_0;
+        eddyViscLane[lane] = nodes->GetEddyViscosity(iPoint);
+        /*--- Use minimum y+ as defined in the config, in case the routine below for computing y+ does not converge ---*/
+        yPlusLane[lane]    = 0.99*config->GetwallModel_MinYPlus(); // use clipping value as minimum
+        activeLane[lane]   = true;
+        nActive++;
       }
 
-      /*--- Convergence criterium for the Newton solver, note that 1e-10 is too large ---*/
-      const su2double tol = 1e-12;
-      while (fabs(diff) > tol) {
+      /*--- Newton phase, advance all unconverged lanes together. ---*/
 
-        /*--- Friction velocity and u+ ---*/
+      unsigned long counter = 0;
 
-        const su2double U_Plus = VelTangMod/U_Tau;
+      while (nActive > 0) {
 
-        /*--- Gamma, Beta, Q, and Phi, defined by Nichols & Nelson (2004) page 1110 ---*/
+        SU2_OMP_SIMD_IF_NOT_AD
+        for (auto lane = 0ul; lane < nLane; lane++) {
 
-        const su2double Gam  = Recovery*U_Tau*U_Tau/(2.0*Cp*T_Wall);
-        const su2double Beta = q_w*Lam_Visc_Wall/(Density_Wall*T_Wall*Conductivity_Wall*U_Tau);
-        const su2double Q    = sqrt(Beta*Beta + 4.0*Gam);
-        const su2double Phi  = asin(-1.0*Beta/Q);
+          if (!activeLane[lane]) continue;
 
-        /*--- Crocco-Busemann equation for wall temperature (eq. 11 of Nichols and Nelson) ---*/
-        /*--- update T_Wall due to aerodynamic heating, unless the wall is isothermal      ---*/
+          /*--- Friction velocity and u+ ---*/
 
-        if (config->GetMarker_All_KindBC(iMarker) != ISOTHERMAL) {
-          const su2double denum = (1.0 + Beta*U_Plus - Gam*U_Plus*U_Plus);
-          if (denum > EPS){
-            T_Wall = T_Normal / denum;
-            nodes->SetTemperature(iPoint,T_Wall);
-          }
-          else {
-            cout << "Warning: T_Wall < 0 " << endl;
+          const su2double U_Plus = velTangLane[lane]/uTauLane[lane];
+
+          /*--- Gamma, Beta, Q, and Phi, defined by Nichols & Nelson (2004) page 1110 ---*/
+
+          const su2double Gam  = Recovery*uTauLane[lane]*uTauLane[lane]/(2.0*Cp*tWallLane[lane]);
+          const su2double Beta = q_w*lamViscWLane[lane]/(densWLane[lane]*tWallLane[lane]*conductLane[lane]*uTauLane[lane]);
+          const su2double Q    = sqrt(Beta*Beta + 4.0*Gam);
+          const su2double Phi  = asin(-1.0*Beta/Q);
+
+          /*--- Crocco-Busemann equation for wall temperature (eq. 11 of Nichols and Nelson) ---*/
+          /*--- update T_Wall due to aerodynamic heating, unless the wall is isothermal      ---*/
+
+          if (!isothermal) {
+            const su2double denum = (1.0 + Beta*U_Plus - Gam*U_Plus*U_Plus);
+            if (denum > EPS) tWallLane[lane] = tNormalLane[lane] / denum;
           }
-        }
 
-        /*--- update of wall density using the wall temperature ---*/
-        Density_Wall = P_Wall/(Gas_Constant*T_Wall);
+          /*--- update of wall density using the wall temperature ---*/
+          densWLane[lane] = pWallLane[lane]/(Gas_Constant*tWallLane[lane]);
 
-        /*--- Y+ defined by White & Christoph (compressibility and heat transfer) negative value for (2.0*Gam*U_Plus - Beta)/Q ---*/
+          /*--- Y+ defined by White & Christoph (compressibility and heat transfer) negative value for (2.0*Gam*U_Plus - Beta)/Q ---*/
 
-        const su2double Y_Plus_White = exp((kappa/sqrt(Gam))*(asin((2.0*Gam*U_Plus - Beta)/Q) - Phi))*exp(-1.0*kappa*B);
+          const su2double Y_Plus_White = exp((kappa/sqrt(Gam))*(asin((2.0*Gam*U_Plus - Beta)/Q) - Phi))*exp(-1.0*kappa*B);
 
-        /*--- Spalding's universal form for the BL velocity with the
-         *    outer velocity form of White & Christoph above. ---*/
-        const su2double kUp = kappa*U_Plus;
-        Y_Plus = U_Plus + Y_Plus_White - (exp(-1.0*kappa*B)* (1.0 + kUp + 0.5*kUp*kUp + kUp*kUp*kUp/6.0));
+          /*--- Spalding's universal form for the BL velocity with the
+           *    outer velocity form of White & Christoph above. ---*/
+          const su2double kUp = kappa*U_Plus;
+          yPlusLane[lane] = U_Plus + Y_Plus_White - (exp(-1.0*kappa*B)* (1.0 + kUp + 0.5*kUp*kUp + kUp*kUp*kUp/6.0));
 
-        const su2double dypw_dyp = 2.0*Y_Plus_White*(kappa*sqrt(Gam)/Q)*sqrt(1.0 - pow(2.0*Gam*U_Plus - Beta,2.0)/(Q*Q));
+          const su2double dypw_dyp = 2.0*Y_Plus_White*(kappa*sqrt(Gam)/Q)*sqrt(1.0 - pow(2.0*Gam*U_Plus - Beta,2.0)/(Q*Q));
 
-        Eddy_Visc_Wall = Lam_Visc_Wall*(1.0 + dypw_dyp - kappa*exp(-1.0*kappa*B)*
-                                         (1.0 + kappa*U_Plus + kappa*kappa*U_Plus*U_Plus/2.0)
-                                         - Lam_Visc_Normal/Lam_Visc_Wall);
-        Eddy_Visc_Wall = max(1.0e-6, Eddy_Visc_Wall);
+          eddyViscLane[lane] = lamViscWLane[lane]*(1.0 + dypw_dyp - kappa*exp(-1.0*kappa*B)*
+                                                   (1.0 + kappa*U_Plus + kappa*kappa*U_Plus*U_Plus/2.0)
+                                                   - lamViscNLane[lane]/lamViscWLane[lane]);
+          eddyViscLane[lane] = max(1.0e-6, eddyViscLane[lane]);
 
-        /* --- Define function for Newton method to zero --- */
+          /* --- Define function for Newton method to zero --- */
 
-        diff = (Density_Wall * U_Tau * WallDistMod / Lam_Visc_Wall) - Y_Plus;
+          diffLane[lane] = (densWLane[lane] * uTauLane[lane] * wallDistLane[lane] / lamViscWLane[lane]) - yPlusLane[lane];
 
-        /* --- Gradient of function defined above --- */
+          /* --- Gradient of function defined above --- */
 
-        const su2double grad_diff = Density_Wall * WallDistMod / Lam_Visc_Wall + VelTangMod / (U_Tau * U_Tau) +
-                  kappa /(U_Tau * sqrt(Gam)) * asin(U_Plus * sqrt(Gam)) * Y_Plus_White -
-                  exp(-1.0 * B * kappa) * (0.5 * pow(VelTangMod * kappa / U_Tau, 3) +
-                  pow(VelTangMod * kappa / U_Tau, 2) + VelTangMod * kappa / U_Tau) / U_Tau;
+          const su2double grad_diff = densWLane[lane] * wallDistLane[lane] / lamViscWLane[lane] +
+                    velTangLane[lane] / (uTauLane[lane] * uTauLane[lane]) +
+                    kappa /(uTauLane[lane] * sqrt(Gam)) * asin(U_Plus * sqrt(Gam)) * Y_Plus_White -
+                    exp(-1.0 * B * kappa) * (0.5 * pow(velTangLane[lane] * kappa / uTauLane[lane], 3) +
+                    pow(velTangLane[lane] * kappa / uTauLane[lane], 2) + velTangLane[lane] * kappa / uTauLane[lane]) / uTauLane[lane];
 
-        /* --- Newton Step --- */
+          /* --- Newton Step --- */
+
+          uTauLane[lane] -= relax*(diffLane[lane] / grad_diff);
+        }
 
-        U_Tau = U_Tau - relax*(diff / grad_diff);
+        /*--- Convergence masking, kept out of the lane loop above. ---*/
 
         counter++;
-        if (counter > max_iter) {
-          notConvergedCounter++;
-          // use some safe values for convergence
-          Y_Plus = 30.0;
-          Eddy_Visc_Wall = 1.0;
-          U_Tau = 1.0;
-          break;
+        for (auto lane = 0ul; lane < nLane; lane++) {
+          if (!activeLane[lane]) continue;
+          if (fabs(diffLane[lane]) <= tol) {
+            activeLane[lane] = false;
+            nActive--;
+          }
+          else if (counter > max_iter) {
+            notConvergedCounter++;
+            // use some safe values for convergence
+            yPlusLane[lane] = 30.0;
+            eddyViscLane[lane] = 1.0;
+            uTauLane[lane] = 1.0;
+            activeLane[lane] = false;
+            nActive--;
+          }
         }
       }
 
-      /*--- Calculate an updated value for the wall shear stress
-       *    using the y+ value, the definition of y+, and the definition of
-       *    the friction velocity. ---*/
+      /*--- Scatter phase, calculate an updated value for the wall shear
+       *    stress using the y+ value, the definition of y+, and the
+       *    definition of the friction velocity. ---*/
+
+      for (auto lane = 0ul; lane < nLane; lane++) {
 
-      YPlus[iMarker][iVertex] = Y_Plus;
-      EddyViscWall[iMarker][iVertex] = Eddy_Visc_Wall;
-      UTau[iMarker][iVertex] = U_Tau;
+        const auto iPoint = pointLane[lane];
+        const auto iVertex = vertexLane[lane];
 
-      const su2double Tau_Wall = (1.0/Density_Wall)*pow(Y_Plus*Lam_Visc_Wall/WallDistMod,2.0);
+        if (!isothermal) nodes->SetTemperature(iPoint, tWallLane[lane]);
 
-      /*--- Store this value for the wall shear stress at the node.  ---*/
+        YPlus[iMarker][iVertex] = yPlusLane[lane];
+        EddyViscWall[iMarker][iVertex] = eddyViscLane[lane];
+        UTau[iMarker][iVertex] = uTauLane[lane];
 
-      nodes->SetTau_Wall(iPoint, Tau_Wall);
+        const su2double Tau_Wall = (1.0/densWLane[lane])*pow(yPlusLane[lane]*lamViscWLane[lane]/wallDistLane[lane],2.0);
+
+        /*--- Store this value for the wall shear stress at the node.  ---*/
+
+        nodes->SetTau_Wall(iPoint, Tau_Wall);
+      }
 
     }
     END_SU2_OMP_FOR
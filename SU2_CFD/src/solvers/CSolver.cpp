@@ -27,6 +27,14 @@
 
 
 #include "../../include/solvers/CSolver.hpp"
+
+#if !defined(_WIN32)
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
 #include "../../include/gradients/computeGradientsGreenGauss.hpp"
 #include "../../include/gradients/computeGradientsLeastSquares.hpp"
 #include "../../include/limiters/computeLimiters.hpp"
@@ -47,6 +55,7 @@
 #include "../../../Common/include/toolboxes/geometry_toolbox.hpp"
 #include "../../../Common/include/toolboxes/CLinearPartitioner.hpp"
 #include "../../../Common/include/adt/CADTPointsOnlyClass.hpp"
+#include "../../../Common/include/fem/fem_geometry_structure.hpp"
 #include "../../include/CMarkerProfileReaderFVM.hpp"
 
 
@@ -88,6 +97,10 @@ CSolver::CSolver(LINEAR_SOLVER_MODE linear_solver_mode) : System(linear_solver_m
   Jacobian_jj        = nullptr;
   Restart_Vars       = nullptr;
   Restart_Data       = nullptr;
+  Restart_Data_Map   = nullptr;
+  Restart_Data_MapSize = 0;
+  Restart_Data_n     = nullptr;
+  Restart_TimeN_Loaded = false;
   base_nodes         = nullptr;
   nOutputVariables   = 0;
   ResLinSolver       = 0.0;
@@ -96,6 +109,17 @@ CSolver::CSolver(LINEAR_SOLVER_MODE linear_solver_mode) : System(linear_solver_m
 
   IterLinSolver = 0;
 
+  /*--- Jacobian lagging bookkeeping. ---*/
+
+  JacRefreshCounter = 0;
+  LinIterAtJacRefresh = 0;
+  JacRefreshNow = true;
+  GradRefreshCounter = 0;
+  ResAtGradRefresh = 0.0;
+  GradRefreshNow = true;
+
+  fusedGradientDone = false;
+
   /*--- Initialize pointer for any verification solution. ---*/
   VerificationSolution  = nullptr;
 
@@ -184,7 +208,7 @@ CSolver::~CSolver(void) {
   }
 
   delete [] Restart_Vars;
-  delete [] Restart_Data;
+  FreeRestartData();
 
   delete VerificationSolution;
 }
@@ -372,11 +396,11 @@ void CSolver::InitiatePeriodicComms(CGeometry *geometry,
   su2double Sensor_i = 0.0, Sensor_j = 0.0, Pressure_i, Pressure_j;
   const su2double *Coord_i, *Coord_j;
   su2double r11, r12, r13, r22, r23_a, r23_b, r33, weight;
-  const su2double *center, *angles, *trans;
+  const su2double *center, *translation;
   su2double rotMatrix2D[2][2] = {{1.0,0.0},{0.0,1.0}};
   su2double rotMatrix3D[3][3] = {{1.0,0.0,0.0},{0.0,1.0,0.0},{0.0,0.0,1.0}};
   su2double rotCoord_i[3] = {0.0}, rotCoord_j[3] = {0.0};
-  su2double translation[3] = {0.0}, distance[3] = {0.0};
+  su2double distance[3] = {0.0};
   const su2double zeros[3] = {0.0};
   su2activematrix Cvector;
 
@@ -385,8 +409,6 @@ void CSolver::InitiatePeriodicComms(CGeometry *geometry,
     else GeometryToolbox::Rotate(rotMatrix3D, origin, direction, rotated);
   };
 
-  string Marker_Tag;
-
   /*--- Set the size of the data packet and type depending on quantity. ---*/
 
   GetPeriodicCommCountAndType(config, commType, COUNT_PER_POINT, MPI_TYPE, ICOUNT, JCOUNT);
@@ -445,32 +467,22 @@ void CSolver::InitiatePeriodicComms(CGeometry *geometry,
         iPoint    = geometry->Local_Point_PeriodicSend[msg_offset  + iSend];
         iPeriodic = geometry->Local_Marker_PeriodicSend[msg_offset + iSend];
 
-        /*--- Retrieve the supplied periodic information. ---*/
+        /*--- Retrieve the rotation matrix, rotation center, and (center+trans)
+         vector precomputed for this marker during the comm preprocessing. ---*/
 
-        Marker_Tag = config->GetMarker_All_TagBound(iPeriodic);
-        center     = config->GetPeriodicRotCenter(Marker_Tag);
-        angles     = config->GetPeriodicRotAngles(Marker_Tag);
-        trans      = config->GetPeriodicTranslation(Marker_Tag);
+        const su2double* rotation = geometry->PeriodicRotation[iPeriodic];
 
-        /*--- Store (center+trans) as it is constant and will be added. ---*/
-
-        translation[0] = center[0] + trans[0];
-        translation[1] = center[1] + trans[1];
-        translation[2] = center[2] + trans[2];
-
-        /*--- Store angles separately for clarity. Compute sines/cosines. ---*/
-
-        su2double Theta = angles[0];
-        su2double Phi = angles[1];
-        su2double Psi = angles[2];
-
-        /*--- Compute the rotation matrix. Note that the implicit
-         ordering is rotation about the x-axis, y-axis, then z-axis. ---*/
+        center      = geometry->PeriodicRotCenter[iPeriodic];
+        translation = geometry->PeriodicCenterTranslation[iPeriodic];
 
         if (nDim==2) {
-          GeometryToolbox::RotationMatrix(Psi, rotMatrix2D);
+          for (iVar = 0; iVar < 2; iVar++)
+            for (jVar = 0; jVar < 2; jVar++)
+              rotMatrix2D[iVar][jVar] = rotation[iVar*2+jVar];
         } else {
-          GeometryToolbox::RotationMatrix(Theta, Phi, Psi, rotMatrix3D);
+          for (iVar = 0; iVar < 3; iVar++)
+            for (jVar = 0; jVar < 3; jVar++)
+              rotMatrix3D[iVar][jVar] = rotation[iVar*3+jVar];
         }
 
         /*--- Compute the offset in the recv buffer for this point. ---*/
@@ -1363,6 +1375,10 @@ void CSolver::GetCommCountAndType(const CConfig* config,
       COUNT_PER_POINT  = nPrimVarGrad;
       MPI_TYPE         = COMM_TYPE_DOUBLE;
       break;
+    case LAPLACIAN_SENSOR:
+      COUNT_PER_POINT  = nVar+1;
+      MPI_TYPE         = COMM_TYPE_DOUBLE;
+      break;
     case SOLUTION_EDDY:
       COUNT_PER_POINT  = nVar+1;
       MPI_TYPE         = COMM_TYPE_DOUBLE;
@@ -1417,6 +1433,7 @@ namespace CommHelpers {
 void CSolver::InitiateComms(CGeometry *geometry,
                             const CConfig *config,
                             unsigned short commType) {
+  SU2_PROFILE_PHASE(HALO_COMM);
 
   /*--- Local variables ---*/
 
@@ -1498,6 +1515,11 @@ void CSolver::InitiateComms(CGeometry *geometry,
             for (iVar = 0; iVar < nVar; iVar++)
               bufDSend[buf_offset+iVar] = base_nodes->GetUndivided_Laplacian(iPoint, iVar);
             break;
+          case LAPLACIAN_SENSOR:
+            for (iVar = 0; iVar < nVar; iVar++)
+              bufDSend[buf_offset+iVar] = base_nodes->GetUndivided_Laplacian(iPoint, iVar);
+            bufDSend[buf_offset+nVar]   = base_nodes->GetSensor(iPoint);
+            break;
           case SOLUTION_LIMITER:
           case PRIMITIVE_LIMITER:
             for (iVar = 0; iVar < COUNT_PER_POINT; iVar++)
@@ -1559,6 +1581,7 @@ void CSolver::InitiateComms(CGeometry *geometry,
 void CSolver::CompleteComms(CGeometry *geometry,
                             const CConfig *config,
                             unsigned short commType) {
+  SU2_PROFILE_PHASE(HALO_COMM);
 
   /*--- Local variables ---*/
 
@@ -1649,6 +1672,11 @@ void CSolver::CompleteComms(CGeometry *geometry,
             for (iVar = 0; iVar < nVar; iVar++)
               base_nodes->SetUnd_Lapl(iPoint, iVar, bufDRecv[buf_offset+iVar]);
             break;
+          case LAPLACIAN_SENSOR:
+            for (iVar = 0; iVar < nVar; iVar++)
+              base_nodes->SetUnd_Lapl(iPoint, iVar, bufDRecv[buf_offset+iVar]);
+            base_nodes->SetSensor(iPoint,bufDRecv[buf_offset+nVar]);
+            break;
           case SOLUTION_LIMITER:
           case PRIMITIVE_LIMITER:
             for (iVar = 0; iVar < COUNT_PER_POINT; iVar++)
@@ -1720,6 +1748,35 @@ void CSolver::ResetCFLAdapt() {
   NonLinRes_Counter = 0;
 }
 
+void CSolver::SnapshotSolution() {
+
+  if ((base_nodes == nullptr) || (nPoint == 0)) return;
+
+  /*--- Halo points are included so that no communication is needed on rollback. ---*/
+
+  if (SolutionSnapshot.rows() != nPoint) SolutionSnapshot.resize(nPoint, nVar);
+
+  for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++)
+    for (unsigned short iVar = 0; iVar < nVar; iVar++)
+      SolutionSnapshot(iPoint, iVar) = base_nodes->GetSolution(iPoint, iVar);
+}
+
+bool CSolver::RollbackSolution(su2double cflFactor, su2double cflMin) {
+
+  if ((base_nodes == nullptr) || (nPoint == 0) || (SolutionSnapshot.rows() != nPoint)) return false;
+
+  for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++) {
+    for (unsigned short iVar = 0; iVar < nVar; iVar++)
+      base_nodes->SetSolution(iPoint, iVar, SolutionSnapshot(iPoint, iVar));
+
+    const su2double CFL = max(cflMin, base_nodes->GetLocalCFL(iPoint) * cflFactor);
+    base_nodes->SetLocalCFL(iPoint, CFL);
+  }
+  SolutionDiverged = false;
+
+  return true;
+}
+
 
 void CSolver::AdaptCFLNumber(CGeometry **geometry,
                              CSolver   ***solver_container,
@@ -1735,11 +1792,14 @@ void CSolver::AdaptCFLNumber(CGeometry **geometry,
   const su2double CFLMax            = config->GetCFL_AdaptParam(3);
   const su2double acceptableLinTol  = config->GetCFL_AdaptParam(4);
   const bool fullComms              = (config->GetComm_Level() == COMM_FULL);
+  const bool ptcSER                 = config->GetPTC_SER();
 
   /* Number of iterations considered to check for stagnation. */
   const auto Res_Count = min(100ul, config->GetnInner_Iter()-1);
 
   static bool reduceCFL, resetCFL, canIncrease;
+  static bool newtonPhase = false;
+  static su2double serFactor = 1.0, ptcRefFunc = 0.0;
 
   for (unsigned short iMesh = 0; iMesh <= config->GetnMGLevels(); iMesh++) {
 
@@ -1831,6 +1891,46 @@ void CSolver::AdaptCFLNumber(CGeometry **geometry,
           for (auto& val : NonLinRes_Series) val = 0.0;
         }
       }
+
+      /* Pseudo-transient continuation controller (switched evolution
+       relaxation). The CFL grows with the ratio of consecutive nonlinear
+       residuals, and once the residual has dropped enough we switch to
+       Newton iterations: CFL at the maximum and an inexact-Newton forcing
+       schedule that tightens the linear tolerance with the residual so
+       that the linear solves do not limit the Newton convergence. */
+
+      if (ptcSER) {
+
+        unsigned short nEq = solverFlow->GetnVar();
+        if (solverTurb) nEq += solverTurb->GetnVar();
+        const su2double resNew = New_Func / nEq;
+        const su2double resOld = Old_Func / nEq;
+
+        if (config->GetInnerIter() <= 1) {
+          ptcRefFunc = resNew;
+          serFactor = 1.0;
+          newtonPhase = false;
+        }
+        else {
+          /* SER growth factor from the residual ratio, bounded to keep
+           the ramp stable through transients. */
+          serFactor = pow(su2double(10.0), config->GetPTC_SER_Exponent()*(resOld-resNew));
+          serFactor = max(su2double(0.1), min(su2double(10.0), serFactor));
+
+          /* Switch to the Newton phase once the mean residual has dropped
+           the requested number of orders, with one order of hysteresis to
+           avoid flip-flopping around the threshold. */
+          const su2double switchFunc = ptcRefFunc - config->GetPTC_Newton_Residual_Drop();
+          if (resNew < switchFunc) newtonPhase = true;
+          else if (resNew > switchFunc + 1.0) newtonPhase = false;
+
+          passivedouble forcing = 1.0;
+          if (newtonPhase)
+            forcing = SU2_TYPE::GetValue(pow(su2double(10.0), resNew - switchFunc));
+          solverFlow->System.SetToleranceForcing(forcing);
+          if (solverTurb) solverTurb->System.SetToleranceForcing(forcing);
+        }
+      }
     }
     } /* End SU2_OMP_MASTER, now all threads update the CFL number. */
     END_SU2_OMP_MASTER
@@ -1872,7 +1972,18 @@ void CSolver::AdaptCFLNumber(CGeometry **geometry,
        then we schedule an increase the CFL number for the next iteration. */
 
       su2double CFLFactor = 1.0;
-      if (underRelaxation < 0.1 || reduceCFL) {
+      if (ptcSER) {
+        /* Pseudo-transient continuation: uniform SER factor with the usual
+         safeguards, and a jump to the maximum CFL in the Newton phase. */
+        if (underRelaxation < 0.1 || reduceCFL) {
+          CFLFactor = CFLFactorDecrease;
+        } else if (newtonPhase) {
+          CFL       = CFLMax;
+          CFLFactor = MGFactor[iMesh];
+        } else {
+          CFLFactor = serFactor;
+        }
+      } else if (underRelaxation < 0.1 || reduceCFL) {
         CFLFactor = CFLFactorDecrease;
       } else if ((underRelaxation >= 0.1 && underRelaxation < 1.0) || !canIncrease) {
         CFLFactor = 1.0;
@@ -1945,21 +2056,179 @@ void CSolver::AdaptCFLNumber(CGeometry **geometry,
 
 }
 
+namespace {
+/*!
+ * \brief Fuses the residual monitoring collectives (the reduction of the RMS
+ * residuals and the gathers of the max-residual information) into a single
+ * Allgather, to cut the number of latency-bound collectives per iteration.
+ * The RMS sums are applied locally over the gathered partial sums, and the
+ * point indices travel as doubles, which is exact for any realistic index.
+ */
+struct CResidualReduction {
+  const unsigned long nProcessor;
+  const unsigned short nVar, nDim;
+  su2activematrix buffer;
+
+  CResidualReduction(unsigned long nProc, unsigned short nVar_, unsigned short nDim_,
+                     const su2double* rmsRes, const su2double* maxRes,
+                     const unsigned long* maxPoint, const su2double* maxCoord) :
+    nProcessor(nProc), nVar(nVar_), nDim(nDim_) {
+
+    const unsigned long stride = nVar*(3ul+nDim);
+    su2activevector sendbuf(stride);
+
+    for (unsigned short iVar = 0; iVar < nVar; iVar++) {
+      sendbuf(iVar) = rmsRes[iVar];
+      sendbuf(nVar+iVar) = maxRes[iVar];
+      sendbuf(2ul*nVar+iVar) = su2double(maxPoint[iVar]);
+      for (unsigned short iDim = 0; iDim < nDim; iDim++)
+        sendbuf(3ul*nVar+iVar*nDim+iDim) = maxCoord[iVar*nDim+iDim];
+    }
+
+    buffer.resize(nProcessor, stride);
+
+    SU2_MPI::Allgather(sendbuf.data(), stride, MPI_DOUBLE, buffer.data(), stride,
+                       MPI_DOUBLE, SU2_MPI::GetComm());
+  }
+
+  /*--- Global sum of the partial RMS sums of one variable. ---*/
+  su2double SumRMS(unsigned short iVar) const {
+    su2double sum = 0.0;
+    for (auto iProcessor = 0ul; iProcessor < nProcessor; iProcessor++)
+      sum += buffer(iProcessor, iVar);
+    return sum;
+  }
+
+  su2double MaxRes(unsigned long iProcessor, unsigned short iVar) const {
+    return buffer(iProcessor, nVar+iVar);
+  }
+
+  unsigned long MaxPoint(unsigned long iProcessor, unsigned short iVar) const {
+    return static_cast<unsigned long>(SU2_TYPE::GetValue(buffer(iProcessor, 2ul*nVar+iVar)));
+  }
+
+  const su2double* MaxCoord(unsigned long iProcessor, unsigned short iVar) const {
+    return &buffer(iProcessor, 3ul*nVar+iVar*nDim);
+  }
+};
+} // namespace
+
+bool CSolver::JacobianRefreshDue(unsigned short lagIter, su2double growthTol, su2double solChangeTol) {
+
+  /*--- Lagging disabled, rebuild every nonlinear iteration. ---*/
+  if (lagIter < 2) return true;
+
+  /*--- The bookkeeping is shared by the threads, decide once. ---*/
+  SU2_OMP_BARRIER
+  SU2_OMP_MASTER {
+
+    /*--- On the first iteration after a rebuild, record the linear solver
+     iteration count as the staleness baseline of the current Jacobian. ---*/
+    if (JacRefreshCounter == 1) LinIterAtJacRefresh = IterLinSolver;
+
+    /*--- Optional trigger on the local solution change: the lagged Jacobian is
+     a good approximation only while the state it was linearized about still
+     resembles the current one, so compare every point against the snapshot
+     taken at the last rebuild. ---*/
+    bool solChanged = false;
+
+    if ((solChangeTol > 0.0) && (JacRefreshCounter > 0) && (SolAtJacRefresh.size() > 0)) {
+      const su2double eps = numeric_limits<passivedouble>::epsilon();
+      for (unsigned long iPoint = 0; iPoint < nPointDomain && !solChanged; iPoint++) {
+        for (unsigned short iVar = 0; iVar < nVar; iVar++) {
+          const su2double ref = SolAtJacRefresh(iPoint, iVar);
+          const su2double delta = fabs(base_nodes->GetSolution(iPoint, iVar) - ref);
+          solChanged = (delta > solChangeTol * (fabs(ref) + eps)) || solChanged;
+        }
+      }
+    }
+
+    /*--- Rebuild if nothing was ever assembled, the lag interval is over, the
+     linear solver degraded too much w.r.t. the baseline, or the solution moved
+     too far from the linearization state. ---*/
+    JacRefreshNow = (JacRefreshCounter == 0) || (JacRefreshCounter >= lagIter) ||
+                    ((LinIterAtJacRefresh > 0) &&
+                     (IterLinSolver > growthTol*LinIterAtJacRefresh)) ||
+                    solChanged;
+
+    if (JacRefreshNow) JacRefreshCounter = 1;
+    else JacRefreshCounter++;
+
+    /*--- Snapshot the state the new Jacobian will be linearized about. ---*/
+    if (JacRefreshNow && (solChangeTol > 0.0)) {
+      if (SolAtJacRefresh.size() == 0) SolAtJacRefresh.resize(nPointDomain, nVar);
+      for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++)
+        for (unsigned short iVar = 0; iVar < nVar; iVar++)
+          SolAtJacRefresh(iPoint, iVar) = base_nodes->GetSolution(iPoint, iVar);
+    }
+
+    /*--- While frozen the matrix ignores all assembly-type modifications and
+     keeps its preconditioner factorization. ---*/
+    Jacobian.SetFrozen(!JacRefreshNow);
+  }
+  END_SU2_OMP_MASTER
+  SU2_OMP_BARRIER
+
+  return JacRefreshNow;
+}
+
+bool CSolver::GradientRefreshDue(unsigned short lagIter, su2double growthTol) {
+
+  /*--- Lagging disabled, recompute every inner iteration. ---*/
+  if (lagIter < 2) return true;
+
+  /*--- The bookkeeping is shared by the threads, decide once. ---*/
+  SU2_OMP_BARRIER
+  SU2_OMP_MASTER {
+
+    /*--- The RMS residual of the previous iteration serves as the staleness
+     monitor, a growing residual means the solution started to change
+     significantly again and the lagged gradients no longer represent it. ---*/
+    const su2double resNow = GetRes_RMS(0);
+
+    GradRefreshNow = (GradRefreshCounter == 0) || (GradRefreshCounter >= lagIter) ||
+                     ((ResAtGradRefresh > 0.0) && (resNow > growthTol*ResAtGradRefresh));
+
+    if (GradRefreshNow) {
+      GradRefreshCounter = 1;
+      ResAtGradRefresh = resNow;
+    }
+    else GradRefreshCounter++;
+  }
+  END_SU2_OMP_MASTER
+  SU2_OMP_BARRIER
+
+  return GradRefreshNow;
+}
+
 void CSolver::SetResidual_RMS(const CGeometry *geometry, const CConfig *config) {
 
   if (geometry->GetMGLevel() != MESH_0) return;
 
   SU2_OMP_MASTER {
 
-  /*--- Set the L2 Norm residual in all the processors. ---*/
+  /*--- Set the L2 Norm and Maximum residuals in all the processors, with a
+   single collective for both to reduce the latency cost at scale. ---*/
 
   vector<su2double> rbuf_res(nVar);
   unsigned long Global_nPointDomain = 0;
 
-  if (config->GetComm_Level() == COMM_FULL) {
+  const bool fullComms = (config->GetComm_Level() == COMM_FULL);
+
+  if (fullComms) {
 
-    SU2_MPI::Allreduce(Residual_RMS.data(), rbuf_res.data(), nVar, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
+    CResidualReduction reduction(size, nVar, nDim, Residual_RMS.data(), Residual_Max.data(),
+                                 Point_Max.data(), Point_Max_Coord.data());
+
+    for (unsigned short iVar = 0; iVar < nVar; iVar++) rbuf_res[iVar] = reduction.SumRMS(iVar);
     Global_nPointDomain = geometry->GetGlobal_nPointDomain();
+
+    for (unsigned short iVar = 0; iVar < nVar; iVar++) {
+      for (auto iProcessor = 0ul; iProcessor < reduction.nProcessor; iProcessor++) {
+        AddRes_Max(iVar, reduction.MaxRes(iProcessor,iVar), reduction.MaxPoint(iProcessor,iVar),
+                   reduction.MaxCoord(iProcessor,iVar));
+      }
+    }
   }
   else {
     /*--- Reduced MPI comms have been requested. Use a local residual only. ---*/
@@ -1968,37 +2237,25 @@ void CSolver::SetResidual_RMS(const CGeometry *geometry, const CConfig *config)
     Global_nPointDomain = geometry->GetnPointDomain();
   }
 
+  /*--- With rollback enabled a divergence is not fatal, flag it so the iteration
+   can be retried from the solution snapshot at a reduced CFL number. ---*/
+
+  const bool recoverable = config->GetCFL_AdaptRollback();
+  SolutionDiverged = false;
+
   for (unsigned short iVar = 0; iVar < nVar; iVar++) {
 
     if (std::isnan(SU2_TYPE::GetValue(rbuf_res[iVar]))) {
-      SU2_MPI::Error("SU2 has diverged (NaN detected).", CURRENT_FUNCTION);
+      if (!recoverable) SU2_MPI::Error("SU2 has diverged (NaN detected).", CURRENT_FUNCTION);
+      SolutionDiverged = true;
+      rbuf_res[iVar] = 1.0;
     }
 
     Residual_RMS[iVar] = max(EPS*EPS, sqrt(rbuf_res[iVar]/Global_nPointDomain));
 
     if (log10(GetRes_RMS(iVar)) > 20.0) {
-      SU2_MPI::Error("SU2 has diverged (Residual > 10^20 detected).", CURRENT_FUNCTION);
-    }
-  }
-
-  /*--- Set the Maximum residual in all the processors. ---*/
-
-  if (config->GetComm_Level() == COMM_FULL) {
-
-    const unsigned long nProcessor = size;
-
-    su2activematrix rbuf_residual(nProcessor,nVar);
-    su2matrix<unsigned long> rbuf_point(nProcessor,nVar);
-    su2activematrix rbuf_coord(nProcessor*nVar, nDim);
-
-    SU2_MPI::Allgather(Residual_Max.data(), nVar, MPI_DOUBLE, rbuf_residual.data(), nVar, MPI_DOUBLE, SU2_MPI::GetComm());
-    SU2_MPI::Allgather(Point_Max.data(), nVar, MPI_UNSIGNED_LONG, rbuf_point.data(), nVar, MPI_UNSIGNED_LONG, SU2_MPI::GetComm());
-    SU2_MPI::Allgather(Point_Max_Coord.data(), nVar*nDim, MPI_DOUBLE, rbuf_coord.data(), nVar*nDim, MPI_DOUBLE, SU2_MPI::GetComm());
-
-    for (unsigned short iVar = 0; iVar < nVar; iVar++) {
-      for (auto iProcessor = 0ul; iProcessor < nProcessor; iProcessor++) {
-        AddRes_Max(iVar, rbuf_residual(iProcessor,iVar), rbuf_point(iProcessor,iVar), rbuf_coord[iProcessor*nVar+iVar]);
-      }
+      if (!recoverable) SU2_MPI::Error("SU2 has diverged (Residual > 10^20 detected).", CURRENT_FUNCTION);
+      SolutionDiverged = true;
     }
   }
 
@@ -2016,34 +2273,31 @@ void CSolver::SetResidual_BGS(const CGeometry *geometry, const CConfig *config)
   /*--- Set the L2 Norm residual in all the processors. ---*/
 
   vector<su2double> rbuf_res(nVar);
-
-  SU2_MPI::Allreduce(Residual_BGS.data(), rbuf_res.data(), nVar, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
   const auto Global_nPointDomain = geometry->GetGlobal_nPointDomain();
 
-  for (unsigned short iVar = 0; iVar < nVar; iVar++) {
-    Residual_BGS[iVar] = max(EPS*EPS, sqrt(rbuf_res[iVar]/Global_nPointDomain));
-  }
-
   if (config->GetComm_Level() == COMM_FULL) {
 
-    /*--- Set the Maximum residual in all the processors. ---*/
-
-    const unsigned long nProcessor = size;
+    /*--- Set the L2 Norm and Maximum residuals with a single collective. ---*/
 
-    su2activematrix rbuf_residual(nProcessor,nVar);
-    su2matrix<unsigned long> rbuf_point(nProcessor,nVar);
-    su2activematrix rbuf_coord(nProcessor*nVar, nDim);
+    CResidualReduction reduction(size, nVar, nDim, Residual_BGS.data(), Residual_Max_BGS.data(),
+                                 Point_Max_BGS.data(), Point_Max_Coord_BGS.data());
 
-    SU2_MPI::Allgather(Residual_Max_BGS.data(), nVar, MPI_DOUBLE, rbuf_residual.data(), nVar, MPI_DOUBLE, SU2_MPI::GetComm());
-    SU2_MPI::Allgather(Point_Max_BGS.data(), nVar, MPI_UNSIGNED_LONG, rbuf_point.data(), nVar, MPI_UNSIGNED_LONG, SU2_MPI::GetComm());
-    SU2_MPI::Allgather(Point_Max_Coord_BGS.data(), nVar*nDim, MPI_DOUBLE, rbuf_coord.data(), nVar*nDim, MPI_DOUBLE, SU2_MPI::GetComm());
+    for (unsigned short iVar = 0; iVar < nVar; iVar++) rbuf_res[iVar] = reduction.SumRMS(iVar);
 
     for (unsigned short iVar = 0; iVar < nVar; iVar++) {
-      for (auto iProcessor = 0ul; iProcessor < nProcessor; iProcessor++) {
-        AddRes_Max_BGS(iVar, rbuf_residual(iProcessor,iVar), rbuf_point(iProcessor,iVar), rbuf_coord[iProcessor*nVar+iVar]);
+      for (auto iProcessor = 0ul; iProcessor < reduction.nProcessor; iProcessor++) {
+        AddRes_Max_BGS(iVar, reduction.MaxRes(iProcessor,iVar), reduction.MaxPoint(iProcessor,iVar),
+                       reduction.MaxCoord(iProcessor,iVar));
       }
     }
   }
+  else {
+    SU2_MPI::Allreduce(Residual_BGS.data(), rbuf_res.data(), nVar, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
+  }
+
+  for (unsigned short iVar = 0; iVar < nVar; iVar++) {
+    Residual_BGS[iVar] = max(EPS*EPS, sqrt(rbuf_res[iVar]/Global_nPointDomain));
+  }
 
   }
   END_SU2_OMP_MASTER
@@ -2174,6 +2428,10 @@ void CSolver::SetUndivided_Laplacian(CGeometry *geometry, const CConfig *config)
 
     const bool boundary_i = geometry->nodes->GetPhysicalBoundary(iPoint);
 
+    /*--- Cannot preaccumulate if hybrid parallel due to shared reading. ---*/
+    if (AD::Active && (omp_get_num_threads() == 1)) AD::StartPreacc();
+    AD::SetPreaccIn(base_nodes->GetSolution(iPoint), nVar);
+
     /*--- Initialize. ---*/
     for (unsigned short iVar = 0; iVar < nVar; iVar++)
       base_nodes->SetUnd_Lapl(iPoint, iVar, 0.0);
@@ -2186,6 +2444,8 @@ void CSolver::SetUndivided_Laplacian(CGeometry *geometry, const CConfig *config)
       /*--- If iPoint is boundary it only takes contributions from other boundary points. ---*/
       if (boundary_i && !boundary_j) continue;
 
+      AD::SetPreaccIn(base_nodes->GetSolution(jPoint), nVar);
+
       /*--- Add solution differences, with correction for compressible flows which use the enthalpy. ---*/
 
       for (unsigned short iVar = 0; iVar < nVar; iVar++) {
@@ -2193,6 +2453,9 @@ void CSolver::SetUndivided_Laplacian(CGeometry *geometry, const CConfig *config)
         base_nodes->AddUnd_Lapl(iPoint, iVar, delta);
       }
     }
+
+    AD::SetPreaccOut(base_nodes->GetUndivided_Laplacian(iPoint), nVar);
+    AD::EndPreacc();
   }
   END_SU2_OMP_FOR
 
@@ -2202,23 +2465,36 @@ void CSolver::SetUndivided_Laplacian(CGeometry *geometry, const CConfig *config)
     InitiatePeriodicComms(geometry, config, iPeriodic, PERIODIC_LAPLACIAN);
     CompletePeriodicComms(geometry, config, iPeriodic, PERIODIC_LAPLACIAN);
   }
-
-  /*--- MPI parallelization ---*/
-
-  InitiateComms(geometry, config, UNDIVIDED_LAPLACIAN);
-  CompleteComms(geometry, config, UNDIVIDED_LAPLACIAN);
-
 }
 
 void CSolver::Add_External_To_Solution() {
-  for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++) {
-    base_nodes->AddSolution(iPoint, base_nodes->Get_External(iPoint));
+  /*--- An external container that was never materialized reads as zero. ---*/
+  if (base_nodes->ExternalMaterialized()) {
+    for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++) {
+      base_nodes->AddSolution(iPoint, base_nodes->Get_External(iPoint));
+    }
   }
 
   base_nodes->Add_ExternalExtra_To_SolutionExtra();
 }
 
 void CSolver::Add_Solution_To_External() {
+  /*--- Materialize the external container only when there is a nonzero contribution,
+   *    e.g. solvers of zones that do not influence the objective function keep
+   *    reading as zero without paying for the storage. ---*/
+  if (!base_nodes->ExternalMaterialized()) {
+    bool nonzero = false;
+    for (unsigned long iPoint = 0; iPoint < nPoint && !nonzero; iPoint++)
+      for (unsigned short iVar = 0; iVar < nVar; iVar++)
+        nonzero = nonzero || (SU2_TYPE::GetValue(base_nodes->GetSolution(iPoint,iVar)) != 0.0);
+
+    if (!nonzero) {
+      base_nodes->Set_ExternalExtra_To_SolutionExtra();
+      return;
+    }
+    base_nodes->MaterializeExternal();
+  }
+
   for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++) {
     base_nodes->Add_External(iPoint, base_nodes->GetSolution(iPoint));
   }
@@ -2238,6 +2514,19 @@ void CSolver::Update_Cross_Term(CConfig *config, su2passivematrix &cross_term) {
   vector<su2double> solution(nVar);
   passivedouble alpha = SU2_TYPE::GetValue(config->GetAitkenStatRelax());
 
+  /*--- Nothing to do while the new cross term does not differ from the stored one
+   *    (e.g. effectively uncoupled zone pairs), the external container then keeps
+   *    reading as zero and is not materialized. ---*/
+  if (!base_nodes->ExternalMaterialized()) {
+    bool nonzero = false;
+    for (unsigned long iPoint = 0; iPoint < nPoint && !nonzero; iPoint++)
+      for (unsigned short iVar = 0; iVar < nVar; iVar++)
+        nonzero = nonzero || (SU2_TYPE::GetValue(base_nodes->GetSolution(iPoint,iVar)) != cross_term(iPoint,iVar));
+
+    if (!nonzero) return;
+    base_nodes->MaterializeExternal();
+  }
+
   for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++) {
     for (unsigned short iVar = 0; iVar < nVar; iVar++) {
       passivedouble
@@ -2914,7 +3203,8 @@ void CSolver::Read_SU2_Restart_ASCII(CGeometry *geometry, const CConfig *config,
 
 }
 
-void CSolver::Read_SU2_Restart_Binary(CGeometry *geometry, const CConfig *config, string val_filename) {
+void CSolver::Read_SU2_Restart_Binary(CGeometry *geometry, const CConfig *config, string val_filename,
+                                      unsigned short val_nFieldsWanted) {
 
   char str_buf[CGNS_STRING_SIZE], fname[100];
   val_filename += ".dat";
@@ -2922,6 +3212,15 @@ void CSolver::Read_SU2_Restart_Binary(CGeometry *geometry, const CConfig *config
   const int nRestart_Vars = 5;
   Restart_Vars = new int[nRestart_Vars];
   fields.clear();
+  Restart_TimeN_Loaded = false;
+
+  /*--- Dual-snapshot restart files carry the previous time step as a second
+   data block behind the current one, read it when the calculation can use it
+   (2nd-order dual time on a static grid, see DUAL_SNAPSHOT_RESTART). ---*/
+
+  const bool wantPrev = config->GetDual_Snapshot_Restart() &&
+                        (config->GetTime_Marching() == TIME_MARCHING::DT_STEPPING_2ND) &&
+                        !config->GetDynamic_Grid();
 
 #ifndef HAVE_MPI
 
@@ -2954,11 +3253,35 @@ void CSolver::Read_SU2_Restart_Binary(CGeometry *geometry, const CConfig *config
                    string("possible with the READ_BINARY_RESTART option."), CURRENT_FUNCTION);
   }
 
+  /*--- Reduced-precision or delta-encoded snapshots (see the WRT_SNAPSHOT
+   options) are not valid restart data, only their keyframes are. ---*/
+
+  if (Restart_Vars[3] != 0) {
+    SU2_MPI::Error(string("File ") + string(fname) + string(" is a reduced-precision or delta-encoded snapshot\n") +
+                   string("(see the WRT_SNAPSHOT options) and cannot be used for a restart.\n") +
+                   string("Restart from a keyframe, which is written in the standard full-precision format."),
+                   CURRENT_FUNCTION);
+  }
+
   /*--- Store the number of fields and points to be read for clarity. ---*/
 
   const unsigned long nFields = Restart_Vars[1];
   const unsigned long nPointFile = Restart_Vars[2];
 
+  /*--- Field-filtered read: when the caller only consumes a leading subset of
+   the columns, the trailing fields (typically output-only quantities) are not
+   read at all. Disabled when interpolating between different grids since the
+   interpolation consumes entire records. ---*/
+
+  const bool sameGrid = (nPointFile == geometry->GetGlobal_nPointDomain());
+  const unsigned long nFieldsUse = (sameGrid && (val_nFieldsWanted > 0) &&
+                                    (val_nFieldsWanted < nFields)) ? val_nFieldsWanted : nFields;
+
+  /*--- Presence of the second data block (previous time step), interpolation
+   between grids consumes only the current snapshot. ---*/
+
+  const bool hasPrev = wantPrev && sameGrid && (Restart_Vars[4] == 1);
+
   /*--- Read the variable names from the file. Note that we are adopting a
    fixed length of 33 for the string length to match with CGNS. This is
    needed for when we read the strings later. We pad the beginning of the
@@ -2973,18 +3296,102 @@ void CSolver::Read_SU2_Restart_Binary(CGeometry *geometry, const CConfig *config
     fields.push_back(str_buf);
   }
 
-  /*--- For now, create a temp 1D buffer to read the data from file. ---*/
+  /*--- Offset of the data portion of the file (header plus variable names). ---*/
 
-  Restart_Data = new passivedouble[nFields*nPointFile];
+  const unsigned long data_disp = nRestart_Vars*sizeof(int) + CGNS_STRING_SIZE*nFields*sizeof(char);
 
-  /*--- Read in the data for the restart at all local points. ---*/
+#if !defined(_WIN32)
 
-  ret = fread(Restart_Data, sizeof(passivedouble), nFields*nPointFile, fhw);
-  if (ret != nFields*nPointFile) {
-    SU2_MPI::Error("Error reading restart file.", CURRENT_FUNCTION);
+  /*--- Map the data portion of the file directly into memory (zero copy).
+   The pages of the mapping are only faulted in on first access, i.e. the
+   cost of reading a field that is stored in the file but never used by the
+   solver is mostly avoided. Direct access requires support for unaligned
+   loads when the header does not preserve the alignment of the data, which
+   is the case for the usual architectures. ---*/
+
+#if defined(__x86_64__) || defined(__aarch64__)
+  constexpr bool directAccess = true;
+#else
+  const bool directAccess = (data_disp % alignof(passivedouble) == 0);
+#endif
+
+  struct stat fileStat;
+  if ((nFieldsUse == nFields) && directAccess && (fstat(fileno(fhw), &fileStat) == 0) &&
+      (static_cast<unsigned long>(fileStat.st_size) >=
+       data_disp + (1 + hasPrev)*nFields*nPointFile*sizeof(passivedouble))) {
+    void* addr = mmap(nullptr, fileStat.st_size, PROT_READ, MAP_PRIVATE, fileno(fhw), 0);
+    if (addr != MAP_FAILED) {
+      Restart_Data_Map = addr;
+      Restart_Data_MapSize = fileStat.st_size;
+      Restart_Data = reinterpret_cast<passivedouble*>(static_cast<char*>(addr) + data_disp);
+      if (hasPrev) Restart_Data_n = Restart_Data + nFields*nPointFile;
+    }
   }
 
-  /*--- Close the file. ---*/
+#endif
+
+  if (Restart_Data == nullptr) {
+
+    /*--- Fallback, create a temp 1D buffer to read the data from file. ---*/
+
+    Restart_Data = new passivedouble[nFieldsUse*nPointFile];
+
+    if (nFieldsUse == nFields) {
+
+      /*--- Read in the data for the restart at all local points. ---*/
+
+      fseek(fhw, data_disp, SEEK_SET);
+      ret = fread(Restart_Data, sizeof(passivedouble), nFields*nPointFile, fhw);
+      if (ret != nFields*nPointFile) {
+        SU2_MPI::Error("Error reading restart file.", CURRENT_FUNCTION);
+      }
+    }
+    else {
+
+      /*--- Read only the leading columns of each record, the result is
+       stored contiguously with the reduced stride. ---*/
+
+      for (unsigned long iPoint = 0; iPoint < nPointFile; iPoint++) {
+        fseek(fhw, data_disp + iPoint*nFields*sizeof(passivedouble), SEEK_SET);
+        ret = fread(&Restart_Data[iPoint*nFieldsUse], sizeof(passivedouble), nFieldsUse, fhw);
+        if (ret != nFieldsUse) {
+          SU2_MPI::Error("Error reading restart file.", CURRENT_FUNCTION);
+        }
+      }
+    }
+
+    if (hasPrev) {
+
+      /*--- Read the second data block (previous time step) with the same
+       field filtering as the current one. ---*/
+
+      Restart_Data_n = new passivedouble[nFieldsUse*nPointFile];
+      const unsigned long prev_disp = data_disp + nFields*nPointFile*sizeof(passivedouble);
+
+      if (nFieldsUse == nFields) {
+        fseek(fhw, prev_disp, SEEK_SET);
+        ret = fread(Restart_Data_n, sizeof(passivedouble), nFields*nPointFile, fhw);
+        if (ret != nFields*nPointFile) {
+          SU2_MPI::Error("Error reading restart file.", CURRENT_FUNCTION);
+        }
+      }
+      else {
+        for (unsigned long iPoint = 0; iPoint < nPointFile; iPoint++) {
+          fseek(fhw, prev_disp + iPoint*nFields*sizeof(passivedouble), SEEK_SET);
+          ret = fread(&Restart_Data_n[iPoint*nFieldsUse], sizeof(passivedouble), nFieldsUse, fhw);
+          if (ret != nFieldsUse) {
+            SU2_MPI::Error("Error reading restart file.", CURRENT_FUNCTION);
+          }
+        }
+      }
+    }
+  }
+
+  /*--- Store the stride of the data actually kept. ---*/
+
+  Restart_Vars[1] = static_cast<int>(nFieldsUse);
+
+  /*--- Close the file (does not invalidate the mapping). ---*/
 
   fclose(fhw);
 
@@ -3024,11 +3431,35 @@ void CSolver::Read_SU2_Restart_Binary(CGeometry *geometry, const CConfig *config
                    string("possible with the READ_BINARY_RESTART option."), CURRENT_FUNCTION);
   }
 
+  /*--- Reduced-precision or delta-encoded snapshots (see the WRT_SNAPSHOT
+   options) are not valid restart data, only their keyframes are. ---*/
+
+  if (Restart_Vars[3] != 0) {
+    SU2_MPI::Error(string("File ") + string(fname) + string(" is a reduced-precision or delta-encoded snapshot\n") +
+                   string("(see the WRT_SNAPSHOT options) and cannot be used for a restart.\n") +
+                   string("Restart from a keyframe, which is written in the standard full-precision format."),
+                   CURRENT_FUNCTION);
+  }
+
   /*--- Store the number of fields and points to be read for clarity. ---*/
 
   const unsigned long nFields = Restart_Vars[1];
   const unsigned long nPointFile = Restart_Vars[2];
 
+  /*--- Field-filtered read: when the caller only consumes a leading subset of
+   the columns, the trailing fields (typically output-only quantities) are not
+   read at all. Disabled when interpolating between different grids since the
+   interpolation consumes entire records. ---*/
+
+  const bool sameGrid = (nPointFile == geometry->GetGlobal_nPointDomain());
+  const unsigned long nFieldsUse = (sameGrid && (val_nFieldsWanted > 0) &&
+                                    (val_nFieldsWanted < nFields)) ? val_nFieldsWanted : nFields;
+
+  /*--- Presence of the second data block (previous time step), interpolation
+   between grids consumes only the current snapshot. ---*/
+
+  const bool hasPrev = wantPrev && sameGrid && (Restart_Vars[4] == 1);
+
   /*--- Read the variable names from the file. Note that we are adopting a
    fixed length of 33 for the string length to match with CGNS. This is
    needed for when we read the strings later. ---*/
@@ -3091,7 +3522,7 @@ void CSolver::Read_SU2_Restart_Binary(CGeometry *geometry, const CConfig *config
     int counter = 0;
     for (auto iPoint_Global = 0ul; iPoint_Global < geometry->GetGlobal_nPointDomain(); ++iPoint_Global) {
       if (geometry->GetGlobal_to_Local_Point(iPoint_Global) > -1) {
-        blocklen[counter] = nFields;
+        blocklen[counter] = nFieldsUse;
         displace[counter] = iPoint_Global*nFields*sizeof(passivedouble);
         counter++;
       }
@@ -3127,6 +3558,17 @@ void CSolver::Read_SU2_Restart_Binary(CGeometry *geometry, const CConfig *config
 
   MPI_File_read_all(fhw, Restart_Data, bufSize, MPI_DOUBLE, &status);
 
+  /*--- Read the second data block (previous time step) of a dual-snapshot
+   file by shifting the view one full snapshot forward and reusing the same
+   derived datatype. ---*/
+
+  if (hasPrev) {
+    Restart_Data_n = new passivedouble[bufSize];
+    disp += nFields*nPointFile*sizeof(passivedouble);
+    MPI_File_set_view(fhw, disp, etype, filetype, (char*)"native", MPI_INFO_NULL);
+    MPI_File_read_all(fhw, Restart_Data_n, bufSize, MPI_DOUBLE, &status);
+  }
+
   /*--- All ranks close the file after writing. ---*/
 
   MPI_File_close(&fhw);
@@ -3138,6 +3580,10 @@ void CSolver::Read_SU2_Restart_Binary(CGeometry *geometry, const CConfig *config
   delete [] blocklen;
   delete [] displace;
 
+  /*--- Store the stride of the data actually kept. ---*/
+
+  Restart_Vars[1] = static_cast<int>(nFieldsUse);
+
 #endif
 
   if (nPointFile != geometry->GetGlobal_nPointDomain() &&
@@ -3146,6 +3592,406 @@ void CSolver::Read_SU2_Restart_Binary(CGeometry *geometry, const CConfig *config
   }
 }
 
+void CSolver::Read_SU2_Restart_Surface(CGeometry *geometry, const CConfig *config, string val_filename) {
+
+  char str_buf[CGNS_STRING_SIZE], fname[100];
+  val_filename += ".sdat";
+  strcpy(fname, val_filename.c_str());
+  const int nRestart_Vars = 5;
+  Restart_Vars = new int[nRestart_Vars];
+  fields.clear();
+
+  /*--- Surface restarts hold only the marker-adjacent points and are small
+   by design, the master reads the whole file and broadcasts it. ---*/
+
+  vector<passivedouble> fileData;
+  vector<char> fileNames;
+
+  if (rank == MASTER_NODE) {
+
+    FILE *fhw = fopen(fname,"rb");
+    size_t ret;
+
+    /*--- Error check for opening the file. ---*/
+
+    if (!fhw) {
+      SU2_MPI::Error(string("Unable to open SU2 surface restart file ") + string(fname), CURRENT_FUNCTION);
+    }
+
+    /*--- First, read the number of columns and points. ---*/
+
+    ret = fread(Restart_Vars, sizeof(int), nRestart_Vars, fhw);
+    if (ret != (unsigned long)nRestart_Vars) {
+      SU2_MPI::Error("Error reading restart file.", CURRENT_FUNCTION);
+    }
+
+    /*--- Check the magic number of the sparse surface restart format. ---*/
+
+    if (Restart_Vars[0] != 535534) {
+      SU2_MPI::Error(string("File ") + string(fname) + string(" is not an SU2 surface restart file.\n") +
+                     string("Surface restart files are written with the RESTART_SURFACE output format\n") +
+                     string("and read with the READ_SURFACE_RESTART option."), CURRENT_FUNCTION);
+    }
+
+    const unsigned long nCols = Restart_Vars[1];
+    const unsigned long nPointFile = Restart_Vars[2];
+
+    /*--- Read the variable names (fixed length of 33 to match CGNS), the
+     first column is the global point index. ---*/
+
+    fileNames.resize(nCols*CGNS_STRING_SIZE);
+    ret = fread(fileNames.data(), sizeof(char), nCols*CGNS_STRING_SIZE, fhw);
+    if (ret != nCols*CGNS_STRING_SIZE) {
+      SU2_MPI::Error("Error reading restart file.", CURRENT_FUNCTION);
+    }
+
+    /*--- Read the data section. ---*/
+
+    fileData.resize(nCols*nPointFile);
+    ret = fread(fileData.data(), sizeof(passivedouble), nCols*nPointFile, fhw);
+    if (ret != nCols*nPointFile) {
+      SU2_MPI::Error("Error reading restart file.", CURRENT_FUNCTION);
+    }
+
+    fclose(fhw);
+  }
+
+  /*--- Broadcast the header, names, and records to all ranks. ---*/
+
+  SU2_MPI::Bcast(Restart_Vars, nRestart_Vars, MPI_INT, MASTER_NODE, SU2_MPI::GetComm());
+
+  const unsigned long nCols = Restart_Vars[1];
+  const unsigned long nPointFile = Restart_Vars[2];
+
+  if (rank != MASTER_NODE) {
+    fileNames.resize(nCols*CGNS_STRING_SIZE);
+    fileData.resize(nCols*nPointFile);
+  }
+
+  SU2_MPI::Bcast(fileNames.data(), nCols*CGNS_STRING_SIZE, MPI_CHAR, MASTER_NODE, SU2_MPI::GetComm());
+  SU2_MPI::Bcast(fileData.data(), nCols*nPointFile, MPI_DOUBLE, MASTER_NODE, SU2_MPI::GetComm());
+
+  /*--- Parse the names, the index column of the file takes the place of the
+   Point_ID tag that the volume readers prepend themselves. ---*/
+
+  for (auto iVar = 0ul; iVar < nCols; iVar++) {
+    strncpy(str_buf, &fileNames[iVar*CGNS_STRING_SIZE], CGNS_STRING_SIZE);
+    str_buf[CGNS_STRING_SIZE-1] = '\0';
+    fields.push_back(str_buf);
+  }
+
+  /*--- Keep only the records of locally owned points, stripping the index
+   column so that Restart_Data has the usual field-only layout. ---*/
+
+  const unsigned long nFields = nCols-1;
+  Restart_Vars[1] = (int)nFields;
+
+  Restart_Points.clear();
+  Restart_Data = new passivedouble[nFields*nPointFile];
+
+  unsigned long counter = 0;
+  for (auto iRecord = 0ul; iRecord < nPointFile; iRecord++) {
+    const auto iPoint_Global = (unsigned long)fileData[iRecord*nCols];
+    if (geometry->GetGlobal_to_Local_Point(iPoint_Global) > -1) {
+      Restart_Points.push_back(iPoint_Global);
+      for (auto iVar = 0ul; iVar < nFields; iVar++)
+        Restart_Data[counter*nFields + iVar] = fileData[iRecord*nCols + iVar+1];
+      counter++;
+    }
+  }
+}
+
+void CSolver::Read_SU2_Restart_HighOrder(CGeometry *geometry, const CConfig *config, string val_filename) {
+
+  char str_buf[CGNS_STRING_SIZE], fname[100];
+  val_filename += ".hdat";
+  strcpy(fname, val_filename.c_str());
+  const int nRestart_Vars = 5;
+  Restart_Vars = new int[nRestart_Vars];
+  fields.clear();
+
+  /*--- The format is tied to the FEM DG discretization of the grid. ---*/
+
+  CMeshFEM_DG* DGGeometry = dynamic_cast<CMeshFEM_DG*>(geometry);
+  if (DGGeometry == nullptr)
+    SU2_MPI::Error("High-order restart files can only be read by the FEM DG solver.", CURRENT_FUNCTION);
+
+  /*--- The header, the field names, and the element table are small compared
+   to the DOF data, the master reads them and broadcasts. ---*/
+
+  const unsigned long nRecordVals = 4;
+  vector<char> fileNames;
+  vector<unsigned long> elemTable;
+
+  if (rank == MASTER_NODE) {
+
+    FILE *fhw = fopen(fname,"rb");
+    size_t ret;
+
+    /*--- Error check for opening the file. ---*/
+
+    if (!fhw)
+      SU2_MPI::Error(string("Unable to open SU2 restart file ") + string(fname), CURRENT_FUNCTION);
+
+    /*--- First, read the counts. ---*/
+
+    ret = fread(Restart_Vars, sizeof(int), nRestart_Vars, fhw);
+    if (ret != (unsigned long)nRestart_Vars) {
+      SU2_MPI::Error("Error reading restart file.", CURRENT_FUNCTION);
+    }
+
+    /*--- Check the magic number of the high-order restart format. ---*/
+
+    if (Restart_Vars[0] != 535535) {
+      SU2_MPI::Error(string("File ") + string(fname) + string(" is not an SU2 high-order restart file.\n") +
+                     string("High-order restart files are written with the RESTART_HIGHORDER output format\n") +
+                     string("and read with the READ_HIGHORDER_RESTART option."), CURRENT_FUNCTION);
+    }
+
+    const unsigned long nColsFile = Restart_Vars[1];
+    const unsigned long nElemFile = Restart_Vars[3];
+
+    /*--- Read the names of the data fields (fixed length of 33 to match
+     CGNS), the coordinate columns are not stored in this format. ---*/
+
+    fileNames.resize(nColsFile*CGNS_STRING_SIZE);
+    ret = fread(fileNames.data(), sizeof(char), fileNames.size(), fhw);
+    if (ret != fileNames.size()) {
+      SU2_MPI::Error("Error reading restart file.", CURRENT_FUNCTION);
+    }
+
+    /*--- Read the element table. ---*/
+
+    elemTable.resize(nRecordVals*nElemFile);
+    ret = fread(elemTable.data(), sizeof(unsigned long), elemTable.size(), fhw);
+    if (ret != elemTable.size()) {
+      SU2_MPI::Error("Error reading restart file.", CURRENT_FUNCTION);
+    }
+
+    fclose(fhw);
+  }
+
+  /*--- Broadcast the header, the names, and the element table. ---*/
+
+  SU2_MPI::Bcast(Restart_Vars, nRestart_Vars, MPI_INT, MASTER_NODE, SU2_MPI::GetComm());
+
+  const unsigned long nVarData = Restart_Vars[1];
+  const unsigned long nPointFile = Restart_Vars[2];
+  const unsigned long nElemFile = Restart_Vars[3];
+  const unsigned short nDimFile = Restart_Vars[4];
+
+  if (rank != MASTER_NODE) {
+    fileNames.resize(nVarData*CGNS_STRING_SIZE);
+    elemTable.resize(nRecordVals*nElemFile);
+  }
+
+  SU2_MPI::Bcast(fileNames.data(), (int)fileNames.size(), MPI_CHAR, MASTER_NODE, SU2_MPI::GetComm());
+  SU2_MPI::Bcast(elemTable.data(), (int)elemTable.size(), MPI_UNSIGNED_LONG, MASTER_NODE, SU2_MPI::GetComm());
+
+  /*--- The raw coefficients are only valid for the discretization the file
+   was written with, refuse anything that would require interpolation. ---*/
+
+  if ((nDimFile != nDim) || (nPointFile != geometry->GetGlobal_nPointDomain()))
+    SU2_MPI::Error(string("The discretization in ") + string(fname) +
+                   string(" does not match this run.\n") +
+                   string("High-order restarts are exact and are not interpolated between discretizations."),
+                   CURRENT_FUNCTION);
+
+  /*--- Parse the field names, prepending the Point_ID tag and the coordinate
+   names that the reader reconstructs itself. ---*/
+
+  fields.push_back("Point_ID");
+  const char* coordNames[] = {"x", "y", "z"};
+  for (unsigned short iDim = 0; iDim < nDim; iDim++)
+    fields.push_back(coordNames[iDim]);
+
+  for (auto iVar = 0ul; iVar < nVarData; iVar++) {
+    strncpy(str_buf, &fileNames[iVar*CGNS_STRING_SIZE], CGNS_STRING_SIZE);
+    str_buf[CGNS_STRING_SIZE-1] = '\0';
+    fields.push_back(str_buf);
+  }
+
+  /*--- Index the element records by their global DOF offset and verify the
+   type, polynomial degree, and DOF count of every owned element. ---*/
+
+  map<unsigned long, unsigned long> recordOfOffset;
+  for (auto iElem = 0ul; iElem < nElemFile; iElem++)
+    recordOfOffset[elemTable[iElem*nRecordVals+3]] = iElem;
+
+  const unsigned long nVolElemOwned = DGGeometry->GetNVolElemOwned();
+  const CVolumeElementFEM* volElem = DGGeometry->GetVolElem();
+
+  unsigned short mismatch = 0;
+  for (auto l = 0ul; l < nVolElemOwned; ++l) {
+    const auto it = recordOfOffset.find(volElem[l].offsetDOFsSolGlobal);
+    if (it == recordOfOffset.end()) { mismatch = 1; break; }
+    const unsigned long* record = &elemTable[it->second*nRecordVals];
+    if ((record[0] != volElem[l].VTK_Type) || (record[1] != volElem[l].nPolySol) ||
+        (record[2] != volElem[l].nDOFsSol)) { mismatch = 1; break; }
+  }
+
+#ifdef HAVE_MPI
+  unsigned short mismatchLoc = mismatch;
+  SU2_MPI::Allreduce(&mismatchLoc, &mismatch, 1, MPI_UNSIGNED_SHORT, MPI_MAX, SU2_MPI::GetComm());
+#endif
+
+  if (mismatch != 0)
+    SU2_MPI::Error(string("The elements in ") + string(fname) +
+                   string(" do not match the mesh and solution order of this run.\n") +
+                   string("High-order restarts are exact and are not interpolated between discretizations."),
+                   CURRENT_FUNCTION);
+
+  /*--- Read the rows of the owned DOFs from the data section. ---*/
+
+  const unsigned long nDOFsLoc = geometry->GetnPointDomain();
+  const unsigned long data_disp = nRestart_Vars*sizeof(int) +
+                                  CGNS_STRING_SIZE*nVarData*sizeof(char) +
+                                  nRecordVals*nElemFile*sizeof(unsigned long);
+
+  vector<passivedouble> rawData(nVarData*nDOFsLoc);
+
+#ifndef HAVE_MPI
+
+  /*--- Serial input, all DOFs are owned and read in one block. ---*/
+
+  FILE *fhw = fopen(fname,"rb");
+  if (!fhw)
+    SU2_MPI::Error(string("Unable to open SU2 restart file ") + string(fname), CURRENT_FUNCTION);
+
+  fseek(fhw, data_disp, SEEK_SET);
+  size_t ret = fread(rawData.data(), sizeof(passivedouble), rawData.size(), fhw);
+  if (ret != rawData.size()) {
+    SU2_MPI::Error("Error reading restart file.", CURRENT_FUNCTION);
+  }
+  fclose(fhw);
+
+#else
+
+  /*--- Parallel input using MPI I/O, each rank reads the rows of the DOFs it
+   owns through a derived datatype, like for the standard binary restart. ---*/
+
+  MPI_File fhw;
+  MPI_Datatype filetype;
+
+  int ierr = MPI_File_open(SU2_MPI::GetComm(), fname, MPI_MODE_RDONLY, MPI_INFO_NULL, &fhw);
+
+  if (ierr) SU2_MPI::Error(string("Unable to open SU2 restart file ") + string(fname), CURRENT_FUNCTION);
+
+  vector<int> blocklen(nDOFsLoc);
+  vector<MPI_Aint> displace(nDOFsLoc);
+
+  int counter = 0;
+  for (auto iPoint_Global = 0ul; iPoint_Global < nPointFile; ++iPoint_Global) {
+    if (geometry->GetGlobal_to_Local_Point(iPoint_Global) > -1) {
+      blocklen[counter] = (int)nVarData;
+      displace[counter] = iPoint_Global*nVarData*sizeof(passivedouble);
+      counter++;
+    }
+  }
+
+  MPI_Type_create_hindexed((int)nDOFsLoc, blocklen.data(), displace.data(), MPI_DOUBLE, &filetype);
+  MPI_Type_commit(&filetype);
+
+  MPI_File_set_view(fhw, data_disp, MPI_DOUBLE, filetype, (char*)"native", MPI_INFO_NULL);
+
+  MPI_File_read_all(fhw, rawData.data(), (int)rawData.size(), MPI_DOUBLE, MPI_STATUS_IGNORE);
+
+  MPI_File_close(&fhw);
+  MPI_Type_free(&filetype);
+
+#endif
+
+  /*--- Reconstruct the coordinate columns from the grid, so that Restart_Data
+   gets the usual layout and the load routines can skip the coordinates like
+   for any other restart. ---*/
+
+  vector<passivedouble> coordLocal(nDim*nDOFsLoc);
+
+  for (auto l = 0ul; l < nVolElemOwned; ++l) {
+    for (unsigned short j = 0; j < volElem[l].nDOFsSol; ++j) {
+      const long iLocal = geometry->GetGlobal_to_Local_Point(volElem[l].offsetDOFsSolGlobal + j);
+      for (unsigned short iDim = 0; iDim < nDim; ++iDim)
+        coordLocal[iLocal*nDim+iDim] = SU2_TYPE::GetValue(volElem[l].coorSolDOFs[j*nDim+iDim]);
+    }
+  }
+
+  const unsigned long nFields = nDim + nVarData;
+  Restart_Vars[1] = (int)nFields;
+
+  Restart_Data = new passivedouble[nFields*nDOFsLoc];
+
+  unsigned long iRow = 0;
+  for (auto iPoint_Global = 0ul; iPoint_Global < nPointFile; ++iPoint_Global) {
+    const long iPoint_Local = geometry->GetGlobal_to_Local_Point(iPoint_Global);
+    if (iPoint_Local < 0) continue;
+    for (unsigned short iDim = 0; iDim < nDim; ++iDim)
+      Restart_Data[iRow*nFields + iDim] = coordLocal[iPoint_Local*nDim + iDim];
+    for (auto iVar = 0ul; iVar < nVarData; ++iVar)
+      Restart_Data[iRow*nFields + nDim + iVar] = rawData[iRow*nVarData + iVar];
+    iRow++;
+  }
+}
+
+void CSolver::FreeRestartData() {
+
+#if !defined(_WIN32)
+  if (Restart_Data_Map != nullptr) {
+    munmap(Restart_Data_Map, Restart_Data_MapSize);
+    Restart_Data_Map = nullptr;
+    Restart_Data_MapSize = 0;
+    Restart_Data = nullptr;
+    Restart_Data_n = nullptr;
+    return;
+  }
+#endif
+
+  delete [] Restart_Data;
+  Restart_Data = nullptr;
+  delete [] Restart_Data_n;
+  Restart_Data_n = nullptr;
+}
+
+void CSolver::PrefetchRestartFile(const string& val_filename) {
+
+#if !defined(_WIN32)
+
+  /*--- Non-blocking advisory, the kernel starts reading the file into the
+   page cache in the background and the later read (fread, mmap faults, or
+   MPI I/O) hits memory instead of the device. Failure to open or advise is
+   not an error, the actual load reports its own problems. ---*/
+
+  const string filename = val_filename + ".dat";
+  const int fd = open(filename.c_str(), O_RDONLY);
+  if (fd != -1) {
+    posix_fadvise(fd, 0, 0, POSIX_FADV_WILLNEED);
+    close(fd);
+  }
+
+#endif
+}
+
+namespace {
+/*--- Cache of the interpolation map built by CSolver::InterpolateRestartData.
+ * The map (nearest donor of each target point and the order in which the data
+ * diffuses to the unmapped points) depends only on the mesh pair and not on
+ * the fields being transferred, hence it is reused by the other solvers of
+ * the run (e.g. turbulence after flow) and by repeated restarts. ---*/
+struct CRestartInterpolationMap {
+  bool valid = false;
+  unsigned short zone = 0;
+  unsigned long nPointFile = 0;        /*!< \brief Number of points in the restart file. */
+  unsigned long nPointTarget = 0;      /*!< \brief Global number of points of the mesh. */
+  vector<long> donorIndex;             /*!< \brief Global file index of the nearest donor, -1 if filled by diffusion. */
+  vector<int> fillPass;                /*!< \brief Diffusion pass in which each point was filled (0 = direct donor). */
+  int nRecurse = 0;                    /*!< \brief Number of diffusion passes. */
+
+  bool Matches(unsigned short zone_, unsigned long nPointFile_, unsigned long nPointTarget_) const {
+    return valid && zone == zone_ && nPointFile == nPointFile_ && nPointTarget == nPointTarget_;
+  }
+};
+CRestartInterpolationMap restartInterpolationMap;
+}
+
 void CSolver::InterpolateRestartData(const CGeometry *geometry, const CConfig *config) {
 
   if (geometry->GetGlobal_nPointDomain() == 0) return;
@@ -3164,33 +4010,39 @@ void CSolver::InterpolateRestartData(const CGeometry *geometry, const CConfig *c
    *  - Find the closest target point for each donor, which does not match all targets.
    *  - "Diffuse" the data to neighbor points.
    *  Complexity is approx. Nlt + (Nlt + Nd) log(Nlt) where Nlt is the LOCAL number
-   *  of target points and Nd the TOTAL number of donors. */
+   *  of target points and Nd the TOTAL number of donors.
+   *  The resulting map is cached, repeated transfers only pay the data motion. */
 
   const unsigned long nFields = Restart_Vars[1];
   const unsigned long nPointFile = Restart_Vars[2];
   const auto t0 = SU2_MPI::Wtime();
   auto nRecurse = 0;
 
+  auto& map = restartInterpolationMap;
+  const bool reuseMap = map.Matches(config->GetiZone(), nPointFile, geometry->GetGlobal_nPointDomain());
+
   if (rank == MASTER_NODE) {
     cout << "\nThe number of points in the restart file (" << nPointFile << ") does not match "
-            "the mesh (" << geometry->GetGlobal_nPointDomain() << ").\n"
-            "A recursive nearest neighbor interpolation will be performed." << endl;
+            "the mesh (" << geometry->GetGlobal_nPointDomain() << ").\n";
+    if (reuseMap)
+      cout << "Reusing the nearest neighbor interpolation map of a previous transfer." << endl;
+    else
+      cout << "A recursive nearest neighbor interpolation will be performed." << endl;
+  }
+
+  if (!reuseMap) {
+    map.valid = false;
+    map.zone = config->GetiZone();
+    map.nPointFile = nPointFile;
+    map.nPointTarget = geometry->GetGlobal_nPointDomain();
+    map.donorIndex.assign(nPointDomain, -1);
+    /*--- Sized for halos too, which are visited (and skipped) during the diffusion. ---*/
+    map.fillPass.assign(nPoint, -1);
+    map.nRecurse = 0;
   }
 
   su2activematrix localVars(nPointDomain, nFields);
   localVars = su2double(0.0);
-  {
-  su2vector<uint8_t> isMapped(nPoint);
-  isMapped = false;
-
-  /*--- ADT of local target points. ---*/
-  {
-  const auto& coord = geometry->nodes->GetCoord();
-  vector<unsigned long> index(nPointDomain);
-  iota(index.begin(), index.end(), 0ul);
-
-  CADTPointsOnlyClass adt(nDim, nPointDomain, coord.data(), index.data(), false);
-  vector<unsigned long>().swap(index);
 
   /*--- Copy local donor restart data, which will circulate over all ranks. ---*/
 
@@ -3208,20 +4060,35 @@ void CSolver::InterpolateRestartData(const CGeometry *geometry, const CConfig *c
       sendBuf(iPoint,iVar) = Restart_Data[iPointDonor*nFields+iVar];
   }
 
-  delete [] Restart_Data;
-  Restart_Data = nullptr;
+  FreeRestartData();
 
   /*--- Make room to receive donor data from other ranks, and to map it to target points. ---*/
 
   su2activematrix donorVars(nPointDonorMax, nFields);
-  vector<su2double> donorDist(nPointDomain, 1e12);
 
-  /*--- Circle over all ranks. ---*/
+  /*--- Setup of the ring over all ranks. ---*/
 
   const int dst = (rank+1) % size; // send to next
   const int src = (rank-1+size) % size; // receive from prev.
   const int count = sendBuf.size();
 
+  if (!reuseMap) {
+  su2vector<uint8_t> isMapped(nPoint);
+  isMapped = false;
+
+  /*--- ADT of local target points. ---*/
+  {
+  const auto& coord = geometry->nodes->GetCoord();
+  vector<unsigned long> index(nPointDomain);
+  iota(index.begin(), index.end(), 0ul);
+
+  CADTPointsOnlyClass adt(nDim, nPointDomain, coord.data(), index.data(), false);
+  vector<unsigned long>().swap(index);
+
+  vector<su2double> donorDist(nPointDomain, 1e12);
+
+  /*--- Circle over all ranks. ---*/
+
   for (int iStep = 0; iStep < size; ++iStep) {
 
     swap(sendBuf, donorVars);
@@ -3235,6 +4102,12 @@ void CSolver::InterpolateRestartData(const CGeometry *geometry, const CConfig *c
       else SU2_MPI::Recv(donorVars.data(), count, MPI_DOUBLE, src, 0, SU2_MPI::GetComm(), MPI_STATUS_IGNORE);
     }
 
+    /*--- The chunk received in this step originates "iStep" ranks behind us. ---*/
+
+    const int donorRank = (rank-iStep+size) % size;
+    const auto firstDonor = partitioner.GetFirstIndexOnRank(donorRank);
+    const auto nDonorRank = partitioner.GetSizeOnRank(donorRank);
+
     /*--- Find the closest target for each donor. ---*/
 
     vector<su2double> targetDist(donorVars.rows());
@@ -3256,12 +4129,14 @@ void CSolver::InterpolateRestartData(const CGeometry *geometry, const CConfig *c
       if (dist < donorDist[iPoint]) {
         donorDist[iPoint] = dist;
         isMapped[iPoint] = true;
+        map.donorIndex[iPoint] = firstDonor + min(iDonor, nDonorRank-1ul);
+        map.fillPass[iPoint] = 0;
         for (auto iVar = 0ul; iVar < donorVars.cols(); ++iVar)
           localVars(iPoint,iVar) = donorVars(iDonor,iVar);
       }
     }
   }
-  } // everything goes out of scope except "localVars" and "isMapped"
+  } // the ADT and distances go out of scope
 
   /*--- Recursively diffuse the nearest neighbor data. ---*/
 
@@ -3292,6 +4167,9 @@ void CSolver::InterpolateRestartData(const CGeometry *geometry, const CConfig *c
         for (auto iVar = 0ul; iVar < localVars.cols(); ++iVar)
           localVars(iPoint,iVar) /= nDonor[iPoint];
         nDonor[iPoint] = true;
+        /*--- Record in which pass this point was filled, to be able to
+         replay the diffusion without the trial and error. ---*/
+        map.fillPass[iPoint] = nRecurse+1;
       }
     }
     END_SU2_OMP_FOR
@@ -3320,7 +4198,78 @@ void CSolver::InterpolateRestartData(const CGeometry *geometry, const CConfig *c
   }
   END_SU2_OMP_PARALLEL
 
-  } // everything goes out of scope except "localVars"
+  map.nRecurse = nRecurse;
+  map.valid = true;
+
+  }
+  else {
+
+  /*--- Replay the cached map, first gather the direct donors while the chunks
+   circulate over the ring, without any ADT searches. ---*/
+
+  vector<vector<unsigned long> > targetsOfRank(size);
+  for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint)
+    if (map.donorIndex[iPoint] >= 0)
+      targetsOfRank[partitioner.GetRankContainingIndex(map.donorIndex[iPoint])].push_back(iPoint);
+
+  for (int iStep = 0; iStep < size; ++iStep) {
+
+    swap(sendBuf, donorVars);
+
+    if (iStep) {
+      /*--- Odd ranks send and then receive, and vice versa. ---*/
+      if (rank%2) SU2_MPI::Send(sendBuf.data(), count, MPI_DOUBLE, dst, 0, SU2_MPI::GetComm());
+      else SU2_MPI::Recv(donorVars.data(), count, MPI_DOUBLE, src, 0, SU2_MPI::GetComm(), MPI_STATUS_IGNORE);
+
+      if (rank%2==0) SU2_MPI::Send(sendBuf.data(), count, MPI_DOUBLE, dst, 0, SU2_MPI::GetComm());
+      else SU2_MPI::Recv(donorVars.data(), count, MPI_DOUBLE, src, 0, SU2_MPI::GetComm(), MPI_STATUS_IGNORE);
+    }
+
+    const int donorRank = (rank-iStep+size) % size;
+    const auto firstDonor = partitioner.GetFirstIndexOnRank(donorRank);
+
+    for (const auto iPoint : targetsOfRank[donorRank]) {
+      const auto iDonor = map.donorIndex[iPoint] - firstDonor;
+      for (auto iVar = 0ul; iVar < nFields; ++iVar)
+        localVars(iPoint,iVar) = donorVars(iDonor,iVar);
+    }
+  }
+
+  /*--- Replay the diffusion passes, a point filled in pass "n" averages the
+   neighbors that were filled in earlier passes, exactly as when the map was
+   built. ---*/
+
+  SU2_OMP_PARALLEL
+  for (int iPass = 1; iPass <= map.nRecurse; ++iPass) {
+    SU2_OMP_FOR_DYN(roundUpDiv(nPointDomain,2*omp_get_num_threads()))
+    for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint) {
+      if (map.fillPass[iPoint] != iPass) continue;
+
+      /*--- Boundaries to boundaries and domain to domain. ---*/
+      const bool boundary_i = geometry->nodes->GetSolidBoundary(iPoint);
+
+      int nDonor = 0;
+
+      for (const auto jPoint : geometry->nodes->GetPoints(iPoint)) {
+        if (map.fillPass[jPoint] < 0 || map.fillPass[jPoint] >= iPass) continue;
+        if (boundary_i != geometry->nodes->GetSolidBoundary(jPoint)) continue;
+
+        nDonor++;
+
+        for (auto iVar = 0ul; iVar < localVars.cols(); ++iVar)
+          localVars(iPoint,iVar) += localVars(jPoint,iVar);
+      }
+
+      for (auto iVar = 0ul; iVar < localVars.cols(); ++iVar)
+        localVars(iPoint,iVar) /= nDonor;
+    }
+    END_SU2_OMP_FOR
+  }
+  END_SU2_OMP_PARALLEL
+
+  nRecurse = map.nRecurse;
+
+  }
 
   /*--- Move to Restart_Data in ascending order of global index, which is how a matching restart would have been read. ---*/
 
@@ -3798,61 +4747,88 @@ void CSolver::LoadInletProfile(CGeometry **geometry,
         cout<<"No Inlet Interpolation being used"<<endl;
       }
 
-      /*--- Loop through the nodes on this marker. ---*/
+      /*--- For point-matched profiles, match each vertex to its closest profile row
+       with an ADT over the profile points instead of a linear scan per vertex. The
+       map is kept so that later updates of a time-varying profile with unchanged
+       sample locations only re-apply the values. ---*/
 
-      for (auto iVertex = 0ul; iVertex < geometry[MESH_0]->nVertex[iMarker]; iVertex++) {
+      if (!Interpolate) {
 
-        const auto iPoint = geometry[MESH_0]->vertex[iMarker][iVertex]->GetNode();
-        const auto Coord = geometry[MESH_0]->nodes->GetCoord(iPoint);
+        if (InletProfileMatch.empty()) {
+          InletProfileMatch.resize(config->GetnMarker_All());
+          InletProfileMatchRows.assign(config->GetnMarker_All(), 0);
+        }
+        auto& vertexMatch = InletProfileMatch[iMarker];
+        const auto nVertexMarker = geometry[MESH_0]->nVertex[iMarker];
 
-        if (!Interpolate) {
+        if ((vertexMatch.size() != nVertexMarker) || (InletProfileMatchRows[iMarker] != nRows) ||
+            config->GetDynamic_Grid()) {
 
-          su2double min_dist = 1e16;
+          vertexMatch.assign(nVertexMarker, 0);
+          InletProfileMatchRows[iMarker] = nRows;
 
-          /*--- Find the distance to the closest point in our inlet profile data. ---*/
+          /*--- The first nDim columns of the profile are the sample coordinates. ---*/
 
-          for (auto iRow = 0ul; iRow < nRows; iRow++) {
+          vector<su2double> profileCoord(nRows*nDim);
+          for (auto iRow = 0ul; iRow < nRows; iRow++)
+            for (unsigned short iDim = 0; iDim < nDim; iDim++)
+              profileCoord[iRow*nDim+iDim] = Inlet_Data[iRow*nColumns+iDim];
 
-            /*--- Get the coords for this data point. ---*/
+          vector<unsigned long> profileRow(nRows);
+          iota(profileRow.begin(), profileRow.end(), 0ul);
 
-            const auto index = iRow*nColumns;
+          CADTPointsOnlyClass profileADT(nDim, nRows, profileCoord.data(), profileRow.data(), false);
 
-            const auto dist = GeometryToolbox::Distance(nDim, Coord, &Inlet_Data[index]);
+          for (auto iVertex = 0ul; iVertex < nVertexMarker; iVertex++) {
 
-            /*--- Check is this is the closest point and store data if so. ---*/
+            const auto iPoint = geometry[MESH_0]->vertex[iMarker][iVertex]->GetNode();
+            const auto Coord = geometry[MESH_0]->nodes->GetCoord(iPoint);
 
-            if (dist < min_dist) {
-              min_dist = dist;
-              for (auto iVar = 0ul; iVar < nColumns; iVar++)
-                Inlet_Values[iVar] = Inlet_Data[index+iVar];
-            }
+            su2double min_dist;
+            int rankID = 0;
+            profileADT.DetermineNearestNode(Coord, min_dist, vertexMatch[iVertex], rankID);
 
+            /*--- If the diff is less than the tolerance, match the two.
+            We could modify this to simply use the nearest neighbor, or
+            eventually add something more elaborate here for interpolation. ---*/
+
+            if (min_dist >= tolerance) {
+              unsigned long GlobalIndex = geometry[MESH_0]->nodes->GetGlobalIndex(iPoint);
+              cout << "WARNING: Did not find a match between the points in the inlet file\n";
+              cout << "and point " << GlobalIndex;
+              cout << std::scientific;
+              cout << " at location: [" << Coord[0] << ", " << Coord[1];
+              if (nDim==3) cout << ", " << Coord[2];
+              cout << "]\n";
+              cout << "Distance to closest point: " << min_dist << "\n";
+              cout << "Current tolerance:         " << tolerance << "\n\n";
+              cout << "You can increase the tolerance for point matching by changing the value\n";
+              cout << "of the option INLET_MATCHING_TOLERANCE in your *.cfg file." << endl;
+              local_failure++;
+              break;
+            }
           }
+        }
 
-          /*--- If the diff is less than the tolerance, match the two.
-          We could modify this to simply use the nearest neighbor, or
-          eventually add something more elaborate here for interpolation. ---*/
+        if (local_failure > 0) break;
+      }
 
-          if (min_dist < tolerance) {
+      /*--- Loop through the nodes on this marker. ---*/
 
-            solver[MESH_0][KIND_SOLVER]->SetInletAtVertex(Inlet_Values.data(), iMarker, iVertex);
+      for (auto iVertex = 0ul; iVertex < geometry[MESH_0]->nVertex[iMarker]; iVertex++) {
 
-          } else {
+        const auto iPoint = geometry[MESH_0]->vertex[iMarker][iVertex]->GetNode();
+        const auto Coord = geometry[MESH_0]->nodes->GetCoord(iPoint);
 
-            unsigned long GlobalIndex = geometry[MESH_0]->nodes->GetGlobalIndex(iPoint);
-            cout << "WARNING: Did not find a match between the points in the inlet file\n";
-            cout << "and point " << GlobalIndex;
-            cout << std::scientific;
-            cout << " at location: [" << Coord[0] << ", " << Coord[1];
-            if (nDim==3) cout << ", " << Coord[2];
-            cout << "]\n";
-            cout << "Distance to closest point: " << min_dist << "\n";
-            cout << "Current tolerance:         " << tolerance << "\n\n";
-            cout << "You can increase the tolerance for point matching by changing the value\n";
-            cout << "of the option INLET_MATCHING_TOLERANCE in your *.cfg file." << endl;
-            local_failure++;
-            break;
-          }
+        if (!Interpolate) {
+
+          /*--- Apply the values of the profile row matched to this vertex. ---*/
+
+          const auto index = InletProfileMatch[iMarker][iVertex]*nColumns;
+          for (auto iVar = 0ul; iVar < nColumns; iVar++)
+            Inlet_Values[iVar] = Inlet_Data[index+iVar];
+
+          solver[MESH_0][KIND_SOLVER]->SetInletAtVertex(Inlet_Values.data(), iMarker, iVertex);
 
         }
         else { // Interpolate
@@ -4256,7 +5232,7 @@ void CSolver::BasicLoadRestart(CGeometry *geometry, const CConfig *config, const
   /*--- Delete the class memory that is used to load the restart. ---*/
 
   delete [] Restart_Vars;  Restart_Vars = nullptr;
-  delete [] Restart_Data;  Restart_Data = nullptr;
+  FreeRestartData();
 
   /*--- Detect a wrong solution file ---*/
 
@@ -179,7 +179,10 @@ void CSpeciesSolver::LoadRestart(CGeometry** geometry, CSolver*** solver, CConfi
     /*--- Read the restart data from either an ASCII or binary SU2 file. ---*/
 
     if (config->GetRead_Binary_Restart()) {
-      Read_SU2_Restart_Binary(geometry[MESH_0], config, restart_filename);
+      /*--- The species variables follow the flow and turbulence variables,
+       the trailing output-only fields are skipped during the read. ---*/
+      Read_SU2_Restart_Binary(geometry[MESH_0], config, restart_filename,
+                              nDim + solver[MESH_0][FLOW_SOL]->GetnVar() + config->GetnTurbVar() + nVar);
     } else {
       Read_SU2_Restart_ASCII(geometry[MESH_0], config, restart_filename);
     }
@@ -291,8 +294,7 @@ void CSpeciesSolver::LoadRestart(CGeometry** geometry, CSolver*** solver, CConfi
 
     delete[] Restart_Vars;
     Restart_Vars = nullptr;
-    delete[] Restart_Data;
-    Restart_Data = nullptr;
+    FreeRestartData();
   }
   END_SU2_OMP_MASTER
   SU2_OMP_BARRIER
@@ -319,6 +321,10 @@ void CSpeciesSolver::Preprocessing(CGeometry* geometry, CSolver** solver_contain
   CommonPreprocessing(geometry, config, Output);
 }
 
+CNumericsSIMD* CSpeciesSolver::InstantiateEdgeNumerics(CSolver** solver_container, const CConfig* config) const {
+  return CNumericsSIMD::CreateSpeciesNumerics(*config, nDim, solver_container[FLOW_SOL]->GetNodes(), nVar);
+}
+
 void CSpeciesSolver::Viscous_Residual(unsigned long iEdge, CGeometry* geometry, CSolver** solver_container,
                                       CNumerics* numerics, CConfig* config) {
   /*--- Define an object to set solver specific numerics contribution. ---*/
@@ -465,12 +471,11 @@ su2double CSpeciesSolver::GetInletAtVertex(su2double *val_inlet,
 }
 
 void CSpeciesSolver::SetUniformInlet(const CConfig* config, unsigned short iMarker) {
-  /*--- Find BC string to the numeric-identifier. ---*/
   if (config->GetMarker_All_KindBC(iMarker) == INLET_FLOW) {
-    const string Marker_Tag = config->GetMarker_All_TagBound(iMarker);
+    const su2double* inlet_species = config->GetInlet_SpeciesVal(iMarker);
     for (unsigned long iVertex = 0; iVertex < nVertex[iMarker]; iVertex++) {
       for (unsigned short iVar = 0; iVar < nVar; iVar++) {
-        Inlet_SpeciesVars[iMarker][iVertex][iVar] = config->GetInlet_SpeciesVal(Marker_Tag)[iVar];
+        Inlet_SpeciesVars[iMarker][iVertex][iVar] = inlet_species[iVar];
       }
     }
   }
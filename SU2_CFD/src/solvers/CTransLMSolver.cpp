@@ -245,9 +245,17 @@ void CTransLMSolver::ImplicitEuler_Iteration(CGeometry *geometry, CSolver **solv
 void CTransLMSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_container,
                                      CNumerics **numerics_container, CConfig *config, unsigned short iMesh) {
 
-  CNumerics* numerics = numerics_container[CONV_TERM];
+  /*--- The convective and viscous residuals share the edge stencil and most
+   of the edge data, they are accumulated in a single sweep here to avoid
+   traversing the edges (and re-fetching the flow data) twice. ---*/
+
+  CNumerics* conv_numerics = numerics_container[CONV_TERM];
+  CNumerics* visc_numerics = numerics_container[VISC_TERM];
+
+  auto* flowNodes = solver_container[FLOW_SOL]->GetNodes();
 
   su2double *trans_var_i, *trans_var_j, *U_i, *U_j;
+  const su2double *Normal;
   unsigned long iEdge, iPoint, jPoint;
 
   for (iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
@@ -255,72 +263,50 @@ void CTransLMSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_conta
     /*--- Points in edge and normal vectors ---*/
     iPoint = geometry->edges->GetNode(iEdge,0);
     jPoint = geometry->edges->GetNode(iEdge,1);
-    numerics->SetNormal(geometry->edges->GetNormal(iEdge));
+    Normal = geometry->edges->GetNormal(iEdge);
 
     /*--- Conservative variables w/o reconstruction ---*/
-    U_i = solver_container[FLOW_SOL]->GetNodes()->GetSolution(iPoint);
-    U_j = solver_container[FLOW_SOL]->GetNodes()->GetSolution(jPoint);
-    numerics->SetConservative(U_i, U_j);
+    U_i = flowNodes->GetSolution(iPoint);
+    U_j = flowNodes->GetSolution(jPoint);
 
     /*--- Transition variables w/o reconstruction ---*/
     trans_var_i = nodes->GetSolution(iPoint);
     trans_var_j = nodes->GetSolution(jPoint);
-    numerics->SetTransVar(trans_var_i, trans_var_j);
 
-    /*--- Add and subtract Residual ---*/
-    numerics->ComputeResidual(Residual, Jacobian_i, Jacobian_j, config);
+    /*--- Convective part: add and subtract residual ---*/
+
+    conv_numerics->SetNormal(Normal);
+    conv_numerics->SetConservative(U_i, U_j);
+    conv_numerics->SetTransVar(trans_var_i, trans_var_j);
+
+    conv_numerics->ComputeResidual(Residual, Jacobian_i, Jacobian_j, config);
     LinSysRes.AddBlock(iPoint, Residual);
     LinSysRes.SubtractBlock(jPoint, Residual);
 
     /*--- Implicit part ---*/
     Jacobian.UpdateBlocks(iEdge, iPoint, jPoint, Jacobian_i, Jacobian_j);
 
-  }
-
-}
-
-
-void CTransLMSolver::Viscous_Residual(CGeometry *geometry, CSolver **solver_container, CNumerics **numerics_container,
-                                        CConfig *config, unsigned short iMesh, unsigned short iRKStep) {
-
-  CNumerics* numerics = numerics_container[VISC_TERM];
-
-  unsigned long iEdge, iPoint, jPoint;
-
-  for (iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
-
-    /*--- Points in edge ---*/
-    iPoint = geometry->edges->GetNode(iEdge,0);
-    jPoint = geometry->edges->GetNode(iEdge,1);
+    /*--- Viscous part: coordinates, viscosities, and solution gradients ---*/
 
-    /*--- Points coordinates, and normal vector ---*/
-    numerics->SetCoord(geometry->nodes->GetCoord(iPoint),
-                     geometry->nodes->GetCoord(jPoint));
+    visc_numerics->SetCoord(geometry->nodes->GetCoord(iPoint),
+                            geometry->nodes->GetCoord(jPoint));
+    visc_numerics->SetNormal(Normal);
+    visc_numerics->SetConservative(U_i, U_j);
 
-    numerics->SetNormal(geometry->edges->GetNormal(iEdge));
+    visc_numerics->SetLaminarViscosity(flowNodes->GetLaminarViscosity(iPoint),
+                                       flowNodes->GetLaminarViscosity(jPoint));
+    visc_numerics->SetEddyViscosity(flowNodes->GetEddyViscosity(iPoint),
+                                    flowNodes->GetEddyViscosity(jPoint));
 
-    /*--- Conservative variables w/o reconstruction ---*/
-    numerics->SetConservative(solver_container[FLOW_SOL]->GetNodes()->GetSolution(iPoint),
-                              solver_container[FLOW_SOL]->GetNodes()->GetSolution(jPoint));
-
-    /*--- Laminar Viscosity ---*/
-    numerics->SetLaminarViscosity(solver_container[FLOW_SOL]->GetNodes()->GetLaminarViscosity(iPoint),
-                                  solver_container[FLOW_SOL]->GetNodes()->GetLaminarViscosity(jPoint));
-    /*--- Eddy Viscosity ---*/
-    numerics->SetEddyViscosity(solver_container[FLOW_SOL]->GetNodes()->GetEddyViscosity(iPoint),
-                               solver_container[FLOW_SOL]->GetNodes()->GetEddyViscosity(jPoint));
-
-    /*--- Transition variables w/o reconstruction, and its gradients ---*/
-    numerics->SetTransVar(nodes->GetSolution(iPoint), nodes->GetSolution(jPoint));
-    numerics->SetTransVarGradient(nodes->GetGradient(iPoint), nodes->GetGradient(jPoint));
+    visc_numerics->SetTransVar(trans_var_i, trans_var_j);
+    visc_numerics->SetTransVarGradient(nodes->GetGradient(iPoint), nodes->GetGradient(jPoint));
 
 //    ToDo: The flow solvers do not use the conservative variable gradients
-//    numerics->SetConsVarGradient(solver_container[FLOW_SOL]->GetNodes()->GetGradient(iPoint),
-//                                 solver_container[FLOW_SOL]->GetNodes()->GetGradient(jPoint));
-
+//    visc_numerics->SetConsVarGradient(flowNodes->GetGradient(iPoint),
+//                                      flowNodes->GetGradient(jPoint));
 
     /*--- Compute residual, and Jacobians ---*/
-    numerics->ComputeResidual(Residual, Jacobian_i, Jacobian_j, config);
+    visc_numerics->ComputeResidual(Residual, Jacobian_i, Jacobian_j, config);
 
     /*--- Add and subtract residual, and update Jacobians ---*/
     LinSysRes.SubtractBlock(iPoint, Residual);
@@ -329,6 +315,15 @@ void CTransLMSolver::Viscous_Residual(CGeometry *geometry, CSolver **solver_cont
     Jacobian.UpdateBlocksSub(iEdge, iPoint, jPoint, Jacobian_i, Jacobian_j);
 
   }
+
+}
+
+
+void CTransLMSolver::Viscous_Residual(CGeometry *geometry, CSolver **solver_container, CNumerics **numerics_container,
+                                        CConfig *config, unsigned short iMesh, unsigned short iRKStep) {
+
+  /*--- Accumulated together with the convective fluxes in Upwind_Residual,
+   both terms use the same edge stencil and mostly the same data. ---*/
 }
 
 void CTransLMSolver::Source_Residual(CGeometry *geometry, CSolver **solver_container,
@@ -339,10 +334,7 @@ void CTransLMSolver::Source_Residual(CGeometry *geometry, CSolver **solver_conta
   unsigned long iPoint;
   su2double gamma_sep = 0.0;
 
-  //cout << "Setting Trans residual -AA " << endl;
-  cout << "\nBeginAA" << endl;
   for (iPoint = 0; iPoint < geometry->GetnPointDomain(); iPoint++) {
-    cout << "\niPoint: " << iPoint << endl;
 
     /*--- Conservative variables w/o reconstruction ---*/
 
@@ -400,10 +400,9 @@ void CTurbSASolver::BC_HeatFlux_Wall(CGeometry *geometry, CSolver **solver_conta
 
   const bool implicit = (config->GetKind_TimeIntScheme() == EULER_IMPLICIT);
   bool rough_wall = false;
-  string Marker_Tag = config->GetMarker_All_TagBound(val_marker);
   WALL_TYPE WallType;
   su2double Roughness_Height;
-  tie(WallType, Roughness_Height) = config->GetWallRoughnessProperties(Marker_Tag);
+  tie(WallType, Roughness_Height) = config->GetWallRoughnessProperties(val_marker);
   if (WallType == WALL_TYPE::ROUGH) rough_wall = true;
 
   /*--- The dirichlet condition is used only without wall function, otherwise the
@@ -225,13 +225,21 @@ void CTurbSSTSolver::Postprocessing(CGeometry *geometry, CSolver **solver_contai
 
     su2double F2 = nodes->GetF2blending(iPoint);
 
-    /*--- Compute the eddy viscosity ---*/
+    /*--- Compute the eddy viscosity, preaccumulated to keep only the dependency
+     on the five inputs on the tape instead of the chain of intermediates. ---*/
 
     su2double kine  = nodes->GetSolution(iPoint,0);
     su2double omega = nodes->GetSolution(iPoint,1);
+
+    AD::StartPreacc();
+    AD::SetPreaccIn(rho, kine, omega, F2, VorticityMag);
+
     su2double zeta  = min(1.0/omega, a1/(VorticityMag*F2));
     su2double muT   = max(rho*kine*zeta,0.0);
 
+    AD::SetPreaccOut(muT);
+    AD::EndPreacc();
+
     nodes->SetmuT(iPoint,muT);
 
   }
@@ -343,9 +351,8 @@ void CTurbSSTSolver::BC_HeatFlux_Wall(CGeometry *geometry, CSolver **solver_cont
   const bool implicit = (config->GetKind_TimeIntScheme() == EULER_IMPLICIT);
 
   bool rough_wall = false;
-  string Marker_Tag = config->GetMarker_All_TagBound(val_marker);
   WALL_TYPE WallType; su2double Roughness_Height;
-  tie(WallType, Roughness_Height) = config->GetWallRoughnessProperties(Marker_Tag);
+  tie(WallType, Roughness_Height) = config->GetWallRoughnessProperties(val_marker);
   if (WallType == WALL_TYPE::ROUGH) rough_wall = true;
 
   /*--- Evaluate nu tilde at the closest point to the surface using the wall functions. ---*/
@@ -219,8 +219,13 @@ void CTurbSolver::LoadRestart(CGeometry** geometry, CSolver*** solver, CConfig*
   SU2_OMP_MASTER {
     /*--- Read the restart data from either an ASCII or binary SU2 file. ---*/
 
-    if (config->GetRead_Binary_Restart()) {
-      Read_SU2_Restart_Binary(geometry[MESH_0], config, restart_filename);
+    if (config->GetRead_Surface_Restart()) {
+      Read_SU2_Restart_Surface(geometry[MESH_0], config, restart_filename);
+    } else if (config->GetRead_Binary_Restart()) {
+      /*--- The turbulence variables directly follow the flow variables, the
+       trailing output-only fields are skipped during the read. ---*/
+      Read_SU2_Restart_Binary(geometry[MESH_0], config, restart_filename,
+                              nDim + solver[MESH_0][FLOW_SOL]->GetnVar() + nVar);
     } else {
       Read_SU2_Restart_ASCII(geometry[MESH_0], config, restart_filename);
     }
@@ -243,31 +248,55 @@ void CTurbSolver::LoadRestart(CGeometry** geometry, CSolver*** solver, CConfig*
 
     /*--- Load data from the restart into correct containers. ---*/
 
-    unsigned long counter = 0;
-    for (auto iPoint_Global = 0ul; iPoint_Global < geometry[MESH_0]->GetGlobal_nPointDomain(); iPoint_Global++) {
-      /*--- Retrieve local index. If this node from the restart file lives
-       on the current processor, we will load and instantiate the vars. ---*/
+    if (config->GetRead_Surface_Restart()) {
 
-      const auto iPoint_Local = geometry[MESH_0]->GetGlobal_to_Local_Point(iPoint_Global);
+      /*--- Sparse surface restart, only the marker-adjacent points are in the
+       file, the interior keeps the free-stream values set on construction. ---*/
 
-      if (iPoint_Local > -1) {
-        /*--- We need to store this point's data, so jump to the correct
-         offset in the buffer of data from the restart file and load it. ---*/
-
-        const auto index = counter * Restart_Vars[1] + skipVars;
+      for (auto iRecord = 0ul; iRecord < Restart_Points.size(); iRecord++) {
+        const auto iPoint_Local = geometry[MESH_0]->GetGlobal_to_Local_Point(Restart_Points[iRecord]);
+        const auto index = iRecord * Restart_Vars[1] + skipVars;
         for (auto iVar = 0u; iVar < nVar; iVar++) nodes->SetSolution(iPoint_Local, iVar, Restart_Data[index + iVar]);
+      }
+
+    } else {
+
+      unsigned long counter = 0;
+      for (auto iPoint_Global = 0ul; iPoint_Global < geometry[MESH_0]->GetGlobal_nPointDomain(); iPoint_Global++) {
+        /*--- Retrieve local index. If this node from the restart file lives
+         on the current processor, we will load and instantiate the vars. ---*/
+
+        const auto iPoint_Local = geometry[MESH_0]->GetGlobal_to_Local_Point(iPoint_Global);
+
+        if (iPoint_Local > -1) {
+          /*--- We need to store this point's data, so jump to the correct
+           offset in the buffer of data from the restart file and load it. ---*/
 
-        /*--- Increment the overall counter for how many points have been loaded. ---*/
-        counter++;
+          const auto index = counter * Restart_Vars[1] + skipVars;
+          for (auto iVar = 0u; iVar < nVar; iVar++) nodes->SetSolution(iPoint_Local, iVar, Restart_Data[index + iVar]);
+
+          /*--- Dual-snapshot restart, the same file carries the previous time
+           step as a second data block, place it in the time-n container. ---*/
+
+          if (Restart_Data_n != nullptr) {
+            for (auto iVar = 0u; iVar < nVar; iVar++)
+              nodes->Set_Solution_time_n(iPoint_Local, iVar, Restart_Data_n[index + iVar]);
+          }
+
+          /*--- Increment the overall counter for how many points have been loaded. ---*/
+          counter++;
+        }
       }
-    }
 
-    /*--- Detect a wrong solution file ---*/
+      /*--- Detect a wrong solution file ---*/
+
+      if (counter != nPointDomain) {
+        SU2_MPI::Error(string("The solution file ") + restart_filename + string(" does not match with the mesh file!\n") +
+                           string("This can be caused by empty lines at the end of the file."),
+                       CURRENT_FUNCTION);
+      }
 
-    if (counter != nPointDomain) {
-      SU2_MPI::Error(string("The solution file ") + restart_filename + string(" does not match with the mesh file!\n") +
-                         string("This can be caused by empty lines at the end of the file."),
-                     CURRENT_FUNCTION);
+      Restart_TimeN_Loaded = (Restart_Data_n != nullptr);
     }
 
   }  // end SU2_OMP_MASTER, pre and postprocessing are thread-safe.
@@ -324,8 +353,7 @@ void CTurbSolver::LoadRestart(CGeometry** geometry, CSolver*** solver, CConfig*
 
     delete[] Restart_Vars;
     Restart_Vars = nullptr;
-    delete[] Restart_Data;
-    Restart_Data = nullptr;
+    FreeRestartData();
   }
   END_SU2_OMP_MASTER
   SU2_OMP_BARRIER
@@ -46,6 +46,7 @@ CDiscAdjVariable::CDiscAdjVariable(const su2double* sol, unsigned long npoint, u
 }
 
 void CDiscAdjVariable::Set_External_To_DualTimeDer() {
+  MaterializeExternal();
   assert(External.size() == DualTime_Derivative.size());
   parallelCopy(External.size(), DualTime_Derivative.data(), External.data());
 }
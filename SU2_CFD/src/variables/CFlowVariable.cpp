@@ -99,6 +99,18 @@ CFlowVariable::CFlowVariable(unsigned long npoint, unsigned long ndim, unsigned
   }
 }
 
+void CFlowVariable::TrimHaloAllocation(unsigned long npointdomain) {
+  /*--- The multigrid truncation error and the limiter min/max fields are only
+   *    accessed for domain points (the latter only without periodic BCs). ---*/
+
+  Res_TruncError.resize(npointdomain, nVar) = su2double(0.0);
+
+  if (Solution_Max.size() > 0) {
+    Solution_Max.resize(npointdomain, nPrimVarGrad) = su2double(0.0);
+    Solution_Min.resize(npointdomain, nPrimVarGrad) = su2double(0.0);
+  }
+}
+
 void CFlowVariable::SetSolution_New() {
   assert(Solution_New.size() == Solution.size());
   parallelCopy(Solution.size(), Solution.data(), Solution_New.data());
@@ -40,8 +40,31 @@ CMeshVariable::CMeshVariable(unsigned long npoint, unsigned long ndim, CConfig *
 
   /*--- Initialize the variables necessary when the problem is time domain ---*/
   if (config->GetTime_Domain()) {
-    Solution_time_n.resize(nPoint,nDim) = su2double(0.0);
-    Solution_time_n1.resize(nPoint,nDim) = su2double(0.0);
+    compactHistory = config->GetCompact_Mesh_History();
+    if (compactHistory) {
+      /*--- The displacements relative to Mesh_Coord are stored in single precision,
+       halving the memory footprint of the motion history on large meshes. ---*/
+      Disp_n_Compact.resize(nPoint,nDim) = 0.0f;
+      Disp_n1_Compact.resize(nPoint,nDim) = 0.0f;
+    }
+    else {
+      Solution_time_n.resize(nPoint,nDim) = su2double(0.0);
+      Solution_time_n1.resize(nPoint,nDim) = su2double(0.0);
+    }
+  }
+}
+
+void CMeshVariable::Shift_DispHistory() {
+
+  if (compactHistory) {
+    for (unsigned long k = 0; k < Disp_n_Compact.size(); ++k) {
+      Disp_n1_Compact.data()[k] = Disp_n_Compact.data()[k];
+      Disp_n_Compact.data()[k] = SU2_TYPE::GetValue(Solution.data()[k]);
+    }
+  }
+  else {
+    Set_Solution_time_n1();
+    Set_Solution_time_n();
   }
 }
 
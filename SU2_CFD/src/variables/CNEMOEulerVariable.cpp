@@ -218,8 +218,11 @@ bool CNEMOEulerVariable::Cons2PrimVar(su2double *U, su2double *V,
     sqvel            += V[VEL_INDEX+iDim]*V[VEL_INDEX+iDim];
   }
 
-  /*--- Assign temperatures ---*/
-  const auto& T = fluidmodel->ComputeTemperatures(rhos, rhoE, rhoEve, 0.5*rho*sqvel);
+  /*--- Assign temperatures, warm starting the iterative solve for the
+   vibrational temperature from the previous value of this point (zero
+   before the first update, which disables the warm start). ---*/
+  const su2double Tve_old = V[TVE_INDEX];
+  const auto& T = fluidmodel->ComputeTemperatures(rhos, rhoE, rhoEve, 0.5*rho*sqvel, Tve_old);
 
   /*--- Temperatures ---*/
   V[T_INDEX]   = T[0];
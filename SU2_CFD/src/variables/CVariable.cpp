@@ -27,6 +27,10 @@
 
 #include "../../include/variables/CVariable.hpp"
 #include "../../../Common/include/parallelization/omp_structure.hpp"
+#include "../../../Common/include/toolboxes/allocation_toolbox.hpp"
+
+unsigned long CVariable::ExternalPotentialBytes = 0;
+unsigned long CVariable::ExternalMaterializedBytes = 0;
 
 CVariable::CVariable(unsigned long npoint, unsigned long nvar, const CConfig *config) {
 
@@ -53,20 +57,38 @@ CVariable::CVariable(unsigned long npoint, unsigned long ndim, unsigned long nva
   nVar = nvar;
 
   /*--- Allocate fields common to all problems. Do not allocate fields
-   that are specific to one solver, i.e. not common, in this class. ---*/
-  Solution.resize(nPoint,nVar) = su2double(0.0);
+   that are specific to one solver, i.e. not common, in this class.
+   The solution fields are initialized in parallel, which doubles as a
+   NUMA-aware first touch: their pages are mapped close to the threads
+   that later stream over them in the point loops, instead of all pages
+   landing on the socket of the master thread. ---*/
+  Solution.resize(nPoint,nVar);
 
-  Solution_Old.resize(nPoint,nVar) = su2double(0.0);
+  Solution_Old.resize(nPoint,nVar);
 
   if (config->GetTime_Domain())
-    Solution_time_n.resize(nPoint,nVar) = su2double(0.0);
+    Solution_time_n.resize(nPoint,nVar);
 
   if (config->GetTime_Marching() != TIME_MARCHING::STEADY)
-    Solution_time_n1.resize(nPoint,nVar) = su2double(0.0);
+    Solution_time_n1.resize(nPoint,nVar);
+
+  SU2_OMP_PARALLEL {
+    parallelSet(Solution.size(), su2double(0.0), Solution.data());
+    parallelSet(Solution_Old.size(), su2double(0.0), Solution_Old.data());
+    parallelSet(Solution_time_n.size(), su2double(0.0), Solution_time_n.data());
+    parallelSet(Solution_time_n1.size(), su2double(0.0), Solution_time_n1.data());
+  } END_SU2_OMP_PARALLEL
+
+  if (config->GetNumaDiagnostics())
+    MemoryAllocation::ReportNumaPlacement(Solution.data(), Solution.size()*sizeof(su2double),
+                                          "CVariable Solution");
 
   if (config->GetDiscrete_Adjoint()) {
+    /*--- The external container is materialized lazily on the first write
+     (see MaterializeExternal), adjoint solvers that never receive cross
+     terms do not pay for the storage. An empty container reads as zero. ---*/
     if (adjoint && config->GetMultizone_Problem())
-      External.resize(nPoint,nVar) = su2double(0.0);
+      ExternalPotentialBytes += nPoint*nVar*sizeof(su2double);
 
     if (!adjoint) {
       AD_InputIndex.resize(nPoint,nVar) = -1;
@@ -114,7 +136,16 @@ void CVariable::Restore_BGSSolution_k() {
   parallelCopy(SolutionExtra_BGS_k.size(), SolutionExtra_BGS_k.data(), SolutionExtra.data());
 }
 
-void CVariable::SetExternalZero() { parallelSet(External.size(), 0.0, External.data()); }
+void CVariable::SetExternalZero() {
+  /*--- A container that was never materialized already reads as zero. ---*/
+  parallelSet(External.size(), 0.0, External.data());
+}
+
+void CVariable::MaterializeExternal() {
+  if (ExternalMaterialized()) return;
+  External.resize(nPoint,nVar) = su2double(0.0);
+  ExternalMaterializedBytes += External.size()*sizeof(su2double);
+}
 
 void CVariable::RegisterSolution(bool input) {
   RegisterContainer(input, Solution, input? AD_InputIndex : AD_OutputIndex);
@@ -169,10 +169,18 @@ int main(int argc, char *argv[]) {
 
     if (rank == MASTER_NODE) cout << endl << "----------------------- Preprocessing computations ----------------------" << endl;
 
-    /*--- Compute elements surrounding points, points surrounding points ---*/
+    /*--- Compute elements surrounding points, points surrounding points. Without a
+     volume deformation only the marker-adjacent part of the connectivity is ever
+     queried, the surface-restricted build skips the volume preprocessing. ---*/
 
-    if (rank == MASTER_NODE) cout << "Setting local point connectivity." <<endl;
-    geometry_container[iZone]->SetPoint_Connectivity();
+    if (config_container[iZone]->GetDesign_Variable(0) != NO_DEFORMATION) {
+      if (rank == MASTER_NODE) cout << "Setting local point connectivity." <<endl;
+      geometry_container[iZone]->SetPoint_Connectivity();
+    }
+    else {
+      if (rank == MASTER_NODE) cout << "Setting local point connectivity on the surfaces." <<endl;
+      geometry_container[iZone]->SetBoundPoint_Connectivity();
+    }
 
     /*--- Check the orientation before computing geometrical quantities ---*/
 
@@ -178,10 +178,13 @@ int main(int argc, char *argv[]) {
   }
 
 
-  /*--- Compute elements surrounding points, points surrounding points ---*/
+  /*--- Compute elements surrounding points, points surrounding points. All the
+   geometry evaluations only query the adjacency of marker points (curvature,
+   boundary control volumes, airfoil sections), so the surface-restricted
+   connectivity is enough and skips the volume part of the preprocessing. ---*/
 
-  if (rank == MASTER_NODE) cout << "Setting local point connectivity." <<endl;
-  geometry_container[ZONE_0]->SetPoint_Connectivity();
+  if (rank == MASTER_NODE) cout << "Setting local point connectivity on the surfaces." <<endl;
+  geometry_container[ZONE_0]->SetBoundPoint_Connectivity();
 
   /*--- Check the orientation before computing geometrical quantities ---*/
 
@@ -190,7 +193,8 @@ int main(int argc, char *argv[]) {
     geometry_container[ZONE_0]->Check_IntElem_Orientation(config_container[ZONE_0]);
   }
 
-  /*--- Create the edge structure ---*/
+  /*--- Create the edge structure (covering the marker-adjacent elements only,
+   same restriction as the point connectivity) ---*/
 
   if (rank == MASTER_NODE) cout << "Identify edges and vertices." <<endl;
   geometry_container[ZONE_0]->SetEdges(); geometry_container[ZONE_0]->SetVertex(config_container[ZONE_0]);